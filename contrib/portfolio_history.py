@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+import argparse
+import glob
+import logging
+import re
+
+
+def parse_commandline():
+    """Parse commandline arguments"""
+    epilog = """
+This script builds the history file that is read by cvc5 with
+"--portfolio-history=FILE" to try the portfolio configurations that solved
+most inputs of a logic first.
+
+It reads the output files of a benchmark run with "--use-portfolio" and
+"-o portfolio". A configuration counts as tried for each line
+(portfolio "<options>" ...) and as solved for each line
+(portfolio-success "<options>"). The counts are added to the counts already
+stored in the history file, if it exists, so that the history of several runs
+can be accumulated. All output files are expected to be for the given logic.
+    """
+    parser = argparse.ArgumentParser(
+        description='build a portfolio history from portfolio outputs',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        epilog=epilog)
+    parser.add_argument('logic', help='the logic of the benchmarks')
+    parser.add_argument('basedir', help='path of benchmark results')
+    parser.add_argument('-v', '--verbose',
+                        action='store_true', help='be more verbose')
+    parser.add_argument('--history', default='portfolio-history.txt',
+                        help='path of the history file')
+    parser.add_argument('--pattern', default='**/output.log',
+                        help='pattern of the output files within basedir')
+    return parser.parse_args()
+
+
+def load_history(filename):
+    """Load [logic, options] -> [solved, tried] from the history file"""
+    history = {}
+    try:
+        with open(filename) as fin:
+            for line in fin:
+                line = line.rstrip('\n')
+                if not line or line.startswith('#'):
+                    continue
+                parts = line.split(' ', 3)
+                options = parts[3] if len(parts) > 3 else ''
+                history[(parts[0], options)] = [int(parts[1]), int(parts[2])]
+    except FileNotFoundError:
+        pass
+    return history
+
+
+def save_history(filename, history):
+    """Store the history in the format read by --portfolio-history"""
+    with open(filename, 'w') as fout:
+        fout.write('# <logic> <solved> <tried> <options>\n')
+        for (logic, options), (solved, tried) in sorted(history.items()):
+            fout.write('{} {} {} {}\n'.format(logic, solved, tried, options))
+
+
+def main(args):
+    tried_re = re.compile('^\\(portfolio "([^"]*)"', re.MULTILINE)
+    solved_re = re.compile('^\\(portfolio-success "([^"]*)"\\)', re.MULTILINE)
+    history = load_history(args.history)
+    files = 0
+    for file in glob.iglob('{}/{}'.format(args.basedir, args.pattern),
+                           recursive=True):
+        content = open(file).read()
+        for options in tried_re.findall(content):
+            history.setdefault((args.logic, options), [0, 0])[1] += 1
+        for options in solved_re.findall(content):
+            history.setdefault((args.logic, options), [0, 0])[0] += 1
+        files += 1
+    logging.info('Read {} output files'.format(files))
+    for (logic, options), (solved, tried) in sorted(history.items()):
+        if logic == args.logic:
+            logging.debug('{:5} / {:5}: {}'.format(solved, tried, options))
+    logging.info('Writing history to {}'.format(args.history))
+    save_history(args.history, history)
+
+
+if __name__ == "__main__":
+    logging.basicConfig(format='[%(levelname)s] %(message)s')
+    args = parse_commandline()
+    if args.verbose:
+        logging.getLogger().setLevel(level=logging.DEBUG)
+    else:
+        logging.getLogger().setLevel(level=logging.INFO)
+    main(args)
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+import argparse
+import concurrent.futures
+import logging
+import os
+import shlex
+import signal
+import subprocess
+import tempfile
+import threading
+
+
+def parse_commandline():
+    """Parse commandline arguments"""
+    epilog = """
+This script solves an SMT-LIB benchmark by cube-and-conquer, where the cubes
+may be solved on other machines.
+
+In the first stage, cvc5 is run on the benchmark with "--compute-partitions" to
+write the cubes, one per line, to a file. If this run answers "sat", this is
+the result. Otherwise, in the second stage, each cube is asserted before the
+first "(check-sat)" of the benchmark and the resulting benchmarks are solved by
+a pool of workers. The result is "sat" as soon as some cube is sat, in which
+case the remaining workers are stopped, and "unsat" if all cubes are unsat.
+
+Each worker runs the given worker command, where "{cvc5}" is replaced by the
+path of the cvc5 binary, "{options}" by the worker options and "{file}" by the
+path of the benchmark of the cube. The command may for example log into
+another machine, e.g. "ssh host {cvc5} {options} {file}", provided that the
+benchmark files are accessible there, e.g. in a shared directory given by
+--workdir.
+    """
+    parser = argparse.ArgumentParser(
+        description='solve a benchmark by cube-and-conquer',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        epilog=epilog)
+    parser.add_argument('benchmark', help='the benchmark to solve')
+    parser.add_argument('-v', '--verbose',
+                        action='store_true', help='be more verbose')
+    parser.add_argument('--cvc5', default='cvc5', help='the cvc5 binary')
+    parser.add_argument('--partitions', type=int, default=8,
+                        help='the number of partitions to make')
+    parser.add_argument('--partition-options',
+                        default='--partition-when=climit',
+                        help='options for making the partitions')
+    parser.add_argument('--worker-options', default='',
+                        help='options for solving the cubes')
+    parser.add_argument('--worker-cmd', default='{cvc5} {options} {file}',
+                        help='the command of a worker')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count(),
+                        help='the number of workers')
+    parser.add_argument('--workdir', default=None,
+                        help='directory for the cubes and their benchmarks')
+    return parser.parse_args()
+
+
+class Runner:
+    """Runs commands, which can all be stopped at once"""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.procs = []
+        self.stopped = False
+
+    def run(self, cmd):
+        """Run the given command and return its first line of output"""
+        with self.lock:
+            if self.stopped:
+                return 'unknown'
+            logging.debug('Running {}'.format(cmd))
+            # in its own session, so that the command and its children can be
+            # killed together
+            proc = subprocess.Popen(cmd, shell=True, stdout=subprocess.PIPE,
+                                    stderr=subprocess.DEVNULL,
+                                    universal_newlines=True,
+                                    start_new_session=True)
+            self.procs.append(proc)
+        out, _ = proc.communicate()
+        return out.split('\n')[0].strip()
+
+    def stop(self):
+        """Kill all running commands and do not start new ones"""
+        with self.lock:
+            self.stopped = True
+            for proc in self.procs:
+                if proc.poll() is None:
+                    try:
+                        os.killpg(proc.pid, signal.SIGKILL)
+                    except ProcessLookupError:
+                        # terminated in the meantime
+                        pass
+
+
+def make_partitions(args, workdir):
+    """Compute the cubes, returns the result and the list of cubes"""
+    cubes_file = os.path.join(workdir, 'cubes.txt')
+    cmd = '{} --compute-partitions={} --write-partitions-to={} {} {}'.format(
+        shlex.quote(args.cvc5), args.partitions, shlex.quote(cubes_file),
+        args.partition_options, shlex.quote(args.benchmark))
+    result = Runner().run(cmd)
+    cubes = []
+    if os.path.exists(cubes_file):
+        with open(cubes_file) as fin:
+            cubes = [line.strip() for line in fin if line.strip()]
+    return result, cubes
+
+
+def make_cube_benchmark(content, cube, filename):
+    """Write the benchmark content with the cube asserted to filename"""
+    pos = content.find('(check-sat)')
+    if pos == -1:
+        raise Exception('The benchmark has no (check-sat)')
+    with open(filename, 'w') as fout:
+        fout.write(content[:pos])
+        fout.write('(assert {})\n'.format(cube))
+        fout.write(content[pos:])
+
+
+def solve_cubes(args, workdir, cubes):
+    """Solve the cubes with a pool of workers, returns the result"""
+    content = open(args.benchmark).read()
+    cmds = []
+    for i, cube in enumerate(cubes):
+        filename = os.path.join(workdir, 'cube{}.smt2'.format(i))
+        make_cube_benchmark(content, cube, filename)
+        cmds.append(args.worker_cmd.format(cvc5=shlex.quote(args.cvc5),
+                                           options=args.worker_options,
+                                           file=shlex.quote(filename)))
+    result = 'unsat'
+    runner = Runner()
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+        futures = {pool.submit(runner.run, cmd): i
+                   for i, cmd in enumerate(cmds)}
+        for future in concurrent.futures.as_completed(futures):
+            res = future.result()
+            logging.info('Cube {}: {}'.format(futures[future], res))
+            if res == 'sat':
+                runner.stop()
+                return 'sat'
+            if res != 'unsat':
+                result = 'unknown'
+    return result
+
+
+def main(args):
+    with tempfile.TemporaryDirectory(dir=args.workdir) as workdir:
+        result, cubes = make_partitions(args, workdir)
+        logging.info('Made {} cubes, partitioning result: {}'.format(
+            len(cubes), result))
+        if result == 'sat' or not cubes:
+            return result
+        return solve_cubes(args, workdir, cubes)
+
+
+if __name__ == "__main__":
+    logging.basicConfig(format='[%(levelname)s] %(message)s')
+    args = parse_commandline()
+    if args.verbose:
+        logging.getLogger().setLevel(level=logging.DEBUG)
+    else:
+        logging.getLogger().setLevel(level=logging.WARNING)
+    print(main(args))
@@ -4250,6 +4250,29 @@ CVC5_EXPORT Cvc5Term cvc5_simplify(Cvc5* cvc5, Cvc5Term term, bool apply_subs);
  */
 CVC5_EXPORT void cvc5_assert_formula(Cvc5* cvc5, Cvc5Term term);
 
+/**
+ * Assert a list of formulas, in order.
+ *
+ * This is equivalent to calling `cvc5_assert_formula()` for each of the given
+ * formulas, but performs the checks and the bookkeeping of the assertions
+ * once for all formulas.
+ *
+ * SMT-LIB:
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. code:: smtlib
+ *
+ *     (assert <term>)*
+ * \endverbatim
+ *
+ * @param cvc5 The solver instance.
+ * @param size The number of formulas.
+ * @param terms The formulas to assert.
+ */
+CVC5_EXPORT void cvc5_assert_formulas(Cvc5* cvc5,
+                                      size_t size,
+                                      const Cvc5Term terms[]);
+
 /**
  * Check satisfiability.
  *
@@ -4285,6 +4308,22 @@ CVC5_EXPORT Cvc5Result cvc5_check_sat(Cvc5* cvc5);
 CVC5_EXPORT Cvc5Result cvc5_check_sat_assuming(Cvc5* cvc5,
                                                size_t size,
                                                const Cvc5Term assumptions[]);
+
+/**
+ * Interrupt the current satisfiability check (or other solving call such as
+ * getting an interpolant), or the next one if no such call is running. The
+ * interrupted call then returns an unknown result with explanation
+ * `CVC5_UNKNOWN_EXPLANATION_INTERRUPTED`.
+ *
+ * @note This is the only function on a solver instance that may be called
+ *       from a thread other than the one using the solver, e.g., to cancel a
+ *       call to `cvc5_check_sat()` that runs on another thread.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ */
+CVC5_EXPORT void cvc5_interrupt(Cvc5* cvc5);
 /**
  * Get the list of asserted formulas.
  *
@@ -49,6 +49,7 @@ class NodeTemplate;
 typedef NodeTemplate<true> Node;
 #endif
 
+class ApiTrace;
 class DType;
 class DTypeConstructor;
 class DTypeSelector;
@@ -3788,6 +3789,14 @@ namespace cvc5 {
 
 /**
  * A cvc5 term manager.
+ *
+ * @note A term manager, and all sorts and terms created by it, must not be
+ *       used concurrently from several threads. Creating, copying or
+ *       destroying a term or sort updates state that is shared by all terms
+ *       of its term manager without synchronization. Applications that build
+ *       queries from several threads should either use one term manager (and
+ *       its solver instances) per thread, or serialize all accesses to a
+ *       shared term manager, including the destruction of terms and sorts.
  */
 class CVC5_EXPORT TermManager
 {
@@ -4617,6 +4626,8 @@ class CVC5_EXPORT TermManager
   std::unique_ptr<APIStatistics> d_stats;
   /** The statistics registry (independent from any Solver's registry). */
   std::unique_ptr<internal::StatisticsRegistry> d_statsReg;
+  /** The recorder of the API trace, if enabled via CVC5_API_TRACE. */
+  std::unique_ptr<internal::ApiTrace> d_trace;
 };
 
 /* -------------------------------------------------------------------------- */
@@ -5686,6 +5697,25 @@ class CVC5_EXPORT Solver
    */
   void assertFormula(const Term& term) const;
 
+  /**
+   * Assert a list of formulas, in order.
+   *
+   * This is equivalent to calling assertFormula() for each of the given
+   * formulas, but performs the checks and the bookkeeping of the assertions
+   * once for all formulas.
+   *
+   * SMT-LIB:
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * .. code:: smtlib
+   *
+   *     (assert <term>)*
+   * \endverbatim
+   *
+   * @param terms The formulas to assert.
+   */
+  void assertFormulas(const std::vector<Term>& terms) const;
+
   /**
    * Check satisfiability.
    *
@@ -5733,6 +5763,21 @@ class CVC5_EXPORT Solver
    */
   Result checkSatAssuming(const std::vector<Term>& assumptions) const;
 
+  /**
+   * Interrupt the current satisfiability check (or other solving call such as
+   * getting an interpolant), or the next one if no such call is running. The
+   * interrupted call then returns an unknown result with explanation
+   * UnknownExplanation::INTERRUPTED.
+   *
+   * @note This is the only method of the solver that may be called from a
+   *       thread other than the one using the solver, e.g., to cancel a call
+   *       to checkSat() that runs on another thread. The interruption takes
+   *       effect the next time the solver checks its resource limits.
+   *
+   * @warning This function is experimental and may change in future versions.
+   */
+  void interrupt() const;
+
   /**
    * Create datatype sort.
    *
@@ -6683,6 +6728,13 @@ class CVC5_EXPORT Solver
   /**
    * Remove all assertions.
    *
+   * The options, the logic and the declared terms are kept, as well as the
+   * theory solvers, which are not reconstructed. Resetting the assertions of
+   * an initialized solver is thus cheaper than creating and configuring a new
+   * one, e.g., when answering many unrelated queries over the same logic.
+   * The model, proof and unsat core of the last query are not available
+   * after this call.
+   *
    * SMT-LIB:
    *
    * \verbatim embed:rst:leading-asterisk
@@ -7011,6 +7063,39 @@ class CVC5_EXPORT Solver
    */
   Term findSynthNext() const;
 
+  /**
+   * Write a binary snapshot of the given terms to a file.
+   *
+   * The snapshot contains the shared DAG of the terms, including their sorts
+   * and the names of their free constants, and can be loaded with
+   * loadSnapshot() much faster than the terms can be parsed.
+   *
+   * Requires that the terms are built over Boolean, arithmetic, bit-vector
+   * and string constants, (bound) variables, and function, array, set,
+   * sequence and uninterpreted sorts.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param filename The name of the file to write.
+   * @param terms The terms to write.
+   */
+  void saveSnapshot(const std::string& filename,
+                    const std::vector<Term>& terms) const;
+
+  /**
+   * Load the terms of a binary snapshot written by saveSnapshot().
+   *
+   * The free constants and uninterpreted sorts of the snapshot are created
+   * anew, i.e., they are distinct from any constants and sorts of the same
+   * name that were created before.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param filename The name of the file to read.
+   * @return The terms of the snapshot.
+   */
+  std::vector<Term> loadSnapshot(const std::string& filename);
+
   /**
    * Get a snapshot of the current state of the statistic values of this
    * solver. The returned object is completely decoupled from the solver and
@@ -7097,6 +7182,13 @@ class CVC5_EXPORT Solver
   /** Helper for getting timeout cores */
   std::pair<Result, std::vector<Term>> getTimeoutCoreHelper(
       const std::vector<Term>& assumptions) const;
+  /**
+   * Add literals whose polarity the SAT solver should prefer when deciding
+   * them in subsequent checks. Used by the driver for the literals of
+   * --learned-literals-in.
+   * @param lits The literals.
+   */
+  void addPhaseHints(const std::vector<Term>& lits) const;
   /**
    * Get value helper, which accounts for subtyping.
    * @param term The term to get the value from.
@@ -4783,6 +4783,21 @@ void cvc5_assert_formula(Cvc5* cvc5, Cvc5Term term)
   CVC5_CAPI_TRY_CATCH_END;
 }
 
+void cvc5_assert_formulas(Cvc5* cvc5, size_t size, const Cvc5Term terms[])
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_NOT_NULL(terms);
+  std::vector<cvc5::Term> cterms;
+  for (size_t i = 0; i < size; ++i)
+  {
+    CVC5_CAPI_CHECK_TERM_AT_IDX(terms, i);
+    cterms.push_back(terms[i]->d_term);
+  }
+  cvc5->d_solver.assertFormulas(cterms);
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
 Cvc5Result cvc5_check_sat(Cvc5* cvc5)
 {
   Cvc5Result res = nullptr;
@@ -4812,6 +4827,14 @@ Cvc5Result cvc5_check_sat_assuming(Cvc5* cvc5,
   return res;
 }
 
+void cvc5_interrupt(Cvc5* cvc5)
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  cvc5->d_solver.interrupt();
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
 const Cvc5Term* cvc5_get_assertions(Cvc5* cvc5, size_t* size)
 {
   static thread_local std::vector<Cvc5Term> res;
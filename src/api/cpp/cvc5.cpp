@@ -33,9 +33,11 @@
 #include <cvc5/cvc5.h>
 
 #include <cstring>
+#include <fstream>
 #include <sstream>
 
 #include "api/cpp/cvc5_checks.h"
+#include "api/cpp/cvc5_trace.h"
 #include "base/check.h"
 #include "base/configuration.h"
 #include "expr/array_store_all.h"
@@ -52,6 +54,7 @@
 #include "expr/node_algorithm.h"
 #include "expr/node_builder.h"
 #include "expr/node_manager.h"
+#include "expr/node_snapshot.h"
 #include "expr/plugin.h"
 #include "expr/sequence.h"
 #include "expr/skolem_manager.h"
@@ -81,6 +84,7 @@
 #include "util/iand.h"
 #include "util/random.h"
 #include "util/regexp.h"
+#include "util/resource_manager.h"
 #include "util/result.h"
 #include "util/roundingmode.h"
 #include "util/statistics_registry.h"
@@ -102,6 +106,17 @@ struct APIStatistics
   internal::HistogramStat<internal::TypeConstant> d_consts;
   internal::HistogramStat<internal::TypeConstant> d_vars;
   internal::HistogramStat<Kind> d_terms;
+  /** Garbage collection statistics, copied from the node manager */
+  internal::IntStat d_gcReclaims;
+  internal::IntStat d_gcReclaimed;
+  internal::IntStat d_gcTotalPauseUs;
+  internal::IntStat d_gcMaxPauseUs;
+  /** Memory statistics per kind, copied from the node manager */
+  internal::HistogramStat<internal::Kind> d_memLiveNodes;
+  internal::HistogramStat<internal::Kind> d_memLiveBytes;
+  internal::HistogramStat<internal::Kind> d_memPeakNodes;
+  internal::HistogramStat<internal::Kind> d_memAttributeBytes;
+  internal::IntStat d_memDenseAttributeBytes;
 };
 
 /* -------------------------------------------------------------------------- */
@@ -5316,12 +5331,33 @@ TermManager::TermManager() : d_nm(std::make_unique<internal::NodeManager>())
     d_statsReg.reset(new internal::StatisticsRegistry());
     resetStatistics();
   }
+  d_trace = internal::ApiTrace::mkFromEnvironment();
 }
 
 TermManager::~TermManager() {}
 
 Statistics TermManager::getStatistics() const
 {
+  if constexpr (internal::configuration::isStatisticsBuild())
+  {
+    const internal::NodeManager::GcStatistics& gc = d_nm->getGcStatistics();
+    d_stats->d_gcReclaims = gc.d_numReclaims;
+    d_stats->d_gcReclaimed = gc.d_numReclaimed;
+    d_stats->d_gcTotalPauseUs = gc.d_totalPauseUs;
+    d_stats->d_gcMaxPauseUs = gc.d_maxPauseUs;
+    const internal::NodeManager::MemoryStatistics& mem =
+        d_nm->getMemoryStatistics();
+    std::vector<uint64_t> attrBytes(mem.d_liveNodes.size(), 0);
+    d_stats->d_memDenseAttributeBytes = d_nm->getAttributeMemory(attrBytes);
+    for (size_t i = 0, n = mem.d_liveNodes.size(); i < n; ++i)
+    {
+      internal::Kind k = static_cast<internal::Kind>(i);
+      d_stats->d_memLiveNodes.set(k, mem.d_liveNodes[i]);
+      d_stats->d_memLiveBytes.set(k, mem.d_liveBytes[i]);
+      d_stats->d_memPeakNodes.set(k, mem.d_peakNodes[i]);
+      d_stats->d_memAttributeBytes.set(k, attrBytes[i]);
+    }
+  }
   return Statistics(*d_statsReg);
 }
 
@@ -5366,6 +5402,19 @@ void TermManager::resetStatistics()
       d_statsReg->registerHistogram<internal::TypeConstant>("cvc5::CONSTANT"),
       d_statsReg->registerHistogram<internal::TypeConstant>("cvc5::VARIABLE"),
       d_statsReg->registerHistogram<Kind>("cvc5::TERM"),
+      d_statsReg->registerInt("cvc5::gc::reclaims"),
+      d_statsReg->registerInt("cvc5::gc::reclaimedNodes"),
+      d_statsReg->registerInt("cvc5::gc::totalPauseUs"),
+      d_statsReg->registerInt("cvc5::gc::maxPauseUs"),
+      d_statsReg->registerHistogram<internal::Kind>(
+          "cvc5::memory::liveNodes"),
+      d_statsReg->registerHistogram<internal::Kind>(
+          "cvc5::memory::liveBytes"),
+      d_statsReg->registerHistogram<internal::Kind>(
+          "cvc5::memory::peakNodes"),
+      d_statsReg->registerHistogram<internal::Kind>(
+          "cvc5::memory::attributeBytes"),
+      d_statsReg->registerInt("cvc5::memory::denseAttributeBytes"),
   });
 }
 
@@ -6849,6 +6898,10 @@ Solver::Solver(TermManager& tm, std::unique_ptr<internal::Options>&& original)
       new internal::SolverEngine(tm.d_nm.get(), d_originalOptions.get()));
   d_slv->setSolver(this);
   d_rng.reset(new internal::Random(d_slv->getOptions().driver.seed));
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->newSolver(this, d_slv->getOptions());
+  }
 }
 
 Solver::Solver(TermManager& tm)
@@ -6861,7 +6914,13 @@ Solver::Solver()
 {
 }
 
-Solver::~Solver() {}
+Solver::~Solver()
+{
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->deleteSolver(this);
+  }
+}
 
 /* Helpers and private functions                                              */
 /* -------------------------------------------------------------------------- */
@@ -7293,6 +7352,13 @@ Term Solver::simplify(const Term& term, bool applySubs)
   CVC5_API_TRY_CATCH_BEGIN;
   CVC5_API_SOLVER_CHECK_TERM(term);
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::SIMPLIFY);
+    d_tm.d_trace->addTerm(term);
+    d_tm.d_trace->addUnsigned(applySubs);
+    d_tm.d_trace->endCall();
+  }
   Term res = Term(&d_tm, d_slv->simplify(*term.d_node, applySubs));
   Assert(*res.getSort().d_type == *term.getSort().d_type);
   return res;
@@ -7310,11 +7376,37 @@ void Solver::assertFormula(const Term& term) const
   CVC5_API_SOLVER_CHECK_TERM_WITH_SORT(term, getBooleanSort());
   ensureWellFormedTerm(term);
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::ASSERT_FORMULA);
+    d_tm.d_trace->addTerm(term);
+    d_tm.d_trace->endCall();
+  }
   d_slv->assertFormula(*term.d_node);
   ////////
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::assertFormulas(const std::vector<Term>& terms) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERMS_WITH_SORT(terms, getBooleanSort());
+  ensureWellFormedTerms(terms);
+  //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    for (const Term& t : terms)
+    {
+      d_tm.d_trace->beginCall(this, internal::apitrace::Op::ASSERT_FORMULA);
+      d_tm.d_trace->addTerm(t);
+      d_tm.d_trace->endCall();
+    }
+  }
+  d_slv->assertFormulas(Term::termVectorToNodes(terms));
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 Result Solver::checkSat(void) const
 {
   CVC5_API_TRY_CATCH_BEGIN;
@@ -7324,6 +7416,14 @@ Result Solver::checkSat(void) const
          "(try --"
       << internal::options::base::longName::incrementalSolving << ")";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::CHECK_SAT);
+    d_tm.d_trace->endCall(true);
+    Result res = d_slv->checkSat();
+    d_tm.d_trace->recordResult(this, res);
+    return res;
+  }
   return d_slv->checkSat();
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -7340,6 +7440,15 @@ Result Solver::checkSatAssuming(const Term& assumption) const
   CVC5_API_SOLVER_CHECK_TERM_WITH_SORT(assumption, getBooleanSort());
   ensureWellFormedTerm(assumption);
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::CHECK_SAT_ASSUMING);
+    d_tm.d_trace->addTerms({assumption});
+    d_tm.d_trace->endCall(true);
+    Result res = d_slv->checkSat(*assumption.d_node);
+    d_tm.d_trace->recordResult(this, res);
+    return res;
+  }
   return d_slv->checkSat(*assumption.d_node);
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -7362,11 +7471,29 @@ Result Solver::checkSatAssuming(const std::vector<Term>& assumptions) const
   }
   std::vector<internal::Node> eassumptions =
       Term::termVectorToNodes(assumptions);
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::CHECK_SAT_ASSUMING);
+    d_tm.d_trace->addTerms(assumptions);
+    d_tm.d_trace->endCall(true);
+    Result res = d_slv->checkSat(eassumptions);
+    d_tm.d_trace->recordResult(this, res);
+    return res;
+  }
   return d_slv->checkSat(eassumptions);
   ////////
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::interrupt() const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  d_slv->getResourceManager()->interrupt();
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 Sort Solver::declareDatatype(
     const std::string& symbol,
     const std::vector<DatatypeConstructorDecl>& ctors) const
@@ -7410,6 +7537,16 @@ Term Solver::declareFun(const std::string& symbol,
   internal::Node res = d_tm.mkConstHelper(type, symbol, fresh);
   // notify the solver engine of the declaration
   d_slv->declareConst(res);
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::DECLARE_FUN);
+    d_tm.d_trace->addString(symbol);
+    d_tm.d_trace->addSorts(sorts);
+    d_tm.d_trace->addSort(sort);
+    d_tm.d_trace->addUnsigned(fresh);
+    d_tm.d_trace->endCall();
+    d_tm.d_trace->defineTerm(Term(&d_tm, res));
+  }
   return Term(&d_tm, res);
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -7424,6 +7561,15 @@ Sort Solver::declareSort(const std::string& symbol,
   internal::TypeNode type = d_tm.d_nm->mkSortConstructor(symbol, arity, fresh);
   // notify the solver engine of the declaration
   d_slv->declareSort(type);
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::DECLARE_SORT);
+    d_tm.d_trace->addString(symbol);
+    d_tm.d_trace->addUnsigned(arity);
+    d_tm.d_trace->addUnsigned(fresh);
+    d_tm.d_trace->endCall();
+    d_tm.d_trace->defineSort(Sort(&d_tm, type));
+  }
   return Sort(&d_tm, type);
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -7461,6 +7607,17 @@ Term Solver::defineFun(const std::string& symbol,
 
   d_slv->defineFunction(
       *fun.d_node, Term::termVectorToNodes(bound_vars), *term.d_node, global);
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::DEFINE_FUN);
+    d_tm.d_trace->addString(symbol);
+    d_tm.d_trace->addTerms(bound_vars);
+    d_tm.d_trace->addSort(sort);
+    d_tm.d_trace->addTerm(term);
+    d_tm.d_trace->addUnsigned(global);
+    d_tm.d_trace->endCall();
+    d_tm.d_trace->defineTerm(fun);
+  }
   return fun;
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -7505,6 +7662,17 @@ Term Solver::defineFunRec(const std::string& symbol,
 
   d_slv->defineFunctionRec(
       *fun.d_node, Term::termVectorToNodes(bound_vars), *term.d_node, global);
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::DEFINE_FUN_REC);
+    d_tm.d_trace->addString(symbol);
+    d_tm.d_trace->addTerms(bound_vars);
+    d_tm.d_trace->addSort(sort);
+    d_tm.d_trace->addTerm(term);
+    d_tm.d_trace->addUnsigned(global);
+    d_tm.d_trace->endCall();
+    d_tm.d_trace->defineTerm(fun);
+  }
 
   return fun;
   ////////
@@ -7941,6 +8109,12 @@ std::vector<Term> Solver::getUnsatAssumptions(void) const
   CVC5_API_CHECK(d_slv->getSmtMode() == internal::SmtMode::UNSAT)
       << "cannot get unsat assumptions unless in unsat mode.";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this,
+                            internal::apitrace::Op::GET_UNSAT_ASSUMPTIONS);
+    d_tm.d_trace->endCall();
+  }
 
   std::vector<internal::Node> uassumptions = d_slv->getUnsatAssumptions();
   /* Cannot use
@@ -7966,6 +8140,11 @@ std::vector<Term> Solver::getUnsatCore(void) const
   CVC5_API_RECOVERABLE_CHECK(d_slv->getSmtMode() == internal::SmtMode::UNSAT)
       << "cannot get unsat core unless in unsat mode.";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::GET_UNSAT_CORE);
+    d_tm.d_trace->endCall();
+  }
   internal::UnsatCore core = d_slv->getUnsatCore();
   /* Can not use
    *   return std::vector<Term>(core.begin(), core.end());
@@ -8126,6 +8305,11 @@ std::vector<Term> Solver::getLearnedLiterals(modes::LearnedLitType t) const
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::addPhaseHints(const std::vector<Term>& lits) const
+{
+  d_slv->addPhaseHints(Term::termVectorToNodes(lits));
+}
+
 Term Solver::getValueHelper(const Term& term) const
 {
   // Note: Term is checked in the caller to avoid double checks
@@ -8160,6 +8344,12 @@ Term Solver::getValue(const Term& term) const
       << "cannot get value of a term of non-well-founded datatype sort.";
   ensureWellFormedTerm(term);
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::GET_VALUE);
+    d_tm.d_trace->addTerms({term});
+    d_tm.d_trace->endCall();
+  }
   return getValueHelper(term);
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -8185,13 +8375,31 @@ std::vector<Term> Solver::getValue(const std::vector<Term>& terms) const
   }
   CVC5_API_SOLVER_CHECK_TERMS(terms);
   ensureWellFormedTerms(terms);
+  for (const Term& t : terms)
+  {
+    bool wasShadow = false;
+    bool freeOrShadowedVar =
+        internal::expr::hasFreeOrShadowedVar(t.getNode(), wasShadow);
+    CVC5_API_RECOVERABLE_CHECK(!freeOrShadowedVar)
+        << "cannot get value of term containing "
+        << (wasShadow ? "shadowed" : "free") << " variables";
+  }
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::GET_VALUE);
+    d_tm.d_trace->addTerms(terms);
+    d_tm.d_trace->endCall();
+  }
 
+  // compute the values together, which shares work between the terms
+  std::vector<internal::Node> values =
+      d_slv->getValues(Term::termVectorToNodes(terms), true);
   std::vector<Term> res;
-  for (size_t i = 0, n = terms.size(); i < n; ++i)
+  for (const internal::Node& v : values)
   {
     /* Can not use emplace_back here since constructor is private. */
-    res.push_back(getValueHelper(terms[i]));
+    res.push_back(Term(&d_tm, v));
   }
   return res;
   ////////
@@ -8417,6 +8625,12 @@ void Solver::pop(uint32_t nscopes) const
   CVC5_API_CHECK(nscopes <= d_slv->getNumUserLevels())
       << "cannot pop beyond first pushed context";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::POP);
+    d_tm.d_trace->addUnsigned(nscopes);
+    d_tm.d_trace->endCall();
+  }
   for (uint32_t n = 0; n < nscopes; ++n)
   {
     d_slv->pop();
@@ -8547,6 +8761,12 @@ void Solver::blockModel(modes::BlockModelsMode mode) const
   CVC5_API_RECOVERABLE_CHECK(d_slv->isSmtModeSat())
       << "can only block model after SAT or UNKNOWN response.";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::BLOCK_MODEL);
+    d_tm.d_trace->addUnsigned(static_cast<uint64_t>(mode));
+    d_tm.d_trace->endCall();
+  }
   d_slv->blockModel(mode);
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -8566,6 +8786,12 @@ void Solver::blockModelValues(const std::vector<Term>& terms) const
   CVC5_API_SOLVER_CHECK_TERMS(terms);
   ensureWellFormedTerms(terms);
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::BLOCK_MODEL_VALUES);
+    d_tm.d_trace->addTerms(terms);
+    d_tm.d_trace->endCall();
+  }
   d_slv->blockModelValues(Term::termVectorToNodes(terms));
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -8595,6 +8821,12 @@ void Solver::push(uint32_t nscopes) const
       << "cannot push when not solving incrementally (use --"
       << internal::options::base::longName::incrementalSolving << ")";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::PUSH);
+    d_tm.d_trace->addUnsigned(nscopes);
+    d_tm.d_trace->endCall();
+  }
   for (uint32_t n = 0; n < nscopes; ++n)
   {
     d_slv->push();
@@ -8607,6 +8839,11 @@ void Solver::resetAssertions(void) const
 {
   CVC5_API_TRY_CATCH_BEGIN;
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::RESET_ASSERTIONS);
+    d_tm.d_trace->endCall();
+  }
   d_slv->resetAssertions();
   ////////
   CVC5_API_TRY_CATCH_END;
@@ -8634,6 +8871,13 @@ void Solver::setInfo(const std::string& keyword, const std::string& value) const
                               value)
       << "'sat', 'unsat' or 'unknown'";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::SET_INFO);
+    d_tm.d_trace->addString(keyword);
+    d_tm.d_trace->addString(value);
+    d_tm.d_trace->endCall();
+  }
   if (keyword == "filename")
   {
     // only the Solver object has non-const access to the original options
@@ -8652,6 +8896,12 @@ void Solver::setLogic(const std::string& logic) const
   CVC5_API_CHECK(!d_slv->isFullyInited())
       << "invalid call to 'setLogic', solver is already fully initialized";
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::SET_LOGIC);
+    d_tm.d_trace->addString(logic);
+    d_tm.d_trace->endCall();
+  }
   internal::LogicInfo linfo(logic);
   d_slv->setLogic(linfo);
   ////////
@@ -8704,6 +8954,13 @@ void Solver::setOption(const std::string& option,
         << "', solver is already fully initialized";
   }
   //////// all checks before this line
+  if (d_tm.d_trace)
+  {
+    d_tm.d_trace->beginCall(this, internal::apitrace::Op::SET_OPTION);
+    d_tm.d_trace->addString(option);
+    d_tm.d_trace->addString(value);
+    d_tm.d_trace->endCall();
+  }
   // mark that the option originated from the user here
   d_slv->setOption(option, value, true);
   ////////
@@ -9001,6 +9258,30 @@ Term Solver::findSynthNext() const
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::saveSnapshot(const std::string& filename,
+                          const std::vector<Term>& terms) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERMS(terms);
+  //////// all checks before this line
+  std::ofstream out(filename, std::ios::binary);
+  CVC5_API_CHECK(out.good()) << "cannot open file " << filename;
+  internal::expr::saveSnapshot(out, Term::termVectorToNodes(terms));
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+std::vector<Term> Solver::loadSnapshot(const std::string& filename)
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  std::vector<internal::Node> nodes =
+      internal::expr::loadSnapshot(d_tm.d_nm.get(), filename);
+  return Term::nodeVectorToTerms(&d_tm, nodes);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 Statistics Solver::getStatistics() const
 {
   return Statistics(d_slv->getStatisticsRegistry());
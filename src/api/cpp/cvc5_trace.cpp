@@ -0,0 +1,570 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Recording of API call traces.
+ */
+
+#include "api/cpp/cvc5_trace.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <unordered_set>
+
+#include "base/check.h"
+#include "options/option_exception.h"
+#include "options/options.h"
+#include "options/options_public.h"
+
+namespace cvc5::internal {
+
+using apitrace::Op;
+
+namespace {
+
+/** The size of the buffer that is written to the file at once. */
+constexpr size_t s_bufferSize = 1 << 16;
+
+/** @return True if k is a kind of terms without children made by mkTerm. */
+bool isNullaryOperator(cvc5::Kind k)
+{
+  return k == cvc5::Kind::PI || k == cvc5::Kind::REGEXP_NONE
+         || k == cvc5::Kind::REGEXP_ALL || k == cvc5::Kind::REGEXP_ALLCHAR
+         || k == cvc5::Kind::SEP_EMP;
+}
+
+/** @return True if t is a term of the form TERM_NULLARY. */
+bool isNullaryValue(const Term& t)
+{
+  switch (t.getKind())
+  {
+    case cvc5::Kind::SET_EMPTY:
+    case cvc5::Kind::SET_UNIVERSE:
+    case cvc5::Kind::BAG_EMPTY:
+    case cvc5::Kind::SEP_NIL: return true;
+    case cvc5::Kind::CONST_SEQUENCE: return t.getSequenceValue().empty();
+    default: return false;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<ApiTrace> ApiTrace::mkFromEnvironment()
+{
+  const char* filename = std::getenv(s_envVariable);
+  if (filename == nullptr || *filename == '\0')
+  {
+    return nullptr;
+  }
+  static std::atomic<uint64_t> s_numTraces{0};
+  uint64_t k = s_numTraces++;
+  return std::make_unique<ApiTrace>(
+      k == 0 ? std::string(filename)
+             : std::string(filename) + "." + std::to_string(k));
+}
+
+ApiTrace::ApiTrace(const std::string& filename)
+    : d_file(filename, std::ios::binary),
+      d_inCall(false),
+      d_nextSolverId(0),
+      d_nextSortId(0),
+      d_nextTermId(0)
+{
+  if (!d_file)
+  {
+    throw CVC5ApiException("cannot open API trace file '" + filename + "'");
+  }
+  d_buffer.writeHeader();
+  writeBuffer(true);
+}
+
+ApiTrace::~ApiTrace() { writeBuffer(true); }
+
+void ApiTrace::newSolver(const Solver* slv, const Options& opts)
+{
+  SolverInfo& info = d_solvers[slv];
+  info.d_id = d_nextSolverId++;
+  info.d_options = &opts;
+  info.d_optionsRecorded = false;
+  d_buffer.writeOp(Op::NEW_SOLVER);
+  d_buffer.writeUnsigned(info.d_id);
+  writeBuffer(false);
+}
+
+void ApiTrace::deleteSolver(const Solver* slv)
+{
+  auto it = d_solvers.find(slv);
+  Assert(it != d_solvers.end());
+  d_buffer.writeOp(Op::DELETE_SOLVER);
+  d_buffer.writeUnsigned(it->second.d_id);
+  d_solvers.erase(it);
+  writeBuffer(false);
+}
+
+void ApiTrace::beginCall(const Solver* slv, Op op)
+{
+  Assert(!d_inCall);
+  auto it = d_solvers.find(slv);
+  Assert(it != d_solvers.end());
+  if (op != Op::SET_OPTION && !it->second.d_optionsRecorded)
+  {
+    writeOptions(it->second);
+  }
+  d_inCall = true;
+  d_call.writeOp(op);
+  d_call.writeUnsigned(it->second.d_id);
+}
+
+void ApiTrace::addUnsigned(uint64_t value)
+{
+  Assert(d_inCall);
+  d_call.writeUnsigned(value);
+}
+
+void ApiTrace::addString(const std::string& s)
+{
+  Assert(d_inCall);
+  d_call.writeString(s);
+}
+
+void ApiTrace::addSort(const Sort& s)
+{
+  Assert(d_inCall);
+  d_call.writeUnsigned(getSortId(s));
+}
+
+void ApiTrace::addSorts(const std::vector<Sort>& sorts)
+{
+  Assert(d_inCall);
+  d_call.writeUnsigned(sorts.size());
+  for (const Sort& s : sorts)
+  {
+    d_call.writeUnsigned(getSortId(s));
+  }
+}
+
+void ApiTrace::addTerm(const Term& t)
+{
+  Assert(d_inCall);
+  d_call.writeUnsigned(getTermId(t));
+}
+
+void ApiTrace::addTerms(const std::vector<Term>& terms)
+{
+  Assert(d_inCall);
+  d_call.writeUnsigned(terms.size());
+  for (const Term& t : terms)
+  {
+    d_call.writeUnsigned(getTermId(t));
+  }
+}
+
+void ApiTrace::endCall(bool flush)
+{
+  Assert(d_inCall);
+  // the definitions of the operands were written to the buffer before
+  d_buffer.append(d_call);
+  d_inCall = false;
+  writeBuffer(flush);
+}
+
+void ApiTrace::defineSort(const Sort& s)
+{
+  Assert(!d_inCall);
+  // a declaration may return an existing sort, which then gets a new id like
+  // the result of the replayed call
+  d_sortIds[s] = d_nextSortId++;
+}
+
+void ApiTrace::defineTerm(const Term& t)
+{
+  Assert(!d_inCall);
+  d_termIds[t] = d_nextTermId++;
+}
+
+void ApiTrace::recordResult(const Solver* slv, const cvc5::Result& r)
+{
+  auto it = d_solvers.find(slv);
+  Assert(it != d_solvers.end());
+  d_buffer.writeOp(Op::RESULT);
+  d_buffer.writeUnsigned(it->second.d_id);
+  d_buffer.writeString(r.toString());
+  writeBuffer(false);
+}
+
+uint64_t ApiTrace::getSortId(const Sort& s)
+{
+  auto it = d_sortIds.find(s);
+  if (it != d_sortIds.end())
+  {
+    return it->second;
+  }
+  // define the component sorts first, in post-order
+  std::unordered_set<Sort> visited;
+  std::vector<Sort> visit{s};
+  std::vector<Sort> deps;
+  while (!visit.empty())
+  {
+    Sort cur = visit.back();
+    if (d_sortIds.find(cur) != d_sortIds.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (visited.insert(cur).second)
+    {
+      deps.clear();
+      getComponents(cur, deps);
+      visit.insert(visit.end(), deps.begin(), deps.end());
+      continue;
+    }
+    visit.pop_back();
+    writeSortDefinition(cur);
+    d_sortIds[cur] = d_nextSortId++;
+  }
+  return d_sortIds[s];
+}
+
+uint64_t ApiTrace::getTermId(const Term& t)
+{
+  auto it = d_termIds.find(t);
+  if (it != d_termIds.end())
+  {
+    return it->second;
+  }
+  // define the dependencies first, in post-order
+  std::unordered_set<Term> visited;
+  std::vector<Term> visit{t};
+  std::vector<Term> deps;
+  while (!visit.empty())
+  {
+    Term cur = visit.back();
+    if (d_termIds.find(cur) != d_termIds.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (visited.insert(cur).second)
+    {
+      deps.clear();
+      getDependencies(cur, deps);
+      visit.insert(visit.end(), deps.begin(), deps.end());
+      continue;
+    }
+    visit.pop_back();
+    writeTermDefinition(cur);
+    d_termIds[cur] = d_nextTermId++;
+  }
+  return d_termIds[t];
+}
+
+void ApiTrace::getComponents(const Sort& s, std::vector<Sort>& deps)
+{
+  if (s.isArray())
+  {
+    deps.push_back(s.getArrayIndexSort());
+    deps.push_back(s.getArrayElementSort());
+  }
+  else if (s.isSet())
+  {
+    deps.push_back(s.getSetElementSort());
+  }
+  else if (s.isBag())
+  {
+    deps.push_back(s.getBagElementSort());
+  }
+  else if (s.isSequence())
+  {
+    deps.push_back(s.getSequenceElementSort());
+  }
+  else if (s.isTuple())
+  {
+    std::vector<Sort> sorts = s.getTupleSorts();
+    deps.insert(deps.end(), sorts.begin(), sorts.end());
+  }
+  else if (s.isFunction())
+  {
+    std::vector<Sort> sorts = s.getFunctionDomainSorts();
+    deps.insert(deps.end(), sorts.begin(), sorts.end());
+    deps.push_back(s.getFunctionCodomainSort());
+  }
+}
+
+void ApiTrace::writeSortDefinition(const Sort& s)
+{
+  // all component sorts are defined, hence the ids below are lookups
+  if (s.isBoolean())
+  {
+    d_buffer.writeOp(Op::SORT_BOOLEAN);
+  }
+  else if (s.isInteger())
+  {
+    d_buffer.writeOp(Op::SORT_INTEGER);
+  }
+  else if (s.isReal())
+  {
+    d_buffer.writeOp(Op::SORT_REAL);
+  }
+  else if (s.isString())
+  {
+    d_buffer.writeOp(Op::SORT_STRING);
+  }
+  else if (s.isRegExp())
+  {
+    d_buffer.writeOp(Op::SORT_REGEXP);
+  }
+  else if (s.isRoundingMode())
+  {
+    d_buffer.writeOp(Op::SORT_ROUNDINGMODE);
+  }
+  else if (s.isBitVector())
+  {
+    d_buffer.writeOp(Op::SORT_BITVECTOR);
+    d_buffer.writeUnsigned(s.getBitVectorSize());
+  }
+  else if (s.isFloatingPoint())
+  {
+    d_buffer.writeOp(Op::SORT_FLOATINGPOINT);
+    d_buffer.writeUnsigned(s.getFloatingPointExponentSize());
+    d_buffer.writeUnsigned(s.getFloatingPointSignificandSize());
+  }
+  else if (s.isFiniteField())
+  {
+    d_buffer.writeOp(Op::SORT_FINITE_FIELD);
+    d_buffer.writeString(s.getFiniteFieldSize());
+  }
+  else if (s.isArray() || s.isSet() || s.isBag() || s.isSequence()
+           || s.isTuple() || s.isFunction())
+  {
+    std::vector<Sort> deps;
+    getComponents(s, deps);
+    Op op = s.isArray()      ? Op::SORT_ARRAY
+            : s.isSet()      ? Op::SORT_SET
+            : s.isBag()      ? Op::SORT_BAG
+            : s.isSequence() ? Op::SORT_SEQUENCE
+            : s.isTuple()    ? Op::SORT_TUPLE
+                             : Op::SORT_FUNCTION;
+    d_buffer.writeOp(op);
+    if (op == Op::SORT_TUPLE)
+    {
+      d_buffer.writeUnsigned(deps.size());
+    }
+    else if (op == Op::SORT_FUNCTION)
+    {
+      d_buffer.writeUnsigned(deps.size() - 1);
+    }
+    for (const Sort& d : deps)
+    {
+      d_buffer.writeUnsigned(d_sortIds[d]);
+    }
+  }
+  else if (s.isUninterpretedSort())
+  {
+    d_buffer.writeOp(Op::SORT_UNINTERPRETED);
+    d_buffer.writeUnsigned(s.hasSymbol());
+    if (s.hasSymbol())
+    {
+      d_buffer.writeString(s.getSymbol());
+    }
+  }
+  else
+  {
+    // e.g., datatype sorts
+    d_buffer.writeOp(Op::SORT_UNSUPPORTED);
+    d_buffer.writeString(s.toString());
+  }
+}
+
+void ApiTrace::getDependencies(const Term& t, std::vector<Term>& deps)
+{
+  cvc5::Kind k = t.getKind();
+  if (k == cvc5::Kind::CONST_FLOATINGPOINT)
+  {
+    deps.push_back(std::get<2>(t.getFloatingPointValue()));
+  }
+  else if (k == cvc5::Kind::CONST_ARRAY)
+  {
+    deps.push_back(t.getConstArrayBase());
+  }
+  else if (k != cvc5::Kind::INTERNAL_KIND && !isNullaryValue(t))
+  {
+    for (size_t i = 0, n = t.getNumChildren(); i < n; ++i)
+    {
+      deps.push_back(t[i]);
+    }
+  }
+}
+
+void ApiTrace::writeTermDefinition(const Term& t)
+{
+  // the sort ids are computed before writing the opcode, since they may
+  // write sort definitions
+  cvc5::Kind k = t.getKind();
+  switch (k)
+  {
+    case cvc5::Kind::CONSTANT:
+    case cvc5::Kind::VARIABLE:
+    {
+      uint64_t sort = getSortId(t.getSort());
+      d_buffer.writeOp(k == cvc5::Kind::CONSTANT ? Op::TERM_CONST
+                                                 : Op::TERM_VAR);
+      d_buffer.writeUnsigned(sort);
+      d_buffer.writeUnsigned(t.hasSymbol());
+      if (t.hasSymbol())
+      {
+        d_buffer.writeString(t.getSymbol());
+      }
+      return;
+    }
+    case cvc5::Kind::CONST_BOOLEAN:
+      d_buffer.writeOp(Op::TERM_BOOLEAN);
+      d_buffer.writeUnsigned(t.getBooleanValue());
+      return;
+    case cvc5::Kind::CONST_INTEGER:
+      d_buffer.writeOp(Op::TERM_INTEGER);
+      d_buffer.writeString(t.getIntegerValue());
+      return;
+    case cvc5::Kind::CONST_RATIONAL:
+      d_buffer.writeOp(Op::TERM_REAL);
+      d_buffer.writeString(t.getRealValue());
+      return;
+    case cvc5::Kind::CONST_BITVECTOR:
+      d_buffer.writeOp(Op::TERM_BITVECTOR);
+      d_buffer.writeUnsigned(t.getSort().getBitVectorSize());
+      d_buffer.writeString(t.getBitVectorValue(2));
+      return;
+    case cvc5::Kind::CONST_STRING:
+    {
+      std::u32string s = t.getU32StringValue();
+      d_buffer.writeOp(Op::TERM_STRING);
+      d_buffer.writeUnsigned(s.size());
+      for (char32_t c : s)
+      {
+        d_buffer.writeUnsigned(c);
+      }
+      return;
+    }
+    case cvc5::Kind::CONST_ROUNDINGMODE:
+      d_buffer.writeOp(Op::TERM_ROUNDINGMODE);
+      d_buffer.writeUnsigned(static_cast<uint64_t>(t.getRoundingModeValue()));
+      return;
+    case cvc5::Kind::CONST_FLOATINGPOINT:
+    {
+      auto [exp, sig, bv] = t.getFloatingPointValue();
+      d_buffer.writeOp(Op::TERM_FLOATINGPOINT);
+      d_buffer.writeUnsigned(exp);
+      d_buffer.writeUnsigned(sig);
+      d_buffer.writeUnsigned(d_termIds[bv]);
+      return;
+    }
+    case cvc5::Kind::CONST_FINITE_FIELD:
+    {
+      uint64_t sort = getSortId(t.getSort());
+      d_buffer.writeOp(Op::TERM_FINITE_FIELD);
+      d_buffer.writeUnsigned(sort);
+      d_buffer.writeString(t.getFiniteFieldValue());
+      return;
+    }
+    case cvc5::Kind::CONST_ARRAY:
+    {
+      uint64_t sort = getSortId(t.getSort());
+      d_buffer.writeOp(Op::TERM_CONST_ARRAY);
+      d_buffer.writeUnsigned(sort);
+      d_buffer.writeUnsigned(d_termIds[t.getConstArrayBase()]);
+      return;
+    }
+    default: break;
+  }
+  if (isNullaryValue(t))
+  {
+    uint64_t sort = getSortId(t.getSort());
+    d_buffer.writeOp(Op::TERM_NULLARY);
+    d_buffer.writeUnsigned(static_cast<uint64_t>(k));
+    d_buffer.writeUnsigned(sort);
+    return;
+  }
+  std::vector<uint64_t> indices;
+  bool supported = k != cvc5::Kind::INTERNAL_KIND
+                   && (t.getNumChildren() > 0 || isNullaryOperator(k));
+  if (supported && t.hasOp())
+  {
+    cvc5::Op op = t.getOp();
+    for (size_t i = 0, n = op.isIndexed() ? op.getNumIndices() : 0; i < n; ++i)
+    {
+      Term index = op[i];
+      if (!index.isUInt32Value())
+      {
+        supported = false;
+        break;
+      }
+      indices.push_back(index.getUInt32Value());
+    }
+  }
+  if (!supported)
+  {
+    // e.g., skolems and datatype constructor applications
+    d_buffer.writeOp(Op::TERM_UNSUPPORTED);
+    d_buffer.writeString(t.toString());
+    return;
+  }
+  d_buffer.writeOp(Op::TERM_APP);
+  d_buffer.writeUnsigned(static_cast<uint64_t>(k));
+  d_buffer.writeUnsigned(indices.size());
+  for (uint64_t i : indices)
+  {
+    d_buffer.writeUnsigned(i);
+  }
+  d_buffer.writeUnsigned(t.getNumChildren());
+  for (size_t i = 0, n = t.getNumChildren(); i < n; ++i)
+  {
+    d_buffer.writeUnsigned(d_termIds[t[i]]);
+  }
+}
+
+void ApiTrace::writeOptions(SolverInfo& info)
+{
+  info.d_optionsRecorded = true;
+  Options defaults;
+  for (const std::string& name : options::getNames())
+  {
+    std::string value;
+    try
+    {
+      value = options::get(*info.d_options, name);
+      if (value == options::get(defaults, name))
+      {
+        continue;
+      }
+    }
+    catch (const OptionException&)
+    {
+      continue;
+    }
+    d_buffer.writeOp(Op::SET_OPTION);
+    d_buffer.writeUnsigned(info.d_id);
+    d_buffer.writeString(name);
+    d_buffer.writeString(value);
+  }
+}
+
+void ApiTrace::writeBuffer(bool flush)
+{
+  if (flush || d_buffer.size() >= s_bufferSize)
+  {
+    d_buffer.flush(d_file);
+    if (flush)
+    {
+      d_file.flush();
+    }
+  }
+}
+
+}  // namespace cvc5::internal
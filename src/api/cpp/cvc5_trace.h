@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Recording of API call traces.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__API__CVC5_TRACE_H
+#define CVC5__API__CVC5_TRACE_H
+
+#include <cvc5/cvc5.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "api/cpp/cvc5_trace_format.h"
+
+namespace cvc5::internal {
+
+class Options;
+
+/**
+ * Records the calls to the solvers of a term manager as a binary trace (see
+ * cvc5_trace_format.h), which is replayed with timing per call by the
+ * cvc5-replay binary.
+ *
+ * Tracing is enabled by setting the environment variable CVC5_API_TRACE to
+ * the name of the trace file. The terms and sorts passed to the recorded
+ * calls are defined in the trace on their first use, by decomposing them via
+ * the API. The trace thus reproduces the calls and the term structure
+ * exactly, but not the order in which the terms were constructed. Recorded
+ * terms are kept alive as long as the term manager.
+ */
+class ApiTrace
+{
+ public:
+  /** The environment variable that enables tracing. */
+  static constexpr const char* s_envVariable = "CVC5_API_TRACE";
+  /**
+   * @return A trace if CVC5_API_TRACE is set, nullptr otherwise. The k-th term
+   *         manager of a process with k > 0 writes to <file>.k.
+   */
+  static std::unique_ptr<ApiTrace> mkFromEnvironment();
+  /** Record to the given file. */
+  ApiTrace(const std::string& filename);
+  ~ApiTrace();
+
+  /**
+   * Record the construction of a solver with the given options. The options
+   * that differ from the defaults are recorded before the first call of the
+   * solver that is not setOption, which accounts for options set by a
+   * driver and for the original options of a reset solver.
+   */
+  void newSolver(const Solver* slv, const Options& opts);
+  /** Record the destruction of a solver. */
+  void deleteSolver(const Solver* slv);
+
+  /** Begin the record of a call of the given solver. */
+  void beginCall(const Solver* slv, apitrace::Op op);
+  /** Add an operand to the current call. */
+  void addUnsigned(uint64_t value);
+  /** Add an operand to the current call. */
+  void addString(const std::string& s);
+  /** Add an operand to the current call. */
+  void addSort(const Sort& s);
+  /** Add the number of sorts and the sorts to the current call. */
+  void addSorts(const std::vector<Sort>& sorts);
+  /** Add an operand to the current call. */
+  void addTerm(const Term& t);
+  /** Add the number of terms and the terms to the current call. */
+  void addTerms(const std::vector<Term>& terms);
+  /**
+   * End the record of the current call. If flush is true, the trace is
+   * written to the file, e.g., before a call that may not return.
+   */
+  void endCall(bool flush = false);
+  /** Define the next sort id as the result of the last call. */
+  void defineSort(const Sort& s);
+  /** Define the next term id as the result of the last call. */
+  void defineTerm(const Term& t);
+  /** Record the result of the last check-sat call of the given solver. */
+  void recordResult(const Solver* slv, const cvc5::Result& r);
+
+ private:
+  /** Information about a solver. */
+  struct SolverInfo
+  {
+    /** The id of the solver in the trace. */
+    uint64_t d_id;
+    /** The options of the solver. */
+    const Options* d_options;
+    /** Whether its non-default options were recorded. */
+    bool d_optionsRecorded;
+  };
+  /** @return The id of s, defining it in the trace if necessary. */
+  uint64_t getSortId(const Sort& s);
+  /** @return The id of t, defining it in the trace if necessary. */
+  uint64_t getTermId(const Term& t);
+  /** Add the sorts s is constructed from to deps. */
+  static void getComponents(const Sort& s, std::vector<Sort>& deps);
+  /** Write the definition of s, whose component sorts are defined. */
+  void writeSortDefinition(const Sort& s);
+  /** Write the definition of t, whose dependencies are defined. */
+  void writeTermDefinition(const Term& t);
+  /** Add the terms t depends on in its definition to deps. */
+  static void getDependencies(const Term& t, std::vector<Term>& deps);
+  /** Write the options of the solver that differ from the defaults. */
+  void writeOptions(SolverInfo& info);
+  /** Write buffered records to the file if flush or the buffer is large. */
+  void writeBuffer(bool flush);
+
+  /** The trace file. */
+  std::ofstream d_file;
+  /** The buffered records. */
+  apitrace::Writer d_buffer;
+  /** The operands of the current call. */
+  apitrace::Writer d_call;
+  /** Whether a call is being recorded. */
+  bool d_inCall;
+  /** The solvers. */
+  std::unordered_map<const Solver*, SolverInfo> d_solvers;
+  /** The id of the next solver. */
+  uint64_t d_nextSolverId;
+  /** The id of the next sort. */
+  uint64_t d_nextSortId;
+  /** The id of the next term. */
+  uint64_t d_nextTermId;
+  /** The ids of the defined sorts. */
+  std::unordered_map<Sort, uint64_t> d_sortIds;
+  /** The ids of the defined terms. */
+  std::unordered_map<Term, uint64_t> d_termIds;
+};
+
+}  // namespace cvc5::internal
+
+#endif
@@ -0,0 +1,352 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The binary format of API traces.
+ *
+ * A trace starts with the magic string "CVC5TRC" followed by a zero byte and
+ * the format version, and then consists of a sequence of records. Each record
+ * starts with its opcode, followed by the operands listed for the opcode
+ * below. Unsigned integers are encoded as LEB128 varints, strings by their
+ * length followed by their bytes. Sorts and terms are referred to by ids,
+ * which are assigned consecutively (separately for sorts and terms) in the
+ * order of the records that define them. Solvers are referred to by the id
+ * given to them in their NEW_SOLVER record.
+ */
+
+#include "cvc5_private_library.h"
+
+#ifndef CVC5__API__CVC5_TRACE_FORMAT_H
+#define CVC5__API__CVC5_TRACE_FORMAT_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace cvc5::internal::apitrace {
+
+/** The magic string at the beginning of a trace, including its zero byte. */
+inline constexpr char s_magic[] = "CVC5TRC";
+/** The version of the trace format. */
+inline constexpr uint64_t s_version = 1;
+
+/** The opcodes of the trace records. */
+enum class Op : uint64_t
+{
+  /* Sort definitions, each defines the next sort id ----------------------- */
+  /** (no operands) */
+  SORT_BOOLEAN,
+  /** (no operands) */
+  SORT_INTEGER,
+  /** (no operands) */
+  SORT_REAL,
+  /** (no operands) */
+  SORT_STRING,
+  /** (no operands) */
+  SORT_REGEXP,
+  /** (no operands) */
+  SORT_ROUNDINGMODE,
+  /** size */
+  SORT_BITVECTOR,
+  /** exponent size, significand size */
+  SORT_FLOATINGPOINT,
+  /** size as decimal string */
+  SORT_FINITE_FIELD,
+  /** index sort, element sort */
+  SORT_ARRAY,
+  /** element sort */
+  SORT_SET,
+  /** element sort */
+  SORT_BAG,
+  /** element sort */
+  SORT_SEQUENCE,
+  /** number of sorts, sorts */
+  SORT_TUPLE,
+  /** number of domain sorts, domain sorts, codomain sort */
+  SORT_FUNCTION,
+  /** has symbol, symbol (if any) */
+  SORT_UNINTERPRETED,
+  /** the sort as string, replaying it fails */
+  SORT_UNSUPPORTED,
+
+  /* Term definitions, each defines the next term id ----------------------- */
+  /** sort, has symbol, symbol (if any) */
+  TERM_CONST,
+  /** sort, has symbol, symbol (if any) */
+  TERM_VAR,
+  /** value */
+  TERM_BOOLEAN,
+  /** value as decimal string */
+  TERM_INTEGER,
+  /** value as decimal fraction string */
+  TERM_REAL,
+  /** size, value as binary string */
+  TERM_BITVECTOR,
+  /** number of code points, code points */
+  TERM_STRING,
+  /** rounding mode */
+  TERM_ROUNDINGMODE,
+  /** exponent size, significand size, bit-vector term */
+  TERM_FLOATINGPOINT,
+  /** sort, value as decimal string */
+  TERM_FINITE_FIELD,
+  /** sort, base term */
+  TERM_CONST_ARRAY,
+  /** kind, sort (empty set/bag/sequence, universe set, sep.nil) */
+  TERM_NULLARY,
+  /** kind, number of indices, indices, number of children, children */
+  TERM_APP,
+  /** the term as string, replaying it fails */
+  TERM_UNSUPPORTED,
+
+  /* Solver calls, the first operand is the solver id ---------------------- */
+  /** solver */
+  NEW_SOLVER,
+  /** solver */
+  DELETE_SOLVER,
+  /** solver, option, value */
+  SET_OPTION,
+  /** solver, logic */
+  SET_LOGIC,
+  /** solver, keyword, value */
+  SET_INFO,
+  /** solver, symbol, number of sorts, sorts, sort, fresh (defines a term) */
+  DECLARE_FUN,
+  /** solver, symbol, arity, fresh (defines a sort) */
+  DECLARE_SORT,
+  /**
+   * solver, symbol, number of variables, variables, sort, body, global
+   * (defines a term)
+   */
+  DEFINE_FUN,
+  /**
+   * solver, symbol, number of variables, variables, sort, body, global
+   * (defines a term)
+   */
+  DEFINE_FUN_REC,
+  /** solver, term */
+  ASSERT_FORMULA,
+  /** solver, number of scopes */
+  PUSH,
+  /** solver, number of scopes */
+  POP,
+  /** solver */
+  RESET_ASSERTIONS,
+  /** solver */
+  CHECK_SAT,
+  /** solver, number of assumptions, assumptions */
+  CHECK_SAT_ASSUMING,
+  /** solver, result as string, follows CHECK_SAT(_ASSUMING) */
+  RESULT,
+  /** solver, term, apply substitutions */
+  SIMPLIFY,
+  /** solver, number of terms, terms */
+  GET_VALUE,
+  /** solver */
+  GET_UNSAT_CORE,
+  /** solver */
+  GET_UNSAT_ASSUMPTIONS,
+  /** solver, mode */
+  BLOCK_MODEL,
+  /** solver, number of terms, terms */
+  BLOCK_MODEL_VALUES,
+
+  /** The number of opcodes, not an opcode. */
+  NUM_OPS
+};
+
+/** @return The name of the given opcode. */
+inline const char* toString(Op op)
+{
+  switch (op)
+  {
+    case Op::SORT_BOOLEAN: return "SORT_BOOLEAN";
+    case Op::SORT_INTEGER: return "SORT_INTEGER";
+    case Op::SORT_REAL: return "SORT_REAL";
+    case Op::SORT_STRING: return "SORT_STRING";
+    case Op::SORT_REGEXP: return "SORT_REGEXP";
+    case Op::SORT_ROUNDINGMODE: return "SORT_ROUNDINGMODE";
+    case Op::SORT_BITVECTOR: return "SORT_BITVECTOR";
+    case Op::SORT_FLOATINGPOINT: return "SORT_FLOATINGPOINT";
+    case Op::SORT_FINITE_FIELD: return "SORT_FINITE_FIELD";
+    case Op::SORT_ARRAY: return "SORT_ARRAY";
+    case Op::SORT_SET: return "SORT_SET";
+    case Op::SORT_BAG: return "SORT_BAG";
+    case Op::SORT_SEQUENCE: return "SORT_SEQUENCE";
+    case Op::SORT_TUPLE: return "SORT_TUPLE";
+    case Op::SORT_FUNCTION: return "SORT_FUNCTION";
+    case Op::SORT_UNINTERPRETED: return "SORT_UNINTERPRETED";
+    case Op::SORT_UNSUPPORTED: return "SORT_UNSUPPORTED";
+    case Op::TERM_CONST: return "TERM_CONST";
+    case Op::TERM_VAR: return "TERM_VAR";
+    case Op::TERM_BOOLEAN: return "TERM_BOOLEAN";
+    case Op::TERM_INTEGER: return "TERM_INTEGER";
+    case Op::TERM_REAL: return "TERM_REAL";
+    case Op::TERM_BITVECTOR: return "TERM_BITVECTOR";
+    case Op::TERM_STRING: return "TERM_STRING";
+    case Op::TERM_ROUNDINGMODE: return "TERM_ROUNDINGMODE";
+    case Op::TERM_FLOATINGPOINT: return "TERM_FLOATINGPOINT";
+    case Op::TERM_FINITE_FIELD: return "TERM_FINITE_FIELD";
+    case Op::TERM_CONST_ARRAY: return "TERM_CONST_ARRAY";
+    case Op::TERM_NULLARY: return "TERM_NULLARY";
+    case Op::TERM_APP: return "TERM_APP";
+    case Op::TERM_UNSUPPORTED: return "TERM_UNSUPPORTED";
+    case Op::NEW_SOLVER: return "NEW_SOLVER";
+    case Op::DELETE_SOLVER: return "DELETE_SOLVER";
+    case Op::SET_OPTION: return "SET_OPTION";
+    case Op::SET_LOGIC: return "SET_LOGIC";
+    case Op::SET_INFO: return "SET_INFO";
+    case Op::DECLARE_FUN: return "DECLARE_FUN";
+    case Op::DECLARE_SORT: return "DECLARE_SORT";
+    case Op::DEFINE_FUN: return "DEFINE_FUN";
+    case Op::DEFINE_FUN_REC: return "DEFINE_FUN_REC";
+    case Op::ASSERT_FORMULA: return "ASSERT_FORMULA";
+    case Op::PUSH: return "PUSH";
+    case Op::POP: return "POP";
+    case Op::RESET_ASSERTIONS: return "RESET_ASSERTIONS";
+    case Op::CHECK_SAT: return "CHECK_SAT";
+    case Op::CHECK_SAT_ASSUMING: return "CHECK_SAT_ASSUMING";
+    case Op::RESULT: return "RESULT";
+    case Op::SIMPLIFY: return "SIMPLIFY";
+    case Op::GET_VALUE: return "GET_VALUE";
+    case Op::GET_UNSAT_CORE: return "GET_UNSAT_CORE";
+    case Op::GET_UNSAT_ASSUMPTIONS: return "GET_UNSAT_ASSUMPTIONS";
+    case Op::BLOCK_MODEL: return "BLOCK_MODEL";
+    case Op::BLOCK_MODEL_VALUES: return "BLOCK_MODEL_VALUES";
+    default: return "?";
+  }
+}
+
+/** @return True if the given opcode defines a sort. */
+inline bool isSortDefinition(Op op) { return op <= Op::SORT_UNSUPPORTED; }
+
+/** @return True if the given opcode defines a term. */
+inline bool isTermDefinition(Op op)
+{
+  return op >= Op::TERM_CONST && op <= Op::TERM_UNSUPPORTED;
+}
+
+/** Buffered encoding of trace records. */
+class Writer
+{
+ public:
+  /** Append an unsigned integer. */
+  void writeUnsigned(uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      d_buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    d_buffer.push_back(static_cast<char>(value));
+  }
+  /** Append an opcode. */
+  void writeOp(Op op) { writeUnsigned(static_cast<uint64_t>(op)); }
+  /** Append a string. */
+  void writeString(const std::string& s)
+  {
+    writeUnsigned(s.size());
+    d_buffer.append(s);
+  }
+  /** Append the header of a trace. */
+  void writeHeader()
+  {
+    d_buffer.append(s_magic, sizeof(s_magic));
+    writeUnsigned(s_version);
+  }
+  /** Append the contents of another writer and clear it. */
+  void append(Writer& w)
+  {
+    d_buffer.append(w.d_buffer);
+    w.d_buffer.clear();
+  }
+  /** @return The number of buffered bytes. */
+  size_t size() const { return d_buffer.size(); }
+  /** Write the buffered bytes to the given stream and clear the buffer. */
+  void flush(std::ostream& out)
+  {
+    out.write(d_buffer.data(), d_buffer.size());
+    d_buffer.clear();
+  }
+
+ private:
+  /** The buffered bytes. */
+  std::string d_buffer;
+};
+
+/** Decoding of trace records. The read functions return false on EOF. */
+class Reader
+{
+ public:
+  Reader(std::istream& in) : d_in(in) {}
+  /** Read an unsigned integer. */
+  bool readUnsigned(uint64_t& value)
+  {
+    value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+      int c = d_in.get();
+      if (c == std::char_traits<char>::eof())
+      {
+        return false;
+      }
+      value |= static_cast<uint64_t>(c & 0x7f) << shift;
+      if ((c & 0x80) == 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+  /** Read an opcode. */
+  bool readOp(Op& op)
+  {
+    uint64_t value;
+    if (!readUnsigned(value) || value >= static_cast<uint64_t>(Op::NUM_OPS))
+    {
+      return false;
+    }
+    op = static_cast<Op>(value);
+    return true;
+  }
+  /** Read a string. */
+  bool readString(std::string& s)
+  {
+    uint64_t size;
+    if (!readUnsigned(size))
+    {
+      return false;
+    }
+    s.resize(size);
+    d_in.read(s.data(), size);
+    return static_cast<uint64_t>(d_in.gcount()) == size;
+  }
+  /** Read and check the header of a trace. */
+  bool readHeader()
+  {
+    char magic[sizeof(s_magic)];
+    d_in.read(magic, sizeof(s_magic));
+    uint64_t version;
+    return d_in.gcount() == sizeof(s_magic)
+           && std::char_traits<char>::compare(magic, s_magic, sizeof(s_magic))
+                  == 0
+           && readUnsigned(version) && version == s_version;
+  }
+
+ private:
+  /** The input stream. */
+  std::istream& d_in;
+};
+
+}  // namespace cvc5::internal::apitrace
+
+#endif
@@ -2025,6 +2025,27 @@ public class Solver extends AbstractPointer
 
   private native void assertFormula(long pointer, long termPointer);
 
+  /**
+   * Assert a list of formulas, in order.
+   *
+   * This is equivalent to calling {@link Solver#assertFormula(Term)} for each
+   * of the given formulas, but performs the checks and the bookkeeping of the
+   * assertions once for all formulas.
+   *
+   * SMT-LIB:
+   * {@code
+   *   ( assert <term> )*
+   * }
+   * @param terms The formulas to assert.
+   */
+  public void assertFormulas(Term[] terms)
+  {
+    long[] pointers = Utils.getPointers(terms);
+    assertFormulas(pointer, pointers);
+  }
+
+  private native void assertFormulas(long pointer, long[] termPointers);
+
   /**
    * Check satisfiability.
    *
@@ -2081,6 +2102,25 @@ public class Solver extends AbstractPointer
 
   private native long checkSatAssuming(long pointer, long[] assumptionPointers);
 
+  /**
+   * Interrupt the current satisfiability check (or other solving call such as
+   * getting an interpolant), or the next one if no such call is running. The
+   * interrupted call then returns an unknown result with explanation
+   * {@link UnknownExplanation#INTERRUPTED}.
+   *
+   * @api.note This is the only method of the solver that may be called from a
+   *           thread other than the one using the solver, e.g., to cancel a
+   *           call to {@link #checkSat()} that runs on another thread.
+   *
+   * @api.note This method is experimental and may change in future versions.
+   */
+  public void interrupt()
+  {
+    interrupt(pointer);
+  }
+
+  private native void interrupt(long pointer);
+
   /**
    * Create datatype sort.
    *
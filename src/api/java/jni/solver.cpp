@@ -116,6 +116,21 @@ JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_assertFormula(
   CVC5_JAVA_API_TRY_CATCH_END(env);
 }
 
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    assertFormulas
+ * Signature: (J[J)V
+ */
+JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_assertFormulas(
+    JNIEnv* env, jobject, jlong pointer, jlongArray jTerms)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  std::vector<Term> terms = getObjectsFromPointers<Term>(env, jTerms);
+  solver->assertFormulas(terms);
+  CVC5_JAVA_API_TRY_CATCH_END(env);
+}
+
 /*
  * Class:     io_github_cvc5_Solver
  * Method:    checkSat
@@ -165,6 +180,21 @@ JNIEXPORT jlong JNICALL Java_io_github_cvc5_Solver_checkSatAssuming__J_3J(
   CVC5_JAVA_API_TRY_CATCH_END_RETURN(env, 0);
 }
 
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    interrupt
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_interrupt(JNIEnv* env,
+                                                            jobject,
+                                                            jlong pointer)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  solver->interrupt();
+  CVC5_JAVA_API_TRY_CATCH_END(env);
+}
+
 /*
  * Class:     io_github_cvc5_Solver
  * Method:    declareDatatype
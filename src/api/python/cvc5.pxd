@@ -434,6 +434,7 @@ cdef extern from "<cvc5/cvc5.h>" namespace "cvc5":
         Term mkVar(Sort sort) except +
         Term simplify(const Term& t, bint applySubs) except +
         void assertFormula(Term term) except +
+        void assertFormulas(const vector[Term]& terms) except +
         Result checkSat() except +
         Result checkSatAssuming(const vector[Term]& assumptions) except +
         Sort declareDatatype(const string& symbol, const vector[DatatypeConstructorDecl]& ctors)
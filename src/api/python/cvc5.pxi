@@ -3352,6 +3352,27 @@ cdef class Solver:
         """
         self.csolver.assertFormula(term.cterm)
 
+    def assertFormulas(self, terms):
+        """
+            Assert a list of formulas, in order.
+
+            This is equivalent to calling :py:meth:`assertFormula()` for
+            each of the given formulas, but performs the checks and the
+            bookkeeping of the assertions once for all formulas.
+
+            SMT-LIB:
+
+            .. code-block:: smtlib
+
+                ( assert <term> )*
+
+            :param terms: The formulas to assert.
+        """
+        cdef vector[c_Term] v
+        for t in terms:
+            v.push_back((<Term?> t).cterm)
+        self.csolver.assertFormulas(v)
+
     def checkSat(self):
         """
             Check satisfiability.
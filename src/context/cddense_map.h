@@ -0,0 +1,272 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Tim King, Andres Noetzli, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Context-dependent map indexed by dense integer keys, with a trail of edits.
+ *
+ * This is the same as CDTrailHashMap, except that the elements are found
+ * through an index addressed by KeyIndex()(k) instead of a hash table. This
+ * is meant for keys that are (or map to) dense integers, such as SAT literals
+ * or node ids, where a lookup is then three array loads. The index is made of
+ * lazily allocated pages of 1024 entries, so that a map using only a few keys
+ * with large indices stays small.
+ *
+ * See also:
+ *  CDTrailHashMap : The same map for arbitrary keys.
+ *
+ * Notes:
+ * - Iteration is in insertion order.
+ * - operator[] is only supported as a const derefence (must succeed), use
+ *   insert(k, d) to insert or overwrite.
+ * - Elements cannot be erased.
+ * - Iterators and references are invalidated by insertions and pops.
+ */
+
+#include "cvc5parser_public.h"
+
+#ifndef CVC5__CONTEXT__CDDENSE_MAP_H
+#define CVC5__CONTEXT__CDDENSE_MAP_H
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "context/context.h"
+
+namespace cvc5::context {
+
+template <class Key, class Data, class KeyIndex>
+class CDDenseMap : public ContextObj
+{
+ public:
+  // The type of the <key, data> values in the map.
+  using value_type = std::pair<const Key, Data>;
+
+ private:
+  using ElementVec = std::vector<value_type>;
+
+  /** The elements, in the order of their insertion */
+  ElementVec d_elements;
+
+  /** log2 of the number of entries per page of the index */
+  static constexpr size_t s_logPageSize = 10;
+  /** the number of entries per page of the index */
+  static constexpr size_t s_pageSize = size_t(1) << s_logPageSize;
+
+  /**
+   * The pages of the index of the elements by key. The entry KeyIndex()(k) is
+   * either 0 (absent) or one plus the index of the element of key k in
+   * d_elements.
+   */
+  std::vector<std::unique_ptr<uint32_t[]>> d_pages;
+
+  /** The trail of overwrites, as pairs of element index and previous data */
+  std::vector<std::pair<uint32_t, Data>> d_overwrites;
+
+  /** The number of elements, saved for restores */
+  size_t d_size;
+
+  /** The number of overwrites on the trail, saved for restores */
+  size_t d_numOverwrites;
+
+  /**
+   * The number of elements at the time of the last save. Elements with a
+   * larger index were inserted in the current context level, and
+   * overwriting them needs not be undone.
+   */
+  size_t d_levelSize;
+
+  /** The index function */
+  KeyIndex d_keyIndex;
+
+  /**
+   * Private copy constructor used only by save(). The vectors are not
+   * copied: only the sizes are needed in restore.
+   */
+  CDDenseMap(const CDDenseMap& l)
+      : ContextObj(l),
+        d_size(l.d_size),
+        d_numOverwrites(l.d_numOverwrites),
+        d_levelSize(l.d_levelSize)
+  {
+  }
+  CDDenseMap& operator=(const CDDenseMap&) = delete;
+
+  /**
+   * Implementation of mandatory ContextObj method save: copies the sizes
+   * using the copy constructor. The saved information is allocated using
+   * the ContextMemoryManager.
+   */
+  ContextObj* save(ContextMemoryManager* pCMM) override
+  {
+    ContextObj* data = new (pCMM) CDDenseMap(*this);
+    d_levelSize = d_size;
+    return data;
+  }
+
+ protected:
+  /**
+   * Implementation of mandatory ContextObj method restore: undoes the
+   * overwrites and removes the elements since the save.
+   */
+  void restore(ContextObj* data) override
+  {
+    const CDDenseMap* saved = static_cast<CDDenseMap*>(data);
+    while (d_overwrites.size() > saved->d_numOverwrites)
+    {
+      std::pair<uint32_t, Data>& o = d_overwrites.back();
+      d_elements[o.first].second = std::move(o.second);
+      d_overwrites.pop_back();
+    }
+    while (d_elements.size() > saved->d_size)
+    {
+      entry(d_keyIndex(d_elements.back().first)) = 0;
+      d_elements.pop_back();
+    }
+    d_size = saved->d_size;
+    d_numOverwrites = saved->d_numOverwrites;
+    d_levelSize = saved->d_levelSize;
+  }
+
+  /**
+   * Implementation of ContextObj method discardSaved: nothing to do, since
+   * the saved copy only holds sizes.
+   */
+  void discardSaved(ContextObj* data) override {}
+
+ private:
+  /** Get one plus the index of the element with key k, or 0 if none */
+  uint32_t lookup(const Key& k) const
+  {
+    size_t i = d_keyIndex(k);
+    size_t page = i >> s_logPageSize;
+    if (page >= d_pages.size() || d_pages[page] == nullptr)
+    {
+      return 0;
+    }
+    return d_pages[page][i & (s_pageSize - 1)];
+  }
+
+  /** Get the entry of index i, allocating its page if necessary */
+  uint32_t& entry(size_t i)
+  {
+    size_t page = i >> s_logPageSize;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (d_pages[page] == nullptr)
+    {
+      d_pages[page].reset(new uint32_t[s_pageSize]());
+    }
+    return d_pages[page][i & (s_pageSize - 1)];
+  }
+
+ public:
+  /**
+   * Main constructor: the map starts empty.
+   */
+  CDDenseMap(Context* context)
+      : ContextObj(context), d_size(0), d_numOverwrites(0), d_levelSize(0)
+  {
+  }
+
+  ~CDDenseMap() { this->destroy(); }
+
+  /** An iterator over the elements, in the order of their insertion. */
+  using const_iterator = typename ElementVec::const_iterator;
+  using iterator = const_iterator;
+
+  /** Returns true if the map is empty in the current context. */
+  bool empty() const { return d_size == 0; }
+
+  /** Returns the size of the map in the current context. */
+  size_t size() const { return d_size; }
+
+  /**
+   * Maps k to d in the current context, overwriting the data of k if it is
+   * already mapped. Returns true if k was not mapped before.
+   */
+  bool insert(const Key& k, const Data& d)
+  {
+    makeCurrent();
+    uint32_t& e = entry(d_keyIndex(k));
+    if (e != 0)
+    {
+      uint32_t index = e - 1;
+      if (index < d_levelSize)
+      {
+        d_overwrites.emplace_back(index, d_elements[index].second);
+        ++d_numOverwrites;
+      }
+      d_elements[index].second = d;
+      return false;
+    }
+    d_elements.emplace_back(k, d);
+    e = d_elements.size();
+    ++d_size;
+    return true;
+  }
+
+  /**
+   * Checks if the key k is mapped already.
+   * If it is, this returns false.
+   * Otherwise it is inserted and this returns true.
+   */
+  bool insert_safe(const Key& k, const Data& d)
+  {
+    if (contains(k))
+    {
+      return false;
+    }
+    return insert(k, d);
+  }
+
+  /** Returns true if k is a mapped key in the context. */
+  bool contains(const Key& k) const { return lookup(k) != 0; }
+
+  /**
+   * Returns a reference the data mapped by k.
+   * k must be in the map in this context.
+   */
+  const Data& operator[](const Key& k) const
+  {
+    uint32_t index = lookup(k);
+    Assert(index != 0);
+    return d_elements[index - 1].second;
+  }
+
+  /**
+   * Returns a const_iterator to the value_type if k is a mapped key in
+   * the context, and end() otherwise.
+   */
+  const_iterator find(const Key& k) const
+  {
+    uint32_t index = lookup(k);
+    if (index == 0)
+    {
+      return end();
+    }
+    return d_elements.begin() + (index - 1);
+  }
+
+  /** Returns an iterator to the first element of the map. */
+  const_iterator begin() const { return d_elements.begin(); }
+
+  /** Returns an iterator to the end of the map. */
+  const_iterator end() const { return d_elements.end(); }
+}; /* class CDDenseMap<> */
+
+}  // namespace cvc5::context
+
+#endif /* CVC5__CONTEXT__CDDENSE_MAP_H */
@@ -176,6 +176,13 @@ class CDOhash_map : public ContextObj
     p->mutable_data().~Data();
   }
 
+  void discardSaved(ContextObj* data) override
+  {
+    CDOhash_map* p = static_cast<CDOhash_map*>(data);
+    p->mutable_key().~Key();
+    p->mutable_data().~Data();
+  }
+
   /** ensure copy ctor is only called by us */
   CDOhash_map(const CDOhash_map& other)
       : ContextObj(other),
@@ -202,6 +209,7 @@ class CDOhash_map : public ContextObj
     // we want the restore of d_map to NULL to signal us to remove
     // the element from the map.
 
+    inheritStatisticsOwner(map);
     set(data);
     d_map = map;
 
@@ -239,6 +239,13 @@ protected:
    d_size = restoreSize;
    Assert(d_insertMap->size() == d_size);
   }
+
+ /**
+  * Implementation of ContextObj method discardSaved: nothing to do, since
+  * the saved copy only holds the size.
+  */
+ void discardSaved(ContextObj* data) override {}
+
 public:
 
  /**
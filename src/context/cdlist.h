@@ -31,9 +31,52 @@
 #include "context/context.h"
 #include "context/context_mm.h"
 #include "context/default_clean_up.h"
+#include "context/segmented_vector.h"
 
 namespace cvc5::context {
 
+/**
+ * The backing store of a CDList, which is selected by its allocator. By
+ * default, the elements are stored in an std::vector, which relocates the
+ * elements when it grows.
+ */
+template <class T, class Allocator>
+struct CDListStorage
+{
+  using type = std::vector<T>;
+  static type make(Context* context) { return type(); }
+  /** Called after d_list was restored to a previous size */
+  static void restored(type& list) {}
+};
+
+/**
+ * With a SegmentedAllocator, the elements are stored in heap-allocated
+ * segments that are never relocated. Segments are kept for reuse after a pop.
+ */
+template <class T>
+struct CDListStorage<T, SegmentedAllocator<T>>
+{
+  using type = SegmentedVector<T>;
+  static type make(Context* context) { return type(); }
+  static void restored(type& list) {}
+};
+
+/**
+ * With a ContextMemoryAllocator, the elements are stored in segments that
+ * are allocated by the context memory manager. A pop releases the segments
+ * beyond the restored size, which were allocated in the popped levels.
+ */
+template <class T>
+struct CDListStorage<T, ContextMemoryAllocator<T>>
+{
+  using type = SegmentedVector<T, ContextMemoryAllocator<T>>;
+  static type make(Context* context)
+  {
+    return type(ContextMemoryAllocator<T>(context->getCMM()));
+  }
+  static void restored(type& list) { list.releaseSegments(); }
+};
+
 /**
  * Generic context-dependent dynamic array.  Note that for efficiency, this
  * implementation makes the following assumption: Over time, objects are only
@@ -50,6 +93,9 @@ class CDList : public ContextObj
   /** The cleanup type with which this CDList<> was instantiated. */
   using CleanUp = CleanUpT;
 
+  /** The type of the backing store, see CDListStorage. */
+  using List = typename CDListStorage<T, Allocator>::type;
+
   /**
    * `std::vector<T>::operator[] const` returns an
    * std::vector<T>::const_reference, which does not necessarily have to be a
@@ -57,14 +103,14 @@ class CDList : public ContextObj
    * specialized to be just a simple `bool`. For our `operator[] const`, we use
    * the same type.
    */
-  using ConstReference = typename std::vector<T>::const_reference;
+  using ConstReference = typename List::const_reference;
 
   /**
    * Instead of implementing our own iterators, we just use the iterators of
-   * the underlying `std::vector<T>`.
+   * the underlying backing store.
    */
-  using const_iterator = typename std::vector<T>::const_iterator;
-  using iterator = typename std::vector<T>::const_iterator;
+  using const_iterator = typename List::const_iterator;
+  using iterator = typename List::const_iterator;
 
   /**
    * Main constructor: d_list starts with size 0
@@ -78,7 +124,7 @@ class CDList : public ContextObj
          bool callCleanup = true,
          const CleanUp& cleanup = CleanUp())
       : ContextObj(context),
-        d_list(),
+        d_list(CDListStorage<T, Allocator>::make(context)),
         d_size(0),
         d_callCleanup(callCleanup),
         d_cleanUp(cleanup)
@@ -173,6 +219,7 @@ class CDList : public ContextObj
    */
   CDList(const CDList& l)
       : ContextObj(l),
+        d_list(CDListStorage<T, Allocator>::make(l.getContext())),
         d_size(l.d_size),
         d_callCleanup(false),
         d_cleanUp(l.d_cleanUp)
@@ -190,8 +237,15 @@ class CDList : public ContextObj
   void restore(ContextObj* data) override
   {
     truncateList(((CDList<T, CleanUp, Allocator>*)data)->d_size);
+    CDListStorage<T, Allocator>::restored(d_list);
   }
 
+  /**
+   * Implementation of ContextObj method discardSaved: nothing to do, since
+   * the saved copy only holds the size.
+   */
+  void discardSaved(ContextObj* data) override {}
+
   /**
    * Given a size parameter smaller than d_size, truncateList()
    * removes the elements from the end of the list until d_size equals size.
@@ -209,7 +263,7 @@ class CDList : public ContextObj
       while (d_size != size)
       {
         --d_size;
-        typename std::vector<T>::reference elem = d_list[d_size];
+        typename List::reference elem = d_list[d_size];
         d_cleanUp(elem);
       }
     }
@@ -225,7 +279,7 @@ class CDList : public ContextObj
   /**
    * d_list is a vector of objects of type T.
    */
-  std::vector<T> d_list;
+  List d_list;
 
   /**
    * Number of objects in d_list
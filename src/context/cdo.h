@@ -70,6 +70,15 @@ protected:
     p->d_data.~T();
   }
 
+  /**
+   * Implementation of ContextObj method discardSaved: only destroys the
+   * saved data.
+   */
+  void discardSaved(ContextObj* pContextObj) override
+  {
+    static_cast<CDO<T>*>(pContextObj)->d_data.~T();
+  }
+
 public:
 
   /**
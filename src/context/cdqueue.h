@@ -33,7 +33,6 @@ namespace cvc5::context {
 template <class T, class CleanUp = DefaultCleanUp<T>, class Allocator = std::allocator<T> >
 class CDQueue;
 
-/** We don't define a template with Allocator for the first implementation */
 template <class T, class CleanUp, class Allocator>
 class CDQueue : public CDList<T, CleanUp, Allocator> {
 private:
@@ -84,11 +83,13 @@ protected:
 
 public:
 
-  /** Creates a new CDQueue associated with the current context. */
+  /**
+   * Creates a new CDQueue associated with the current context. The backing
+   * store is selected by Allocator, see CDListStorage.
+   */
  CDQueue(Context* context,
          bool callCleanup = true,
-         const CleanUp& cleanup = CleanUp(),
-         const Allocator& alloc = Allocator())
+         const CleanUp& cleanup = CleanUp())
      : ParentType(context, callCleanup, cleanup), d_iter(0), d_lastsave(0)
  {
  }
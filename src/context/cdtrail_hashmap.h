@@ -0,0 +1,295 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Tim King, Andres Noetzli, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Context-dependent hashmap built using open addressing and a trail of edits.
+ *
+ * The elements of the map are stored in a vector in the order of their
+ * insertion, and are looked up by a linearly probed hash table of indices
+ * into this vector. Overwriting the data of a key records the previous data
+ * on an undo trail. On a pop, the overwrites are undone and the elements
+ * inserted since the push are removed by truncating both vectors, so that
+ * backtracking costs time proportional to the number of edits. Only a
+ * single ContextObj is saved per context level.
+ *
+ * Since elements are removed in the reverse order of their insertion, the
+ * slot of a removed element can simply be cleared: every element whose probe
+ * sequence passes this slot was inserted later, and has thus already been
+ * removed.
+ *
+ * See also:
+ *  CDInsertHashMap : A CD hash map that only allows one insertion per key.
+ *  CDHashMap : A fully featured CD hash map. (The closest to <ext/hash_map>)
+ *
+ * Notes:
+ * - Iteration is in insertion order.
+ * - operator[] is only supported as a const derefence (must succeed), use
+ *   insert(k, d) to insert or overwrite.
+ * - Elements cannot be erased.
+ * - Iterators and references are invalidated by insertions and pops.
+ */
+
+#include "cvc5parser_public.h"
+
+#ifndef CVC5__CONTEXT__CDTRAIL_HASHMAP_H
+#define CVC5__CONTEXT__CDTRAIL_HASHMAP_H
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "context/cdtrail_hashmap_forward.h"
+#include "context/context.h"
+
+namespace cvc5::context {
+
+template <class Key, class Data, class HashFcn>
+class CDTrailHashMap : public ContextObj
+{
+ public:
+  // The type of the <key, data> values in the hashmap.
+  using value_type = std::pair<const Key, Data>;
+
+ private:
+  using ElementVec = std::vector<value_type>;
+
+  /** The elements, in the order of their insertion */
+  ElementVec d_elements;
+
+  /** The slot in d_table of each element of d_elements */
+  std::vector<uint32_t> d_slots;
+
+  /**
+   * The hash table. Each slot is either 0 (empty) or one plus the index of
+   * an element of d_elements. The size of the table is a power of two.
+   */
+  std::vector<uint32_t> d_table;
+
+  /** The trail of overwrites, as pairs of element index and previous data */
+  std::vector<std::pair<uint32_t, Data>> d_overwrites;
+
+  /** The number of elements, saved for restores */
+  size_t d_size;
+
+  /** The number of overwrites on the trail, saved for restores */
+  size_t d_numOverwrites;
+
+  /**
+   * The number of elements at the time of the last save. Elements with a
+   * larger index were inserted in the current context level, and
+   * overwriting them needs not be undone.
+   */
+  size_t d_levelSize;
+
+  /** The hash function */
+  HashFcn d_hash;
+
+  /**
+   * Private copy constructor used only by save(). The vectors are not
+   * copied: only the sizes are needed in restore.
+   */
+  CDTrailHashMap(const CDTrailHashMap& l)
+      : ContextObj(l),
+        d_size(l.d_size),
+        d_numOverwrites(l.d_numOverwrites),
+        d_levelSize(l.d_levelSize)
+  {
+  }
+  CDTrailHashMap& operator=(const CDTrailHashMap&) = delete;
+
+  /**
+   * Implementation of mandatory ContextObj method save: copies the sizes
+   * using the copy constructor. The saved information is allocated using
+   * the ContextMemoryManager.
+   */
+  ContextObj* save(ContextMemoryManager* pCMM) override
+  {
+    ContextObj* data = new (pCMM) CDTrailHashMap(*this);
+    d_levelSize = d_size;
+    return data;
+  }
+
+ protected:
+  /**
+   * Implementation of mandatory ContextObj method restore: undoes the
+   * overwrites and removes the elements since the save.
+   */
+  void restore(ContextObj* data) override
+  {
+    const CDTrailHashMap* saved = static_cast<CDTrailHashMap*>(data);
+    while (d_overwrites.size() > saved->d_numOverwrites)
+    {
+      std::pair<uint32_t, Data>& o = d_overwrites.back();
+      d_elements[o.first].second = std::move(o.second);
+      d_overwrites.pop_back();
+    }
+    while (d_elements.size() > saved->d_size)
+    {
+      d_table[d_slots.back()] = 0;
+      d_slots.pop_back();
+      d_elements.pop_back();
+    }
+    d_size = saved->d_size;
+    d_numOverwrites = saved->d_numOverwrites;
+    d_levelSize = saved->d_levelSize;
+  }
+
+  /**
+   * Implementation of ContextObj method discardSaved: nothing to do, since
+   * the saved copy only holds sizes.
+   */
+  void discardSaved(ContextObj* data) override {}
+
+ private:
+  /**
+   * Get the slot of key k, which is either the slot of the element with
+   * key k or the empty slot where k would be inserted.
+   */
+  uint32_t findSlot(const Key& k) const
+  {
+    uint32_t mask = d_table.size() - 1;
+    uint32_t slot = static_cast<uint32_t>(d_hash(k)) & mask;
+    while (d_table[slot] != 0 && !(d_elements[d_table[slot] - 1].first == k))
+    {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  /** Double the size of the hash table and rehash all elements */
+  void grow()
+  {
+    d_table.assign(d_table.size() * 2, 0);
+    uint32_t mask = d_table.size() - 1;
+    // rehash in insertion order, which maintains that the probe sequences
+    // are compatible with removals in reverse insertion order
+    for (size_t i = 0, n = d_elements.size(); i < n; ++i)
+    {
+      uint32_t slot = static_cast<uint32_t>(d_hash(d_elements[i].first)) & mask;
+      while (d_table[slot] != 0)
+      {
+        slot = (slot + 1) & mask;
+      }
+      d_table[slot] = i + 1;
+      d_slots[i] = slot;
+    }
+  }
+
+ public:
+  /**
+   * Main constructor: the map starts empty.
+   */
+  CDTrailHashMap(Context* context)
+      : ContextObj(context),
+        d_table(16, 0),
+        d_size(0),
+        d_numOverwrites(0),
+        d_levelSize(0)
+  {
+  }
+
+  ~CDTrailHashMap() { this->destroy(); }
+
+  /** An iterator over the elements, in the order of their insertion. */
+  using const_iterator = typename ElementVec::const_iterator;
+  using iterator = const_iterator;
+
+  /** Returns true if the map is empty in the current context. */
+  bool empty() const { return d_size == 0; }
+
+  /** Returns the size of the map in the current context. */
+  size_t size() const { return d_size; }
+
+  /**
+   * Maps k to d in the current context, overwriting the data of k if it is
+   * already mapped. Returns true if k was not mapped before.
+   */
+  bool insert(const Key& k, const Data& d)
+  {
+    makeCurrent();
+    uint32_t slot = findSlot(k);
+    if (d_table[slot] != 0)
+    {
+      uint32_t index = d_table[slot] - 1;
+      if (index < d_levelSize)
+      {
+        d_overwrites.emplace_back(index, d_elements[index].second);
+        ++d_numOverwrites;
+      }
+      d_elements[index].second = d;
+      return false;
+    }
+    d_elements.emplace_back(k, d);
+    d_slots.push_back(slot);
+    d_table[slot] = d_elements.size();
+    ++d_size;
+    // keep the load factor of the table at most 1/2
+    if (2 * d_elements.size() > d_table.size())
+    {
+      grow();
+    }
+    return true;
+  }
+
+  /**
+   * Checks if the key k is mapped already.
+   * If it is, this returns false.
+   * Otherwise it is inserted and this returns true.
+   */
+  bool insert_safe(const Key& k, const Data& d)
+  {
+    if (contains(k))
+    {
+      return false;
+    }
+    return insert(k, d);
+  }
+
+  /** Returns true if k is a mapped key in the context. */
+  bool contains(const Key& k) const { return d_table[findSlot(k)] != 0; }
+
+  /**
+   * Returns a reference the data mapped by k.
+   * k must be in the map in this context.
+   */
+  const Data& operator[](const Key& k) const
+  {
+    uint32_t slot = findSlot(k);
+    Assert(d_table[slot] != 0);
+    return d_elements[d_table[slot] - 1].second;
+  }
+
+  /**
+   * Returns a const_iterator to the value_type if k is a mapped key in
+   * the context, and end() otherwise.
+   */
+  const_iterator find(const Key& k) const
+  {
+    uint32_t slot = findSlot(k);
+    if (d_table[slot] == 0)
+    {
+      return end();
+    }
+    return d_elements.begin() + (d_table[slot] - 1);
+  }
+
+  /** Returns an iterator to the first element of the map. */
+  const_iterator begin() const { return d_elements.begin(); }
+
+  /** Returns an iterator to the end of the map. */
+  const_iterator end() const { return d_elements.end(); }
+}; /* class CDTrailHashMap<> */
+
+}  // namespace cvc5::context
+
+#endif /* CVC5__CONTEXT__CDTRAIL_HASHMAP_H */
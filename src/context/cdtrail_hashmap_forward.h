@@ -0,0 +1,36 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Tim King, Mathias Preiner, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * This is a forward declaration header to declare the CDTrailHashMap<>
+ * template.
+ *
+ * It's useful if you want to forward-declare CDTrailHashMap<> without
+ * including the full cdtrail_hashmap.h header, for example, in a public
+ * header context.
+ *
+ * For CDTrailHashMap<> in particular, it's difficult to forward-declare it
+ * yourself, because it has a default template argument.
+ */
+
+#include "cvc5_public.h"
+
+#ifndef CVC5__CONTEXT__CDTRAIL_HASHMAP_FORWARD_H
+#define CVC5__CONTEXT__CDTRAIL_HASHMAP_FORWARD_H
+
+#include <functional>
+
+namespace cvc5::context {
+template <class Key, class Data, class HashFcn = std::hash<Key> >
+class CDTrailHashMap;
+}  // namespace cvc5::context
+
+#endif /* CVC5__CONTEXT__CDTRAIL_HASHMAP_FORWARD_H */
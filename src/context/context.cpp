@@ -14,15 +14,20 @@
  */
 
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "base/check.h"
 #include "context/context.h"
+#include "context/context_stats.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::context {
 
-Context::Context() : d_pCNOpre(NULL), d_pCNOpost(NULL) {
+Context::Context()
+    : d_pCNOpre(NULL), d_pCNOpost(NULL), d_popTimer(nullptr), d_stats(nullptr)
+{
   // Create new memory manager
   d_pCMM = new ContextMemoryManager();
 
@@ -74,7 +79,19 @@ void Context::push() {
 
 void Context::pop() {
   Assert(getLevel() > 0) << "Cannot pop below level 0";
+  if (d_popTimer != nullptr)
+  {
+    internal::CodeTimer popTimer(*d_popTimer, true);
+    popScope();
+  }
+  else
+  {
+    popScope();
+  }
+}
 
+void Context::popScope()
+{
   // Notify the (pre-pop) ContextNotifyObj objects
   ContextNotifyObj* pCNO = d_pCNOpre;
   while(pCNO != NULL) {
@@ -111,8 +128,81 @@ void Context::pop() {
 
 void Context::popto(uint32_t toLevel)
 {
-  // Pop scopes until there are none left or toLevel is reached
-  while (toLevel < getLevel()) pop();
+  if (toLevel >= getLevel())
+  {
+    return;
+  }
+  std::unique_ptr<internal::CodeTimer> popTimer;
+  if (d_popTimer != nullptr)
+  {
+    popTimer = std::make_unique<internal::CodeTimer>(*d_popTimer, true);
+  }
+  if (toLevel + 1 == getLevel())
+  {
+    popScope();
+  }
+  else
+  {
+    popScopes(toLevel);
+  }
+}
+
+void Context::popScopes(uint32_t toLevel)
+{
+  Assert(toLevel < getLevel());
+  Trace("pushpop") << std::string(2 * toLevel, ' ') << "} Pop [from "
+                   << getLevel() << " to " << toLevel << "] " << this
+                   << std::endl;
+
+  // Notify the (pre-pop) ContextNotifyObj objects
+  ContextNotifyObj* pCNO = d_pCNOpre;
+  while (pCNO != NULL)
+  {
+    // pre-store the "next" pointer in case pCNO deletes itself on notify()
+    ContextNotifyObj* next = pCNO->d_pCNOnext;
+    pCNO->contextNotifyPop();
+    pCNO = next;
+  }
+
+  // Take the popped Scopes off the list, so that the level is toLevel
+  // while the objects are restored
+  std::vector<Scope*> popped(d_scopeList.begin() + toLevel + 1,
+                             d_scopeList.end());
+  d_scopeList.resize(toLevel + 1);
+
+  // Restore all objects of the popped Scopes, from the top. After the
+  // objects of a Scope are restored, all saved copies in the lower popped
+  // Scopes belonging to them are unlinked, so the lower Scopes only contain
+  // objects that were last modified there.
+  for (auto it = popped.rbegin(); it != popped.rend(); ++it)
+  {
+    ContextObj* pContextObj = (*it)->d_pContextObjList;
+    (*it)->d_pContextObjList = nullptr;
+    while (pContextObj != nullptr)
+    {
+      ContextObj* pContextObjNext = pContextObj->next();
+      pContextObj->restoreTo(toLevel);
+      pContextObj = pContextObjNext;
+    }
+  }
+
+  // Delete the Scopes (which collects their garbage) and pop the memory
+  // regions
+  for (auto it = popped.rbegin(); it != popped.rend(); ++it)
+  {
+    delete *it;
+    d_pCMM->pop();
+  }
+
+  // Notify the (post-pop) ContextNotifyObj objects
+  pCNO = d_pCNOpost;
+  while (pCNO != NULL)
+  {
+    // pre-store the "next" pointer in case pCNO deletes itself on notify()
+    ContextNotifyObj* next = pCNO->d_pCNOnext;
+    pCNO->contextNotifyPop();
+    pCNO = next;
+  }
 }
 
 void Context::addNotifyObjPre(ContextNotifyObj* pCNO) {
@@ -137,7 +227,14 @@ void Context::addNotifyObjPost(ContextNotifyObj* pCNO) {
 void ContextObj::update()
 {
   // Call save() to save the information in the current object
+  std::optional<ContextStatistics::Timer> timer;
+  ContextStatistics* stats = d_pScope->getContext()->getStatistics();
+  if (stats != nullptr)
+  {
+    timer.emplace(*stats, this, true);
+  }
   ContextObj* pContextObjSaved = save(d_pScope->getCMM());
+  timer.reset();
 
   // Check that base class data was saved
   Assert((pContextObjSaved->d_pContextObjNext == d_pContextObjNext
@@ -184,7 +281,16 @@ ContextObj* ContextObj::restoreAndContinue()
     // Nothing else to do
   } else {
     // Call restore to update the subclass data
-    restore(d_pContextObjRestore);
+    ContextStatistics* stats = d_pScope->getContext()->getStatistics();
+    if (stats != nullptr)
+    {
+      ContextStatistics::Timer timer(*stats, this, false);
+      restore(d_pContextObjRestore);
+    }
+    else
+    {
+      restore(d_pContextObjRestore);
+    }
 
     // Remember the next object in the list
     pContextObjNext = d_pContextObjNext;
@@ -206,6 +312,52 @@ ContextObj* ContextObj::restoreAndContinue()
   return pContextObjNext;
 }
 
+void ContextObj::restoreTo(uint32_t toLevel)
+{
+  ContextObj* pSaved = d_pContextObjRestore;
+  Assert(pSaved != nullptr) << "Expected a saved copy in a popped scope";
+  std::optional<ContextStatistics::Timer> timer;
+  ContextStatistics* stats = d_pScope->getContext()->getStatistics();
+  if (stats != nullptr)
+  {
+    timer.emplace(*stats, this, false);
+  }
+  while (pSaved->d_pScope->getLevel() > toLevel)
+  {
+    // The saved copy is in a popped scope as well, unlink it from there
+    if (pSaved->next() != nullptr)
+    {
+      pSaved->next()->prev() = pSaved->prev();
+    }
+    *pSaved->prev() = pSaved->next();
+    ContextObj* pSavedNext = pSaved->d_pContextObjRestore;
+    if (pSavedNext == nullptr)
+    {
+      // as in restoreAndContinue, this object does not exist at toLevel
+      restore(pSaved);
+      d_pScope = nullptr;
+      d_pContextObjRestore = nullptr;
+      return;
+    }
+    discardSaved(pSaved);
+    pSaved = pSavedNext;
+  }
+
+  // Call restore to update the subclass data
+  restore(pSaved);
+
+  // Take the place of the saved copy in the list of its scope
+  d_pScope = pSaved->d_pScope;
+  next() = pSaved->d_pContextObjNext;
+  prev() = pSaved->d_ppContextObjPrev;
+  d_pContextObjRestore = pSaved->d_pContextObjRestore;
+  if (next() != nullptr)
+  {
+    next()->prev() = &next();
+  }
+  *prev() = this;
+}
+
 void ContextObj::destroy()
 {
   /* The object to destroy must be valid, i.e., its current state must belong
@@ -238,6 +390,20 @@ void ContextObj::destroy()
   }
   Trace("context") << "after destroy " << this << ":" << std::endl
                    << *getContext() << std::endl;
+  ContextStatistics* stats = getContext()->getStatistics();
+  if (stats != nullptr)
+  {
+    stats->unregisterObject(this);
+  }
+}
+
+void ContextObj::inheritStatisticsOwner(const ContextObj* parent)
+{
+  ContextStatistics* stats = getContext()->getStatistics();
+  if (stats != nullptr)
+  {
+    stats->inheritOwner(this, parent);
+  }
 }
 
 
@@ -251,6 +417,11 @@ ContextObj::ContextObj(Context* pContext) :
   Trace("context") << "create new ContextObj(" << this << " inCMM=false)" << std::endl;
   d_pScope = pContext->getBottomScope();
   d_pScope->addToChain(this);
+  ContextStatistics* stats = pContext->getStatistics();
+  if (stats != nullptr)
+  {
+    stats->registerObject(this);
+  }
 }
 
 void ContextObj::enqueueToGarbageCollect() {
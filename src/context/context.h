@@ -28,12 +28,17 @@
 #include "base/output.h"
 #include "context/context_mm.h"
 
+namespace cvc5::internal {
+class TimerStat;
+}
+
 namespace cvc5::context {
 
 class Context;
 class Scope;
 class ContextObj;
 class ContextNotifyObj;
+class ContextStatistics;
 
 /** Pretty-printing of Contexts (for debugging) */
 std::ostream& operator<<(std::ostream&, const Context&);
@@ -86,8 +91,32 @@ class CVC5_EXPORT Context
    */
   ContextNotifyObj* d_pCNOpost;
 
+  /**
+   * The timer for the time spent in pop() and popto(), or nullptr if pops
+   * are not timed.
+   */
+  internal::TimerStat* d_popTimer;
+
+  /**
+   * The statistics on the save and restore operations of the objects in
+   * this context, or nullptr if they are not collected.
+   */
+  ContextStatistics* d_stats;
+
   friend std::ostream& operator<<(std::ostream&, const Context&);
 
+  /** Pop the top Scope, without timing */
+  void popScope();
+
+  /**
+   * Pop all Scopes above level toLevel at once. Every ContextObj that was
+   * modified above toLevel is restored directly to its version at toLevel,
+   * skipping its intermediate versions (see ContextObj::discardSaved()).
+   * The ContextNotifyObj objects are notified only once, before (resp.
+   * after) all Scopes are popped.
+   */
+  void popScopes(uint32_t toLevel);
+
   // disable copy, assignment
   Context(const Context&) = delete;
   Context& operator=(const Context&) = delete;
@@ -178,10 +207,28 @@ public:
   void pop();
 
   /**
-   * Pop all the way back to given level
+   * Pop all the way back to given level. If this pops more than one level,
+   * all levels are popped at once (see popScopes()).
    */
   void popto(uint32_t toLevel);
 
+  /**
+   * Set the timer for the time spent in pop() and popto(). The timer must
+   * outlive all pops of this context, or be unset by passing nullptr.
+   */
+  void setPopTimer(internal::TimerStat* timer) { d_popTimer = timer; }
+
+  /**
+   * Set the statistics on the save and restore operations of the objects in
+   * this context. Only objects created after this call are attributed to an
+   * owner. The statistics must outlive all operations on this context, or
+   * be unset by passing nullptr.
+   */
+  void setStatistics(ContextStatistics* stats) { d_stats = stats; }
+
+  /** Get the statistics set by setStatistics(), or nullptr */
+  ContextStatistics* getStatistics() const { return d_stats; }
+
   /**
    * Add pCNO to the list of objects notified before every pop
    */
@@ -259,6 +306,9 @@ class Scope {
 
   friend std::ostream& operator<<(std::ostream&, const Scope&);
 
+  /** Context takes over the list of objects when popping several Scopes */
+  friend class Context;
+
  public:
   /**
    * Constructor: Create a new Scope; set the level and the previous Scope
@@ -477,6 +527,17 @@ class CVC5_EXPORT ContextObj
    */
   ContextObj* restoreAndContinue();
 
+  /**
+   * This method is called by Context during a pop of several Scopes at
+   * once: it restores the object directly to its most recent version at
+   * level toLevel or below, and discards the versions in between (see
+   * discardSaved()). Unlike restoreAndContinue(), the object and its
+   * discarded versions are unlinked from the lists of the popped Scopes.
+   */
+  void restoreTo(uint32_t toLevel);
+
+  friend class Context;
+
  protected:
   /**
    * This is a method that must be implemented by all classes inheriting from
@@ -490,6 +551,18 @@ class CVC5_EXPORT ContextObj
    */
   virtual void restore(ContextObj* pContextObjRestore) = 0;
 
+  /**
+   * Release a saved copy which is skipped when several Scopes are popped at
+   * once, i.e., the object is restored from an older saved copy instead.
+   * The default implementation calls restore(), which is always correct.
+   * Classes whose restore() only overwrites the current state from the
+   * saved copy should override this to only release the saved copy.
+   */
+  virtual void discardSaved(ContextObj* pContextObjSaved)
+  {
+    restore(pContextObjSaved);
+  }
+
   /**
    * This method checks if the object has been modified in this Scope
    * yet.  If not, it calls update().
@@ -514,6 +587,12 @@ class CVC5_EXPORT ContextObj
    */
   void destroy();
 
+  /**
+   * Attribute this object to the same owner as parent in the statistics of
+   * the context (see ContextStatistics), if there are any.
+   */
+  void inheritStatisticsOwner(const ContextObj* parent);
+
   /////
   //
   //  These next four accessors return properties of the Scope to
@@ -13,6 +13,7 @@
  * Implementation of Context Memory Manager
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <deque>
 #include <limits>
@@ -20,6 +21,10 @@
 #include <ostream>
 #include <vector>
 
+#ifndef __WIN32__
+#include <sys/mman.h>
+#endif /* ! __WIN32__ */
+
 #ifdef CVC5_VALGRIND
 #include <valgrind/memcheck.h>
 #endif /* CVC5_VALGRIND */
@@ -32,6 +37,98 @@ namespace cvc5::context {
 
 #ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
 
+namespace {
+
+/** The size of a huge page in bytes */
+constexpr size_t s_hugePageSize = 2 << 20;
+
+/** Add n to the counter of level in v */
+void incrementAt(std::vector<uint64_t>& v, size_t level, uint64_t n)
+{
+  if (v.size() <= level)
+  {
+    v.resize(level + 1, 0);
+  }
+  v[level] += n;
+}
+
+}  // namespace
+
+ContextMemoryManager::Chunk ContextMemoryManager::allocateChunk(uint32_t c)
+{
+  size_t size = getChunkSize(c);
+#ifndef __WIN32__
+  if (d_policy.d_hugePages && size >= s_hugePageSize)
+  {
+    void* mem = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    // explicit huge pages, if the system has reserved some
+    mem = mmap(nullptr,
+               size,
+               PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+               -1,
+               0);
+#endif /* MAP_HUGETLB */
+#ifdef MADV_HUGEPAGE
+    // otherwise, ask for transparent huge pages
+    if (mem == MAP_FAILED)
+    {
+      mem = mmap(nullptr,
+                 size,
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS,
+                 -1,
+                 0);
+      if (mem != MAP_FAILED)
+      {
+        madvise(mem, size, MADV_HUGEPAGE);
+      }
+    }
+#endif /* MADV_HUGEPAGE */
+    if (mem != MAP_FAILED)
+    {
+      return Chunk{static_cast<char*>(mem), c, true};
+    }
+  }
+#endif /* ! __WIN32__ */
+  char* data = static_cast<char*>(malloc(size));
+  if (data == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return Chunk{data, c, false};
+}
+
+void ContextMemoryManager::releaseChunk(const Chunk& chunk)
+{
+#ifndef __WIN32__
+  if (chunk.d_mapped)
+  {
+    munmap(chunk.d_data, getChunkSize(chunk.d_class));
+    return;
+  }
+#endif /* ! __WIN32__ */
+  free(chunk.d_data);
+}
+
+uint64_t ContextMemoryManager::releaseFreeChunks(size_t maxBytes)
+{
+  uint64_t n = 0;
+  for (uint32_t c = numChunkClasses; c > 0 && d_freeBytes > maxBytes; --c)
+  {
+    std::deque<Chunk>& chunks = d_freeChunks[c - 1];
+    while (!chunks.empty() && d_freeBytes > maxBytes)
+    {
+      releaseChunk(chunks.front());
+      d_freeBytes -= getChunkSize(c - 1);
+      chunks.pop_front();
+      ++n;
+    }
+  }
+  return n;
+}
+
 void ContextMemoryManager::newChunk() {
 
   // Increment index to chunk list
@@ -39,36 +136,42 @@ void ContextMemoryManager::newChunk() {
   Assert(d_chunkList.size() == d_indexChunkList)
       << "Index should be at the end of the list";
 
+  // Chunks grow geometrically with their index
+  uint32_t c = std::min<uint32_t>(d_indexChunkList, d_maxClass);
+  size_t level = d_nextFreeStack.size();
+  std::deque<Chunk>& chunks = d_freeChunks[c];
   // Create new chunk if no free chunk available
-  if(d_freeChunks.empty()) {
-    d_chunkList.push_back((char*)malloc(chunkSizeBytes));
-    if(d_chunkList.back() == NULL) {
-      throw std::bad_alloc();
-    }
+  if (chunks.empty())
+  {
+    d_chunkList.push_back(allocateChunk(c));
+    incrementAt(d_stats.d_allocated, level, 1);
 
 #ifdef CVC5_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
+    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back().d_data, getChunkSize(c));
 #endif /* CVC5_VALGRIND */
   }
   // If there is a free chunk, use that
   else {
-    d_chunkList.push_back(d_freeChunks.back());
-    d_freeChunks.pop_back();
+    d_chunkList.push_back(chunks.back());
+    chunks.pop_back();
+    d_freeBytes -= getChunkSize(c);
+    incrementAt(d_stats.d_reused, level, 1);
   }
   // Set up the current chunk pointers
-  d_nextFree = d_chunkList.back();
-  d_endChunk = d_nextFree + chunkSizeBytes;
+  d_nextFree = d_chunkList.back().d_data;
+  d_endChunk = d_nextFree + getChunkSize(c);
 }
 
 
-ContextMemoryManager::ContextMemoryManager() : d_indexChunkList(0) {
+ContextMemoryManager::ContextMemoryManager()
+    : d_freeBytes(0), d_indexChunkList(0), d_maxClass(0)
+{
+  setPolicy(ContextMemoryPolicy());
   // Create initial chunk
-  d_chunkList.push_back((char*)malloc(chunkSizeBytes));
-  d_nextFree = d_chunkList.back();
-  if(d_nextFree == NULL) {
-    throw std::bad_alloc();
-  }
+  d_chunkList.push_back(allocateChunk(0));
+  d_nextFree = d_chunkList.back().d_data;
   d_endChunk = d_nextFree + chunkSizeBytes;
+  incrementAt(d_stats.d_allocated, 0, 1);
 
 #ifdef CVC5_VALGRIND
   VALGRIND_CREATE_MEMPOOL(this, 0, false);
@@ -84,16 +187,22 @@ ContextMemoryManager::~ContextMemoryManager() {
 #endif /* CVC5_VALGRIND */
 
   // Delete all chunks
-  while(!d_chunkList.empty()) {
-    free(d_chunkList.back());
-    d_chunkList.pop_back();
-  }
-  while(!d_freeChunks.empty()) {
-    free(d_freeChunks.back());
-    d_freeChunks.pop_back();
+  for (const Chunk& chunk : d_chunkList)
+  {
+    releaseChunk(chunk);
   }
+  releaseFreeChunks(0);
 }
 
+size_t ContextMemoryManager::getMemoryUsage() const
+{
+  size_t res = d_freeBytes;
+  for (const Chunk& chunk : d_chunkList)
+  {
+    res += getChunkSize(chunk.d_class);
+  }
+  return res;
+}
 
 void* ContextMemoryManager::newData(size_t size) {
   // Use next available free location in current chunk
@@ -139,6 +248,7 @@ void ContextMemoryManager::pop() {
 #endif /* CVC5_VALGRIND */
 
   Assert(d_nextFreeStack.size() > 0 && d_endChunkStack.size() > 0);
+  size_t level = d_nextFreeStack.size();
 
   // Restore state from stack
   d_nextFree = d_nextFreeStack.back();
@@ -148,21 +258,39 @@ void ContextMemoryManager::pop() {
 
   // Free all the new chunks since the last push
   while(d_indexChunkList > d_indexChunkListStack.back()) {
-    d_freeChunks.push_back(d_chunkList.back());
+    const Chunk& chunk = d_chunkList.back();
+    size_t size = getChunkSize(chunk.d_class);
 #ifdef CVC5_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
+    VALGRIND_MAKE_MEM_NOACCESS(chunk.d_data, size);
 #endif /* CVC5_VALGRIND */
+    d_freeChunks[chunk.d_class].push_back(chunk);
+    d_freeBytes += size;
     d_chunkList.pop_back();
     --d_indexChunkList;
   }
   d_indexChunkListStack.pop_back();
 
   // Delete excess free chunks
-  while(d_freeChunks.size() > maxFreeChunks) {
-    free(d_freeChunks.front());
-    d_freeChunks.pop_front();
+  if (d_freeBytes > d_policy.d_maxFreeBytes)
+  {
+    uint64_t n = releaseFreeChunks(d_policy.d_maxFreeBytes);
+    incrementAt(d_stats.d_released, level, n);
   }
 }
+
+void ContextMemoryManager::setPolicy(const ContextMemoryPolicy& policy)
+{
+  d_policy = policy;
+  d_maxClass = 0;
+  while (d_maxClass + 1 < numChunkClasses
+         && getChunkSize(d_maxClass + 1) <= d_policy.d_maxChunkSize)
+  {
+    ++d_maxClass;
+  }
+  // free chunks may have been allocated differently
+  releaseFreeChunks(0);
+}
+
 #else
 
 unsigned ContextMemoryManager::getMaxAllocationSize()
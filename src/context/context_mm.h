@@ -25,10 +25,50 @@
 #endif
 #include <cvc5/cvc5_export.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace cvc5::context {
 
+/**
+ * The policy of a ContextMemoryManager for allocating and retaining chunks.
+ */
+struct CVC5_EXPORT ContextMemoryPolicy
+{
+  /**
+   * The maximal size of a chunk in bytes. Chunks start at
+   * ContextMemoryManager::getMaxAllocationSize() bytes and double in size
+   * with each chunk of a region stack, up to this size.
+   */
+  size_t d_maxChunkSize = 1 << 20;
+  /**
+   * The maximal number of bytes kept in free chunks for reuse. Free chunks
+   * beyond this are released when a region is popped.
+   */
+  size_t d_maxFreeBytes = 16 << 20;
+  /**
+   * Whether to back chunks of at least 2 MB with huge pages, if the
+   * platform supports it (MAP_HUGETLB, or transparent huge pages as a
+   * fallback).
+   */
+  bool d_hugePages = false;
+};
+
+/**
+ * Statistics on the chunks of a ContextMemoryManager, indexed by the
+ * context level at which the chunk was requested (resp. released).
+ */
+struct CVC5_EXPORT ContextMemoryStatistics
+{
+  /** The number of chunks newly allocated */
+  std::vector<uint64_t> d_allocated;
+  /** The number of chunks reused from the free chunks */
+  std::vector<uint64_t> d_reused;
+  /** The number of free chunks released due to the retention policy */
+  std::vector<uint64_t> d_released;
+};
+
 #ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
 
 /**
@@ -40,29 +80,50 @@ namespace cvc5::context {
  * stack, and a new current region is created.  A subsequent call to pop
  * releases the new region and restores the top region from the stack.
  *
+ * The i-th chunk of the region stack has size min(2^i * chunkSizeBytes,
+ * d_maxChunkSize), so that deep region stacks need few chunks. Chunks
+ * released by pop are kept for reuse according to the ContextMemoryPolicy.
  */
 class CVC5_EXPORT ContextMemoryManager
 {
   /**
-   * Memory in regions is allocated in chunks.  This is the chunk size
+   * Memory in regions is allocated in chunks.  This is the size of the
+   * smallest chunk.
    */
   static const unsigned chunkSizeBytes = 16384;
 
   /**
-   * A list of free chunks is maintained.  This is the maximum number of
-   * free chunks.
+   * The number of chunk size classes, i.e., chunks are at most
+   * 2^(numChunkClasses - 1) * chunkSizeBytes bytes large.
    */
-  static const unsigned maxFreeChunks = 100;
+  static const unsigned numChunkClasses = 16;
+
+  /** A chunk of memory */
+  struct Chunk
+  {
+    /** The memory of the chunk */
+    char* d_data;
+    /** The size class of the chunk */
+    uint32_t d_class;
+    /** Whether the chunk was obtained by mmap */
+    bool d_mapped;
+  };
 
   /**
    * List of all chunks that are currently active
    */
-  std::vector<char*> d_chunkList;
+  std::vector<Chunk> d_chunkList;
+
+  /**
+   * Stacks of free chunks per size class (for best cache performance, LIFO
+   * order is used)
+   */
+  std::deque<Chunk> d_freeChunks[numChunkClasses];
 
   /**
-   * Queue of free chunks (for best cache performance, LIFO order is used)
+   * The number of bytes in free chunks
    */
-  std::deque<char*> d_freeChunks;
+  size_t d_freeBytes;
 
   /**
    * Pointer to the beginning of available memory in the current chunk in
@@ -99,6 +160,15 @@ class CVC5_EXPORT ContextMemoryManager
    */
   std::vector<unsigned> d_indexChunkListStack;
 
+  /** The chunk policy */
+  ContextMemoryPolicy d_policy;
+
+  /** The size class of the largest chunks, derived from d_policy */
+  uint32_t d_maxClass;
+
+  /** The chunk statistics */
+  ContextMemoryStatistics d_stats;
+
   /**
    * Private method to grab a new chunk for the current region.  Uses chunk
    * from d_freeChunks if available.  Creates a new one otherwise.  Sets the
@@ -106,6 +176,21 @@ class CVC5_EXPORT ContextMemoryManager
    */
   void newChunk();
 
+  /** Allocate a new chunk of size class c */
+  Chunk allocateChunk(uint32_t c);
+
+  /** Release the memory of chunk */
+  static void releaseChunk(const Chunk& chunk);
+
+  /**
+   * Release free chunks, largest first, until at most maxBytes bytes are
+   * left, and return the number of released chunks.
+   */
+  uint64_t releaseFreeChunks(size_t maxBytes);
+
+  /** Get the size in bytes of a chunk of size class c */
+  static size_t getChunkSize(uint32_t c) { return size_t(chunkSizeBytes) << c; }
+
 #ifdef CVC5_VALGRIND
   /**
    * Vector of allocations for each level. Used for accurately marking
@@ -148,6 +233,21 @@ class CVC5_EXPORT ContextMemoryManager
    */
   void pop();
 
+  /**
+   * Set the chunk policy. This applies to all chunks allocated from now on,
+   * and releases all free chunks.
+   */
+  void setPolicy(const ContextMemoryPolicy& policy);
+
+  /** Get the chunk policy */
+  const ContextMemoryPolicy& getPolicy() const { return d_policy; }
+
+  /** Get the chunk statistics */
+  const ContextMemoryStatistics& getStatistics() const { return d_stats; }
+
+  /** Get the number of bytes in active and free chunks */
+  size_t getMemoryUsage() const;
+
 }; /* class ContextMemoryManager */
 
 #else /* CVC5_DEBUG_CONTEXT_MEMORY_MANAGER */
@@ -195,8 +295,16 @@ class ContextMemoryManager
     d_allocations.pop_back();
   }
 
+  void setPolicy(const ContextMemoryPolicy& policy) { d_policy = policy; }
+  const ContextMemoryPolicy& getPolicy() const { return d_policy; }
+  const ContextMemoryStatistics& getStatistics() const { return d_stats; }
+  /** The memory of the individual allocations is not tracked */
+  size_t getMemoryUsage() const { return 0; }
+
  private:
   std::vector<std::vector<char*>> d_allocations;
+  ContextMemoryPolicy d_policy;
+  ContextMemoryStatistics d_stats;
 }; /* ContextMemoryManager */
 
 #endif /* CVC5_DEBUG_CONTEXT_MEMORY_MANAGER */
@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Clark Barrett, Morgan Deters, Tim King
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Statistics on the save and restore operations of context-dependent objects.
+ */
+
+#include "context/context_stats.h"
+
+#include <cxxabi.h>
+
+#include <cstdlib>
+#include <typeinfo>
+
+#include "context/context.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::context {
+
+namespace {
+
+/** The owner of the innermost OwnerScope of this thread */
+thread_local const char* s_currentOwner = nullptr;
+
+/**
+ * Get the name of the type t without namespaces and template arguments, so
+ * that, e.g., all instances of CDHashMap share their statistics.
+ */
+std::string getTypeName(const std::type_info& t)
+{
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(t.name(), nullptr, nullptr, &status);
+  std::string name = status == 0 ? demangled : t.name();
+  std::free(demangled);
+  name = name.substr(0, name.find('<'));
+  for (const char* ns : {"cvc5::context::", "cvc5::internal::"})
+  {
+    if (name.compare(0, std::char_traits<char>::length(ns), ns) == 0)
+    {
+      name = name.substr(std::char_traits<char>::length(ns));
+    }
+  }
+  return name;
+}
+
+}  // namespace
+
+ContextStatistics::Entry::Entry(internal::StatisticsRegistry& reg,
+                                const std::string& name)
+    : d_saves(reg.registerInt(name + "saves")),
+      d_saveTime(reg.registerTimer(name + "saveTime")),
+      d_restores(reg.registerInt(name + "restores")),
+      d_restoreTime(reg.registerTimer(name + "restoreTime"))
+{
+}
+
+ContextStatistics::ContextStatistics(internal::StatisticsRegistry& reg,
+                                     const std::string& prefix)
+    : d_reg(reg), d_prefix(prefix), d_other(nullptr)
+{
+  d_other = &getEntry(d_prefix + "byOwner::other::");
+}
+
+ContextStatistics::Entry& ContextStatistics::getEntry(const std::string& name)
+{
+  auto it = d_entries.find(name);
+  if (it == d_entries.end())
+  {
+    it = d_entries.emplace(name, Entry(d_reg, name)).first;
+  }
+  return it->second;
+}
+
+void ContextStatistics::registerObject(const ContextObj* obj)
+{
+  if (s_currentOwner != nullptr)
+  {
+    d_owners[obj] =
+        &getEntry(d_prefix + "byOwner::" + s_currentOwner + "::");
+  }
+}
+
+void ContextStatistics::inheritOwner(const ContextObj* obj,
+                                     const ContextObj* parent)
+{
+  auto it = d_owners.find(parent);
+  if (it != d_owners.end())
+  {
+    d_owners[obj] = it->second;
+  }
+}
+
+void ContextStatistics::unregisterObject(const ContextObj* obj)
+{
+  d_owners.erase(obj);
+}
+
+ContextStatistics::Entry& ContextStatistics::getTypeEntry(
+    const ContextObj* obj)
+{
+  std::type_index t(typeid(*obj));
+  auto it = d_types.find(t);
+  if (it == d_types.end())
+  {
+    Entry* e = &getEntry(d_prefix + "byType::" + getTypeName(typeid(*obj))
+                         + "::");
+    it = d_types.emplace(t, e).first;
+  }
+  return *it->second;
+}
+
+ContextStatistics::Entry& ContextStatistics::getOwnerEntry(
+    const ContextObj* obj)
+{
+  auto it = d_owners.find(obj);
+  return it == d_owners.end() ? *d_other : *it->second;
+}
+
+ContextStatistics::OwnerScope::OwnerScope(const char* owner)
+    : d_prev(s_currentOwner)
+{
+  s_currentOwner = owner;
+}
+
+ContextStatistics::OwnerScope::~OwnerScope() { s_currentOwner = d_prev; }
+
+ContextStatistics::Timer::Timer(ContextStatistics& stats,
+                                const ContextObj* obj,
+                                bool isSave)
+    : Timer(stats.getTypeEntry(obj), stats.getOwnerEntry(obj), isSave)
+{
+}
+
+ContextStatistics::Timer::Timer(Entry& type, Entry& owner, bool isSave)
+    : d_typeTimer(isSave ? type.d_saveTime : type.d_restoreTime, true),
+      d_ownerTimer(isSave ? owner.d_saveTime : owner.d_restoreTime, true)
+{
+  if (isSave)
+  {
+    ++type.d_saves;
+    ++owner.d_saves;
+  }
+  else
+  {
+    ++type.d_restores;
+    ++owner.d_restores;
+  }
+}
+
+}  // namespace cvc5::context
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Clark Barrett, Morgan Deters, Tim King
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Statistics on the save and restore operations of context-dependent objects.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__CONTEXT__CONTEXT_STATS_H
+#define CVC5__CONTEXT__CONTEXT_STATS_H
+
+#include <map>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+class StatisticsRegistry;
+}
+
+namespace cvc5::context {
+
+class ContextObj;
+
+/**
+ * Counts and times the calls to ContextObj::save() and ContextObj::restore()
+ * of a context, grouped by the concrete type of the objects and by their
+ * owner. A context only collects these statistics if they are set with
+ * Context::setStatistics().
+ *
+ * The owner of an object is the innermost OwnerScope that is active when the
+ * object is constructed, or "other" if there is none. Owner scopes are
+ * typically put around the construction of a theory, an equality engine or
+ * the CNF stream.
+ */
+class ContextStatistics
+{
+  struct Entry;
+
+ public:
+  /**
+   * Registers the statistics with names starting with prefix in reg. The
+   * statistics of a type (resp. an owner) X are named
+   * prefix + "byType::X::" (resp. prefix + "byOwner::X::") followed by
+   * "saves", "saveTime", "restores" or "restoreTime".
+   */
+  ContextStatistics(internal::StatisticsRegistry& reg,
+                    const std::string& prefix);
+
+  /** Assign the current owner to obj, called when obj is constructed */
+  void registerObject(const ContextObj* obj);
+  /** Assign the owner of parent (if any) to obj */
+  void inheritOwner(const ContextObj* obj, const ContextObj* parent);
+  /** Forget the owner of obj, called when obj is destroyed */
+  void unregisterObject(const ContextObj* obj);
+
+  /**
+   * While an OwnerScope is alive, the context-dependent objects constructed
+   * by the current thread are attributed to its owner. The owner must be a
+   * string with static storage duration.
+   */
+  class OwnerScope
+  {
+   public:
+    OwnerScope(const char* owner);
+    ~OwnerScope();
+
+   private:
+    /** The owner of the enclosing scope */
+    const char* d_prev;
+  };
+
+  /**
+   * Counts and times a call to save() (resp. restore()) on obj for the
+   * lifetime of this object.
+   */
+  class Timer
+  {
+   public:
+    Timer(ContextStatistics& stats, const ContextObj* obj, bool isSave);
+
+   private:
+    Timer(Entry& type, Entry& owner, bool isSave);
+    internal::CodeTimer d_typeTimer;
+    internal::CodeTimer d_ownerTimer;
+  };
+
+ private:
+  /** The statistics of a group of objects */
+  struct Entry
+  {
+    Entry(internal::StatisticsRegistry& reg, const std::string& name);
+    internal::IntStat d_saves;
+    internal::TimerStat d_saveTime;
+    internal::IntStat d_restores;
+    internal::TimerStat d_restoreTime;
+  };
+
+  /** Get the entry of the name, creating it if necessary */
+  Entry& getEntry(const std::string& name);
+  /** Get the entry of the concrete type of obj */
+  Entry& getTypeEntry(const ContextObj* obj);
+  /** Get the entry of the owner of obj */
+  Entry& getOwnerEntry(const ContextObj* obj);
+
+  /** The statistics registry */
+  internal::StatisticsRegistry& d_reg;
+  /** The prefix of the statistic names */
+  std::string d_prefix;
+  /** The entries, by the (full) name of their statistics */
+  std::map<std::string, Entry> d_entries;
+  /** The entries of the types that occurred so far */
+  std::unordered_map<std::type_index, Entry*> d_types;
+  /** The entries of the owners of the registered objects */
+  std::unordered_map<const ContextObj*, Entry*> d_owners;
+  /** The entry of the objects without owner */
+  Entry* d_other;
+};
+
+}  // namespace cvc5::context
+
+#endif /* CVC5__CONTEXT__CONTEXT_STATS_H */
@@ -0,0 +1,338 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Morgan Deters, Tim King, Andres Noetzli
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A non-relocating vector made of segments.
+ *
+ * The elements are stored in a list of segments that are never moved, so
+ * growing the vector never copies elements and references to elements stay
+ * valid until the elements are removed. The first segments double in size up
+ * to a maximum segment size, all further segments have the maximum size.
+ *
+ * This is used as the backing store of CDList and CDQueue if they are
+ * instantiated with a SegmentedAllocator or a ContextMemoryAllocator, see
+ * cdlist.h.
+ */
+
+#include "cvc5parser_public.h"
+
+#ifndef CVC5__CONTEXT__SEGMENTED_VECTOR_H
+#define CVC5__CONTEXT__SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+
+namespace cvc5::context {
+
+/**
+ * An allocator that selects the segmented, heap-allocated backing store for
+ * CDList and CDQueue (see CDListStorage in cdlist.h). It allocates exactly
+ * like std::allocator.
+ */
+template <class T>
+class SegmentedAllocator : public std::allocator<T>
+{
+ public:
+  template <class U>
+  struct rebind
+  {
+    typedef SegmentedAllocator<U> other;
+  };
+  SegmentedAllocator() = default;
+  template <class U>
+  SegmentedAllocator(const SegmentedAllocator<U>&)
+  {
+  }
+};
+
+template <class T, class Allocator = std::allocator<T>>
+class SegmentedVector
+{
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using reference = T&;
+  using const_reference = const T&;
+
+  /** A random access iterator over the elements. */
+  class const_iterator
+  {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator() : d_vec(nullptr), d_index(0) {}
+    const_iterator(const SegmentedVector* vec, size_t index)
+        : d_vec(vec), d_index(index)
+    {
+    }
+
+    reference operator*() const { return (*d_vec)[d_index]; }
+    pointer operator->() const { return &(*d_vec)[d_index]; }
+    reference operator[](difference_type n) const
+    {
+      return (*d_vec)[d_index + n];
+    }
+
+    const_iterator& operator++()
+    {
+      ++d_index;
+      return *this;
+    }
+    const_iterator operator++(int) { return const_iterator(d_vec, d_index++); }
+    const_iterator& operator--()
+    {
+      --d_index;
+      return *this;
+    }
+    const_iterator operator--(int) { return const_iterator(d_vec, d_index--); }
+    const_iterator& operator+=(difference_type n)
+    {
+      d_index += n;
+      return *this;
+    }
+    const_iterator& operator-=(difference_type n)
+    {
+      d_index -= n;
+      return *this;
+    }
+    const_iterator operator+(difference_type n) const
+    {
+      return const_iterator(d_vec, d_index + n);
+    }
+    friend const_iterator operator+(difference_type n, const const_iterator& i)
+    {
+      return i + n;
+    }
+    const_iterator operator-(difference_type n) const
+    {
+      return const_iterator(d_vec, d_index - n);
+    }
+    difference_type operator-(const const_iterator& i) const
+    {
+      return static_cast<difference_type>(d_index)
+             - static_cast<difference_type>(i.d_index);
+    }
+
+    bool operator==(const const_iterator& i) const
+    {
+      return d_index == i.d_index;
+    }
+    bool operator!=(const const_iterator& i) const
+    {
+      return d_index != i.d_index;
+    }
+    bool operator<(const const_iterator& i) const
+    {
+      return d_index < i.d_index;
+    }
+    bool operator>(const const_iterator& i) const
+    {
+      return d_index > i.d_index;
+    }
+    bool operator<=(const const_iterator& i) const
+    {
+      return d_index <= i.d_index;
+    }
+    bool operator>=(const const_iterator& i) const
+    {
+      return d_index >= i.d_index;
+    }
+
+   private:
+    /** The vector */
+    const SegmentedVector* d_vec;
+    /** The index of the element */
+    size_t d_index;
+  };
+  using iterator = const_iterator;
+
+  /**
+   * Constructs an empty vector whose segments are allocated by alloc. The
+   * segments have at most alloc.max_size() elements, and at most
+   * s_maxSegmentBytes bytes unless a single element is larger.
+   */
+  SegmentedVector(const Allocator& alloc = Allocator())
+      : d_alloc(alloc), d_size(0)
+  {
+    Assert(AllocTraits::max_size(d_alloc) > 0)
+        << "elements too large for the allocator of SegmentedVector";
+    size_t maxElems = s_maxSegmentBytes / sizeof(T);
+    if (maxElems > AllocTraits::max_size(d_alloc))
+    {
+      maxElems = AllocTraits::max_size(d_alloc);
+    }
+    if (maxElems == 0)
+    {
+      maxElems = 1;
+    }
+    // the largest power of two that is at most maxElems
+    d_logMax = 63 - __builtin_clzll(static_cast<unsigned long long>(maxElems));
+    d_logFirst = d_logMax < s_logFirstSegment ? d_logMax : s_logFirstSegment;
+    d_geometricSize = (size_t(1) << (d_logMax + 1)) - (size_t(1) << d_logFirst);
+  }
+
+  ~SegmentedVector()
+  {
+    truncate(0);
+    releaseSegments();
+  }
+
+  SegmentedVector(const SegmentedVector&) = delete;
+  SegmentedVector& operator=(const SegmentedVector&) = delete;
+
+  /** Returns the number of elements. */
+  size_t size() const { return d_size; }
+
+  /** Returns true if there are no elements. */
+  bool empty() const { return d_size == 0; }
+
+  /** Returns the number of allocated segments. */
+  size_t numSegments() const { return d_segments.size(); }
+
+  /** Appends a copy of data. */
+  void push_back(const T& data) { emplace_back(data); }
+
+  /** Appends an element constructed in-place from args. */
+  template <typename... Args>
+  void emplace_back(Args&&... args)
+  {
+    size_t segment, offset;
+    locate(d_size, segment, offset);
+    if (segment == d_segments.size())
+    {
+      d_segments.push_back(
+          AllocTraits::allocate(d_alloc, segmentSize(segment)));
+    }
+    ::new (static_cast<void*>(d_segments[segment] + offset))
+        T(std::forward<Args>(args)...);
+    ++d_size;
+  }
+
+  /** Access to the ith element. */
+  reference operator[](size_t i)
+  {
+    size_t segment, offset;
+    locate(i, segment, offset);
+    return d_segments[segment][offset];
+  }
+  const_reference operator[](size_t i) const
+  {
+    size_t segment, offset;
+    locate(i, segment, offset);
+    return d_segments[segment][offset];
+  }
+
+  /** Returns an iterator to the first element. */
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  /** Returns an iterator one past the last element. */
+  const_iterator end() const { return const_iterator(this, d_size); }
+
+  /**
+   * Removes the elements from index size onwards. The segments are kept
+   * for reuse, see releaseSegments().
+   */
+  void truncate(size_t size)
+  {
+    Assert(size <= d_size);
+    while (d_size > size)
+    {
+      --d_size;
+      (*this)[d_size].~T();
+    }
+  }
+
+  /** Same as truncate(first - begin()), last must be end(). */
+  void erase(const_iterator first, const_iterator last)
+  {
+    Assert(last == end()) << "SegmentedVector only supports erasing a suffix";
+    truncate(first - begin());
+  }
+
+  /** Deallocates the segments that contain no element. */
+  void releaseSegments()
+  {
+    size_t needed = 0;
+    if (d_size > 0)
+    {
+      size_t offset;
+      locate(d_size - 1, needed, offset);
+      ++needed;
+    }
+    while (d_segments.size() > needed)
+    {
+      AllocTraits::deallocate(
+          d_alloc, d_segments.back(), segmentSize(d_segments.size() - 1));
+      d_segments.pop_back();
+    }
+  }
+
+ private:
+  /** The default size of the first segment is 2^s_logFirstSegment. */
+  static constexpr uint32_t s_logFirstSegment = 4;
+  /** The default maximum size of a segment in bytes. */
+  static constexpr size_t s_maxSegmentBytes = size_t(1) << 20;
+
+  /** Returns the number of elements of the ith segment. */
+  size_t segmentSize(size_t i) const
+  {
+    return size_t(1) << (i + d_logFirst < d_logMax ? i + d_logFirst : d_logMax);
+  }
+
+  /** Computes the segment and offset of the ith element. */
+  void locate(size_t i, size_t& segment, size_t& offset) const
+  {
+    if (i < d_geometricSize)
+    {
+      // the kth segment starts at 2^(k+logFirst) - 2^logFirst
+      size_t j = i + (size_t(1) << d_logFirst);
+      uint32_t log = 63 - __builtin_clzll(static_cast<unsigned long long>(j));
+      segment = log - d_logFirst;
+      offset = j - (size_t(1) << log);
+    }
+    else
+    {
+      size_t j = i - d_geometricSize;
+      segment = d_logMax - d_logFirst + 1 + (j >> d_logMax);
+      offset = j & ((size_t(1) << d_logMax) - 1);
+    }
+  }
+
+  /** The allocator of the segments */
+  Allocator d_alloc;
+  /** The segments */
+  std::vector<T*> d_segments;
+  /** The number of elements */
+  size_t d_size;
+  /** The logarithm of the size of the first segment */
+  uint32_t d_logFirst;
+  /** The logarithm of the maximum size of a segment */
+  uint32_t d_logMax;
+  /** The number of elements in the segments of increasing size */
+  size_t d_geometricSize;
+}; /* class SegmentedVector<> */
+
+}  // namespace cvc5::context
+
+#endif /* CVC5__CONTEXT__SEGMENTED_VECTOR_H */
@@ -88,7 +88,10 @@ class AssertionList
 
  private:
   /** The list of assertions */
-  context::CDList<Node> d_assertions;
+  context::CDList<Node,
+                  context::DefaultCleanUp<Node>,
+                  context::SegmentedAllocator<Node>>
+      d_assertions;
   /** The index of the next assertion to satify */
   context::CDO<size_t> d_assertionIndex;
   // --------------------------- dynamic assertions
@@ -35,13 +35,14 @@ JustificationStrategy::JustificationStrategy(Env& env,
               .decision.jhRlvOrder),  // assertions are user-context dependent
       d_localAssertions(
           context(), context()),  // local assertions are SAT-context dependent
-      d_jcache(context(), ss, cs),
+      d_jcache(context(), userContext(), ss, cs, statisticsRegistry()),
       d_stack(context()),
       d_lastDecisionLit(context()),
       d_currStatusDec(false),
       d_useRlvOrder(options().decision.jhRlvOrder),
       d_decisionStopOnly(options().decision.decisionMode
                          == options::DecisionMode::STOPONLY),
+      d_useActivityOrder(options().decision.jhActivityOrder),
       d_jhSkMode(options().decision.jhSkolemMode),
       d_jhSkRlvMode(options().decision.jhSkolemRlvMode),
       d_stats(statisticsRegistry())
@@ -241,7 +242,9 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
   // i.e. i == 0 || lastChildVal != SAT_VALUE_UNKNOWN,
   // however this does not hold when backtracking has occurred.
   // if i=0, we shouldn't have a last child value
-  Assert(i > 0 || lastChildVal == SAT_VALUE_UNKNOWN)
+  // This does not hold either when using the activity order, which revisits
+  // the first child index after deciding an atom below.
+  Assert(i > 0 || lastChildVal == SAT_VALUE_UNKNOWN || d_useActivityOrder)
       << "in getNextJustifyNode, value given for non-existent last child";
   // we are trying to make the value of curr equal to currDesiredVal
   SatValue currDesiredVal = currPol ? jc.second : invertValue(jc.second);
@@ -261,6 +264,8 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
       {
         // lookahead to determine if already satisfied
         // we scan only once, when processing the first child
+        TNode best;
+        double bestActivity = 0.0;
         for (const Node& c : curr)
         {
           SatValue v = d_jcache.lookupValue(c);
@@ -272,6 +277,30 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
           }
           // NOTE: if v == SAT_VALUE_UNKNOWN, then we can add this to a watch
           // list and short circuit processing in the children of this node.
+          if (d_useActivityOrder && v == SAT_VALUE_UNKNOWN)
+          {
+            TNode catom = c.getKind() == Kind::NOT ? c[0] : c;
+            if (expr::isTheoryAtom(catom))
+            {
+              double a = d_satSolver->getActivity(
+                  d_cnfStream->getLiteral(catom).getSatVariable());
+              if (best.isNull() || a > bestActivity)
+              {
+                best = c;
+                bestActivity = a;
+              }
+            }
+          }
+        }
+        if (value == SAT_VALUE_UNKNOWN && !best.isNull())
+        {
+          // Decide the most active atom, which forces curr if it is assigned
+          // the desired value. The child index is reverted so that the
+          // children are scanned again once the atom has a value.
+          Trace("jh-debug") << "most active child " << best << std::endl;
+          ++d_stats.d_numActivityDecisions;
+          ji->revertChildIndex();
+          return JustifyNode(best, currDesiredVal);
         }
       }
       desiredVal = currDesiredVal;
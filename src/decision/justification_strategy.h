@@ -225,6 +225,8 @@ class JustificationStrategy : public DecisionEngine
   bool d_useRlvOrder;
   /** using stop only */
   bool d_decisionStopOnly;
+  /** decide the most active atoms of disjunctions first */
+  bool d_useActivityOrder;
   /** skolem mode */
   options::JutificationSkolemMode d_jhSkMode;
   /** skolem relevancy mode */
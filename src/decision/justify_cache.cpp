@@ -16,6 +16,7 @@
 #include "decision/justify_cache.h"
 
 #include "expr/node_algorithm.h"
+#include "util/statistics_registry.h"
 
 using namespace cvc5::internal::kind;
 using namespace cvc5::internal::prop;
@@ -24,23 +25,40 @@ namespace cvc5::internal {
 namespace decision {
 
 JustifyCache::JustifyCache(context::Context* c,
+                           context::Context* uc,
                            prop::CDCLTSatSolver* ss,
-                           prop::CnfStream* cs)
-    : d_justified(c), d_satSolver(ss), d_cnfStream(cs)
+                           prop::CnfStream* cs,
+                           StatisticsRegistry& sr)
+    : d_justified(c),
+      d_fixed(uc),
+      d_satSolver(ss),
+      d_cnfStream(cs),
+      d_numLookups(sr.registerInt("JustifyCache::numLookups")),
+      d_numHits(sr.registerInt("JustifyCache::numHits")),
+      d_numFixedHits(sr.registerInt("JustifyCache::numFixedHits"))
 {
 }
 
 prop::SatValue JustifyCache::lookupValue(TNode n)
 {
+  ++d_numLookups;
   bool pol = n.getKind() != Kind::NOT;
   TNode atom = pol ? n : n[0];
   Assert(atom.getKind() != Kind::NOT);
   // check if we have already determined the value
   // notice that d_justified may contain nodes that are not assigned SAT values,
   // since this class infers when the value of nodes can be determined.
+  auto fit = d_fixed.find(atom);
+  if (fit != d_fixed.end())
+  {
+    ++d_numHits;
+    ++d_numFixedHits;
+    return pol ? fit->second : invertValue(fit->second);
+  }
   auto jit = d_justified.find(atom);
   if (jit != d_justified.end())
   {
+    ++d_numHits;
     return pol ? jit->second : invertValue(jit->second);
   }
   // Notice that looking up values for non-theory atoms may lead to
@@ -58,7 +76,14 @@ prop::SatValue JustifyCache::lookupValue(TNode n)
       // add now.
       // NOTE: if we enable skolems when they are justified, we could call
       // a method notifyJustified(atom) here
-      d_justified.insert(atom, val);
+      if (d_satSolver->isFixed(nsl.getSatVariable()))
+      {
+        d_fixed.insert(atom, val);
+      }
+      else
+      {
+        d_justified.insert(atom, val);
+      }
       return pol ? val : invertValue(val);
     }
   }
@@ -67,12 +92,84 @@ prop::SatValue JustifyCache::lookupValue(TNode n)
 
 bool JustifyCache::hasValue(TNode n) const
 {
-  return d_justified.find(n) != d_justified.end();
+  return d_fixed.find(n) != d_fixed.end()
+         || d_justified.find(n) != d_justified.end();
 }
 
 void JustifyCache::setValue(const Node& n, prop::SatValue value)
 {
-  d_justified.insert(n, value);
+  if (isFixedValue(n, value))
+  {
+    if (d_fixed.find(n) == d_fixed.end())
+    {
+      d_fixed.insert(n, value);
+    }
+  }
+  else
+  {
+    d_justified.insert(n, value);
+  }
+}
+
+prop::SatValue JustifyCache::lookupFixedValue(TNode n) const
+{
+  bool pol = n.getKind() != Kind::NOT;
+  TNode atom = pol ? n : n[0];
+  auto fit = d_fixed.find(atom);
+  if (fit == d_fixed.end())
+  {
+    return SAT_VALUE_UNKNOWN;
+  }
+  return pol ? fit->second : invertValue(fit->second);
+}
+
+bool JustifyCache::isFixedValue(TNode n, prop::SatValue value) const
+{
+  Kind k = n.getKind();
+  if (k == Kind::AND || k == Kind::OR)
+  {
+    // a single child forces the value, or all children determine it
+    SatValue forcing = k == Kind::AND ? SAT_VALUE_FALSE : SAT_VALUE_TRUE;
+    bool forced = value == forcing;
+    for (const Node& c : n)
+    {
+      SatValue v = lookupFixedValue(c);
+      if (forced && v == forcing)
+      {
+        return true;
+      }
+      if (!forced && v == SAT_VALUE_UNKNOWN)
+      {
+        return false;
+      }
+    }
+    return !forced;
+  }
+  else if (k == Kind::IMPLIES)
+  {
+    SatValue v0 = lookupFixedValue(n[0]);
+    SatValue v1 = lookupFixedValue(n[1]);
+    if (value == SAT_VALUE_TRUE)
+    {
+      return v0 == SAT_VALUE_FALSE || v1 == SAT_VALUE_TRUE;
+    }
+    return v0 != SAT_VALUE_UNKNOWN && v1 != SAT_VALUE_UNKNOWN;
+  }
+  else if (k == Kind::ITE)
+  {
+    SatValue vc = lookupFixedValue(n[0]);
+    if (vc != SAT_VALUE_UNKNOWN)
+    {
+      return lookupFixedValue(n[vc == SAT_VALUE_TRUE ? 1 : 2]) == value;
+    }
+    return lookupFixedValue(n[1]) == value && lookupFixedValue(n[2]) == value;
+  }
+  else if (k == Kind::XOR || k == Kind::EQUAL)
+  {
+    return lookupFixedValue(n[0]) != SAT_VALUE_UNKNOWN
+           && lookupFixedValue(n[1]) != SAT_VALUE_UNKNOWN;
+  }
+  return false;
 }
 
 }  // namespace decision
@@ -23,6 +23,7 @@
 #include "prop/cnf_stream.h"
 #include "prop/sat_solver.h"
 #include "prop/sat_solver_types.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace decision {
@@ -30,14 +31,20 @@ namespace decision {
 /**
  * A mapping storing the justification values of nodes which uses the SAT solver
  * and CNF stream to lookup the value of literals.
+ *
+ * Values that only depend on literals that are fixed by the SAT solver are
+ * stored separately in a user-context dependent map, so that they remain
+ * valid on backtracking and need not be justified again.
  */
 class JustifyCache
 {
  public:
   /** Constructor */
   JustifyCache(context::Context* c,
+               context::Context* uc,
                prop::CDCLTSatSolver* ss,
-               prop::CnfStream* cs);
+               prop::CnfStream* cs,
+               StatisticsRegistry& sr);
   /**
    * Returns the value TRUE/FALSE for n, or UNKNOWN otherwise.
    *
@@ -53,6 +60,9 @@ class JustifyCache
    * - n is a theory literal assigned to the given value,
    * - n evaluates to value based on the justification values of its children.
    * The value of n should not be set more than once.
+   *
+   * The value is stored as fixed if it is determined by the fixed values of
+   * the children of n.
    */
   void setValue(const Node& n, prop::SatValue value);
   /**
@@ -61,12 +71,27 @@ class JustifyCache
   bool hasValue(TNode n) const;
 
  private:
+  /** Get the fixed value of n, or UNKNOWN if it has none */
+  prop::SatValue lookupFixedValue(TNode n) const;
+  /** Is value of n (of the given kind) determined by fixed children? */
+  bool isFixedValue(TNode n, prop::SatValue value) const;
   /** Mapping from non-negated nodes to their SAT value */
   context::CDInsertHashMap<Node, prop::SatValue> d_justified;
+  /**
+   * Mapping from non-negated nodes to their SAT value, for values that only
+   * depend on fixed literals.
+   */
+  context::CDInsertHashMap<Node, prop::SatValue> d_fixed;
   /** Pointer to the SAT solver */
   prop::CDCLTSatSolver* d_satSolver;
   /** Pointer to the CNF stream */
   prop::CnfStream* d_cnfStream;
+  /** Number of lookups */
+  IntStat d_numLookups;
+  /** Number of lookups answered by cached values */
+  IntStat d_numHits;
+  /** Number of lookups answered by fixed values */
+  IntStat d_numFixedHits;
 };
 
 }  // namespace decision
@@ -25,7 +25,9 @@ JustifyStatistics::JustifyStatistics(StatisticsRegistry& sr)
       d_numStatusBacktrack(sr.registerInt("JustifyStrategy::StatusBacktrack")),
       d_maxStackSize(sr.registerInt("JustifyStrategy::MaxStackSize")),
       d_maxAssertionsSize(sr.registerInt("JustifyStrategy::MaxAssertionsSize")),
-      d_maxSkolemDefsSize(sr.registerInt("JustifyStrategy::MaxSkolemDefsSize"))
+      d_maxSkolemDefsSize(sr.registerInt("JustifyStrategy::MaxSkolemDefsSize")),
+      d_numActivityDecisions(
+          sr.registerInt("JustifyStrategy::ActivityDecisions"))
 {
 }
 
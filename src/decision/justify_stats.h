@@ -40,6 +40,8 @@ class JustifyStatistics
   IntStat d_maxAssertionsSize;
   /** Maximum skolem definition size we considered */
   IntStat d_maxSkolemDefsSize;
+  /** Number of atoms chosen by activity */
+  IntStat d_numActivityDecisions;
 };
 
 }
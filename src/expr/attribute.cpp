@@ -33,6 +33,19 @@ bool AttributeManager::inGarbageCollection() const {
   return d_inGarbageCollection;
 }
 
+size_t AttributeManager::getMemory(std::vector<uint64_t>& bytes) const
+{
+  Assert(bytes.size() >= static_cast<size_t>(Kind::LAST_KIND));
+  d_bools.addMemoryByKind(bytes);
+  d_ints.addMemoryByKind(bytes);
+  d_tnodes.addMemoryByKind(bytes);
+  d_nodes.addMemoryByKind(bytes);
+  d_types.addMemoryByKind(bytes);
+  d_strings.addMemoryByKind(bytes);
+  return d_denseBools.getMemory() + d_denseInts.getMemory()
+         + d_denseNodes.getMemory() + d_denseTypes.getMemory();
+}
+
 void AttributeManager::debugHook(int debugFlag) {
   /* DO NOT CHECK IN ANY CODE INTO THE DEBUG HOOKS!
    * debugHook() is an empty function for the purpose of debugging
@@ -49,6 +62,10 @@ void AttributeManager::deleteAllAttributes(NodeValue* nv) {
   deleteFromTable(d_nodes, nv);
   deleteFromTable(d_types, nv);
   deleteFromTable(d_strings, nv);
+  d_denseBools.eraseBy(nv);
+  d_denseInts.eraseBy(nv);
+  d_denseNodes.eraseBy(nv);
+  d_denseTypes.eraseBy(nv);
 }
 
 void AttributeManager::deleteAllAttributes() {
@@ -58,6 +75,13 @@ void AttributeManager::deleteAllAttributes() {
   deleteAllFromTable(d_nodes);
   deleteAllFromTable(d_types);
   deleteAllFromTable(d_strings);
+  Assert(!d_inGarbageCollection);
+  d_inGarbageCollection = true;
+  d_denseBools.clear();
+  d_denseInts.clear();
+  d_denseNodes.clear();
+  d_denseTypes.clear();
+  d_inGarbageCollection = false;
 }
 
 void AttributeManager::deleteAttributes(const AttrIdVec& atids) {
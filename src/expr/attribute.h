@@ -123,6 +123,14 @@ public:
   AttrHash<TypeNode> d_types;
   /** Underlying hash table for string-valued attributes */
   AttrHash<std::string> d_strings;
+  /** Underlying dense table for boolean-valued attributes */
+  DenseAttrTable<bool> d_denseBools;
+  /** Underlying dense table for integral-valued attributes */
+  DenseAttrTable<uint64_t> d_denseInts;
+  /** Underlying dense table for node-valued attributes */
+  DenseAttrTable<Node> d_denseNodes;
+  /** Underlying dense table for types attributes */
+  DenseAttrTable<TypeNode> d_denseTypes;
 
   /**
    * Get a particular attribute on a particular node.
@@ -188,6 +196,13 @@ public:
    */
   void deleteAllAttributes();
 
+  /**
+   * Add the approximate number of bytes used by the sparse tables for the
+   * node values of each kind to bytes, which is indexed by kind, and return
+   * the number of bytes used by the dense tables.
+   */
+  size_t getMemory(std::vector<uint64_t>& bytes) const;
+
   /**
    * Returns true if a table is currently being deleted.
    */
@@ -320,6 +335,77 @@ struct getTable<std::string>
   }
 };
 
+/**
+ * The getDenseTable<> template provides (static) access to the
+ * AttributeManager field holding the dense table for a value type. Only the
+ * value types below support dense storage.
+ */
+template <class T, class Enable = void>
+struct getDenseTable;
+
+/** Access the "d_denseBools" member of AttributeManager. */
+template <>
+struct getDenseTable<bool>
+{
+  typedef DenseAttrTable<bool> table_type;
+  static inline table_type& get(AttributeManager& am)
+  {
+    return am.d_denseBools;
+  }
+  static inline const table_type& get(const AttributeManager& am)
+  {
+    return am.d_denseBools;
+  }
+};
+
+/** Access the "d_denseInts" member of AttributeManager. */
+template <class T>
+struct getDenseTable<
+    T,
+    // Use this specialization only for unsigned integers
+    typename std::enable_if<std::is_unsigned<T>::value>::type>
+{
+  typedef DenseAttrTable<uint64_t> table_type;
+  static inline table_type& get(AttributeManager& am)
+  {
+    return am.d_denseInts;
+  }
+  static inline const table_type& get(const AttributeManager& am)
+  {
+    return am.d_denseInts;
+  }
+};
+
+/** Access the "d_denseNodes" member of AttributeManager. */
+template <>
+struct getDenseTable<Node>
+{
+  typedef DenseAttrTable<Node> table_type;
+  static inline table_type& get(AttributeManager& am)
+  {
+    return am.d_denseNodes;
+  }
+  static inline const table_type& get(const AttributeManager& am)
+  {
+    return am.d_denseNodes;
+  }
+};
+
+/** Access the "d_denseTypes" member of AttributeManager. */
+template <>
+struct getDenseTable<TypeNode>
+{
+  typedef DenseAttrTable<TypeNode> table_type;
+  static inline table_type& get(AttributeManager& am)
+  {
+    return am.d_denseTypes;
+  }
+  static inline const table_type& get(const AttributeManager& am)
+  {
+    return am.d_denseTypes;
+  }
+};
+
 }  // namespace attr
 
 // ATTRIBUTE MANAGER IMPLEMENTATIONS ===========================================
@@ -334,6 +420,20 @@ AttributeManager::getAttribute(NodeValue* nv, const AttrKind&) const {
   typedef KindValueToTableValueMapping<value_type> mapping;
   typedef typename getTable<value_type>::table_type table_type;
 
+  if constexpr (AttrKind::is_dense)
+  {
+    const auto& dt = getDenseTable<value_type>::get(*this);
+    if constexpr (std::is_same<value_type, bool>::value)
+    {
+      return dt.get(AttrKind::getId(), nv);
+    }
+    else
+    {
+      const auto* v = dt.find(AttrKind::getId(), nv);
+      return v == nullptr ? value_type() : mapping::convertBack(*v);
+    }
+  }
+
   const table_type& ah = getTable<value_type>::get(*this);
   typename table_type::const_iterator i =
     ah.find(std::make_pair(AttrKind::getId(), nv));
@@ -435,6 +535,12 @@ struct HasAttribute<false, AttrKind> {
 template <class AttrKind>
 bool AttributeManager::hasAttribute(NodeValue* nv,
                                     const AttrKind&) const {
+  if constexpr (AttrKind::is_dense && !AttrKind::has_default_value)
+  {
+    typedef typename AttrKind::value_type value_type;
+    return getDenseTable<value_type>::get(*this).find(AttrKind::getId(), nv)
+           != nullptr;
+  }
   return HasAttribute<AttrKind::has_default_value, AttrKind>::
            hasAttribute(this, nv);
 }
@@ -443,6 +549,27 @@ template <class AttrKind>
 bool AttributeManager::getAttribute(NodeValue* nv,
                                     const AttrKind&,
                                     typename AttrKind::value_type& ret) const {
+  if constexpr (AttrKind::is_dense)
+  {
+    typedef typename AttrKind::value_type value_type;
+    typedef KindValueToTableValueMapping<value_type> mapping;
+    const auto& dt = getDenseTable<value_type>::get(*this);
+    if constexpr (std::is_same<value_type, bool>::value)
+    {
+      ret = dt.get(AttrKind::getId(), nv);
+      return true;
+    }
+    else
+    {
+      const auto* v = dt.find(AttrKind::getId(), nv);
+      if (v == nullptr)
+      {
+        return false;
+      }
+      ret = mapping::convertBack(*v);
+      return true;
+    }
+  }
   return HasAttribute<AttrKind::has_default_value, AttrKind>::
            getAttribute(this, nv, ret);
 }
@@ -456,6 +583,13 @@ AttributeManager::setAttribute(NodeValue* nv,
   typedef KindValueToTableValueMapping<value_type> mapping;
   typedef typename getTable<value_type>::table_type table_type;
 
+  if constexpr (AttrKind::is_dense)
+  {
+    getDenseTable<value_type>::get(*this).set(
+        AttrKind::getId(), nv, mapping::convert(value));
+    return;
+  }
+
   table_type& ah = getTable<value_type>::get(*this);
   ah[std::make_pair(AttrKind::getId(), nv)] = mapping::convert(value);
 }
@@ -479,6 +613,8 @@ inline void AttributeManager::deleteAllFromTable(AttrHash<T>& table) {
 
 template <class AttrKind>
 AttributeUniqueId AttributeManager::getAttributeId(const AttrKind& attr){
+  static_assert(!AttrKind::is_dense,
+                "attributes with dense storage cannot be deleted by id");
   typedef typename AttrKind::value_type value_type;
   AttrTableId tableId = getTable<value_type>::id;
   return AttributeUniqueId(tableId, attr.getId());
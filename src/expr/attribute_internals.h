@@ -26,7 +26,9 @@
 #ifndef CVC5__EXPR__ATTRIBUTE_INTERNALS_H
 #define CVC5__EXPR__ATTRIBUTE_INTERNALS_H
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace cvc5::internal {
 namespace expr {
@@ -528,6 +530,21 @@ class AttrHash
 
   void eraseBy(NodeValue* nv) { d_storage.erase(nv); }
 
+  /**
+   * Add the approximate number of bytes used for the entries of each node
+   * value to bytes, which is indexed by kind. Memory owned by the values
+   * (e.g., the characters of a long string) is not included.
+   */
+  void addMemoryByKind(std::vector<uint64_t>& bytes) const
+  {
+    for (const std::pair<NodeValue* const, IdMap>& l2 : d_storage)
+    {
+      bytes[static_cast<size_t>(l2.first->getKind())] +=
+          sizeof(l2) + 2 * sizeof(void*)
+          + l2.second.size() * sizeof(typename IdMap::value_type);
+    }
+  }
+
  private:
   Storage d_storage;
 };/* class AttrHash<> */
@@ -736,8 +753,214 @@ public:
   size_t size() const {
     return super::size();
   }
+
+  /**
+   * Add the approximate number of bytes used for the entries of each node
+   * value to bytes, which is indexed by kind.
+   */
+  void addMemoryByKind(std::vector<uint64_t>& bytes) const
+  {
+    for (super::const_iterator it = super::begin(), iend = super::end();
+         it != iend;
+         ++it)
+    {
+      bytes[static_cast<size_t>(it->first->getKind())] +=
+          sizeof(*it) + 2 * sizeof(void*);
+    }
+  }
 };/* class AttrHash<bool> */
 
+/**
+ * A "DenseAttrTable<V>" is an alternative to AttrHash<V> for attributes
+ * that are read very frequently. It maps pairs (unique-attribute-id, Node)
+ * to V by indexing directly on the id of the node value. For each
+ * attribute, values are stored in pages of s_pageSize consecutive node ids
+ * that are allocated on first use, together with a bitmask recording which
+ * entries are set. A lookup is thus two array loads instead of two hash
+ * lookups, at the price of memory proportional to the range of node ids
+ * that have the attribute. Attribute kinds opt in to this storage via the
+ * `dense` parameter of expr::Attribute.
+ */
+template <class V>
+class DenseAttrTable
+{
+ public:
+  /** log2 of the number of entries per page */
+  static constexpr uint64_t s_logPageSize = 10;
+  /** the number of entries per page */
+  static constexpr uint64_t s_pageSize = uint64_t(1) << s_logPageSize;
+
+  /**
+   * Returns a pointer to the value of attribute id for nv, or nullptr if it
+   * is not set.
+   */
+  const V* find(uint64_t id, const NodeValue* nv) const
+  {
+    const Page* p = getPage(id, nv->getId());
+    if (p == nullptr)
+    {
+      return nullptr;
+    }
+    uint64_t i = nv->getId() & (s_pageSize - 1);
+    return (p->d_set[i >> 6] & GetBitSet(i & 63)) ? &p->d_values[i] : nullptr;
+  }
+
+  /** Set the value of attribute id for nv to v. */
+  void set(uint64_t id, const NodeValue* nv, const V& v)
+  {
+    Page& p = getOrMkPage(id, nv->getId());
+    uint64_t i = nv->getId() & (s_pageSize - 1);
+    p.d_values[i] = v;
+    p.d_set[i >> 6] |= GetBitSet(i & 63);
+  }
+
+  /** Delete the values of all attributes for nv. */
+  void eraseBy(const NodeValue* nv)
+  {
+    uint64_t i = nv->getId() & (s_pageSize - 1);
+    uint64_t page = nv->getId() >> s_logPageSize;
+    for (std::vector<std::unique_ptr<Page>>& pages : d_pages)
+    {
+      Page* p = page < pages.size() ? pages[page].get() : nullptr;
+      if (p != nullptr && (p->d_set[i >> 6] & GetBitSet(i & 63)))
+      {
+        p->d_set[i >> 6] &= ~GetBitSet(i & 63);
+        p->d_values[i] = V();
+      }
+    }
+  }
+
+  /** Delete all values. */
+  void clear() { d_pages.clear(); }
+
+  /** The number of bytes used by the pages of this table. */
+  size_t getMemory() const
+  {
+    size_t bytes = 0;
+    for (const std::vector<std::unique_ptr<Page>>& pages : d_pages)
+    {
+      bytes += pages.capacity() * sizeof(std::unique_ptr<Page>);
+      for (const std::unique_ptr<Page>& p : pages)
+      {
+        bytes += p == nullptr ? 0 : sizeof(Page);
+      }
+    }
+    return bytes;
+  }
+
+ private:
+  struct Page
+  {
+    V d_values[s_pageSize];
+    uint64_t d_set[s_pageSize / 64] = {};
+  };
+  const Page* getPage(uint64_t id, uint64_t nvId) const
+  {
+    uint64_t page = nvId >> s_logPageSize;
+    if (id >= d_pages.size() || page >= d_pages[id].size())
+    {
+      return nullptr;
+    }
+    return d_pages[id][page].get();
+  }
+  Page& getOrMkPage(uint64_t id, uint64_t nvId)
+  {
+    uint64_t page = nvId >> s_logPageSize;
+    if (id >= d_pages.size())
+    {
+      d_pages.resize(id + 1);
+    }
+    std::vector<std::unique_ptr<Page>>& pages = d_pages[id];
+    if (page >= pages.size())
+    {
+      pages.resize(page + 1);
+    }
+    if (pages[page] == nullptr)
+    {
+      pages[page].reset(new Page);
+    }
+    return *pages[page];
+  }
+  /** The pages, indexed by attribute id and page number */
+  std::vector<std::vector<std::unique_ptr<Page>>> d_pages;
+};/* class DenseAttrTable<> */
+
+/**
+ * In the case of Boolean-valued attributes, a dense table only stores one bit
+ * per node and attribute. Since these attributes have a default value, there
+ * is no need to record whether an entry is set.
+ */
+template <>
+class DenseAttrTable<bool>
+{
+ public:
+  /** Get the value of attribute id for nv. */
+  bool get(uint64_t id, const NodeValue* nv) const
+  {
+    uint64_t word = nv->getId() >> 6;
+    if (id >= d_bits.size() || word >= d_bits[id].size())
+    {
+      return false;
+    }
+    return (d_bits[id][word] & GetBitSet(nv->getId() & 63)) != 0;
+  }
+
+  /** Set the value of attribute id for nv to b. */
+  void set(uint64_t id, const NodeValue* nv, bool b)
+  {
+    uint64_t word = nv->getId() >> 6;
+    if (id >= d_bits.size())
+    {
+      d_bits.resize(id + 1);
+    }
+    std::vector<uint64_t>& bits = d_bits[id];
+    if (word >= bits.size())
+    {
+      if (!b)
+      {
+        return;
+      }
+      // grow geometrically, since node ids are allocated in increasing order
+      bits.resize(std::max(word + 1, 2 * bits.size()), 0);
+    }
+    if (b)
+    {
+      bits[word] |= GetBitSet(nv->getId() & 63);
+    }
+    else
+    {
+      bits[word] &= ~GetBitSet(nv->getId() & 63);
+    }
+  }
+
+  /** Reset all flags of nv. */
+  void eraseBy(const NodeValue* nv)
+  {
+    for (size_t id = 0, nattrs = d_bits.size(); id < nattrs; ++id)
+    {
+      set(id, nv, false);
+    }
+  }
+
+  /** Reset all flags. */
+  void clear() { d_bits.clear(); }
+
+  /** The number of bytes used by the bit vectors of this table. */
+  size_t getMemory() const
+  {
+    size_t bytes = 0;
+    for (const std::vector<uint64_t>& bits : d_bits)
+    {
+      bytes += bits.capacity() * sizeof(uint64_t);
+    }
+    return bytes;
+  }
+
+ private:
+  /** The bit vectors, indexed by attribute id and node id */
+  std::vector<std::vector<uint64_t>> d_bits;
+};/* class DenseAttrTable<bool> */
+
 }  // namespace attr
 
 // ATTRIBUTE IDENTIFIER ASSIGNMENT TEMPLATE ====================================
@@ -779,8 +1002,12 @@ struct LastAttributeId
  * @param T the tag for the attribute kind.
  *
  * @param value_t the underlying value_type for the attribute kind
+ *
+ * @param dense whether the attribute is stored in a DenseAttrTable indexed by
+ * node id instead of a hash table; this is meant for attributes that are read
+ * very frequently and set on a large fraction of the nodes.
  */
-template <class T, class value_t>
+template <class T, class value_t, bool dense = false>
 class Attribute
 {
   /**
@@ -797,6 +1024,9 @@ public:
   /** Get the unique ID associated to this attribute. */
   static inline uint64_t getId() { return s_id; }
 
+  /** Whether this attribute uses dense storage. */
+  static const bool is_dense = dense;
+
   /**
    * This attribute does not have a default value: calling
    * hasAttribute() for a Node that hasn't had this attribute set will
@@ -813,6 +1043,11 @@ public:
   static inline uint64_t registerAttribute() {
     typedef typename attr::KindValueToTableValueMapping<value_t>::
                      table_value_type table_value_type;
+    if (dense)
+    {
+      return attr::LastAttributeId<
+          attr::DenseAttrTable<table_value_type>>::getNextId();
+    }
     return attr::LastAttributeId<table_value_type>::getNextId();
   }
 };/* class Attribute<> */
@@ -820,8 +1055,8 @@ public:
 /**
  * An "attribute type" structure for boolean flags (special).
  */
-template <class T>
-class Attribute<T, bool>
+template <class T, bool dense>
+class Attribute<T, bool, dense>
 {
   /** IDs for bool-valued attributes are actually bit assignments. */
   static const uint64_t s_id;
@@ -834,6 +1069,9 @@ public:
   /** Get the unique ID associated to this attribute. */
   static inline uint64_t getId() { return s_id; }
 
+  /** Whether this attribute uses dense storage. */
+  static const bool is_dense = dense;
+
   /**
    * Such bool-valued attributes ("flags") have a default value: they
    * are false for all nodes on entry.  Calling hasAttribute() for a
@@ -854,6 +1092,11 @@ public:
    * return the id.
    */
   static inline uint64_t registerAttribute() {
+    if (dense)
+    {
+      // dense flags are not packed into a single word
+      return attr::LastAttributeId<attr::DenseAttrTable<bool>>::getNextId();
+    }
     const uint64_t id = attr::LastAttributeId<bool>::getNextId();
     AlwaysAssert(id <= 63) << "Too many boolean node attributes registered "
                               "during initialization !";
@@ -864,14 +1107,14 @@ public:
 // ATTRIBUTE IDENTIFIER ASSIGNMENT =============================================
 
 /** Assign unique IDs to attributes at load time. */
-template <class T, class value_t>
-const uint64_t Attribute<T, value_t>::s_id =
-    Attribute<T, value_t>::registerAttribute();
+template <class T, class value_t, bool dense>
+const uint64_t Attribute<T, value_t, dense>::s_id =
+    Attribute<T, value_t, dense>::registerAttribute();
 
 /** Assign unique IDs to attributes at load time. */
-template <class T>
-const uint64_t Attribute<T, bool>::s_id =
-    Attribute<T, bool>::registerAttribute();
+template <class T, bool dense>
+const uint64_t Attribute<T, bool, dense>::s_id =
+    Attribute<T, bool, dense>::registerAttribute();
 
 }  // namespace expr
 }  // namespace cvc5::internal
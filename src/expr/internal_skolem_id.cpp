@@ -34,6 +34,7 @@ const char* toString(InternalSkolemId id)
     case InternalSkolemId::MBQI_INPUT: return "MBQI_INPUT";
     case InternalSkolemId::ABSTRACT_VALUE: return "ABSTRACT_VALUE";
     case InternalSkolemId::QE_CLOSED_INPUT: return "QE_CLOSED_INPUT";
+    case InternalSkolemId::QE_NESTED_VAR: return "QE_NESTED_VAR";
     case InternalSkolemId::QUANTIFIERS_ATTRIBUTE_INTERNAL:
       return "QUANTIFIERS_ATTRIBUTE_INTERNAL";
     case InternalSkolemId::GET_VALUE_PURIFY: return "GET_VALUE_PURIFY";
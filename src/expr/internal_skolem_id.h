@@ -54,6 +54,8 @@ enum class InternalSkolemId
   ABSTRACT_VALUE,
   /** Input variables for quantifier elimination of closed formulas */
   QE_CLOSED_INPUT,
+  /** Skolemized variables of the parent of a nested quantified formula */
+  QE_NESTED_VAR,
   /** Skolem used for marking a quantified attribute */
   QUANTIFIERS_ATTRIBUTE_INTERNAL,
   /** Skolem used for subsolver in get-value */
@@ -20,6 +20,7 @@
 #include "expr/attribute.h"
 #include "expr/cardinality_constraint.h"
 #include "expr/dtype.h"
+#include "expr/node_visited_set.h"
 
 namespace cvc5::internal {
 namespace expr {
@@ -31,7 +32,7 @@ bool hasSubterm(TNode n, TNode t, bool strict)
     return true;
   }
 
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> toProcess;
 
   toProcess.push_back(n);
@@ -60,13 +61,8 @@ bool hasSubterm(TNode n, TNode t, bool strict)
       {
         return true;
       }
-      if (visited.find(child) != visited.end())
-      {
-        continue;
-      }
-      else
+      if (visited.insert(child))
       {
-        visited.insert(child);
         toProcess.push_back(child);
       }
     }
@@ -132,7 +128,7 @@ bool hasSubtermMulti(TNode n, TNode t)
 
 bool hasSubtermKind(Kind k, Node n)
 {
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> visit;
   TNode cur;
   visit.push_back(n);
@@ -140,9 +136,8 @@ bool hasSubtermKind(Kind k, Node n)
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (visited.insert(cur))
     {
-      visited.insert(cur);
       if (cur.getKind() == k)
       {
         return true;
@@ -221,7 +216,7 @@ void getSubtermsKinds(
       ts[k].clear();
     }
   }
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> visit;
   TNode cur;
   visit.push_back(n);
@@ -231,9 +226,8 @@ void getSubtermsKinds(
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (visited.insert(cur))
     {
-      visited.insert(cur);
       k = cur.getKind();
       itt = ts.find(k);
       if (itt != ts.end())
@@ -264,7 +258,7 @@ bool hasSubterm(TNode n, const std::vector<Node>& t, bool strict)
     return true;
   }
 
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> toProcess;
 
   toProcess.push_back(n);
@@ -293,13 +287,8 @@ bool hasSubterm(TNode n, const std::vector<Node>& t, bool strict)
       {
         return true;
       }
-      if (visited.find(child) != visited.end())
+      if (visited.insert(child))
       {
-        continue;
-      }
-      else
-      {
-        visited.insert(child);
         toProcess.push_back(child);
       }
     }
@@ -315,8 +304,9 @@ struct HasBoundVarComputedTag
 {
 };
 /** Attribute true for expressions with bound variables in them */
-typedef expr::Attribute<HasBoundVarTag, bool> HasBoundVarAttr;
-typedef expr::Attribute<HasBoundVarComputedTag, bool> HasBoundVarComputedAttr;
+typedef expr::Attribute<HasBoundVarTag, bool, true> HasBoundVarAttr;
+typedef expr::Attribute<HasBoundVarComputedTag, bool, true>
+    HasBoundVarComputedAttr;
 
 bool hasBoundVar(TNode n)
 {
@@ -378,7 +368,7 @@ bool checkVariablesInternal(TNode n,
                             bool computeFv = true,
                             bool checkShadow = false)
 {
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> visit;
   TNode cur;
   visit.push_back(n);
@@ -391,10 +381,8 @@ bool checkVariablesInternal(TNode n,
     {
       continue;
     }
-    std::unordered_set<TNode>::iterator itv = visited.find(cur);
-    if (itv == visited.end())
+    if (visited.insert(cur))
     {
-      visited.insert(cur);
       if (cur.getKind() == Kind::BOUND_VARIABLE)
       {
         if (scope.find(cur) == scope.end())
@@ -546,15 +534,19 @@ bool hasFreeVariablesScope(TNode n, std::unordered_set<TNode>& scope)
   return getVariablesInternal(n, fvs, scope, false);
 }
 
-bool getVariables(TNode n, std::unordered_set<Node>& vs)
+namespace {
+
+/** Mark n as visited, return true if it was not visited before. */
+bool markVisited(std::unordered_set<TNode>& visited, TNode n)
 {
-  std::unordered_set<TNode> visited;
-  return getVariables(n, vs, visited);
+  return visited.insert(n).second;
 }
+bool markVisited(NodeVisitedSet& visited, TNode n) { return visited.insert(n); }
 
-bool getVariables(TNode n,
-                  std::unordered_set<Node>& vs,
-                  std::unordered_set<TNode>& visited)
+template <class VisitedSet>
+bool collectVariables(TNode n,
+                      std::unordered_set<Node>& vs,
+                      VisitedSet& visited)
 {
   std::vector<TNode> visit;
   TNode cur;
@@ -563,8 +555,7 @@ bool getVariables(TNode n,
   {
     cur = visit.back();
     visit.pop_back();
-    std::unordered_set<TNode>::iterator itv = visited.find(cur);
-    if (itv == visited.end())
+    if (markVisited(visited, cur))
     {
       if (cur.isVar())
       {
@@ -578,22 +569,16 @@ bool getVariables(TNode n,
         }
         visit.insert(visit.end(), cur.begin(), cur.end());
       }
-      visited.insert(cur);
     }
   } while (!visit.empty());
 
   return !vs.empty();
 }
 
-void getSymbols(TNode n, std::unordered_set<Node>& syms)
-{
-  std::unordered_set<TNode> visited;
-  getSymbols(n, syms, visited);
-}
-
-void getSymbols(TNode n,
-                std::unordered_set<Node>& syms,
-                std::unordered_set<TNode>& visited)
+template <class VisitedSet>
+void collectSymbols(TNode n,
+                    std::unordered_set<Node>& syms,
+                    VisitedSet& visited)
 {
   std::vector<TNode> visit;
   TNode cur;
@@ -602,9 +587,8 @@ void getSymbols(TNode n,
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (markVisited(visited, cur))
     {
-      visited.insert(cur);
       if (cur.isVar() && cur.getKind() != Kind::BOUND_VARIABLE)
       {
         syms.insert(cur);
@@ -618,12 +602,66 @@ void getSymbols(TNode n,
   } while (!visit.empty());
 }
 
+template <class VisitedSet>
+void collectTypes(TNode n,
+                  std::unordered_set<TypeNode>& types,
+                  VisitedSet& visited)
+{
+  std::vector<TNode> visit;
+  TNode cur;
+  visit.push_back(n);
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (markVisited(visited, cur))
+    {
+      types.insert(cur.getType());
+      // special cases where the type is not part of the AST
+      if (cur.getKind() == Kind::CARDINALITY_CONSTRAINT)
+      {
+        types.insert(
+            cur.getOperator().getConst<CardinalityConstraint>().getType());
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+}
+
+}  // namespace
+
+bool getVariables(TNode n, std::unordered_set<Node>& vs)
+{
+  NodeVisitedSet visited(n.getNodeManager());
+  return collectVariables(n, vs, visited);
+}
+
+bool getVariables(TNode n,
+                  std::unordered_set<Node>& vs,
+                  std::unordered_set<TNode>& visited)
+{
+  return collectVariables(n, vs, visited);
+}
+
+void getSymbols(TNode n, std::unordered_set<Node>& syms)
+{
+  NodeVisitedSet visited(n.getNodeManager());
+  collectSymbols(n, syms, visited);
+}
+
+void getSymbols(TNode n,
+                std::unordered_set<Node>& syms,
+                std::unordered_set<TNode>& visited)
+{
+  collectSymbols(n, syms, visited);
+}
+
 void getKindSubterms(TNode n,
                      Kind k,
                      bool topLevel,
                      std::unordered_set<Node>& ts)
 {
-  std::unordered_set<TNode> visited;
+  NodeVisitedSet visited(n.getNodeManager());
   std::vector<TNode> visit;
   TNode cur;
   visit.push_back(n);
@@ -631,9 +669,8 @@ void getKindSubterms(TNode n,
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (visited.insert(cur))
     {
-      visited.insert(cur);
       if (cur.getKind() == k)
       {
         ts.insert(cur);
@@ -695,36 +732,15 @@ void getOperatorsMap(TNode n,
 
 void getTypes(TNode n, std::unordered_set<TypeNode>& types)
 {
-  std::unordered_set<TNode> visited;
-  getTypes(n, types, visited);
+  NodeVisitedSet visited(n.getNodeManager());
+  collectTypes(n, types, visited);
 }
 
 void getTypes(TNode n,
               std::unordered_set<TypeNode>& types,
               std::unordered_set<TNode>& visited)
 {
-  std::unordered_set<TNode>::iterator it;
-  std::vector<TNode> visit;
-  TNode cur;
-  visit.push_back(n);
-  do
-  {
-    cur = visit.back();
-    visit.pop_back();
-    it = visited.find(cur);
-    if (it == visited.end())
-    {
-      visited.insert(cur);
-      types.insert(cur.getType());
-      // special cases where the type is not part of the AST
-      if (cur.getKind() == Kind::CARDINALITY_CONSTRAINT)
-      {
-        types.insert(
-            cur.getOperator().getConst<CardinalityConstraint>().getType());
-      }
-      visit.insert(visit.end(), cur.begin(), cur.end());
-    }
-  } while (!visit.empty());
+  collectTypes(n, types, visited);
 }
 
 void getComponentTypes(TypeNode t, std::unordered_set<TypeNode>& types)
@@ -387,12 +387,7 @@ expr::NodeValue* NodeBuilder::constructNV()
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv =
-        (expr::NodeValue*)std::malloc(sizeof(expr::NodeValue));
-    if (nv == nullptr)
-    {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nvAllocator.allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
@@ -401,6 +396,7 @@ expr::NodeValue* NodeBuilder::constructNV()
     nv->d_nm = d_nm;
     nv->d_rc = 0;
     setUsed();
+    d_nm->notifyCreated(nv, expr::NodeValueAllocator::blockSize(0));
     if (TraceIsOn("gc"))
     {
       Trace("gc") << "creating node value " << nv << " [" << nv->d_id << "]: ";
@@ -471,13 +467,8 @@ expr::NodeValue* NodeBuilder::constructNV()
        * reference count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)std::malloc(
-          sizeof(expr::NodeValue)
-          + (sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren));
-      if (nv == nullptr)
-      {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nvAllocator.allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
       nv->d_id = d_nm->d_nextId++;
@@ -493,6 +484,8 @@ expr::NodeValue* NodeBuilder::constructNV()
 
       // poolNv = nv;
       d_nm->poolInsert(nv);
+      d_nm->notifyCreated(
+          nv, expr::NodeValueAllocator::blockSize(nv->d_nchildren));
       if (TraceIsOn("gc"))
       {
         Trace("gc") << "creating node value " << nv << " [" << nv->d_id
@@ -539,8 +532,25 @@ expr::NodeValue* NodeBuilder::constructNV()
        * it had is placed into the NodeManager's pool and returned in
        * a Node wrapper. */
 
-      crop();
-      expr::NodeValue* nv = d_nv;
+      expr::NodeValue* nv;
+      if (d_nv->d_nchildren <= expr::NodeValueAllocator::s_maxSmallChildren)
+      {
+        // The node value is small enough to be owned by the allocator of
+        // the node manager, so we move it there and release our buffer.
+        nv = d_nm->d_nvAllocator.allocate(d_nv->d_nchildren);
+        nv->d_rc = 0;
+        nv->d_kind = d_nv->d_kind;
+        nv->d_nchildren = d_nv->d_nchildren;
+        std::copy(d_nv->d_children,
+                  d_nv->d_children + d_nv->d_nchildren,
+                  nv->d_children);
+        free(d_nv);
+      }
+      else
+      {
+        crop();
+        nv = d_nv;
+      }
       nv->d_id = d_nm->d_nextId++;
       nv->d_nm = d_nm;
       d_nv = &d_inlineNv;
@@ -549,6 +559,8 @@ expr::NodeValue* NodeBuilder::constructNV()
 
       // poolNv = nv;
       d_nm->poolInsert(nv);
+      d_nm->notifyCreated(
+          nv, expr::NodeValueAllocator::blockSize(nv->d_nchildren));
       Trace("gc") << "creating node value " << nv << " [" << nv->d_id
                   << "]: " << *nv << "\n";
       return nv;
@@ -48,7 +48,8 @@ namespace attr {
 
 typedef Attribute<attr::VarNameTag, std::string> VarNameAttr;
 typedef Attribute<attr::SortArityTag, uint64_t> SortArityAttr;
-typedef expr::Attribute<expr::attr::TypeTag, TypeNode> TypeAttr;
+/** The type of a node, stored densely since it is computed for most nodes */
+typedef expr::Attribute<expr::attr::TypeTag, TypeNode, true> TypeAttr;
 typedef expr::Attribute<expr::attr::TypeCheckedTag, bool> TypeCheckedAttr;
 
 /** Attribute is true for unresolved datatype sorts */
@@ -13,6 +13,7 @@
  * A manager for Nodes.
  */
 #include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <stack>
 #include <utility>
@@ -116,6 +117,15 @@ NodeManager::NodeManager()
 {
   poolInsert(&expr::NodeValue::null());
 
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    size_t nkinds = static_cast<size_t>(Kind::LAST_KIND);
+    d_memStats.d_liveNodes.resize(nkinds, 0);
+    d_memStats.d_liveBytes.resize(nkinds, 0);
+    d_memStats.d_peakNodes.resize(nkinds, 0);
+    d_constPayloadSize.resize(nkinds, 0);
+  }
+
   for (uint32_t i = 0; i < static_cast<uint32_t>(Kind::LAST_KIND); ++i)
   {
     Kind k = Kind(i);
@@ -284,11 +294,16 @@ NodeManager::~NodeManager()
 
   poolRemove(&expr::NodeValue::null());
 
+  Trace("nm-pool") << "pool lookups: " << d_nodeValuePool.getNumLookups()
+                   << ", probes: " << d_nodeValuePool.getNumProbes()
+                   << ", max probe length: "
+                   << d_nodeValuePool.getMaxProbeLength() << std::endl;
+
   if (TraceIsOn("gc:leaks"))
   {
     Trace("gc:leaks") << "still in pool:" << endl;
-    for (NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
-                                       iend = d_nodeValuePool.end();
+    for (expr::NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
+                                             iend = d_nodeValuePool.end();
          i != iend;
          ++i)
     {
@@ -356,7 +371,10 @@ void NodeManager::reclaimZombies()
   // and ensures that d_inReclaimZombies is set back to false.
   ScopedBool r(d_inReclaimZombies);
 
-  // We copy the set away and clear the NodeManager's set of zombies.
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  // We copy the list away and clear the NodeManager's list of zombies.
   // This is because reclaimZombie() decrements the RC of the
   // NodeValue's children, which may (recursively) reclaim them.
   //
@@ -367,32 +385,34 @@ void NodeManager::reclaimZombies()
   // into d_zombies.  This is what we do.  However, if we were to
   // concurrently process d_zombies in the loop below, such addition
   // may be invisible to us (B is leaked) or even invalidate our
-  // iterator, causing a crash.  So we need to copy the set away.
+  // iterator, causing a crash.  So we need to copy the list away.
 
   vector<NodeValue*> zombies;
-  zombies.reserve(d_zombies.size());
-  remove_copy_if(d_zombies.begin(),
-                 d_zombies.end(),
-                 back_inserter(zombies),
-                 NodeValueReferenceCountNonZero());
-  d_zombies.clear();
-
-#ifdef _LIBCPP_VERSION
-  NodeValue* last = NULL;
-#endif
+  zombies.swap(d_zombies);
+  // remove the zombies that were resurrected
+  zombies.erase(remove_if(zombies.begin(),
+                          zombies.end(),
+                          NodeValueReferenceCountNonZero()),
+                zombies.end());
+  // Sort by id (which also makes the deletion order deterministic) and remove
+  // duplicates. If two entries have the same id but different pointers, then
+  // the wrong `NodeManager` was in scope for one of the two nodes when it
+  // reached refcount zero.
+  sort(zombies.begin(), zombies.end(), [](NodeValue* a, NodeValue* b) {
+    return a->d_id < b->d_id;
+  });
+  zombies.erase(unique(zombies.begin(),
+                       zombies.end(),
+                       [](NodeValue* a, NodeValue* b) {
+                         Assert(a->d_id != b->d_id || a == b);
+                         return a == b;
+                       }),
+                zombies.end());
+
   for (vector<NodeValue*>::iterator i = zombies.begin(); i != zombies.end();
        ++i)
   {
     NodeValue* nv = *i;
-#ifdef _LIBCPP_VERSION
-    // Work around an apparent bug in libc++'s hash_set<> which can
-    // (very occasionally) have an element repeated.
-    if (nv == last)
-    {
-      continue;
-    }
-    last = nv;
-#endif
 
     // collect ONLY IF still zero
     if (nv->d_rc == 0)
@@ -433,6 +453,7 @@ void NodeManager::reclaimZombies()
 
       // decr ref counts of children
       nv->decrRefCounts();
+      notifyDeleted(nv);
       if (mk == kind::metakind::CONSTANT)
       {
         // Destroy (call the destructor for) the C++ type representing
@@ -443,12 +464,53 @@ void NodeManager::reclaimZombies()
         // constant, but then, you should probably use a smart-pointer
         // type for a constant payload.)
         kind::metakind::deleteNodeValueConstant(nv);
+        free(nv);
       }
-      free(nv);
+      else
+      {
+        d_nvAllocator.deallocate(nv, nv->d_nchildren);
+      }
+      ++d_gcStats.d_numReclaimed;
     }
   }
+
+  uint64_t pause = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  ++d_gcStats.d_numReclaims;
+  d_gcStats.d_totalPauseUs += pause;
+  d_gcStats.d_maxPauseUs = std::max(d_gcStats.d_maxPauseUs, pause);
 } /* NodeManager::reclaimZombies() */
 
+void NodeManager::notifyDeleted(const expr::NodeValue* nv)
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    uint32_t k = nv->d_kind;
+    size_t bytes = nv->getMetaKind() == kind::metakind::CONSTANT
+                       ? sizeof(expr::NodeValue) + d_constPayloadSize[k]
+                       : expr::NodeValueAllocator::blockSize(nv->d_nchildren);
+    Assert(d_memStats.d_liveNodes[k] > 0 && d_memStats.d_liveBytes[k] >= bytes);
+    --d_memStats.d_liveNodes[k];
+    d_memStats.d_liveBytes[k] -= bytes;
+  }
+}
+
+size_t NodeManager::getMemoryUsage() const
+{
+  size_t res = d_nodeValuePool.getMemoryUsage();
+  for (uint64_t bytes : d_memStats.d_liveBytes)
+  {
+    res += bytes;
+  }
+  return res;
+}
+
+size_t NodeManager::getAttributeMemory(std::vector<uint64_t>& bytes) const
+{
+  return d_attrManager->getMemory(bytes);
+}
+
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots)
 {
@@ -1374,6 +1436,11 @@ NodeClass NodeManager::mkConstInternal(Kind k, const T& val)
   new (&nv->d_children) T(val);
 
   poolInsert(nv);
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    d_constPayloadSize[static_cast<size_t>(k)] = sizeof(T);
+    notifyCreated(nv, sizeof(expr::NodeValue) + sizeof(T));
+  }
   if (TraceIsOn("gc"))
   {
     Trace("gc") << "creating node value " << nv << " [" << nv->d_id << "]: ";
@@ -27,10 +27,14 @@
 #include <vector>
 
 #include "base/check.h"
+#include "base/configuration.h"
 #include "expr/internal_skolem_id.h"
 #include "expr/kind.h"
 #include "expr/node_builder.h"
 #include "expr/node_value.h"
+#include "expr/node_value_allocator.h"
+#include "expr/node_value_pool.h"
+#include "expr/visited_stamps.h"
 #include "util/floatingpoint_size.h"
 
 namespace cvc5 {
@@ -58,17 +62,27 @@ class AttributeUniqueId;
 class AttributeManager;
 }  // namespace attr
 
+class NodeVisitedSet;
+class SnapshotReader;
 class TypeChecker;
 }  // namespace expr
 
 /**
  * The node manager.
+ *
+ * The node manager is not thread-safe. Reference counts of node values are
+ * plain bit-fields that are updated without synchronization, and the
+ * hash-consing pool, the zombie set and the attribute tables are shared by
+ * all nodes of a node manager. Hence nodes of one node manager must not be
+ * created, copied or destroyed by several threads at the same time.
  */
 class NodeManager
 {
   friend class cvc5::Solver;
   friend class cvc5::TermManager;
   friend class expr::NodeValue;
+  friend class expr::NodeVisitedSet;
+  friend class expr::SnapshotReader;
   friend class expr::TypeChecker;
   friend class SkolemManager;
 
@@ -112,6 +126,66 @@ class NodeManager
    */
   static bool hasOperator(Kind k);
 
+  /** Statistics about the reclamation of zombie nodes */
+  struct GcStatistics
+  {
+    /** The number of calls to reclaimZombies() */
+    uint64_t d_numReclaims = 0;
+    /** The number of node values deleted */
+    uint64_t d_numReclaimed = 0;
+    /** The total time spent in reclaimZombies(), in microseconds */
+    uint64_t d_totalPauseUs = 0;
+    /** The longest time spent in one call to reclaimZombies(), in microseconds */
+    uint64_t d_maxPauseUs = 0;
+  };
+  /** Get the garbage collection statistics of this node manager */
+  const GcStatistics& getGcStatistics() const { return d_gcStats; }
+
+  /**
+   * Statistics about the memory used by the node values of this node
+   * manager, indexed by kind. These are only maintained in statistics
+   * builds. The bytes of a node value do not include memory allocated by the
+   * payload of a constant (e.g., the limbs of a large integer).
+   */
+  struct MemoryStatistics
+  {
+    /** The number of live node values */
+    std::vector<uint64_t> d_liveNodes;
+    /** The number of bytes of live node values */
+    std::vector<uint64_t> d_liveBytes;
+    /** The maximal number of live node values so far */
+    std::vector<uint64_t> d_peakNodes;
+  };
+  /** Get the memory statistics of this node manager */
+  const MemoryStatistics& getMemoryStatistics() const { return d_memStats; }
+  /**
+   * Get the number of bytes used by the live node values (only maintained in
+   * statistics builds, see MemoryStatistics) and by the hash-consing pool.
+   */
+  size_t getMemoryUsage() const;
+  /**
+   * Add the approximate number of bytes used by the (sparse) attribute tables
+   * for the node values of each kind to bytes, which is indexed by kind.
+   * Returns the number of bytes used by dense attribute tables, which cannot
+   * be attributed to kinds. This iterates over all attribute tables.
+   */
+  size_t getAttributeMemory(std::vector<uint64_t>& bytes) const;
+
+  /**
+   * Reclaim all pending zombies, if it is safe to do so. This is meant to be
+   * called at boundaries of the solving process (e.g. user-level push and
+   * pop), where many nodes have typically just become unreachable, so that
+   * garbage collection pauses happen at predictable points instead of in the
+   * middle of a check.
+   */
+  void reclaimZombiesAtBoundary()
+  {
+    if (!d_zombies.empty() && safeToReclaimZombies())
+    {
+      reclaimZombies();
+    }
+  }
+
   /** Get this node manager's skolem manager */
   SkolemManager* getSkolemManager() { return d_skManager.get(); }
   /** Get this node manager's bound variable manager */
@@ -811,10 +885,6 @@ class NodeManager
       const std::vector<DType>& datatypes,
       const std::set<TypeNode>& unresolvedTypes);
 
-  typedef std::unordered_set<expr::NodeValue*,
-                             expr::NodeValuePoolHashFunction,
-                             expr::NodeValuePoolEq>
-      NodeValuePool;
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValueIDHashFunction,
                              expr::NodeValueIDEquality>
@@ -941,20 +1011,13 @@ class NodeManager
                   << std::endl;
     }
 
-    // `d_zombies` uses the node id to hash and compare nodes. If `d_zombies`
-    // already contains a node value with the same id as `nv`, but the pointers
-    // are different, then the wrong `NodeManager` was in scope for one of the
-    // two nodes when it reached refcount zero.
-    Assert(d_zombies.find(nv) == d_zombies.end() || *d_zombies.find(nv) == nv);
+    // A node value may be added more than once if it was resurrected and
+    // zombified again; duplicates are removed in reclaimZombies().
+    d_zombies.push_back(nv);
 
-    d_zombies.insert(nv);
-
-    if (safeToReclaimZombies())
+    if (d_zombies.size() > s_zombieThreshold && safeToReclaimZombies())
     {
-      if (d_zombies.size() > 5000)
-      {
-        reclaimZombies();
-      }
+      reclaimZombies();
     }
   }
 
@@ -1008,16 +1071,26 @@ class NodeManager
   /** Make a new sort with the given name and arity. */
   TypeNode mkSortConstructorInternal(const std::string& name, size_t arity);
 
+  /**
+   * The allocator for non-constant node values. This is declared before the
+   * members that hold nodes, so that it is destroyed after them.
+   */
+  expr::NodeValueAllocator d_nvAllocator;
+
   /** The skolem manager */
   std::unique_ptr<SkolemManager> d_skManager;
   /** The bound variable manager */
   std::unique_ptr<BoundVarManager> d_bvManager;
 
-  NodeValuePool d_nodeValuePool;
+  /** The hash-consing pool */
+  expr::NodeValuePool d_nodeValuePool;
 
   /** The next node identifier */
   size_t d_nextId;
 
+  /** The stamp arrays used by expr::NodeVisitedSet */
+  expr::VisitedStampsPool d_visitedPool;
+
   expr::attr::AttributeManager* d_attrManager;
 
   /**
@@ -1039,11 +1112,42 @@ class NodeManager
   bool d_inReclaimZombies;
 
   /**
-   * The set of zombie nodes.  We may want to revisit this design, as
-   * we might like to delete nodes in least-recently-used order.  But
-   * we also need to avoid processing a zombie twice.
+   * The number of pending zombies above which markForDeletion() reclaims
+   * them. This bounds the memory held by zombies between the boundaries at
+   * which reclaimZombiesAtBoundary() is called.
+   */
+  static constexpr size_t s_zombieThreshold = 50000;
+
+  /**
+   * The list of zombie nodes. It may contain duplicates, which are removed
+   * in batch when the zombies are reclaimed; this avoids hashing on every
+   * call to markForDeletion().
    */
-  NodeValueIDSet d_zombies;
+  std::vector<expr::NodeValue*> d_zombies;
+
+  /** Garbage collection statistics */
+  GcStatistics d_gcStats;
+
+  /** Memory statistics */
+  MemoryStatistics d_memStats;
+  /** The payload size of constants, indexed by kind */
+  std::vector<uint32_t> d_constPayloadSize;
+  /** Record that nv, which occupies the given number of bytes, was created */
+  void notifyCreated(const expr::NodeValue* nv, size_t bytes)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      uint32_t k = nv->d_kind;
+      d_memStats.d_liveBytes[k] += bytes;
+      uint64_t live = ++d_memStats.d_liveNodes[k];
+      if (live > d_memStats.d_peakNodes[k])
+      {
+        d_memStats.d_peakNodes[k] = live;
+      }
+    }
+  }
+  /** Record that nv is about to be deleted */
+  void notifyDeleted(const expr::NodeValue* nv);
 
   /**
    * NodeValues with maxed out reference counts. These live as long as the
@@ -1101,24 +1205,14 @@ inline TypeNode NodeManager::mkSetType(TypeNode elementType)
 }
 
 inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
-  NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
-  if(find == d_nodeValuePool.end()) {
-    return NULL;
-  } else {
-    return *find;
-  }
+  return d_nodeValuePool.find(nv);
 }
 
 inline void NodeManager::poolInsert(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end())
-      << "NodeValue already in the pool!";
   d_nodeValuePool.insert(nv);
 }
 
 inline void NodeManager::poolRemove(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end())
-      << "NodeValue is not in the pool!";
-
   d_nodeValuePool.erase(nv);
 }
 
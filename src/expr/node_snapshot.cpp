@@ -0,0 +1,773 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A binary snapshot format for node DAGs.
+ */
+
+#include "expr/node_snapshot.h"
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* ! __WIN32__ */
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+#include "base/exception.h"
+#include "expr/node_builder.h"
+#include "expr/node_manager.h"
+#include "util/bitvector.h"
+#include "util/floatingpoint_size.h"
+#include "util/rational.h"
+#include "util/string.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+namespace {
+
+/** The magic string at the beginning of each snapshot */
+constexpr char s_magic[] = "CVC5SNAP";
+constexpr size_t s_magicSize = sizeof(s_magic) - 1;
+/** The version of the snapshot format */
+constexpr uint64_t s_version = 1;
+
+/** Tags of the encoding of an integer */
+constexpr uint8_t s_intSmall = 0;
+constexpr uint8_t s_intLarge = 1;
+
+/**
+ * The writer of snapshots. Records are emitted in post-order, i.e., each
+ * node or type is emitted after its children, its operator and its type (for
+ * variables). The traversal is iterative since snapshots are meant for very
+ * large DAGs.
+ */
+class SnapshotWriter
+{
+ public:
+  SnapshotWriter() : d_numRecords(0) {}
+
+  /** Write the snapshot of the DAG of roots to out. */
+  void write(std::ostream& out, const std::vector<Node>& roots)
+  {
+    std::vector<uint64_t> rootIds;
+    for (const Node& r : roots)
+    {
+      visit(Item(r));
+      rootIds.push_back(d_index[r.getId()]);
+    }
+    std::string header(s_magic, s_magicSize);
+    writeVarint(header, s_version);
+    writeVarint(header, d_numRecords);
+    out.write(header.data(), header.size());
+    out.write(d_buf.data(), d_buf.size());
+    std::string footer;
+    writeVarint(footer, rootIds.size());
+    for (uint64_t id : rootIds)
+    {
+      writeVarint(footer, id);
+    }
+    out.write(footer.data(), footer.size());
+    if (!out)
+    {
+      throw Exception("error writing snapshot");
+    }
+  }
+
+ private:
+  /** A node or a type to be emitted */
+  struct Item
+  {
+    explicit Item(TNode n) : d_node(n), d_expanded(false) {}
+    explicit Item(TypeNode t) : d_type(t), d_expanded(false) {}
+    bool isType() const { return !d_type.isNull(); }
+    uint64_t getId() const { return isType() ? d_type.getId() : d_node.getId(); }
+    Node d_node;
+    TypeNode d_type;
+    /** Whether the dependencies of this item have been pushed */
+    bool d_expanded;
+  };
+
+  static void writeVarint(std::string& buf, uint64_t v)
+  {
+    while (v >= 0x80)
+    {
+      buf.push_back(static_cast<char>((v & 0x7f) | 0x80));
+      v >>= 7;
+    }
+    buf.push_back(static_cast<char>(v));
+  }
+  void writeVarint(uint64_t v) { writeVarint(d_buf, v); }
+  void writeString(const std::string& s)
+  {
+    writeVarint(s.size());
+    d_buf.append(s);
+  }
+  void writeInteger(const Integer& i)
+  {
+    if (i.length() <= 62)
+    {
+      int64_t v = i.getSigned64();
+      d_buf.push_back(static_cast<char>(s_intSmall));
+      // zigzag encoding
+      writeVarint((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+    }
+    else
+    {
+      d_buf.push_back(static_cast<char>(s_intLarge));
+      writeString(i.toString(16));
+    }
+  }
+  /** Write a reference to the record of the node or type with the given id */
+  void writeRef(uint64_t id)
+  {
+    auto it = d_index.find(id);
+    Assert(it != d_index.end());
+    writeVarint(d_numRecords - it->second);
+  }
+
+  /** Emit the records of item and all of its dependencies. */
+  void visit(const Item& root)
+  {
+    std::vector<Item> stack;
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+      if (d_index.find(stack.back().getId()) != d_index.end())
+      {
+        stack.pop_back();
+        continue;
+      }
+      if (stack.back().d_expanded)
+      {
+        emit(stack.back());
+        stack.pop_back();
+        continue;
+      }
+      stack.back().d_expanded = true;
+      Item cur = stack.back();
+      if (cur.isType())
+      {
+        for (const TypeNode& tc : cur.d_type)
+        {
+          stack.emplace_back(tc);
+        }
+        continue;
+      }
+      kind::MetaKind mk = cur.d_node.getMetaKind();
+      if (mk == kind::metakind::VARIABLE
+          || mk == kind::metakind::NULLARY_OPERATOR)
+      {
+        stack.emplace_back(cur.d_node.getType());
+      }
+      else if (mk == kind::metakind::PARAMETERIZED)
+      {
+        stack.emplace_back(cur.d_node.getOperator());
+      }
+      for (const Node& nc : cur.d_node)
+      {
+        stack.emplace_back(nc);
+      }
+    }
+  }
+
+  /** Emit the record of item, whose dependencies have been emitted. */
+  void emit(const Item& item)
+  {
+    Kind k = item.isType() ? item.d_type.getKind() : item.d_node.getKind();
+    writeVarint((static_cast<uint64_t>(k) << 1) | (item.isType() ? 1 : 0));
+    if (item.isType())
+    {
+      emitType(item.d_type);
+    }
+    else
+    {
+      emitTerm(item.d_node);
+    }
+    d_index[item.getId()] = d_numRecords++;
+  }
+
+  void emitTerm(const Node& n)
+  {
+    Kind k = n.getKind();
+    switch (n.getMetaKind())
+    {
+      case kind::metakind::CONSTANT: emitConstant(n); return;
+      case kind::metakind::VARIABLE:
+        if (k != Kind::VARIABLE && k != Kind::BOUND_VARIABLE)
+        {
+          unsupported(n);
+        }
+        d_buf.push_back(n.hasName() ? 1 : 0);
+        if (n.hasName())
+        {
+          writeString(n.getName());
+        }
+        writeRef(n.getType().getId());
+        return;
+      case kind::metakind::NULLARY_OPERATOR:
+        writeRef(n.getType().getId());
+        return;
+      case kind::metakind::PARAMETERIZED:
+        writeRef(n.getOperator().getId());
+        break;
+      case kind::metakind::OPERATOR: break;
+      default: unsupported(n);
+    }
+    writeVarint(n.getNumChildren());
+    for (const Node& nc : n)
+    {
+      writeRef(nc.getId());
+    }
+  }
+
+  void emitConstant(const Node& n)
+  {
+    switch (n.getKind())
+    {
+      case Kind::CONST_BOOLEAN:
+        d_buf.push_back(n.getConst<bool>() ? 1 : 0);
+        break;
+      case Kind::CONST_RATIONAL:
+      case Kind::CONST_INTEGER:
+      {
+        const Rational& r = n.getConst<Rational>();
+        writeInteger(r.getNumerator());
+        writeInteger(r.getDenominator());
+        break;
+      }
+      case Kind::CONST_BITVECTOR:
+      {
+        const BitVector& bv = n.getConst<BitVector>();
+        writeVarint(bv.getSize());
+        writeInteger(bv.getValue());
+        break;
+      }
+      case Kind::CONST_STRING:
+      {
+        const std::vector<unsigned>& vec = n.getConst<String>().getVec();
+        writeVarint(vec.size());
+        for (unsigned c : vec)
+        {
+          writeVarint(c);
+        }
+        break;
+      }
+      case Kind::BITVECTOR_EXTRACT_OP:
+      {
+        const BitVectorExtract& e = n.getConst<BitVectorExtract>();
+        writeVarint(e.d_high);
+        writeVarint(e.d_low);
+        break;
+      }
+      case Kind::BITVECTOR_REPEAT_OP:
+        writeVarint(n.getConst<BitVectorRepeat>());
+        break;
+      case Kind::BITVECTOR_ZERO_EXTEND_OP:
+        writeVarint(n.getConst<BitVectorZeroExtend>());
+        break;
+      case Kind::BITVECTOR_SIGN_EXTEND_OP:
+        writeVarint(n.getConst<BitVectorSignExtend>());
+        break;
+      case Kind::BITVECTOR_ROTATE_LEFT_OP:
+        writeVarint(n.getConst<BitVectorRotateLeft>());
+        break;
+      case Kind::BITVECTOR_ROTATE_RIGHT_OP:
+        writeVarint(n.getConst<BitVectorRotateRight>());
+        break;
+      case Kind::INT_TO_BITVECTOR_OP:
+        writeVarint(n.getConst<IntToBitVector>());
+        break;
+      default: unsupported(n);
+    }
+  }
+
+  void emitType(const TypeNode& t)
+  {
+    switch (t.getKind())
+    {
+      case Kind::TYPE_CONSTANT:
+        writeVarint(t.getConst<TypeConstant>());
+        return;
+      case Kind::BITVECTOR_TYPE:
+        writeVarint(t.getConst<BitVectorSize>());
+        return;
+      case Kind::FLOATINGPOINT_TYPE:
+      {
+        const FloatingPointSize& fs = t.getConst<FloatingPointSize>();
+        writeVarint(fs.exponentWidth());
+        writeVarint(fs.significandWidth());
+        return;
+      }
+      case Kind::SORT_TYPE:
+        if (!t.isUninterpretedSort())
+        {
+          unsupported(t);
+        }
+        writeString(t.hasName() ? t.getName() : std::string());
+        return;
+      case Kind::FUNCTION_TYPE:
+      case Kind::ARRAY_TYPE:
+      case Kind::SET_TYPE:
+      case Kind::SEQUENCE_TYPE: break;
+      default: unsupported(t);
+    }
+    writeVarint(t.getNumChildren());
+    for (const TypeNode& tc : t)
+    {
+      writeRef(tc.getId());
+    }
+  }
+
+  template <class T>
+  [[noreturn]] static void unsupported(const T& n)
+  {
+    std::stringstream ss;
+    ss << "cannot write " << n.getKind() << " to a snapshot: " << n;
+    throw Exception(ss.str());
+  }
+
+  /** The encoded records */
+  std::string d_buf;
+  /** The number of records emitted so far */
+  uint64_t d_numRecords;
+  /** Map from node ids to the index of their records */
+  std::unordered_map<uint64_t, uint64_t> d_index;
+};
+
+/**
+ * A read-only view of the contents of a file, which is mapped into memory if
+ * possible.
+ */
+class MappedFile
+{
+ public:
+  MappedFile(const std::string& filename)
+      : d_data(nullptr), d_size(0), d_mapped(false)
+  {
+#ifndef __WIN32__
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0)
+      {
+        void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+          d_data = static_cast<const char*>(p);
+          d_size = st.st_size;
+          d_mapped = true;
+        }
+      }
+      close(fd);
+      if (d_mapped)
+      {
+        return;
+      }
+    }
+#endif /* ! __WIN32__ */
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+    {
+      throw Exception("cannot open snapshot file " + filename);
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    d_contents = ss.str();
+    d_data = d_contents.data();
+    d_size = d_contents.size();
+  }
+  ~MappedFile()
+  {
+#ifndef __WIN32__
+    if (d_mapped)
+    {
+      munmap(const_cast<char*>(d_data), d_size);
+    }
+#endif /* ! __WIN32__ */
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return d_data; }
+  size_t size() const { return d_size; }
+
+ private:
+  const char* d_data;
+  size_t d_size;
+  /** Whether d_data is mapped, otherwise it points into d_contents */
+  bool d_mapped;
+  std::string d_contents;
+};
+
+}  // namespace
+
+void saveSnapshot(std::ostream& out, const std::vector<Node>& roots)
+{
+  SnapshotWriter w;
+  w.write(out, roots);
+}
+
+std::vector<Node> loadSnapshot(NodeManager* nm, const std::string& filename)
+{
+  MappedFile f(filename);
+  SnapshotReader r(nm, f.data(), f.size());
+  return r.read();
+}
+
+SnapshotReader::SnapshotReader(NodeManager* nm, const char* data, size_t size)
+    : d_nm(nm), d_cur(data), d_end(data + size)
+{
+}
+
+std::vector<Node> SnapshotReader::read()
+{
+  if (static_cast<size_t>(d_end - d_cur) < s_magicSize
+      || std::memcmp(d_cur, s_magic, s_magicSize) != 0)
+  {
+    fail("not a snapshot");
+  }
+  d_cur += s_magicSize;
+  if (readVarint() != s_version)
+  {
+    fail("unsupported snapshot version");
+  }
+  uint64_t numRecords = readVarint();
+  // every record takes at least two bytes
+  if (numRecords > static_cast<uint64_t>(d_end - d_cur))
+  {
+    fail("invalid number of records");
+  }
+  d_terms.reserve(numRecords);
+  d_types.reserve(numRecords);
+  // avoid rehashing the pool while the records are hash-consed
+  d_nm->d_nodeValuePool.reserve(d_nm->d_nodeValuePool.size() + numRecords);
+  for (uint64_t i = 0; i < numRecords; ++i)
+  {
+    uint64_t tag = readVarint();
+    uint64_t kv = tag >> 1;
+    if (kv <= static_cast<uint64_t>(Kind::NULL_EXPR)
+        || kv >= static_cast<uint64_t>(Kind::LAST_KIND))
+    {
+      fail("invalid kind");
+    }
+    Kind k = static_cast<Kind>(kv);
+    if (tag & 1)
+    {
+      d_types.push_back(readType(k));
+      d_terms.emplace_back();
+    }
+    else
+    {
+      d_terms.push_back(readTerm(k));
+      d_types.emplace_back();
+    }
+  }
+  uint64_t numRoots = readVarint();
+  if (numRoots > static_cast<uint64_t>(d_end - d_cur))
+  {
+    fail("invalid number of roots");
+  }
+  std::vector<Node> roots;
+  for (uint64_t i = 0; i < numRoots; ++i)
+  {
+    uint64_t index = readVarint();
+    if (index >= d_terms.size() || d_terms[index].isNull())
+    {
+      fail("invalid root");
+    }
+    roots.push_back(d_terms[index]);
+  }
+  if (d_cur != d_end)
+  {
+    fail("trailing data");
+  }
+  return roots;
+}
+
+uint8_t SnapshotReader::readByte()
+{
+  if (d_cur == d_end)
+  {
+    fail("unexpected end of data");
+  }
+  return static_cast<uint8_t>(*d_cur++);
+}
+
+uint64_t SnapshotReader::readVarint()
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; shift < 64; shift += 7)
+  {
+    uint8_t b = readByte();
+    v |= static_cast<uint64_t>(b & 0x7f) << shift;
+    if ((b & 0x80) == 0)
+    {
+      return v;
+    }
+  }
+  fail("invalid varint");
+}
+
+uint32_t SnapshotReader::readVarint32()
+{
+  uint64_t v = readVarint();
+  if (v > std::numeric_limits<uint32_t>::max())
+  {
+    fail("value out of range");
+  }
+  return static_cast<uint32_t>(v);
+}
+
+std::string SnapshotReader::readString()
+{
+  uint64_t size = readVarint();
+  if (size > static_cast<uint64_t>(d_end - d_cur))
+  {
+    fail("unexpected end of data");
+  }
+  std::string s(d_cur, size);
+  d_cur += size;
+  return s;
+}
+
+Integer SnapshotReader::readInteger()
+{
+  uint8_t tag = readByte();
+  if (tag == s_intSmall)
+  {
+    uint64_t z = readVarint();
+    return Integer(static_cast<int64_t>(z >> 1) ^ -static_cast<int64_t>(z & 1));
+  }
+  if (tag != s_intLarge)
+  {
+    fail("invalid integer");
+  }
+  std::string s = readString();
+  try
+  {
+    return Integer(s, 16);
+  }
+  catch (const std::invalid_argument&)
+  {
+    fail("invalid integer");
+  }
+}
+
+uint64_t SnapshotReader::readRef()
+{
+  uint64_t dist = readVarint();
+  uint64_t cur = d_terms.size();
+  if (dist == 0 || dist > cur)
+  {
+    fail("invalid reference");
+  }
+  return cur - dist;
+}
+
+const Node& SnapshotReader::readTermRef()
+{
+  const Node& n = d_terms[readRef()];
+  if (n.isNull())
+  {
+    fail("expected a reference to a term");
+  }
+  return n;
+}
+
+const TypeNode& SnapshotReader::readTypeRef()
+{
+  const TypeNode& t = d_types[readRef()];
+  if (t.isNull())
+  {
+    fail("expected a reference to a type");
+  }
+  return t;
+}
+
+Node SnapshotReader::readTerm(Kind k)
+{
+  switch (k)
+  {
+    case Kind::CONST_BOOLEAN: return d_nm->mkConst(readByte() != 0);
+    case Kind::CONST_RATIONAL:
+    case Kind::CONST_INTEGER:
+    {
+      Integer num = readInteger();
+      Integer den = readInteger();
+      if (den.sgn() <= 0 || num.gcd(den) != 1
+          || (k == Kind::CONST_INTEGER && den != 1))
+      {
+        fail("invalid rational");
+      }
+      return d_nm->mkConst(k, Rational(num, den));
+    }
+    case Kind::CONST_BITVECTOR:
+    {
+      uint32_t size = readVarint32();
+      Integer val = readInteger();
+      if (size == 0 || val.sgn() < 0 || val.length() > size)
+      {
+        fail("invalid bit-vector");
+      }
+      return d_nm->mkConst(BitVector(size, val));
+    }
+    case Kind::CONST_STRING:
+    {
+      uint64_t size = readVarint();
+      if (size > static_cast<uint64_t>(d_end - d_cur))
+      {
+        fail("unexpected end of data");
+      }
+      std::vector<unsigned> vec;
+      vec.reserve(size);
+      for (uint64_t i = 0; i < size; ++i)
+      {
+        uint32_t c = readVarint32();
+        if (c >= String::num_codes())
+        {
+          fail("invalid string");
+        }
+        vec.push_back(c);
+      }
+      return d_nm->mkConst(String(vec));
+    }
+    case Kind::BITVECTOR_EXTRACT_OP:
+    {
+      uint32_t high = readVarint32();
+      uint32_t low = readVarint32();
+      return d_nm->mkConst(BitVectorExtract(high, low));
+    }
+    case Kind::BITVECTOR_REPEAT_OP:
+      return d_nm->mkConst(BitVectorRepeat(readVarint32()));
+    case Kind::BITVECTOR_ZERO_EXTEND_OP:
+      return d_nm->mkConst(BitVectorZeroExtend(readVarint32()));
+    case Kind::BITVECTOR_SIGN_EXTEND_OP:
+      return d_nm->mkConst(BitVectorSignExtend(readVarint32()));
+    case Kind::BITVECTOR_ROTATE_LEFT_OP:
+      return d_nm->mkConst(BitVectorRotateLeft(readVarint32()));
+    case Kind::BITVECTOR_ROTATE_RIGHT_OP:
+      return d_nm->mkConst(BitVectorRotateRight(readVarint32()));
+    case Kind::INT_TO_BITVECTOR_OP:
+      return d_nm->mkConst(IntToBitVector(readVarint32()));
+    case Kind::VARIABLE:
+    case Kind::BOUND_VARIABLE:
+    {
+      bool hasName = readByte() != 0;
+      std::string name = hasName ? readString() : std::string();
+      const TypeNode& type = readTypeRef();
+      if (k == Kind::BOUND_VARIABLE)
+      {
+        return hasName ? NodeManager::mkBoundVar(name, type)
+                       : NodeManager::mkBoundVar(type);
+      }
+      return hasName ? d_nm->mkVar(name, type) : NodeManager::mkVar(type);
+    }
+    default: break;
+  }
+  kind::MetaKind mk = kind::metaKindOf(k);
+  if (mk == kind::metakind::NULLARY_OPERATOR)
+  {
+    return d_nm->mkNullaryOperator(readTypeRef(), k);
+  }
+  if (mk != kind::metakind::OPERATOR && mk != kind::metakind::PARAMETERIZED)
+  {
+    fail("unsupported kind");
+  }
+  NodeBuilder nb(d_nm, k);
+  if (mk == kind::metakind::PARAMETERIZED)
+  {
+    nb << readTermRef();
+  }
+  uint64_t nchildren = readVarint();
+  if (nchildren < kind::metakind::getMinArityForKind(k)
+      || nchildren > kind::metakind::getMaxArityForKind(k))
+  {
+    fail("invalid number of children");
+  }
+  for (uint64_t i = 0; i < nchildren; ++i)
+  {
+    nb << readTermRef();
+  }
+  return nb.constructNode();
+}
+
+TypeNode SnapshotReader::readType(Kind k)
+{
+  switch (k)
+  {
+    case Kind::TYPE_CONSTANT:
+    {
+      uint32_t tc = readVarint32();
+      if (tc >= LAST_TYPE)
+      {
+        fail("invalid type constant");
+      }
+      return d_nm->mkTypeConst(static_cast<TypeConstant>(tc));
+    }
+    case Kind::BITVECTOR_TYPE:
+    {
+      uint32_t size = readVarint32();
+      if (size == 0)
+      {
+        fail("invalid bit-vector type");
+      }
+      return d_nm->mkBitVectorType(size);
+    }
+    case Kind::FLOATINGPOINT_TYPE:
+    {
+      uint32_t exp = readVarint32();
+      uint32_t sig = readVarint32();
+      if (exp < 2 || sig < 2)
+      {
+        fail("invalid floating-point type");
+      }
+      return d_nm->mkFloatingPointType(exp, sig);
+    }
+    case Kind::SORT_TYPE: return d_nm->mkSort(readString());
+    case Kind::FUNCTION_TYPE:
+    case Kind::ARRAY_TYPE:
+    case Kind::SET_TYPE:
+    case Kind::SEQUENCE_TYPE:
+    {
+      uint64_t nchildren = readVarint();
+      if (nchildren < kind::metakind::getMinArityForKind(k)
+          || nchildren > kind::metakind::getMaxArityForKind(k))
+      {
+        fail("invalid number of children");
+      }
+      std::vector<TypeNode> children;
+      for (uint64_t i = 0; i < nchildren; ++i)
+      {
+        children.push_back(readTypeRef());
+      }
+      return d_nm->mkTypeNode(k, children);
+    }
+    default: break;
+  }
+  fail("unsupported type kind");
+}
+
+void SnapshotReader::fail(const std::string& msg) const
+{
+  throw Exception("malformed snapshot: " + msg);
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A binary snapshot format for node DAGs.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_SNAPSHOT_H
+#define CVC5__EXPR__NODE_SNAPSHOT_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/type_node.h"
+
+namespace cvc5::internal {
+
+class NodeManager;
+
+namespace expr {
+
+/**
+ * A snapshot is a binary encoding of the DAG of a list of nodes, including
+ * the types and the names of the free symbols that occur in it. Each
+ * distinct node or type is stored exactly once, after all of its children,
+ * so that a snapshot can be loaded in a single pass in which every node is
+ * hash-consed exactly once.
+ *
+ * The format consists of the magic string "CVC5SNAP", a format version, the
+ * number of records, the records and the list of root records. All numbers
+ * are encoded as unsigned LEB128 varints and references to (earlier)
+ * records are encoded as the distance to the referencing record, which
+ * keeps snapshots compact regardless of their size.
+ *
+ * Supported are all nodes built over Boolean, arithmetic, bit-vector and
+ * string constants, free and bound variables, function, array, set and
+ * sequence types, and uninterpreted sorts. An exception is thrown for
+ * anything else (e.g., skolems or datatypes).
+ *
+ * Variables and uninterpreted sorts are recreated when a snapshot is loaded,
+ * i.e., they are distinct from the variables and sorts of the same name that
+ * were created before.
+ */
+
+/**
+ * Write a snapshot of the DAG of roots to out.
+ *
+ * @throws Exception if the DAG contains a node that is not supported
+ */
+void saveSnapshot(std::ostream& out, const std::vector<Node>& roots);
+
+/**
+ * Load the snapshot stored in file filename into nm, and return its roots.
+ * The file is mapped into memory if possible.
+ *
+ * @throws Exception if the file cannot be read or is not a valid snapshot
+ */
+std::vector<Node> loadSnapshot(NodeManager* nm, const std::string& filename);
+
+/**
+ * The reader of snapshots. It is a friend of the node manager, since it
+ * creates free variables (see NodeManager::mkVar()).
+ */
+class SnapshotReader
+{
+ public:
+  SnapshotReader(NodeManager* nm, const char* data, size_t size);
+
+  /**
+   * Read the snapshot and return its roots.
+   *
+   * @throws Exception if the data is not a valid snapshot
+   */
+  std::vector<Node> read();
+
+ private:
+  /** Read a single byte */
+  uint8_t readByte();
+  /** Read an unsigned varint */
+  uint64_t readVarint();
+  /** Read an unsigned varint that fits into 32 bits */
+  uint32_t readVarint32();
+  /** Read a length-prefixed string */
+  std::string readString();
+  /** Read an integer */
+  Integer readInteger();
+  /** Read a reference to an earlier record */
+  uint64_t readRef();
+  /** Read a reference to an earlier term (resp. type) record */
+  const Node& readTermRef();
+  const TypeNode& readTypeRef();
+  /** Read the record of a term (resp. type) with kind k */
+  Node readTerm(Kind k);
+  TypeNode readType(Kind k);
+  /** Throw an exception for malformed input */
+  [[noreturn]] void fail(const std::string& msg) const;
+
+  /** The node manager */
+  NodeManager* d_nm;
+  /** The next byte to read */
+  const char* d_cur;
+  /** The end of the data */
+  const char* d_end;
+  /** The records read so far, exactly one of which is non-null per index */
+  std::vector<Node> d_terms;
+  std::vector<TypeNode> d_types;
+};
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_SNAPSHOT_H */
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Morgan Deters, Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A size-class allocator for node values.
+ */
+
+#include "expr/node_value_allocator.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+namespace {
+/** The size of a chunk in bytes */
+constexpr size_t s_chunkSize = 64 * 1024;
+}  // namespace
+
+NodeValueAllocator::NodeValueAllocator() {}
+
+NodeValueAllocator::~NodeValueAllocator()
+{
+  for (char* chunk : d_chunks)
+  {
+    std::free(chunk);
+  }
+}
+
+void NodeValueAllocator::newChunk(SizeClass& sc)
+{
+  char* chunk = static_cast<char*>(std::malloc(s_chunkSize));
+  if (chunk == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  d_chunks.push_back(chunk);
+  // the remainder of the previous chunk (smaller than one block) is dropped
+  sc.d_next = chunk;
+  sc.d_end = chunk + s_chunkSize;
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Morgan Deters, Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A size-class allocator for node values.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_VALUE_ALLOCATOR_H
+#define CVC5__EXPR__NODE_VALUE_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/node_value.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+/**
+ * Allocator for the storage of (non-constant) node values owned by a
+ * NodeManager.
+ *
+ * Node values with at most s_maxSmallChildren children are carved out of
+ * large chunks, with one size class per number of children. Freed node
+ * values are kept in an intrusive free list per size class and are reused
+ * by subsequent allocations of the same class. Chunks are only released
+ * when the allocator is destroyed, i.e., when the owning NodeManager is
+ * destroyed. Node values with more children are allocated with std::malloc.
+ *
+ * Since most terms have few children, this avoids most of the per-node
+ * overhead of the system allocator and keeps nodes of similar shape close
+ * to each other in memory.
+ */
+class NodeValueAllocator
+{
+ public:
+  /** The maximal number of children of a node value allocated in a chunk */
+  static constexpr size_t s_maxSmallChildren = 4;
+
+  NodeValueAllocator();
+  ~NodeValueAllocator();
+  NodeValueAllocator(const NodeValueAllocator&) = delete;
+  NodeValueAllocator& operator=(const NodeValueAllocator&) = delete;
+
+  /**
+   * Allocate (uninitialized) storage for a node value with nchildren
+   * children.
+   *
+   * @throws bad_alloc if the allocation fails
+   */
+  NodeValue* allocate(size_t nchildren)
+  {
+    if (CVC5_PREDICT_FALSE(nchildren > s_maxSmallChildren))
+    {
+      void* mem = std::malloc(blockSize(nchildren));
+      if (mem == nullptr)
+      {
+        throw std::bad_alloc();
+      }
+      return static_cast<NodeValue*>(mem);
+    }
+    SizeClass& sc = d_classes[nchildren];
+    if (sc.d_freeList != nullptr)
+    {
+      FreeBlock* b = sc.d_freeList;
+      sc.d_freeList = b->d_next;
+      return reinterpret_cast<NodeValue*>(b);
+    }
+    size_t size = blockSize(nchildren);
+    if (CVC5_PREDICT_FALSE(sc.d_next + size > sc.d_end))
+    {
+      newChunk(sc);
+    }
+    NodeValue* nv = reinterpret_cast<NodeValue*>(sc.d_next);
+    sc.d_next += size;
+    return nv;
+  }
+
+  /**
+   * Release the storage of nv, which must have been obtained by
+   * allocate(nchildren).
+   */
+  void deallocate(NodeValue* nv, size_t nchildren)
+  {
+    if (CVC5_PREDICT_FALSE(nchildren > s_maxSmallChildren))
+    {
+      std::free(nv);
+      return;
+    }
+    SizeClass& sc = d_classes[nchildren];
+    FreeBlock* b = reinterpret_cast<FreeBlock*>(nv);
+    b->d_next = sc.d_freeList;
+    sc.d_freeList = b;
+  }
+
+  /** The number of chunks allocated so far. */
+  size_t getNumChunks() const { return d_chunks.size(); }
+
+  /** The size in bytes of a node value with nchildren children. */
+  static size_t blockSize(size_t nchildren)
+  {
+    return sizeof(NodeValue) + sizeof(NodeValue*) * nchildren;
+  }
+
+ private:
+  /** A freed block, linked into the free list of its size class. */
+  struct FreeBlock
+  {
+    FreeBlock* d_next;
+  };
+  /** The state of one size class */
+  struct SizeClass
+  {
+    /** The head of the free list */
+    FreeBlock* d_freeList = nullptr;
+    /** The next unused byte in the current chunk */
+    char* d_next = nullptr;
+    /** The end of the current chunk */
+    char* d_end = nullptr;
+  };
+  /** Allocate a new chunk for size class sc */
+  void newChunk(SizeClass& sc);
+
+  /** The size classes, indexed by number of children */
+  SizeClass d_classes[s_maxSmallChildren + 1];
+  /** All chunks allocated so far */
+  std::vector<char*> d_chunks;
+};
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_VALUE_ALLOCATOR_H */
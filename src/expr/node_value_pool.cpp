@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Morgan Deters, Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The hash-consing pool of node values.
+ */
+
+#include "expr/node_value_pool.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+namespace {
+/** The initial number of slots, must be a power of two. */
+constexpr size_t s_initialCapacity = 1024;
+/** log2(s_initialCapacity) */
+constexpr uint32_t s_initialLogCapacity = 10;
+}  // namespace
+
+NodeValuePool::NodeValuePool()
+    : d_tags(s_initialCapacity, 0),
+      d_values(s_initialCapacity, nullptr),
+      d_size(0),
+      d_mask(s_initialCapacity - 1),
+      d_shift(32 - s_initialLogCapacity),
+      d_numLookups(0),
+      d_numProbes(0),
+      d_maxProbeLength(0)
+{
+}
+
+void NodeValuePool::insertInternal(uint32_t tag, NodeValue* nv)
+{
+  size_t i = homeSlot(tag);
+  while (d_tags[i] != 0)
+  {
+    i = (i + 1) & d_mask;
+  }
+  d_tags[i] = tag;
+  d_values[i] = nv;
+}
+
+void NodeValuePool::erase(NodeValue* nv)
+{
+  uint32_t tag = computeTag(nv);
+  size_t i = homeSlot(tag);
+  while (d_values[i] != nv)
+  {
+    Assert(d_tags[i] != 0) << "NodeValue is not in the pool!";
+    i = (i + 1) & d_mask;
+  }
+  // Backward-shift deletion: move subsequent entries of the probe sequence
+  // into the hole, unless doing so would move them before their home slot.
+  size_t j = i;
+  for (;;)
+  {
+    j = (j + 1) & d_mask;
+    uint32_t t = d_tags[j];
+    if (t == 0)
+    {
+      break;
+    }
+    size_t home = homeSlot(t);
+    // the entry at j may be moved to the hole at i iff its home slot is not
+    // (cyclically) within (i, j]
+    if (((j - home) & d_mask) >= ((j - i) & d_mask))
+    {
+      d_tags[i] = t;
+      d_values[i] = d_values[j];
+      i = j;
+    }
+  }
+  d_tags[i] = 0;
+  d_values[i] = nullptr;
+  --d_size;
+}
+
+void NodeValuePool::reserve(size_t n)
+{
+  while (4 * n > 3 * d_tags.size())
+  {
+    grow();
+  }
+}
+
+void NodeValuePool::grow()
+{
+  Assert(d_shift > 0) << "NodeValuePool capacity exhausted";
+  std::vector<uint32_t> tags(2 * d_tags.size(), 0);
+  std::vector<NodeValue*> values(2 * d_values.size(), nullptr);
+  tags.swap(d_tags);
+  values.swap(d_values);
+  d_mask = d_tags.size() - 1;
+  --d_shift;
+  for (size_t i = 0, n = tags.size(); i < n; ++i)
+  {
+    if (tags[i] != 0)
+    {
+      insertInternal(tags[i], values[i]);
+    }
+  }
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
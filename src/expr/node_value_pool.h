@@ -0,0 +1,209 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Morgan Deters, Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The hash-consing pool of node values.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_VALUE_POOL_H
+#define CVC5__EXPR__NODE_VALUE_POOL_H
+
+#include <cstdint>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/metakind.h"
+#include "expr/node_value.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+/**
+ * An open-addressing hash set of NodeValue pointers, used by the NodeManager
+ * for hash-consing.
+ *
+ * The table uses linear probing over two parallel arrays: an array of 32-bit
+ * hash tags and an array of NodeValue pointers. A tag is the top half of the
+ * (mixed) pool hash of the node value stored in the corresponding slot, with
+ * the lowest bit forced to one so that a tag of zero denotes an empty slot.
+ * Probing therefore only touches the (contiguous, densely packed) tag array
+ * and dereferences a node value only if its tag matches, which avoids the
+ * pointer chasing of a node-based std::unordered_set. Since the home slot of
+ * an entry can be recomputed from its tag, removal uses backward-shift
+ * deletion and no tombstones are ever left in the table.
+ *
+ * The same caveats as for NodeValuePoolHashFunction apply: lookups may be
+ * done with NodeValues that are not fully constructed (see
+ * NodeManager::poolLookup()), but only fully constructed NodeValues may be
+ * inserted.
+ */
+class NodeValuePool
+{
+ public:
+  NodeValuePool();
+
+  /** Iterator over the node values in this pool. */
+  class const_iterator
+  {
+   public:
+    const_iterator(const NodeValuePool* pool, size_t i) : d_pool(pool), d_i(i)
+    {
+      skipEmpty();
+    }
+    NodeValue* operator*() const { return d_pool->d_values[d_i]; }
+    const_iterator& operator++()
+    {
+      ++d_i;
+      skipEmpty();
+      return *this;
+    }
+    bool operator==(const const_iterator& other) const
+    {
+      return d_i == other.d_i;
+    }
+    bool operator!=(const const_iterator& other) const
+    {
+      return d_i != other.d_i;
+    }
+
+   private:
+    void skipEmpty()
+    {
+      while (d_i < d_pool->d_tags.size() && d_pool->d_tags[d_i] == 0)
+      {
+        ++d_i;
+      }
+    }
+    const NodeValuePool* d_pool;
+    size_t d_i;
+  };
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, d_tags.size()); }
+
+  /** The number of node values in this pool. */
+  size_t size() const { return d_size; }
+  /** Whether this pool is empty. */
+  bool empty() const { return d_size == 0; }
+
+  /**
+   * Look up a node value that is equal (w.r.t. NodeValuePoolEq) to nv.
+   * Returns nullptr if no such node value is in the pool.
+   */
+  NodeValue* find(const NodeValue* nv) const;
+
+  /**
+   * Insert nv into the pool. It is an error to insert a node value that is
+   * already in the pool.
+   */
+  void insert(NodeValue* nv);
+
+  /**
+   * Remove nv from the pool. It is an error to remove a node value that is
+   * not in the pool.
+   */
+  void erase(NodeValue* nv);
+
+  /**
+   * Grow the pool such that it can hold n node values without being grown
+   * again.
+   */
+  void reserve(size_t n);
+
+  /** The number of bytes used by the slots of this pool. */
+  size_t getMemoryUsage() const
+  {
+    return d_tags.capacity() * sizeof(uint32_t)
+           + d_values.capacity() * sizeof(NodeValue*);
+  }
+
+  /** The total number of calls to find(). */
+  uint64_t getNumLookups() const { return d_numLookups; }
+  /** The total number of slots inspected by find(). */
+  uint64_t getNumProbes() const { return d_numProbes; }
+  /** The maximal number of slots inspected by a single call to find(). */
+  uint64_t getMaxProbeLength() const { return d_maxProbeLength; }
+
+ private:
+  /** The tag of nv, which is never zero. */
+  static uint32_t computeTag(const NodeValue* nv)
+  {
+    // Fibonacci hashing, to spread the (weak) pool hash over the high bits.
+    uint64_t h = static_cast<uint64_t>(nv->poolHash()) * 0x9e3779b97f4a7c15ULL;
+    return static_cast<uint32_t>(h >> 32) | 1;
+  }
+  /** The home slot of an entry with the given tag. */
+  size_t homeSlot(uint32_t tag) const { return tag >> d_shift; }
+  /** Double the capacity of this pool and reinsert all node values. */
+  void grow();
+  /** Insert into a free slot, assuming nv is not in the pool. */
+  void insertInternal(uint32_t tag, NodeValue* nv);
+
+  /** The tags of the slots, zero for empty slots. */
+  std::vector<uint32_t> d_tags;
+  /** The node values of the slots. */
+  std::vector<NodeValue*> d_values;
+  /** The number of node values in the pool. */
+  size_t d_size;
+  /** mask for wrapping slot indices, d_tags.size() - 1 */
+  size_t d_mask;
+  /** 32 - log2(d_tags.size()) */
+  uint32_t d_shift;
+  /** Probe length counters, updated by find() */
+  mutable uint64_t d_numLookups;
+  mutable uint64_t d_numProbes;
+  mutable uint64_t d_maxProbeLength;
+};
+
+inline NodeValue* NodeValuePool::find(const NodeValue* nv) const
+{
+  uint32_t tag = computeTag(nv);
+  size_t i = homeSlot(tag);
+  uint64_t probes = 1;
+  NodeValue* result = nullptr;
+  NodeValuePoolEq eq;
+  for (uint32_t t = d_tags[i]; t != 0; t = d_tags[i])
+  {
+    if (t == tag && eq(d_values[i], nv))
+    {
+      result = d_values[i];
+      break;
+    }
+    i = (i + 1) & d_mask;
+    ++probes;
+  }
+  ++d_numLookups;
+  d_numProbes += probes;
+  if (probes > d_maxProbeLength)
+  {
+    d_maxProbeLength = probes;
+  }
+  return result;
+}
+
+inline void NodeValuePool::insert(NodeValue* nv)
+{
+  Assert(find(nv) == nullptr) << "NodeValue already in the pool!";
+  // keep the load factor below 3/4
+  if (4 * (d_size + 1) > 3 * d_tags.size())
+  {
+    grow();
+  }
+  insertInternal(computeTag(nv), nv);
+  ++d_size;
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_VALUE_POOL_H */
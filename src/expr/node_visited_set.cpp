@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Epoch-stamped visited sets for node traversals.
+ */
+
+#include "expr/node_visited_set.h"
+
+#include "expr/node_manager.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+NodeVisitedSet::NodeVisitedSet(NodeManager* nm)
+    : d_pool(nm == nullptr ? nullptr : &nm->d_visitedPool)
+{
+  if (d_pool != nullptr)
+  {
+    d_stamps = d_pool->acquire();
+  }
+  else
+  {
+    // the null node does not belong to a node manager
+    d_local = std::make_unique<VisitedStamps>();
+    d_stamps = d_local.get();
+  }
+}
+
+NodeVisitedSet::~NodeVisitedSet()
+{
+  if (d_pool != nullptr)
+  {
+    d_stamps->reset();
+    d_pool->release(d_stamps);
+  }
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Epoch-stamped visited sets for node traversals.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_VISITED_SET_H
+#define CVC5__EXPR__NODE_VISITED_SET_H
+
+#include <memory>
+
+#include "expr/node.h"
+#include "expr/visited_stamps.h"
+
+namespace cvc5::internal {
+
+class NodeManager;
+
+namespace expr {
+
+/**
+ * A set of nodes, to be used as the visited set of a traversal instead of
+ * std::unordered_set<TNode>. Membership is tested by indexing the stamp
+ * array with the node id, which avoids hashing and the allocation of one
+ * hash table entry per visited node. The stamp array is borrowed from the
+ * node manager for the lifetime of this object.
+ *
+ * Like std::unordered_set<TNode>, this does not keep the nodes in it alive.
+ */
+class NodeVisitedSet
+{
+ public:
+  /** Construct an empty set for the nodes of nm. */
+  NodeVisitedSet(NodeManager* nm);
+  ~NodeVisitedSet();
+  NodeVisitedSet(const NodeVisitedSet&) = delete;
+  NodeVisitedSet& operator=(const NodeVisitedSet&) = delete;
+
+  /** Add n to the set, return true if it was not already in the set. */
+  bool insert(TNode n) { return d_stamps->insert(n.getId()); }
+  /** Is n in the set? */
+  bool contains(TNode n) const { return d_stamps->contains(n.getId()); }
+
+ private:
+  /** The pool the stamp array was borrowed from, if any */
+  VisitedStampsPool* d_pool;
+  /** The stamp array, if not borrowed */
+  std::unique_ptr<VisitedStamps> d_local;
+  /** The stamp array */
+  VisitedStamps* d_stamps;
+};
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_VISITED_SET_H */
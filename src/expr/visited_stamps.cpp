@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Stamp arrays indexed by node id.
+ */
+
+#include "expr/visited_stamps.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+void VisitedStamps::grow(uint64_t id)
+{
+  size_t size = std::max<size_t>(1024, d_stamps.size());
+  while (size <= id)
+  {
+    size *= 2;
+  }
+  d_stamps.resize(size, 0);
+}
+
+VisitedStamps* VisitedStampsPool::acquire()
+{
+  if (d_free.empty())
+  {
+    d_all.push_back(std::make_unique<VisitedStamps>());
+    return d_all.back().get();
+  }
+  VisitedStamps* s = d_free.back();
+  d_free.pop_back();
+  return s;
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Morgan Deters
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Stamp arrays indexed by node id.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__VISITED_STAMPS_H
+#define CVC5__EXPR__VISITED_STAMPS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+/**
+ * An array of stamps indexed by node id. A node id is in the set iff its
+ * stamp is equal to the current epoch, hence the set is cleared in constant
+ * time by advancing the epoch.
+ */
+class VisitedStamps
+{
+ public:
+  VisitedStamps() : d_epoch(1) {}
+
+  /** Clear the set. */
+  void reset()
+  {
+    if (CVC5_PREDICT_FALSE(++d_epoch == 0))
+    {
+      // the epoch wrapped around, stale stamps could be mistaken as current
+      std::fill(d_stamps.begin(), d_stamps.end(), 0);
+      d_epoch = 1;
+    }
+  }
+
+  /** Add id to the set, return true if it was not already in the set. */
+  bool insert(uint64_t id)
+  {
+    if (CVC5_PREDICT_FALSE(id >= d_stamps.size()))
+    {
+      grow(id);
+    }
+    if (d_stamps[id] == d_epoch)
+    {
+      return false;
+    }
+    d_stamps[id] = d_epoch;
+    return true;
+  }
+
+  /** Is id in the set? */
+  bool contains(uint64_t id) const
+  {
+    return id < d_stamps.size() && d_stamps[id] == d_epoch;
+  }
+
+  /** The number of ids covered by the stamp array. */
+  size_t capacity() const { return d_stamps.size(); }
+
+ private:
+  /** Grow the stamp array such that it covers id. */
+  void grow(uint64_t id);
+
+  /** The stamps, indexed by node id */
+  std::vector<uint32_t> d_stamps;
+  /** The current epoch, never zero */
+  uint32_t d_epoch;
+};
+
+/**
+ * The stamp arrays of a node manager. Stamp arrays that are not in use are
+ * kept for reuse by subsequent traversals. Traversals that are active at the
+ * same time (e.g., nested or recursive ones) use distinct stamp arrays.
+ */
+class VisitedStampsPool
+{
+ public:
+  VisitedStampsPool() {}
+  VisitedStampsPool(const VisitedStampsPool&) = delete;
+  VisitedStampsPool& operator=(const VisitedStampsPool&) = delete;
+
+  /** Get an empty stamp array that is not in use. */
+  VisitedStamps* acquire();
+  /** Return a stamp array obtained by acquire(). */
+  void release(VisitedStamps* s) { d_free.push_back(s); }
+
+  /** The number of stamp arrays allocated so far. */
+  size_t getNumAllocated() const { return d_all.size(); }
+
+ private:
+  /** All stamp arrays owned by this pool */
+  std::vector<std::unique_ptr<VisitedStamps>> d_all;
+  /** The stamp arrays that are not in use */
+  std::vector<VisitedStamps*> d_free;
+};
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__VISITED_STAMPS_H */
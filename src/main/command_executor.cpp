@@ -21,6 +21,7 @@
 
 #include <cvc5/cvc5_parser.h>
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -56,7 +57,8 @@ CommandExecutor::CommandExecutor(std::unique_ptr<cvc5::Solver>& solver)
     : d_solver(solver),
       d_symman(new SymbolManager(d_solver->getTermManager())),
       d_result(),
-      d_parseOnly(false)
+      d_parseOnly(false),
+      d_learnedLiteralsImported(false)
 {
 }
 CommandExecutor::~CommandExecutor()
@@ -94,11 +96,20 @@ void CommandExecutor::printStatistics(std::ostream& out) const
     }
     {
       const auto& stats = d_solver->getTermManager().getStatistics();
-      auto it =
-          stats.begin(d_solver->getOptionInfo("stats-internal").boolValue(),
-                      d_solver->getOptionInfo("stats-all").boolValue());
+      bool statsInternal =
+          d_solver->getOptionInfo("stats-internal").boolValue();
+      bool statsMemory = d_solver->getOptionInfo("stats-memory").boolValue();
+      auto it = stats.begin(statsInternal || statsMemory,
+                            d_solver->getOptionInfo("stats-all").boolValue());
       for (; it != stats.end(); ++it)
       {
+        // the (internal) memory statistics are printed with --stats-memory
+        // even if the other internal statistics are not
+        if (!statsInternal && it->second.isInternal()
+            && it->first.rfind("cvc5::memory::", 0) != 0)
+        {
+          continue;
+        }
         out << it->first << " = " << it->second << std::endl;
       }
     }
@@ -129,20 +140,27 @@ void CommandExecutor::reset()
 
 bool CommandExecutor::doCommandSingleton(Cmd* cmd)
 {
+  const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(cmd);
+  const CheckSatAssumingCommand* csa =
+      dynamic_cast<const CheckSatAssumingCommand*>(cmd);
+  // the learned literals are imported once the symbols are declared
+  if ((cs != nullptr || csa != nullptr) && !d_learnedLiteralsImported
+      && !d_parseOnly)
+  {
+    importLearnedLiterals();
+  }
+
   bool status = solverInvoke(d_solver.get(),
                              d_symman->toSymManager(),
                              cmd);
 
   cvc5::Result res;
   bool hasResult = false;
-  const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(cmd);
   if (cs != nullptr)
   {
     d_result = res = cs->getResult();
     hasResult = true;
   }
-  const CheckSatAssumingCommand* csa =
-      dynamic_cast<const CheckSatAssumingCommand*>(cmd);
   if (csa != nullptr)
   {
     d_result = res = csa->getResult();
@@ -155,6 +173,11 @@ bool CommandExecutor::doCommandSingleton(Cmd* cmd)
     return status;
   }
 
+  if (status && !d_solver->getOption("learned-literals-out").empty())
+  {
+    exportLearnedLiterals();
+  }
+
   // dump the model/proof/unsat core if option is set
   if (status) {
     bool isResultUnsat = res.isUnsat();
@@ -242,6 +265,84 @@ bool CommandExecutor::solverInvoke(cvc5::Solver* solver,
   return !cmd->fail();
 }
 
+void CommandExecutor::importLearnedLiterals()
+{
+  d_learnedLiteralsImported = true;
+  std::string filename = d_solver->getOption("learned-literals-in");
+  if (filename.empty())
+  {
+    return;
+  }
+  std::ifstream in(filename);
+  if (!in)
+  {
+    d_solver->getDriverOptions().err()
+        << "warning: cannot open learned literals file " << filename
+        << std::endl;
+    return;
+  }
+  std::vector<Term> lits;
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (line.empty() || line[0] == ';')
+    {
+      continue;
+    }
+    // parse each literal on its own, so that a literal over a symbol that
+    // does not exist in this run does not affect the others
+    InputParser parser(d_solver.get(), d_symman.get());
+    parser.setStringInput(
+        modes::InputLanguage::SMT_LIB_2_6, line, "learned-literals");
+    try
+    {
+      Term lit = parser.nextTerm();
+      if (!lit.isNull() && lit.getSort().isBoolean())
+      {
+        lits.push_back(lit);
+      }
+    }
+    catch (ParserException&)
+    {
+    }
+    catch (CVC5ApiException&)
+    {
+    }
+  }
+  Trace("learned-literals") << "Imported " << lits.size()
+                            << " learned literals" << std::endl;
+  if (d_solver->getOption("learned-literals-in-mode") == "assert")
+  {
+    for (const Term& lit : lits)
+    {
+      d_solver->assertFormula(lit);
+    }
+  }
+  else
+  {
+    d_solver->addPhaseHints(lits);
+  }
+}
+
+void CommandExecutor::exportLearnedLiterals()
+{
+  std::string filename = d_solver->getOption("learned-literals-out");
+  std::ofstream out(filename);
+  if (!out)
+  {
+    d_solver->getDriverOptions().err()
+        << "warning: cannot open learned literals file " << filename
+        << std::endl;
+    return;
+  }
+  out << "; learned input literals, for --learned-literals-in" << std::endl;
+  for (const Term& lit :
+       d_solver->getLearnedLiterals(modes::LearnedLitType::INPUT))
+  {
+    out << lit << std::endl;
+  }
+}
+
 void CommandExecutor::flushOutputStreams() {
   printStatistics(d_solver->getDriverOptions().err());
 
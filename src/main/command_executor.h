@@ -55,6 +55,9 @@ class CommandExecutor
   /** Cache option value of parse-only option. */
   bool d_parseOnly;
 
+  /** Whether the literals of --learned-literals-in were imported. */
+  bool d_learnedLiteralsImported;
+
  public:
   CommandExecutor(std::unique_ptr<cvc5::Solver>& solver);
 
@@ -121,6 +124,14 @@ class CommandExecutor
   bool solverInvoke(cvc5::Solver* solver,
                     parser::SymManager* sm,
                     parser::Cmd* cmd);
+
+  /**
+   * Import the literals of --learned-literals-in. Literals over symbols that
+   * are not declared (with the same sort) in this run are skipped.
+   */
+  void importLearnedLiterals();
+  /** Write the learned input literals to --learned-literals-out. */
+  void exportLearnedLiterals();
 }; /* class CommandExecutor */
 
 
@@ -34,6 +34,7 @@
 #include "main/main.h"
 #include "main/options.h"
 #include "main/portfolio_driver.h"
+#include "main/server.h"
 #include "main/signal_handlers.h"
 #include "main/time_limit.h"
 #include "smt/solver_engine.h"
@@ -96,7 +97,10 @@ int runCvc5(int argc, char* argv[], std::unique_ptr<cvc5::Solver>& solver)
     }
   }
 
-  auto limit = install_time_limit(solver->getOptionInfo("tlimit").uintValue());
+  // in server mode, the time limit applies to each script
+  const std::string server = solver->getOption("server");
+  uint64_t tlimit = solver->getOptionInfo("tlimit").uintValue();
+  auto limit = install_time_limit(server.empty() ? tlimit : 0);
   segvSpin = solver->getOptionInfo("segv-spin").boolValue();
 
   // If in competition mode, set output stream option to flush immediately
@@ -108,6 +112,10 @@ int runCvc5(int argc, char* argv[], std::unique_ptr<cvc5::Solver>& solver)
   if(filenames.size() > 1) {
     throw Exception("Too many input files specified.");
   }
+  if (!server.empty() && !filenames.empty())
+  {
+    throw Exception("No input file can be given in server mode.");
+  }
 
   // If no file supplied we will read from standard input
   const bool inputFromStdin = filenames.empty() || filenames[0] == "-";
@@ -117,7 +125,9 @@ int runCvc5(int argc, char* argv[], std::unique_ptr<cvc5::Solver>& solver)
   {
     pExecutor->setOptionInternal(
         "interactive",
-        (inputFromStdin && isatty(fileno(stdin))) ? "true"  : "false");
+        (inputFromStdin && server.empty() && isatty(fileno(stdin)))
+            ? "true"
+            : "false");
   }
 
   // Auto-detect input language by filename extension
@@ -174,7 +184,8 @@ int runCvc5(int argc, char* argv[], std::unique_ptr<cvc5::Solver>& solver)
     solver->setInfo("filename", filenameStr);
 
     // Parse and execute commands until we are done
-    if (solver->getOptionInfo("interactive").boolValue() && inputFromStdin)
+    if (solver->getOptionInfo("interactive").boolValue() && inputFromStdin
+        && server.empty())
     {
       // We use the interactive shell when piping from stdin, even some cases
       // where the input stream is not a TTY. We do this to avoid memory issues
@@ -233,6 +244,14 @@ int runCvc5(int argc, char* argv[], std::unique_ptr<cvc5::Solver>& solver)
       // now store options as original
       pExecutor->storeOptionsAsOriginal();
 
+      if (!server.empty())
+      {
+        return runServer(server,
+                         solver->getOptionInfo("server-jobs").uintValue(),
+                         ilang,
+                         tlimit);
+      }
+
       std::unique_ptr<InputParser> parser(new InputParser(
           pExecutor->getSolver(), pExecutor->getSymbolManager()));
       if( inputFromStdin ) {
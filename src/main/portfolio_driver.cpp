@@ -21,9 +21,13 @@
 
 #include <cvc5/cvc5.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <map>
 #include <optional>
+#include <sstream>
 #include <thread>
 
 #include "base/check.h"
@@ -381,6 +385,7 @@ class PortfolioProcessPool
       // Check if any job was successful
       if (checkResults())
       {
+        stopRunningJobs();
         return true;
       }
 
@@ -396,6 +401,7 @@ class PortfolioProcessPool
         pid_t child = wait(&wstatus);
         if (checkResults(child, wstatus))
         {
+          stopRunningJobs();
           return true;
         }
       }
@@ -483,6 +489,28 @@ class PortfolioProcessPool
     job.d_state = JobState::RUNNING;
   }
 
+  /**
+   * Kill the worker and timeout processes of all jobs that are still running,
+   * which is done once some job has solved the input.
+   */
+  void stopRunningJobs()
+  {
+    for (auto& job : d_jobs)
+    {
+      if (job.d_state != JobState::RUNNING) continue;
+      Trace("portfolio") << "Stopping " << job.d_config << std::endl;
+      kill(job.d_worker, SIGKILL);
+      if (job.d_timeout > 0)
+      {
+        kill(job.d_timeout, SIGKILL);
+      }
+      // reap the worker, so that it does not remain a zombie process
+      waitpid(job.d_worker, nullptr, 0);
+      job.d_state = JobState::DONE;
+      --d_running;
+    }
+  }
+
   /**
    * Check whether some process terminated and solved the input. If so,
    * forward the child process output to the main out and return true.
@@ -588,6 +616,11 @@ bool PortfolioDriver::solve(std::unique_ptr<CommandExecutor>& executor)
   bool incremental_solving = solver.getOption("incremental") == "true";
   PortfolioStrategy strategy = getStrategy(incremental_solving, *ctx.d_logic);
   Assert(!strategy.d_strategies.empty()) << "The portfolio strategy should never be empty.";
+  std::string history = solver.getOption("portfolio-history");
+  if (!history.empty())
+  {
+    applyHistory(strategy, *ctx.d_logic, history);
+  }
   if (strategy.d_strategies.size() == 1)
   {
     PortfolioConfig& config = strategy.d_strategies.front();
@@ -671,6 +704,61 @@ std::ostream& operator<<(std::ostream& os, const PortfolioConfig& config)
   return os;
 }
 
+void PortfolioDriver::applyHistory(PortfolioStrategy& s,
+                                   const std::string& logic,
+                                   const std::string& file)
+{
+  std::ifstream in(file);
+  if (!in)
+  {
+    throw internal::Exception("Unable to read portfolio history from " + file);
+  }
+  // the estimated success rate of the configurations of the logic, by their
+  // option string
+  std::map<std::string, double> rates;
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+    std::istringstream ls(line);
+    std::string l;
+    uint64_t solved = 0, tried = 0;
+    if (!(ls >> l >> solved >> tried))
+    {
+      throw internal::Exception("Malformed line in portfolio history: " + line);
+    }
+    if (l != logic)
+    {
+      continue;
+    }
+    std::string options;
+    std::getline(ls >> std::ws, options);
+    rates[options] = (solved + 1.0) / (tried + 2.0);
+  }
+  std::vector<PortfolioConfig>& configs = s.d_strategies;
+  // configurations that are not in the history get the prior rate
+  auto rate = [&rates](const PortfolioConfig& c) {
+    auto it = rates.find(c.toOptionString());
+    return it == rates.end() ? 0.5 : it->second;
+  };
+  // reorder each range of configurations with a timeout
+  auto begin = configs.begin();
+  while (begin != configs.end())
+  {
+    auto end = std::find_if(begin, configs.end(), [](const PortfolioConfig& c) {
+      return c.d_timeout == 0;
+    });
+    std::stable_sort(
+        begin, end, [&rate](const PortfolioConfig& a, const PortfolioConfig& b) {
+          return rate(a) > rate(b);
+        });
+    begin = end == configs.end() ? end : end + 1;
+  }
+}
+
 /**
  * Check if the first string (the logic) is one of the remaining strings.
  * Used to have a reasonably concise syntax to check the current logic against a
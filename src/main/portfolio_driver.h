@@ -188,6 +188,20 @@ class PortfolioDriver
                                 const std::string& logic);
   PortfolioStrategy getIncrementalStrategy(const std::string& logic);
   PortfolioStrategy getNonIncrementalStrategy(const std::string& logic);
+  /**
+   * Reorder the configurations of strategy s for the given logic based on the
+   * results of past runs stored in the given file. Each line of the file, other
+   * than empty lines and comments starting with '#', has the form
+   *   <logic> <solved> <tried> <options>
+   * where <options> is the option string of a configuration, as printed with
+   * -o portfolio, which has been tried <tried> times and solved the input
+   * <solved> times. The configurations with a timeout are tried by decreasing
+   * estimated success rate (solved+1)/(tried+2), and otherwise keep their
+   * order. The configurations without timeout remain at their position.
+   */
+  void applyHistory(PortfolioStrategy& s,
+                    const std::string& logic,
+                    const std::string& file);
 
   /** The parser we use to get the commands */
   parser::InputParser* d_parser;
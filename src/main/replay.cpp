@@ -0,0 +1,662 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The cvc5-replay binary, which replays an API trace recorded with the
+ * environment variable CVC5_API_TRACE and reports the time of each call.
+ */
+
+#include <cvc5/cvc5.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "api/cpp/cvc5_trace_format.h"
+
+using namespace cvc5;
+namespace apitrace = cvc5::internal::apitrace;
+
+namespace {
+
+/** Thrown for malformed traces. */
+class MalformedTrace : public std::runtime_error
+{
+ public:
+  MalformedTrace(const std::string& msg) : std::runtime_error(msg) {}
+};
+
+/** Replays a trace with a fresh term manager. */
+class Replayer
+{
+ public:
+  Replayer(std::istream& in, std::ostream& out, bool printCalls)
+      : d_reader(in),
+        d_out(out),
+        d_printCalls(printCalls),
+        d_numRecords(0),
+        d_numErrors(0),
+        d_numMismatches(0),
+        d_definitionMs(0),
+        d_numDefinitions(0),
+        d_stats(static_cast<size_t>(apitrace::Op::NUM_OPS))
+  {
+  }
+
+  /**
+   * Replay the trace.
+   * @return True if all calls succeeded with the recorded results.
+   */
+  bool run()
+  {
+    if (!d_reader.readHeader())
+    {
+      throw MalformedTrace("not an API trace of this version");
+    }
+    apitrace::Op op;
+    while (d_reader.readOp(op))
+    {
+      ++d_numRecords;
+      if (apitrace::isSortDefinition(op) || apitrace::isTermDefinition(op))
+      {
+        auto start = std::chrono::steady_clock::now();
+        if (apitrace::isSortDefinition(op))
+        {
+          defineSort(op);
+        }
+        else
+        {
+          defineTerm(op);
+        }
+        d_definitionMs += elapsedMs(start);
+        ++d_numDefinitions;
+      }
+      else if (op == apitrace::Op::RESULT)
+      {
+        checkResult();
+      }
+      else
+      {
+        call(op);
+      }
+    }
+    return d_numErrors == 0 && d_numMismatches == 0;
+  }
+
+  /** Print the number of calls and the time per kind of call. */
+  void printSummary()
+  {
+    double total = d_definitionMs;
+    d_out << "# calls by total time (ms)" << std::endl;
+    std::multimap<double, size_t, std::greater<double>> byTime;
+    for (size_t i = 0, n = d_stats.size(); i < n; ++i)
+    {
+      if (d_stats[i].d_count > 0)
+      {
+        byTime.emplace(d_stats[i].d_ms, i);
+        total += d_stats[i].d_ms;
+      }
+    }
+    for (const auto& [ms, i] : byTime)
+    {
+      d_out << std::setw(22) << std::left
+            << apitrace::toString(static_cast<apitrace::Op>(i)) << std::right
+            << std::setw(10) << d_stats[i].d_count << std::setw(14)
+            << std::fixed << std::setprecision(3) << ms << std::endl;
+    }
+    d_out << std::setw(22) << std::left << "term/sort definitions"
+          << std::right << std::setw(10) << d_numDefinitions << std::setw(14)
+          << std::fixed << std::setprecision(3) << d_definitionMs << std::endl;
+    d_out << std::setw(22) << std::left << "total" << std::right
+          << std::setw(24) << total << std::endl;
+    d_out << "# " << d_numErrors << " errors, " << d_numMismatches
+          << " result mismatches" << std::endl;
+  }
+
+ private:
+  /** Statistics of a kind of call. */
+  struct CallStats
+  {
+    uint64_t d_count = 0;
+    double d_ms = 0;
+  };
+
+  static double elapsedMs(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+
+  uint64_t readUnsigned()
+  {
+    uint64_t value;
+    if (!d_reader.readUnsigned(value))
+    {
+      throw MalformedTrace("unexpected end of trace");
+    }
+    return value;
+  }
+  std::string readString()
+  {
+    std::string s;
+    if (!d_reader.readString(s))
+    {
+      throw MalformedTrace("unexpected end of trace");
+    }
+    return s;
+  }
+  std::optional<std::string> readSymbol()
+  {
+    if (readUnsigned() == 0)
+    {
+      return std::nullopt;
+    }
+    return readString();
+  }
+  Sort readSort()
+  {
+    uint64_t id = readUnsigned();
+    if (id >= d_sorts.size())
+    {
+      throw MalformedTrace("undefined sort " + std::to_string(id));
+    }
+    return d_sorts[id];
+  }
+  std::vector<Sort> readSorts()
+  {
+    std::vector<Sort> sorts;
+    for (uint64_t i = 0, n = readUnsigned(); i < n; ++i)
+    {
+      sorts.push_back(readSort());
+    }
+    return sorts;
+  }
+  Term readTerm()
+  {
+    uint64_t id = readUnsigned();
+    if (id >= d_terms.size())
+    {
+      throw MalformedTrace("undefined term " + std::to_string(id));
+    }
+    return d_terms[id];
+  }
+  std::vector<Term> readTerms()
+  {
+    std::vector<Term> terms;
+    for (uint64_t i = 0, n = readUnsigned(); i < n; ++i)
+    {
+      terms.push_back(readTerm());
+    }
+    return terms;
+  }
+
+  /** Report an error of the current record. */
+  void error(apitrace::Op op, const std::string& msg)
+  {
+    ++d_numErrors;
+    std::cerr << "record " << d_numRecords << " (" << apitrace::toString(op)
+              << "): " << msg << std::endl;
+  }
+
+  void defineSort(apitrace::Op op)
+  {
+    // the operands are read before constructing the sort, since the sort is
+    // null if the construction fails
+    Sort res;
+    try
+    {
+      switch (op)
+      {
+        case apitrace::Op::SORT_BOOLEAN: res = d_tm.getBooleanSort(); break;
+        case apitrace::Op::SORT_INTEGER: res = d_tm.getIntegerSort(); break;
+        case apitrace::Op::SORT_REAL: res = d_tm.getRealSort(); break;
+        case apitrace::Op::SORT_STRING: res = d_tm.getStringSort(); break;
+        case apitrace::Op::SORT_REGEXP: res = d_tm.getRegExpSort(); break;
+        case apitrace::Op::SORT_ROUNDINGMODE:
+          res = d_tm.getRoundingModeSort();
+          break;
+        case apitrace::Op::SORT_BITVECTOR:
+          res = d_tm.mkBitVectorSort(readUnsigned());
+          break;
+        case apitrace::Op::SORT_FLOATINGPOINT:
+        {
+          uint64_t exp = readUnsigned();
+          uint64_t sig = readUnsigned();
+          res = d_tm.mkFloatingPointSort(exp, sig);
+          break;
+        }
+        case apitrace::Op::SORT_FINITE_FIELD:
+          res = d_tm.mkFiniteFieldSort(readString());
+          break;
+        case apitrace::Op::SORT_ARRAY:
+        {
+          Sort index = readSort();
+          Sort elem = readSort();
+          res = d_tm.mkArraySort(index, elem);
+          break;
+        }
+        case apitrace::Op::SORT_SET: res = d_tm.mkSetSort(readSort()); break;
+        case apitrace::Op::SORT_BAG: res = d_tm.mkBagSort(readSort()); break;
+        case apitrace::Op::SORT_SEQUENCE:
+          res = d_tm.mkSequenceSort(readSort());
+          break;
+        case apitrace::Op::SORT_TUPLE:
+          res = d_tm.mkTupleSort(readSorts());
+          break;
+        case apitrace::Op::SORT_FUNCTION:
+        {
+          std::vector<Sort> domain = readSorts();
+          Sort codomain = readSort();
+          res = d_tm.mkFunctionSort(domain, codomain);
+          break;
+        }
+        case apitrace::Op::SORT_UNINTERPRETED:
+          res = d_tm.mkUninterpretedSort(readSymbol());
+          break;
+        default:
+          error(op, "unsupported sort " + readString());
+          break;
+      }
+    }
+    catch (const CVC5ApiException& e)
+    {
+      error(op, e.what());
+    }
+    d_sorts.push_back(res);
+  }
+
+  void defineTerm(apitrace::Op op)
+  {
+    Term res;
+    try
+    {
+      switch (op)
+      {
+        case apitrace::Op::TERM_CONST:
+        case apitrace::Op::TERM_VAR:
+        {
+          Sort sort = readSort();
+          std::optional<std::string> symbol = readSymbol();
+          res = op == apitrace::Op::TERM_CONST ? d_tm.mkConst(sort, symbol)
+                                               : d_tm.mkVar(sort, symbol);
+          break;
+        }
+        case apitrace::Op::TERM_BOOLEAN:
+          res = d_tm.mkBoolean(readUnsigned() != 0);
+          break;
+        case apitrace::Op::TERM_INTEGER:
+          res = d_tm.mkInteger(readString());
+          break;
+        case apitrace::Op::TERM_REAL: res = d_tm.mkReal(readString()); break;
+        case apitrace::Op::TERM_BITVECTOR:
+        {
+          uint64_t size = readUnsigned();
+          std::string value = readString();
+          res = d_tm.mkBitVector(size, value, 2);
+          break;
+        }
+        case apitrace::Op::TERM_STRING:
+        {
+          std::u32string s;
+          for (uint64_t i = 0, n = readUnsigned(); i < n; ++i)
+          {
+            s.push_back(static_cast<char32_t>(readUnsigned()));
+          }
+          res = d_tm.mkString(s);
+          break;
+        }
+        case apitrace::Op::TERM_ROUNDINGMODE:
+          res = d_tm.mkRoundingMode(static_cast<RoundingMode>(readUnsigned()));
+          break;
+        case apitrace::Op::TERM_FLOATINGPOINT:
+        {
+          uint64_t exp = readUnsigned();
+          uint64_t sig = readUnsigned();
+          Term bv = readTerm();
+          res = d_tm.mkFloatingPoint(exp, sig, bv);
+          break;
+        }
+        case apitrace::Op::TERM_FINITE_FIELD:
+        {
+          Sort sort = readSort();
+          std::string value = readString();
+          res = d_tm.mkFiniteFieldElem(value, sort);
+          break;
+        }
+        case apitrace::Op::TERM_CONST_ARRAY:
+        {
+          Sort sort = readSort();
+          Term base = readTerm();
+          res = d_tm.mkConstArray(sort, base);
+          break;
+        }
+        case apitrace::Op::TERM_NULLARY:
+        {
+          Kind kind = static_cast<Kind>(readUnsigned());
+          Sort sort = readSort();
+          switch (kind)
+          {
+            case Kind::SET_EMPTY: res = d_tm.mkEmptySet(sort); break;
+            case Kind::SET_UNIVERSE: res = d_tm.mkUniverseSet(sort); break;
+            case Kind::BAG_EMPTY: res = d_tm.mkEmptyBag(sort); break;
+            case Kind::SEP_NIL: res = d_tm.mkSepNil(sort); break;
+            case Kind::CONST_SEQUENCE:
+              res = d_tm.mkEmptySequence(sort.getSequenceElementSort());
+              break;
+            default: throw MalformedTrace("unexpected nullary term kind");
+          }
+          break;
+        }
+        case apitrace::Op::TERM_APP:
+        {
+          Kind kind = static_cast<Kind>(readUnsigned());
+          std::vector<uint32_t> indices;
+          for (uint64_t i = 0, n = readUnsigned(); i < n; ++i)
+          {
+            indices.push_back(static_cast<uint32_t>(readUnsigned()));
+          }
+          std::vector<Term> children = readTerms();
+          res = indices.empty()
+                    ? d_tm.mkTerm(kind, children)
+                    : d_tm.mkTerm(d_tm.mkOp(kind, indices), children);
+          break;
+        }
+        default:
+          error(op, "unsupported term " + readString());
+          break;
+      }
+    }
+    catch (const CVC5ApiException& e)
+    {
+      error(op, e.what());
+    }
+    d_terms.push_back(res);
+  }
+
+  void checkResult()
+  {
+    uint64_t id = readUnsigned();
+    std::string expected = readString();
+    auto it = d_lastResults.find(id);
+    if (it != d_lastResults.end() && it->second != expected)
+    {
+      ++d_numMismatches;
+      std::cerr << "record " << d_numRecords << ": result mismatch, expected "
+                << expected << ", got " << it->second << std::endl;
+    }
+    d_lastResults.erase(id);
+  }
+
+  Solver& getSolver(uint64_t id)
+  {
+    auto it = d_solvers.find(id);
+    if (it == d_solvers.end())
+    {
+      throw MalformedTrace("undefined solver " + std::to_string(id));
+    }
+    return *it->second;
+  }
+
+  void call(apitrace::Op op)
+  {
+    uint64_t id = readUnsigned();
+    if (op == apitrace::Op::NEW_SOLVER)
+    {
+      d_solvers[id] = std::make_unique<Solver>(d_tm);
+      return;
+    }
+    if (op == apitrace::Op::DELETE_SOLVER)
+    {
+      d_solvers.erase(id);
+      return;
+    }
+    Solver& slv = getSolver(id);
+    // read all operands before timing the call
+    std::string s1, s2;
+    std::vector<Term> terms;
+    std::vector<Sort> sorts;
+    Term term;
+    Sort sort;
+    uint64_t u = 0;
+    switch (op)
+    {
+      case apitrace::Op::SET_OPTION:
+      case apitrace::Op::SET_INFO:
+        s1 = readString();
+        s2 = readString();
+        break;
+      case apitrace::Op::SET_LOGIC: s1 = readString(); break;
+      case apitrace::Op::DECLARE_FUN:
+        s1 = readString();
+        sorts = readSorts();
+        sort = readSort();
+        u = readUnsigned();
+        break;
+      case apitrace::Op::DECLARE_SORT:
+        s1 = readString();
+        u = readUnsigned();
+        s2 = readUnsigned() ? "fresh" : "";
+        break;
+      case apitrace::Op::DEFINE_FUN:
+      case apitrace::Op::DEFINE_FUN_REC:
+        s1 = readString();
+        terms = readTerms();
+        sort = readSort();
+        term = readTerm();
+        u = readUnsigned();
+        break;
+      case apitrace::Op::ASSERT_FORMULA: term = readTerm(); break;
+      case apitrace::Op::PUSH:
+      case apitrace::Op::POP:
+      case apitrace::Op::BLOCK_MODEL: u = readUnsigned(); break;
+      case apitrace::Op::SIMPLIFY:
+        term = readTerm();
+        u = readUnsigned();
+        break;
+      case apitrace::Op::CHECK_SAT_ASSUMING:
+      case apitrace::Op::GET_VALUE:
+      case apitrace::Op::BLOCK_MODEL_VALUES: terms = readTerms(); break;
+      default: break;
+    }
+    std::string result;
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+      switch (op)
+      {
+        case apitrace::Op::SET_OPTION:
+          try
+          {
+            slv.setOption(s1, s2);
+          }
+          catch (const CVC5ApiException& e)
+          {
+            // options recorded after solver construction are not
+            // necessarily settable via the API, e.g., driver options
+            std::cerr << "record " << d_numRecords << ": ignoring option "
+                      << s1 << "=" << s2 << ": " << e.what() << std::endl;
+          }
+          break;
+        case apitrace::Op::SET_LOGIC: slv.setLogic(s1); break;
+        case apitrace::Op::SET_INFO: slv.setInfo(s1, s2); break;
+        case apitrace::Op::DECLARE_FUN:
+          term = slv.declareFun(s1, sorts, sort, u != 0);
+          break;
+        case apitrace::Op::DECLARE_SORT:
+          sort = slv.declareSort(s1, u, !s2.empty());
+          break;
+        case apitrace::Op::DEFINE_FUN:
+          term = slv.defineFun(s1, terms, sort, term, u != 0);
+          break;
+        case apitrace::Op::DEFINE_FUN_REC:
+          term = slv.defineFunRec(s1, terms, sort, term, u != 0);
+          break;
+        case apitrace::Op::ASSERT_FORMULA: slv.assertFormula(term); break;
+        case apitrace::Op::PUSH: slv.push(u); break;
+        case apitrace::Op::POP: slv.pop(u); break;
+        case apitrace::Op::RESET_ASSERTIONS: slv.resetAssertions(); break;
+        case apitrace::Op::CHECK_SAT:
+          result = slv.checkSat().toString();
+          break;
+        case apitrace::Op::CHECK_SAT_ASSUMING:
+          result = slv.checkSatAssuming(terms).toString();
+          break;
+        case apitrace::Op::SIMPLIFY: slv.simplify(term, u != 0); break;
+        case apitrace::Op::GET_VALUE: slv.getValue(terms); break;
+        case apitrace::Op::GET_UNSAT_CORE: slv.getUnsatCore(); break;
+        case apitrace::Op::GET_UNSAT_ASSUMPTIONS:
+          slv.getUnsatAssumptions();
+          break;
+        case apitrace::Op::BLOCK_MODEL:
+          slv.blockModel(static_cast<modes::BlockModelsMode>(u));
+          break;
+        case apitrace::Op::BLOCK_MODEL_VALUES:
+          slv.blockModelValues(terms);
+          break;
+        default: throw MalformedTrace("unexpected record");
+      }
+    }
+    catch (const CVC5ApiException& e)
+    {
+      error(op, e.what());
+      term = Term();
+      sort = Sort();
+    }
+    double ms = elapsedMs(start);
+    CallStats& stats = d_stats[static_cast<size_t>(op)];
+    ++stats.d_count;
+    stats.d_ms += ms;
+    if (op == apitrace::Op::DECLARE_FUN || op == apitrace::Op::DEFINE_FUN
+        || op == apitrace::Op::DEFINE_FUN_REC)
+    {
+      d_terms.push_back(term);
+    }
+    else if (op == apitrace::Op::DECLARE_SORT)
+    {
+      d_sorts.push_back(sort);
+    }
+    if (!result.empty())
+    {
+      d_lastResults[id] = result;
+    }
+    if (d_printCalls)
+    {
+      d_out << std::setw(8) << d_numRecords << "  " << std::setw(22)
+            << std::left << apitrace::toString(op) << std::right
+            << std::setw(12) << std::fixed << std::setprecision(3) << ms
+            << " ms";
+      if (!result.empty())
+      {
+        d_out << "  " << result;
+      }
+      d_out << std::endl;
+    }
+  }
+
+  /** The reader of the trace. */
+  apitrace::Reader d_reader;
+  /** The output stream for the timings. */
+  std::ostream& d_out;
+  /** Whether to print the time of each call. */
+  bool d_printCalls;
+  /** The number of records read so far. */
+  size_t d_numRecords;
+  /** The number of failed records. */
+  size_t d_numErrors;
+  /** The number of check-sat calls with a different result. */
+  size_t d_numMismatches;
+  /** The time spent in term and sort definitions. */
+  double d_definitionMs;
+  /** The number of term and sort definitions. */
+  size_t d_numDefinitions;
+  /** The statistics per kind of call. */
+  std::vector<CallStats> d_stats;
+  /** The term manager, must be destroyed after the solvers. */
+  TermManager d_tm;
+  /** The sorts by id. */
+  std::vector<Sort> d_sorts;
+  /** The terms by id. */
+  std::vector<Term> d_terms;
+  /** The solvers by id. */
+  std::map<uint64_t, std::unique_ptr<Solver>> d_solvers;
+  /** The result of the last check-sat call of each solver. */
+  std::map<uint64_t, std::string> d_lastResults;
+};
+
+void printUsage(const char* prog)
+{
+  std::cerr << "usage: " << prog << " [--summary] <trace>" << std::endl
+            << std::endl
+            << "Replays an API trace recorded by a program run with "
+               "CVC5_API_TRACE=<trace>"
+            << std::endl
+            << "and prints the time of each solver call." << std::endl
+            << std::endl
+            << "  --summary  only print the total time per kind of call"
+            << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  bool summaryOnly = false;
+  const char* filename = nullptr;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--summary") == 0)
+    {
+      summaryOnly = true;
+    }
+    else if (argv[i][0] == '-' || filename != nullptr)
+    {
+      printUsage(argv[0]);
+      return 2;
+    }
+    else
+    {
+      filename = argv[i];
+    }
+  }
+  if (filename == nullptr)
+  {
+    printUsage(argv[0]);
+    return 2;
+  }
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+  {
+    std::cerr << "cannot open " << filename << std::endl;
+    return 2;
+  }
+  Replayer replayer(in, std::cout, !summaryOnly);
+  bool ok;
+  try
+  {
+    ok = replayer.run();
+  }
+  catch (const MalformedTrace& e)
+  {
+    std::cerr << filename << ": malformed trace: " << e.what() << std::endl;
+    return 2;
+  }
+  replayer.printSummary();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Gereon Kremer, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The server mode of the cvc5 binary.
+ */
+#include "main/server.h"
+
+#include "base/cvc5config.h"
+
+#if HAVE_SYS_WAIT_H
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <cvc5/cvc5_parser.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include "base/exception.h"
+#include "base/output.h"
+#include "main/command_executor.h"
+#include "main/main.h"
+#include "main/portfolio_driver.h"
+#include "main/time_limit.h"
+
+namespace cvc5::main {
+
+#if HAVE_SYS_WAIT_H
+
+namespace {
+
+/** Read from fd until the end of the input. */
+std::string readAll(int fd)
+{
+  std::string res;
+  char buf[4096];
+  while (true)
+  {
+    ssize_t cnt = read(fd, buf, sizeof(buf));
+    if (cnt == -1)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      throw internal::Exception("Unable to read from connection");
+    }
+    else if (cnt == 0)
+    {
+      break;
+    }
+    res.append(buf, cnt);
+  }
+  return res;
+}
+
+/**
+ * Run the script received over the connection fd, which is called within the
+ * child process serving the connection. Does not return.
+ */
+[[noreturn]] void serveConnection(int fd,
+                                  modes::InputLanguage ilang,
+                                  uint64_t tlimit)
+{
+  int rc = 1;
+  try
+  {
+    std::string script = readAll(fd);
+    // send the standard and error output over the connection
+    while ((dup2(fd, STDOUT_FILENO) == -1) && (errno == EINTR))
+    {
+    }
+    while ((dup2(fd, STDERR_FILENO) == -1) && (errno == EINTR))
+    {
+    }
+    close(fd);
+    auto limit = install_time_limit(tlimit);
+    std::istringstream in(script);
+    std::unique_ptr<parser::InputParser> parser(new parser::InputParser(
+        pExecutor->getSolver(), pExecutor->getSymbolManager()));
+    parser->setStreamInput(ilang, in, "<socket>");
+    PortfolioDriver driver(parser);
+    rc = driver.solve(pExecutor) ? 0 : 1;
+    pExecutor->flushOutputStreams();
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "(error \"" << e.what() << "\")" << std::endl;
+  }
+  std::cout << std::flush;
+  std::cerr << std::flush;
+  // do not run the destructors, which are run by the server
+  _exit(rc);
+}
+
+}  // namespace
+
+int runServer(const std::string& path,
+              uint64_t jobs,
+              modes::InputLanguage ilang,
+              uint64_t tlimit)
+{
+  sockaddr_un addr;
+  if (path.size() >= sizeof(addr.sun_path))
+  {
+    throw internal::Exception("Socket path is too long: " + path);
+  }
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock == -1)
+  {
+    throw internal::Exception("Unable to create socket");
+  }
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+  // remove a stale socket of a previous server
+  unlink(path.c_str());
+  if (bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1
+      || listen(sock, SOMAXCONN) == -1)
+  {
+    close(sock);
+    throw internal::Exception("Unable to listen on socket " + path);
+  }
+  uint64_t running = 0;
+  while (true)
+  {
+    // reap the children that have terminated
+    while (running > 0 && waitpid(-1, nullptr, WNOHANG) > 0)
+    {
+      --running;
+    }
+    // wait until we can run another script
+    while (running >= jobs && running > 0)
+    {
+      if (waitpid(-1, nullptr, 0) > 0)
+      {
+        --running;
+      }
+      else if (errno != EINTR)
+      {
+        running = 0;
+      }
+    }
+    int conn = accept(sock, nullptr, nullptr);
+    if (conn == -1)
+    {
+      if (errno == EINTR || errno == ECONNABORTED)
+      {
+        continue;
+      }
+      close(sock);
+      throw internal::Exception("Unable to accept connection");
+    }
+    pid_t child = fork();
+    if (child == -1)
+    {
+      close(conn);
+      close(sock);
+      throw internal::Exception("Unable to fork");
+    }
+    if (child == 0)
+    {
+      close(sock);
+      serveConnection(conn, ilang, tlimit);
+    }
+    Trace("server") << "Serving connection in process " << child << std::endl;
+    close(conn);
+    ++running;
+  }
+  return 1;
+}
+
+#else
+
+int runServer(const std::string& path,
+              uint64_t jobs,
+              modes::InputLanguage ilang,
+              uint64_t tlimit)
+{
+  throw internal::Exception("Can't run server mode without <sys/wait.h>.");
+  return 1;
+}
+
+#endif
+
+}  // namespace cvc5::main
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Gereon Kremer, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The server mode of the cvc5 binary.
+ */
+
+#ifndef CVC5__MAIN__SERVER_H
+#define CVC5__MAIN__SERVER_H
+
+#include <cvc5/cvc5_types.h>
+
+#include <cstdint>
+#include <string>
+
+namespace cvc5::main {
+
+/**
+ * Runs the server mode of the binary, which listens on the Unix domain socket
+ * at the given path and serves one script per connection. A client sends the
+ * script and then shuts down the writing side of its connection. The script is
+ * run by a child process forked from the server, which thus starts from the
+ * solver of pExecutor as configured by the command line, and its standard and
+ * error output are sent back over the connection, which is closed when the
+ * script is done.
+ *
+ * Forking avoids the startup cost of the binary for each script, while every
+ * script is run in isolation. The time limit applies to each script.
+ *
+ * @param path The path of the socket.
+ * @param jobs The maximum number of scripts that are run in parallel.
+ * @param ilang The input language of the scripts.
+ * @param tlimit The time limit in milliseconds of each script, or 0.
+ * @return The exit code of the binary, which is only returned on errors.
+ */
+int runServer(const std::string& path,
+              uint64_t jobs,
+              modes::InputLanguage ilang,
+              uint64_t tlimit);
+
+}  // namespace cvc5::main
+
+#endif /* CVC5__MAIN__SERVER_H */
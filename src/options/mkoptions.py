@@ -274,6 +274,12 @@ def generate_holder_mem_copy(modules):
     return concat_format('      *d_{id} = *options.d_{id};', modules)
 
 
+def generate_holder_mem_equal(modules):
+    """Render comparison of holder members of the Option class"""
+    return concat_format('*d_{id} == *options.d_{id}', modules,
+                         '\n        && ')
+
+
 ################################################################################
 # for options/options_public.cpp
 
@@ -515,6 +521,18 @@ def generate_module_holder_decl(module):
         res.append('bool {}WasSetByUser = false;'.format(option.name))
     return '\n  '.join(res)
 
+def generate_module_holder_equal(module):
+    res = []
+    for option in module.options:
+        if option.name is None:
+            continue
+        res.append('{0} == other.{0}'.format(option.name))
+        res.append('{0}WasSetByUser == other.{0}WasSetByUser'.format(
+            option.name))
+    if not res:
+        return 'true'
+    return '\n      && '.join(res)
+
 def generate_module_long_name_decl(module):
     res = []
     for option in module.options:
@@ -968,6 +986,7 @@ def codegen_module(module, dst_dir, tpls):
         'includes': generate_module_includes(module),
         'modes_decl': generate_module_mode_decl(module),
         'holder_decl': generate_module_holder_decl(module),
+        'holder_equal': generate_module_holder_equal(module),
         'long_name_decl': generate_module_long_name_decl(module),
         # module source
         'header': module.header,
@@ -1011,6 +1030,7 @@ def codegen_all_modules(modules, src_dir, build_dir, dst_dir, tpls):
         'holder_ref_inits': generate_holder_ref_inits(modules),
         'write_functions': generate_write_functions(modules),
         'holder_mem_copy': generate_holder_mem_copy(modules),
+        'holder_mem_equal': generate_holder_mem_equal(modules),
         # options/options_public.cpp
         'options_includes': generate_public_includes(modules),
         'getnames_impl': generate_getnames_impl(modules),
@@ -28,4 +28,11 @@ namespace cvc5::internal::options {
 ${modes_impl}$
 // clang-format on
 
+bool Holder${id_cap}$::operator==(const Holder${id_cap}$& other) const
+{
+  // clang-format off
+  return ${holder_equal}$;
+  // clang-format on
+}
+
 }  // namespace cvc5::internal::options
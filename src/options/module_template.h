@@ -50,6 +50,8 @@ struct Holder${id_cap}$
 // clang-format off
   ${holder_decl}$
 // clang-format on
+  /** Do all options and whether they were set by the user equal other? */
+  bool operator==(const Holder${id_cap}$& other) const;
 };
 
 #undef DO_SEMANTIC_CHECKS_BY_DEFAULT
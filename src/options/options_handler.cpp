@@ -201,6 +201,11 @@ void OptionsHandler::setStats(const std::string& flag, bool value)
     d_options->write_base().statisticsAll = false;
     d_options->write_base().statisticsEveryQuery = false;
     d_options->write_base().statisticsInternal = false;
+    d_options->write_base().statisticsMemory = false;
+    d_options->write_base().statisticsContext = false;
+    d_options->write_base().statisticsPreprocess = false;
+    d_options->write_base().statisticsRewrite = false;
+    d_options->write_base().statisticsProofMemory = false;
   }
 }
 
@@ -222,6 +227,20 @@ void OptionsHandler::setStatsDetail(const std::string& flag, bool value)
   }
 }
 
+void OptionsHandler::setStatsEvery(const std::string& flag, uint64_t value)
+{
+#ifndef CVC5_STATISTICS_ON
+  if (value > 0)
+  {
+    std::stringstream ss;
+    ss << "option `" << flag
+       << "' requires a statistics-enabled build of cvc5; this binary was not "
+          "built with statistics support";
+    throw OptionException(ss.str());
+  }
+#endif /* CVC5_STATISTICS_ON */
+}
+
 void OptionsHandler::enableTraceTag(const std::string& flag,
                                     const std::string& optarg)
 {
@@ -89,6 +89,8 @@ class OptionsHandler
   void setStats(const std::string& flag, bool value);
   /** If statistics sub-option is disabled, enable statistics */
   void setStatsDetail(const std::string& flag, bool value);
+  /** Check that periodic statistics snapshots are supported */
+  void setStatsEvery(const std::string& flag, uint64_t value);
   /** Enable a particular trace tag */
   void enableTraceTag(const std::string& flag, const std::string& optarg);
   /** Enable a particular output tag */
@@ -57,5 +57,12 @@ ${holder_mem_copy}$
     }
   }
 
+  bool Options::hasEqualValues(const Options& options) const
+  {
+    // clang-format off
+    return ${holder_mem_equal}$;
+    // clang-format on
+  }
+
 }  // namespace cvc5::internal
 
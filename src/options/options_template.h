@@ -63,6 +63,12 @@ class CVC5_EXPORT Options
    */
   void copyValues(const Options& options);
 
+  /**
+   * Whether the values of all options, and whether they were set by the user,
+   * are equal to those of the given Options object.
+   */
+  bool hasEqualValues(const Options& options) const;
+
  private:
 
 // clang-format off
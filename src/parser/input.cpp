@@ -17,17 +17,57 @@
 
 #include <fstream>
 
+#include "base/cvc5config.h"
 #include <cvc5/cvc5_parser.h>
 
+#if HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace cvc5 {
 namespace parser {
 
-/** File input class */
+/**
+ * File input class. Regular files are memory-mapped where supported, which
+ * avoids copying their contents into the buffer of the lexer. Otherwise, or
+ * if mapping fails, the file is read via a file stream.
+ */
 class FileInput : public Input
 {
  public:
-  FileInput(const std::string& filename) : Input()
+  FileInput(const std::string& filename)
+      : Input(), d_data(nullptr), d_size(0)
   {
+#if HAVE_SYS_MMAN_H
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+      struct stat st;
+      if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+      {
+        void* data = mmap(nullptr,
+                          static_cast<size_t>(st.st_size),
+                          PROT_READ,
+                          MAP_PRIVATE,
+                          fd,
+                          0);
+        if (data != MAP_FAILED)
+        {
+          madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+          d_data = static_cast<const char*>(data);
+          d_size = static_cast<size_t>(st.st_size);
+        }
+      }
+      close(fd);
+      if (d_data != nullptr)
+      {
+        return;
+      }
+    }
+#endif
     d_fs.open(filename, std::fstream::in);
     if (!d_fs.is_open())
     {
@@ -36,11 +76,34 @@ class FileInput : public Input
       throw ParserException(ss.str());
     }
   }
+  ~FileInput()
+  {
+#if HAVE_SYS_MMAN_H
+    if (d_data != nullptr)
+    {
+      munmap(const_cast<char*>(d_data), d_size);
+    }
+#endif
+  }
   std::istream* getStream() override { return &d_fs; }
+  bool getBuffer(const char*& data, size_t& size) override
+  {
+    if (d_data == nullptr)
+    {
+      return false;
+    }
+    data = d_data;
+    size = d_size;
+    return true;
+  }
 
  private:
-  /** File stream */
+  /** File stream, if the file is not mapped */
   std::ifstream d_fs;
+  /** The mapped contents of the file, or null if it is not mapped */
+  const char* d_data;
+  /** The size of d_data */
+  size_t d_size;
 };
 
 /** Stream reference input class */
@@ -86,5 +149,7 @@ std::unique_ptr<Input> Input::mkStringInput(const std::string& input)
 }
 bool Input::isInteractive() const { return false; }
 
+bool Input::getBuffer(const char*&, size_t&) { return false; }
+
 }  // namespace parser
 }  // namespace cvc5
@@ -28,7 +28,10 @@ namespace parser {
 /**
  * Wrapper to setup the necessary information for constructing a flex Lexer.
  *
- * Currently this is std::istream& obtainable via getStream.
+ * Currently this is std::istream& obtainable via getStream. Inputs whose
+ * contents are available in memory, such as memory-mapped files, may
+ * additionally provide them via getBuffer, which the lexer reads from
+ * directly.
  */
 class Input
 {
@@ -61,6 +64,15 @@ class Input
    * it character-by-character.
    */
   virtual bool isInteractive() const;
+  /**
+   * Get the contents of this input as a contiguous buffer, if available.
+   *
+   * @param data Set to the first character of the contents.
+   * @param size Set to the number of characters of the contents.
+   * @return true if the contents are available, in which case they remain
+   * valid for the lifetime of this input and getStream should not be used.
+   */
+  virtual bool getBuffer(const char*& data, size_t& size);
 };
 
 }  // namespace parser
@@ -35,7 +35,14 @@ std::ostream& operator<<(std::ostream& o, const Span& l)
 }
 
 Lexer::Lexer()
-    : d_bufferPos(0), d_bufferEnd(0), d_peekedChar(false), d_chPeeked(0)
+    : d_istream(nullptr),
+      d_isInteractive(false),
+      d_isMapped(false),
+      d_data(d_buffer),
+      d_bufferPos(0),
+      d_bufferEnd(0),
+      d_peekedChar(false),
+      d_chPeeked(0)
 {
 }
 
@@ -70,13 +77,26 @@ void Lexer::initSpan()
 void Lexer::initialize(Input* input, const std::string& inputName)
 {
   Assert(input != nullptr);
-  d_istream = input->getStream();
   d_isInteractive = input->isInteractive();
   d_inputName = inputName;
   initSpan();
   d_peeked.clear();
   d_bufferPos = 0;
   d_bufferEnd = 0;
+  const char* data;
+  size_t size;
+  d_isMapped = input->getBuffer(data, size);
+  if (d_isMapped)
+  {
+    d_istream = nullptr;
+    d_data = data;
+    d_bufferEnd = size;
+  }
+  else
+  {
+    d_istream = input->getStream();
+    d_data = d_buffer;
+  }
   d_peekedChar = false;
   d_chPeeked = 0;
 }
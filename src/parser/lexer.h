@@ -18,6 +18,7 @@
 #ifndef CVC5__PARSER__LEXER_H
 #define CVC5__PARSER__LEXER_H
 
+#include <array>
 #include <fstream>
 #include <iosfwd>
 #include <string>
@@ -98,9 +99,13 @@ class Lexer
   {
     if (d_bufferPos < d_bufferEnd)
     {
-      d_ch = d_buffer[d_bufferPos];
+      d_ch = d_data[d_bufferPos];
       d_bufferPos++;
     }
+    else if (d_isMapped)
+    {
+      d_ch = EOF;
+    }
     else if (d_isInteractive)
     {
       d_ch = d_istream->get();
@@ -146,6 +151,62 @@ class Lexer
     }
     return res;
   }
+  /**
+   * Consume the longest sequence of characters starting at the current
+   * position in the buffer whose entry in classes has a bit of mask set, and
+   * append them to tok if it is non-null. This is a fast path for scanning
+   * runs of characters of the same kind, which avoids calling nextChar for
+   * each character.
+   *
+   * This stops at the end of the current buffer and does nothing if a
+   * character was saved, hence callers must check the next character with
+   * nextChar afterwards.
+   */
+  void scanChars(const std::array<uint8_t, 256>& classes,
+                 uint8_t mask,
+                 std::vector<char>* tok)
+  {
+    if (d_peekedChar)
+    {
+      return;
+    }
+    const char* begin = d_data + d_bufferPos;
+    const char* end = d_data + d_bufferEnd;
+    const char* p = begin;
+    if (classes['\n'] & mask)
+    {
+      // we may consume newlines, which requires updating the line
+      uint32_t line = d_span.d_end.d_line;
+      uint32_t column = d_span.d_end.d_column;
+      for (; p < end && (classes[static_cast<uint8_t>(*p)] & mask); ++p)
+      {
+        if (*p == '\n')
+        {
+          line++;
+          column = 0;
+        }
+        else
+        {
+          column++;
+        }
+      }
+      d_span.d_end.d_line = line;
+      d_span.d_end.d_column = column;
+    }
+    else
+    {
+      while (p < end && (classes[static_cast<uint8_t>(*p)] & mask))
+      {
+        ++p;
+      }
+      d_span.d_end.d_column += static_cast<uint32_t>(p - begin);
+    }
+    if (tok != nullptr)
+    {
+      tok->insert(tok->end(), begin, p);
+    }
+    d_bufferPos += static_cast<size_t>(p - begin);
+  }
   /** Save character */
   void saveChar(int32_t ch)
   {
@@ -185,7 +246,14 @@ class Lexer
   std::istream* d_istream;
   /** True if the input stream is interactive */
   bool d_isInteractive;
-  /** The current buffer */
+  /**
+   * True if we read from the contents of the input directly (see
+   * Input::getBuffer), in which case d_data is the entire input.
+   */
+  bool d_isMapped;
+  /** The current buffer, pointing to d_buffer if d_isMapped is false */
+  const char* d_data;
+  /** The buffer in which we read from the input stream */
   char d_buffer[INPUT_BUFFER_SIZE];
   /** The position in the current buffer we are reading from */
   size_t d_bufferPos;
@@ -107,7 +107,7 @@ Token Smt2CmdParser::nextCommandToken()
   if (tok == Token::SYMBOL)
   {
     std::string str(d_lex.tokenStr());
-    std::map<std::string, Token>::iterator it = d_table.find(str);
+    std::unordered_map<std::string, Token>::iterator it = d_table.find(str);
     if (it != d_table.end())
     {
       return it->second;
@@ -18,6 +18,8 @@
 #ifndef CVC5__PARSER__SMT2_CMD_PARSER_H
 #define CVC5__PARSER__SMT2_CMD_PARSER_H
 
+#include <unordered_map>
+
 #include "parser/smt2/smt2_state.h"
 #include "parser/smt2/smt2_lexer.h"
 #include "parser/smt2/smt2_term_parser.h"
@@ -50,8 +52,8 @@ class Smt2CmdParser
   Smt2State& d_state;
   /** The term parser */
   Smt2TermParser& d_tparser;
-  /** Map strings to tokens */
-  std::map<std::string, Token> d_table;
+  /** Map strings to tokens, looked up once per command */
+  std::unordered_map<std::string, Token> d_table;
 };
 
 }  // namespace parser
@@ -69,6 +69,14 @@ Smt2Lexer::Smt2Lexer(bool isStrict, bool isSygus)
   d_charClass['\t'] |= static_cast<uint32_t>(CharacterClass::WHITESPACE);
   d_charClass['\r'] |= static_cast<uint32_t>(CharacterClass::WHITESPACE);
   d_charClass['\n'] |= static_cast<uint32_t>(CharacterClass::WHITESPACE);
+  // the characters that may occur in string literals without ending them
+  for (int32_t ch : s_printableAsciiChars)
+  {
+    if (ch != '"')
+    {
+      d_charClass[ch] |= static_cast<uint32_t>(CharacterClass::STRING);
+    }
+  }
 }
 
 const char* Smt2Lexer::tokenStr() const
@@ -100,6 +108,9 @@ Token Smt2Lexer::computeNextToken()
   {
     do
     {
+      scanChars(d_charClass,
+                static_cast<uint8_t>(CharacterClass::WHITESPACE),
+                nullptr);
       if ((ch = nextChar()) == EOF)
       {
         return Token::EOF_TOK;
@@ -180,6 +191,8 @@ Token Smt2Lexer::computeNextToken()
     case '"':
       for (;;)
       {
+        scanChars(
+            d_charClass, static_cast<uint8_t>(CharacterClass::STRING), &d_token);
         ch = nextChar();
         if (ch == EOF)
         {
@@ -304,6 +317,8 @@ void Smt2Lexer::parseCharList(CharacterClass cc)
   int32_t ch;
   for (;;)
   {
+    // consume the characters available in the buffer at once
+    scanChars(d_charClass, static_cast<uint8_t>(cc), &d_token);
     ch = nextChar();
     if (!isCharacterClass(ch, cc))
     {
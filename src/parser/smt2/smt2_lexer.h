@@ -76,6 +76,7 @@ class Smt2Lexer : public Lexer
     SYMBOL_START = (1 << 4),
     SYMBOL = (1 << 5),
     PRINTABLE = (1 << 6),
+    STRING = (1 << 7),
   };
   /** The set of non-letter/non-digit characters that may occur in keywords. */
   inline static const std::string s_extraSymbolChars = "+-/*=%?!.$_~&^<>@";
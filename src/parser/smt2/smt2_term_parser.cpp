@@ -110,6 +110,11 @@ Term Smt2TermParser::parseTerm()
   std::vector<std::pair<ParseOp, std::vector<Term>>> tstack;
   // Let bindings, dynamically allocated for each let in scope.
   std::vector<std::vector<std::pair<std::string, Term>>> letBinders;
+  // For each let in scope, whether it is the body of the let before it. Such
+  // lets are common in generated benchmarks (let (...) (let (...) ...)). They
+  // end together with the let before it, hence they bind their symbols in its
+  // scope instead of pushing and popping a scope of their own.
+  std::vector<bool> letSharesScope;
   Solver* slv = d_state.getSolver();
   TermManager& tm = slv->getTermManager();
   do
@@ -178,6 +183,8 @@ Term Smt2TermParser::parseTerm()
           break;
           case Token::LET_TOK:
           {
+            letSharesScope.push_back(!xstack.empty()
+                                     && xstack.back() == ParseCtx::LET_BODY);
             xstack.emplace_back(ParseCtx::LET_NEXT_BIND);
             tstack.emplace_back(ParseOp(), std::vector<Term>());
             needsUpdateCtx = true;
@@ -380,8 +387,12 @@ Term Smt2TermParser::parseTerm()
           {
             // ), we are now looking for the body of the let
             xstack[xstack.size() - 1] = ParseCtx::LET_BODY;
-            // push scope
-            d_state.pushScope();
+            // push scope, unless we share the scope of the let before us
+            Assert(!letSharesScope.empty());
+            if (!letSharesScope.back())
+            {
+              d_state.pushScope();
+            }
             // implement the bindings
             Assert(!letBinders.empty());
             const std::vector<std::pair<std::string, Term>>& bs =
@@ -399,8 +410,12 @@ Term Smt2TermParser::parseTerm()
           d_lex.eatToken(Token::RPAREN_TOK);
           xstack.pop_back();
           tstack.pop_back();
-          // pop scope
-          d_state.popScope();
+          // pop scope, if we pushed one
+          if (!letSharesScope.back())
+          {
+            d_state.popScope();
+          }
+          letSharesScope.pop_back();
           // Done with the binders now. We clear this only at this point since
           // the let binders may to pertinent to avoid illegal substitutions
           // from lets.
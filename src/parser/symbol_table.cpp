@@ -173,7 +173,9 @@ class OverloadedTypeTrie
 
 bool OverloadedTypeTrie::isOverloadedFunction(Term fun) const
 {
-  return d_overloaded_symbols->find(fun) != d_overloaded_symbols->end();
+  // most inputs do not overload symbols, in which case we avoid hashing fun
+  return !d_overloaded_symbols->empty()
+         && d_overloaded_symbols->find(fun) != d_overloaded_symbols->end();
 }
 
 Term OverloadedTypeTrie::getOverloadedConstantForType(const std::string& name,
@@ -454,7 +456,7 @@ Term SymbolTable::Implementation::lookup(const string& name) const
   {
     return d_nullTerm;
   }
-  Term expr = it->second;
+  const Term& expr = (*it).second;
   if (isOverloadedFunction(expr))
   {
     return d_nullTerm;
@@ -499,7 +501,7 @@ Sort SymbolTable::Implementation::lookupType(const string& name) const
   {
     return d_nullSort;
   }
-  std::pair<std::vector<Sort>, Sort> p = it->second;
+  const std::pair<std::vector<Sort>, Sort>& p = (*it).second;
   if (p.first.size() != 0)
   {
     std::stringstream ss;
@@ -518,7 +520,7 @@ Sort SymbolTable::Implementation::lookupType(const string& name,
   {
     return d_nullSort;
   }
-  std::pair<std::vector<Sort>, Sort> p = it->second;
+  const std::pair<std::vector<Sort>, Sort>& p = (*it).second;
   if (p.first.size() != params.size())
   {
     std::stringstream ss;
@@ -567,8 +569,7 @@ Sort SymbolTable::Implementation::lookupType(const string& name,
 
 size_t SymbolTable::Implementation::lookupArity(const string& name)
 {
-  std::pair<std::vector<Sort>, Sort> p = (*d_typeMap.find(name)).second;
-  return p.first.size();
+  return (*d_typeMap.find(name)).second.first.size();
 }
 
 void SymbolTable::Implementation::popScope()
@@ -24,6 +24,7 @@
 
 #include "preprocessing/passes/ackermann.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "base/check.h"
@@ -32,6 +33,7 @@
 #include "smt/logic_exception.h"
 #include "options/base_options.h"
 #include "options/options.h"
+#include "options/smt_options.h"
 #include "preprocessing/assertion_pipeline.h"
 #include "preprocessing/preprocessing_pass_context.h"
 
@@ -92,9 +94,35 @@ void addLemmaForPair(TNode args1,
       lemma, false, nullptr, TrustId::PREPROCESS_ACKERMANN_LEMMA);
 }
 
+/* Return true if all arguments of the application term are constants. */
+bool hasConstantArgs(TNode term)
+{
+  return std::all_of(
+      term.begin(), term.end(), [](TNode arg) { return arg.isConst(); });
+}
+
+/* Return true if the applications term1 and term2 of the same function have
+ * distinct constant arguments at some position, in which case they are
+ * trivially consistent. */
+bool hasDistinctConstantArgs(TNode term1, TNode term2)
+{
+  Assert(term1.getNumChildren() == term2.getNumChildren());
+  for (size_t i = 0, n = term1.getNumChildren(); i < n; ++i)
+  {
+    if (term1[i].isConst() && term2[i].isConst() && term1[i] != term2[i]
+        && term1[i].getType() == term2[i].getType())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 void storeFunctionAndAddLemmas(TNode func,
                                TNode term,
                                FunctionToArgsMap& fun_to_args,
+                               FunctionToTermsMap& fun_to_non_ground,
+                               bool prune,
                                SubstitutionMap& fun_to_skolem,
                                AssertionPipeline* assertions,
                                NodeManager* nm,
@@ -109,9 +137,41 @@ void storeFunctionAndAddLemmas(TNode func,
   {
     SkolemManager* sm = nm->getSkolemManager();
     Node skolem = sm->mkPurifySkolem(term);
-    for (const auto& t : set)
+    if (!prune)
+    {
+      for (const auto& t : set)
+      {
+        addLemmaForPair(t, term, func, assertions, nm);
+      }
+    }
+    else
     {
-      addLemmaForPair(t, term, func, assertions, nm);
+      // Two distinct applications to constants only are always trivially
+      // consistent, hence term only needs to be paired with the applications
+      // having non-constant arguments if it has constant arguments only.
+      std::vector<TNode>& nonGround = fun_to_non_ground[func];
+      bool ground = hasConstantArgs(term);
+      if (ground)
+      {
+        for (TNode t : nonGround)
+        {
+          if (!hasDistinctConstantArgs(t, term))
+          {
+            addLemmaForPair(t, term, func, assertions, nm);
+          }
+        }
+      }
+      else
+      {
+        for (const auto& t : set)
+        {
+          if (!hasDistinctConstantArgs(t, term))
+          {
+            addLemmaForPair(t, term, func, assertions, nm);
+          }
+        }
+        nonGround.push_back(term);
+      }
     }
     fun_to_skolem.addSubstitution(term, skolem);
     set.insert(term);
@@ -148,6 +208,8 @@ void storeFunctionAndAddLemmas(TNode func,
  * Now that we see g(x) and g(y), we explicitly add them as well. */
 void collectFunctionsAndLemmas(NodeManager* nm,
                                FunctionToArgsMap& fun_to_args,
+                               FunctionToTermsMap& fun_to_non_ground,
+                               bool prune,
                                SubstitutionMap& fun_to_skolem,
                                std::vector<TNode>* vec,
                                AssertionPipeline* assertions)
@@ -166,6 +228,8 @@ void collectFunctionsAndLemmas(NodeManager* nm,
         storeFunctionAndAddLemmas(term.getOperator(),
                                   term,
                                   fun_to_args,
+                                  fun_to_non_ground,
+                                  prune,
                                   fun_to_skolem,
                                   assertions,
                                   nm,
@@ -317,6 +381,8 @@ PreprocessingPassResult Ackermann::applyInternal(
   }
   collectFunctionsAndLemmas(nodeManager(),
                             d_funcToArgs,
+                            d_funcToNonGround,
+                            options().smt.ackermannPrune,
                             d_funcToSkolem,
                             &to_process,
                             assertionsToPreprocess);
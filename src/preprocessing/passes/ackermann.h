@@ -28,6 +28,7 @@
 #define CVC5__PREPROCESSING__PASSES__ACKERMANN_H
 
 #include <unordered_map>
+#include <vector>
 
 #include "expr/node.h"
 #include "preprocessing/preprocessing_pass.h"
@@ -40,6 +41,7 @@ namespace passes {
 
 using TNodeSet = std::unordered_set<TNode>;
 using FunctionToArgsMap = std::unordered_map<TNode, TNodeSet>;
+using FunctionToTermsMap = std::unordered_map<TNode, std::vector<TNode>>;
 using USortToBVSizeMap = std::unordered_map<TypeNode, size_t>;
 
 class Ackermann : public PreprocessingPass
@@ -57,6 +59,9 @@ class Ackermann : public PreprocessingPass
    * - For each f(X) and f(Y) with X = (x1, . . . , xn) and Y = (y1, . . . , yn)
    *   occurring in the input formula, add the following lemma:
    *     (x_1 = y_1 /\ ... /\ x_n = y_n) => f_X = f_Y
+   *   With --ackermann-prune, the lemma is omitted if x_i and y_i are distinct
+   *   constants for some i, since it is then trivially satisfied. In
+   *   particular, no pair of applications to constants only is considered.
    *
    * - For each uninterpreted sort S, suppose k is the number of variables with
    *   sort S, then for each such variable X, introduce a fresh variable BV_X
@@ -68,6 +73,11 @@ class Ackermann : public PreprocessingPass
  private:
   /* Map each function to a set of terms associated with it */
   FunctionToArgsMap d_funcToArgs;
+  /*
+   * Map each function to its terms in d_funcToArgs that have non-constant
+   * arguments, only used with --ackermann-prune.
+   */
+  FunctionToTermsMap d_funcToNonGround;
   /* Map each function-application term to the new Skolem variable created by
    * ackermannization */
   theory::SubstitutionMap d_funcToSkolem;
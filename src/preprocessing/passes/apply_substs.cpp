@@ -29,7 +29,10 @@ namespace preprocessing {
 namespace passes {
 
 ApplySubsts::ApplySubsts(PreprocessingPassContext* preprocContext)
-    : PreprocessingPass(preprocContext, "apply-substs")
+    : PreprocessingPass(preprocContext, "apply-substs"),
+      d_numChanges(0),
+      d_numSkipped(
+          statisticsRegistry().registerInt("ApplySubsts::numSkipped"))
 {
 }
 
@@ -44,6 +47,12 @@ PreprocessingPassResult ApplySubsts::applyInternal(
 
   theory::TrustSubstitutionMap& tlsm =
       d_preprocContext->getTopLevelSubstitutions();
+  size_t numChanges = tlsm.get().getNumChanges();
+  if (numChanges != d_numChanges)
+  {
+    d_processed.clear();
+    d_numChanges = numChanges;
+  }
   unsigned size = assertionsToPreprocess->size();
   for (unsigned i = 0; i < size; ++i)
   {
@@ -51,6 +60,11 @@ PreprocessingPassResult ApplySubsts::applyInternal(
     {
       continue;
     }
+    if (d_processed.find((*assertionsToPreprocess)[i]) != d_processed.end())
+    {
+      ++d_numSkipped;
+      continue;
+    }
     Trace("apply-substs") << "applying to " << (*assertionsToPreprocess)[i]
                           << std::endl;
     d_preprocContext->spendResource(Resource::PreprocessStep);
@@ -64,6 +78,7 @@ PreprocessingPassResult ApplySubsts::applyInternal(
     {
       return PreprocessingPassResult::CONFLICT;
     }
+    d_processed.insert((*assertionsToPreprocess)[i]);
   }
   return PreprocessingPassResult::NO_CONFLICT;
 }
@@ -21,6 +21,9 @@
 #ifndef CVC5__PREPROCESSING__PASSES__APPLY_SUBSTS_H
 #define CVC5__PREPROCESSING__PASSES__APPLY_SUBSTS_H
 
+#include <unordered_set>
+
+#include "expr/node.h"
 #include "preprocessing/preprocessing_pass.h"
 
 namespace cvc5::internal {
@@ -43,6 +46,20 @@ class ApplySubsts : public PreprocessingPass
    */
   PreprocessingPassResult applyInternal(
       AssertionPipeline* assertionsToPreprocess) override;
+
+ private:
+  /**
+   * The assertions computed by this pass, which are unchanged by applying
+   * the top-level substitutions and rewriting, as long as the top-level
+   * substitutions have d_numChanges changes. This pass is applied multiple
+   * times during preprocessing, and this allows us to skip assertions that
+   * were not modified by the passes in between.
+   */
+  std::unordered_set<Node> d_processed;
+  /** The number of changes of the top-level substitutions for d_processed */
+  size_t d_numChanges;
+  /** The number of assertions skipped due to d_processed */
+  IntStat d_numSkipped;
 };
 
 }  // namespace passes
@@ -18,6 +18,7 @@
 
 #include "preprocessing/passes/bv_gauss.h"
 
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -243,6 +244,31 @@ uint32_t BVGauss::getMinBwExpr(Node expr)
  * form) is stored in 'rhs' and 'lhs', i.e., the given matrix is overwritten
  * with the resulting matrix.
  */
+namespace {
+
+/**
+ * Set a to (a - b * mul) modulo prime. The rows of the equation systems are
+ * typically sparse, hence we avoid the multiplication if b is zero and only
+ * normalize a, which is then equivalent.
+ */
+void subtractModPrime(Integer& a,
+                      const Integer& b,
+                      const Integer& mul,
+                      const Integer& prime)
+{
+  if (b.isZero())
+  {
+    if (a.sgn() < 0 || a >= prime)
+    {
+      a = a.euclidianDivideRemainder(prime);
+    }
+    return;
+  }
+  a = a.modAdd(-b * mul, prime);
+}
+
+}  // namespace
+
 BVGauss::Result BVGauss::gaussElim(Integer prime,
                                    std::vector<Integer>& rhs,
                                    std::vector<std::vector<Integer>>& lhs)
@@ -261,6 +287,11 @@ BVGauss::Result BVGauss::gaussElim(Integer prime,
     return BVGauss::Result::UNIQUE;
   }
 
+  if (prime == 2)
+  {
+    return gaussElimGF2(rhs, lhs);
+  }
+
   size_t nrows = lhs.size();
   size_t ncols = lhs[0].size();
 
@@ -330,9 +361,12 @@ BVGauss::Result BVGauss::gaussElim(Integer prime,
           }
           for (size_t k = pcol; k < ncols; ++k)
           {
-            lhs[j][k] = lhs[j][k].modMultiply(inv, prime);
+            if (!lhs[j][k].isZero())
+            {
+              lhs[j][k] = lhs[j][k].modMultiply(inv, prime);
+            }
             if (j <= prow) continue; /* pivot */
-            lhs[j][k] = lhs[j][k].modAdd(-lhs[prow][k], prime);
+            subtractModPrime(lhs[j][k], lhs[prow][k], Integer(1), prime);
           }
           rhs[j] = rhs[j].modMultiply(inv, prime);
           if (j > prow) { rhs[j] = rhs[j].modAdd(-rhs[prow], prime); }
@@ -342,7 +376,7 @@ BVGauss::Result BVGauss::gaussElim(Integer prime,
         {
           for (size_t k = pcol; k < ncols; ++k)
           {
-            lhs[j][k] = lhs[j][k].modAdd(-lhs[prow][k], prime);
+            subtractModPrime(lhs[j][k], lhs[prow][k], Integer(1), prime);
           }
           rhs[j] = rhs[j].modAdd(-rhs[prow], prime);
         }
@@ -356,7 +390,7 @@ BVGauss::Result BVGauss::gaussElim(Integer prime,
       {
         for (size_t k = pcol; k < ncols; ++k)
         {
-          lhs[j][k] = lhs[j][k].modAdd(-lhs[prow][k] * mul, prime);
+          subtractModPrime(lhs[j][k], lhs[prow][k], mul, prime);
         }
         rhs[j] = rhs[j].modAdd(-rhs[prow] * mul, prime);
       }
@@ -399,6 +433,81 @@ BVGauss::Result BVGauss::gaussElim(Integer prime,
   return BVGauss::Result::UNIQUE;
 }
 
+BVGauss::Result BVGauss::gaussElimGF2(std::vector<Integer>& rhs,
+                                      std::vector<std::vector<Integer>>& lhs)
+{
+  size_t nrows = lhs.size();
+  size_t ncols = lhs[0].size();
+  /* bit k of a row is the coefficient of column k, bit ncols is the rhs */
+  size_t nwords = (ncols + 1 + 63) / 64;
+  std::vector<std::vector<uint64_t>> rows(nrows,
+                                          std::vector<uint64_t>(nwords, 0));
+  Integer two(2);
+  for (size_t i = 0; i < nrows; ++i)
+  {
+    for (size_t k = 0; k <= ncols; ++k)
+    {
+      const Integer& c = k < ncols ? lhs[i][k] : rhs[i];
+      if (!c.euclidianDivideRemainder(two).isZero())
+      {
+        rows[i][k / 64] |= uint64_t(1) << (k % 64);
+      }
+    }
+  }
+
+  size_t prow = 0;
+  for (size_t pcol = 0; pcol < ncols && prow < nrows; ++pcol)
+  {
+    size_t w = pcol / 64;
+    uint64_t bit = uint64_t(1) << (pcol % 64);
+    size_t j = prow;
+    while (j < nrows && !(rows[j][w] & bit)) ++j;
+    if (j == nrows) continue;
+    std::swap(rows[prow], rows[j]);
+    const std::vector<uint64_t>& p = rows[prow];
+    for (size_t i = 0; i < nrows; ++i)
+    {
+      if (i != prow && (rows[i][w] & bit))
+      {
+        /* the words before w are zero in the pivot row */
+        uint64_t* r = rows[i].data();
+        for (size_t k = w; k < nwords; ++k)
+        {
+          r[k] ^= p[k];
+        }
+      }
+    }
+    ++prow;
+  }
+
+  bool ispart = false, isnone = false;
+  for (size_t i = 0; i < nrows; ++i)
+  {
+    bool haspivot = false;
+    for (size_t k = 0; k <= ncols; ++k)
+    {
+      bool set = (rows[i][k / 64] >> (k % 64)) & 1;
+      if (k < ncols)
+      {
+        lhs[i][k] = set ? 1 : 0;
+        ispart = ispart || (set && haspivot);
+        haspivot = haspivot || set;
+      }
+      else
+      {
+        rhs[i] = set ? 1 : 0;
+        /* no solution */
+        isnone = isnone || (set && !haspivot);
+      }
+    }
+  }
+  if (isnone)
+  {
+    return BVGauss::Result::NONE;
+  }
+  return ispart ? BVGauss::Result::PARTIAL : BVGauss::Result::UNIQUE;
+}
+
 /**
  * Apply Gaussian Elimination on a set of equations modulo some (prime)
  * number given as bit-vector equations.
@@ -97,6 +97,14 @@ class BVGauss : public PreprocessingPass
                    std::vector<Integer>& rhs,
                    std::vector<std::vector<Integer>>& lhs);
 
+  /**
+   * Gaussian Elimination modulo 2 on bit-packed rows, where rows are reduced
+   * by XOR-ing machine words. Computes the reduced row echelon form of the
+   * given system with zero rows at the bottom, as gaussElim does.
+   */
+  Result gaussElimGF2(std::vector<Integer>& rhs,
+                      std::vector<std::vector<Integer>>& lhs);
+
   Result gaussElimRewriteForUrem(const std::vector<Node>& equations,
                                  std::unordered_map<Node, Node>& res);
 
@@ -248,10 +248,18 @@ PreprocessingPassResult ITESimp::applyInternal(
     AssertionPipeline* assertionsToPreprocess)
 {
   d_preprocContext->spendResource(Resource::PreprocessStep);
+  d_iteUtilities.setSimpITEBudget(options().smt.iteSimpBudget);
 
   size_t nasserts = assertionsToPreprocess->size();
   for (size_t i = 0; i < nasserts; ++i)
   {
+    if (d_iteUtilities.isSimpITEOutOfBudget())
+    {
+      // the remaining assertions are kept as they are
+      verbose(1) << "ite-simp: out of budget after " << i << " of " << nasserts
+                 << " assertions" << std::endl;
+      break;
+    }
     d_preprocContext->spendResource(Resource::PreprocessStep);
     Node simp = simpITE(&d_iteUtilities, (*assertionsToPreprocess)[i]);
     assertionsToPreprocess->replace(
@@ -70,12 +70,12 @@ void UnconstrainedSimplifier::visitAll(TNode assertion)
     TNode parent = toVisit.back().parent;
     toVisit.pop_back();
 
-    TNodeCountMap::iterator find = d_visited.find(current);
-    if (find != d_visited.end())
+    auto [find, inserted] = d_visited.try_emplace(current, parent);
+    if (!inserted)
     {
-      if (find->second == 1)
+      if (find->second.d_count == 1)
       {
-        d_visitedOnce.erase(current);
+        find->second.d_parent = TNode::null();
         if (current.isVar())
         {
           d_unconstrained.erase(current);
@@ -91,13 +91,10 @@ void UnconstrainedSimplifier::visitAll(TNode assertion)
           }
         }
       }
-      ++find->second;
+      ++find->second.d_count;
       continue;
     }
 
-    d_visited[current] = 1;
-    d_visitedOnce[current] = parent;
-
     if (current.getNumChildren() == 0)
     {
       if (current.isVar())
@@ -151,8 +148,9 @@ void UnconstrainedSimplifier::processUnconstrained()
   workList.pop_back();
   for (;;)
   {
-    Assert(d_visitedOnce.find(current) != d_visitedOnce.end());
-    parent = d_visitedOnce[current];
+    TNodeVisitMap::const_iterator itv = d_visited.find(current);
+    Assert(itv != d_visited.end() && itv->second.d_count == 1);
+    parent = itv->second.d_parent;
     if (!parent.isNull())
     {
       swap = isSigned = strict = false;
@@ -794,7 +792,7 @@ void UnconstrainedSimplifier::processUnconstrained()
           currentSub = Node();
         }
       }
-      if (current == parent && d_visited[parent] == 1)
+      if (current == parent && d_visited.at(parent).d_count == 1)
       {
         d_unconstrained.insert(parent);
         continue;
@@ -873,7 +871,6 @@ PreprocessingPassResult UnconstrainedSimplifier::applyInternal(
   d_context->pop();
 
   d_visited.clear();
-  d_visitedOnce.clear();
   d_unconstrained.clear();
 
   return PreprocessingPassResult::NO_CONFLICT;
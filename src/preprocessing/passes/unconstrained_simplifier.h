@@ -49,12 +49,23 @@ class UnconstrainedSimplifier : public PreprocessingPass
   /** number of expressions eliminated due to unconstrained simplification */
   IntStat d_numUnconstrainedElim;
 
-  using TNodeCountMap = std::unordered_map<TNode, unsigned>;
-  using TNodeMap = std::unordered_map<TNode, TNode>;
+  /** Information on a visited subterm. */
+  struct VisitInfo
+  {
+    VisitInfo(TNode parent) : d_count(1), d_parent(parent) {}
+    /** The number of occurrences of the subterm. */
+    unsigned d_count;
+    /** The parent of the subterm if it occurs once, null otherwise. */
+    TNode d_parent;
+  };
+  using TNodeVisitMap = std::unordered_map<TNode, VisitInfo>;
   using TNodeSet = std::unordered_set<TNode>;
 
-  TNodeCountMap d_visited;
-  TNodeMap d_visitedOnce;
+  /**
+   * The visited subterms. This is a single map so that visiting a subterm
+   * costs a single lookup.
+   */
+  TNodeVisitMap d_visited;
   TNodeSet d_unconstrained;
 
   context::Context* d_context;
@@ -15,22 +15,66 @@
 
 #include "preprocessing/preprocessing_pass.h"
 
+#include <unordered_set>
+
+#include "options/base_options.h"
 #include "preprocessing/assertion_pipeline.h"
 #include "preprocessing/preprocessing_pass_context.h"
 #include "printer/printer.h"
 #include "smt/env.h"
+#include "theory/trust_substitutions.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace preprocessing {
 
+namespace {
+
+/** Get the number of distinct subterms of the given assertions. */
+size_t getDagSize(const std::vector<Node>& assertions)
+{
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit(assertions.begin(), assertions.end());
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (visited.insert(cur).second)
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  }
+  return visited.size();
+}
+
+}  // namespace
+
 PreprocessingPassResult PreprocessingPass::apply(
     AssertionPipeline* assertionsToPreprocess) {
-  TimerStat::CodeTimer codeTimer(d_timer);
-  Trace("preprocessing") << "PRE " << d_name << std::endl;
-  verbose(2) << d_name << "..." << std::endl;
-  PreprocessingPassResult result = applyInternal(assertionsToPreprocess);
-  Trace("preprocessing") << "POST " << d_name << std::endl;
+  bool profile = options().base.statisticsPreprocess;
+  size_t numSubs = 0;
+  if (profile)
+  {
+    d_assertionsIn += assertionsToPreprocess->size();
+    d_sizeIn += getDagSize(assertionsToPreprocess->ref());
+    numSubs = d_env.getTopLevelSubstitutions().get().size();
+  }
+  PreprocessingPassResult result;
+  {
+    // the profiling above and below is not timed
+    TimerStat::CodeTimer codeTimer(d_timer);
+    Trace("preprocessing") << "PRE " << d_name << std::endl;
+    verbose(2) << d_name << "..." << std::endl;
+    result = applyInternal(assertionsToPreprocess);
+    Trace("preprocessing") << "POST " << d_name << std::endl;
+  }
+  if (profile)
+  {
+    d_assertionsOut += assertionsToPreprocess->size();
+    d_sizeOut += getDagSize(assertionsToPreprocess->ref());
+    d_substitutionsLearned +=
+        d_env.getTopLevelSubstitutions().get().size() - numSubs;
+  }
   return result;
 }
 
@@ -39,7 +83,17 @@ PreprocessingPass::PreprocessingPass(PreprocessingPassContext* preprocContext,
     : EnvObj(preprocContext->getEnv()),
       d_preprocContext(preprocContext),
       d_name(name),
-      d_timer(statisticsRegistry().registerTimer("preprocessing::" + name))
+      d_timer(statisticsRegistry().registerTimer("preprocessing::" + name)),
+      d_assertionsIn(statisticsRegistry().registerInt("preprocessing::" + name
+                                                      + "::assertionsIn")),
+      d_assertionsOut(statisticsRegistry().registerInt(
+          "preprocessing::" + name + "::assertionsOut")),
+      d_sizeIn(statisticsRegistry().registerInt("preprocessing::" + name
+                                                + "::sizeIn")),
+      d_sizeOut(statisticsRegistry().registerInt("preprocessing::" + name
+                                                 + "::sizeOut")),
+      d_substitutionsLearned(statisticsRegistry().registerInt(
+          "preprocessing::" + name + "::substitutionsLearned"))
 {
 }
 
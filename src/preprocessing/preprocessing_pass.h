@@ -21,6 +21,7 @@
  *
  * - Dumping assertions before and after the pass
  * - Initializing the timer
+ * - Profiling the size of the assertions (with --stats-preprocess)
  * - Tracing and chatting
  *
  * Optionally, preprocessing passes can overwrite the initInteral() method to
@@ -75,6 +76,16 @@ class PreprocessingPass : protected EnvObj
   std::string d_name;
   /* Timer for registering the preprocessing time of this pass */
   TimerStat d_timer;
+  /*
+   * The total number of assertions, the total DAG size of the assertions and
+   * the total number of top-level substitutions before and after the
+   * applications of this pass, computed only with --stats-preprocess.
+   */
+  IntStat d_assertionsIn;
+  IntStat d_assertionsOut;
+  IntStat d_sizeIn;
+  IntStat d_sizeOut;
+  IntStat d_substitutionsLearned;
 };
 
 }  // namespace preprocessing
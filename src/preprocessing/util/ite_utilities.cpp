@@ -90,7 +90,8 @@ ITEUtilities::ITEUtilities(Env& env)
       d_containsVisitor(new ContainsTermITEVisitor()),
       d_compressor(NULL),
       d_simplifier(NULL),
-      d_careSimp(NULL)
+      d_careSimp(NULL),
+      d_simpITEBudget(0)
 {
   Assert(d_containsVisitor != NULL);
 }
@@ -116,10 +117,25 @@ Node ITEUtilities::simpITE(TNode assertion)
   if (d_simplifier == NULL)
   {
     d_simplifier = new ITESimplifier(d_env, d_containsVisitor.get());
+    d_simplifier->setBudget(d_simpITEBudget);
   }
   return d_simplifier->simpITE(assertion);
 }
 
+void ITEUtilities::setSimpITEBudget(uint64_t budget)
+{
+  d_simpITEBudget = budget;
+  if (d_simplifier != NULL)
+  {
+    d_simplifier->setBudget(budget);
+  }
+}
+
+bool ITEUtilities::isSimpITEOutOfBudget() const
+{
+  return d_simplifier != NULL && d_simplifier->isOutOfBudget();
+}
+
 bool ITEUtilities::simpIteDidALotOfWorkHeuristic() const
 {
   if (d_simplifier == NULL)
@@ -643,6 +659,8 @@ ITESimplifier::ITESimplifier(Env& env, ContainsTermITEVisitor* contains)
       d_constantLeaves(),
       d_allocatedConstantLeaves(),
       d_citeEqConstApplications(0),
+      d_budget(0),
+      d_work(0),
       d_constantIteEqualsConstantCache(),
       d_replaceOverCache(),
       d_replaceOverTermIteCache(),
@@ -699,6 +717,17 @@ bool ITESimplifier::doneALotOfWorkHeuristic() const
   return (d_citeEqConstApplications > SIZE_BOUND);
 }
 
+void ITESimplifier::setBudget(uint64_t budget)
+{
+  d_budget = budget;
+  d_work = 0;
+}
+
+bool ITESimplifier::isOutOfBudget() const
+{
+  return d_budget > 0 && d_work >= d_budget;
+}
+
 ITESimplifier::Statistics::Statistics(StatisticsRegistry& reg)
     : d_maxNonConstantsFolded(
         reg.registerInt("ite-simp::maxNonConstantsFolded")),
@@ -708,6 +737,7 @@ ITESimplifier::Statistics::Statistics(StatisticsRegistry& reg)
       d_binaryPredFold(reg.registerInt("ite-simp::binaryPredFold")),
       d_specialEqualityFolds(reg.registerInt("ite-simp::specialEqualityFolds")),
       d_simpITEVisits(reg.registerInt("ite-simp::simpITE.visits")),
+      d_budgetSkipped(reg.registerInt("ite-simp::budgetSkipped")),
       d_numBranches(0),
       d_numFalseBranches(0),
       d_itesMade(0),
@@ -1093,6 +1123,7 @@ Node ITESimplifier::constantIteEqualsConstant(TNode cite, TNode constant)
   }
 
   ++d_citeEqConstApplications;
+  ++d_work;
 
   NodeVec* leaves = computeConstantLeaves(cite);
   Assert(leaves != NULL);
@@ -1536,6 +1567,7 @@ Node ITESimplifier::simpITE(TNode assertion)
     {
       d_simpITECache[current] = current;
       ++(d_statistics.d_simpITEVisits);
+      ++d_work;
       toVisit.pop_back();
       continue;
     }
@@ -1566,11 +1598,18 @@ Node ITESimplifier::simpITE(TNode assertion)
       // Mark the substitution and continue
       Node result = builder;
 
-      // If this is an atom, we process it
+      // If this is an atom, we process it, unless we are out of budget
       if (d_env.theoryOf(result) != theory::THEORY_BOOL
           && result.getType().isBoolean())
       {
-        result = simpITEAtom(result);
+        if (isOutOfBudget())
+        {
+          ++(d_statistics.d_budgetSkipped);
+        }
+        else
+        {
+          result = simpITEAtom(result);
+        }
       }
 
       // if(current != result && result.isConst()){
@@ -1581,6 +1620,7 @@ Node ITESimplifier::simpITE(TNode assertion)
       result = rewrite(result);
       d_simpITECache[current] = result;
       ++(d_statistics.d_simpITEVisits);
+      ++d_work;
       toVisit.pop_back();
     }
     else
@@ -1607,6 +1647,7 @@ Node ITESimplifier::simpITE(TNode assertion)
         // No children, so we're done
         d_simpITECache[current] = current;
         ++(d_statistics.d_simpITEVisits);
+        ++d_work;
         toVisit.pop_back();
       }
     }
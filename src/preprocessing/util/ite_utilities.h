@@ -77,6 +77,14 @@ class ITEUtilities : protected EnvObj
 
   bool simpIteDidALotOfWorkHeuristic() const;
 
+  /**
+   * Set the budget of simpITE to `budget` units of work from now on, where 0
+   * means no limit.
+   */
+  void setSimpITEBudget(uint64_t budget);
+  /** Has simpITE exhausted its budget? */
+  bool isSimpITEOutOfBudget() const;
+
   /* returns false if an assertion is discovered to be equal to false. */
   bool compress(AssertionPipeline* assertionsToPreprocess);
 
@@ -99,6 +107,8 @@ class ITEUtilities : protected EnvObj
   ITECompressor* d_compressor;
   ITESimplifier* d_simplifier;
   ITECareSimplifier* d_careSimp;
+  /** The budget of simpITE, see setSimpITEBudget(). */
+  uint64_t d_simpITEBudget;
 };
 
 class IncomingArcCounter
@@ -217,6 +227,15 @@ class ITESimplifier : protected EnvObj
   bool doneALotOfWorkHeuristic() const;
   void clearSimpITECaches();
 
+  /**
+   * Allow `budget` more units of work, that is, visited terms and comparisons
+   * of constant ites with constants, where 0 means no limit. Once the budget
+   * is exhausted, the atoms that are not simplified yet are kept as they are.
+   */
+  void setBudget(uint64_t budget);
+  /** Has the budget been exhausted? */
+  bool isOutOfBudget() const;
+
  private:
   using NodeVec = std::vector<Node>;
   using ConstantLeavesMap = std::unordered_map<Node, NodeVec*>;
@@ -235,6 +254,7 @@ class ITESimplifier : protected EnvObj
     IntStat d_binaryPredFold;
     IntStat d_specialEqualityFolds;
     IntStat d_simpITEVisits;
+    IntStat d_budgetSkipped;
     unsigned d_numBranches;
     unsigned d_numFalseBranches;
     unsigned d_itesMade;
@@ -309,6 +329,11 @@ class ITESimplifier : protected EnvObj
 
   uint32_t d_citeEqConstApplications;
 
+  /** The budget, see setBudget(). */
+  uint64_t d_budget;
+  /** The work done since the last call to setBudget(). */
+  uint64_t d_work;
+
   NodePairMap d_constantIteEqualsConstantCache;
   NodePairMap d_replaceOverCache;
   NodePairMap d_replaceOverTermIteCache;
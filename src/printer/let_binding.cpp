@@ -162,7 +162,6 @@ void LetBinding::updateCounts(Node n)
   do
   {
     cur = visit.back();
-    it = d_count.find(cur);
     bool isSkolem = (d_traverseSkolems && cur.getKind() == Kind::SKOLEM);
     // do not traverse beneath quantifiers if d_traverseBinders is false.
     if ((!isSkolem && cur.getNumChildren() == 0) || cur.getKind() == Kind::BOUND_VAR_LIST
@@ -171,9 +170,11 @@ void LetBinding::updateCounts(Node n)
       visit.pop_back();
       continue;
     }
+    // only look up the nodes that may be letified
+    it = d_count.find(cur);
     if (it == d_count.end())
     {
-      d_count[cur] = 0;
+      d_count.insert(cur, 0);
       if (isSkolem)
       {
         SkolemId skid;
@@ -201,11 +202,12 @@ void LetBinding::updateCounts(Node n)
     }
     else
     {
-      if ((*it).second == 0)
+      uint32_t count = (*it).second;
+      if (count == 0)
       {
         d_visitList.push_back(cur);
       }
-      d_count[cur] = (*it).second + 1;
+      d_count.insert(cur, count + 1);
       visit.pop_back();
     }
   } while (!visit.empty());
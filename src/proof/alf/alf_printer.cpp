@@ -15,6 +15,7 @@
 
 #include "proof/alf/alf_printer.h"
 
+#include <algorithm>
 #include <cctype>
 #include <iostream>
 #include <memory>
@@ -874,6 +875,7 @@ void AlfPrinter::print(AlfPrintChannelOut& aout,
       ascope != nullptr ? ascope->getArguments() : d_emptyVec;
 
   bool wasAlloc;
+  size_t streamSize = options().proof.proofPrintStreamSize;
   for (size_t i = 0; i < 2; i++)
   {
     AlfPrintChannel* ao;
@@ -937,7 +939,14 @@ void AlfPrinter::print(AlfPrintChannelOut& aout,
       ao->printStep("refl", f.eqNode(lam), id, {}, {lam});
     }
     // [5] print proof body
-    printProofInternal(ao, pnBody, i == 1);
+    if (streamSize == 0)
+    {
+      printProofInternal(ao, pnBody, i == 1);
+    }
+    else if (i == 1)
+    {
+      printProofStreaming(aout, pnBody, streamSize);
+    }
   }
 }
 
@@ -1015,6 +1024,62 @@ void AlfPrinter::printProofInternal(AlfPrintChannel* out,
   } while (!visit.empty());
 }
 
+void AlfPrinter::printProofStreaming(AlfPrintChannelOut& out,
+                                     const ProofNode* pn,
+                                     size_t chunkSize)
+{
+  Assert(chunkSize > 0);
+  // Collect the top-level steps in post-order. We do not traverse beneath
+  // SCOPE steps, since the steps in their body are printed in the context of
+  // their assumptions.
+  std::vector<const ProofNode*> steps;
+  std::unordered_set<const ProofNode*> visited;
+  std::vector<std::pair<const ProofNode*, bool>> visit;
+  visit.emplace_back(pn, false);
+  do
+  {
+    std::pair<const ProofNode*, bool> cur = visit.back();
+    visit.pop_back();
+    if (cur.second)
+    {
+      steps.push_back(cur.first);
+      continue;
+    }
+    if (cur.first->getRule() == ProofRule::ASSUME
+        || d_alreadyPrinted.find(cur.first) != d_alreadyPrinted.end()
+        || !visited.insert(cur.first).second)
+    {
+      continue;
+    }
+    visit.emplace_back(cur.first, true);
+    if (cur.first->getRule() == ProofRule::SCOPE)
+    {
+      continue;
+    }
+    std::vector<std::shared_ptr<ProofNode>> children;
+    getChildrenFromProofRule(cur.first, children);
+    for (const std::shared_ptr<ProofNode>& c : children)
+    {
+      visit.emplace_back(c.get(), false);
+    }
+  } while (!visit.empty());
+  std::ostream& os = out.getOStream();
+  for (size_t i = 0, nsteps = steps.size(); i < nsteps; i += chunkSize)
+  {
+    size_t end = std::min(i + chunkSize, nsteps);
+    // letify the chunk, print the new let bindings, then print the chunk
+    for (size_t j = i; j < end; j++)
+    {
+      printProofInternal(&d_aletify, steps[j], false);
+    }
+    printLetList(os, d_lbind);
+    for (size_t j = i; j < end; j++)
+    {
+      printProofInternal(&out, steps[j], true);
+    }
+  }
+}
+
 void AlfPrinter::printStepPre(AlfPrintChannel* out, const ProofNode* pn)
 {
   // if we haven't yet allocated a proof id, do it now
@@ -141,6 +141,16 @@ class AlfPrinter : protected EnvObj
   void printProofInternal(AlfPrintChannel* out,
                           const ProofNode* pn,
                           bool addToCache);
+  /**
+   * Helper for print. Prints the proof node pn to out in chunks of the given
+   * number of top-level steps, i.e. steps that are not in the scope of a
+   * SCOPE step. Each chunk is letified and preceded by the definitions of the
+   * terms it introduces, as done in printNext, so that output starts before
+   * the entire proof is processed.
+   */
+  void printProofStreaming(AlfPrintChannelOut& out,
+                           const ProofNode* pn,
+                           size_t chunkSize);
   /**
    * Called at preorder traversal of proof node pn. Prints (if necessary) to
    * out.
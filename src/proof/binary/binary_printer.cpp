@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Haniel Barbosa
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The module for printing proofs in a compact binary format.
+ */
+
+#include "proof/binary/binary_printer.h"
+
+#include <sstream>
+
+#include "options/io_utils.h"
+
+namespace cvc5::internal {
+namespace proof {
+
+const uint32_t BinaryPrinter::s_version = 1;
+
+BinaryPrinter::BinaryPrinter(Env& env)
+    : EnvObj(env), d_numStrings(0), d_numTerms(0)
+{
+}
+
+void BinaryPrinter::writeVarint(std::string& buf, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    buf.push_back(static_cast<char>((v & 0x7f) | 0x80));
+    v >>= 7;
+  }
+  buf.push_back(static_cast<char>(v));
+}
+
+void BinaryPrinter::writeFixed(std::string& buf, uint64_t v, size_t nbytes)
+{
+  for (size_t i = 0; i < nbytes; i++)
+  {
+    buf.push_back(static_cast<char>(v & 0xff));
+    v >>= 8;
+  }
+}
+
+uint64_t BinaryPrinter::getStringId(const std::string& s)
+{
+  std::unordered_map<std::string, uint64_t>::iterator it = d_stringIds.find(s);
+  if (it != d_stringIds.end())
+  {
+    return it->second;
+  }
+  uint64_t id = d_numStrings++;
+  d_stringIds[s] = id;
+  writeVarint(d_strings, s.size());
+  d_strings.append(s);
+  return id;
+}
+
+uint64_t BinaryPrinter::getTermId(TNode n)
+{
+  std::unordered_map<TNode, uint64_t>::iterator it = d_termIds.find(n);
+  if (it != d_termIds.end())
+  {
+    return it->second;
+  }
+  // allocate the subterms in post-order
+  std::vector<std::pair<TNode, bool>> visit;
+  visit.emplace_back(n, false);
+  do
+  {
+    std::pair<TNode, bool> cur = visit.back();
+    visit.pop_back();
+    if (d_termIds.find(cur.first) != d_termIds.end())
+    {
+      continue;
+    }
+    bool hasOp = cur.first.getMetaKind() == kind::metakind::PARAMETERIZED;
+    if (!cur.second)
+    {
+      visit.emplace_back(cur.first, true);
+      if (hasOp)
+      {
+        visit.emplace_back(cur.first.getOperator(), false);
+      }
+      for (TNode c : cur.first)
+      {
+        visit.emplace_back(c, false);
+      }
+      continue;
+    }
+    uint64_t kid = getStringId(kind::toString(cur.first.getKind()));
+    writeVarint(d_terms, kid);
+    if (cur.first.getNumChildren() == 0 && !hasOp)
+    {
+      std::stringstream ss;
+      options::ioutils::applyOutputLanguage(ss, Language::LANG_SMTLIB_V2_6);
+      ss << cur.first;
+      std::stringstream sst;
+      options::ioutils::applyOutputLanguage(sst, Language::LANG_SMTLIB_V2_6);
+      sst << cur.first.getType();
+      uint64_t sid = getStringId(ss.str());
+      uint64_t tid = getStringId(sst.str());
+      writeVarint(d_terms, 1);
+      writeVarint(d_terms, sid);
+      writeVarint(d_terms, tid);
+    }
+    else
+    {
+      writeVarint(d_terms, hasOp ? 2 : 0);
+      if (hasOp)
+      {
+        writeVarint(d_terms, d_termIds[cur.first.getOperator()]);
+      }
+      writeVarint(d_terms, cur.first.getNumChildren());
+      for (TNode c : cur.first)
+      {
+        writeVarint(d_terms, d_termIds[c]);
+      }
+    }
+    d_termIds[cur.first] = d_numTerms++;
+  } while (!visit.empty());
+  return d_termIds[n];
+}
+
+void BinaryPrinter::print(std::ostream& out, const ProofNode* pn)
+{
+  d_strings.clear();
+  d_numStrings = 0;
+  d_stringIds.clear();
+  d_terms.clear();
+  d_numTerms = 0;
+  d_termIds.clear();
+  // the steps, which are allocated in post-order
+  std::string steps;
+  uint64_t numSteps = 0;
+  std::unordered_map<const ProofNode*, uint64_t> stepIds;
+  std::vector<std::pair<const ProofNode*, bool>> visit;
+  visit.emplace_back(pn, false);
+  do
+  {
+    std::pair<const ProofNode*, bool> cur = visit.back();
+    visit.pop_back();
+    if (stepIds.find(cur.first) != stepIds.end())
+    {
+      continue;
+    }
+    const std::vector<std::shared_ptr<ProofNode>>& cs =
+        cur.first->getChildren();
+    if (!cur.second)
+    {
+      visit.emplace_back(cur.first, true);
+      for (const std::shared_ptr<ProofNode>& c : cs)
+      {
+        visit.emplace_back(c.get(), false);
+      }
+      continue;
+    }
+    uint64_t id = numSteps++;
+    writeVarint(steps, getStringId(toString(cur.first->getRule())));
+    writeVarint(steps, getTermId(cur.first->getResult()));
+    writeVarint(steps, cs.size());
+    for (const std::shared_ptr<ProofNode>& c : cs)
+    {
+      Assert(stepIds.find(c.get()) != stepIds.end());
+      writeVarint(steps, id - stepIds[c.get()]);
+    }
+    const std::vector<Node>& args = cur.first->getArguments();
+    writeVarint(steps, args.size());
+    for (const Node& a : args)
+    {
+      writeVarint(steps, getTermId(a));
+    }
+    stepIds[cur.first] = id;
+  } while (!visit.empty());
+  // prefix each section with its size
+  std::string sstrings;
+  writeVarint(sstrings, d_numStrings);
+  sstrings.append(d_strings);
+  std::string sterms;
+  writeVarint(sterms, d_numTerms);
+  sterms.append(d_terms);
+  std::string ssteps;
+  writeVarint(ssteps, numSteps);
+  ssteps.append(steps);
+  // the header
+  std::string header("CVC5PRF");
+  header.push_back('\0');
+  writeFixed(header, s_version, 4);
+  writeFixed(header, 0, 4);
+  uint64_t offStrings = 48;
+  uint64_t offTerms = offStrings + sstrings.size();
+  uint64_t offSteps = offTerms + sterms.size();
+  uint64_t total = offSteps + ssteps.size();
+  writeFixed(header, offStrings, 8);
+  writeFixed(header, offTerms, 8);
+  writeFixed(header, offSteps, 8);
+  writeFixed(header, total, 8);
+  Assert(header.size() == offStrings);
+  out.write(header.data(), header.size());
+  out.write(sstrings.data(), sstrings.size());
+  out.write(sterms.data(), sterms.size());
+  out.write(ssteps.data(), ssteps.size());
+}
+
+}  // namespace proof
+}  // namespace cvc5::internal
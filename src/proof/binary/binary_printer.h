@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds, Haniel Barbosa
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The module for printing proofs in a compact binary format.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROOF__BINARY__BINARY_PRINTER_H
+#define CVC5__PROOF__BINARY__BINARY_PRINTER_H
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "proof/proof_node.h"
+#include "smt/env_obj.h"
+
+namespace cvc5::internal {
+namespace proof {
+
+/**
+ * Prints proof nodes in a compact binary format, which is intended to be
+ * consumed by external tools.
+ *
+ * The output consists of a fixed-size header followed by three sections.
+ * All integers in the sections are unsigned LEB128 varints.
+ *
+ * Header (48 bytes):
+ *   - the magic bytes "CVC5PRF" followed by a zero byte,
+ *   - the format version as a 32-bit little-endian integer, followed by 4
+ *     reserved zero bytes,
+ *   - the offsets of the string, term and step sections, and the total size,
+ *     as 64-bit little-endian integers, relative to the start of the header.
+ *     These permit tools to map the file in memory and directly access each
+ *     section.
+ *
+ * String section: the number of strings, then for each string its length
+ * followed by its bytes. Strings are used for the names of kinds and proof
+ * rules, and for the textual representation of leaf terms and their types.
+ * Each string occurs once.
+ *
+ * Term section: the number of terms, then for each term (in an order where
+ * the subterms of a term precede it, with ids starting from zero):
+ *   - the string id of its kind,
+ *   - flags, where bit 0 is set for leaves and bit 1 for terms with an
+ *     operator (parameterized kinds),
+ *   - for leaves, the string ids of its text and of the text of its type,
+ *   - otherwise, the term id of its operator if bit 1 is set, the number of
+ *     children and the term ids of its children.
+ * Each term occurs once.
+ *
+ * Step section: the number of steps, then for each step (in an order where
+ * the premises of a step precede it, with ids starting from zero):
+ *   - the string id of its proof rule,
+ *   - the term id of its conclusion,
+ *   - the number of premises and, for each premise, the difference between
+ *     the id of this step and the id of the premise, which tends to be small,
+ *   - the number of arguments and their term ids.
+ * The last step concludes the proof.
+ */
+class BinaryPrinter : protected EnvObj
+{
+ public:
+  BinaryPrinter(Env& env);
+  ~BinaryPrinter() {}
+  /** The version of the format printed by this class */
+  static const uint32_t s_version;
+  /**
+   * Print the proof pn to out in the binary format.
+   *
+   * @param out The output stream, which should be opened in binary mode.
+   * @param pn The proof to print.
+   */
+  void print(std::ostream& out, const ProofNode* pn);
+
+ private:
+  /** Append the varint encoding of v to buf */
+  static void writeVarint(std::string& buf, uint64_t v);
+  /** Append the little-endian encoding of v to buf */
+  static void writeFixed(std::string& buf, uint64_t v, size_t nbytes);
+  /** Get the id of string s, allocating it if necessary */
+  uint64_t getStringId(const std::string& s);
+  /** Get the id of term n, allocating it and its subterms if necessary */
+  uint64_t getTermId(TNode n);
+  /** The string section, without its size */
+  std::string d_strings;
+  /** The number of strings in d_strings */
+  uint64_t d_numStrings;
+  /** Maps strings to their ids */
+  std::unordered_map<std::string, uint64_t> d_stringIds;
+  /** The term section, without its size */
+  std::string d_terms;
+  /** The number of terms in d_terms */
+  uint64_t d_numTerms;
+  /** Maps terms to their ids */
+  std::unordered_map<TNode, uint64_t> d_termIds;
+};
+
+}  // namespace proof
+}  // namespace cvc5::internal
+
+#endif /* CVC5__PROOF__BINARY__BINARY_PRINTER_H */
@@ -28,7 +28,9 @@ ProofCheckerStatistics::ProofCheckerStatistics(StatisticsRegistry& sr)
     : d_ruleChecks(
         sr.registerHistogram<ProofRule>("ProofCheckerStatistics::ruleChecks")),
       d_totalRuleChecks(
-          sr.registerInt("ProofCheckerStatistics::totalRuleChecks"))
+          sr.registerInt("ProofCheckerStatistics::totalRuleChecks")),
+      d_cachedRuleChecks(
+          sr.registerInt("ProofCheckerStatistics::cachedRuleChecks"))
 {
 }
 
@@ -36,7 +38,12 @@ ProofChecker::ProofChecker(StatisticsRegistry& sr,
                            options::ProofCheckMode pcMode,
                            uint32_t pclevel,
                            rewriter::RewriteDb* rdb)
-    : d_stats(sr), d_pcMode(pcMode), d_pclevel(pclevel), d_rdb(rdb)
+    : d_stats(sr),
+      d_checkCacheSize(
+          sr.registerSize("ProofCheckerStatistics::checkCacheSize", d_checkCache)),
+      d_pcMode(pcMode),
+      d_pclevel(pclevel),
+      d_rdb(rdb)
 {
 }
 
@@ -44,6 +51,7 @@ void ProofChecker::reset()
 {
   d_checker.clear();
   d_plevel.clear();
+  d_checkCache.clear();
 }
 
 Node ProofChecker::check(ProofNode* pn, Node expected)
@@ -94,6 +102,22 @@ Node ProofChecker::check(
   }
   Trace("pfcheck") << "      args: " << args << std::endl;
   Trace("pfcheck") << "  expected: " << expected << std::endl;
+  // We only cache the results of actual checks, i.e. not of trusted rules
+  // and not if we are not checking, since those return expected.
+  bool useCache = d_pcMode != options::ProofCheckMode::NONE;
+  CheckKey key;
+  if (useCache)
+  {
+    key = CheckKey(id, cchildren, args);
+    std::map<CheckKey, Node>::const_iterator itc = d_checkCache.find(key);
+    if (itc != d_checkCache.end()
+        && (expected.isNull() || itc->second == expected))
+    {
+      Trace("pfcheck") << "ProofChecker::check: success (cached)" << std::endl;
+      ++d_stats.d_cachedRuleChecks;
+      return itc->second;
+    }
+  }
   // we use trusted (null) checkers here, since we want the proof generation to
   // proceed without failing here. We always enable output since a failure
   // implies that we will exit with the error message below.
@@ -108,6 +132,15 @@ Node ProofChecker::check(
     return Node::null();
   }
   Trace("pfcheck") << "ProofChecker::check: success!" << std::endl;
+  if (useCache)
+  {
+    std::map<ProofRule, ProofRuleChecker*>::const_iterator it =
+        d_checker.find(id);
+    if (it != d_checker.end() && it->second != nullptr)
+    {
+      d_checkCache[key] = res;
+    }
+  }
   return res;
 }
 
@@ -144,6 +177,8 @@ Node ProofChecker::checkDebug(ProofRule id,
 void ProofChecker::setProofCheckMode(options::ProofCheckMode pcMode)
 {
   d_pcMode = pcMode;
+  // cached checks may not have been subject to pedantic checking
+  d_checkCache.clear();
 }
 
 Node ProofChecker::checkInternal(ProofRule id,
@@ -19,6 +19,8 @@
 #define CVC5__PROOF__PROOF_CHECKER_H
 
 #include <map>
+#include <tuple>
+#include <vector>
 
 #include "expr/node.h"
 #include "options/proof_options.h"
@@ -39,6 +41,8 @@ class ProofCheckerStatistics
   HistogramStat<ProofRule> d_ruleChecks;
   /** Total number of rule checks */
   IntStat d_totalRuleChecks;
+  /** Total number of rule checks answered by the check cache */
+  IntStat d_cachedRuleChecks;
 };
 
 /** A class for checking proofs */
@@ -50,7 +54,7 @@ class ProofChecker
                uint32_t pclevel = 0,
                rewriter::RewriteDb* rdb = nullptr);
   ~ProofChecker() {}
-  /** Reset, which clears the rule checkers */
+  /** Reset, which clears the rule checkers and the check cache */
   void reset();
   /**
    * Return the formula that is proven by proof node pn, or null if pn is not
@@ -135,6 +139,17 @@ class ProofChecker
   std::map<ProofRule, ProofRuleChecker*> d_checker;
   /** Maps proof trusted rules to their pedantic level */
   std::map<ProofRule, uint32_t> d_plevel;
+  /** A proof step, given by its rule, premises and arguments */
+  using CheckKey = std::tuple<ProofRule, std::vector<Node>, std::vector<Node>>;
+  /**
+   * Maps the proof steps we successfully checked with a (non-trusted)
+   * checker to their conclusion. Since rule checkers only depend on the
+   * premises and arguments of a step, this avoids checking steps again that
+   * occur in distinct proof nodes, which is common in large proofs.
+   */
+  std::map<CheckKey, Node> d_checkCache;
+  /** The size of d_checkCache */
+  SizeStat<std::map<CheckKey, Node>> d_checkCacheSize;
   /** The proof checking mode */
   options::ProofCheckMode d_pcMode;
   /** The pedantic level of this checker */
@@ -36,7 +36,7 @@ void ProofLetify::computeProofLet(const ProofNode* pn,
     return;
   }
   std::vector<const ProofNode*> visitList;
-  std::map<const ProofNode*, size_t> pcount;
+  std::unordered_map<const ProofNode*, size_t> pcount;
   if (pltc == nullptr)
   {
     // use default callback
@@ -51,22 +51,25 @@ void ProofLetify::computeProofLet(const ProofNode* pn,
   convertProofCountToLet(visitList, pcount, pletList, pletMap, thresh);
 }
 
-void ProofLetify::computeProofCounts(const ProofNode* pn,
-                                     std::vector<const ProofNode*>& visitList,
-                                     std::map<const ProofNode*, size_t>& pcount,
-                                     ProofLetifyTraverseCallback* pltc)
+void ProofLetify::computeProofCounts(
+    const ProofNode* pn,
+    std::vector<const ProofNode*>& visitList,
+    std::unordered_map<const ProofNode*, size_t>& pcount,
+    ProofLetifyTraverseCallback* pltc)
 {
-  std::map<const ProofNode*, size_t>::iterator it;
+  std::unordered_map<const ProofNode*, size_t>::iterator it;
   std::vector<const ProofNode*> visit;
   const ProofNode* cur;
   visit.push_back(pn);
   do
   {
     cur = visit.back();
-    it = pcount.find(cur);
-    if (it == pcount.end())
+    // a single lookup, which inserts a count of zero for new proof nodes
+    std::pair<std::unordered_map<const ProofNode*, size_t>::iterator, bool>
+        ins = pcount.emplace(cur, 0);
+    it = ins.first;
+    if (ins.second)
     {
-      pcount[cur] = 0;
       if (!pltc->shouldTraverse(cur))
       {
         // callback indicated we should not traverse
@@ -84,7 +87,7 @@ void ProofLetify::computeProofCounts(const ProofNode* pn,
       {
         visitList.push_back(cur);
       }
-      pcount[cur]++;
+      it->second++;
       visit.pop_back();
     }
   } while (!visit.empty());
@@ -92,7 +95,7 @@ void ProofLetify::computeProofCounts(const ProofNode* pn,
 
 void ProofLetify::convertProofCountToLet(
     const std::vector<const ProofNode*>& visitList,
-    const std::map<const ProofNode*, size_t>& pcount,
+    const std::unordered_map<const ProofNode*, size_t>& pcount,
     std::vector<const ProofNode*>& pletList,
     std::map<const ProofNode*, size_t>& pletMap,
     size_t thresh)
@@ -105,7 +108,7 @@ void ProofLetify::convertProofCountToLet(
   }
   // Assign ids for those whose count is > 1, traverse in reverse order
   // so that deeper proofs are assigned lower identifiers
-  std::map<const ProofNode*, size_t>::const_iterator itc;
+  std::unordered_map<const ProofNode*, size_t>::const_iterator itc;
   for (const ProofNode* pn : visitList)
   {
     itc = pcount.find(pn);
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <map>
+#include <unordered_map>
 
 #include "expr/node.h"
 #include "proof/proof_node.h"
@@ -77,7 +78,7 @@ class ProofLetify
    */
   static void convertProofCountToLet(
       const std::vector<const ProofNode*>& visitList,
-      const std::map<const ProofNode*, size_t>& pcount,
+      const std::unordered_map<const ProofNode*, size_t>& pcount,
       std::vector<const ProofNode*>& pletList,
       std::map<const ProofNode*, size_t>& pletMap,
       size_t thresh = 2);
@@ -85,11 +86,15 @@ class ProofLetify
    * Compute the count of sub proof nodes in pn, store in pcount. Additionally,
    * store each proof node in the domain of pcount in an order in visitList
    * such that visitList[i] does not contain sub proof visitList[j] for j>i.
+   *
+   * This traversal is iterative and performs a single lookup in pcount per
+   * edge of the proof DAG, so that it runs in time linear in the size of pn.
    */
-  static void computeProofCounts(const ProofNode* pn,
-                                 std::vector<const ProofNode*>& visitList,
-                                 std::map<const ProofNode*, size_t>& pcount,
-                                 ProofLetifyTraverseCallback* pltc);
+  static void computeProofCounts(
+      const ProofNode* pn,
+      std::vector<const ProofNode*>& visitList,
+      std::unordered_map<const ProofNode*, size_t>& pcount,
+      ProofLetifyTraverseCallback* pltc);
 };
 
 }  // namespace proof
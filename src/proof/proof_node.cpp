@@ -26,8 +26,21 @@ ProofNode::ProofNode(ProofRule id,
     : d_provenChecked(false)
 {
   setValue(id, children, args);
+  if (++s_numLive > s_maxLive)
+  {
+    s_maxLive = s_numLive;
+  }
 }
 
+ProofNode::~ProofNode() { --s_numLive; }
+
+thread_local uint64_t ProofNode::s_numLive = 0;
+thread_local uint64_t ProofNode::s_maxLive = 0;
+
+const uint64_t& ProofNode::getNumLive() { return s_numLive; }
+
+const uint64_t& ProofNode::getMaxLive() { return s_maxLive; }
+
 ProofRule ProofNode::getRule() const { return d_rule; }
 
 const std::vector<std::shared_ptr<ProofNode>>& ProofNode::getChildren() const
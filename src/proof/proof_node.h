@@ -92,7 +92,7 @@ class ProofNode
   ProofNode(ProofRule id,
             const std::vector<std::shared_ptr<ProofNode>>& children,
             const std::vector<Node>& args);
-  ~ProofNode() {}
+  ~ProofNode();
   /** get the rule of this proof node */
   ProofRule getRule() const;
   /** Get children */
@@ -119,6 +119,10 @@ class ProofNode
    * @return the cloned proof node.
    */
   std::shared_ptr<ProofNode> clone() const;
+  /** Get the number of proof nodes that currently exist */
+  static const uint64_t& getNumLive();
+  /** Get the maximum number of proof nodes that existed at the same time */
+  static const uint64_t& getMaxLive();
 
  private:
   /**
@@ -138,6 +142,10 @@ class ProofNode
   Node d_proven;
   /** Was d_proven actually checked, or is it trusted? */
   bool d_provenChecked;
+  /** The number of proof nodes that currently exist */
+  static thread_local uint64_t s_numLive;
+  /** The maximum value of s_numLive so far */
+  static thread_local uint64_t s_maxLive;
 };
 }  // namespace cvc5::internal
 
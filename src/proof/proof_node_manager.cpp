@@ -15,14 +15,18 @@
 
 #include "proof/proof_node_manager.h"
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
 
+#include "options/base_options.h"
 #include "options/proof_options.h"
 #include "proof/proof.h"
 #include "proof/proof_checker.h"
 #include "proof/proof_node.h"
 #include "proof/proof_node_algorithm.h"
 #include "theory/rewriter.h"
+#include "util/statistics_registry.h"
 
 using namespace cvc5::internal::kind;
 
@@ -31,12 +35,38 @@ namespace cvc5::internal {
 ProofNodeManager::ProofNodeManager(NodeManager* nm,
                                    const Options& opts,
                                    theory::Rewriter* rr,
-                                   ProofChecker* pc)
-    : d_opts(opts), d_rewriter(rr), d_checker(pc)
+                                   ProofChecker* pc,
+                                   StatisticsRegistry* sr)
+    : d_opts(opts), d_rewriter(rr), d_checker(pc), d_hashConsLimit(1024)
 {
   d_true = nm->mkConst(true);
   // we always allocate a proof checker, regardless of the proof checking mode
   Assert(d_checker != nullptr);
+  if (sr != nullptr && d_opts.proof.proofHashCons)
+  {
+    d_stats.reset(new Statistics(*sr));
+  }
+  if (sr != nullptr && d_opts.base.statisticsProofMemory)
+  {
+    d_memStats.reset(new MemoryStatistics(*sr, d_hashCons));
+  }
+}
+
+ProofNodeManager::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_hashConsNodes(sr.registerInt("ProofNodeManager::hashConsNodes")),
+      d_hashConsShared(sr.registerInt("ProofNodeManager::hashConsShared"))
+{
+}
+
+ProofNodeManager::MemoryStatistics::MemoryStatistics(
+    StatisticsRegistry& sr,
+    const std::map<HashConsKey, std::weak_ptr<ProofNode>>& hc)
+    : d_numLive(sr.registerReference<uint64_t>("ProofNodeManager::liveNodes",
+                                               ProofNode::getNumLive())),
+      d_maxLive(sr.registerReference<uint64_t>("ProofNodeManager::maxLiveNodes",
+                                               ProofNode::getMaxLive())),
+      d_hashConsSize(sr.registerSize("ProofNodeManager::hashConsSize", hc))
+{
 }
 
 std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
@@ -47,6 +77,31 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
 {
   Trace("pnm") << "ProofNodeManager::mkNode " << id << " {" << expected.getId()
                << "} " << expected << "\n";
+  bool hashCons = d_opts.proof.proofHashCons && id != ProofRule::ASSUME;
+  HashConsKey key;
+  if (hashCons)
+  {
+    std::vector<const ProofNode*> cps;
+    for (const std::shared_ptr<ProofNode>& c : children)
+    {
+      cps.push_back(c.get());
+    }
+    key = HashConsKey(id, cps, args);
+    std::shared_ptr<ProofNode> pn =
+        getHashConsed(key, children, args, expected);
+    if (d_stats != nullptr)
+    {
+      ++d_stats->d_hashConsNodes;
+    }
+    if (pn != nullptr)
+    {
+      if (d_stats != nullptr)
+      {
+        ++d_stats->d_hashConsShared;
+      }
+      return pn;
+    }
+  }
   bool didCheck = false;
   Node res = checkInternal(id, children, args, expected, didCheck);
   if (res.isNull())
@@ -59,6 +114,42 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
       std::make_shared<ProofNode>(id, children, args);
   pn->d_proven = res;
   pn->d_provenChecked = didCheck;
+  if (hashCons)
+  {
+    if (d_hashCons.size() >= d_hashConsLimit)
+    {
+      // remove the entries for proof nodes that were deleted
+      for (auto it = d_hashCons.begin(); it != d_hashCons.end();)
+      {
+        it = it->second.expired() ? d_hashCons.erase(it) : std::next(it);
+      }
+      d_hashConsLimit = std::max(d_hashConsLimit, 2 * d_hashCons.size());
+    }
+    d_hashCons[key] = pn;
+  }
+  return pn;
+}
+
+std::shared_ptr<ProofNode> ProofNodeManager::getHashConsed(
+    const HashConsKey& key,
+    const std::vector<std::shared_ptr<ProofNode>>& children,
+    const std::vector<Node>& args,
+    const Node& expected)
+{
+  std::map<HashConsKey, std::weak_ptr<ProofNode>>::const_iterator it =
+      d_hashCons.find(key);
+  if (it == d_hashCons.end())
+  {
+    return nullptr;
+  }
+  std::shared_ptr<ProofNode> pn = it->second.lock();
+  // the proof node may have been deleted or updated in the meantime
+  if (pn == nullptr || pn->getRule() != std::get<0>(key)
+      || pn->getChildren() != children || pn->getArguments() != args
+      || (!expected.isNull() && pn->getResult() != expected))
+  {
+    return nullptr;
+  }
   return pn;
 }
 
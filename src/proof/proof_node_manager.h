@@ -18,17 +18,22 @@
 #ifndef CVC5__PROOF__PROOF_NODE_MANAGER_H
 #define CVC5__PROOF__PROOF_NODE_MANAGER_H
 
+#include <map>
+#include <memory>
+#include <tuple>
 #include <vector>
 
 #include "cvc5/cvc5_proof_rule.h"
 #include "expr/node.h"
 #include "proof/trust_id.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
 class ProofChecker;
 class ProofNode;
 class Options;
+class StatisticsRegistry;
 
 namespace theory {
 class Rewriter;
@@ -53,9 +58,11 @@ class Rewriter;
  * node.
  *
  * Notice that ProofNode objects are mutable, and hence this class does not
- * cache the results of mkNode. A version of this class that caches
- * immutable version of ProofNode objects could be built as an extension
- * or layer on top of this class.
+ * cache the results of mkNode by default. With --proof-hash-cons, mkNode
+ * returns an existing proof node with the same rule, children and arguments
+ * if one is still alive and was not updated since. This is sound since
+ * updates preserve the conclusion of proof nodes. We never share ASSUME
+ * nodes, since they are updated depending on the scope they occur in.
  */
 class ProofNodeManager
 {
@@ -63,7 +70,8 @@ class ProofNodeManager
   ProofNodeManager(NodeManager* nm,
                    const Options& opts,
                    theory::Rewriter* rr,
-                   ProofChecker* pc = nullptr);
+                   ProofChecker* pc = nullptr,
+                   StatisticsRegistry* sr = nullptr);
   ~ProofNodeManager() {}
   /**
    * This constructs a ProofNode with the given arguments. The expected
@@ -214,6 +222,48 @@ class ProofNodeManager
   ProofChecker* d_checker;
   /** the true node */
   Node d_true;
+  /** The key of a proof node for hash-consing */
+  using HashConsKey = std::tuple<ProofRule,
+                                 std::vector<const ProofNode*>,
+                                 std::vector<Node>>;
+  /** The proof nodes constructed by mkNode, if hash-consing is enabled */
+  std::map<HashConsKey, std::weak_ptr<ProofNode>> d_hashCons;
+  /** The size of d_hashCons at which we remove its expired entries */
+  size_t d_hashConsLimit;
+  /** Statistics for hash-consing */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of proof nodes requested via mkNode while hash-consing */
+    IntStat d_hashConsNodes;
+    /** Number of those for which we returned an existing proof node */
+    IntStat d_hashConsShared;
+  };
+  /** The statistics, null if not hash-consing or no registry was given */
+  std::unique_ptr<Statistics> d_stats;
+  /** Statistics for the memory used by proofs */
+  struct MemoryStatistics
+  {
+    MemoryStatistics(StatisticsRegistry& sr,
+                     const std::map<HashConsKey, std::weak_ptr<ProofNode>>& hc);
+    /** The number of proof nodes that currently exist */
+    ReferenceStat<uint64_t> d_numLive;
+    /** The maximum number of proof nodes that existed at the same time */
+    ReferenceStat<uint64_t> d_maxLive;
+    /** The size of the hash-consing table, including expired entries */
+    SizeStat<std::map<HashConsKey, std::weak_ptr<ProofNode>>> d_hashConsSize;
+  };
+  /** The memory statistics, null unless --stats-proof-memory is enabled */
+  std::unique_ptr<MemoryStatistics> d_memStats;
+  /**
+   * Return an existing proof node for the given rule, children and arguments
+   * that proves expected (if non-null), or null if none exists.
+   */
+  std::shared_ptr<ProofNode> getHashConsed(
+      const HashConsKey& key,
+      const std::vector<std::shared_ptr<ProofNode>>& children,
+      const std::vector<Node>& args,
+      const Node& expected);
   /** Check internal
    *
    * This returns the result of proof checking a ProofNode with the provided
@@ -17,6 +17,7 @@
 
 #include "prop/cadical.h"
 
+#include <algorithm>
 #include <cadical/cadical.hpp>
 #include <cadical/tracer.hpp>
 #include <deque>
@@ -25,6 +26,8 @@
 #include "options/base_options.h"
 #include "options/main_options.h"
 #include "options/proof_options.h"
+#include "options/smt_options.h"
+#include "prop/clause_exchange.h"
 #include "prop/sat_solver_types.h"
 #include "prop/theory_proxy.h"
 #include "util/resource_manager.h"
@@ -79,8 +82,13 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
   CadicalPropagator(prop::TheoryProxy* proxy,
                     context::Context* context,
                     CaDiCaL::Solver& solver,
-                    StatisticsRegistry& stats)
-      : d_proxy(proxy), d_context(*context), d_solver(solver), d_stats(stats)
+                    StatisticsRegistry& stats,
+                    bool observe_all)
+      : d_proxy(proxy),
+        d_context(*context),
+        d_solver(solver),
+        d_observe_all(observe_all),
+        d_stats(stats)
   {
     d_var_info.emplace_back();  // 0: Not used
   }
@@ -239,11 +247,8 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     // Backtrack decisions
     Assert(d_decisions.size() > level);
     Assert(d_context.getLevel() > level);
-    for (size_t cur_level = d_decisions.size(); cur_level > level; --cur_level)
-    {
-      d_context.pop();
-      d_decisions.pop_back();
-    }
+    d_context.popto(d_context.getLevel() - (d_decisions.size() - level));
+    d_decisions.resize(level);
 
     // Backtrack assignments, resend fixed theory literals that got backtracked
     Assert(!d_assignment_control.empty());
@@ -420,6 +425,15 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
         Trace("cadical::propagator") << "No solution found yet" << std::endl;
       }
     }
+    // Decisions on unobserved variables are left to the SAT solver, since
+    // CaDiCaL may have eliminated them.
+    if (!stopSearch && lit != undefSatLiteral
+        && !d_var_info[lit.getSatVariable()].is_observed)
+    {
+      Trace("cadical::propagator")
+          << "cb::decide: skip unobserved " << lit << std::endl;
+      lit = undefSatLiteral;
+    }
     if (!stopSearch && lit != undefSatLiteral)
     {
       if (!requirePhase)
@@ -597,8 +611,14 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     {
       SatVariable var = lit.getSatVariable();
       Assert(var < d_var_info.size());
-      const auto& info = d_var_info[var];
+      auto& info = d_var_info[var];
       Assert(info.is_active);
+      // Literals of lemmas are frozen from here on, since CaDiCaL expects
+      // all literals sent back to be observed.
+      if (!info.is_observed && d_in_search)
+      {
+        observe(var);
+      }
       if (info.is_fixed)
       {
         int32_t val = lit.isNegated() ? -info.assignment : info.assignment;
@@ -642,9 +662,10 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
    * @param var            The variable to add.
    * @param level          The current user assertion level.
    * @param is_theory_atom True if variable is a theory atom.
+   * @param can_erase      True if variable may be eliminated.
    * @param in_search      True if SAT solver is currently in search().
    */
-  void add_new_var(const SatVariable& var, bool is_theory_atom)
+  void add_new_var(const SatVariable& var, bool is_theory_atom, bool can_erase)
   {
     // Since activation literals are not tracked here, we have to make sure to
     // properly resize d_var_info.
@@ -654,18 +675,39 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     }
     Assert(d_var_info.size() == var);
 
-    // Boolean variables are not theory atoms, but may still occur in
-    // lemmas/conflicts sent to the SAT solver. Hence, we have to observe them
-    // since CaDiCaL expects all literals sent back to be observed.
-    d_solver.add_observed_var(toCadicalVar(var));
     d_active_vars.push_back(var);
     Trace("cadical::propagator")
         << "new var: " << var << " (level: " << current_user_level()
         << ", is_theory_atom: " << is_theory_atom
-        << ", in_search: " << d_in_search << ")" << std::endl;
+        << ", can_erase: " << can_erase << ", in_search: " << d_in_search
+        << ")" << std::endl;
     auto& info = d_var_info.emplace_back();
     info.level_intro = current_user_level();
     info.is_theory_atom = is_theory_atom;
+    // Boolean variables are not theory atoms, but may still occur in
+    // lemmas/conflicts sent to the SAT solver. Hence, we have to observe them
+    // since CaDiCaL expects all literals sent back to be observed. Observed
+    // variables are frozen, i.e., cannot be eliminated by CaDiCaL. If not all
+    // variables are observed, the erasable variables that are not theory atoms
+    // are only observed once they occur in a lemma, see add_clause().
+    if (d_observe_all || is_theory_atom || !can_erase || d_in_search)
+    {
+      observe(var);
+    }
+  }
+
+  /** Observe (and thus freeze) given variable. */
+  void observe(SatVariable var)
+  {
+    Assert(!d_var_info[var].is_observed);
+    d_solver.add_observed_var(toCadicalVar(var));
+    d_var_info[var].is_observed = true;
+  }
+
+  /** Return true if given variable is observed. */
+  bool is_observed(SatVariable var) const
+  {
+    return d_var_info[var].is_observed;
   }
 
   /**
@@ -766,7 +808,10 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
       {
         Trace("cadical::propagator") << "set inactive: " << var << std::endl;
         d_var_info[var].is_active = false;
-        d_solver.remove_observed_var(toCadicalVar(var));
+        if (info.is_observed)
+        {
+          d_solver.remove_observed_var(toCadicalVar(var));
+        }
         Assert(info.level_intro > user_level);
         // Fix value of inactive variables in order to avoid CaDiCaL from
         // deciding on them again. This make a huge difference in performance
@@ -921,12 +966,19 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
   context::Context& d_context;
   CaDiCaL::Solver& d_solver;
 
+  /**
+   * True if all variables are observed, false if only theory atoms,
+   * non-erasable variables and literals of lemmas are observed.
+   */
+  bool d_observe_all;
+
   /** Struct to store information on variables. */
   struct VarInfo
   {
     uint32_t level_intro = 0;     // user level at which variable was created
     uint32_t level_fixed = 0;     // user level at which variable was fixed
     bool is_theory_atom = false;  // is variable a theory atom
+    bool is_observed = false;     // is variable observed (and frozen)
     bool is_fixed = false;        // has variable fixed assignment
     bool is_active = true;        // is variable active
     int32_t assignment = 0;       // current variable assignment
@@ -1254,6 +1306,172 @@ class ProofTracer : public CaDiCaL::Tracer
   std::vector<uint64_t> d_final_clauses;
 };
 
+/**
+ * Streams the clausal proof of CaDiCaL in DRAT or LRAT format, in text or
+ * binary mode, while solving. Nothing is stored, the memory overhead is
+ * constant.
+ *
+ * The original clauses added before the first call to solve() are the input
+ * clauses of the proof and are not written. Original clauses added later
+ * (theory lemmas in CDCL(T) mode, clauses of later checks in incremental mode)
+ * and clauses restored after variable elimination are not implied by the
+ * input, they are written as additions without antecedents, i.e., trusted
+ * steps.
+ */
+class ClausalProofWriter : public CaDiCaL::Tracer
+{
+ public:
+  ClausalProofWriter(std::ostream& out, bool lrat, bool binary)
+      : d_out(out), d_lrat(lrat), d_binary(binary)
+  {
+  }
+
+  /** Notify that solving started, later original clauses are trusted. */
+  void notify_solve() { d_solving = true; }
+
+  void add_original_clause(uint64_t clause_id,
+                           bool redundant,
+                           const std::vector<int>& clause,
+                           bool restored) override
+  {
+    if (d_solving || restored)
+    {
+      write_addition(clause_id, clause, {});
+    }
+  }
+
+  void add_derived_clause(uint64_t clause_id,
+                          bool redundant,
+                          const std::vector<int>& clause,
+                          const std::vector<uint64_t>& antecedents) override
+  {
+    write_addition(clause_id, clause, antecedents);
+  }
+
+  void add_assumption_clause(uint64_t clause_id,
+                             const std::vector<int>& clause,
+                             const std::vector<uint64_t>& antecedents) override
+  {
+    write_addition(clause_id, clause, antecedents);
+  }
+
+  void delete_clause(uint64_t clause_id,
+                     bool redundant,
+                     const std::vector<int>& clause) override
+  {
+    if (d_binary)
+    {
+      d_out.put('d');
+      if (d_lrat)
+      {
+        write_binary(2 * clause_id);
+      }
+      else
+      {
+        write_binary_lits(clause);
+      }
+      d_out.put(0);
+      return;
+    }
+    if (d_lrat)
+    {
+      d_out << d_last_id << " d " << clause_id << " 0\n";
+    }
+    else
+    {
+      d_out << "d";
+      for (int lit : clause)
+      {
+        d_out << " " << lit;
+      }
+      d_out << " 0\n";
+    }
+  }
+
+  void conclude_unsat(CaDiCaL::ConclusionType type,
+                      const std::vector<uint64_t>& clause_ids) override
+  {
+    d_out.flush();
+  }
+
+ private:
+  /** Write the addition of a clause (trusted if it has no antecedents). */
+  void write_addition(uint64_t clause_id,
+                      const std::vector<int>& clause,
+                      const std::vector<uint64_t>& antecedents)
+  {
+    d_last_id = std::max(d_last_id, clause_id);
+    if (d_binary)
+    {
+      d_out.put('a');
+      if (d_lrat)
+      {
+        write_binary(2 * clause_id);
+      }
+      write_binary_lits(clause);
+      d_out.put(0);
+      if (d_lrat)
+      {
+        for (uint64_t id : antecedents)
+        {
+          write_binary(2 * id);
+        }
+        d_out.put(0);
+      }
+      return;
+    }
+    if (d_lrat)
+    {
+      d_out << clause_id << " ";
+    }
+    for (int lit : clause)
+    {
+      d_out << lit << " ";
+    }
+    d_out << "0";
+    if (d_lrat)
+    {
+      for (uint64_t id : antecedents)
+      {
+        d_out << " " << id;
+      }
+      d_out << " 0";
+    }
+    d_out << "\n";
+  }
+
+  /** Write the literals of a clause in binary mode. */
+  void write_binary_lits(const std::vector<int>& clause)
+  {
+    for (int lit : clause)
+    {
+      write_binary(2 * static_cast<uint64_t>(std::abs(lit)) + (lit < 0));
+    }
+  }
+
+  /** Write a number in the variable-length encoding of binary mode. */
+  void write_binary(uint64_t n)
+  {
+    while (n > 127)
+    {
+      d_out.put(static_cast<char>((n & 127) | 128));
+      n >>= 7;
+    }
+    d_out.put(static_cast<char>(n));
+  }
+
+  /** The output stream of the proof. */
+  std::ostream& d_out;
+  /** Whether to write LRAT (rather than DRAT). */
+  bool d_lrat;
+  /** Whether to write in binary mode. */
+  bool d_binary;
+  /** Whether solving started. */
+  bool d_solving = false;
+  /** The largest clause id so far, the step id of LRAT deletions. */
+  uint64_t d_last_id = 0;
+};
+
 class ClauseLearner : public CaDiCaL::Learner
 {
  public:
@@ -1290,6 +1508,101 @@ class ClauseLearner : public CaDiCaL::Learner
   int32_t d_max_clause_size;
 };
 
+/**
+ * Exports the short clauses learned by a CaDiCaL instance of a portfolio to a
+ * clause exchange, and imports the clauses learned by the other instances as
+ * external (forgettable) clauses. This is only used for instances without a
+ * CDCL(T) propagator.
+ *
+ * Note: CaDiCaL expects the literals of external clauses to be observed, which
+ *       freezes all variables of the instance.
+ */
+class ClauseSharer : public CaDiCaL::Learner,
+                     public CaDiCaL::ExternalPropagator
+{
+ public:
+  ClauseSharer(CaDiCaL::Solver& solver, ClauseExchange& exchange, size_t id)
+      : d_solver(solver), d_exchange(exchange), d_id(id)
+  {
+  }
+  ~ClauseSharer() override {}
+
+  /** Observe new variable, required for importing clauses over it. */
+  void add_new_var(SatVariable var)
+  {
+    d_solver.add_observed_var(toCadicalVar(var));
+  }
+
+  /* Learner interface ---------------------------------------------------- */
+
+  bool learning(int size) override
+  {
+    return static_cast<size_t>(size) <= d_exchange.getMaxSize();
+  }
+
+  void learn(int lit) override
+  {
+    if (lit)
+    {
+      d_clause.push_back(toSatLiteral(lit));
+    }
+    else
+    {
+      d_exchange.exportClause(d_id, d_clause);
+      d_clause.clear();
+    }
+  }
+
+  /* ExternalPropagator interface ----------------------------------------- */
+
+  void notify_assignment(const std::vector<int>& lits) override {}
+  void notify_new_decision_level() override {}
+  void notify_backtrack(size_t level) override {}
+  bool cb_check_found_model(const std::vector<int>& model) override
+  {
+    // Imported clauses are implied by the input, any model is a model.
+    return true;
+  }
+
+  bool cb_has_external_clause(bool& is_forgettable) override
+  {
+    if (d_new_clauses.empty() && d_exchange.hasNewClauses(d_id))
+    {
+      std::vector<SatClause> clauses;
+      d_exchange.importClauses(d_id, clauses);
+      for (const SatClause& clause : clauses)
+      {
+        for (const SatLiteral& lit : clause)
+        {
+          d_new_clauses.push_back(toCadicalLit(lit));
+        }
+        d_new_clauses.push_back(0);
+      }
+    }
+    is_forgettable = true;
+    return !d_new_clauses.empty();
+  }
+
+  int cb_add_external_clause_lit() override
+  {
+    Assert(!d_new_clauses.empty());
+    CadicalLit lit = d_new_clauses.front();
+    d_new_clauses.pop_front();
+    return lit;
+  }
+
+ private:
+  CaDiCaL::Solver& d_solver;
+  /** The clause exchange of the portfolio. */
+  ClauseExchange& d_exchange;
+  /** The index of this instance in the portfolio. */
+  size_t d_id;
+  /** Intermediate literals buffer of the learned clause. */
+  std::vector<SatLiteral> d_clause;
+  /** Imported clauses not yet added, separated by 0. */
+  std::deque<CadicalLit> d_new_clauses;
+};
+
 CadicalSolver::CadicalSolver(Env& env,
                              StatisticsRegistry& registry,
                              const std::string& name)
@@ -1350,6 +1663,10 @@ CadicalSolver::~CadicalSolver()
   {
     d_solver->disconnect_proof_tracer(d_proof_tracer.get());
   }
+  if (d_proof_writer != nullptr)
+  {
+    d_solver->disconnect_proof_tracer(d_proof_writer.get());
+  }
 }
 
 /**
@@ -1377,6 +1694,65 @@ void CadicalSolver::setResourceLimit(ResourceManager* resmgr)
   d_solver->connect_terminator(d_terminator.get());
 }
 
+/**
+ * Terminator class for the instances of a portfolio, which notifies CaDiCaL to
+ * terminate when the portfolio stops its instances or, if given, when the
+ * resource limit is reached.
+ */
+class PortfolioTerminator : public CaDiCaL::Terminator
+{
+ public:
+  PortfolioTerminator(const std::atomic<bool>& stop, ResourceManager* resmgr)
+      : d_stop(stop), d_resmgr(resmgr){};
+
+  bool terminate() override
+  {
+    if (d_stop)
+    {
+      return true;
+    }
+    if (d_resmgr == nullptr)
+    {
+      return false;
+    }
+    d_resmgr->spendResource(Resource::BvSatStep);
+    return d_resmgr->out();
+  }
+
+ private:
+  const std::atomic<bool>& d_stop;
+  ResourceManager* d_resmgr;
+};
+
+void CadicalSolver::setProofOutput(std::ostream& out)
+{
+  Assert(d_nextVarIdx == 1) << "must be called before init()";
+  bool lrat = options().proof.satProofFormat == options::SatProofFormat::LRAT;
+  d_proof_writer.reset(
+      new ClausalProofWriter(out, lrat, options().proof.dratBinaryFormat));
+  d_solver->connect_proof_tracer(d_proof_writer.get(), lrat);
+}
+
+void CadicalSolver::setPortfolioInstance(size_t id,
+                                         ClauseExchange* exchange,
+                                         const std::atomic<bool>& stop,
+                                         ResourceManager* resmgr)
+{
+  Assert(!d_propagator);
+  Assert(d_nextVarIdx == 1) << "must be called before init()";
+  d_terminator.reset(new PortfolioTerminator(stop, resmgr));
+  d_solver->connect_terminator(d_terminator.get());
+  // Diversify the search of the instances.
+  d_solver->set("seed", static_cast<int>(id));
+  d_solver->set("phase", id % 2 == 0 ? 1 : 0);
+  if (exchange != nullptr)
+  {
+    d_clause_sharer.reset(new ClauseSharer(*d_solver, *exchange, id));
+    d_solver->connect_learner(d_clause_sharer.get());
+    d_solver->connect_external_propagator(d_clause_sharer.get());
+  }
+}
+
 SatValue CadicalSolver::_solve(const std::vector<SatLiteral>& assumptions)
 {
   if (d_propagator)
@@ -1385,6 +1761,10 @@ SatValue CadicalSolver::_solve(const std::vector<SatLiteral>& assumptions)
     d_propagator->renotify_fixed();
   }
   TimerStat::CodeTimer codeTimer(d_statistics.d_solveTime);
+  if (d_proof_writer)
+  {
+    d_proof_writer->notify_solve();
+  }
   d_assumptions.clear();
   if (d_propagator)
   {
@@ -1488,7 +1868,11 @@ SatVariable CadicalSolver::newVar(bool isTheoryAtom, bool canErase)
   ++d_statistics.d_numVariables;
   if (d_propagator)
   {
-    d_propagator->add_new_var(d_nextVarIdx, isTheoryAtom);
+    d_propagator->add_new_var(d_nextVarIdx, isTheoryAtom, canErase);
+  }
+  else if (d_clause_sharer)
+  {
+    d_clause_sharer->add_new_var(d_nextVarIdx);
   }
   return d_nextVarIdx++;
 }
@@ -1529,7 +1913,15 @@ void CadicalSolver::getUnsatAssumptions(std::vector<SatLiteral>& assumptions)
 
 void CadicalSolver::interrupt() { d_solver->terminate(); }
 
-SatValue CadicalSolver::value(SatLiteral l) { return d_propagator->value(l); }
+SatValue CadicalSolver::value(SatLiteral l)
+{
+  // Unobserved variables are not notified, take their value from the model.
+  if (d_inSatMode && !d_propagator->is_observed(l.getSatVariable()))
+  {
+    return modelValue(l);
+  }
+  return d_propagator->value(l);
+}
 
 SatValue CadicalSolver::modelValue(SatLiteral l)
 {
@@ -1562,12 +1954,24 @@ void CadicalSolver::initialize(prop::TheoryProxy* theoryProxy,
 {
   d_proxy = theoryProxy;
   d_propagator.reset(new CadicalPropagator(
-      theoryProxy, d_context, *d_solver, statisticsRegistry()));
+      theoryProxy,
+      d_context,
+      *d_solver,
+      statisticsRegistry(),
+      !options().prop.cadicalInprocess));
   if (!d_env.getPlugins().empty())
   {
     d_clause_learner.reset(new ClauseLearner(*theoryProxy, 0));
     d_solver->connect_learner(d_clause_learner.get());
   }
+  else if (options().smt.deepRestartMode != options::DeepRestartMode::NONE
+           && options().smt.deepRestartClauseSize > 0)
+  {
+    // only the short clauses are kept for deep restarts
+    d_clause_learner.reset(new ClauseLearner(
+        *theoryProxy, static_cast<int32_t>(options().smt.deepRestartClauseSize)));
+    d_solver->connect_learner(d_clause_learner.get());
+  }
 
   if (d_env.isSatProofProducing())
   {
@@ -1586,7 +1990,7 @@ void CadicalSolver::push()
   // Set new activation literal for pushed user level
   // Note: This happens after the push to ensure that the activation literal's
   // introduction level is the current user level.
-  SatVariable alit = newVar(false);
+  SatVariable alit = newVar(false, false);
   d_propagator->set_activation_lit(alit);
 }
 
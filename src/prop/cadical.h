@@ -20,6 +20,9 @@
 #ifndef CVC5__PROP__CADICAL_H
 #define CVC5__PROP__CADICAL_H
 
+#include <atomic>
+#include <iosfwd>
+
 #include "context/cdhashset.h"
 #include "prop/sat_solver.h"
 #include "smt/env_obj.h"
@@ -33,7 +36,10 @@ namespace cvc5::internal {
 namespace prop {
 
 class CadicalPropagator;
+class ClausalProofWriter;
+class ClauseExchange;
 class ClauseLearner;
+class ClauseSharer;
 class ProofTracer;
 
 class CadicalSolver : public CDCLTSatSolver, protected EnvObj
@@ -118,6 +124,29 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
    */
   void setResourceLimit(ResourceManager* resmgr);
 
+  /**
+   * Stream the clausal proof of this solver to `out`, in the format given by
+   * the options --sat-proof-format and --drat-binary-format. Must be called
+   * before init().
+   * @param out The output stream of the proof.
+   */
+  void setProofOutput(std::ostream& out);
+
+  /**
+   * Configure this solver as the instance of index `id` of a portfolio.
+   * Diversifies its search and, if `exchange` is not null, shares learned
+   * clauses with the other instances. Must be called before init(), instead
+   * of setResourceLimit().
+   * @param id       The index of the instance in the portfolio.
+   * @param exchange The clause exchange of the portfolio, or null.
+   * @param stop     The flag of the portfolio to stop its instances.
+   * @param resmgr   The associated resource manager, or null.
+   */
+  void setPortfolioInstance(size_t id,
+                            ClauseExchange* exchange,
+                            const std::atomic<bool>& stop,
+                            ResourceManager* resmgr);
+
   SatValue _solve(const std::vector<SatLiteral>& assumptions);
 
   /** The wrapped CaDiCaL instance. */
@@ -135,6 +164,10 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
   std::unique_ptr<ClauseLearner> d_clause_learner;
   /** Proof tracer instance for extracting unsat cores. */
   std::unique_ptr<ProofTracer> d_proof_tracer;
+  /** Clausal proof writer instance (for --sat-proof-out). */
+  std::unique_ptr<ClausalProofWriter> d_proof_writer;
+  /** Clause sharer instance (for portfolio instances). */
+  std::unique_ptr<ClauseSharer> d_clause_sharer;
 
   /**
    * Stores the current set of assumptions provided via solve() and is used to
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Exchange of learned clauses between SAT solvers running in parallel.
+ */
+
+#include "prop/clause_exchange.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+ClauseExchange::ClauseExchange(size_t numSolvers, size_t maxSize)
+    : d_maxSize(maxSize),
+      d_cursors(numSolvers, 0),
+      d_numExported(0),
+      d_numSeen(numSolvers)
+{
+}
+
+void ClauseExchange::exportClause(size_t id, const SatClause& clause)
+{
+  Assert(id < d_cursors.size());
+  if (clause.empty() || clause.size() > d_maxSize)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(d_mutex);
+  d_clauses.emplace_back(id, clause);
+  ++d_numExported;
+}
+
+bool ClauseExchange::hasNewClauses(size_t id) const
+{
+  Assert(id < d_numSeen.size());
+  return d_numSeen[id] != d_numExported;
+}
+
+void ClauseExchange::importClauses(size_t id, std::vector<SatClause>& clauses)
+{
+  Assert(id < d_cursors.size());
+  std::lock_guard<std::mutex> lock(d_mutex);
+  d_numSeen[id] = d_numExported.load();
+  for (size_t i = d_cursors[id], size = d_clauses.size(); i < size; ++i)
+  {
+    if (d_clauses[i].first != id)
+    {
+      clauses.push_back(d_clauses[i].second);
+    }
+  }
+  d_cursors[id] = d_clauses.size();
+  // Discard the clauses imported by all solvers once they make up half of the
+  // pool, which keeps the cost of this amortized constant per clause.
+  size_t done = *std::min_element(d_cursors.begin(), d_cursors.end());
+  if (done > 0 && 2 * done >= d_clauses.size())
+  {
+    d_clauses.erase(d_clauses.begin(), d_clauses.begin() + done);
+    for (size_t& c : d_cursors)
+    {
+      c -= done;
+    }
+  }
+}
+
+}  // namespace prop
+}  // namespace cvc5::internal
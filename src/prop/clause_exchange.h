@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Exchange of learned clauses between SAT solvers running in parallel.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROP__CLAUSE_EXCHANGE_H
+#define CVC5__PROP__CLAUSE_EXCHANGE_H
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "prop/sat_solver_types.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+/**
+ * A pool of learned clauses shared by a fixed number of SAT solvers over the
+ * same variables, each identified by an index. Every solver exports the
+ * short clauses it learns and periodically imports the clauses exported by
+ * the other solvers since its last import.
+ *
+ * All methods are thread-safe. Clauses that were imported by all solvers are
+ * discarded from the pool.
+ */
+class ClauseExchange
+{
+ public:
+  /**
+   * @param numSolvers The number of solvers sharing clauses.
+   * @param maxSize    The maximum size of the exchanged clauses.
+   */
+  ClauseExchange(size_t numSolvers, size_t maxSize);
+
+  /** Get the maximum size of the exchanged clauses. */
+  size_t getMaxSize() const { return d_maxSize; }
+
+  /** Export clause learned by solver `id`, ignored if it is too long. */
+  void exportClause(size_t id, const SatClause& clause);
+
+  /**
+   * Return true if clauses were exported since the last call to
+   * importClauses() by solver `id`. This does not lock the pool.
+   */
+  bool hasNewClauses(size_t id) const;
+
+  /**
+   * Append the clauses exported by the other solvers since the last import of
+   * solver `id` to `clauses`.
+   */
+  void importClauses(size_t id, std::vector<SatClause>& clauses);
+
+  /** Get the total number of exported clauses. */
+  size_t getNumExported() const { return d_numExported; }
+
+ private:
+  /** The maximum size of the exchanged clauses. */
+  size_t d_maxSize;
+  /** Protects d_clauses and d_cursors. */
+  std::mutex d_mutex;
+  /** The clauses in the pool, with the index of their exporting solver. */
+  std::vector<std::pair<size_t, SatClause>> d_clauses;
+  /** The index of the first clause in d_clauses not imported by a solver. */
+  std::vector<size_t> d_cursors;
+  /** The total number of exported clauses. */
+  std::atomic<size_t> d_numExported;
+  /** The value of d_numExported at the last import of a solver. */
+  std::vector<std::atomic<size_t>> d_numSeen;
+};
+
+}  // namespace prop
+}  // namespace cvc5::internal
+
+#endif  // CVC5__PROP__CLAUSE_EXCHANGE_H
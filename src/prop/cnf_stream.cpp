@@ -15,12 +15,16 @@
  */
 #include "prop/cnf_stream.h"
 
+#include <algorithm>
 #include <queue>
+#include <tuple>
+#include <unordered_set>
 
 #include "base/check.h"
 #include "base/output.h"
 #include "expr/node.h"
 #include "options/bv_options.h"
+#include "options/prop_options.h"
 #include "printer/printer.h"
 #include "proof/clause_id.h"
 #include "prop/minisat/minisat.h"
@@ -45,12 +49,25 @@ CnfStream::CnfStream(Env& env,
       d_notifyFormulas(c),
       d_nodeToLiteralMap(c),
       d_literalToNodeMap(c),
+      d_gates(c),
+      d_gatePolarity(c),
       d_flitPolicy(flpol),
       d_registrar(registrar),
       d_name(name),
       d_removable(false),
+      d_structHash(false),
+      d_polarityAware(false),
       d_stats(statisticsRegistry(), name)
 {
+  // Gates may only share literals and be partially defined if their literals
+  // are internal to the SAT solver, and if the clauses are not justified by
+  // a proof CNF stream
+  if ((flpol == FormulaLitPolicy::INTERNAL || flpol == FormulaLitPolicy::TRACK)
+      && !d_env.isSatProofProducing())
+  {
+    d_structHash = options().prop.cnfStructHash;
+    d_polarityAware = options().prop.cnfPolarity;
+  }
 }
 
 bool CnfStream::assertClause(TNode node, SatClause& c)
@@ -117,7 +134,7 @@ void CnfStream::ensureLiteral(TNode n)
       n.getType().toString().c_str());
   Trace("cnf") << "ensureLiteral(" << n << ")\n";
   TimerStat::CodeTimer codeTimer(d_stats.d_cnfConversionTime, true);
-  if (hasLiteral(n))
+  if (isDefined(n, POL_BOTH))
   {
     ensureMappingForLiteral(n);
     return;
@@ -303,9 +320,86 @@ SatLiteral CnfStream::getLiteral(TNode node) {
   return literal;
 }
 
-void CnfStream::handleXor(TNode xorNode)
+namespace {
+
+/** Swap the positive and the negative polarity in pol */
+uint32_t flipPolarity(uint32_t pol)
+{
+  return ((pol & 1) << 1) | ((pol & 2) >> 1);
+}
+
+}  // namespace
+
+uint32_t CnfStream::getDefinedPolarity(SatLiteral lit) const
+{
+  if (!d_polarityAware)
+  {
+    return POL_BOTH;
+  }
+  auto it = d_gatePolarity.find(lit.getSatVariable());
+  if (it == d_gatePolarity.end())
+  {
+    return POL_BOTH;
+  }
+  return lit.isNegated() ? flipPolarity(it->second) : it->second;
+}
+
+void CnfStream::addDefinedPolarity(SatLiteral lit, uint32_t pol)
+{
+  if (!d_polarityAware)
+  {
+    return;
+  }
+  pol = lit.isNegated() ? flipPolarity(pol) : pol;
+  SatVariable v = lit.getSatVariable();
+  auto it = d_gatePolarity.find(v);
+  uint32_t prev = it == d_gatePolarity.end() ? 0 : it->second;
+  d_gatePolarity.insert(v, prev | pol);
+}
+
+bool CnfStream::isDefined(TNode node, uint32_t pol) const
+{
+  NodeToLiteralMap::const_iterator it = d_nodeToLiteralMap.find(node);
+  if (it == d_nodeToLiteralMap.end())
+  {
+    return false;
+  }
+  return (getDefinedPolarity((*it).second) & pol) == pol;
+}
+
+void CnfStream::mapToLiteral(TNode node, SatLiteral lit)
+{
+  Assert(!hasLiteral(node));
+  d_nodeToLiteralMap.insert(node, lit);
+  d_nodeToLiteralMap.insert(node.notNode(), ~lit);
+}
+
+SatLiteral CnfStream::getGateLiteral(TNode node,
+                                     uint32_t pol,
+                                     uint32_t& missing)
+{
+  SatLiteral lit;
+  if (hasLiteral(node))
+  {
+    Assert(d_polarityAware) << "Atom already mapped!";
+    lit = getLiteral(node);
+    missing = pol & ~getDefinedPolarity(lit);
+  }
+  else
+  {
+    lit = newLiteral(node);
+    if (d_polarityAware)
+    {
+      d_gatePolarity.insert(lit.getSatVariable(), 0);
+    }
+    missing = pol;
+  }
+  addDefinedPolarity(lit, missing);
+  return lit;
+}
+
+void CnfStream::handleXor(TNode xorNode, uint32_t pol)
 {
-  Assert(!hasLiteral(xorNode)) << "Atom already mapped!";
   Assert(xorNode.getKind() == Kind::XOR) << "Expecting an XOR expression!";
   Assert(xorNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -314,17 +408,23 @@ void CnfStream::handleXor(TNode xorNode)
   SatLiteral a = getLiteral(xorNode[0]);
   SatLiteral b = getLiteral(xorNode[1]);
 
-  SatLiteral xorLit = newLiteral(xorNode);
+  uint32_t missing;
+  SatLiteral xorLit = getGateLiteral(xorNode, pol, missing);
 
-  assertClause(xorNode.negate(), a, b, ~xorLit);
-  assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
-  assertClause(xorNode, a, ~b, xorLit);
-  assertClause(xorNode, ~a, b, xorLit);
+  if (missing & POL_POS)
+  {
+    assertClause(xorNode.negate(), a, b, ~xorLit);
+    assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
+  }
+  if (missing & POL_NEG)
+  {
+    assertClause(xorNode, a, ~b, xorLit);
+    assertClause(xorNode, ~a, b, xorLit);
+  }
 }
 
-void CnfStream::handleOr(TNode orNode)
+void CnfStream::handleOr(TNode orNode, uint32_t pol)
 {
-  Assert(!hasLiteral(orNode)) << "Atom already mapped!";
   Assert(orNode.getKind() == Kind::OR) << "Expecting an OR expression!";
   Assert(orNode.getNumChildren() > 1) << "Expecting more then 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -334,7 +434,8 @@ void CnfStream::handleOr(TNode orNode)
   size_t numChildren = orNode.getNumChildren();
 
   // Get the literal for this node
-  SatLiteral orLit = newLiteral(orNode);
+  uint32_t missing;
+  SatLiteral orLit = getGateLiteral(orNode, pol, missing);
 
   // Transform all the children first
   SatClause clause(numChildren + 1);
@@ -345,19 +446,24 @@ void CnfStream::handleOr(TNode orNode)
     // lit <- (a_1 | a_2 | a_3 | ... | a_n)
     // lit | ~(a_1 | a_2 | a_3 | ... | a_n)
     // (lit | ~a_1) & (lit | ~a_2) & (lit & ~a_3) & ... & (lit & ~a_n)
-    assertClause(orNode, orLit, ~clause[i]);
+    if (missing & POL_NEG)
+    {
+      assertClause(orNode, orLit, ~clause[i]);
+    }
   }
 
   // lit -> (a_1 | a_2 | a_3 | ... | a_n)
   // ~lit | a_1 | a_2 | a_3 | ... | a_n
   clause[numChildren] = ~orLit;
   // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(orNode.negate(), clause);
+  if (missing & POL_POS)
+  {
+    assertClause(orNode.negate(), clause);
+  }
 }
 
-void CnfStream::handleAnd(TNode andNode)
+void CnfStream::handleAnd(TNode andNode, uint32_t pol)
 {
-  Assert(!hasLiteral(andNode)) << "Atom already mapped!";
   Assert(andNode.getKind() == Kind::AND) << "Expecting an AND expression!";
   Assert(andNode.getNumChildren() > 1) << "Expecting more than 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -367,7 +473,8 @@ void CnfStream::handleAnd(TNode andNode)
   size_t numChildren = andNode.getNumChildren();
 
   // Get the literal for this node
-  SatLiteral andLit = newLiteral(andNode);
+  uint32_t missing;
+  SatLiteral andLit = getGateLiteral(andNode, pol, missing);
 
   // Transform all the children first (remembering the negation)
   SatClause clause(numChildren + 1);
@@ -378,7 +485,10 @@ void CnfStream::handleAnd(TNode andNode)
     // lit -> (a_1 & a_2 & a_3 & ... & a_n)
     // ~lit | (a_1 & a_2 & a_3 & ... & a_n)
     // (~lit | a_1) & (~lit | a_2) & ... & (~lit | a_n)
-    assertClause(andNode.negate(), ~andLit, ~clause[i]);
+    if (missing & POL_POS)
+    {
+      assertClause(andNode.negate(), ~andLit, ~clause[i]);
+    }
   }
 
   // lit <- (a_1 & a_2 & a_3 & ... a_n)
@@ -386,12 +496,152 @@ void CnfStream::handleAnd(TNode andNode)
   // lit | ~a_1 | ~a_2 | ~a_3 | ... | ~a_n
   clause[numChildren] = andLit;
   // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(andNode, clause);
+  if (missing & POL_NEG)
+  {
+    assertClause(andNode, clause);
+  }
 }
 
-void CnfStream::handleImplies(TNode impliesNode)
+void CnfStream::collectGateInputs(
+    TNode node, std::vector<std::pair<TNode, bool>>& inputs) const
+{
+  Assert(node.getKind() == Kind::AND || node.getKind() == Kind::OR);
+  // a disjunction is the negation of the conjunction of the negated children
+  bool negated = node.getKind() == Kind::OR;
+  // the formulas that were already visited, positively and negatively
+  std::unordered_set<TNode> visited[2];
+  std::vector<std::pair<TNode, bool>> visit;
+  for (size_t i = 0, size = node.getNumChildren(); i < size; ++i)
+  {
+    visit.emplace_back(node[size - 1 - i], negated);
+  }
+  while (!visit.empty())
+  {
+    auto [cur, neg] = visit.back();
+    visit.pop_back();
+    while (cur.getKind() == Kind::NOT)
+    {
+      cur = cur[0];
+      neg = !neg;
+    }
+    if (!visited[neg].insert(cur).second)
+    {
+      continue;
+    }
+    Kind k = cur.getKind();
+    if (!hasLiteral(cur)
+        && ((k == Kind::AND && !neg) || (k == Kind::OR && neg)))
+    {
+      for (size_t i = 0, size = cur.getNumChildren(); i < size; ++i)
+      {
+        visit.emplace_back(cur[size - 1 - i], neg);
+      }
+    }
+    else
+    {
+      inputs.emplace_back(cur, neg);
+    }
+  }
+}
+
+void CnfStream::handleGate(TNode node,
+                           uint32_t pol,
+                           const std::vector<std::pair<TNode, bool>>& inputs)
+{
+  Assert(node.getKind() == Kind::AND || node.getKind() == Kind::OR);
+  Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
+  Trace("cnf") << "handleGate(" << node << ")\n";
+
+  // we clausify node as the conjunction of the inputs, or as the negation of
+  // it if node is a disjunction
+  bool isAnd = node.getKind() == Kind::AND;
+  uint32_t gatePol = isAnd ? pol : flipPolarity(pol);
+  SatClause inputLits;
+  for (const std::pair<TNode, bool>& in : inputs)
+  {
+    SatLiteral lit = getLiteral(in.first);
+    inputLits.push_back(in.second ? ~lit : lit);
+  }
+  std::sort(inputLits.begin(), inputLits.end());
+  inputLits.erase(std::unique(inputLits.begin(), inputLits.end()),
+                  inputLits.end());
+  Assert(!inputLits.empty());
+  // a conjunction containing complementary literals is false
+  bool isFalse = false;
+  for (size_t i = 1, size = inputLits.size(); i < size; ++i)
+  {
+    if (inputLits[i].getSatVariable() == inputLits[i - 1].getSatVariable())
+    {
+      isFalse = true;
+      break;
+    }
+  }
+
+  SatLiteral gateLit;
+  bool isNew = false;
+  if (hasLiteral(node))
+  {
+    Assert(d_polarityAware) << "Atom already mapped!";
+    gateLit = isAnd ? getLiteral(node) : ~getLiteral(node);
+  }
+  else if (inputLits.size() == 1)
+  {
+    // the gate is equivalent to its input, which is already defined for the
+    // polarities of the gate
+    mapToLiteral(node, isAnd ? inputLits[0] : ~inputLits[0]);
+    return;
+  }
+  else
+  {
+    auto it = d_gates.find(inputLits);
+    if (it != d_gates.end())
+    {
+      gateLit = it->second;
+      mapToLiteral(node, isAnd ? gateLit : ~gateLit);
+      ++d_stats.d_numSharedGates;
+    }
+    else
+    {
+      SatLiteral lit = newLiteral(node);
+      gateLit = isAnd ? lit : ~lit;
+      d_gates.insert(inputLits, gateLit);
+      isNew = true;
+      if (d_polarityAware)
+      {
+        d_gatePolarity.insert(lit.getSatVariable(), 0);
+      }
+    }
+  }
+  if (inputLits.size() == 1)
+  {
+    return;
+  }
+  uint32_t missing = isNew ? gatePol : gatePol & ~getDefinedPolarity(gateLit);
+  addDefinedPolarity(gateLit, missing);
+
+  // gate -> (a_1 & a_2 & ... & a_n)
+  if (missing & POL_POS)
+  {
+    for (const SatLiteral& lit : inputLits)
+    {
+      assertClause(node, ~gateLit, lit);
+    }
+  }
+  // (a_1 & a_2 & ... & a_n) -> gate, which is trivial if the gate is false
+  if ((missing & POL_NEG) && !isFalse)
+  {
+    SatClause clause(inputLits.size() + 1);
+    for (size_t i = 0, size = inputLits.size(); i < size; ++i)
+    {
+      clause[i] = ~inputLits[i];
+    }
+    clause[inputLits.size()] = gateLit;
+    assertClause(node, clause);
+  }
+}
+
+void CnfStream::handleImplies(TNode impliesNode, uint32_t pol)
 {
-  Assert(!hasLiteral(impliesNode)) << "Atom already mapped!";
   Assert(impliesNode.getKind() == Kind::IMPLIES)
       << "Expecting an IMPLIES expression!";
   Assert(impliesNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
@@ -402,22 +652,28 @@ void CnfStream::handleImplies(TNode impliesNode)
   SatLiteral a = getLiteral(impliesNode[0]);
   SatLiteral b = getLiteral(impliesNode[1]);
 
-  SatLiteral impliesLit = newLiteral(impliesNode);
+  uint32_t missing;
+  SatLiteral impliesLit = getGateLiteral(impliesNode, pol, missing);
 
   // lit -> (a->b)
   // ~lit | ~ a | b
-  assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  if (missing & POL_POS)
+  {
+    assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  }
 
   // (a->b) -> lit
   // ~(~a | b) | lit
   // (a | l) & (~b | l)
-  assertClause(impliesNode, a, impliesLit);
-  assertClause(impliesNode, ~b, impliesLit);
+  if (missing & POL_NEG)
+  {
+    assertClause(impliesNode, a, impliesLit);
+    assertClause(impliesNode, ~b, impliesLit);
+  }
 }
 
-void CnfStream::handleIff(TNode iffNode)
+void CnfStream::handleIff(TNode iffNode, uint32_t pol)
 {
-  Assert(!hasLiteral(iffNode)) << "Atom already mapped!";
   Assert(iffNode.getKind() == Kind::EQUAL) << "Expecting an EQUAL expression!";
   Assert(iffNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -428,26 +684,32 @@ void CnfStream::handleIff(TNode iffNode)
   SatLiteral b = getLiteral(iffNode[1]);
 
   // Get the now literal
-  SatLiteral iffLit = newLiteral(iffNode);
+  uint32_t missing;
+  SatLiteral iffLit = getGateLiteral(iffNode, pol, missing);
 
   // lit -> ((a-> b) & (b->a))
   // ~lit | ((~a | b) & (~b | a))
   // (~a | b | ~lit) & (~b | a | ~lit)
-  assertClause(iffNode.negate(), ~a, b, ~iffLit);
-  assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  if (missing & POL_POS)
+  {
+    assertClause(iffNode.negate(), ~a, b, ~iffLit);
+    assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  }
 
   // (a<->b) -> lit
   // ~((a & b) | (~a & ~b)) | lit
   // (~(a & b)) & (~(~a & ~b)) | lit
   // ((~a | ~b) & (a | b)) | lit
   // (~a | ~b | lit) & (a | b | lit)
-  assertClause(iffNode, ~a, ~b, iffLit);
-  assertClause(iffNode, a, b, iffLit);
+  if (missing & POL_NEG)
+  {
+    assertClause(iffNode, ~a, ~b, iffLit);
+    assertClause(iffNode, a, b, iffLit);
+  }
 }
 
-void CnfStream::handleIte(TNode iteNode)
+void CnfStream::handleIte(TNode iteNode, uint32_t pol)
 {
-  Assert(!hasLiteral(iteNode)) << "Atom already mapped!";
   Assert(iteNode.getKind() == Kind::ITE);
   Assert(iteNode.getNumChildren() == 3);
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -458,7 +720,8 @@ void CnfStream::handleIte(TNode iteNode)
   SatLiteral thenLit = getLiteral(iteNode[1]);
   SatLiteral elseLit = getLiteral(iteNode[2]);
 
-  SatLiteral iteLit = newLiteral(iteNode);
+  uint32_t missing;
+  SatLiteral iteLit = getGateLiteral(iteNode, pol, missing);
 
   // If ITE is true then one of the branches is true and the condition
   // implies which one
@@ -466,9 +729,12 @@ void CnfStream::handleIte(TNode iteNode)
   // lit -> (t | e) & (b -> t) & (!b -> e)
   // lit -> (t | e) & (!b | t) & (b | e)
   // (!lit | t | e) & (!lit | !b | t) & (!lit | b | e)
-  assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
-  assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
-  assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  if (missing & POL_POS)
+  {
+    assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
+    assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
+    assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  }
 
   // If ITE is false then one of the branches is false and the condition
   // implies which one
@@ -476,74 +742,137 @@ void CnfStream::handleIte(TNode iteNode)
   // !lit -> (!t | !e) & (b -> !t) & (!b -> !e)
   // !lit -> (!t | !e) & (!b | !t) & (b | !e)
   // (lit | !t | !e) & (lit | !b | !t) & (lit | b | !e)
-  assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
-  assertClause(iteNode, iteLit, ~condLit, ~thenLit);
-  assertClause(iteNode, iteLit, condLit, ~elseLit);
+  if (missing & POL_NEG)
+  {
+    assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
+    assertClause(iteNode, iteLit, ~condLit, ~thenLit);
+    assertClause(iteNode, iteLit, condLit, ~elseLit);
+  }
 }
 
-SatLiteral CnfStream::toCNF(TNode node, bool negated)
+SatLiteral CnfStream::toCNF(TNode node, bool negated, uint32_t pol)
 {
   Trace("cnf") << "toCNF(" << node
                << ", negated = " << (negated ? "true" : "false") << ")\n";
 
+  if (!d_polarityAware)
+  {
+    pol = POL_BOTH;
+  }
   TNode cur;
+  uint32_t curPol;
   SatLiteral nodeLit;
-  std::vector<TNode> visit;
-  std::unordered_map<TNode, bool> cache;
-
-  visit.push_back(node);
+  // the nodes to visit, with the polarities in which they are used
+  std::vector<std::pair<TNode, uint32_t>> visit;
+  // the polarities (as bit 1 << pol) for which a node was visited
+  std::unordered_map<TNode, uint32_t> cache;
+  // the inputs of the gates, if d_structHash is true
+  std::unordered_map<TNode, std::vector<std::pair<TNode, bool>>> gateInputs;
+
+  visit.emplace_back(node, negated ? flipPolarity(pol) : pol);
   while (!visit.empty())
   {
-    cur = visit.back();
+    std::tie(cur, curPol) = visit.back();
     Assert(cur.getType().isBoolean());
 
-    if (hasLiteral(cur))
+    if (isDefined(cur, curPol))
     {
       visit.pop_back();
       continue;
     }
 
-    const auto& it = cache.find(cur);
-    if (it == cache.end())
-    {
-      cache.emplace(cur, false);
-      Kind k = cur.getKind();
-      // Only traverse Boolean nodes
-      if (k == Kind::NOT || k == Kind::XOR || k == Kind::ITE
-          || k == Kind::IMPLIES || k == Kind::OR || k == Kind::AND
-          || (k == Kind::EQUAL && cur[0].getType().isBoolean()))
-      {
-        // Preserve the order of the recursive version
-        for (size_t i = 0, size = cur.getNumChildren(); i < size; ++i)
-        {
-          visit.push_back(cur[size - 1 - i]);
-        }
-      }
-      continue;
-    }
-    else if (!it->second)
+    uint32_t& visited = cache[cur];
+    Kind k = cur.getKind();
+    if (!(visited & (1 << curPol)))
     {
-      it->second = true;
-      Kind k = cur.getKind();
+      visited |= 1 << curPol;
+      // Only traverse Boolean nodes, preserving the order of the recursive
+      // version
       switch (k)
       {
-        case Kind::NOT: Assert(hasLiteral(cur[0])); break;
-        case Kind::XOR: handleXor(cur); break;
-        case Kind::ITE: handleIte(cur); break;
-        case Kind::IMPLIES: handleImplies(cur); break;
-        case Kind::OR: handleOr(cur); break;
-        case Kind::AND: handleAnd(cur); break;
-        default:
-          if (k == Kind::EQUAL && cur[0].getType().isBoolean())
+        case Kind::NOT: visit.emplace_back(cur[0], flipPolarity(curPol)); break;
+        case Kind::AND:
+        case Kind::OR:
+          if (d_structHash)
           {
-            handleIff(cur);
+            std::vector<std::pair<TNode, bool>>& inputs = gateInputs[cur];
+            inputs.clear();
+            collectGateInputs(cur, inputs);
+            uint32_t gatePol = k == Kind::AND ? curPol : flipPolarity(curPol);
+            for (size_t i = 0, size = inputs.size(); i < size; ++i)
+            {
+              const std::pair<TNode, bool>& in = inputs[size - 1 - i];
+              visit.emplace_back(in.first,
+                                 in.second ? flipPolarity(gatePol) : gatePol);
+            }
           }
           else
           {
-            convertAtom(cur);
+            for (size_t i = 0, size = cur.getNumChildren(); i < size; ++i)
+            {
+              visit.emplace_back(cur[size - 1 - i], curPol);
+            }
+          }
+          break;
+        case Kind::IMPLIES:
+          visit.emplace_back(cur[1], curPol);
+          visit.emplace_back(cur[0], flipPolarity(curPol));
+          break;
+        case Kind::ITE:
+          visit.emplace_back(cur[2], curPol);
+          visit.emplace_back(cur[1], curPol);
+          visit.emplace_back(cur[0], POL_BOTH);
+          break;
+        case Kind::XOR:
+          visit.emplace_back(cur[1], POL_BOTH);
+          visit.emplace_back(cur[0], POL_BOTH);
+          break;
+        default:
+          if (k == Kind::EQUAL && cur[0].getType().isBoolean())
+          {
+            visit.emplace_back(cur[1], POL_BOTH);
+            visit.emplace_back(cur[0], POL_BOTH);
           }
           break;
       }
+      continue;
+    }
+    switch (k)
+    {
+      case Kind::NOT: Assert(hasLiteral(cur[0])); break;
+      case Kind::XOR: handleXor(cur, curPol); break;
+      case Kind::ITE: handleIte(cur, curPol); break;
+      case Kind::IMPLIES: handleImplies(cur, curPol); break;
+      case Kind::OR:
+        if (d_structHash)
+        {
+          handleGate(cur, curPol, gateInputs[cur]);
+        }
+        else
+        {
+          handleOr(cur, curPol);
+        }
+        break;
+      case Kind::AND:
+        if (d_structHash)
+        {
+          handleGate(cur, curPol, gateInputs[cur]);
+        }
+        else
+        {
+          handleAnd(cur, curPol);
+        }
+        break;
+      default:
+        if (k == Kind::EQUAL && cur[0].getType().isBoolean())
+        {
+          handleIff(cur, curPol);
+        }
+        else
+        {
+          convertAtom(cur);
+        }
+        break;
     }
     visit.pop_back();
   }
@@ -572,7 +901,7 @@ void CnfStream::convertAndAssertAnd(TNode node, bool negated)
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, true);
+      clause[i] = toCNF(*disjunct, true, POL_POS);
     }
     Assert(disjunct == node.end());
     assertClause(node.negate(), clause);
@@ -591,7 +920,7 @@ void CnfStream::convertAndAssertOr(TNode node, bool negated)
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, false);
+      clause[i] = toCNF(*disjunct, false, POL_POS);
     }
     Assert(disjunct == node.end());
     assertClause(node, clause);
@@ -679,8 +1008,8 @@ void CnfStream::convertAndAssertImplies(TNode node, bool negated)
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   if (!negated) {
     // p => q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_NEG);
+    SatLiteral q = toCNF(node[1], false, POL_POS);
     // Construct the clause ~p || q
     SatClause clause(2);
     clause[0] = ~p;
@@ -700,8 +1029,8 @@ void CnfStream::convertAndAssertIte(TNode node, bool negated)
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   // ITE(p, q, r)
   SatLiteral p = toCNF(node[0], false);
-  SatLiteral q = toCNF(node[1], negated);
-  SatLiteral r = toCNF(node[2], negated);
+  SatLiteral q = toCNF(node[1], negated, POL_POS);
+  SatLiteral r = toCNF(node[2], negated, POL_POS);
   // Construct the clauses:
   // (p => q) and (!p => r)
   //
@@ -763,7 +1092,7 @@ void CnfStream::convertAndAssert(TNode node, bool negated)
         nnode = node.negate();
       }
       // Atoms
-      assertClause(nnode, toCNF(node, negated));
+      assertClause(nnode, toCNF(node, negated, POL_POS));
   }
     break;
   }
@@ -773,7 +1102,8 @@ CnfStream::Statistics::Statistics(StatisticsRegistry& sr,
                                   const std::string& name)
     : d_cnfConversionTime(
         sr.registerTimer(name + "::CnfStream::cnfConversionTime")),
-      d_numAtoms(sr.registerInt(name + "::CnfStream::numAtoms"))
+      d_numAtoms(sr.registerInt(name + "::CnfStream::numAtoms")),
+      d_numSharedGates(sr.registerInt(name + "::CnfStream::numSharedGates"))
 {
 }
 
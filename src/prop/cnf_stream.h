@@ -26,8 +26,9 @@
 #ifndef CVC5__PROP__CNF_STREAM_H
 #define CVC5__PROP__CNF_STREAM_H
 
+#include "context/cddense_map.h"
+#include "context/cdhashmap.h"
 #include "context/cdhashset.h"
-#include "context/cdinsert_hashmap.h"
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "prop/registrar.h"
@@ -58,6 +59,12 @@ enum class FormulaLitPolicy : uint32_t
   INTERNAL,
 };
 
+/** Helper for indexing dense maps by node ids, see context::CDDenseMap. */
+struct NodeIdIndexFunction
+{
+  size_t operator()(const Node& node) const { return node.getId(); }
+};
+
 /**
  * Implements the following recursive algorithm
  * http://people.inf.ethz.ch/daniekro/classes/251-0247-00/f2007/readings/Tseitin70.pdf
@@ -73,12 +80,17 @@ class CnfStream : protected EnvObj
   friend ProofCnfStream;
 
  public:
-  /** Cache of what nodes have been registered to a literal. */
-  typedef context::CDInsertHashMap<SatLiteral, TNode, SatLiteralHashFunction>
+  /**
+   * Cache of what nodes have been registered to a literal. It is indexed by
+   * the literals, which are dense, since it is queried for each propagation
+   * and explanation of the theory proxy.
+   */
+  typedef context::CDDenseMap<SatLiteral, TNode, SatLiteralIndexFunction>
       LiteralToNodeMap;
 
-  /** Cache of what literals have been registered to a node. */
-  typedef context::CDInsertHashMap<Node, SatLiteral> NodeToLiteralMap;
+  /** Cache of what literals have been registered to a node, by node id. */
+  typedef context::CDDenseMap<Node, SatLiteral, NodeIdIndexFunction>
+      NodeToLiteralMap;
 
   /**
    * Constructs a CnfStream that performs equisatisfiable CNF transformations
@@ -220,6 +232,20 @@ class CnfStream : protected EnvObj
   void convertAndAssertImplies(TNode node, bool negated);
   void convertAndAssertIte(TNode node, bool negated);
 
+  /**
+   * The polarities in which a literal of a formula is used, as a bit mask.
+   * If the literal is used positively, the clauses must ensure that the
+   * literal implies the formula. If it is used negatively, they must ensure
+   * that the formula implies the literal. Unless d_polarityAware is true, the
+   * clauses of all formulas are generated for both polarities.
+   */
+  enum Polarity : uint32_t
+  {
+    POL_POS = 1,
+    POL_NEG = 2,
+    POL_BOTH = 3
+  };
+
   /**
    * Transforms the node into CNF recursively and yields a literal
    * definitionally equal to it.
@@ -230,20 +256,51 @@ class CnfStream : protected EnvObj
    *
    * @param node the formula to transform
    * @param negated whether the literal is negated
+   * @param pol the polarities in which the returned literal is used
    * @return the literal representing the root of the formula
    */
-  SatLiteral toCNF(TNode node, bool negated = false);
+  SatLiteral toCNF(TNode node, bool negated = false, uint32_t pol = POL_BOTH);
 
   /**
    * Specific clausifiers that clausify a formula based on the given formula
-   * kind and introduce a literal definitionally equal to it.
+   * kind and introduce a literal definitionally equal to it. Only the clauses
+   * for the polarities in pol that were not generated before are asserted.
+   */
+  void handleXor(TNode node, uint32_t pol);
+  void handleImplies(TNode node, uint32_t pol);
+  void handleIff(TNode node, uint32_t pol);
+  void handleIte(TNode node, uint32_t pol);
+  void handleAnd(TNode node, uint32_t pol);
+  void handleOr(TNode node, uint32_t pol);
+  /**
+   * Clausifies the AND or OR node as the n-ary conjunction of the given
+   * inputs, see collectGateInputs. Nodes whose inputs have the same literals
+   * share the literal of their gate.
+   */
+  void handleGate(TNode node,
+                  uint32_t pol,
+                  const std::vector<std::pair<TNode, bool>>& inputs);
+  /**
+   * Collect the inputs of the AND or OR node, seen as a conjunction, by
+   * flattening the nested conjunctions that have no literal yet. An input is
+   * a pair of a formula and whether it is negated in the conjunction.
+   */
+  void collectGateInputs(TNode node,
+                         std::vector<std::pair<TNode, bool>>& inputs) const;
+  /**
+   * Get the literal of the gate node, making a new one if necessary, and
+   * compute the polarities in pol for which no clauses have been generated.
+   * These polarities are marked as generated.
    */
-  void handleXor(TNode node);
-  void handleImplies(TNode node);
-  void handleIff(TNode node);
-  void handleIte(TNode node);
-  void handleAnd(TNode node);
-  void handleOr(TNode node);
+  SatLiteral getGateLiteral(TNode node, uint32_t pol, uint32_t& missing);
+  /** Get the polarities for which the definition of lit has been asserted */
+  uint32_t getDefinedPolarity(SatLiteral lit) const;
+  /** Mark that the definition of lit has been asserted for the polarities */
+  void addDefinedPolarity(SatLiteral lit, uint32_t pol);
+  /** Does node have a literal whose definition covers the polarities? */
+  bool isDefined(TNode node, uint32_t pol) const;
+  /** Map node to the existing literal lit */
+  void mapToLiteral(TNode node, SatLiteral lit);
 
   /** Stores the literal of the given node in d_literalToNodeMap.
    *
@@ -328,6 +385,19 @@ class CnfStream : protected EnvObj
   /** Map from literals to nodes */
   LiteralToNodeMap d_literalToNodeMap;
 
+  /**
+   * Map from the sorted inputs of the n-ary conjunctions to the literal of
+   * their gate, if d_structHash is true.
+   */
+  context::CDHashMap<SatClause, SatLiteral, SatClauseHashFunction> d_gates;
+
+  /**
+   * The polarities for which the definitions of the gate variables have been
+   * asserted, if d_polarityAware is true. Variables not in this map are fully
+   * defined.
+   */
+  context::CDHashMap<SatVariable, uint32_t> d_gatePolarity;
+
   /**
    * True if the lit-to-Node map should be kept for all lits, not just
    * theory lits.  This is true if e.g. replay logging is on, which
@@ -352,6 +422,15 @@ class CnfStream : protected EnvObj
   /** Pointer to resource manager for associated SolverEngine */
   ResourceManager* d_resourceManager;
 
+  /** Whether to flatten and structurally hash AND and OR gates */
+  bool d_structHash;
+
+  /**
+   * Whether to generate the clauses of gates only for the polarities in which
+   * they are used (Plaisted-Greenbaum encoding).
+   */
+  bool d_polarityAware;
+
  private:
   struct Statistics
   {
@@ -359,6 +438,8 @@ class CnfStream : protected EnvObj
     TimerStat d_cnfConversionTime;
     /** Number of atoms */
     IntStat d_numAtoms;
+    /** Number of formulas that reused the literal of an existing gate */
+    IntStat d_numSharedGates;
   };
   /** Statistics */
   Statistics d_stats;
@@ -22,8 +22,10 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include <math.h>
 
+#include <algorithm>
 #include <iostream>
 #include <unordered_set>
+#include <vector>
 
 #include "base/check.h"
 #include "base/output.h"
@@ -141,6 +143,7 @@ Solver::Solver(Env& env,
       d_proxy(proxy),
       d_context(context),
       assertionLevel(0),
+      maxClauseLevel(0),
       d_pfManager(nullptr),
       d_enable_incremental(enableIncremental),
       minisat_busy(false)
@@ -187,7 +190,10 @@ Solver::Solver(Env& env,
       clauses_literals(0),
       learnts_literals(0),
       max_literals(0),
-      tot_literals(0)
+      tot_literals(0),
+      inprocessings(0),
+      vivified_clauses(0),
+      subsumed_clauses(0)
 
       ,
       ok(true),
@@ -199,7 +205,9 @@ Solver::Solver(Env& env,
       simpDB_props(0),
       order_heap(VarOrderLt(activity)),
       progress_estimate(0),
-      remove_satisfied(!enableIncremental)
+      remove_satisfied(!enableIncremental),
+      inprocess_conflicts(0),
+      inprocess_props(0)
 
       // Resource constraints:
       //
@@ -597,6 +605,7 @@ void Solver::attachClause(CRef cr) {
       Trace("minisat") << ", level " << c.level() << "\n";
     }
     Assert(c.size() > 1);
+    if (c.level() > maxClauseLevel) maxClauseLevel = c.level();
     watches[~c[0]].push(Watcher(cr, c[1]));
     watches[~c[1]].push(Watcher(cr, c[0]));
     if (c.removable()) learnts_literals += c.size();
@@ -688,11 +697,8 @@ void Solver::cancelUntil(int level) {
 
     if (decisionLevel() > level)
     {
-      // Pop the SMT context
-      for (int l = trail_lim.size() - level; l > 0; --l)
-      {
-        d_context->pop();
-      }
+      // Pop the SMT context, all levels at once
+      d_context->popto(d_context->getLevel() - (trail_lim.size() - level));
         for (int c = trail.size()-1; c >= trail_lim[level]; c--){
             Var      x  = var(trail[c]);
             assigns [x] = l_Undef;
@@ -1415,11 +1421,7 @@ void Solver::removeClausesAboveLevel(vec<CRef>& cs, int level)
     for (i = j = 0; i < cs.size(); i++){
         Clause& c = ca[cs[i]];
         if (c.level() > level) {
-          SatClause satClause;
-          vec<Lit> clauseLits;
-          MinisatSatSolver::toSatClause(c, satClause);
-          MinisatSatSolver::toMinisatClause(satClause, clauseLits);
-          Assert(!locked(c)) << "Locked " << clauseLits;
+          Assert(!locked(c)) << "Locked clause of level " << c.level();
           removeClause(cs[i]);
         } else {
             cs[j++] = cs[i];
@@ -1428,6 +1430,222 @@ void Solver::removeClausesAboveLevel(vec<CRef>& cs, int level)
     cs.shrink(i - j);
 }
 
+/*_________________________________________________________________________________________________
+|
+|  inprocess : ()  ->  [void]
+|
+|  Description:
+|    Vivify the removable clauses (learnt clauses and removable lemmas), most active first, and
+|    remove the removable clauses subsumed by another clause. Must be called at decision level 0
+|    after propagation. The effort spent on vivification is bounded by a fraction of the
+|    propagations since the last call.
+|
+|    The strengthened clauses are only implied by the current clause database, so they are added
+|    at the current assertion level. Since they are not justified, this is not done when
+|    producing proofs.
+|________________________________________________________________________________________________@*/
+void Solver::inprocess()
+{
+  Assert(decisionLevel() == 0);
+  Assert(qhead == trail.size());
+  inprocessings++;
+  int64_t budget =
+      std::max<int64_t>((propagations - inprocess_props) / 10, 10000);
+  int64_t limit = propagations + budget;
+
+  sort(clauses_removable, [this](CRef x, CRef y) {
+    return ca[x].activity() > ca[y].activity();
+  });
+  vec<Lit> out_clause;
+  for (int i = 0; i < clauses_removable.size() && propagations < limit; i++)
+  {
+    CRef cr = clauses_removable[i];
+    {
+      Clause& c = ca[cr];
+      if (c.size() <= 2 || locked(c) || satisfied(c))
+      {
+        continue;
+      }
+    }
+    if (!vivify(cr, out_clause))
+    {
+      continue;
+    }
+    vivified_clauses++;
+    float act = ca[cr].activity();
+    CRef ncr = ca.alloc(assertionLevel, out_clause, true);
+    ca[ncr].activity() = act;
+    attachClause(ncr);
+    // the old clause was detached by vivify
+    ca[cr].mark(1);
+    ca.free(cr);
+    clauses_removable[i] = ncr;
+    SatClause satClause;
+    MinisatSatSolver::toSatClause(ca[ncr], satClause);
+    d_proxy->notifySatClause(satClause);
+  }
+
+  subsumeRemovable();
+  checkGarbage();
+  inprocess_conflicts = conflicts;
+  inprocess_props = propagations;
+}
+
+bool Solver::vivify(CRef cr, vec<Lit>& out_clause)
+{
+  vec<Lit> lits;
+  for (int i = 0; i < ca[cr].size(); i++)
+  {
+    lits.push(ca[cr][i]);
+  }
+  // the clause must not propagate itself
+  detachClause(cr, true);
+
+  // Assign the negation of the literals one by one. A literal that becomes
+  // false is implied to be false by the negation of the previous literals and
+  // can be removed. The clause is implied as soon as a literal becomes true or
+  // propagation fails.
+  out_clause.clear();
+  for (int i = 0; i < lits.size(); i++)
+  {
+    lbool val = value(lits[i]);
+    if (val == l_False)
+    {
+      continue;
+    }
+    out_clause.push(lits[i]);
+    if (val == l_True)
+    {
+      break;
+    }
+    newDecisionLevel();
+    uncheckedEnqueue(~lits[i]);
+    if (propagateBool() != CRef_Undef)
+    {
+      break;
+    }
+  }
+
+  // Backtrack, without changing the saved phases.
+  vec<Var> assigned;
+  vec<char> saved_polarity;
+  for (int i = trail_lim.size() > 0 ? trail_lim[0] : trail.size();
+       i < trail.size();
+       i++)
+  {
+    assigned.push(var(trail[i]));
+    saved_polarity.push(polarity[var(trail[i])]);
+  }
+  cancelUntil(0);
+  for (int i = 0; i < assigned.size(); i++)
+  {
+    polarity[assigned[i]] = saved_polarity[i];
+  }
+
+  // Units are not learnt here, since they would have to be propagated.
+  if (out_clause.size() < 2 || out_clause.size() == lits.size())
+  {
+    attachClause(cr);
+    return false;
+  }
+  return true;
+}
+
+void Solver::subsumeRemovable()
+{
+  // occurrence lists of the clauses that may be removed
+  std::vector<std::vector<CRef>> occurs(2 * nVars());
+  for (int i = 0; i < clauses_removable.size(); i++)
+  {
+    const Clause& c = ca[clauses_removable[i]];
+    if (!locked(c))
+    {
+      for (int j = 0; j < c.size(); j++)
+      {
+        occurs[toInt(c[j])].push_back(clauses_removable[i]);
+      }
+    }
+  }
+  // try all clauses as subsumers, shortest first
+  std::vector<CRef> subsumers;
+  for (int i = 0; i < clauses_persistent.size(); i++)
+  {
+    subsumers.push_back(clauses_persistent[i]);
+  }
+  for (int i = 0; i < clauses_removable.size(); i++)
+  {
+    subsumers.push_back(clauses_removable[i]);
+  }
+  std::sort(subsumers.begin(), subsumers.end(), [this](CRef x, CRef y) {
+    return ca[x].size() < ca[y].size();
+  });
+
+  std::vector<char> marked(2 * nVars(), 0);
+  int64_t steps = 10 * (clauses_literals + learnts_literals);
+  for (CRef cr : subsumers)
+  {
+    if (steps < 0)
+    {
+      break;
+    }
+    const Clause& c = ca[cr];
+    if (c.mark() != 0)
+    {
+      continue;
+    }
+    // only the clauses containing the least frequent literal of c can be
+    // subsumed by c
+    int best = toInt(c[0]);
+    for (int i = 0; i < c.size(); i++)
+    {
+      marked[toInt(c[i])] = 1;
+      if (occurs[toInt(c[i])].size() < occurs[best].size())
+      {
+        best = toInt(c[i]);
+      }
+    }
+    for (CRef dr : occurs[best])
+    {
+      Clause& d = ca[dr];
+      // require that c lives as long as d
+      if (dr == cr || d.mark() != 0 || d.size() < c.size()
+          || c.level() > d.level())
+      {
+        continue;
+      }
+      int count = 0;
+      for (int i = 0; i < d.size(); i++)
+      {
+        count += marked[toInt(d[i])];
+      }
+      steps -= d.size();
+      if (count == c.size())
+      {
+        if (c.removable() && ca[cr].activity() < d.activity())
+        {
+          ca[cr].activity() = d.activity();
+        }
+        removeClause(dr);
+        subsumed_clauses++;
+      }
+    }
+    for (int i = 0; i < c.size(); i++)
+    {
+      marked[toInt(c[i])] = 0;
+    }
+  }
+
+  int i, j;
+  for (i = j = 0; i < clauses_removable.size(); i++)
+  {
+    if (ca[clauses_removable[i]].mark() == 0)
+    {
+      clauses_removable[j++] = clauses_removable[i];
+    }
+  }
+  clauses_removable.shrink(i - j);
+}
+
 void Solver::rebuildOrderHeap()
 {
     vec<Var> vs;
@@ -1633,6 +1851,15 @@ lbool Solver::search(int nof_conflicts)
         return l_False;
       }
 
+      // Periodically strengthen the set of learnt clauses:
+      uint64_t interval = options().prop.minisatInprocessInterval;
+      if (interval > 0 && decisionLevel() == 0
+          && conflicts - inprocess_conflicts >= (int64_t)interval
+          && !isProofEnabled())
+      {
+        inprocess();
+      }
+
       if (clauses_removable.size() - nAssigns() >= max_learnts)
       {
         // Reduce the set of learnt clauses:
@@ -1976,9 +2203,15 @@ void Solver::pop()
   // The head should be at the trail top
   qhead = trail.size();
 
-  // Remove the clauses
-  removeClausesAboveLevel(clauses_persistent, assertionLevel);
-  removeClausesAboveLevel(clauses_removable, assertionLevel);
+  // Remove the clauses, unless none was added above the current level, which
+  // avoids scanning all clauses on every pop, e.g., when checking
+  // satisfiability repeatedly under assumptions that are literals
+  if (maxClauseLevel > assertionLevel)
+  {
+    removeClausesAboveLevel(clauses_persistent, assertionLevel);
+    removeClausesAboveLevel(clauses_removable, assertionLevel);
+    maxClauseLevel = assertionLevel;
+  }
   Trace("minisat") << cvc5::internal::pop;
   // Pop the SAT context to notify everyone
   d_context->pop();  // SAT context for cvc5
@@ -2174,6 +2407,17 @@ inline bool Solver::withinBudget(Resource r) const
   return within_budget;
 }
 
+uint64_t Solver::memoryUsage() const
+{
+  // the clause arena, two watchers per clause and the per-variable data
+  uint64_t res = static_cast<uint64_t>(ca.allocated()) * sizeof(uint32_t);
+  res += static_cast<uint64_t>(nClauses() + nLearnts()) * 2 * sizeof(Watcher);
+  res += static_cast<uint64_t>(nVars())
+         * (sizeof(VarData) + sizeof(double) + sizeof(lbool) + sizeof(Lit)
+            + 2 * sizeof(vec<Watcher>) + 3 * sizeof(char));
+  return res;
+}
+
 SatProofManager* Solver::getProofManager()
 {
   return isProofEnabled() ? d_pfManager.get() : nullptr;
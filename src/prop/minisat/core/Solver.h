@@ -81,6 +81,12 @@ class Solver : protected EnvObj
   /** The current assertion level (user) */
   int assertionLevel;
 
+  /**
+   * An upper bound on the (user) levels of the attached clauses, which is
+   * used to skip the removal of clauses on pop when there are none to remove.
+   */
+  int maxClauseLevel;
+
   /** Variable representing true */
   Var varTrue;
 
@@ -288,6 +294,9 @@ public:
 
  const std::vector<Node> getMiniSatOrderHeap();
 
+ // Return the activity of a variable.
+ double getActivity(Var x) const { return activity[x]; }
+
  // Read state:
  //
  lbool value(Var x) const;  // The current value of a variable.
@@ -302,6 +311,7 @@ public:
  int nClauses() const;  // The current number of original clauses.
  int nLearnts() const;  // The current number of learnt clauses.
  int nVars() const;     // The current number of variables.
+ uint64_t memoryUsage() const;  // An estimate of the memory used in bytes.
  int nFreeVars() const;
  bool isDecision(Var x) const;  // is the given var a decision?
 
@@ -370,6 +380,7 @@ public:
      resources_consumed;
  int64_t dec_vars, clauses_literals, learnts_literals, max_literals,
      tot_literals;
+ int64_t inprocessings, vivified_clauses, subsumed_clauses;
 
 protected:
 
@@ -479,6 +490,8 @@ protected:
     double              max_learnts;
     double              learntsize_adjust_confl;
     int                 learntsize_adjust_cnt;
+    int64_t             inprocess_conflicts;  // Number of conflicts at the last call to 'inprocess()'.
+    int64_t             inprocess_props;      // Number of propagations at the last call to 'inprocess()'.
 
     // Resource contraints:
     //
@@ -509,6 +522,9 @@ protected:
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
+    void     inprocess        ();                                                      // Vivify and subsume the removable clauses.
+    bool     vivify           (CRef cr, vec<Lit>& out_clause);                         // Compute a subclause of 'cr' implied by the other clauses.
+    void     subsumeRemovable ();                                                      // Remove the removable clauses subsumed by another clause.
     void     rebuildOrderHeap ();
 
     // Maintaining Variable/Clause activity:
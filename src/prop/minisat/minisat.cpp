@@ -246,6 +246,11 @@ void MinisatSatSolver::getUnsatAssumptions(
   }
 }
 
+uint64_t MinisatSatSolver::getMemoryUsage() const
+{
+  return d_minisat->memoryUsage();
+}
+
 bool MinisatSatSolver::ok() const {
   return d_minisat->okay();
 }
@@ -303,6 +308,11 @@ std::vector<Node> MinisatSatSolver::getOrderHeap() const
   return d_minisat->getMiniSatOrderHeap();
 }
 
+double MinisatSatSolver::getActivity(SatVariable var) const
+{
+  return d_minisat->getActivity(var);
+}
+
 std::shared_ptr<ProofNode> MinisatSatSolver::getProof()
 {
   Assert(d_env.isSatProofProducing());
@@ -343,7 +353,13 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry& registry)
       d_statMaxLiterals(
           registry.registerReference<int64_t>("sat::max_literals")),
       d_statTotLiterals(
-          registry.registerReference<int64_t>("sat::tot_literals"))
+          registry.registerReference<int64_t>("sat::tot_literals")),
+      d_statInprocessings(
+          registry.registerReference<int64_t>("sat::inprocessings")),
+      d_statVivifiedClauses(
+          registry.registerReference<int64_t>("sat::vivified_clauses")),
+      d_statSubsumedClauses(
+          registry.registerReference<int64_t>("sat::subsumed_clauses"))
 {
 }
 
@@ -357,6 +373,9 @@ void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* minisat){
   d_statLearntsLiterals.set(minisat->learnts_literals);
   d_statMaxLiterals.set(minisat->max_literals);
   d_statTotLiterals.set(minisat->tot_literals);
+  d_statInprocessings.set(minisat->inprocessings);
+  d_statVivifiedClauses.set(minisat->vivified_clauses);
+  d_statSubsumedClauses.set(minisat->subsumed_clauses);
 }
 void MinisatSatSolver::Statistics::deinit()
 {
@@ -369,6 +388,9 @@ void MinisatSatSolver::Statistics::deinit()
   d_statLearntsLiterals.reset();
   d_statMaxLiterals.reset();
   d_statTotLiterals.reset();
+  d_statInprocessings.reset();
+  d_statVivifiedClauses.reset();
+  d_statSubsumedClauses.reset();
 }
 
 }  // namespace prop
@@ -67,6 +67,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
 
   bool ok() const override;
 
+  uint64_t getMemoryUsage() const override;
+
   void interrupt() override;
 
   SatValue value(SatLiteral l) override;
@@ -98,6 +100,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
    */
   std::vector<Node> getOrderHeap() const override;
 
+  double getActivity(SatVariable var) const override;
+
   /** Retrieve a pointer to the underlying solver. */
   Minisat::SimpSolver* getSolver() { return d_minisat; }
 
@@ -128,7 +132,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
    ReferenceStat<int64_t> d_statRndDecisions, d_statPropagations;
    ReferenceStat<int64_t> d_statConflicts, d_statClausesLiterals;
    ReferenceStat<int64_t> d_statLearntsLiterals, d_statMaxLiterals;
-   ReferenceStat<int64_t> d_statTotLiterals;
+   ReferenceStat<int64_t> d_statTotLiterals, d_statInprocessings;
+   ReferenceStat<int64_t> d_statVivifiedClauses, d_statSubsumedClauses;
 
   public:
    Statistics(StatisticsRegistry& registry);
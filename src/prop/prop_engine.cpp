@@ -21,6 +21,7 @@
 
 #include "base/check.h"
 #include "base/output.h"
+#include "context/context_stats.h"
 #include "expr/skolem_manager.h"
 #include "options/base_options.h"
 #include "options/decision_options.h"
@@ -98,12 +99,15 @@ PropEngine::PropEngine(Env& env, TheoryEngine* te)
   // CNF stream and theory proxy required pointers to each other, make the
   // theory proxy first
   d_theoryProxy = new TheoryProxy(d_env, this, d_theoryEngine, d_skdm.get());
-  d_cnfStream = new CnfStream(env,
-                              d_satSolver,
-                              d_theoryProxy,
-                              userContext,
-                              FormulaLitPolicy::TRACK,
-                              "prop");
+  {
+    context::ContextStatistics::OwnerScope owner("CnfStream");
+    d_cnfStream = new CnfStream(env,
+                                d_satSolver,
+                                d_theoryProxy,
+                                userContext,
+                                FormulaLitPolicy::TRACK,
+                                "prop");
+  }
 
   // connect theory proxy
   d_theoryProxy->finishInit(d_satSolver, d_cnfStream);
@@ -115,6 +119,8 @@ PropEngine::PropEngine(Env& env, TheoryEngine* te)
   }
   // connect SAT solver
   d_satSolver->initialize(d_theoryProxy, d_ppm.get());
+  resourceManager()->registerMemoryAccount(
+      "sat", [this]() { return d_satSolver->getMemoryUsage(); });
 }
 
 void PropEngine::finishInit()
@@ -126,6 +132,7 @@ void PropEngine::finishInit()
 
 PropEngine::~PropEngine() {
   Trace("prop") << "Destructing the PropEngine" << std::endl;
+  resourceManager()->unregisterMemoryAccount("sat");
   delete d_cnfStream;
   delete d_satSolver;
   delete d_theoryProxy;
@@ -502,6 +509,10 @@ Result PropEngine::checkSat() {
     {
       why = UnknownExplanation::RESOURCEOUT;
     }
+    if (rm->outOfMemory())
+    {
+      why = UnknownExplanation::MEMOUT;
+    }
     outputIncompleteReason(why);
     return Result(Result::UNKNOWN, why);
   }
@@ -846,6 +857,11 @@ std::vector<Node> PropEngine::getLearnedZeroLevelLiteralsForRestart() const
   return d_theoryProxy->getLearnedZeroLevelLiteralsForRestart();
 }
 
+const std::vector<Node>& PropEngine::getLearnedClausesForRestart() const
+{
+  return d_theoryProxy->getLearnedClausesForRestart();
+}
+
 modes::LearnedLitType PropEngine::getLiteralType(const Node& lit) const
 {
   return d_theoryProxy->getLiteralType(lit);
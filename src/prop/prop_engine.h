@@ -357,6 +357,8 @@ class PropEngine : protected EnvObj
 
   /** Get the zero-level assertions that should be used on deep restart */
   std::vector<Node> getLearnedZeroLevelLiteralsForRestart() const;
+  /** Get the learned clauses that should be used on deep restart */
+  const std::vector<Node>& getLearnedClausesForRestart() const;
 
   /** Get the literal type through the ZLL utilities */
   modes::LearnedLitType getLiteralType(const Node& lit) const;
@@ -114,6 +114,12 @@ public:
   /** Check if the solver is in an inconsistent state */
   virtual bool ok() const = 0;
 
+  /**
+   * Returns an estimate of the memory used by this solver in bytes, or zero
+   * if the solver does not provide one.
+   */
+  virtual uint64_t getMemoryUsage() const { return 0; }
+
   /**
    * Get list of unsatisfiable assumptions.
    *
@@ -174,6 +180,12 @@ class CDCLTSatSolver : public SatSolver
    */
   virtual std::vector<SatLiteral> getDecisions() const = 0;
 
+  /**
+   * Return the activity of the variable in the decision heuristic of the SAT
+   * solver, or 0 if the SAT solver does not provide activities.
+   */
+  virtual double getActivity(SatVariable var) const { return 0.0; }
+
   /**
    * Return the order heap of the SAT solver, which is a priority queueue
    * of literals ordered with respect to variable activity.
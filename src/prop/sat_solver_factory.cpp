@@ -15,10 +15,13 @@
 
 #include "prop/sat_solver_factory.h"
 
+#include "options/bv_options.h"
+#include "options/proof_options.h"
 #include "prop/cadical.h"
 #include "prop/cryptominisat.h"
 #include "prop/kissat.h"
 #include "prop/minisat/minisat.h"
+#include "prop/sat_solver_portfolio.h"
 
 namespace cvc5::internal {
 namespace prop {
@@ -53,11 +56,41 @@ CDCLTSatSolver* SatSolverFactory::createCadical(Env& env,
                                                 const std::string& name)
 {
   CadicalSolver* res = new CadicalSolver(env, registry, name);
+  // with eager bit-blasting, this solver does the propositional reasoning
+  const Options& opts = env.getOptions();
+  if (opts.proof.satProofOutWasSetByUser
+      && opts.bv.bitblastMode == options::BitblastMode::EAGER)
+  {
+    res->setProofOutput(*opts.proof.satProofOut);
+  }
   res->init();
   res->setResourceLimit(resmgr);
   return res;
 }
 
+SatSolver* SatSolverFactory::createCadicalPortfolio(Env& env,
+                                                   StatisticsRegistry& registry,
+                                                   ResourceManager* resmgr,
+                                                   size_t numThreads,
+                                                   size_t shareSize,
+                                                   const std::string& name)
+{
+  auto create = [&](size_t id,
+                    ClauseExchange* exchange,
+                    const std::atomic<bool>& stop) -> SatSolver* {
+    // the first instance keeps the statistics names of the solver
+    std::string iname =
+        id == 0 ? name : name + "portfolio" + std::to_string(id) + "::";
+    CadicalSolver* res = new CadicalSolver(env, registry, iname);
+    // the resource manager is not thread-safe, only the first instance may
+    // spend resources
+    res->setPortfolioInstance(id, exchange, stop, id == 0 ? resmgr : nullptr);
+    res->init();
+    return res;
+  };
+  return new SatSolverPortfolio(numThreads, shareSize, create);
+}
+
 CDCLTSatSolver* SatSolverFactory::createCadicalCDCLT(
     Env& env,
     StatisticsRegistry& registry,
@@ -65,6 +98,12 @@ CDCLTSatSolver* SatSolverFactory::createCadicalCDCLT(
     const std::string& name)
 {
   CadicalSolver* res = new CadicalSolver(env, registry, name);
+  const Options& opts = env.getOptions();
+  if (opts.proof.satProofOutWasSetByUser
+      && opts.bv.bitblastMode != options::BitblastMode::EAGER)
+  {
+    res->setProofOutput(*opts.proof.satProofOut);
+  }
   res->setResourceLimit(resmgr);
   return res;
 }
@@ -40,6 +40,18 @@ class SatSolverFactory
                                        ResourceManager* resmgr,
                                        const std::string& name = "");
 
+  /**
+   * Create a portfolio of numThreads differently seeded CaDiCaL instances
+   * solving in parallel, which exchange their learned clauses of size at most
+   * shareSize (no clauses are exchanged if shareSize is 0).
+   */
+  static SatSolver* createCadicalPortfolio(Env& env,
+                                           StatisticsRegistry& registry,
+                                           ResourceManager* resmgr,
+                                           size_t numThreads,
+                                           size_t shareSize,
+                                           const std::string& name = "");
+
   static CDCLTSatSolver* createCadicalCDCLT(Env& env,
                                             StatisticsRegistry& registry,
                                             ResourceManager* resmgr,
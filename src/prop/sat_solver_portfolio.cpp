@@ -0,0 +1,186 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A portfolio of SAT solvers running in parallel.
+ */
+
+#include "prop/sat_solver_portfolio.h"
+
+#include <mutex>
+#include <thread>
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+SatSolverPortfolio::SatSolverPortfolio(size_t numSolvers,
+                                       size_t shareSize,
+                                       const SolverCreator& create)
+    : d_winner(0), d_stop(false)
+{
+  Assert(numSolvers > 0);
+  if (numSolvers > 1 && shareSize > 0)
+  {
+    d_exchange.reset(new ClauseExchange(numSolvers, shareSize));
+  }
+  for (size_t i = 0; i < numSolvers; ++i)
+  {
+    d_solvers.emplace_back(create(i, d_exchange.get(), d_stop));
+  }
+}
+
+SatSolverPortfolio::~SatSolverPortfolio() {}
+
+ClauseId SatSolverPortfolio::addClause(SatClause& clause, bool removable)
+{
+  ClauseId res = ClauseIdUndef;
+  for (std::unique_ptr<SatSolver>& s : d_solvers)
+  {
+    // copy, since solvers may modify the clause
+    SatClause c = clause;
+    res = s->addClause(c, removable);
+  }
+  return res;
+}
+
+ClauseId SatSolverPortfolio::addXorClause(SatClause& clause,
+                                          bool rhs,
+                                          bool removable)
+{
+  ClauseId res = ClauseIdUndef;
+  for (std::unique_ptr<SatSolver>& s : d_solvers)
+  {
+    SatClause c = clause;
+    res = s->addXorClause(c, rhs, removable);
+  }
+  return res;
+}
+
+SatVariable SatSolverPortfolio::newVar(bool isTheoryAtom, bool canErase)
+{
+  SatVariable res = d_solvers[0]->newVar(isTheoryAtom, canErase);
+  for (size_t i = 1, size = d_solvers.size(); i < size; ++i)
+  {
+    CVC5_UNUSED SatVariable v = d_solvers[i]->newVar(isTheoryAtom, canErase);
+    Assert(v == res) << "solvers of portfolio disagree on variables";
+  }
+  return res;
+}
+
+SatVariable SatSolverPortfolio::trueVar()
+{
+  SatVariable res = d_solvers[0]->trueVar();
+  for (size_t i = 1, size = d_solvers.size(); i < size; ++i)
+  {
+    CVC5_UNUSED SatVariable v = d_solvers[i]->trueVar();
+    Assert(v == res) << "solvers of portfolio disagree on variables";
+  }
+  return res;
+}
+
+SatVariable SatSolverPortfolio::falseVar()
+{
+  SatVariable res = d_solvers[0]->falseVar();
+  for (size_t i = 1, size = d_solvers.size(); i < size; ++i)
+  {
+    CVC5_UNUSED SatVariable v = d_solvers[i]->falseVar();
+    Assert(v == res) << "solvers of portfolio disagree on variables";
+  }
+  return res;
+}
+
+SatValue SatSolverPortfolio::solve() { return solveParallel({}); }
+
+SatValue SatSolverPortfolio::solve(long unsigned int&)
+{
+  Unimplemented() << "Setting limits for the portfolio is not supported";
+  return SAT_VALUE_UNKNOWN;
+}
+
+SatValue SatSolverPortfolio::solve(const std::vector<SatLiteral>& assumptions)
+{
+  return solveParallel(assumptions);
+}
+
+SatValue SatSolverPortfolio::solveParallel(
+    const std::vector<SatLiteral>& assumptions)
+{
+  d_stop = false;
+  if (d_solvers.size() == 1)
+  {
+    d_winner = 0;
+    return assumptions.empty() ? d_solvers[0]->solve()
+                               : d_solvers[0]->solve(assumptions);
+  }
+  std::mutex mutex;
+  bool done = false;
+  SatValue res = SAT_VALUE_UNKNOWN;
+  auto run = [&](size_t i) {
+    SatValue r = assumptions.empty() ? d_solvers[i]->solve()
+                                     : d_solvers[i]->solve(assumptions);
+    // Only the first solver answers unknown if it was not stopped, e.g., when
+    // running out of resources.
+    if (r == SAT_VALUE_UNKNOWN && i != 0)
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!done)
+    {
+      done = true;
+      d_winner = i;
+      res = r;
+      d_stop = true;
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1, size = d_solvers.size(); i < size; ++i)
+  {
+    threads.emplace_back(run, i);
+  }
+  // the first solver runs on the calling thread
+  run(0);
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+  return res;
+}
+
+void SatSolverPortfolio::getUnsatAssumptions(
+    std::vector<SatLiteral>& assumptions)
+{
+  d_solvers[d_winner]->getUnsatAssumptions(assumptions);
+}
+
+void SatSolverPortfolio::interrupt() { d_stop = true; }
+
+SatValue SatSolverPortfolio::value(SatLiteral l)
+{
+  return d_solvers[d_winner]->value(l);
+}
+
+SatValue SatSolverPortfolio::modelValue(SatLiteral l)
+{
+  return d_solvers[d_winner]->modelValue(l);
+}
+
+uint32_t SatSolverPortfolio::getAssertionLevel() const
+{
+  return d_solvers[0]->getAssertionLevel();
+}
+
+bool SatSolverPortfolio::ok() const { return d_solvers[d_winner]->ok(); }
+
+}  // namespace prop
+}  // namespace cvc5::internal
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A portfolio of SAT solvers running in parallel.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROP__SAT_SOLVER_PORTFOLIO_H
+#define CVC5__PROP__SAT_SOLVER_PORTFOLIO_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "prop/clause_exchange.h"
+#include "prop/sat_solver.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+/**
+ * A SAT solver that runs several (differently configured) SAT solvers over
+ * the same clauses in parallel, one per thread, and takes the result of the
+ * first solver that finishes. The other solvers are then interrupted.
+ *
+ * All clauses and variables are added to all solvers, which must therefore
+ * assign the same indices to new variables. The solvers may share learned
+ * clauses through a clause exchange owned by the portfolio. Model values and
+ * unsat assumptions are taken from the solver that answered the last solve
+ * call.
+ *
+ * The solvers are stopped through a flag owned by the portfolio rather than
+ * through SatSolver::interrupt(), since a solver may be interrupted before
+ * its thread has even started solving.
+ *
+ * Note: Only the first solver should be connected to the resource manager,
+ *       which is not thread-safe. It is then the only solver answering
+ *       SAT_VALUE_UNKNOWN on its own.
+ */
+class SatSolverPortfolio : public SatSolver
+{
+ public:
+  /**
+   * Creates the solver of index `id` of the portfolio, given the clause
+   * exchange to use (or null) and the flag indicating that it must stop.
+   */
+  using SolverCreator = std::function<SatSolver*(
+      size_t id, ClauseExchange* exchange, const std::atomic<bool>& stop)>;
+
+  /**
+   * @param numSolvers The number of solvers of the portfolio.
+   * @param shareSize  The maximum size of the shared clauses, 0 to disable
+   *                   clause sharing.
+   * @param create     The function creating the solvers.
+   */
+  SatSolverPortfolio(size_t numSolvers,
+                     size_t shareSize,
+                     const SolverCreator& create);
+  ~SatSolverPortfolio() override;
+
+  ClauseId addClause(SatClause& clause, bool removable) override;
+
+  ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override;
+
+  SatVariable newVar(bool isTheoryAtom, bool canErase) override;
+
+  SatVariable trueVar() override;
+
+  SatVariable falseVar() override;
+
+  SatValue solve() override;
+  SatValue solve(long unsigned int&) override;
+  SatValue solve(const std::vector<SatLiteral>& assumptions) override;
+  void getUnsatAssumptions(std::vector<SatLiteral>& assumptions) override;
+
+  void interrupt() override;
+
+  SatValue value(SatLiteral l) override;
+
+  SatValue modelValue(SatLiteral l) override;
+
+  uint32_t getAssertionLevel() const override;
+
+  bool ok() const override;
+
+ private:
+  /** Solve with all solvers in parallel and return the first answer. */
+  SatValue solveParallel(const std::vector<SatLiteral>& assumptions);
+
+  /**
+   * The clause exchange of the solvers (may be null). Declared first so that
+   * it outlives the solvers.
+   */
+  std::unique_ptr<ClauseExchange> d_exchange;
+  /** The solvers of the portfolio. */
+  std::vector<std::unique_ptr<SatSolver>> d_solvers;
+  /** The index of the solver that answered the last solve call. */
+  size_t d_winner;
+  /** Flag requesting the solvers to stop. */
+  std::atomic<bool> d_stop;
+};
+
+}  // namespace prop
+}  // namespace cvc5::internal
+
+#endif  // CVC5__PROP__SAT_SOLVER_PORTFOLIO_H
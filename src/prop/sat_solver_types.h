@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "cvc5_private.h"
+#include "util/hash.h"
 
 namespace cvc5::internal {
 namespace prop {
@@ -166,11 +167,38 @@ struct SatLiteralHashFunction {
   }
 };
 
+/**
+ * Helper for indexing dense maps by literals, see context::CDDenseMap.
+ */
+struct SatLiteralIndexFunction
+{
+  inline size_t operator()(const SatLiteral& literal) const
+  {
+    return literal.toInt();
+  }
+};
+
 /**
  * A SAT clause is a vector of literals.
  */
 typedef std::vector<SatLiteral> SatClause;
 
+/**
+ * Helper for hashing the (ordered) literals of a clause.
+ */
+struct SatClauseHashFunction
+{
+  inline size_t operator()(const SatClause& clause) const
+  {
+    uint64_t hash = fnv1a::offsetBasis;
+    for (const SatLiteral& l : clause)
+    {
+      hash = fnv1a::fnv1a_64(l.hash(), hash);
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
 struct SatClauseSetHashFunction
 {
   inline size_t operator()(
@@ -59,7 +59,9 @@ TheoryProxy::TheoryProxy(Env& env,
       d_zll(nullptr),
       d_prr(nullptr),
       d_stopSearch(userContext(), false),
-      d_activatedSkDefs(false)
+      d_activatedSkDefs(false),
+      d_numUncheckedFacts(0),
+      d_stats(statisticsRegistry())
 {
   bool trackZeroLevel =
       options().smt.deepRestartMode != options::DeepRestartMode::NONE
@@ -242,6 +244,7 @@ void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
     // now, assert to theory engine
     Trace("prereg") << "assert: " << assertion << std::endl;
     d_theoryEngine->assertFact(assertion);
+    ++d_numUncheckedFacts;
     if (d_trackActiveSkDefs)
     {
       Assert(d_skdm != nullptr);
@@ -270,10 +273,23 @@ void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
       }
     }
   }
-  if (!d_stopSearch.get())
+  if (d_stopSearch.get())
+  {
+    return;
+  }
+  // If batching, standard effort checks are only done once enough literals
+  // are pending. This is sound since the theories are checked at full effort
+  // before a model is accepted, it only delays conflicts and propagations.
+  uint64_t batch = options().prop.theoryCheckBatch;
+  if (effort == theory::Theory::EFFORT_STANDARD && batch > 0
+      && d_numUncheckedFacts < batch)
   {
-    d_theoryEngine->check(effort);
+    ++d_stats.d_numDeferredChecks;
+    return;
   }
+  d_stats.d_checkBatchSize << d_numUncheckedFacts;
+  d_numUncheckedFacts = 0;
+  d_theoryEngine->check(effort);
 }
 
 void TheoryProxy::theoryPropagate(std::vector<SatLiteral>& output) {
@@ -326,16 +342,21 @@ void TheoryProxy::explainPropagation(SatLiteral l, SatClause& explanation) {
 
 void TheoryProxy::notifySatClause(const SatClause& clause)
 {
+  // keep the clause for deep restarts if it is short enough
+  bool keepForRestart =
+      d_inSolve && clause.size() > 1
+      && clause.size() <= options().smt.deepRestartClauseSize
+      && d_restartClauses.size() < options().smt.deepRestartClauseLimit
+      && options().smt.deepRestartMode != options::DeepRestartMode::NONE;
   const std::vector<Plugin*>& plugins = d_env.getPlugins();
-  if (plugins.empty())
+  // We do not inform plugins of SAT clauses if we are not in solving mode and
+  // pluginNotifySatClauseInSolve is true (default).
+  bool notifyPlugins =
+      !plugins.empty()
+      && (d_inSolve || !options().base.pluginNotifySatClauseInSolve);
+  if (!keepForRestart && !notifyPlugins)
   {
-    // nothing to do if no plugins
-    return;
-  }
-  if (!d_inSolve && options().base.pluginNotifySatClauseInSolve)
-  {
-    // We are not in solving mode. We do not inform plugins of SAT clauses
-    // if pluginNotifySatClauseInSolve is true (default).
+    // nothing to do
     return;
   }
   // convert to node
@@ -350,11 +371,24 @@ void TheoryProxy::notifySatClause(const SatClause& clause)
     {
       clauseNodes.push_back(it->second);
     }
+    else
+    {
+      // the clause without the literal would not be implied
+      keepForRestart = false;
+    }
   }
   Node cln = nodeManager()->mkOr(clauseNodes);
   // get the sharable form of cln
   Node clns = d_env.getSharableFormula(cln);
-  if (!clns.isNull())
+  if (clns.isNull())
+  {
+    return;
+  }
+  if (keepForRestart && d_restartClauseSet.insert(clns).second)
+  {
+    d_restartClauses.push_back(clns);
+  }
+  if (notifyPlugins)
   {
     Trace("theory-proxy")
         << "TheoryProxy::notifySatClause: Clause from SAT solver: " << clns
@@ -553,11 +587,24 @@ std::vector<Node> TheoryProxy::getLearnedZeroLevelLiteralsForRestart() const
   return {};
 }
 
+const std::vector<Node>& TheoryProxy::getLearnedClausesForRestart() const
+{
+  return d_restartClauses;
+}
+
 TrustNode TheoryProxy::inprocessLemma(TrustNode& trn)
 {
   Assert(d_lemip != nullptr);
   return d_lemip->inprocessLemma(trn);
 }
 
+TheoryProxy::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_checkBatchSize(
+        sr.registerAverage("prop::TheoryProxy::checkBatchSize")),
+      d_numDeferredChecks(
+          sr.registerInt("prop::TheoryProxy::numDeferredChecks"))
+{
+}
+
 }  // namespace prop
 }  // namespace cvc5::internal
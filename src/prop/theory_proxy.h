@@ -35,6 +35,7 @@
 #include "theory/theory.h"
 #include "theory/theory_preprocessor.h"
 #include "util/resource_manager.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
@@ -202,6 +203,12 @@ class TheoryProxy : protected EnvObj, public Registrar
       modes::LearnedLitType ltype) const;
   /** Get the zero-level assertions that should be used on deep restart */
   std::vector<Node> getLearnedZeroLevelLiteralsForRestart() const;
+  /**
+   * Get the learned clauses that should be used on deep restart, which are
+   * the first ones (up to option deepRestartClauseLimit) whose size is at
+   * least two and at most option deepRestartClauseSize.
+   */
+  const std::vector<Node>& getLearnedClausesForRestart() const;
   /** Get literal type using ZLL utility */
   modes::LearnedLitType getLiteralType(const Node& lit) const;
 
@@ -235,6 +242,11 @@ class TheoryProxy : protected EnvObj, public Registrar
    */
   bool d_inSolve;
 
+  /** The learned clauses for deep restarts, see above */
+  std::vector<Node> d_restartClauses;
+  /** The set of clauses in d_restartClauses */
+  std::unordered_set<Node> d_restartClauseSet;
+
   /** The theory engine we are using. */
   TheoryEngine* d_theoryEngine;
 
@@ -266,6 +278,23 @@ class TheoryProxy : protected EnvObj, public Registrar
    * are dynamically activated only when decision=justification.
    */
   bool d_activatedSkDefs;
+
+  /**
+   * The number of literals asserted to the theory engine since its last
+   * check, used for batching standard effort checks.
+   */
+  uint64_t d_numUncheckedFacts;
+
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of literals asserted to the theory engine per check */
+    AverageStat d_checkBatchSize;
+    /** Number of standard effort checks deferred to a later check */
+    IntStat d_numDeferredChecks;
+  };
+  /** Statistics */
+  Statistics d_stats;
 }; /* class TheoryProxy */
 
 }  // namespace prop
@@ -14,6 +14,8 @@
  */
 #include "prop/zero_level_learner.h"
 
+#include <limits>
+
 #include "context/context.h"
 #include "expr/node_algorithm.h"
 #include "expr/skolem_manager.h"
@@ -36,8 +38,10 @@ ZeroLevelLearner::ZeroLevelLearner(Env& env, TheoryEngine* theoryEngine)
       d_ppnAtoms(userContext()),
       d_ppnTerms(userContext()),
       d_ppnSyms(userContext()),
+      d_ppnVisited(userContext()),
       d_assertNoLearnCount(0),
-      d_tsmap(env, userContext(), "ZllSimplificationMap")
+      d_tsmap(env, userContext(), "ZllSimplificationMap"),
+      d_stats(statisticsRegistry())
 {
   // get the learned types
   options::DeepRestartMode lmode = options().smt.deepRestartMode;
@@ -65,9 +69,10 @@ ZeroLevelLearner::ZeroLevelLearner(Env& env, TheoryEngine* theoryEngine)
 
 ZeroLevelLearner::~ZeroLevelLearner() {}
 
-void ZeroLevelLearner::getAtoms(TNode a,
-                                std::unordered_set<TNode>& visited,
-                                std::unordered_set<Node>& atoms)
+bool ZeroLevelLearner::getAtoms(TNode a,
+                                const std::unordered_set<TNode>& visited,
+                                std::unordered_set<Node>& atoms,
+                                uint64_t& budget)
 {
   std::vector<TNode> visit;
   TNode cur;
@@ -76,9 +81,16 @@ void ZeroLevelLearner::getAtoms(TNode a,
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (visited.find(cur) == visited.end()
+        && d_ppnVisited.find(cur) == d_ppnVisited.end())
     {
-      visited.insert(cur);
+      if (budget == 0)
+      {
+        return false;
+      }
+      budget--;
+      d_ppnVisited.insert(cur);
+      ++d_stats.d_numInputNodes;
       if (expr::isBooleanConnective(cur))
       {
         visit.insert(visit.end(), cur.begin(), cur.end());
@@ -87,6 +99,7 @@ void ZeroLevelLearner::getAtoms(TNode a,
       atoms.insert(cur);
     }
   } while (!visit.empty());
+  return true;
 }
 
 void ZeroLevelLearner::notifyTopLevelSubstitution(const Node& lhs,
@@ -99,6 +112,7 @@ void ZeroLevelLearner::notifyTopLevelSubstitution(const Node& lhs,
 
 void ZeroLevelLearner::notifyInputFormulas(const std::vector<Node>& assertions)
 {
+  TimerStat::CodeTimer codeTimer(d_stats.d_inputTime);
   std::unordered_set<TNode> visited;
   std::unordered_set<TNode> visitedWithinAtom;
   std::unordered_set<Node> inputSymbols;
@@ -136,23 +150,41 @@ void ZeroLevelLearner::notifyInputFormulas(const std::vector<Node>& assertions)
         computeLearnedLiteralType(lit);
       }
       processLearnedLiteral(lit, modes::LearnedLitType::PREPROCESS);
-      // also get its symbols
-      expr::getSymbols(atom, inputSymbols, visitedWithinAtom);
+      // also get its symbols, unless they were computed on a previous call
+      if (d_ppnTerms.find(atom) == d_ppnTerms.end())
+      {
+        expr::getSymbols(atom, inputSymbols, visitedWithinAtom);
+      }
     }
     // remember we've seen it
     d_levelZeroAsserts.insert(lit);
   }
-  // Compute the set of literals in the preprocessed assertions
+  // Compute the set of literals in the preprocessed assertions. The parts of
+  // the assertions that were traversed on previous calls are skipped, to make
+  // this proportional to the size of the new assertions in incremental mode.
   std::unordered_set<Node> inputAtoms;
+  uint64_t budget = options().smt.learnedLitsInputBudget;
+  if (budget == 0)
+  {
+    budget = std::numeric_limits<uint64_t>::max();
+  }
   for (const Node& a : assertions)
   {
-    getAtoms(a, visited, inputAtoms);
+    if (!getAtoms(a, visited, inputAtoms, budget))
+    {
+      Trace("level-zero") << "Exhausted budget for input formulas" << std::endl;
+      ++d_stats.d_numBudgetExhausted;
+      break;
+    }
   }
   for (const Node& a : inputAtoms)
   {
     d_ppnAtoms.insert(a);
-    // also get its symbols
-    expr::getSymbols(a, inputSymbols, visitedWithinAtom);
+    // also get its symbols, unless they were computed on a previous call
+    if (d_ppnTerms.find(a) == d_ppnTerms.end())
+    {
+      expr::getSymbols(a, inputSymbols, visitedWithinAtom);
+    }
   }
   for (const TNode& t : visitedWithinAtom)
   {
@@ -201,6 +233,7 @@ bool ZeroLevelLearner::notifyAsserted(TNode assertion, int32_t alevel)
   {
     // remember we've processed this
     d_levelZeroAsserts.insert(assertion);
+    ++d_stats.d_numLearned;
     // process what we should do with the learned literal
     modes::LearnedLitType ltype = computeLearnedLiteralType(assertion);
     processLearnedLiteral(assertion, ltype);
@@ -238,6 +271,7 @@ bool ZeroLevelLearner::notifyAsserted(TNode assertion, int32_t alevel)
 modes::LearnedLitType ZeroLevelLearner::computeLearnedLiteralType(
     const Node& input)
 {
+  TimerStat::CodeTimer codeTimer(d_stats.d_classifyTime);
   // literal was learned, determine its type
   // compute whether internal prior to substitution
   TNode aatom = input.getKind() == Kind::NOT ? input[0] : input;
@@ -450,5 +484,15 @@ bool ZeroLevelLearner::getSolved(const Node& lit, Subs& subs)
   return false;
 }
 
+ZeroLevelLearner::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_inputTime(sr.registerTimer("prop::ZeroLevelLearner::inputTime")),
+      d_classifyTime(sr.registerTimer("prop::ZeroLevelLearner::classifyTime")),
+      d_numInputNodes(sr.registerInt("prop::ZeroLevelLearner::numInputNodes")),
+      d_numBudgetExhausted(
+          sr.registerInt("prop::ZeroLevelLearner::numBudgetExhausted")),
+      d_numLearned(sr.registerInt("prop::ZeroLevelLearner::numLearned"))
+{
+}
+
 }  // namespace prop
 }  // namespace cvc5::internal
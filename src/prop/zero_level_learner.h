@@ -27,6 +27,7 @@
 #include "prop/learned_db.h"
 #include "smt/env_obj.h"
 #include "theory/trust_substitutions.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
@@ -78,9 +79,16 @@ class ZeroLevelLearner : protected EnvObj
   theory::TrustSubstitutionMap& getSimplifications();
 
  private:
-  static void getAtoms(TNode a,
-                       std::unordered_set<TNode>& visited,
-                       std::unordered_set<Node>& atoms);
+  /**
+   * Collect the atoms of a into atoms. Nodes in visited or d_ppnVisited are
+   * skipped, the visited nodes are added to d_ppnVisited. At most budget new
+   * nodes are visited, which is decremented accordingly. Return false if the
+   * budget was exhausted before all nodes were visited.
+   */
+  bool getAtoms(TNode a,
+                const std::unordered_set<TNode>& visited,
+                std::unordered_set<Node>& atoms,
+                uint64_t& budget);
   /** Process learned literal */
   void processLearnedLiteral(const Node& lit, modes::LearnedLitType ltype);
   /** is learnable based on the value of options */
@@ -118,6 +126,11 @@ class ZeroLevelLearner : protected EnvObj
   NodeSet d_ppnTerms;
   /** Symbols in the above atoms. */
   NodeSet d_ppnSyms;
+  /**
+   * The nodes of the input formulas traversed when computing the above atoms,
+   * which are not traversed again on later calls to notifyInputFormulas.
+   */
+  NodeSet d_ppnVisited;
   /** Current counter of assertions */
   size_t d_assertNoLearnCount;
   /** The threshold */
@@ -132,6 +145,22 @@ class ZeroLevelLearner : protected EnvObj
    */
   theory::TrustSubstitutionMap d_tsmap;
 
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Time spent processing the input formulas */
+    TimerStat d_inputTime;
+    /** Time spent classifying learned literals */
+    TimerStat d_classifyTime;
+    /** Number of nodes of the input formulas traversed */
+    IntStat d_numInputNodes;
+    /** Number of checks for which the traversal budget was exhausted */
+    IntStat d_numBudgetExhausted;
+    /** Number of literals learned at decision level zero */
+    IntStat d_numLearned;
+  };
+  /** Statistics */
+  Statistics d_stats;
 }; /* class ZeroLevelLearner */
 
 }  // namespace prop
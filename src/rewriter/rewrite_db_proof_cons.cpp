@@ -51,7 +51,15 @@ RewriteDbProofCons::RewriteDbProofCons(Env& env, RewriteDb* db)
       d_statTotalAttempts(statisticsRegistry().registerInt(
           "RewriteDbProofCons::totalAttempts")),
       d_statTotalInputSuccess(statisticsRegistry().registerInt(
-          "RewriteDbProofCons::totalInputSuccess"))
+          "RewriteDbProofCons::totalInputSuccess")),
+      d_statTotalInputCachedFail(statisticsRegistry().registerInt(
+          "RewriteDbProofCons::totalInputCachedFail")),
+      d_statRuleAttempts(
+          statisticsRegistry().registerHistogram<ProofRewriteRule>(
+              "RewriteDbProofCons::ruleAttempts")),
+      d_statRuleSuccess(
+          statisticsRegistry().registerHistogram<ProofRewriteRule>(
+              "RewriteDbProofCons::ruleSuccess"))
 {
   NodeManager* nm = nodeManager();
   d_true = nm->mkConst(true);
@@ -66,14 +74,25 @@ bool RewriteDbProofCons::prove(
     int64_t stepLimit,
     TheoryRewriteMode tmode)
 {
+  Node eq = a.eqNode(b);
+  Trace("rpc") << "RewriteDbProofCons::prove: " << a << " == " << b << ", mode "
+               << tmode << std::endl;
+  // if we already failed for the same input, limits and mode, we fail again
+  std::unordered_map<Node, FailInfo>::const_iterator itf =
+      d_failInputs.find(eq);
+  if (itf != d_failInputs.end() && itf->second.d_recLimit == recLimit
+      && itf->second.d_stepLimit == stepLimit && itf->second.d_tmode == tmode)
+  {
+    Trace("rpc") << "...fail (cached)" << std::endl;
+    ++d_statTotalInputCachedFail;
+    return false;
+  }
+  Node input = eq;
   d_tmode = tmode;
   // clear the proof caches
   d_pcache.clear();
   // clear the evaluate cache
   d_evalCache.clear();
-  Node eq = a.eqNode(b);
-  Trace("rpc") << "RewriteDbProofCons::prove: " << a << " == " << b << ", mode "
-               << tmode << std::endl;
   // As a heuristic, always apply CONG if we are an equality between two
   // binder terms with the same quantifier prefix or ALPHA_EQUIV if they have
   // a different prefix whose types are the same.
@@ -141,6 +160,7 @@ bool RewriteDbProofCons::prove(
     else
     {
       Trace("rpc") << "...fail" << std::endl;
+      d_failInputs[input] = FailInfo(recLimit, stepLimit, tmode);
     }
   }
   else
@@ -541,6 +561,7 @@ bool RewriteDbProofCons::notifyMatch(const Node& s,
   {
     // try to prove target with the current rule, using inflection matching
     // and fixed point semantics
+    d_statRuleAttempts << id;
     if (proveWithRule(RewriteProofStatus::DSL,
                       d_target,
                       vars,
@@ -550,6 +571,7 @@ bool RewriteDbProofCons::notifyMatch(const Node& s,
                       recurse,
                       id))
     {
+      d_statRuleSuccess << id;
       // if successful, we do not want to be notified of further matches
       // and return false here.
       return false;
@@ -328,6 +328,30 @@ class RewriteDbProofCons : protected EnvObj
   std::unordered_set<Node> d_currProving;
   /** Cache for the proven status of formulas */
   std::unordered_map<Node, ProvenInfo> d_pcache;
+  /** The limits and mode under which an input equality failed to prove */
+  class FailInfo
+  {
+   public:
+    FailInfo()
+        : d_recLimit(0), d_stepLimit(0), d_tmode(TheoryRewriteMode::STANDARD)
+    {
+    }
+    FailInfo(int64_t recLimit, int64_t stepLimit, TheoryRewriteMode tmode)
+        : d_recLimit(recLimit), d_stepLimit(stepLimit), d_tmode(tmode)
+    {
+    }
+    int64_t d_recLimit;
+    int64_t d_stepLimit;
+    TheoryRewriteMode d_tmode;
+  };
+  /**
+   * Maps input equalities (= a b) of prove to the limits under which we
+   * failed to prove them. Unlike d_pcache, this is not cleared between calls
+   * to prove, since the same rewrite may appear many times in a proof. A
+   * failure is only reused for the same limits and mode, for which prove is
+   * deterministic.
+   */
+  std::unordered_map<Node, FailInfo> d_failInputs;
   /** the evaluation cache */
   std::unordered_map<Node, Node> d_evalCache;
   /** common constants */
@@ -355,6 +379,12 @@ class RewriteDbProofCons : protected EnvObj
   IntStat d_statTotalAttempts;
   /** Total number of rewrites we proved successfully */
   IntStat d_statTotalInputSuccess;
+  /** Total number of rewrites we skipped due to a cached failure */
+  IntStat d_statTotalInputCachedFail;
+  /** Number of times we tried to prove a rewrite with each RARE rule */
+  HistogramStat<ProofRewriteRule> d_statRuleAttempts;
+  /** Number of times each RARE rule proved the rewrite it was tried on */
+  HistogramStat<ProofRewriteRule> d_statRuleSuccess;
   /** Fixed point limit */
   static size_t s_fixedPointLimit;
 };
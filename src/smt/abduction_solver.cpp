@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "base/modal_exception.h"
+#include "options/base_options.h"
 #include "options/quantifiers_options.h"
 #include "options/smt_options.h"
 #include "smt/env.h"
@@ -187,26 +188,31 @@ void AbductionSolver::checkAbduct(Node a)
   Options subOptions;
   subOptions.copyValues(d_env.getOptions());
   subOptions.write_smt().produceAbducts = false;
+  // the checker answers two queries
+  subOptions.write_base().incrementalSolving = true;
   SetDefaults::disableChecking(subOptions);
   SubsolverSetupInfo ssi(d_env, subOptions);
+  // Start new SMT engine to check solution. Both checks below share the
+  // assertions and the solution, hence we use a single engine where the goal
+  // is given as an assumption.
+  Trace("check-abduct") << "SolverEngine::checkAbduct: make new SMT engine"
+                        << std::endl;
+  std::unique_ptr<SolverEngine> abdChecker;
+  initializeSubsolver(nodeManager(), abdChecker, ssi);
+  Trace("check-abduct") << "SolverEngine::checkAbduct: asserting formulas"
+                        << std::endl;
+  for (const Node& e : asserts)
+  {
+    abdChecker->assertFormula(e);
+  }
   // two checks: first, consistent with assertions, second, implies negated goal
   // is unsatisfiable.
   for (unsigned j = 0; j < 2; j++)
   {
-    Trace("check-abduct") << "SolverEngine::checkAbduct: phase " << j
-                          << ": make new SMT engine" << std::endl;
-    // Start new SMT engine to check solution
-    std::unique_ptr<SolverEngine> abdChecker;
-    initializeSubsolver(nodeManager(), abdChecker, ssi);
-    Trace("check-abduct") << "SolverEngine::checkAbduct: phase " << j
-                          << ": asserting formulas" << std::endl;
-    for (const Node& e : asserts)
-    {
-      abdChecker->assertFormula(e);
-    }
     Trace("check-abduct") << "SolverEngine::checkAbduct: phase " << j
                           << ": check the assertions" << std::endl;
-    Result r = abdChecker->checkSat();
+    Result r =
+        j == 0 ? abdChecker->checkSat() : abdChecker->checkSat(d_abdConj);
     Trace("check-abduct") << "SolverEngine::checkAbduct: phase " << j
                           << ": result is " << r << std::endl;
     std::stringstream serr;
@@ -225,9 +231,7 @@ void AbductionSolver::checkAbduct(Node a)
       }
       Trace("check-abduct")
           << "SolverEngine::checkAbduct: goal is " << d_abdConj << std::endl;
-      // add the goal to the set of assertions
       Assert(!d_abdConj.isNull());
-      asserts.push_back(d_abdConj);
     }
     else
     {
@@ -93,6 +93,18 @@ const context::CDList<Node>& Assertions::getAssertionListDefinitions() const
   return d_assertionListDefs;
 }
 
+const std::vector<Node>& Assertions::getStreamedAssertions() const
+{
+  return d_streamedAssertions;
+}
+
+std::vector<Node> Assertions::releaseStreamedAssertions()
+{
+  std::vector<Node> res;
+  res.swap(d_streamedAssertions);
+  return res;
+}
+
 std::unordered_set<Node> Assertions::getCurrentAssertionListDefitions() const
 {
   std::unordered_set<Node> defSet;
@@ -107,8 +119,16 @@ void Assertions::addFormula(TNode n,
                             bool isFunDef,
                             bool maybeHasFv)
 {
-  // add to assertion list
-  d_assertionList.push_back(n);
+  // add to assertion list, or to the streamed assertions if we do not keep
+  // the input assertions
+  if (options().smt.streamAssertions)
+  {
+    d_streamedAssertions.push_back(n);
+  }
+  else
+  {
+    d_assertionList.push_back(n);
+  }
   if (n.isConst() && n.getConst<bool>())
   {
     // true, nothing to do
@@ -103,6 +103,18 @@ class Assertions : protected EnvObj
    * on initializeCheckSat.
    */
   std::vector<Node>& getAssumptions();
+  /**
+   * Get the assertions added since the last call to releaseStreamedAssertions,
+   * only used with --stream-assertions, in which case they are not added to
+   * the assertion list.
+   */
+  const std::vector<Node>& getStreamedAssertions() const;
+  /**
+   * Get the assertions added since the last call to this method and forget
+   * them, so that they are freed once they are preprocessed. Only used with
+   * --stream-assertions.
+   */
+  std::vector<Node> releaseStreamedAssertions();
  private:
   /**
    * Fully type-check the argument, and also type-check that it's
@@ -133,6 +145,12 @@ class Assertions : protected EnvObj
   AssertionList d_assertionList;
   /** The subset of above the correspond to define-fun or define-fun-rec */
   AssertionList d_assertionListDefs;
+  /**
+   * The assertions that are not preprocessed yet, which are kept here instead
+   * of the assertion list with --stream-assertions. This is not
+   * context-dependent since that option requires non-incremental mode.
+   */
+  std::vector<Node> d_streamedAssertions;
   /**
    * List of lemmas generated for global (recursive) function definitions. We
    * assert this list of definitions in each check-sat call.
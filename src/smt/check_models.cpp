@@ -66,7 +66,7 @@ void getTheoriesOf(Env& env, const Node& n, std::vector<TheoryId>& theories)
   } while (!visit.empty());
 }
 
-CheckModels::CheckModels(Env& e) : EnvObj(e) {}
+CheckModels::CheckModels(Env& e) : EnvObj(e), d_expDef(e) {}
 
 void CheckModels::checkModel(TheoryModel* m,
                              const context::CDList<Node>& al,
@@ -91,13 +91,14 @@ void CheckModels::checkModel(TheoryModel* m,
     // only throw warning
     hardFailure = false;
   }
-  // expand definitions module and substitutions
-  std::unordered_map<Node, Node> ecache;
-  ExpandDefs expDef(d_env);
+  // Expanding definitions does not depend on the model nor on the context,
+  // hence we use a cache that persists across calls. This avoids expanding
+  // the same assertions again on every check in incremental runs. Applying
+  // the substitutions and rewriting are cached by their own utilities.
+  std::unordered_map<Node, Node>& cache = d_expandCache;
 
   theory::SubstitutionMap& sm = d_env.getTopLevelSubstitutions().get();
   Trace("check-model") << "checkModel: Check assertions..." << std::endl;
-  std::unordered_map<Node, Node> cache;
   // the list of assertions that did not rewrite to true
   std::vector<Node> noCheckList;
   // Now go through all our user assertions checking if they're satisfied.
@@ -118,7 +119,7 @@ void CheckModels::checkModel(TheoryModel* m,
     // Expand definitions, which is required for being accurate for operators
     // that expand involving skolems during preprocessing. Not doing this will
     // increase the spurious warnings raised by this class.
-    n = expDef.expandDefinitions(n, cache);
+    n = d_expDef.expandDefinitions(n, cache);
     bool checkAgain = false;
     bool processed = false;
     Node nval;
@@ -159,7 +160,7 @@ void CheckModels::checkModel(TheoryModel* m,
       // rewrite quantified formulas (see cvc4-wishues#43).
       if (!nval.isConst())
       {
-        n = expDef.expandDefinitions(nval, cache);
+        n = d_expDef.expandDefinitions(nval, cache);
         if (n != nval)
         {
           // It could be that we can expand again after simplifying. This is
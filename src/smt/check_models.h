@@ -18,9 +18,12 @@
 #ifndef CVC5__SMT__CHECK_MODELS_H
 #define CVC5__SMT__CHECK_MODELS_H
 
+#include <unordered_map>
+
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "smt/env_obj.h"
+#include "smt/expand_definitions.h"
 
 namespace cvc5::internal {
 
@@ -51,6 +54,12 @@ class CheckModels : protected EnvObj
   void checkModel(theory::TheoryModel* m,
                   const context::CDList<Node>& al,
                   bool hardFailure);
+
+ private:
+  /** The utility for expanding definitions */
+  ExpandDefs d_expDef;
+  /** The cache of d_expDef, which is kept across calls to checkModel */
+  std::unordered_map<Node, Node> d_expandCache;
 };
 
 }  // namespace smt
@@ -28,8 +28,10 @@
 #include "options/strings_options.h"
 #include "printer/printer.h"
 #include "proof/conv_proof_generator.h"
+#include "proof/proof_node.h"
 #include "smt/proof_manager.h"
 #include "smt/solver_engine_stats.h"
+#include "smt/subsolver_options_cache.h"
 #include "theory/evaluator.h"
 #include "theory/quantifiers/oracle_checker.h"
 #include "theory/rewriter.h"
@@ -56,6 +58,7 @@ Env::Env(NodeManager* nm, const Options* opts)
       d_options(),
       d_resourceManager(),
       d_uninterpretedSortOwner(theory::THEORY_UF),
+      d_subsolverOptionsCache(new smt::SubsolverOptionsCache()),
       d_boolTermSkolems(d_userContext.get())
 {
   if (opts != nullptr)
@@ -72,6 +75,14 @@ Env::Env(NodeManager* nm, const Options* opts)
   d_statisticsRegistry->registerTimer("global::totalTime").start();
   d_resourceManager = std::make_unique<ResourceManager>(*d_statisticsRegistry, d_options);
   d_rewriter->d_resourceManager = d_resourceManager.get();
+  d_rewriter->initializeStatistics(*d_statisticsRegistry,
+                                   d_options.base.statisticsRewrite);
+  d_resourceManager->registerMemoryAccount(
+      "nodes", [nm]() { return nm->getMemoryUsage(); });
+  d_resourceManager->registerMemoryAccount("context", [this]() {
+    return d_context->getCMM()->getMemoryUsage()
+           + d_userContext->getCMM()->getMemoryUsage();
+  });
 }
 
 Env::~Env() {}
@@ -86,6 +97,11 @@ void Env::finishInit(smt::PfManager* pm)
     Assert(d_proofNodeManager == nullptr);
     d_proofNodeManager = pm->getProofNodeManager();
     d_rewriter->finishInit(*this);
+    // the proof nodes of all solvers of this thread, not counting the
+    // vectors of their children and arguments
+    d_resourceManager->registerMemoryAccount("proofs", []() {
+      return ProofNode::getNumLive() * sizeof(ProofNode);
+    });
   }
   d_topLevelSubs.reset(
       new theory::TrustSubstitutionMap(*this, d_userContext.get()));
@@ -96,6 +112,13 @@ void Env::finishInit(smt::PfManager* pm)
   }
   d_statisticsRegistry->setStatsAll(d_options.base.statisticsAll);
   d_statisticsRegistry->setStatsInternal(d_options.base.statisticsInternal);
+
+  context::ContextMemoryPolicy policy;
+  policy.d_maxChunkSize = d_options.smt.contextMemoryMaxChunk;
+  policy.d_maxFreeBytes = d_options.smt.contextMemoryMaxFree;
+  policy.d_hugePages = d_options.smt.contextMemoryHugePages;
+  d_context->getCMM()->setPolicy(policy);
+  d_userContext->getCMM()->setPolicy(policy);
 }
 
 void Env::shutdown()
@@ -326,6 +349,11 @@ theory::quantifiers::OracleChecker* Env::getOracleChecker() const
   return d_ochecker.get();
 }
 
+smt::SubsolverOptionsCache* Env::getSubsolverOptionsCache() const
+{
+  return d_subsolverOptionsCache.get();
+}
+
 void Env::registerBooleanTermSkolem(const Node& k)
 {
   Assert(k.isVar());
@@ -49,6 +49,7 @@ using OutputTag = options::OutputTag;
 
 namespace smt {
 class PfManager;
+class SubsolverOptionsCache;
 }
 
 namespace theory {
@@ -305,6 +306,12 @@ class Env
   /** get oracle checker */
   theory::quantifiers::OracleChecker* getOracleChecker() const;
 
+  /**
+   * Get the cache for the default options of the internal subsolvers that are
+   * initialized based on this environment, see initializeSubsolver.
+   */
+  smt::SubsolverOptionsCache* getSubsolverOptionsCache() const;
+
   /**
    * Register Boolean term skolem. This registers that k is a Boolean variable
    * that should be treated as a theory atom. This impacts theoryOf, where
@@ -419,6 +426,8 @@ class Env
   std::vector<Plugin*> d_plugins;
   /** oracle checker */
   std::unique_ptr<theory::quantifiers::OracleChecker> d_ochecker;
+  /** The cache for the default options of subsolvers */
+  std::unique_ptr<smt::SubsolverOptionsCache> d_subsolverOptionsCache;
   /**
    * The set of skolems introduced for Boolean term elimination. This is a set
    * of purification skolems of Boolean type. These variables are important
@@ -160,42 +160,55 @@ void IllegalChecker::checkAssertions(Assertions& as)
     return;
   }
   // check illegal kinds here
+  if (options().smt.streamAssertions)
+  {
+    // the new assertions are the streamed ones, which are not released yet
+    for (const Node& n : as.getStreamedAssertions())
+    {
+      checkAssertion(n);
+    }
+    return;
+  }
   const context::CDList<Node>& assertions = as.getAssertionList();
   size_t asize = assertions.size();
   for (size_t i = d_assertionIndex.get(); i < asize; ++i)
   {
-    Node n = assertions[i];
-    Trace("illegal-check") << "Check assertion " << n << std::endl;
-    Kind k = checkInternal(n);
-    if (k != Kind::UNDEFINED_KIND)
-    {
-      std::stringstream ss;
-      ss << "Cannot handle assertion with term of kind " << k
-         << " in this configuration.";
-      // suggested options only in non-safe builds
+    checkAssertion(assertions[i]);
+  }
+  d_assertionIndex = asize;
+}
+
+void IllegalChecker::checkAssertion(const Node& n)
+{
+  Trace("illegal-check") << "Check assertion " << n << std::endl;
+  Kind k = checkInternal(n);
+  if (k != Kind::UNDEFINED_KIND)
+  {
+    std::stringstream ss;
+    ss << "Cannot handle assertion with term of kind " << k
+       << " in this configuration.";
+    // suggested options only in non-safe builds
 #if !defined(CVC5_SAFE_MODE) && !defined(CVC5_STABLE_MODE)
-      if (k == Kind::STORE_ALL)
-      {
-        ss << " Try --arrays-exp.";
-      }
-      else
+    if (k == Kind::STORE_ALL)
+    {
+      ss << " Try --arrays-exp.";
+    }
+    else
+    {
+      theory::TheoryId tid = theory::kindToTheoryId(k);
+      // if the kind was disabled based a theory, report it.
+      switch (tid)
       {
-        theory::TheoryId tid = theory::kindToTheoryId(k);
-        // if the kind was disabled based a theory, report it.
-        switch (tid)
-        {
-          case theory::THEORY_FF: ss << " Try --ff."; break;
-          case theory::THEORY_FP: ss << " Try --fp."; break;
-          case theory::THEORY_BAGS: ss << " Try --bags."; break;
-          case theory::THEORY_SEP: ss << " Try --sep."; break;
-          default: break;
-        }
+        case theory::THEORY_FF: ss << " Try --ff."; break;
+        case theory::THEORY_FP: ss << " Try --fp."; break;
+        case theory::THEORY_BAGS: ss << " Try --bags."; break;
+        case theory::THEORY_SEP: ss << " Try --sep."; break;
+        default: break;
       }
-#endif
-      throw SafeLogicException(ss.str());
     }
+#endif
+    throw SafeLogicException(ss.str());
   }
-  d_assertionIndex = asize;
 }
 
 Kind IllegalChecker::checkInternal(TNode n)
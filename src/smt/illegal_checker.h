@@ -44,6 +44,8 @@ class IllegalChecker : protected EnvObj
   void checkAssertions(Assertions& as);
 
  private:
+  /** Check whether the assertion n is legal, throw an exception otherwise */
+  void checkAssertion(const Node& n);
   /** The assertions we have visited (user-context dependent) */
   context::CDHashSet<Node> d_visited;
   /** The illegal kinds that cannot appear in assertions */
@@ -15,6 +15,7 @@
 
 #include "smt/model_core_builder.h"
 
+#include "expr/node_algorithm.h"
 #include "theory/subs_minimize.h"
 
 using namespace cvc5::internal::kind;
@@ -45,6 +46,22 @@ bool ModelCoreBuilder::setModelCore(const std::vector<Node>& assertions,
   NodeManager* nm = nodeManager();
 
   Node formula = nm->mkAnd(assertions);
+  if (mode == options::ModelCoresMode::JUSTIFY)
+  {
+    std::vector<Node> coreVars;
+    if (!findJustified(formula, m, coreVars))
+    {
+      Trace("model-core") << "...formula is false in the model" << std::endl;
+      return false;
+    }
+    m->setUsingModelCore();
+    Trace("model-core") << "...got core vars : " << coreVars << std::endl;
+    for (const Node& cv : coreVars)
+    {
+      m->recordModelCoreSymbol(cv);
+    }
+    return true;
+  }
   std::vector<Node> vars;
   std::vector<Node> subs;
   Trace("model-core") << "Assignments: " << std::endl;
@@ -102,4 +119,207 @@ bool ModelCoreBuilder::setModelCore(const std::vector<Node>& assertions,
   return true;
 }
 
+bool ModelCoreBuilder::isJustifiedConnective(TNode n)
+{
+  switch (n.getKind())
+  {
+    case Kind::NOT:
+    case Kind::AND:
+    case Kind::OR:
+    case Kind::IMPLIES:
+    case Kind::XOR: return true;
+    case Kind::EQUAL: return n[0].getType().isBoolean();
+    case Kind::ITE: return n.getType().isBoolean();
+    default: return false;
+  }
+}
+
+bool ModelCoreBuilder::findJustified(Node formula,
+                                     theory::TheoryModel* m,
+                                     std::vector<Node>& coreVars)
+{
+  NodeManager* nm = nodeManager();
+  // Compute the values of the Boolean structure, where the value of a node
+  // is a Boolean constant, or the node itself if its value is unknown. A null
+  // value marks nodes whose children are being visited.
+  std::unordered_map<TNode, Node> value;
+  std::unordered_map<TNode, Node>::iterator it;
+  std::vector<TNode> visit;
+  TNode cur;
+  visit.push_back(formula);
+  do
+  {
+    cur = visit.back();
+    it = value.find(cur);
+    if (it == value.end())
+    {
+      if (!isJustifiedConnective(cur))
+      {
+        visit.pop_back();
+        Node v = m->getValue(cur);
+        value[cur] = v.isConst() ? v : Node(cur);
+        continue;
+      }
+      value[cur] = Node::null();
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    visit.pop_back();
+    if (!it->second.isNull())
+    {
+      continue;
+    }
+    // the value of the i^th child, which is -1 if it is unknown
+    auto childValue = [&value, &cur](size_t i) {
+      const Node& v = value[cur[i]];
+      return v.isConst() ? static_cast<int>(v.getConst<bool>()) : -1;
+    };
+    int res = -1;
+    Kind k = cur.getKind();
+    switch (k)
+    {
+      case Kind::NOT:
+      {
+        int c = childValue(0);
+        res = c == -1 ? -1 : 1 - c;
+      }
+      break;
+      case Kind::AND:
+      case Kind::OR:
+      {
+        // the value that determines the value of the node
+        int dom = k == Kind::OR ? 1 : 0;
+        res = 1 - dom;
+        for (size_t i = 0, nchild = cur.getNumChildren(); i < nchild; i++)
+        {
+          int c = childValue(i);
+          if (c == dom)
+          {
+            res = dom;
+            break;
+          }
+          else if (c == -1)
+          {
+            res = -1;
+          }
+        }
+      }
+      break;
+      case Kind::IMPLIES:
+      {
+        int c0 = childValue(0);
+        int c1 = childValue(1);
+        if (c0 == 0 || c1 == 1)
+        {
+          res = 1;
+        }
+        else if (c0 == 1 && c1 == 0)
+        {
+          res = 0;
+        }
+      }
+      break;
+      case Kind::XOR:
+      case Kind::EQUAL:
+      {
+        int c0 = childValue(0);
+        int c1 = childValue(1);
+        if (c0 != -1 && c1 != -1)
+        {
+          res = (c0 == c1) == (k == Kind::EQUAL) ? 1 : 0;
+        }
+      }
+      break;
+      case Kind::ITE:
+      {
+        int c0 = childValue(0);
+        if (c0 != -1)
+        {
+          res = childValue(c0 == 1 ? 1 : 2);
+        }
+        else if (childValue(1) == childValue(2))
+        {
+          res = childValue(1);
+        }
+      }
+      break;
+      default: Unreachable(); break;
+    }
+    value[cur] = res == -1 ? Node(cur) : nm->mkConst(res == 1);
+  } while (!visit.empty());
+
+  const Node& fvalue = value[formula];
+  if (fvalue.isConst() && !fvalue.getConst<bool>())
+  {
+    return false;
+  }
+  // Justify the formula top-down. A node is justified by the given children
+  // among the candidates, where the candidates whose value is the i^th wanted
+  // value suffice. We prefer a child that is already justified, and otherwise
+  // take the first one.
+  std::unordered_set<TNode> justified;
+  std::unordered_set<Node> syms;
+  std::unordered_set<TNode> symsVisited;
+  auto justifyByOne = [&](TNode n, const std::vector<bool>& wanted) {
+    TNode first;
+    for (size_t i = 0, nchild = n.getNumChildren(); i < nchild; i++)
+    {
+      const Node& v = value[n[i]];
+      if (!v.isConst() || v.getConst<bool>() != wanted[i])
+      {
+        continue;
+      }
+      if (justified.find(n[i]) != justified.end())
+      {
+        return;
+      }
+      if (first.isNull())
+      {
+        first = n[i];
+      }
+    }
+    Assert(!first.isNull());
+    visit.push_back(first);
+  };
+  visit.push_back(formula);
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (!justified.insert(cur).second)
+    {
+      continue;
+    }
+    const Node& v = value[cur];
+    if (!v.isConst() || !isJustifiedConnective(cur))
+    {
+      // an atom, or a formula whose value is unknown
+      expr::getSymbols(cur, syms, symsVisited);
+      continue;
+    }
+    bool b = v.getConst<bool>();
+    Kind k = cur.getKind();
+    size_t nchild = cur.getNumChildren();
+    if ((k == Kind::OR && b) || (k == Kind::AND && !b))
+    {
+      justifyByOne(cur, std::vector<bool>(nchild, b));
+    }
+    else if (k == Kind::IMPLIES && b)
+    {
+      justifyByOne(cur, {false, true});
+    }
+    else if (k == Kind::ITE && value[cur[0]].isConst())
+    {
+      visit.push_back(cur[0]);
+      visit.push_back(value[cur[0]].getConst<bool>() ? cur[1] : cur[2]);
+    }
+    else
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+  coreVars.insert(coreVars.end(), syms.begin(), syms.end());
+  return true;
+}
+
 }  // namespace cvc5::internal
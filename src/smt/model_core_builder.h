@@ -60,6 +60,27 @@ class ModelCoreBuilder : protected EnvObj
   bool setModelCore(const std::vector<Node>& assertions,
                     theory::TheoryModel* m,
                     options::ModelCoresMode mode);
+
+ private:
+  /**
+   * Compute a model core for ModelCoresMode::JUSTIFY. This computes the
+   * values of the Boolean structure of formula bottom-up from the values of
+   * its atoms in m, and then justifies formula top-down, in the style of the
+   * justification decision heuristic: a disjunction that is true is justified
+   * by one of its children that is true, preferring children that are already
+   * justified, and an atom is justified by all of its symbols. Subformulas
+   * whose value is not a constant are justified by all of their symbols.
+   *
+   * @param formula The formula to justify.
+   * @param m The model.
+   * @param coreVars The symbols of the core, which are added to.
+   * @return false if formula is false in m.
+   */
+  bool findJustified(Node formula,
+                     theory::TheoryModel* m,
+                     std::vector<Node>& coreVars);
+  /** Is n a Boolean connective that is handled by findJustified? */
+  static bool isJustifiedConnective(TNode n);
 }; /* class TheoryModelCoreBuilder */
 
 }  // namespace cvc5::internal
@@ -50,6 +50,15 @@ struct SolverEngineStatistics;
  * It is designed to be agnostic to whether we are in incremental mode. That is,
  * it processes assertions in a way that assumes that apply(...) could be
  * applied multiple times to different sets of assertions.
+ *
+ * Note that passes are applied sequentially, including those that transform
+ * each assertion independently (e.g. rewrite or theory-preprocess). These
+ * cannot be applied to several assertions in parallel, since they construct
+ * terms via the node manager and use caches (e.g. of the rewriter and the
+ * theory preprocessor), neither of which are thread-safe. Moreover, such passes
+ * are typically not independent across assertions after all, since they share
+ * these caches, and some, like ite-removal, add new assertions to the
+ * pipeline.
  */
 class ProcessAssertions : protected EnvObj
 {
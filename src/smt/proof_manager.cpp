@@ -23,6 +23,7 @@
 #include "proof/alethe/alethe_post_processor.h"
 #include "proof/alethe/alethe_printer.h"
 #include "proof/alf/alf_printer.h"
+#include "proof/binary/binary_printer.h"
 #include "proof/dot/dot_printer.h"
 #include "proof/lfsc/lfsc_post_processor.h"
 #include "proof/lfsc/lfsc_printer.h"
@@ -102,7 +103,8 @@ PfManager::PfManager(Env& env)
   d_pnm.reset(new ProofNodeManager(env.getNodeManager(),
                                    env.getOptions(),
                                    env.getRewriter(),
-                                   d_pchecker.get()));
+                                   d_pchecker.get(),
+                                   &statisticsRegistry()));
   // Now, initialize the proof postprocessor with the environment.
   // By default the post-processor will update all assumptions, which
   // can lead to SCOPE subproofs of the form
@@ -186,7 +188,10 @@ void PfManager::startProofLogging(std::ostream& out, Assertions& as)
 }
 
 std::shared_ptr<ProofNode> PfManager::connectProofToAssertions(
-    std::shared_ptr<ProofNode> pfn, Assertions& as, ProofScopeMode scopeMode)
+    std::shared_ptr<ProofNode> pfn,
+    Assertions& as,
+    ProofScopeMode scopeMode,
+    bool coreOnly)
 {
   // Note this assumes that connectProofToAssertions is only called once per
   // unsat response. This method would need to cache its result otherwise.
@@ -236,7 +241,8 @@ std::shared_ptr<ProofNode> PfManager::connectProofToAssertions(
   {
     d_pfpp->setAssertions(assertions, false);
   }
-  d_pfpp->process(pfn, d_pppg.get());
+  bool elaborate = !coreOnly || !options().proof.proofLazyElaborate;
+  d_pfpp->process(pfn, d_pppg.get(), elaborate);
 
   switch (scopeMode)
   {
@@ -318,8 +324,9 @@ void PfManager::printProof(std::ostream& out,
   // reused in further check-sat calls, or they may be used again if the
   // user asks for the proof again (in non-incremental mode). We don't need to
   // clone if the printing below does not modify the proof, which is the case
-  // for proof formats ALF and NONE.
+  // for proof formats ALF, BINARY and NONE.
   if (mode != options::ProofFormatMode::CPC
+      && mode != options::ProofFormatMode::BINARY
       && mode != options::ProofFormatMode::NONE)
   {
     fp = fp->clone();
@@ -331,6 +338,11 @@ void PfManager::printProof(std::ostream& out,
     proof::DotPrinter dotPrinter(d_env);
     dotPrinter.print(out, fp.get());
   }
+  else if (mode == options::ProofFormatMode::BINARY)
+  {
+    proof::BinaryPrinter bp(d_env);
+    bp.print(out, fp.get());
+  }
   else if (mode == options::ProofFormatMode::CPC)
   {
     proof::AlfNodeConverter atp(nodeManager());
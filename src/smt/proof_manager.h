@@ -140,11 +140,15 @@ class PfManager : protected EnvObj
    * @param pfn The proof.
    * @param as Reference to the assertions.
    * @param scopeMode The expected form of fp (see ProofScopeMode).
+   * @param coreOnly Whether the proof is only used for its free assumptions,
+   * e.g. for computing an unsat core. If so, we skip the elaboration of
+   * trusted steps with --proof-lazy-elaborate.
    */
   std::shared_ptr<ProofNode> connectProofToAssertions(
       std::shared_ptr<ProofNode> pfn,
       Assertions& as,
-      ProofScopeMode scopeMode = ProofScopeMode::UNIFIED);
+      ProofScopeMode scopeMode = ProofScopeMode::UNIFIED,
+      bool coreOnly = false);
   /**
    * Check proof. This call runs the final proof callback, which checks for
    * pedantic failures and takes statistics.
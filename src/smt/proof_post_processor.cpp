@@ -1109,7 +1109,8 @@ ProofPostprocess::ProofPostprocess(Env& env,
 ProofPostprocess::~ProofPostprocess() {}
 
 void ProofPostprocess::process(std::shared_ptr<ProofNode> pf,
-                               ProofGenerator* pppg)
+                               ProofGenerator* pppg,
+                               bool elaborate)
 {
   // Initialize the callback, which computes necessary static information about
   // how to process, including how to process assumptions in pf.
@@ -1127,7 +1128,7 @@ void ProofPostprocess::process(std::shared_ptr<ProofNode> pf,
     // now update
     d_env.getProofNodeManager()->updateNode(pf.get(), pfc.get());
   }
-  if (d_elimTrustedRules && d_ppdsl != nullptr)
+  if (elaborate && d_elimTrustedRules && d_ppdsl != nullptr)
   {
     // go back and find the (possibly new) trusted steps
     std::vector<std::shared_ptr<ProofNode>> tproofs;
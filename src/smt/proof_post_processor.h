@@ -211,8 +211,15 @@ class ProofPostprocess : protected EnvObj
    *
    * @param pf The proof to process.
    * @param pppg The proof generator for pre-processing proofs.
+   * @param elaborate Whether to eliminate trusted steps via the DSL post
+   * processor, if enabled. This does not change the free assumptions of pf
+   * and hence may be skipped if only those are of interest. Since pf is
+   * updated in place, a later call to this method with elaborate set to true
+   * completes the elaboration of pf.
    */
-  void process(std::shared_ptr<ProofNode> pf, ProofGenerator* pppg);
+  void process(std::shared_ptr<ProofNode> pf,
+               ProofGenerator* pppg,
+               bool elaborate = true);
   /** set eliminate rule */
   void setEliminateRule(ProofRule rule);
   /** set eliminate all trusted rules via DSL */
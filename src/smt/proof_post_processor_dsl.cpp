@@ -146,11 +146,27 @@ bool ProofPostprocessDsl::update(Node res,
   }
   int64_t recLimit = options().proof.proofRewriteRconsRecLimit;
   int64_t stepLimit = options().proof.proofRewriteRconsStepLimit;
+  // If we already reconstructed a proof of this equality, reuse it.
+  std::pair<Node, rewriter::TheoryRewriteMode> key(res, tm);
+  std::map<std::pair<Node, rewriter::TheoryRewriteMode>,
+           std::shared_ptr<ProofNode>>::iterator itp = d_proven.find(key);
+  if (itp != d_proven.end())
+  {
+    Trace("pp-dsl") << "...reuse proof" << std::endl;
+    cdp->addProof(itp->second);
+    continueUpdate = true;
+    if (reqTrueElim)
+    {
+      cdp->addStep(res[0], ProofRule::TRUE_ELIM, {res}, {});
+    }
+    return true;
+  }
   // Attempt to reconstruct the proof of the equality into cdp using the
   // rewrite database proof reconstructor.
   // We record the subgoals in d_subgoals.
   if (d_rdbPc.prove(cdp, res[0], res[1], recLimit, stepLimit, tm))
   {
+    d_proven[key] = cdp->getProofFor(res);
     // we will update this again, in case the elaboration introduced
     // new trust steps
     continueUpdate = true;
@@ -69,6 +69,14 @@ class ProofPostprocessDsl : protected EnvObj, public ProofNodeUpdaterCallback
   rewriter::TheoryRewriteMode d_tmode;
   /** The current proofs we are traversing */
   std::vector<std::shared_ptr<ProofNode>> d_traversing;
+  /**
+   * Maps equalities and modes to the proofs we reconstructed for them. This
+   * is kept across calls to reconstruct, for which subproof merging does not
+   * apply.
+   */
+  std::map<std::pair<Node, rewriter::TheoryRewriteMode>,
+           std::shared_ptr<ProofNode>>
+      d_proven;
 };
 
 }  // namespace smt
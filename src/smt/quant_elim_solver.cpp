@@ -34,7 +34,10 @@ namespace cvc5::internal {
 namespace smt {
 
 QuantElimSolver::QuantElimSolver(Env& env, SmtSolver& sms, ContextManager* ctx)
-    : EnvObj(env), d_smtSolver(sms), d_ctx(ctx)
+    : EnvObj(env),
+      d_smtSolver(sms),
+      d_ctx(ctx),
+      d_nqeCache(new quantifiers::NestedQeCache)
 {
 }
 
@@ -54,7 +57,7 @@ Node QuantElimSolver::getQuantifierElimination(Node q,
   // ensure the body is rewritten
   q = nm->mkNode(q.getKind(), q[0], rewrite(q[1]));
   // do nested quantifier elimination if necessary
-  q = quantifiers::NestedQe::doNestedQe(d_env, q, true);
+  q = quantifiers::NestedQe::doNestedQe(d_env, q, true, d_nqeCache.get());
   Trace("smt-qe") << "QuantElimSolver: after nested quantifier elimination : "
                   << q << std::endl;
   Node keyword =
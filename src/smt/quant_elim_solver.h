@@ -18,11 +18,20 @@
 #ifndef CVC5__SMT__QUANT_ELIM_SOLVER_H
 #define CVC5__SMT__QUANT_ELIM_SOLVER_H
 
+#include <memory>
+
 #include "expr/node.h"
 #include "smt/assertions.h"
 #include "smt/env_obj.h"
 
 namespace cvc5::internal {
+
+namespace theory {
+namespace quantifiers {
+class NestedQeCache;
+}
+}  // namespace theory
+
 namespace smt {
 
 class SmtSolver;
@@ -98,6 +107,11 @@ class QuantElimSolver : protected EnvObj
   SmtSolver& d_smtSolver;
   /** The underlying context manager. */
   ContextManager* d_ctx;
+  /**
+   * The cache for nested quantifier elimination, which is shared by all
+   * quantifier elimination queries.
+   */
+  std::unique_ptr<theory::quantifiers::NestedQeCache> d_nqeCache;
 };
 
 }  // namespace smt
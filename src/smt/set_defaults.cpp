@@ -209,6 +209,10 @@ void SetDefaults::setDefaultsPre(Options& opts)
   {
     SET_AND_NOTIFY(smt, produceDifficulty, true, "dumpDifficulty");
   }
+  if (!opts.driver.learnedLiteralsOut.empty())
+  {
+    SET_AND_NOTIFY(smt, produceLearnedLiterals, true, "learnedLiteralsOut");
+  }
   if (opts.smt.checkUnsatCores || opts.driver.dumpUnsatCores
       || opts.driver.dumpUnsatCoresLemmas || opts.smt.unsatAssumptions
       || opts.smt.minimalUnsatCores
@@ -418,6 +422,8 @@ void SetDefaults::setDefaultsPre(Options& opts)
                            deepRestartMode,
                            options::DeepRestartMode::NONE,
                            "internal subsolver");
+    // statistics snapshots are only written for the main solver
+    SET_AND_NOTIFY(base, statisticsEvery, 0, "internal subsolver");
   }
 }
 
@@ -637,6 +643,19 @@ void SetDefaults::setDefaultsPost(const LogicInfo& logic, Options& opts) const
     }
   }
 
+  // Output an error if streaming assertions is enabled with options that
+  // require the input assertions
+  if (opts.smt.streamAssertions)
+  {
+    std::stringstream reasonNoStream;
+    if (incompatibleWithStreamAssertions(opts, reasonNoStream))
+    {
+      std::stringstream ss;
+      ss << reasonNoStream.str() << " not supported with streaming assertions";
+      throw FatalOptionException(ss.str());
+    }
+  }
+
   // Disable options incompatible with unsat cores or output an error if enabled
   // explicitly
   if (opts.smt.produceUnsatCores)
@@ -931,6 +950,27 @@ void SetDefaults::setDefaultsPost(const LogicInfo& logic, Options& opts) const
     }
   }
 
+  if (opts.prop.cadicalInprocess)
+  {
+    // CaDiCaL may only eliminate the variables it is not asked about during
+    // search. This excludes the same logics as minisat variable elimination,
+    // as well as decision heuristics that inspect the values of Boolean
+    // variables, incremental solving (new assertions may refer to eliminated
+    // variables) and SAT proofs.
+    if (logic.isTheoryEnabled(THEORY_SETS) || logic.isTheoryEnabled(THEORY_BAGS)
+        || logic.isTheoryEnabled(THEORY_ARRAYS)
+        || logic.isTheoryEnabled(THEORY_STRINGS)
+        || logic.isTheoryEnabled(THEORY_DATATYPES) || logic.isQuantified()
+        || opts.smt.produceModels || opts.smt.produceAssignments
+        || opts.smt.checkModels
+        || (logic.isTheoryEnabled(THEORY_ARITH) && !logic.isLinear())
+        || opts.decision.decisionMode != options::DecisionMode::INTERNAL
+        || opts.base.incrementalSolving || opts.smt.produceProofs)
+    {
+      SET_AND_NOTIFY(prop, cadicalInprocess, false, "non-basic logic");
+    }
+  }
+
   if (logic.isTheoryEnabled(THEORY_ARITH) && !logic.isLinear()
       && opts.arith.nlRlvMode != options::NlRlvMode::NONE)
   {
@@ -1109,6 +1149,12 @@ bool SetDefaults::incompatibleWithProofs(Options& opts,
     reason << "global-negate";
     return true;
   }
+  if (opts.parallel.solvePartitions)
+  {
+    // the result is obtained from subsolvers
+    reason << "solve-partitions";
+    return true;
+  }
   bool isFullPf = (opts.smt.proofMode == options::ProofMode::FULL
                    || opts.smt.proofMode == options::ProofMode::FULL_STRICT);
   if (isSygus(opts))
@@ -1218,6 +1264,11 @@ bool SetDefaults::incompatibleWithModels(const Options& opts,
     reason << "arrays-weak-equiv";
     return true;
   }
+  else if (opts.parallel.solvePartitions)
+  {
+    reason << "solve-partitions";
+    return true;
+  }
   return false;
 }
 
@@ -1325,6 +1376,11 @@ bool SetDefaults::incompatibleWithUnsatCores(Options& opts,
     SET_AND_NOTIFY_VAL_SYM(
         smt, deepRestartMode, options::DeepRestartMode::NONE, "unsat cores");
   }
+  if (opts.parallel.solvePartitions)
+  {
+    reason << "solving partitions";
+    return true;
+  }
   if (opts.smt.learnedRewrite)
   {
     if (opts.smt.learnedRewriteWasSetByUser)
@@ -1392,6 +1448,64 @@ bool SetDefaults::incompatibleWithSygus(const Options& opts,
   return false;
 }
 
+bool SetDefaults::incompatibleWithStreamAssertions(const Options& opts,
+                                                   std::ostream& reason) const
+{
+  // All features that access the input assertions after they are preprocessed
+  // are listed here.
+  if (opts.base.incrementalSolving)
+  {
+    reason << "incremental solving";
+    return true;
+  }
+  if (opts.smt.produceProofs)
+  {
+    reason << "proofs";
+    return true;
+  }
+  if (opts.smt.produceUnsatCores)
+  {
+    reason << "unsat cores";
+    return true;
+  }
+  if (opts.parallel.solvePartitions)
+  {
+    reason << "solving partitions";
+    return true;
+  }
+  if (opts.smt.produceDifficulty)
+  {
+    reason << "difficulty";
+    return true;
+  }
+  if (opts.smt.checkModels)
+  {
+    reason << "model checking";
+    return true;
+  }
+  if (opts.smt.modelCoresMode != options::ModelCoresMode::NONE)
+  {
+    reason << "model cores";
+    return true;
+  }
+  if (opts.smt.produceAbducts || opts.smt.produceInterpolants)
+  {
+    reason << "abducts and interpolants";
+    return true;
+  }
+  if (opts.smt.deepRestartMode != options::DeepRestartMode::NONE)
+  {
+    reason << "deep restarts";
+    return true;
+  }
+  if (isSygus(opts))
+  {
+    reason << "sygus";
+    return true;
+  }
+  return false;
+}
+
 bool SetDefaults::incompatibleWithQuantifiers(const Options& opts,
                                               std::ostream& reason) const
 {
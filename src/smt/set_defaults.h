@@ -132,6 +132,13 @@ class SetDefaults : protected EnvObj
    */
   bool incompatibleWithSeparationLogic(Options& opts,
                                        std::ostream& reason) const;
+  /**
+   * Check if incompatible with streaming assertions, that is, if we require
+   * the input assertions after preprocessing. The output stream reason is
+   * similar to above.
+   */
+  bool incompatibleWithStreamAssertions(const Options& opts,
+                                        std::ostream& reason) const;
   //------------------------- options setting, prior finalization of logic
   /**
    * Set defaults pre, which sets all options prior to finalizing the logic.
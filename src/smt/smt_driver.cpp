@@ -17,12 +17,17 @@
 
 #include "options/base_options.h"
 #include "options/main_options.h"
+#include "options/parallel_options.h"
 #include "options/smt_options.h"
 #include "prop/prop_engine.h"
 #include "smt/context_manager.h"
 #include "smt/env.h"
 #include "smt/logic_exception.h"
 #include "smt/smt_solver.h"
+#include "smt/solver_engine.h"
+#include "theory/partition_generator.h"
+#include "theory/smt_engine_subsolver.h"
+#include "theory/theory_engine.h"
 
 namespace cvc5::internal {
 namespace smt {
@@ -66,9 +71,13 @@ Result SmtDriver::checkSat(const std::vector<Node>& assumptions)
     // if we are already out of (cumulative) resources
     if (rm->out())
     {
-      UnknownExplanation why = rm->outOfResources()
-                                   ? UnknownExplanation::RESOURCEOUT
-                                   : UnknownExplanation::TIMEOUT;
+      UnknownExplanation why =
+          rm->outOfMemory()
+              ? UnknownExplanation::MEMOUT
+              : (rm->outOfResources()
+                     ? UnknownExplanation::RESOURCEOUT
+                     : (rm->outOfTime() ? UnknownExplanation::TIMEOUT
+                                        : UnknownExplanation::INTERRUPTED));
       result = Result(Result::UNKNOWN, why);
     }
     else
@@ -86,7 +95,7 @@ Result SmtDriver::checkSat(const std::vector<Node>& assumptions)
                    == UnknownExplanation::REQUIRES_CHECK_AGAIN)
         {
           // finish init to construct new theory/prop engine
-          d_smt.finishInit();
+          d_smt.finishInit(d_smt.getUserLogic());
         }
         else
         {
@@ -172,6 +181,20 @@ Result SmtDriverSingleCall::checkSatNext(preprocessing::AssertionPipeline& ap)
   d_smt.assertToInternal(ap);
   // get result
   Result result = d_smt.checkSatInternal();
+  if (options().parallel.solvePartitions
+      && result.getStatus() == Result::UNSAT)
+  {
+    theory::PartitionGenerator* pg =
+        d_smt.getTheoryEngine()->getPartitionGenerator();
+    if (pg != nullptr)
+    {
+      std::vector<Node> partitions = pg->getPartitionsToSolve();
+      if (!partitions.empty())
+      {
+        result = solvePartitions(partitions);
+      }
+    }
+  }
   // handle preprocessing-specific modifications to result
   if (ap.isNegated())
   {
@@ -204,10 +227,57 @@ Result SmtDriverSingleCall::checkSatNext(preprocessing::AssertionPipeline& ap)
   return result;
 }
 
+Result SmtDriverSingleCall::solvePartitions(
+    const std::vector<Node>& partitions)
+{
+  // The partitions are in terms of the input, hence we solve them with the
+  // input assertions rather than with the preprocessed ones, since e.g.
+  // variables that are solved for do not occur in the latter.
+  const context::CDList<Node>& al = d_smt.getAssertions().getAssertionList();
+  Options subOptions;
+  subOptions.copyValues(options());
+  subOptions.write_parallel().computePartitions = 0;
+  theory::SubsolverSetupInfo ssi(d_env, subOptions);
+  Result result(Result::UNSAT);
+  for (size_t i = 0, npartitions = partitions.size(); i < npartitions; i++)
+  {
+    Trace("partitions") << "Solve partition #" << i << ": " << partitions[i]
+                        << std::endl;
+    std::unique_ptr<SolverEngine> subSolver;
+    theory::initializeSubsolver(nodeManager(), subSolver, ssi);
+    for (const Node& a : al)
+    {
+      subSolver->assertFormula(a);
+    }
+    subSolver->assertFormula(partitions[i]);
+    Result r = subSolver->checkSat();
+    Trace("partitions") << "...result is " << r << std::endl;
+    if (r.getStatus() == Result::SAT)
+    {
+      return r;
+    }
+    if (r.getStatus() != Result::UNSAT)
+    {
+      // we continue, since another partition may be sat
+      result = r;
+    }
+  }
+  return result;
+}
+
 void SmtDriverSingleCall::getNextAssertions(
     preprocessing::AssertionPipeline& ap)
 {
   Assertions& as = d_smt.getAssertions();
+  if (options().smt.streamAssertions)
+  {
+    // the assertions are only referenced by ap from now on
+    for (const Node& a : as.releaseStreamedAssertions())
+    {
+      ap.push_back(a, true);
+    }
+    return;
+  }
   const context::CDList<Node>& al = as.getAssertionList();
   size_t alsize = al.size();
   for (size_t i = d_assertionListIndex.get(); i < alsize; ++i)
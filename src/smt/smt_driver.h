@@ -145,6 +145,13 @@ class SmtDriverSingleCall : public SmtDriver
   Result checkSatNext(preprocessing::AssertionPipeline& ap) override;
   /** Gets all the assertions we have yet to process */
   void getNextAssertions(preprocessing::AssertionPipeline& ap) override;
+  /**
+   * Solve the partitions that remain after the check of the underlying SMT
+   * solver, which used compute-partitions, answered unsat. Each partition is
+   * solved together with the input assertions in a subsolver. Returns sat if
+   * some partition is sat, unsat if all are unsat, and unknown otherwise.
+   */
+  Result solvePartitions(const std::vector<Node>& partitions);
   /**
    * The first index in the assertion list of the underlying SMT solver that we
    * have not processed yet. The call to getNextAssertions gets all assertions
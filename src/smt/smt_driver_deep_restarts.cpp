@@ -28,24 +28,47 @@ namespace smt {
 SmtDriverDeepRestarts::SmtDriverDeepRestarts(Env& env,
                                              SmtSolver& smt,
                                              ContextManager* ctx)
-    : SmtDriver(env, smt, ctx), d_firstTime(true)
+    : SmtDriver(env, smt, ctx),
+      d_firstTime(true),
+      d_round(0),
+      d_numRestarts(
+          statisticsRegistry().registerInt("smt::DeepRestarts::numRestarts")),
+      d_numLearnedLits(statisticsRegistry().registerInt(
+          "smt::DeepRestarts::numLearnedLiterals")),
+      d_numLearnedClauses(statisticsRegistry().registerInt(
+          "smt::DeepRestarts::numLearnedClauses")),
+      d_learnedLitsPerRound(statisticsRegistry().registerHistogram<uint32_t>(
+          "smt::DeepRestarts::learnedLiteralsPerRound")),
+      d_learnedClausesPerRound(statisticsRegistry().registerHistogram<uint32_t>(
+          "smt::DeepRestarts::learnedClausesPerRound"))
 {
 }
 
 Result SmtDriverDeepRestarts::checkSatNext(preprocessing::AssertionPipeline& ap)
 {
   d_zll.clear();
+  d_clauses.clear();
   d_smt.preprocess(ap);
   d_smt.assertToInternal(ap);
   Result result = d_smt.checkSatInternal();
   // check again if we didn't solve and there are learned literals
   if (result.getStatus() == Result::UNKNOWN)
   {
-    // get the learned literals immediately
-    d_zll = d_smt.getPropEngine()->getLearnedZeroLevelLiteralsForRestart();
-    // check again if there are any
+    // get the learned literals and clauses immediately, since the prop
+    // engine is reset on the next round
+    prop::PropEngine* pe = d_smt.getPropEngine();
+    d_zll = pe->getLearnedZeroLevelLiteralsForRestart();
+    // check again if there are any learned literals
     if (!d_zll.empty())
     {
+      d_clauses = pe->getLearnedClausesForRestart();
+      ++d_numRestarts;
+      d_numLearnedLits += d_zll.size();
+      d_numLearnedClauses += d_clauses.size();
+      // indexed by the round that learned them
+      d_learnedLitsPerRound.set(d_round, d_zll.size());
+      d_learnedClausesPerRound.set(d_round, d_clauses.size());
+      ++d_round;
       return Result(Result::UNKNOWN, UnknownExplanation::REQUIRES_CHECK_AGAIN);
     }
   }
@@ -108,6 +131,15 @@ void SmtDriverDeepRestarts::getNextAssertions(
       d_allLearnedLits.insert(lit);
     }
   }
+  // The learned clauses are implied by the assertions and the theory lemmas
+  // of the previous round, hence adding them does not change satisfiability.
+  Trace("deep-restart") << "Have " << d_clauses.size() << " learned clauses"
+                        << std::endl;
+  for (const Node& c : d_clauses)
+  {
+    Trace("deep-restart-lit") << "Restart learned clause: " << c << std::endl;
+    ap.push_back(c);
+  }
   Trace("deep-restart") << "Finished compute deep restart" << std::endl;
   // Note that the environment may contain top-level substitutions derived
   // on the previous check-sat. Since the context does not change, these
@@ -20,6 +20,7 @@
 
 #include "smt/smt_driver.h"
 #include "util/result.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace smt {
@@ -37,6 +38,9 @@ class ContextManager;
  * - no literal has been learned after some threshold.
  * In this case, we preprocess and checkSat again where the SMT solver has
  * its PropEngine and TheoryEngine reset.
+ *
+ * The learned literals are added to the assertions of the next round, as well
+ * as the short learned clauses if option deepRestartClauseSize is set.
  */
 class SmtDriverDeepRestarts : public SmtDriver
 {
@@ -51,10 +55,24 @@ class SmtDriverDeepRestarts : public SmtDriver
  private:
   /** first time? */
   bool d_firstTime;
+  /** The index of the current round */
+  uint32_t d_round;
   /** The current learned literals */
   std::vector<Node> d_zll;
+  /** The current learned clauses */
+  std::vector<Node> d_clauses;
   /** All learned literals, used for debugging */
   std::unordered_set<Node> d_allLearnedLits;
+  /** The number of deep restarts */
+  IntStat d_numRestarts;
+  /** The number of learned literals added on deep restarts */
+  IntStat d_numLearnedLits;
+  /** The number of learned clauses added on deep restarts */
+  IntStat d_numLearnedClauses;
+  /** The number of learned literals of each round */
+  HistogramStat<uint32_t> d_learnedLitsPerRound;
+  /** The number of learned clauses of each round */
+  HistogramStat<uint32_t> d_learnedClausesPerRound;
 };
 
 }  // namespace smt
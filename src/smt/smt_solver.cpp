@@ -34,6 +34,7 @@
 #include "smt/proof_manager.h"
 #include "smt/solver_engine_stats.h"
 #include "theory/logic_info.h"
+#include "theory/rewriter.h"
 #include "theory/theory_engine.h"
 #include "theory/theory_traits.h"
 
@@ -56,20 +57,35 @@ SmtSolver::SmtSolver(Env& env, SolverEngineStatistics& stats)
 
 SmtSolver::~SmtSolver() {}
 
-void SmtSolver::finishInit()
+void SmtSolver::finishInit(const LogicInfo& userLogic)
 {
+  d_userLogic = userLogic;
   // We have mutual dependency here, so we add the prop engine to the theory
   // engine later (it is non-essential there)
   d_theoryEngine.reset(new TheoryEngine(d_env));
 
-  // Add the theories
+  // Add the theories. We do not construct the theories, with their
+  // solvers and statistics, whose terms cannot occur in the input. The
+  // remaining theories use the default theory rewriter, which leaves their
+  // terms unchanged. If proofs are enabled, all theories are constructed
+  // since their proof checkers may be required for steps outside the logic.
+  ProofNodeManager* pnm = d_env.getProofNodeManager();
+  const LogicInfo& logic = logicInfo();
   for (theory::TheoryId id = theory::THEORY_FIRST; id < theory::THEORY_LAST;
        ++id)
   {
-    theory::TheoryConstructor::addTheory(d_theoryEngine.get(), id);
+    if (pnm != nullptr || logic.isTheoryEnabled(id)
+        || userLogic.isTheoryEnabled(id))
+    {
+      theory::TheoryConstructor::addTheory(d_theoryEngine.get(), id);
+    }
+    else
+    {
+      Trace("smt-debug") << "Not constructing theory " << id << std::endl;
+      d_env.getRewriter()->registerTheoryRewriter(id, nullptr);
+    }
   }
   // Add the proof checkers for each theory
-  ProofNodeManager* pnm = d_env.getProofNodeManager();
   if (pnm)
   {
     // reset the rule checkers
@@ -133,10 +149,27 @@ void SmtSolver::interrupt()
 
 Result SmtSolver::checkSatInternal()
 {
+  for (const Node& lit : d_phaseHints)
+  {
+    bool pol = lit.getKind() != Kind::NOT;
+    TNode atom = pol ? lit : lit[0];
+    if (d_propEngine->isSatLiteral(atom))
+    {
+      d_propEngine->preferPhase(atom, pol);
+    }
+  }
   // call the prop engine to check sat
   return d_propEngine->checkSat();
 }
 
+void SmtSolver::addPhaseHints(const std::vector<Node>& lits)
+{
+  for (const Node& lit : lits)
+  {
+    d_phaseHints.push_back(rewrite(lit));
+  }
+}
+
 void SmtSolver::preprocess(preprocessing::AssertionPipeline& ap)
 {
   TimerStat::CodeTimer paTimer(d_stats.d_processAssertionsTime);
@@ -213,7 +246,7 @@ const context::CDHashMap<size_t, Node>& SmtSolver::getPreprocessedSkolemMap()
 bool SmtSolver::trackPreprocessedAssertions() const
 {
   return options().smt.deepRestartMode != options::DeepRestartMode::NONE
-         || options().smt.produceProofs;
+         || options().smt.produceProofs || options().smt.preprocessedClones;
 }
 
 TheoryEngine* SmtSolver::getTheoryEngine() { return d_theoryEngine.get(); }
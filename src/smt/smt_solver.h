@@ -73,8 +73,18 @@ class SmtSolver : protected EnvObj
   ~SmtSolver();
   /**
    * Create theory engine, prop engine based on the environment.
+   *
+   * Only the theories that are enabled by the logic or by the given logic
+   * of the user are constructed, unless proofs are enabled. Terms of the other
+   * theories are rejected by the theory engine.
+   *
+   * @param userLogic The logic set by the user, which may include theories
+   * that are disabled in the logic of the environment since they are
+   * eliminated during preprocessing, e.g. by ackermannization.
    */
-  void finishInit();
+  void finishInit(const LogicInfo& userLogic);
+  /** Get the logic of the user given to the last call to finishInit. */
+  const LogicInfo& getUserLogic() const { return d_userLogic; }
   /** Reset all assertions, global declarations, etc.  */
   void resetAssertions();
   /**
@@ -131,12 +141,21 @@ class SmtSolver : protected EnvObj
    * processes the results based on the options.
    */
   Result checkSatInternal();
+  /**
+   * Add literals whose phase the SAT solver should prefer in the following
+   * checks, e.g., literals learned in an earlier run on a similar input. This
+   * only affects the decisions of the SAT solver and is always sound. The
+   * literals that do not occur in the preprocessed assertions are ignored.
+   */
+  void addPhaseHints(const std::vector<Node>& lits);
 
  private:
   /** Whether we track information necessary for deep restarts */
   bool trackPreprocessedAssertions() const;
   /** Finish initialization of preprocessor */
   void finishInitPreprocessor();
+  /** The logic of the user, given to finishInit */
+  LogicInfo d_userLogic;
   /** The preprocessor of this SMT solver */
   Preprocessor d_pp;
   /** Assertions manager */
@@ -147,6 +166,8 @@ class SmtSolver : protected EnvObj
   std::unique_ptr<TheoryEngine> d_theoryEngine;
   /** The propositional engine */
   std::unique_ptr<prop::PropEngine> d_propEngine;
+  /** The (rewritten) literals added by addPhaseHints */
+  std::vector<Node> d_phaseHints;
   //------------------------------------------ Bookkeeping for deep restarts
   /** The exact list of preprocessed assertions we sent to the PropEngine */
   NodeList d_ppAssertions;
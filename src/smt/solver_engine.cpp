@@ -40,6 +40,7 @@
 #include "options/quantifiers_options.h"
 #include "options/smt_options.h"
 #include "options/theory_options.h"
+#include "preprocessing/assertion_pipeline.h"
 #include "preprocessing/passes/synth_rew_rules.h"
 #include "printer/printer.h"
 #include "proof/unsat_core.h"
@@ -66,6 +67,7 @@
 #include "smt/smt_solver.h"
 #include "smt/solver_engine_state.h"
 #include "smt/solver_engine_stats.h"
+#include "smt/subsolver_options_cache.h"
 #include "smt/sygus_solver.h"
 #include "smt/timeout_core_manager.h"
 #include "smt/unsat_core_manager.h"
@@ -120,12 +122,15 @@ SolverEngine::SolverEngine(NodeManager* nm, const Options* optr)
       d_safeOptsSetRegularOption(false),
       d_safeOptsSetRegularOptionToDefault(false),
       d_isInternalSubsolver(false),
+      d_subsolverOptionsCache(nullptr),
       d_stats(nullptr)
 {
   // listen to resource out
   getResourceManager()->registerListener(d_routListener.get());
   // make statistics
   d_stats.reset(new SolverEngineStatistics(d_env->getStatisticsRegistry()));
+  d_env->getContext()->setPopTimer(&d_stats->d_contextPopTime);
+  d_env->getUserContext()->setPopTimer(&d_stats->d_userContextPopTime);
   // make the SMT solver
   d_smtSolver.reset(new SmtSolver(*d_env, *d_stats));
   // make the context manager
@@ -178,8 +183,17 @@ void SolverEngine::finishInit()
 
   // Call finish init on the set defaults module. This inializes the logic
   // and the best default options based on our heuristics.
-  SetDefaults sdefaults(*d_env, d_isInternalSubsolver);
-  sdefaults.setDefaults(d_env->d_logic, getOptions());
+  if (d_isInternalSubsolver && d_subsolverOptionsCache != nullptr)
+  {
+    // reuse the defaults of subsolvers with the same options and logic
+    d_subsolverOptionsCache->setDefaults(
+        *d_env, d_env->d_logic, getOptions());
+  }
+  else
+  {
+    SetDefaults sdefaults(*d_env, d_isInternalSubsolver);
+    sdefaults.setDefaults(d_env->d_logic, getOptions());
+  }
 
   if (d_env->getOptions().smt.produceProofs)
   {
@@ -203,8 +217,20 @@ void SolverEngine::finishInit()
   // enable proof support in the environment/rewriter
   d_env->finishInit(d_pfManager.get());
 
+  if (d_env->getOptions().base.statisticsContext)
+  {
+    StatisticsRegistry& sr = d_env->getStatisticsRegistry();
+    d_stats->d_contextObjects =
+        std::make_unique<context::ContextStatistics>(sr, "context::");
+    d_stats->d_userContextObjects =
+        std::make_unique<context::ContextStatistics>(sr, "userContext::");
+    d_env->getContext()->setStatistics(d_stats->d_contextObjects.get());
+    d_env->getUserContext()->setStatistics(
+        d_stats->d_userContextObjects.get());
+  }
+
   Trace("smt-debug") << "SolverEngine::finishInit" << std::endl;
-  d_smtSolver->finishInit();
+  d_smtSolver->finishInit(getUserLogicInfo());
 
   // make SMT solver driver based on options
   if (options().smt.deepRestartMode != options::DeepRestartMode::NONE)
@@ -252,6 +278,12 @@ void SolverEngine::finishInit()
 
 void SolverEngine::shutdown()
 {
+  if (!d_isInternalSubsolver
+      && d_env->getOptions().base.rweightCalibrateWasSetByUser)
+  {
+    d_env->getResourceManager()->printCalibratedWeights(
+        *d_env->getOptions().base.rweightCalibrate);
+  }
   d_ctxManager->shutdown();
   d_env->shutdown();
 }
@@ -280,6 +312,10 @@ SolverEngine::~SolverEngine()
     d_smtDriver.reset(nullptr);
     d_smtSolver.reset(nullptr);
 
+    d_env->getContext()->setPopTimer(nullptr);
+    d_env->getUserContext()->setPopTimer(nullptr);
+    d_env->getContext()->setStatistics(nullptr);
+    d_env->getUserContext()->setStatistics(nullptr);
     d_stats.reset(nullptr);
     d_routListener.reset(nullptr);
     // destroy the state
@@ -806,6 +842,14 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
 {
   ensureWellFormedTerms(assumptions, "checkSat");
 
+  // flush the rewrite caches if they grew too large, which is safe here since
+  // no TNode refers to a rewritten term between satisfiability checks
+  uint64_t rewriteCacheLimit = d_env->getOptions().smt.rewriteCacheLimit;
+  if (rewriteCacheLimit > 0)
+  {
+    d_env->getRewriter()->flushCaches(rewriteCacheLimit);
+  }
+
   Trace("smt") << "SolverEngine::checkSat(" << assumptions << ")" << endl;
   // update the state to indicate we are about to run a check-sat
   d_state->notifyCheckSat();
@@ -846,6 +890,7 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
     }
   }
 
+  d_stats->updateContextMemory(*d_env->getContext()->getCMM());
   if (d_env->getOptions().base.statisticsEveryQuery)
   {
     printStatisticsDiff();
@@ -931,6 +976,16 @@ void SolverEngine::assertFormula(const Node& formula)
   assertFormulaInternal(formula);
 }
 
+void SolverEngine::assertFormulas(const std::vector<Node>& formulas)
+{
+  beginCall();
+  ensureWellFormedTerms(formulas, "assertFormulas");
+  for (const Node& f : formulas)
+  {
+    assertFormulaInternal(f);
+  }
+}
+
 void SolverEngine::assertFormulaInternal(const Node& formula)
 {
   // as an optimization we do not check whether formula is well-formed here, and
@@ -1203,6 +1258,14 @@ Node SolverEngine::simplify(const Node& t, bool applySubs)
 Node SolverEngine::getValue(const Node& t, bool fromUser)
 {
   ensureWellFormedTerm(t, "get value");
+  std::unordered_map<Node, Node> cache;
+  return getValueInternal(t, fromUser, cache);
+}
+
+Node SolverEngine::getValueInternal(const Node& t,
+                                    bool fromUser,
+                                    std::unordered_map<Node, Node>& cache)
+{
   Trace("smt") << "SMT getValue(" << t << ")" << endl;
   TypeNode expectedType = t.getType();
 
@@ -1212,7 +1275,6 @@ Node SolverEngine::getValue(const Node& t, bool fromUser)
   // a division-by-zero term, we require getting the appropriate skolem
   // function corresponding to division-by-zero which may have been used during
   // the previous satisfiability check.
-  std::unordered_map<Node, Node> cache;
   ExpandDefs expDef(*d_env.get());
   // Must apply substitutions first to ensure we expand definitions in the
   // solved form of t as well.
@@ -1326,10 +1388,14 @@ Node SolverEngine::getValue(const Node& t, bool fromUser)
 std::vector<Node> SolverEngine::getValues(const std::vector<Node>& exprs,
                                           bool fromUser)
 {
+  ensureWellFormedTerms(exprs, "get value");
+  // the terms share the cache for expanding definitions, which is common for
+  // terms whose values are requested together
+  std::unordered_map<Node, Node> cache;
   std::vector<Node> result;
   for (const Node& e : exprs)
   {
-    result.push_back(getValue(e, fromUser));
+    result.push_back(getValueInternal(e, fromUser, cache));
   }
   return result;
 }
@@ -1459,6 +1525,12 @@ std::pair<Node, Node> SolverEngine::getSepHeapAndNilExpr(void)
 std::vector<Node> SolverEngine::getAssertionsInternal() const
 {
   Assert(d_state->isFullyInited());
+  if (d_env->getOptions().smt.streamAssertions)
+  {
+    throw ModalException(
+        "Cannot get the assertions when streaming assertions, which does not "
+        "keep the input assertions.");
+  }
   // ensure that global declarations are processed
   d_smtSolver->getAssertions().refresh();
   const CDList<Node>& al = d_smtSolver->getAssertions().getAssertionList();
@@ -1516,7 +1588,6 @@ void SolverEngine::printProof(std::ostream& out,
                               modes::ProofFormat proofFormat,
                               const std::map<Node, std::string>& assertionNames)
 {
-  out << "(" << std::endl;
   // we print in the format based on the proof mode
   options::ProofFormatMode mode = options::ProofFormatMode::NONE;
   switch (proofFormat)
@@ -1532,13 +1603,21 @@ void SolverEngine::printProof(std::ostream& out,
     case modes::ProofFormat::CPC: mode = options::ProofFormatMode::CPC; break;
     case modes::ProofFormat::LFSC: mode = options::ProofFormatMode::LFSC; break;
   }
-
+  // the binary format is not wrapped in parentheses
+  bool isBinary = mode == options::ProofFormatMode::BINARY;
+  if (!isBinary)
+  {
+    out << "(" << std::endl;
+  }
   d_pfManager->printProof(out,
                           fp,
                           mode,
                           ProofScopeMode::DEFINITIONS_AND_ASSERTIONS,
                           assertionNames);
-  out << ")" << std::endl;
+  if (!isBinary)
+  {
+    out << ")" << std::endl;
+  }
 }
 
 std::vector<Node> SolverEngine::getSubstitutedAssertions()
@@ -1603,6 +1682,14 @@ std::vector<Node> SolverEngine::getLearnedLiterals(modes::LearnedLitType t)
   return pe->getLearnedZeroLevelLiterals(t);
 }
 
+void SolverEngine::addPhaseHints(const std::vector<Node>& lits)
+{
+  Trace("smt") << "SMT addPhaseHints(" << lits.size() << " literals)"
+               << std::endl;
+  beginCall();
+  d_smtSolver->addPhaseHints(lits);
+}
+
 void SolverEngine::checkProof()
 {
   Assert(d_env->getOptions().smt.produceProofs);
@@ -1649,6 +1736,8 @@ void SolverEngine::endCall()
   // refresh the resource manager (for stats)
   ResourceManager* rm = getResourceManager();
   rm->refresh();
+  // an interruption only applies to the call during which it was requested
+  rm->clearInterrupt();
   Trace("limit") << "SolverEngine::endCall(): cumulative millis "
                  << rm->getTimeUsage() << ", resources "
                  << rm->getResourceUsage() << std::endl;
@@ -2114,6 +2203,49 @@ std::vector<Node> SolverEngine::getAssertions()
   return getAssertionsInternal();
 }
 
+std::unique_ptr<SolverEngine> SolverEngine::clonePreprocessed()
+{
+  Trace("smt") << "SMT clonePreprocessed()" << endl;
+  finishInit();
+  const Options& opts = d_env->getOptions();
+  if (!opts.smt.preprocessedClones)
+  {
+    throw ModalException(
+        "Cannot clone the preprocessed state when the pp-clones option is "
+        "off.");
+  }
+  if (opts.smt.produceProofs || opts.smt.produceUnsatCores)
+  {
+    throw ModalException(
+        "Cannot clone the preprocessed state when producing proofs or unsat "
+        "cores.");
+  }
+  std::unique_ptr<SolverEngine> clone =
+      std::make_unique<SolverEngine>(d_env->getNodeManager(), &opts);
+  // the clone does not know the original assertions
+  clone->getOptions().write_smt().checkModels = false;
+  clone->setLogic(d_userLogic);
+  clone->finishInit();
+  // the preprocessed assertions (with the definitions of their skolems) are
+  // the input of the clone, and are not preprocessed again
+  preprocessing::AssertionPipeline ap(*clone->d_env);
+  for (const Node& a : d_smtSolver->getPreprocessedAssertions())
+  {
+    ap.push_back(a);
+  }
+  preprocessing::IteSkolemMap& ism = ap.getIteSkolemMap();
+  for (const auto& k : d_smtSolver->getPreprocessedSkolemMap())
+  {
+    ism[k.first] = k.second;
+  }
+  // the top-level substitutions are needed for the values of the variables
+  // that were eliminated in preprocessing
+  clone->d_env->getTopLevelSubstitutions().addSubstitutions(
+      d_env->getTopLevelSubstitutions());
+  clone->d_smtSolver->assertToInternal(ap);
+  return clone;
+}
+
 void SolverEngine::getDifficultyMap(std::map<Node, Node>& dmap)
 {
   Trace("smt") << "SMT getDifficultyMap()\n";
@@ -2139,6 +2271,9 @@ void SolverEngine::push()
   Trace("smt") << "SMT push()" << endl;
   d_smtDriver->refreshAssertions();
   d_ctxManager->userPush();
+  // push is a natural point for collecting the nodes that became unreachable
+  // during the previous check
+  d_env->getNodeManager()->reclaimZombiesAtBoundary();
 }
 
 void SolverEngine::pop()
@@ -2150,6 +2285,9 @@ void SolverEngine::pop()
   // clear the learned literals from the preprocessor
   d_smtSolver->getPreprocessor()->clearLearnedLiterals();
 
+  // the nodes only referenced by the popped context are zombies now
+  d_env->getNodeManager()->reclaimZombiesAtBoundary();
+
   Trace("userpushpop") << "SolverEngine: popped to level "
                        << d_env->getUserContext()->getLevel() << endl;
   // should we reset d_status here?
@@ -2170,6 +2308,7 @@ void SolverEngine::resetAssertions()
   Trace("smt") << "SMT resetAssertions()" << endl;
 
   d_ctxManager->notifyResetAssertions();
+  d_state->notifyResetAssertions();
 
   // reset SmtSolver, which will construct a new prop engine
   d_smtSolver->resetAssertions();
@@ -2318,6 +2457,11 @@ void SolverEngine::setOption(const std::string& key,
 
 void SolverEngine::setIsInternalSubsolver() { d_isInternalSubsolver = true; }
 
+void SolverEngine::setSubsolverOptionsCache(smt::SubsolverOptionsCache* cache)
+{
+  d_subsolverOptionsCache = cache;
+}
+
 bool SolverEngine::isInternalSubsolver() const { return d_isInternalSubsolver; }
 
 std::string SolverEngine::getOption(const std::string& key) const
@@ -75,6 +75,7 @@ class FindSynthSolver;
 struct SolverEngineStatistics;
 class PfManager;
 class UnsatCoreManager;
+class SubsolverOptionsCache;
 
 }  // namespace smt
 
@@ -205,6 +206,11 @@ class CVC5_EXPORT SolverEngine
   void setIsInternalSubsolver();
   /** Is this an internal subsolver? */
   bool isInternalSubsolver() const;
+  /**
+   * Set the cache that is used to set the default options of this internal
+   * subsolver when it is initialized, see SubsolverOptionsCache.
+   */
+  void setSubsolverOptionsCache(smt::SubsolverOptionsCache* cache);
 
   /**
    * Block the current model. Can be called only if immediately preceded by
@@ -257,6 +263,12 @@ class CVC5_EXPORT SolverEngine
    */
   std::vector<Node> getLearnedLiterals(modes::LearnedLitType t);
 
+  /**
+   * Add literals whose phase the SAT solver should prefer in the following
+   * checks, e.g., literals learned in an earlier run on a similar input.
+   */
+  void addPhaseHints(const std::vector<Node>& lits);
+
   /**
    * Get an aspect of the current SMT execution environment.
    * @throw OptionException
@@ -333,6 +345,14 @@ class CVC5_EXPORT SolverEngine
    */
   void assertFormula(const Node& formula);
 
+  /**
+   * Same as assertFormula, for a vector of formulas, which are asserted in
+   * order.
+   *
+   * @throw TypeCheckingException, LogicException
+   */
+  void assertFormulas(const std::vector<Node>& formulas);
+
   /**
    * Assert a formula (if provided) to the current context and call
    * check().  Returns SAT, UNSAT, or UNKNOWN result.
@@ -745,6 +765,24 @@ class CVC5_EXPORT SolverEngine
    */
   std::vector<Node> getAssertions();
 
+  /**
+   * Make a new solver engine whose starting point is the preprocessed state
+   * of this one, e.g., to solve the cubes of a partition of the problem.
+   * The preprocessed assertions, which share their nodes with this solver
+   * engine, and the top-level substitutions are asserted to the new solver
+   * engine without preprocessing them again. The SAT and theory state of
+   * the new solver engine are built from these assertions.
+   *
+   * The new solver engine uses the same node manager, so it must not be
+   * used concurrently with this solver engine. It only knows the
+   * preprocessed assertions, so it cannot check models or produce proofs
+   * and unsat cores.
+   *
+   * Requires that this solver engine tracks its preprocessed assertions
+   * (--pp-clones) and does not produce proofs or unsat cores.
+   */
+  std::unique_ptr<SolverEngine> clonePreprocessed();
+
   /**
    * Get difficulty map, which populates dmap, mapping input assertions
    * to a value that estimates their difficulty for solving the current problem.
@@ -932,6 +970,13 @@ class CVC5_EXPORT SolverEngine
 
   /** Internal version of assertFormula */
   void assertFormulaInternal(const Node& formula);
+  /**
+   * Internal version of getValue, where cache is the cache used for
+   * expanding definitions. This cache is shared by the terms of getValues.
+   */
+  Node getValueInternal(const Node& t,
+                        bool fromUser,
+                        std::unordered_map<Node, Node>& cache);
 
   /**
    * Check that a generated proof checks. This method is the same as getProof,
@@ -1151,6 +1196,8 @@ class CVC5_EXPORT SolverEngine
 
   /** Whether this is an internal subsolver. */
   bool d_isInternalSubsolver;
+  /** The cache for setting the default options, if this is a subsolver. */
+  smt::SubsolverOptionsCache* d_subsolverOptionsCache;
 
   /** The statistics class */
   std::unique_ptr<smt::SolverEngineStatistics> d_stats;
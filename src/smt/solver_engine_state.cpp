@@ -185,6 +185,14 @@ void SolverEngineState::notifyUserPop()
   d_smtMode = SmtMode::ASSERT;
 }
 
+void SolverEngineState::notifyResetAssertions()
+{
+  // The result of the last query no longer applies, and its model, proof and
+  // unsat core are not available anymore.
+  d_status = Result();
+  d_smtMode = SmtMode::ASSERT;
+}
+
 Result SolverEngineState::getStatus() const { return d_status; }
 
 bool SolverEngineState::isFullyInited() const { return d_fullyInited; }
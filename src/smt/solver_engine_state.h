@@ -79,6 +79,11 @@ class SolverEngineState : protected EnvObj
    * the SMT-LIB command pop.
    */
   void notifyUserPop();
+  /**
+   * Called when the user of SolverEngine resets the assertions. This
+   * corresponds to the SMT-LIB command reset-assertions.
+   */
+  void notifyResetAssertions();
   /**
    * Notify that the result of the last check-sat was r. This should be called
    * once immediately following notifyCheckSat() if the check-sat call
@@ -29,10 +29,44 @@ SolverEngineStatistics::SolverEngineStatistics(StatisticsRegistry& sr,
       d_checkUnsatCoreTime(sr.registerTimer(name + "checkUnsatCoreTime")),
       d_solveTime(sr.registerTimer(name + "solveTime")),
       d_pushPopTime(sr.registerTimer(name + "pushPopTime")),
+      d_contextPopTime(sr.registerTimer(name + "contextPopTime")),
+      d_userContextPopTime(sr.registerTimer(name + "userContextPopTime")),
       d_processAssertionsTime(sr.registerTimer(name + "processAssertionsTime")),
-      d_simplifiedToFalse(sr.registerInt(name + "simplifiedToFalse"))
+      d_simplifiedToFalse(sr.registerInt(name + "simplifiedToFalse")),
+      d_contextChunksAllocated(sr.registerHistogram<uint32_t>(
+          name + "contextMemory::chunksAllocated")),
+      d_contextChunksReused(sr.registerHistogram<uint32_t>(
+          name + "contextMemory::chunksReused")),
+      d_contextChunksReleased(sr.registerHistogram<uint32_t>(
+          name + "contextMemory::chunksReleased"))
 {
 }
 
+namespace {
+/** Copy the per-level counters in v to stat */
+void setLevels(HistogramStat<uint32_t>& stat, const std::vector<uint64_t>& v)
+{
+  for (size_t i = 0, n = v.size(); i < n; ++i)
+  {
+    if (v[i] > 0)
+    {
+      stat.set(static_cast<uint32_t>(i), v[i]);
+    }
+  }
+}
+}  // namespace
+
+void SolverEngineStatistics::updateContextMemory(
+    const context::ContextMemoryManager& cmm)
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    const context::ContextMemoryStatistics& stats = cmm.getStatistics();
+    setLevels(d_contextChunksAllocated, stats.d_allocated);
+    setLevels(d_contextChunksReused, stats.d_reused);
+    setLevels(d_contextChunksReleased, stats.d_released);
+  }
+}
+
 }  // namespace smt
 }  // namespace cvc5::internal
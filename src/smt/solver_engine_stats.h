@@ -18,6 +18,10 @@
 #ifndef CVC5__SMT__SOLVER_ENGINE_STATS_H
 #define CVC5__SMT__SOLVER_ENGINE_STATS_H
 
+#include <memory>
+
+#include "context/context_mm.h"
+#include "context/context_stats.h"
 #include "util/statistics_registry.h"
 #include "util/statistics_stats.h"
 
@@ -44,11 +48,33 @@ struct SolverEngineStatistics
   TimerStat d_solveTime;
   /** time spent in pushing/popping */
   TimerStat d_pushPopTime;
+  /** time spent in popping the SAT context */
+  TimerStat d_contextPopTime;
+  /** time spent in popping the user context */
+  TimerStat d_userContextPopTime;
   /** time spent in processAssertions() */
   TimerStat d_processAssertionsTime;
 
   /** Has something simplified to false? */
   IntStat d_simplifiedToFalse;
+
+  /**
+   * Number of chunks of the SAT context memory that were allocated, reused
+   * and released, per context level
+   */
+  HistogramStat<uint32_t> d_contextChunksAllocated;
+  HistogramStat<uint32_t> d_contextChunksReused;
+  HistogramStat<uint32_t> d_contextChunksReleased;
+
+  /** Update the context memory statistics from cmm */
+  void updateContextMemory(const context::ContextMemoryManager& cmm);
+
+  /**
+   * The statistics on the save and restore operations of the objects in the
+   * SAT and user context, which are only collected with --stats-context
+   */
+  std::unique_ptr<context::ContextStatistics> d_contextObjects;
+  std::unique_ptr<context::ContextStatistics> d_userContextObjects;
 }; /* struct SolverEngineStatistics */
 
 }  // namespace smt
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache for the default options of internal subsolvers.
+ */
+
+#include "smt/subsolver_options_cache.h"
+
+#include "smt/env.h"
+#include "smt/set_defaults.h"
+
+namespace cvc5::internal {
+namespace smt {
+
+SubsolverOptionsCache::SubsolverOptionsCache() {}
+
+SubsolverOptionsCache::~SubsolverOptionsCache() {}
+
+void SubsolverOptionsCache::setDefaults(Env& env,
+                                        LogicInfo& logic,
+                                        Options& opts)
+{
+  bool hasSepHeap = env.hasSepHeap();
+  for (const std::unique_ptr<Entry>& e : d_entries)
+  {
+    if (e->d_hasSepHeap == hasSepHeap && e->d_inputLogic == logic
+        && e->d_inputOptions.hasEqualValues(opts))
+    {
+      Trace("subsolver-opts-cache") << "Use cached defaults for subsolver in "
+                                    << logic << std::endl;
+      opts.copyValues(e->d_options);
+      logic = e->d_logic;
+      env.setUninterpretedSortOwner(e->d_uninterpretedSortOwner);
+      return;
+    }
+  }
+  std::unique_ptr<Entry> e;
+  if (d_entries.size() < s_maxEntries)
+  {
+    e = std::make_unique<Entry>();
+    e->d_inputOptions.copyValues(opts);
+    e->d_inputLogic = logic;
+    e->d_hasSepHeap = hasSepHeap;
+  }
+  SetDefaults sdefaults(env, true);
+  sdefaults.setDefaults(logic, opts);
+  if (e != nullptr)
+  {
+    e->d_options.copyValues(opts);
+    e->d_logic = logic;
+    e->d_uninterpretedSortOwner = env.getUninterpretedSortOwner();
+    d_entries.push_back(std::move(e));
+  }
+}
+
+}  // namespace smt
+}  // namespace cvc5::internal
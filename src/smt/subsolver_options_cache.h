@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache for the default options of internal subsolvers.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__SUBSOLVER_OPTIONS_CACHE_H
+#define CVC5__SMT__SUBSOLVER_OPTIONS_CACHE_H
+
+#include <memory>
+#include <vector>
+
+#include "options/options.h"
+#include "theory/logic_info.h"
+#include "theory/theory_id.h"
+
+namespace cvc5::internal {
+
+class Env;
+
+namespace smt {
+
+/**
+ * Caches the result of SetDefaults for internal subsolvers.
+ *
+ * Internal subsolvers are typically initialized many times with the same
+ * options and logic, e.g. by MBQI or SyGuS. Since setting the default options
+ * only depends on the options, the logic and whether a separation logic heap
+ * is declared, the options and logic it computes are stored per such input and
+ * copied into subsolvers with the same input, instead of setting the defaults
+ * again.
+ *
+ * An instance of this class is owned by the Env of a solver engine and used
+ * for the subsolvers initialized based on it, see initializeSubsolver.
+ */
+class SubsolverOptionsCache
+{
+ public:
+  SubsolverOptionsCache();
+  ~SubsolverOptionsCache();
+  /**
+   * Set the default options and update the logic of an internal subsolver
+   * whose environment is env, as SetDefaults::setDefaults does. If the defaults
+   * were computed for the same input before, they are copied from this cache.
+   *
+   * @param env The environment of the subsolver.
+   * @param logic The logic of the subsolver.
+   * @param opts The options of the subsolver.
+   */
+  void setDefaults(Env& env, LogicInfo& logic, Options& opts);
+
+ private:
+  /** An input to SetDefaults and the result of setting the defaults for it. */
+  struct Entry
+  {
+    /** The options before setting the defaults */
+    Options d_inputOptions;
+    /** The logic before setting the defaults */
+    LogicInfo d_inputLogic;
+    /** Whether a separation logic heap was declared */
+    bool d_hasSepHeap;
+    /** The options after setting the defaults */
+    Options d_options;
+    /** The logic after setting the defaults */
+    LogicInfo d_logic;
+    /** The owner of the uninterpreted sort after setting the defaults */
+    theory::TheoryId d_uninterpretedSortOwner;
+  };
+  /** The maximum number of entries, after which no entries are added */
+  static constexpr size_t s_maxEntries = 16;
+  /** The entries */
+  std::vector<std::unique_ptr<Entry>> d_entries;
+};
+
+}  // namespace smt
+}  // namespace cvc5::internal
+
+#endif /* CVC5__SMT__SUBSOLVER_OPTIONS_CACHE_H */
@@ -404,12 +404,15 @@ bool TimeoutCoreManager::recordCurrentModel(bool& allAssertsSat,
   size_t startIndex =
       nasserts == 0 ? 0 : Random::getRandom().pick(0, nasserts - 1);
   currModel.resize(nasserts);
+  // evaluate all assertions at once, so that they share the cache for
+  // expanding definitions in the subsolver
+  std::vector<Node> mvals = d_subSolver->getValues(d_ppAsserts);
   bool hadFalseAssert = false;
   for (size_t i = 0; i < nasserts; i++)
   {
     size_t ii = (i + startIndex) % nasserts;
     Node a = d_ppAsserts[ii];
-    Node av = d_subSolver->getValue(a);
+    Node av = mvals[ii];
     Trace("smt-to-core-mv") << "M(" << a << ") = " << av << std::endl;
     av = av.isConst() ? av : Node::null();
     currModel[ii] = av;
@@ -15,6 +15,7 @@
 
 #include "unsat_core_manager.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "expr/skolem_manager.h"
@@ -23,6 +24,7 @@
 #include "printer/printer.h"
 #include "proof/proof.h"
 #include "proof/proof_node_algorithm.h"
+#include "proof/unsat_core.h"
 #include "prop/prop_engine.h"
 #include "smt/assertions.h"
 #include "smt/env.h"
@@ -232,30 +234,50 @@ std::vector<Node> UnsatCoreManager::reduceUnsatCore(
                    << std::endl;
   std::unordered_set<Node> removed;
   std::unordered_set<Node> adefs = as.getCurrentAssertionListDefitions();
-  for (const Node& skip : core)
+  bool chunked = options().smt.minimalUnsatCoresChunked;
+  size_t csize = chunked ? std::max<size_t>(core.size() / 2, 1) : 1;
+  std::vector<Node> subcore;
+  for (;;)
   {
-    std::unique_ptr<SolverEngine> coreChecker;
-    theory::initializeSubsolver(coreChecker, d_env);
-    coreChecker->setLogic(logicInfo());
-    // disable all proof options
-    SetDefaults::disableChecking(coreChecker->getOptions());
-    // add to removed set?
-    removed.insert(skip);
-    // assert everything to the subsolver
-    theory::assertToSubsolver(*coreChecker.get(), core, adefs, removed);
-    Result r;
-    try
+    for (size_t i = 0, ncore = core.size(); i < ncore; i += csize)
     {
-      r = coreChecker->checkSat();
-    }
-    catch (...)
-    {
-      throw;
-    }
-
-    if (r.getStatus() != Result::UNSAT)
-    {
-      removed.erase(skip);
+      // the assertions of this chunk that were not already removed
+      std::vector<Node> skip;
+      for (size_t j = i, jend = std::min(i + csize, ncore); j < jend; j++)
+      {
+        if (removed.find(core[j]) == removed.end())
+        {
+          skip.push_back(core[j]);
+        }
+      }
+      if (skip.empty())
+      {
+        continue;
+      }
+      removed.insert(skip.begin(), skip.end());
+      Result r =
+          checkReducedCore(core, adefs, removed, chunked ? &subcore : nullptr);
+      if (r.getStatus() == Result::UNSAT)
+      {
+        if (chunked)
+        {
+          // remove the assertions that were not needed by the subsolver
+          std::unordered_set<Node> subcoreSet(subcore.begin(), subcore.end());
+          for (const Node& n : core)
+          {
+            if (adefs.find(n) == adefs.end()
+                && subcoreSet.find(n) == subcoreSet.end())
+            {
+              removed.insert(n);
+            }
+          }
+        }
+        continue;
+      }
+      for (const Node& n : skip)
+      {
+        removed.erase(n);
+      }
       if (r.isUnknown())
       {
         d_env.warning()
@@ -264,6 +286,11 @@ std::vector<Node> UnsatCoreManager::reduceUnsatCore(
                "unknown result.";
       }
     }
+    if (csize == 1)
+    {
+      break;
+    }
+    csize = csize / 2;
   }
 
   if (removed.empty())
@@ -281,6 +308,29 @@ std::vector<Node> UnsatCoreManager::reduceUnsatCore(
   return newUcAssertions;
 }
 
+Result UnsatCoreManager::checkReducedCore(
+    const std::vector<Node>& core,
+    const std::unordered_set<Node>& adefs,
+    const std::unordered_set<Node>& removed,
+    std::vector<Node>* subcore)
+{
+  std::unique_ptr<SolverEngine> coreChecker;
+  theory::initializeSubsolver(coreChecker, d_env);
+  coreChecker->setLogic(logicInfo());
+  // disable all proof options
+  SetDefaults::disableChecking(coreChecker->getOptions());
+  // we do not want the subsolver to minimize its own unsat cores
+  coreChecker->getOptions().write_smt().minimalUnsatCores = false;
+  // assert everything to the subsolver
+  theory::assertToSubsolver(*coreChecker.get(), core, adefs, removed);
+  Result r = coreChecker->checkSat();
+  if (subcore != nullptr && r.getStatus() == Result::UNSAT)
+  {
+    *subcore = coreChecker->getUnsatCore().getCore();
+  }
+  return r;
+}
+
 void UnsatCoreManager::partitionUnsatCore(const std::vector<Node>& core,
                                           std::vector<Node>& coreDefs,
                                           std::vector<Node>& coreAsserts)
@@ -310,7 +360,7 @@ std::vector<Node> UnsatCoreManager::convertPreprocessedToInput(
   std::shared_ptr<ProofNode> pepf = cdp.getProofFor(fnode);
   Assert(pepf != nullptr);
   std::shared_ptr<ProofNode> pfn = d_pfm.connectProofToAssertions(
-      pepf, d_slv.getAssertions(), ProofScopeMode::UNIFIED);
+      pepf, d_slv.getAssertions(), ProofScopeMode::UNIFIED, true);
   getUnsatCoreInternal(pfn, core, isInternal);
   return core;
 }
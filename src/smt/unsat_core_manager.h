@@ -110,9 +110,25 @@ class UnsatCoreManager : protected EnvObj
                             bool isInternal);
   /**
    * Reduce an unsatisfiable core to make it minimal.
+   *
+   * By default, this tries to remove the assertions of core one at a time.
+   * With --minimal-unsat-cores-chunked, we instead try to remove chunks of
+   * assertions, starting with halves of the core and halving the chunk size
+   * until it is one. Moreover, whenever a check is unsat, we remove all
+   * assertions that are not in the unsat core of the subsolver. The last
+   * round ensures the result is minimal.
    */
   std::vector<Node> reduceUnsatCore(const Assertions& as,
                                     const std::vector<Node>& core);
+  /**
+   * Check the satisfiability of the assertions in core that are not in
+   * removed, where adefs are the definitions. If subcore is non-null and the
+   * result is unsat, it is set to the unsat core of the subsolver.
+   */
+  Result checkReducedCore(const std::vector<Node>& core,
+                          const std::unordered_set<Node>& adefs,
+                          const std::unordered_set<Node>& removed,
+                          std::vector<Node>* subcore);
   /**
    * Parition core into ordinary assertions and definitions. This method is
    * only used for printing output traces.
@@ -30,11 +30,10 @@
 #include "theory/arith/linear/cut_log.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
+#include "theory/arith/linear/partial_model.h"
 #include "util/statistics_registry.h"
 
 #ifdef CVC5_USE_GLPK
-#include "theory/arith/linear/partial_model.h"
-
 extern "C" {
 #include <glpk.h>
 } /* extern "C" */
@@ -165,10 +164,6 @@ class ApproxGLPK : public ApproximateSimplex
 
   virtual void setBranchOnVariableLimit(int bl) override;
 
-  virtual std::optional<Rational> estimateWithCFE(double d) const override;
-  virtual std::optional<Rational> estimateWithCFE(
-      double d, const Integer& D) const override;
-
  private:
   Solution extractSolution(bool mip) const;
   int guessDir(ArithVar v) const;
@@ -259,28 +254,6 @@ class ApproxGLPK : public ApproximateSimplex
 
   double sumInfeasibilities(glp_prob* prob, bool mip) const;
 
-  /** UTILITIES FOR DEALING WITH ESTIMATES */
-
-  static constexpr double SMALL_FIXED_DELTA = .000000001;
-  static constexpr double TOLERENCE = 1 + .000000001;
-
-  /** Returns true if two doubles are roughly equal based on TOLERENCE and
-   * SMALL_FIXED_DELTA.*/
-  static bool roughlyEqual(double a, double b);
-
-  /**
-   * Converts a rational to a continued fraction expansion representation
-   * using a maximum number of expansions equal to depth as long as the
-   * expression is not roughlyEqual() to 0.
-   */
-  static std::vector<Integer> rationalToCfe(const Rational& q, int depth);
-
-  /** Converts a continued fraction expansion representation to a rational. */
-  static Rational cfeToRational(const std::vector<Integer>& exp);
-
-  /** Estimates a rational as a continued fraction expansion.*/
-  static Rational estimateWithCFE(const Rational& q, const Integer& K);
-
  private:
   const ArithVariables& d_vars;
   TreeLog& d_log;
@@ -295,9 +268,6 @@ class ApproxGLPK : public ApproximateSimplex
   /* maxmimum branching depth allowed.*/
   int d_maxDepth;
 
-  /* Default denominator for diophatine approximation, 2^{26} .*/
-  static constexpr uint64_t s_defaultMaxDenom = (1 << 26);
-
   glp_prob* d_inputProb; /* a copy of the input prob */
   glp_prob* d_realProb;  /* a copy of the real relaxation output */
   glp_prob* d_mipProb;   /* a copy of the integer prob */
@@ -335,167 +305,6 @@ void ApproxGLPK::setBranchOnVariableLimit(int bl)
   d_branchLimit = bl;
 }
 
-bool ApproxGLPK::roughlyEqual(double a, double b)
-{
-  if (a == 0)
-  {
-    return -SMALL_FIXED_DELTA <= b && b <= SMALL_FIXED_DELTA;
-  }
-  else if (b == 0)
-  {
-    return -SMALL_FIXED_DELTA <= a && a <= SMALL_FIXED_DELTA;
-  }
-  else
-  {
-    return std::abs(b / a) <= TOLERENCE && std::abs(a / b) <= TOLERENCE;
-  }
-}
-
-Rational ApproxGLPK::cfeToRational(const std::vector<Integer>& exp)
-{
-  if (exp.empty())
-  {
-    return Rational(0);
-  }
-  else
-  {
-    Rational result = exp.back();
-    std::vector<Integer>::const_reverse_iterator exp_iter = exp.rbegin();
-    std::vector<Integer>::const_reverse_iterator exp_end = exp.rend();
-    ++exp_iter;
-    while (exp_iter != exp_end)
-    {
-      result = result.inverse();
-      const Integer& i = *exp_iter;
-      result += i;
-      ++exp_iter;
-    }
-    return result;
-  }
-}
-
-std::vector<Integer> ApproxGLPK::rationalToCfe(const Rational& q, int depth)
-{
-  std::vector<Integer> mods;
-  if (!q.isZero())
-  {
-    Rational carry = q;
-    for (int i = 0; i <= depth; ++i)
-    {
-      Assert(!carry.isZero());
-      mods.push_back(Integer());
-      Integer& back = mods.back();
-      back = carry.floor();
-      Trace("rationalToCfe") << "  cfe[" << i << "]: " << back << std::endl;
-      carry -= back;
-      if (carry.isZero())
-      {
-        break;
-      }
-      else if (ApproxGLPK::roughlyEqual(carry.getDouble(), 0.0))
-      {
-        break;
-      }
-      else
-      {
-        carry = carry.inverse();
-      }
-    }
-  }
-  return mods;
-}
-
-Rational ApproxGLPK::estimateWithCFE(const Rational& r, const Integer& K)
-{
-  Trace("estimateWithCFE") << "estimateWithCFE(" << r << ", " << K << ")"
-                           << std::endl;
-  // references
-  // page 4:
-  // http://carlossicoli.free.fr/C/Cassels_J.W.S.-An_introduction_to_diophantine_approximation-University_Press(1965).pdf
-  // http://en.wikipedia.org/wiki/Continued_fraction
-  Assert(K >= Integer(1));
-  if (r.getDenominator() <= K)
-  {
-    return r;
-  }
-
-  // current numerator and denominator that has not been resolved in the cfe
-  Integer num = r.getNumerator(), den = r.getDenominator();
-  Integer quot, rem;
-
-  unsigned t = 0;
-  // For a sequence of candidate solutions q_t/p_t
-  // we keep only 3 time steps: 0[prev], 1[current], 2[next]
-  // timesteps with a fake timestep 0 (p is 0 and q is 1)
-  // at timestep 1
-  Integer p[3];  // h
-  Integer q[3];  // k
-  // load the first 3 time steps manually
-  p[0] = 0;
-  q[0] = 1;  // timestep -2
-  p[1] = 1;
-  q[1] = 0;  // timestep -1
-
-  Integer::floorQR(quot, rem, num, den);
-  num = den;
-  den = rem;
-
-  q[2] = q[0] + quot * q[1];
-  p[2] = p[0] + quot * p[1];
-  Trace("estimateWithCFE") << "  cfe[" << t << "]: " << p[2] << "/" << q[2]
-                           << std::endl;
-  while (q[2] <= K)
-  {
-    p[0] = p[1];
-    p[1] = p[2];
-    q[0] = q[1];
-    q[1] = q[2];
-
-    Integer::floorQR(quot, rem, num, den);
-    num = den;
-    den = rem;
-
-    p[2] = p[0] + quot * p[1];
-    q[2] = q[0] + quot * q[1];
-    ++t;
-    Trace("estimateWithCFE")
-        << "  cfe[" << t << "]: " << p[2] << "/" << q[2] << std::endl;
-  }
-
-  Integer k = (K - q[0]).floorDivideQuotient(q[1]);
-  Rational cand_prev(p[0] + k * p[1], q[0] + k * q[1]);
-  Rational cand_curr(p[1], q[1]);
-  Rational dist_prev = (cand_prev - r).abs();
-  Rational dist_curr = (cand_curr - r).abs();
-  if (dist_prev <= dist_curr)
-  {
-    Trace("estimateWithCFE")
-        << cand_prev << " is closer than " << cand_curr << std::endl;
-    return cand_prev;
-  }
-  else
-  {
-    Trace("estimateWithCFE")
-        << cand_curr << " is closer than " << cand_prev << std::endl;
-    return cand_curr;
-  }
-}
-
-std::optional<Rational> ApproxGLPK::estimateWithCFE(double d,
-                                                    const Integer& D) const
-{
-  if (std::optional<Rational> from_double = Rational::fromDouble(d))
-  {
-    return estimateWithCFE(*from_double, D);
-  }
-  return std::optional<Rational>();
-}
-
-std::optional<Rational> ApproxGLPK::estimateWithCFE(double d) const
-{
-  return estimateWithCFE(d, Integer(s_defaultMaxDenom));
-}
-
 Kind glpk_type_to_kind(int glpk_cut_type)
 {
   switch (glpk_cut_type)
@@ -3142,13 +2951,443 @@ namespace cvc5::internal {
 namespace theory {
 namespace arith::linear {
 
+/**
+ * A native approximating solver for the real relaxation, used when GLPK is
+ * not available. It runs a bounded-variable primal simplex that minimizes the
+ * sum of infeasibilities over a dense floating-point tableau, starting from
+ * the basis in which the auxiliary variables are basic. The tableau rows are
+ * the definitions of the auxiliary variables over the other variables, as for
+ * the GLPK solver.
+ *
+ * Only the relaxation is supported: the MIP and cut methods are not, and the
+ * optimization coefficients are ignored.
+ */
+class ApproxNative : public ApproximateSimplex
+{
+ public:
+  ApproxNative(const ArithVariables& v);
+
+  LinResult solveRelaxation() override;
+  Solution extractRelaxation() const override;
+
+  ArithRatPairVec heuristicOptCoeffs() const override
+  {
+    return ArithRatPairVec();
+  }
+  void setOptCoeffs(const ArithRatPairVec& ref) override {}
+  void setPivotLimit(int pl) override
+  {
+    Assert(pl >= 0);
+    d_pivotLimit = pl;
+  }
+
+  MipResult solveMIP(bool al) override
+  {
+    Unimplemented() << "MIP requires the GLPK approximate solver";
+  }
+  Solution extractMIP() const override
+  {
+    Unimplemented() << "MIP requires the GLPK approximate solver";
+  }
+  std::vector<const CutInfo*> getValidCuts(const NodeLog& nodes) override
+  {
+    return std::vector<const CutInfo*>();
+  }
+  ArithVar getBranchVar(const NodeLog& con) const override
+  {
+    return ARITHVAR_SENTINEL;
+  }
+  void setBranchingDepth(int bd) override {}
+  void setBranchOnVariableLimit(int bl) override {}
+  void tryCut(int nid, CutInfo& cut) override {}
+
+ private:
+  /** The coefficient of nonbasic column c in row r of the tableau. */
+  double& coeff(size_t r, size_t c) { return d_tableau[r * d_numCols + c]; }
+  /** Is the value of slot s below its lower bound? */
+  bool belowLower(size_t s) const
+  {
+    return d_value[s] < d_lower[s] - s_feasTol * (1 + std::abs(d_lower[s]));
+  }
+  /** Is the value of slot s above its upper bound? */
+  bool aboveUpper(size_t s) const
+  {
+    return d_value[s] > d_upper[s] + s_feasTol * (1 + std::abs(d_upper[s]));
+  }
+  /**
+   * Choose the nonbasic column entering the basis to decrease the sum of
+   * infeasibilities, and the direction its value moves in. Uses the largest
+   * reduced cost, or Bland's rule if `bland` is true. Returns false if there
+   * is no such column.
+   */
+  bool selectEntering(bool bland, size_t& col, int& dir) const;
+  /**
+   * Pivot the basic variable of row r out of the basis and the nonbasic
+   * variable of column c into it.
+   */
+  void pivot(size_t r, size_t c);
+
+  /** Tolerance for bounds. */
+  static constexpr double s_feasTol = 1e-9;
+  /** Tolerance for pivot elements. */
+  static constexpr double s_pivotTol = 1e-9;
+  /** Entries below this magnitude are dropped from the tableau. */
+  static constexpr double s_dropTol = 1e-12;
+  /** The maximal number of entries of the dense tableau. */
+  static constexpr size_t s_maxTableauSize = 1 << 22;
+  /**
+   * The number of consecutive degenerate pivots after which Bland's rule is
+   * used, which avoids cycling.
+   */
+  static constexpr uint32_t s_blandThreshold = 50;
+
+  const ArithVariables& d_vars;
+  /** The maximum pivots allowed in a query. */
+  int d_pivotLimit;
+  /**
+   * Each variable is assigned a slot, which indexes the vectors below. The
+   * variables of the slots.
+   */
+  std::vector<ArithVar> d_slotToVar;
+  /** The bounds and the values of the slots, using infinity if unbounded. */
+  std::vector<double> d_lower;
+  std::vector<double> d_upper;
+  std::vector<double> d_value;
+  /** The number of rows and columns of the tableau. */
+  size_t d_numRows;
+  size_t d_numCols;
+  /** The slots of the basic variable of each row. */
+  std::vector<size_t> d_basic;
+  /** The slots of the nonbasic variable of each column. */
+  std::vector<size_t> d_nonbasic;
+  /**
+   * The dense row-major tableau, where basic variable d_basic[r] is the sum
+   * of coeff(r, c) * d_nonbasic[c] over all columns c.
+   */
+  std::vector<double> d_tableau;
+  /** Whether the tableau could be built. */
+  bool d_valid;
+  /** Whether the relaxation was solved. */
+  bool d_solvedRelaxation;
+};
+
+ApproxNative::ApproxNative(const ArithVariables& var)
+    : d_vars(var),
+      d_pivotLimit(std::numeric_limits<int>::max()),
+      d_numRows(0),
+      d_numCols(0),
+      d_valid(true),
+      d_solvedRelaxation(false)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  DenseMap<size_t> varToCol;
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    size_t slot = d_slotToVar.size();
+    d_slotToVar.push_back(v);
+    d_lower.push_back(d_vars.hasLowerBound(v)
+                          ? d_vars.getLowerBound(v).approx(SMALL_FIXED_DELTA)
+                          : -inf);
+    d_upper.push_back(d_vars.hasUpperBound(v)
+                          ? d_vars.getUpperBound(v).approx(SMALL_FIXED_DELTA)
+                          : inf);
+    d_value.push_back(d_vars.getAssignment(v).approx(SMALL_FIXED_DELTA));
+    if (d_vars.isAuxiliary(v))
+    {
+      d_basic.push_back(slot);
+    }
+    else
+    {
+      varToCol.set(v, d_nonbasic.size());
+      d_nonbasic.push_back(slot);
+      // nonbasic variables start within their bounds
+      d_value[slot] =
+          std::max(d_lower[slot], std::min(d_upper[slot], d_value[slot]));
+    }
+  }
+  d_numRows = d_basic.size();
+  d_numCols = d_nonbasic.size();
+  if (d_numRows * d_numCols > s_maxTableauSize)
+  {
+    Trace("approx") << "ApproxNative: tableau too large " << d_numRows << "x"
+                    << d_numCols << std::endl;
+    d_valid = false;
+    return;
+  }
+  d_tableau.resize(d_numRows * d_numCols, 0.0);
+  for (size_t r = 0; r < d_numRows; ++r)
+  {
+    size_t slot = d_basic[r];
+    Polynomial p =
+        Polynomial::parsePolynomial(d_vars.asNode(d_slotToVar[slot]));
+    double val = 0.0;
+    for (Polynomial::iterator j = p.begin(), end = p.end(); j != end; ++j)
+    {
+      const Monomial& mono = *j;
+      Node n = mono.getVarList().getNode();
+      Assert(d_vars.hasArithVar(n));
+      ArithVar av = d_vars.asArithVar(n);
+      if (!varToCol.isKey(av))
+      {
+        // not a definition over the non-auxiliary variables
+        d_valid = false;
+        return;
+      }
+      size_t c = varToCol[av];
+      double a = mono.getConstant().getValue().getDouble();
+      coeff(r, c) = a;
+      val += a * d_value[d_nonbasic[c]];
+    }
+    d_value[slot] = val;
+  }
+}
+
+bool ApproxNative::selectEntering(bool bland, size_t& col, int& dir) const
+{
+  double best = s_pivotTol;
+  ArithVar bestVar = ARITHVAR_SENTINEL;
+  bool found = false;
+  for (size_t c = 0; c < d_numCols; ++c)
+  {
+    // the decrease of the sum of infeasibilities when column c increases
+    double d = 0.0;
+    for (size_t r = 0; r < d_numRows; ++r)
+    {
+      size_t b = d_basic[r];
+      if (belowLower(b))
+      {
+        d += d_tableau[r * d_numCols + c];
+      }
+      else if (aboveUpper(b))
+      {
+        d -= d_tableau[r * d_numCols + c];
+      }
+    }
+    size_t s = d_nonbasic[c];
+    int cdir = 0;
+    if (d > s_pivotTol && d_value[s] < d_upper[s])
+    {
+      cdir = 1;
+    }
+    else if (d < -s_pivotTol && d_value[s] > d_lower[s])
+    {
+      cdir = -1;
+      d = -d;
+    }
+    if (cdir == 0)
+    {
+      continue;
+    }
+    if (bland ? (!found || d_slotToVar[s] < bestVar) : d > best)
+    {
+      found = true;
+      best = d;
+      bestVar = d_slotToVar[s];
+      col = c;
+      dir = cdir;
+    }
+  }
+  return found;
+}
+
+void ApproxNative::pivot(size_t r, size_t c)
+{
+  double a = coeff(r, c);
+  Assert(std::abs(a) > s_pivotTol);
+  // solve row r for the entering variable
+  std::vector<size_t> nonzeros;
+  for (size_t j = 0; j < d_numCols; ++j)
+  {
+    double& e = coeff(r, j);
+    if (j == c)
+    {
+      e = 1.0 / a;
+      nonzeros.push_back(j);
+    }
+    else if (e != 0.0)
+    {
+      e = -e / a;
+      nonzeros.push_back(j);
+    }
+  }
+  // substitute it into the other rows
+  for (size_t i = 0; i < d_numRows; ++i)
+  {
+    double f = coeff(i, c);
+    if (i == r || f == 0.0)
+    {
+      continue;
+    }
+    coeff(i, c) = 0.0;
+    for (size_t j : nonzeros)
+    {
+      double& e = coeff(i, j);
+      e += f * coeff(r, j);
+      if (std::abs(e) < s_dropTol)
+      {
+        e = 0.0;
+      }
+    }
+  }
+  std::swap(d_basic[r], d_nonbasic[c]);
+}
+
+LinResult ApproxNative::solveRelaxation()
+{
+  Assert(!d_solvedRelaxation);
+  if (!d_valid)
+  {
+    return LinUnknown;
+  }
+  const double inf = std::numeric_limits<double>::infinity();
+  uint32_t degenerate = 0;
+  for (int pivots = 0; pivots < d_pivotLimit; ++pivots)
+  {
+    size_t col = 0;
+    int dir = 0;
+    if (!selectEntering(degenerate >= s_blandThreshold, col, dir))
+    {
+      bool feasible = true;
+      for (size_t r = 0; r < d_numRows && feasible; ++r)
+      {
+        feasible = !belowLower(d_basic[r]) && !aboveUpper(d_basic[r]);
+      }
+      Trace("approx") << "ApproxNative: "
+                      << (feasible ? "feasible" : "infeasible") << " after "
+                      << pivots << " pivots" << std::endl;
+      d_solvedRelaxation = true;
+      return feasible ? LinFeasible : LinInfeasible;
+    }
+    // ratio test, which keeps feasible basic variables feasible and stops
+    // infeasible ones at the bound they violate
+    size_t s = d_nonbasic[col];
+    double step = dir > 0 ? d_upper[s] - d_value[s] : d_value[s] - d_lower[s];
+    size_t leave = d_numRows;
+    double leaveBound = dir > 0 ? d_upper[s] : d_lower[s];
+    for (size_t r = 0; r < d_numRows; ++r)
+    {
+      double a = coeff(r, col) * dir;
+      if (std::abs(a) <= s_pivotTol)
+      {
+        continue;
+      }
+      // the bound basic variable b reaches first, if any
+      size_t b = d_basic[r];
+      double bound;
+      if (a > 0)
+      {
+        bound = belowLower(b)   ? d_lower[b]
+                : aboveUpper(b) ? inf
+                                : d_upper[b];
+      }
+      else
+      {
+        bound = aboveUpper(b)   ? d_upper[b]
+                : belowLower(b) ? -inf
+                                : d_lower[b];
+      }
+      if (std::isinf(bound))
+      {
+        continue;
+      }
+      double t = std::max((bound - d_value[b]) / a, 0.0);
+      if (t < step)
+      {
+        step = t;
+        leave = r;
+        leaveBound = bound;
+      }
+    }
+    if (step == inf)
+    {
+      Trace("approx") << "ApproxNative: unbounded step" << std::endl;
+      return LinUnknown;
+    }
+    degenerate = step == 0.0 ? degenerate + 1 : 0;
+    // move the entering variable and update the basic variables
+    d_value[s] += dir * step;
+    for (size_t r = 0; r < d_numRows; ++r)
+    {
+      double a = coeff(r, col);
+      if (a != 0.0)
+      {
+        d_value[d_basic[r]] += a * dir * step;
+      }
+    }
+    // snap the variable that reached a bound to it
+    if (leave < d_numRows)
+    {
+      d_value[d_basic[leave]] = leaveBound;
+      pivot(leave, col);
+    }
+    else
+    {
+      d_value[s] = leaveBound;
+    }
+  }
+  Trace("approx") << "ApproxNative: exhausted" << std::endl;
+  return LinExhausted;
+}
+
+ApproximateSimplex::Solution ApproxNative::extractRelaxation() const
+{
+  Assert(d_solvedRelaxation);
+  Solution sol;
+  for (size_t r = 0; r < d_numRows; ++r)
+  {
+    sol.newBasis.add(d_slotToVar[d_basic[r]]);
+  }
+  for (size_t s = 0, size = d_slotToVar.size(); s < size; ++s)
+  {
+    ArithVar v = d_slotToVar[s];
+    double val = d_value[s];
+    if (d_vars.hasLowerBound(v) && roughlyEqual(val, d_lower[s]))
+    {
+      sol.newValues.set(v, d_vars.getLowerBound(v));
+      continue;
+    }
+    if (d_vars.hasUpperBound(v) && roughlyEqual(val, d_upper[s]))
+    {
+      sol.newValues.set(v, d_vars.getUpperBound(v));
+      continue;
+    }
+    double rounded = std::round(val);
+    if (roughlyEqual(val, rounded))
+    {
+      val = rounded;
+    }
+    DeltaRational proposal = d_vars.getAssignment(v);
+    if (!roughlyEqual(val, proposal.approx(SMALL_FIXED_DELTA)))
+    {
+      if (std::optional<Rational> est = estimateWithCFE(val))
+      {
+        proposal = *est;
+      }
+    }
+    if (d_vars.strictlyLessThanLowerBound(v, proposal))
+    {
+      proposal = d_vars.getLowerBound(v);
+    }
+    else if (d_vars.strictlyGreaterThanUpperBound(v, proposal))
+    {
+      proposal = d_vars.getUpperBound(v);
+    }
+    sol.newValues.set(v, proposal);
+  }
+  return sol;
+}
+
 ApproximateSimplex* ApproximateSimplex::mkApproximateSimplexSolver(
     const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s)
 {
 #ifdef CVC5_USE_GLPK
   return new ApproxGLPK(vars, l, s);
 #else
-  Unimplemented() << "Approximate simplex solver requires GLPK";
+  return new ApproxNative(vars);
 #endif
 }
 
@@ -3161,6 +3400,170 @@ bool ApproximateSimplex::enabled()
 #endif
 }
 
+bool ApproximateSimplex::relaxationEnabled() { return true; }
+
+bool ApproximateSimplex::roughlyEqual(double a, double b)
+{
+  if (a == 0)
+  {
+    return -SMALL_FIXED_DELTA <= b && b <= SMALL_FIXED_DELTA;
+  }
+  else if (b == 0)
+  {
+    return -SMALL_FIXED_DELTA <= a && a <= SMALL_FIXED_DELTA;
+  }
+  else
+  {
+    return std::abs(b / a) <= TOLERENCE && std::abs(a / b) <= TOLERENCE;
+  }
+}
+
+Rational ApproximateSimplex::cfeToRational(const std::vector<Integer>& exp)
+{
+  if (exp.empty())
+  {
+    return Rational(0);
+  }
+  else
+  {
+    Rational result = exp.back();
+    std::vector<Integer>::const_reverse_iterator exp_iter = exp.rbegin();
+    std::vector<Integer>::const_reverse_iterator exp_end = exp.rend();
+    ++exp_iter;
+    while (exp_iter != exp_end)
+    {
+      result = result.inverse();
+      const Integer& i = *exp_iter;
+      result += i;
+      ++exp_iter;
+    }
+    return result;
+  }
+}
+
+std::vector<Integer> ApproximateSimplex::rationalToCfe(const Rational& q, int depth)
+{
+  std::vector<Integer> mods;
+  if (!q.isZero())
+  {
+    Rational carry = q;
+    for (int i = 0; i <= depth; ++i)
+    {
+      Assert(!carry.isZero());
+      mods.push_back(Integer());
+      Integer& back = mods.back();
+      back = carry.floor();
+      Trace("rationalToCfe") << "  cfe[" << i << "]: " << back << std::endl;
+      carry -= back;
+      if (carry.isZero())
+      {
+        break;
+      }
+      else if (ApproximateSimplex::roughlyEqual(carry.getDouble(), 0.0))
+      {
+        break;
+      }
+      else
+      {
+        carry = carry.inverse();
+      }
+    }
+  }
+  return mods;
+}
+
+Rational ApproximateSimplex::estimateWithCFE(const Rational& r,
+                                             const Integer& K)
+{
+  Trace("estimateWithCFE") << "estimateWithCFE(" << r << ", " << K << ")"
+                           << std::endl;
+  // references
+  // page 4:
+  // http://carlossicoli.free.fr/C/Cassels_J.W.S.-An_introduction_to_diophantine_approximation-University_Press(1965).pdf
+  // http://en.wikipedia.org/wiki/Continued_fraction
+  Assert(K >= Integer(1));
+  if (r.getDenominator() <= K)
+  {
+    return r;
+  }
+
+  // current numerator and denominator that has not been resolved in the cfe
+  Integer num = r.getNumerator(), den = r.getDenominator();
+  Integer quot, rem;
+
+  unsigned t = 0;
+  // For a sequence of candidate solutions q_t/p_t
+  // we keep only 3 time steps: 0[prev], 1[current], 2[next]
+  // timesteps with a fake timestep 0 (p is 0 and q is 1)
+  // at timestep 1
+  Integer p[3];  // h
+  Integer q[3];  // k
+  // load the first 3 time steps manually
+  p[0] = 0;
+  q[0] = 1;  // timestep -2
+  p[1] = 1;
+  q[1] = 0;  // timestep -1
+
+  Integer::floorQR(quot, rem, num, den);
+  num = den;
+  den = rem;
+
+  q[2] = q[0] + quot * q[1];
+  p[2] = p[0] + quot * p[1];
+  Trace("estimateWithCFE") << "  cfe[" << t << "]: " << p[2] << "/" << q[2]
+                           << std::endl;
+  while (q[2] <= K)
+  {
+    p[0] = p[1];
+    p[1] = p[2];
+    q[0] = q[1];
+    q[1] = q[2];
+
+    Integer::floorQR(quot, rem, num, den);
+    num = den;
+    den = rem;
+
+    p[2] = p[0] + quot * p[1];
+    q[2] = q[0] + quot * q[1];
+    ++t;
+    Trace("estimateWithCFE")
+        << "  cfe[" << t << "]: " << p[2] << "/" << q[2] << std::endl;
+  }
+
+  Integer k = (K - q[0]).floorDivideQuotient(q[1]);
+  Rational cand_prev(p[0] + k * p[1], q[0] + k * q[1]);
+  Rational cand_curr(p[1], q[1]);
+  Rational dist_prev = (cand_prev - r).abs();
+  Rational dist_curr = (cand_curr - r).abs();
+  if (dist_prev <= dist_curr)
+  {
+    Trace("estimateWithCFE")
+        << cand_prev << " is closer than " << cand_curr << std::endl;
+    return cand_prev;
+  }
+  else
+  {
+    Trace("estimateWithCFE")
+        << cand_curr << " is closer than " << cand_prev << std::endl;
+    return cand_curr;
+  }
+}
+
+std::optional<Rational> ApproximateSimplex::estimateWithCFE(
+    double d, const Integer& D) const
+{
+  if (std::optional<Rational> from_double = Rational::fromDouble(d))
+  {
+    return estimateWithCFE(*from_double, D);
+  }
+  return std::optional<Rational>();
+}
+
+std::optional<Rational> ApproximateSimplex::estimateWithCFE(double d) const
+{
+  return estimateWithCFE(d, Integer(s_defaultMaxDenom));
+}
+
 ApproximateStatistics::ApproximateStatistics(StatisticsRegistry& sr)
     : d_branchMaxDepth(sr.registerInt("z::approx::branchMaxDepth")),
       d_branchesMaxOnAVar(sr.registerInt("z::approx::branchesMaxOnAVar")),
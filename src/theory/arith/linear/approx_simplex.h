@@ -74,7 +74,16 @@ class ApproximateSimplex{
   static bool enabled();
 
   /**
-   * If GLPK is enabled, creates a GPLK-based approximating solver.
+   * Is an approximating solver for the real relaxation available? This is
+   * always the case, since a native floating-point solver is used if GLPK is
+   * not enabled.
+   */
+  static bool relaxationEnabled();
+
+  /**
+   * If GLPK is enabled, creates a GPLK-based approximating solver. Otherwise,
+   * creates a native solver that only supports solveRelaxation() and
+   * extractRelaxation().
    */
   static ApproximateSimplex* mkApproximateSimplexSolver(
       const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s);
@@ -100,9 +109,8 @@ class ApproximateSimplex{
    * cuts off the estimate once the value is approximately zero.
    * This is designed for removing rounding artifacts.
    */
-  virtual std::optional<Rational> estimateWithCFE(double d) const = 0;
-  virtual std::optional<Rational> estimateWithCFE(double d,
-                                                  const Integer& D) const = 0;
+  std::optional<Rational> estimateWithCFE(double d) const;
+  std::optional<Rational> estimateWithCFE(double d, const Integer& D) const;
 
   virtual void tryCut(int nid, CutInfo& cut) = 0;
 
@@ -126,6 +134,32 @@ class ApproximateSimplex{
   virtual Solution extractMIP() const = 0;
 
   virtual Solution extractRelaxation() const = 0;
+
+ protected:
+  /** UTILITIES FOR DEALING WITH ESTIMATES */
+
+  static constexpr double SMALL_FIXED_DELTA = .000000001;
+  static constexpr double TOLERENCE = 1 + .000000001;
+
+  /** Returns true if two doubles are roughly equal based on TOLERENCE and
+   * SMALL_FIXED_DELTA.*/
+  static bool roughlyEqual(double a, double b);
+
+  /**
+   * Converts a rational to a continued fraction expansion representation
+   * using a maximum number of expansions equal to depth as long as the
+   * expression is not roughlyEqual() to 0.
+   */
+  static std::vector<Integer> rationalToCfe(const Rational& q, int depth);
+
+  /** Converts a continued fraction expansion representation to a rational. */
+  static Rational cfeToRational(const std::vector<Integer>& exp);
+
+  /** Estimates a rational as a continued fraction expansion.*/
+  static Rational estimateWithCFE(const Rational& q, const Integer& K);
+
+  /* Default denominator for diophatine approximation, 2^{26} .*/
+  static constexpr uint64_t s_defaultMaxDenom = (1 << 26);
 };/* class ApproximateSimplex */
 
 }  // namespace arith
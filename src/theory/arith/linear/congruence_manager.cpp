@@ -112,7 +112,9 @@ ArithCongruenceManager::Statistics::Statistics(StatisticsRegistry& sr)
       d_propagations(sr.registerInt("theory::arith::congruence::propagations")),
       d_propagateConstraints(
           sr.registerInt("theory::arith::congruence::propagateConstraints")),
-      d_conflicts(sr.registerInt("theory::arith::congruence::conflicts"))
+      d_conflicts(sr.registerInt("theory::arith::congruence::conflicts")),
+      d_entailedAssertions(
+          sr.registerInt("theory::arith::congruence::entailedAssertions"))
 {
 }
 
@@ -623,6 +625,15 @@ void ArithCongruenceManager::assertLitToEqualityEngine(
       d_pfee->assertFact(lit, reason, d_pfGenEe.get());
     }
   }
+  else if (d_ee->hasTerm(eq[0]) && d_ee->hasTerm(eq[1])
+           && (isEquality ? d_ee->areEqual(eq[0], eq[1])
+                          : d_ee->areDisequal(eq[0], eq[1], false)))
+  {
+    // The (possibly central) equality engine already entails the literal,
+    // e.g. by a merge of another theory, and can explain it on its own.
+    Trace("arith-ee") << "...already entailed" << std::endl;
+    ++(d_statistics.d_entailedAssertions);
+  }
   else
   {
     // The equality engine doesn't ref-count for us...
@@ -245,6 +245,8 @@ class ArithCongruenceManager : protected EnvObj
     IntStat d_propagations;
     IntStat d_propagateConstraints;
     IntStat d_conflicts;
+    /** Literals not asserted since the equality engine entailed them. */
+    IntStat d_entailedAssertions;
 
     Statistics(StatisticsRegistry& sr);
   } d_statistics;
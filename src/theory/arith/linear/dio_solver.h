@@ -382,6 +382,9 @@ private:
   SumPair purifyIndex(TrailIndex i);
 
 public:
+  /** Returns the number of input constraints in the current context. */
+  size_t getNumInputConstraints() const { return d_inputConstraints.size(); }
+
   bool hasMoreDecompositionLemmas() const{
     return !d_decompositionLemmaQueue.empty();
   }
@@ -36,7 +36,8 @@ DualSimplexDecisionProcedure::DualSimplexDecisionProcedure(
     TempVarMalloc tvmalloc)
     : SimplexDecisionProcedure(env, linEq, errors, conflictChannel, tvmalloc),
       d_pivotsInRound(),
-      d_statistics(statisticsRegistry(), d_pivots)
+      d_statistics(statisticsRegistry(), d_pivots),
+      d_pivotStats(statisticsRegistry(), "theory::arith::dual::")
 { }
 
 DualSimplexDecisionProcedure::Statistics::Statistics(StatisticsRegistry& sr,
@@ -133,6 +134,7 @@ Result::Status DualSimplexDecisionProcedure::dualFindModel(bool exactResult)
   d_pivotsInRound.purge();
   // ensure that the conflict variable is still in the queue.
   d_conflictVariables.purge();
+  recordCheck(d_pivotStats);
 
   Trace("arith::findModel") << "end findModel() " << result << endl;
 
@@ -214,6 +216,7 @@ bool DualSimplexDecisionProcedure::searchForFeasibleSolution(uint32_t remainingI
     bool conflict = processSignals();
     int32_t currErrorSize CVC5_UNUSED = d_errorSet.errorSize();
     d_pivots++;
+    recordPivot(d_pivotStats, false, useVarOrderPivot);
 
     if(TraceIsOn("arith::dual")){
       Trace("arith::dual")
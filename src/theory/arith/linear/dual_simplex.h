@@ -113,6 +113,8 @@ private:
 
     Statistics(StatisticsRegistry& sr, uint32_t& pivots);
   } d_statistics;
+
+  PivotStatistics d_pivotStats;
 };/* class DualSimplexDecisionProcedure */
 
 }  // namespace arith
@@ -42,7 +42,8 @@ FCSimplexDecisionProcedure::FCSimplexDecisionProcedure(
       d_prevWitnessImprovement(AntiProductive),
       d_witnessImprovementInARow(0),
       d_sgnDisagreements(),
-      d_statistics(statisticsRegistry(), "theory::arith::FC::", d_pivots)
+      d_statistics(statisticsRegistry(), "theory::arith::FC::", d_pivots),
+      d_pivotStats(statisticsRegistry(), "theory::arith::FC::")
 { }
 
 FCSimplexDecisionProcedure::Statistics::Statistics(StatisticsRegistry& sr,
@@ -58,6 +59,8 @@ FCSimplexDecisionProcedure::Statistics::Statistics(StatisticsRegistry& sr,
       d_selectUpdateForDualLike(
           sr.registerTimer(name + "selectUpdateForDualLike")),
       d_selectUpdateForPrimal(sr.registerTimer(name + "selectUpdateForPrimal")),
+      d_selectPrimalUpdate(sr.registerTimer(name + "selectPrimalUpdate")),
+      d_componentFocus(sr.registerInt(name + "componentFocus")),
       d_finalCheckPivotCounter(
           sr.registerReference<uint32_t>(name + "lastPivots", pivots))
 {
@@ -129,6 +132,7 @@ Result::Status FCSimplexDecisionProcedure::findModel(bool exactResult)
 
   // ensure that the conflict variable is still in the queue.
   d_conflictVariables.purge();
+  recordCheck(d_pivotStats);
 
   Trace("arith::findModel") << "end findModel() " << result << endl;
 
@@ -159,6 +163,8 @@ void FCSimplexDecisionProcedure::logPivot(WitnessImprovement w){
   if(strongImprovement(w)){
     d_leavingCountSinceImprovement.purge();
   }
+  d_pivotStats.d_pivotDecisions << w;
+  recordPivot(d_pivotStats, degenerate(w), w == BlandsDegenerate);
 
   Trace("logPivot") << "logPivot " << d_prevWitnessImprovement << " "  << d_witnessImprovementInARow << endl;
 
@@ -226,6 +232,42 @@ WitnessImprovement FCSimplexDecisionProcedure::adjustFocusShrank(const ArithVarV
   return FocusShrank;
 }
 
+void FCSimplexDecisionProcedure::focusOnComponent()
+{
+  Assert(d_focusSize == d_errorSet.focusSize());
+  Assert(d_focusErrorVar == ARITHVAR_SENTINEL);
+  if (!options().arith.arithComponentFocus || d_focusSize <= 1)
+  {
+    return;
+  }
+  DenseMap<ArithVar> comp;
+  d_tableau.computeComponents(comp);
+  ArithVar top = d_errorSet.topFocusVariable();
+  Assert(comp.isKey(top));
+  ArithVar topComp = comp[top];
+
+  ArithVarVec dropped;
+  for (ErrorSet::focus_iterator i = d_errorSet.focusBegin(),
+                                i_end = d_errorSet.focusEnd();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    if (!comp.isKey(v) || comp[v] != topComp)
+    {
+      dropped.push_back(v);
+    }
+  }
+  if (!dropped.empty())
+  {
+    Trace("arith::focus") << "focusOnComponent " << top << " drops "
+                          << dropped.size() << " of " << d_focusSize << endl;
+    d_errorSet.dropFromFocusAll(dropped);
+    d_focusSize = d_errorSet.focusSize();
+    ++(d_statistics.d_componentFocus);
+  }
+}
+
 WitnessImprovement FCSimplexDecisionProcedure::focusDownToJust(ArithVar v){
   // uint32_t newErrorSize = d_errorSet.errorSize();
   // uint32_t newFocusSize = d_errorSet.focusSize();
@@ -246,6 +288,7 @@ WitnessImprovement FCSimplexDecisionProcedure::focusDownToJust(ArithVar v){
 
 
 UpdateInfo FCSimplexDecisionProcedure::selectPrimalUpdate(ArithVar basic, LinearEqualityModule::UpdatePreferenceFunction upf, LinearEqualityModule::VarPreferenceFunction bpf) {
+  TimerStat::CodeTimer codeTimer(d_statistics.d_selectPrimalUpdate);
   UpdateInfo selected;
 
   Trace("arith::selectPrimalUpdate")
@@ -671,6 +714,7 @@ Result::Status FCSimplexDecisionProcedure::dualLike()
   Assert(d_focusErrorVar == ARITHVAR_SENTINEL);
 
   d_scores.purge();
+  focusOnComponent();
   d_focusErrorVar = constructInfeasiblityFunction(d_statistics.d_fcFocusConstructionTimer);
 
 
@@ -694,6 +738,7 @@ Result::Status FCSimplexDecisionProcedure::dualLike()
       Assert(d_errorSize == d_focusSize);
       Assert(d_errorSize >= 1);
 
+      focusOnComponent();
       d_focusErrorVar = constructInfeasiblityFunction(d_statistics.d_fcFocusConstructionTimer);
 
       Trace("dualLike") << "blur " << d_focusSize << endl;
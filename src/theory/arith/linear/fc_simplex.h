@@ -210,6 +210,15 @@ private:
   WitnessImprovement adjustFocusShrank(const ArithVarVec& drop);
   WitnessImprovement focusDownToJust(ArithVar v);
 
+  /**
+   * If --simplex-component-focus is enabled, drops from the focus the error
+   * variables that are not in the tableau component of the top focus
+   * variable. The components do not share variables, so each one can be
+   * repaired on its own, and the infeasibility function only ranges over
+   * the rows of one component. The others are added back by the next blur.
+   */
+  void focusOnComponent();
+
 
   void adjustFocusAndError(const UpdateInfo& up, const AVIntPairVec& focusChanges);
 
@@ -247,6 +256,9 @@ private:
 
     TimerStat d_selectUpdateForDualLike;
     TimerStat d_selectUpdateForPrimal;
+    TimerStat d_selectPrimalUpdate;
+
+    IntStat d_componentFocus;
 
     ReferenceStat<uint32_t> d_finalCheckPivotCounter;
 
@@ -254,6 +266,8 @@ private:
                const std::string& name,
                uint32_t& pivots);
   } d_statistics;
+
+  PivotStatistics d_pivotStats;
 };/* class FCSimplexDecisionProcedure */
 
 }  // namespace arith
@@ -74,6 +74,9 @@ LinearEqualityModule::Statistics::Statistics(StatisticsRegistry& sr)
       d_statUpdates(sr.registerInt("theory::arith::updates")),
       d_pivotTime(sr.registerTimer("theory::arith::pivotTime")),
       d_adjTime(sr.registerTimer("theory::arith::adjTime")),
+      d_machineRowUpdates(
+          sr.registerInt("theory::arith::rowUpdates::machine")),
+      d_exactRowUpdates(sr.registerInt("theory::arith::rowUpdates::exact")),
       d_weakeningAttempts(sr.registerInt("theory::arith::weakening::attempts")),
       d_weakeningSuccesses(sr.registerInt("theory::arith::weakening::success")),
       d_weakenings(sr.registerInt("theory::arith::weakening::total")),
@@ -283,6 +286,8 @@ void LinearEqualityModule::pivotAndUpdate(ArithVar x_i, ArithVar x_j, const Delt
   ++(d_statistics.d_statPivots);
 
   d_tableau.pivot(x_i, x_j, d_trackCallback);
+  d_statistics.d_machineRowUpdates = d_tableau.getNumMachineUpdates();
+  d_statistics.d_exactRowUpdates = d_tableau.getNumExactUpdates();
 
   if(TraceIsOn("arith::tracking::post")){
     Trace("arith::tracking") << "postpivot" << endl;
@@ -716,6 +716,11 @@ private:
     IntStat d_statPivots, d_statUpdates;
     TimerStat d_pivotTime;
     TimerStat d_adjTime;
+    /**
+     * Coefficient updates of the tableau during pivots, done with machine
+     * arithmetic or falling back to exact arithmetic.
+     */
+    IntStat d_machineRowUpdates, d_exactRowUpdates;
 
     IntStat d_weakeningAttempts, d_weakeningSuccesses, d_weakenings;
     TimerStat d_weakenTime;
@@ -207,6 +207,20 @@ public:
   uint32_t size() const{ return d_size; }
   uint32_t capacity() const{ return d_entries.capacity(); }
 
+  /**
+   * Hint that entry id (possibly ENTRYID_SENTINEL) is accessed soon. The
+   * entries of a row are linked but scattered in d_entries, hence the row
+   * operations fetch the next entry while working on the current one.
+   */
+  void prefetch(EntryID id) const
+  {
+    if (id != ENTRYID_SENTINEL)
+    {
+      Assert(inBounds(id));
+      __builtin_prefetch(&d_entries[id]);
+    }
+  }
+
 
 private:
   bool inBounds(EntryID id) const{
@@ -399,6 +413,11 @@ protected:
 
   T d_zero;
 
+  /* The number of coefficient updates of row additions done with machine
+   * arithmetic, and the number of those done with exact arithmetic. */
+  uint64_t d_machineUpdates;
+  uint64_t d_exactUpdates;
+
 public:
   /**
    * Constructs an empty Matrix.
@@ -410,7 +429,9 @@ public:
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
-    d_zero(0)
+    d_zero(0),
+    d_machineUpdates(0),
+    d_exactUpdates(0)
   {}
 
   Matrix(const T& zero)
@@ -420,7 +441,9 @@ public:
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
-    d_zero(zero)
+    d_zero(zero),
+    d_machineUpdates(0),
+    d_exactUpdates(0)
   {}
 
   Matrix(const Matrix& m)
@@ -430,7 +453,9 @@ public:
     d_rowInMergeBuffer(m.d_rowInMergeBuffer),
     d_entriesInUse(m.d_entriesInUse),
     d_entries(m.d_entries),
-    d_zero(m.d_zero)
+    d_zero(m.d_zero),
+    d_machineUpdates(m.d_machineUpdates),
+    d_exactUpdates(m.d_exactUpdates)
   {
     d_columns.clear();
     for(typename ColumnTable::const_iterator c=m.d_columns.begin(), cend = m.d_columns.end(); c!=cend; ++c){
@@ -450,6 +475,8 @@ public:
     d_entriesInUse = (m.d_entriesInUse);
     d_entries = (m.d_entries);
     d_zero = (m.d_zero);
+    d_machineUpdates = m.d_machineUpdates;
+    d_exactUpdates = m.d_exactUpdates;
     d_columns.clear();
     for(typename ColumnTable::const_iterator c=m.d_columns.begin(), cend = m.d_columns.end(); c!=cend; ++c){
       const ColumnVector<T>& col = *c;
@@ -464,6 +491,18 @@ public:
   }
 
 protected:
+  /** Count a coefficient update, done with machine arithmetic if `machine`. */
+  void countUpdate(bool machine)
+  {
+    if (machine)
+    {
+      ++d_machineUpdates;
+    }
+    else
+    {
+      ++d_exactUpdates;
+    }
+  }
 
   void addEntry(RowIndex row, ArithVar col, const T& coeff){
     Trace("tableau") << "addEntry(" << row << "," << col <<"," << coeff << ")" << std::endl;
@@ -609,6 +648,17 @@ public:
     d_mergeBuffer.purge();
   }
 
+  /**
+   * Get the number of coefficient updates of row additions that were done
+   * with machine arithmetic.
+   */
+  uint64_t getNumMachineUpdates() const { return d_machineUpdates; }
+  /**
+   * Get the number of coefficient updates of row additions that fell back to
+   * exact arithmetic.
+   */
+  uint64_t getNumExactUpdates() const { return d_exactUpdates; }
+
   /* to *= mult */
   void multiplyRowByConstant(RowIndex to, const T& mult){
     RowIterator i = getRow(to).begin();
@@ -657,6 +707,7 @@ public:
       ArithVar colVar = entry.getColVar();
 
       ++i;
+      d_entries.prefetch(i.getID());
 
       if(d_mergeBuffer.isKey(colVar)){
         EntryID bufferEntry = d_mergeBuffer[colVar].first;
@@ -665,7 +716,7 @@ public:
 
         const Entry& other = d_entries.get(bufferEntry);
         T& coeff = entry.getCoefficient();
-        coeff += mult * other.getCoefficient();
+        countUpdate(coeff.addProduct(mult, other.getCoefficient()));
 
         if(coeff.sgn() == 0){
           removeEntry(id);
@@ -679,6 +730,7 @@ public:
     for(; i != i_end; ++i){
       const Entry& entry = *i;
       ArithVar colVar = entry.getColVar();
+      d_entries.prefetch(entry.getNextRowEntryID());
 
       if(d_mergeBuffer[colVar].second){
         d_mergeBuffer.get(colVar).second = false;
@@ -716,6 +768,7 @@ public:
       ArithVar colVar = entry.getColVar();
 
       ++i;
+      d_entries.prefetch(i.getID());
 
       if(d_mergeBuffer.isKey(colVar)){
         EntryID bufferEntry = d_mergeBuffer[colVar].first;
@@ -725,7 +778,7 @@ public:
         const Entry& other = d_entries.get(bufferEntry);
         T& coeff = entry.getCoefficient();
         int coeffOldSgn = coeff.sgn();
-        coeff += mult * other.getCoefficient();
+        countUpdate(coeff.addProduct(mult, other.getCoefficient()));
         int coeffNewSgn = coeff.sgn();
 
         if(coeffOldSgn != coeffNewSgn){
@@ -744,6 +797,7 @@ public:
     for(; i != i_end; ++i){
       const Entry& entry = *i;
       ArithVar colVar = entry.getColVar();
+      d_entries.prefetch(entry.getNextRowEntryID());
 
       if(d_mergeBuffer[colVar].second){
         d_mergeBuffer.get(colVar).second = false;
@@ -63,6 +63,46 @@ SimplexDecisionProcedure::~SimplexDecisionProcedure(){
   delete d_conflictBuilder;
 }
 
+SimplexDecisionProcedure::PivotStatistics::PivotStatistics(
+    StatisticsRegistry& sr, const std::string& name)
+    : d_name(name),
+      d_pivotsPerCheck(sr.registerAverage(name + "pivotsPerCheck")),
+      d_maxPivotsPerCheck(sr.registerInt(name + "maxPivotsPerCheck")),
+      d_degeneratePivots(sr.registerInt(name + "degeneratePivots")),
+      d_varOrderPivots(sr.registerInt(name + "varOrderPivots")),
+      d_errorSetSize(sr.registerAverage(name + "errorSetSize")),
+      d_maxErrorSetSize(sr.registerInt(name + "maxErrorSetSize")),
+      d_pivotDecisions(
+          sr.registerHistogram<WitnessImprovement>(name + "pivotDecisions"))
+{
+}
+
+void SimplexDecisionProcedure::recordPivot(PivotStatistics& stats,
+                                           bool degenerate,
+                                           bool varOrder)
+{
+  uint32_t errors = d_errorSet.errorSize();
+  stats.d_errorSetSize << errors;
+  stats.d_maxErrorSetSize.maxAssign(errors);
+  if (degenerate)
+  {
+    ++stats.d_degeneratePivots;
+  }
+  if (varOrder)
+  {
+    ++stats.d_varOrderPivots;
+  }
+  Trace("arith::pivots") << stats.d_name << " #" << d_pivots << " errors "
+                         << errors << (degenerate ? " degenerate" : "")
+                         << (varOrder ? " varOrder" : "") << std::endl;
+}
+
+void SimplexDecisionProcedure::recordCheck(PivotStatistics& stats)
+{
+  stats.d_pivotsPerCheck << d_pivots;
+  stats.d_maxPivotsPerCheck.maxAssign(d_pivots);
+}
+
 
 bool SimplexDecisionProcedure::standardProcessSignals(TimerStat &timer, IntStat& conflicts) {
   TimerStat::CodeTimer codeTimer(timer);
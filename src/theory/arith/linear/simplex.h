@@ -55,12 +55,14 @@
 
 #pragma once
 
+#include <string>
 #include <unordered_map>
 
 #include "options/arith_options.h"
 #include "smt/env_obj.h"
 #include "theory/arith/linear/arithvar.h"
 #include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/simplex_update.h"
 #include "util/dense_map.h"
 #include "util/result.h"
 #include "util/statistics_stats.h"
@@ -146,6 +148,39 @@ class SimplexDecisionProcedure : protected EnvObj
   void removeFromInfeasFunc(TimerStat& timer, ArithVar inf, ArithVar e);
   void shrinkInfeasFunc(TimerStat& timer, ArithVar inf, const ArithVarVec& dropped);
 
+  /**
+   * Statistics on the pivots of a simplex procedure, registered with the
+   * prefix of the procedure. See recordPivot() and recordCheck().
+   */
+  class PivotStatistics
+  {
+   public:
+    PivotStatistics(StatisticsRegistry& sr, const std::string& name);
+
+    /** The prefix, also used in the trace. */
+    std::string d_name;
+    /** The pivots and updates per call to findModel() that searched. */
+    AverageStat d_pivotsPerCheck;
+    IntStat d_maxPivotsPerCheck;
+    /** The pivots and updates that were degenerate. */
+    IntStat d_degeneratePivots;
+    /** The pivots selected by variable order (Bland's rule). */
+    IntStat d_varOrderPivots;
+    /** The size of the error set after each pivot or update. */
+    AverageStat d_errorSetSize;
+    IntStat d_maxErrorSetSize;
+    /** The improvements selected by the pivot rule. */
+    HistogramStat<WitnessImprovement> d_pivotDecisions;
+  };
+
+  /**
+   * Records a pivot or update of the procedure after its signals have been
+   * processed. It is also traced on arith::pivots.
+   */
+  void recordPivot(PivotStatistics& stats, bool degenerate, bool varOrder);
+  /** Records the number of pivots after a call to findModel(). */
+  void recordCheck(PivotStatistics& stats);
+
 public:
  SimplexDecisionProcedure(Env& env,
                           LinearEqualityModule& linEq,
@@ -42,7 +42,8 @@ SumOfInfeasibilitiesSPD::SumOfInfeasibilitiesSPD(Env& env,
       d_prevWitnessImprovement(AntiProductive),
       d_witnessImprovementInARow(0),
       d_sgnDisagreements(),
-      d_statistics(statisticsRegistry(), "theory::arith::SOI", d_pivots)
+      d_statistics(statisticsRegistry(), "theory::arith::SOI", d_pivots),
+      d_pivotStats(statisticsRegistry(), "theory::arith::SOI::")
 { }
 
 SumOfInfeasibilitiesSPD::Statistics::Statistics(StatisticsRegistry& sr,
@@ -133,6 +134,7 @@ Result::Status SumOfInfeasibilitiesSPD::findModel(bool exactResult)
 
   // ensure that the conflict variable is still in the queue.
   d_conflictVariables.purge();
+  recordCheck(d_pivotStats);
 
   Trace("soi::findModel") << "end findModel() " << result << endl;
 
@@ -161,6 +163,8 @@ void SumOfInfeasibilitiesSPD::logPivot(WitnessImprovement w){
   if(strongImprovement(w)){
     d_leavingCountSinceImprovement.purge();
   }
+  d_pivotStats.d_pivotDecisions << w;
+  recordPivot(d_pivotStats, degenerate(w), w == BlandsDegenerate);
 
   Trace("logPivot") << "logPivot " << d_prevWitnessImprovement << " "  << d_witnessImprovementInARow << endl;
 }
@@ -192,6 +196,7 @@ void SumOfInfeasibilitiesSPD::adjustFocusAndError(const UpdateInfo& up, const AV
 
 
 UpdateInfo SumOfInfeasibilitiesSPD::selectUpdate(LinearEqualityModule::UpdatePreferenceFunction upf, LinearEqualityModule::VarPreferenceFunction bpf) {
+  TimerStat::CodeTimer codeTimer(d_statistics.d_selectUpdateForSOI);
   UpdateInfo selected;
 
   Trace("soi::selectPrimalUpdate")
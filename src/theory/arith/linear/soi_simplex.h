@@ -222,6 +222,8 @@ private:
                const std::string& name,
                uint32_t& pivots);
   } d_statistics;
+
+  PivotStatistics d_pivotStats;
 };/* class FCSimplexDecisionProcedure */
 
 }  // namespace arith
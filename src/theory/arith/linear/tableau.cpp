@@ -191,6 +191,51 @@ void Tableau::printBasicRow(ArithVar basic, std::ostream& out){
   printRow(basicToRowIndex(basic), out);
 }
 
+void Tableau::computeComponents(DenseMap<ArithVar>& comp) const
+{
+  // union-find over the variables, with path halving
+  DenseMap<ArithVar> parent;
+  auto find = [&parent](ArithVar v) {
+    while (parent[v] != v)
+    {
+      ArithVar p = parent[parent[v]];
+      parent.set(v, p);
+      v = p;
+    }
+    return v;
+  };
+  for (BasicIterator i = beginBasic(), i_end = endBasic(); i != i_end; ++i)
+  {
+    ArithVar basic = *i;
+    if (!parent.isKey(basic))
+    {
+      parent.set(basic, basic);
+    }
+    ArithVar root = find(basic);
+    for (RowIterator ri = basicRowIterator(basic); !ri.atEnd(); ++ri)
+    {
+      ArithVar v = (*ri).getColVar();
+      if (!parent.isKey(v))
+      {
+        parent.set(v, root);
+      }
+      else
+      {
+        ArithVar r = find(v);
+        if (r != root)
+        {
+          parent.set(r, root);
+        }
+      }
+    }
+  }
+  comp.purge();
+  for (ArithVar v : parent.getKeys())
+  {
+    comp.set(v, find(v));
+  }
+}
+
 }  // namespace arith
 }  // namespace theory
 }  // namespace cvc5::internal
@@ -82,6 +82,9 @@ public:
     return d_basic2RowIndex[x];
   }
 
+  /** Returns true if rid is the index of a row currently in the tableau. */
+  bool isRowIndex(RowIndex rid) const { return d_rowIndex2basic.isKey(rid); }
+
   ArithVar rowIndexToBasic(RowIndex rid) const {
     Assert(d_rowIndex2basic.isKey(rid));
     return d_rowIndex2basic[rid];
@@ -152,6 +155,13 @@ public:
 
   void printBasicRow(ArithVar basic, std::ostream& out);
 
+  /**
+   * Computes the connected components of the tableau, where two variables are
+   * connected if they occur in the same row. Afterwards, comp maps each
+   * variable occurring in some row to a representative of its component.
+   */
+  void computeComponents(DenseMap<ArithVar>& comp) const;
+
 private:
   /* Changes the basic variable on the row for basicOld to basicNew. */
   void rowPivot(ArithVar basicOld, ArithVar basicNew, CoefficientChangeCallback& cb);
@@ -18,9 +18,13 @@
 
 #include "theory/arith/linear/theory_arith_private.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <optional>
 #include <queue>
+#include <tuple>
 #include <vector>
 
 #include "base/output.h"
@@ -43,6 +47,7 @@
 #include "proof/proof_generator.h"
 #include "proof/proof_node_manager.h"
 #include "smt/logic_exception.h"
+#include "theory/arith/arith_msum.h"
 #include "theory/arith/arith_proof_rcons.h"
 #include "theory/arith/arith_proof_utilities.h"
 #include "theory/arith/arith_rewriter.h"
@@ -69,6 +74,7 @@
 #include "theory/trust_substitutions.h"
 #include "theory/valuation.h"
 #include "util/dense_map.h"
+#include "util/hash.h"
 #include "util/integer.h"
 #include "util/random.h"
 #include "util/rational.h"
@@ -159,6 +165,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
       d_approxCuts(context()),
       d_fullCheckCounter(0),
       d_cutCount(context(), 0),
+      d_gomoryRounds(context(), 0),
       d_cutInContext(context()),
       d_likelyIntegerInfeasible(context(), false),
       d_guessedCoeffSet(context(), false),
@@ -170,6 +177,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
       d_approxStats(NULL),
       d_attemptSolveIntTurnedOff(userContext(), 0),
       d_dioSolveResources(0),
+      d_dioCutFailed(context(), 0),
       d_solveIntMaybeHelp(0u),
       d_solveIntAttempts(0u),
       d_newFacts(false),
@@ -267,6 +275,11 @@ TheoryArithPrivate::Statistics::Statistics(StatisticsRegistry& reg,
       d_boundComputationTime(reg.registerTimer(name + "bound::time")),
       d_boundComputations(reg.registerInt(name + "bound::boundComputations")),
       d_boundPropagations(reg.registerInt(name + "bound::boundPropagations")),
+      d_boundRowsProcessed(reg.registerInt(name + "bound::rowsProcessed")),
+      d_boundRowsDeferred(reg.registerInt(name + "bound::rowsDeferred")),
+      d_gomoryCuts(reg.registerInt(name + "gomory::cuts")),
+      d_gomoryCutsFiltered(reg.registerInt(name + "gomory::filtered")),
+      d_dioCutsSkipped(reg.registerInt(name + "dio::cutsSkipped")),
       d_unknownChecks(reg.registerInt(name + "status::unknowns")),
       d_maxUnknownsInARow(reg.registerInt(name + "status::maxUnknownsInARow")),
       d_avgUnknownsInARow(
@@ -955,16 +968,18 @@ bool TheoryArithPrivate::ppAssert(TrustNode tin,
 
 
   // Solve equalities
-  Rational minConstant = 0;
-  Node minMonomial;
-  Node minVar;
   if (in.getKind() == Kind::EQUAL
       && Theory::theoryOf(in[0].getType()) == THEORY_ARITH)
   {
     Comparison cmp = Comparison::parseNormalForm(in);
 
     Polynomial left = cmp.getLeft();
+    Polynomial right = cmp.getRight();
 
+    // The variables to solve for, the leading one first. The others are only
+    // tried if the option is set, which eliminates more equalities and thus
+    // shrinks the tableau.
+    std::vector<Node> candidates;
     Monomial m = left.getHead();
     if (m.getVarList().singleton()){
       VarList vl = m.getVarList();
@@ -973,19 +988,51 @@ bool TheoryArithPrivate::ppAssert(TrustNode tin,
       {
         // if vl.isIntegral then m.getConstant().isOne()
         if(!vl.isIntegral() || m.getConstant().isOne()){
-          minVar = var;
+          candidates.push_back(var);
+        }
+      }
+    }
+    if (options().arith.ppAssertSolveAny)
+    {
+      for (Polynomial::iterator it = right.begin(), end = right.end();
+           it != end;
+           ++it)
+      {
+        Monomial mr = *it;
+        if (mr.getVarList().singleton() && mr.getVarList().getNode().isVar())
+        {
+          candidates.push_back(mr.getVarList().getNode());
         }
       }
     }
 
     // Solve for variable
-    if (!minVar.isNull()) {
-      Polynomial right = cmp.getRight();
-      Node elim = right.getNode();
-      // ax + p = c -> (ax + p) -ax - c = -ax
-      // x = (p - ax - c) * -1/a
-      // Add the substitution if not recursive
-      Assert(elim == rewrite(elim));
+    for (size_t i = 0, size = candidates.size(); i < size; ++i)
+    {
+      Node minVar = candidates[i];
+      Node elim;
+      if (i == 0 && minVar == m.getVarList().getNode())
+      {
+        elim = right.getNode();
+        // ax + p = c -> (ax + p) -ax - c = -ax
+        // x = (p - ax - c) * -1/a
+        // Add the substitution if not recursive
+        Assert(elim == rewrite(elim));
+      }
+      else
+      {
+        // null if the variable is an integer with a non-unit coefficient
+        elim = ArithMSum::solveEqualityFor(in, minVar);
+        if (elim.isNull())
+        {
+          continue;
+        }
+        elim = rewrite(elim);
+      }
+      if (minVar.getType().isInteger() && !elim.getType().isInteger())
+      {
+        continue;
+      }
       if (elim.getType().isInteger() && !minVar.getType().isInteger())
       {
         elim = nodeManager()->mkNode(Kind::TO_REAL, elim);
@@ -997,6 +1044,8 @@ bool TheoryArithPrivate::ppAssert(TrustNode tin,
                "right hand side containing too many terms: "
             << minVar << ":" << elim << endl;
         Trace("simplify") << right.size() << endl;
+        // the same holds for all candidates
+        break;
       }
       else if (d_valuation.isLegalElimination(minVar, elim))
       {
@@ -1362,9 +1411,10 @@ Comparison TheoryArithPrivate::mkIntegerEqualityFromAssignment(ArithVar v){
 
 TrustNode TheoryArithPrivate::dioCutting()
 {
-  context::Context::ScopedPush speculativePush(context());
-  //DO NOT TOUCH THE OUTPUTSTREAM
-
+  // The speculated equalities, identified together with the input equalities
+  // of the dio solver by a hash.
+  std::vector<ArithVar> speculative;
+  uint64_t hash = fnv1a::fnv1a_64(d_diosolver.getNumInputConstraints());
   for(var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi){
     ArithVar v = *vi;
     if(isInteger(v)){
@@ -1372,20 +1422,43 @@ TrustNode TheoryArithPrivate::dioCutting()
          d_partialModel.cmpAssignmentLowerBound(v) == 0){
         if(!d_partialModel.boundsAreEqual(v)){
           // If the bounds are equal this is already in the dioSolver
-          //Add v = dr as a speculation.
-          Comparison eq = mkIntegerEqualityFromAssignment(v);
-          Trace("dio::push") << "dio::push " << v << " " <<  eq.getNode() << endl;
-          Assert(!eq.isBoolean());
-          d_diosolver.pushInputConstraint(eq, eq.getNode());
-          // It does not matter what the explanation of eq is.
-          // It cannot be used in a conflict
+          speculative.push_back(v);
+          const DeltaRational& dr = d_partialModel.getAssignment(v);
+          hash = fnv1a::fnv1a_64(v, hash);
+          hash = fnv1a::fnv1a_64(dr.getNoninfinitesimalPart().hash(), hash);
         }
       }
     }
   }
+  // The substitutions of the input equalities are kept in the context, but
+  // the ones of the speculations are discarded below. Do not redo the work
+  // if it already failed to find a cut for the same equalities.
+  if (d_dioCutFailed.get() == hash)
+  {
+    ++d_statistics.d_dioCutsSkipped;
+    return TrustNode::null();
+  }
+
+  SumPair plane = SumPair::mkZero(nodeManager());
+  {
+    context::Context::ScopedPush speculativePush(context());
+    //DO NOT TOUCH THE OUTPUTSTREAM
 
-  SumPair plane = d_diosolver.processEquationsForCut();
+    for (ArithVar v : speculative)
+    {
+      //Add v = dr as a speculation.
+      Comparison eq = mkIntegerEqualityFromAssignment(v);
+      Trace("dio::push") << "dio::push " << v << " " <<  eq.getNode() << endl;
+      Assert(!eq.isBoolean());
+      d_diosolver.pushInputConstraint(eq, eq.getNode());
+      // It does not matter what the explanation of eq is.
+      // It cannot be used in a conflict
+    }
+
+    plane = d_diosolver.processEquationsForCut();
+  }
   if(plane.isZero()){
+    d_dioCutFailed = hash;
     return TrustNode::null();
   }else{
     Polynomial p = plane.getPolynomial();
@@ -1438,6 +1511,163 @@ TrustNode TheoryArithPrivate::dioCutting()
   }
 }
 
+std::vector<TrustNode> TheoryArithPrivate::gomoryCuts()
+{
+  // At most this many cuts are issued in a round, the ones separating the
+  // current assignment the most.
+  constexpr size_t maxCutsPerRound = 8;
+  std::vector<TrustNode> cuts;
+  // There is no proof rule for the cuts.
+  if (proofsEnabled() || d_qflraStatus != Result::SAT)
+  {
+    return cuts;
+  }
+  std::vector<std::pair<double, Node>> candidates;
+  for (Tableau::BasicIterator i = d_tableau.beginBasic(),
+                              iend = d_tableau.endBasic();
+       i != iend;
+       ++i)
+  {
+    ArithVar basic = *i;
+    if (!isInteger(basic)
+        || d_partialModel.getAssignment(basic).getNoninfinitesimalPart()
+               .isIntegral())
+    {
+      continue;
+    }
+    double efficacy = 0;
+    Node cut = gomoryCut(basic, efficacy);
+    if (!cut.isNull())
+    {
+      candidates.emplace_back(efficacy, cut);
+    }
+  }
+  std::sort(candidates.begin(),
+            candidates.end(),
+            [](const std::pair<double, Node>& a,
+               const std::pair<double, Node>& b) { return a.first > b.first; });
+  for (size_t i = 0, n = std::min(candidates.size(), maxCutsPerRound); i < n;
+       ++i)
+  {
+    cuts.push_back(TrustNode::mkTrustLemma(candidates[i].second, nullptr));
+  }
+  d_statistics.d_gomoryCuts += cuts.size();
+  return cuts;
+}
+
+Node TheoryArithPrivate::gomoryCut(ArithVar basic, double& efficacy)
+{
+  // The coefficients of a cut may not vary more than this in magnitude.
+  constexpr double maxDynamism = 1e6;
+
+  // The row is basic = sum a_j x_j. Let y_j = x_j - b_j for the nonbasic
+  // variables at their lower bound b_j, and y_j = b_j - x_j for the ones at
+  // their upper bound b_j. Then basic + sum alpha_j y_j = beta, where alpha_j
+  // is -a_j resp. a_j, the y_j are non-negative and beta is the non-integral
+  // value of basic. The cut is sum g_j y_j >= 1, with g_j computed from the
+  // fractional parts of beta and alpha_j. The integral y_j are those of the
+  // integer variables at an integral bound.
+  Assert(d_tableau.isBasic(basic));
+  NodeManager* nm = nodeManager();
+  std::vector<std::tuple<ArithVar, Rational, bool>> coeffs;
+  ConstraintCPVec bounds;
+  Rational beta;
+  for (Tableau::RowIterator ri = d_tableau.basicRowIterator(basic);
+       !ri.atEnd();
+       ++ri)
+  {
+    const Tableau::Entry& entry = *ri;
+    ArithVar v = entry.getColVar();
+    if (v == basic)
+    {
+      continue;
+    }
+    ConstraintP c;
+    if (d_partialModel.hasLowerBound(v)
+        && d_partialModel.cmpAssignmentLowerBound(v) == 0)
+    {
+      c = d_partialModel.getLowerBoundConstraint(v);
+    }
+    else if (d_partialModel.hasUpperBound(v)
+             && d_partialModel.cmpAssignmentUpperBound(v) == 0)
+    {
+      c = d_partialModel.getUpperBoundConstraint(v);
+    }
+    else
+    {
+      return Node::null();
+    }
+    bool upper = c->isUpperBound();
+    const DeltaRational& b = c->getValue();
+    const Rational& a = entry.getCoefficient();
+    beta += a * b.getNoninfinitesimalPart();
+    coeffs.emplace_back(v, upper ? a : -a, isInteger(v) && b.isIntegral());
+    bounds.push_back(c);
+  }
+  Rational f0 = beta.floor_frac();
+  if (f0.isZero())
+  {
+    return Node::null();
+  }
+  Rational f0c = Rational(1) - f0;
+
+  // Compute the cut in terms of the x_j, i.e. sum g_j s_j x_j >= rhs with
+  // s_j = 1 for the lower and -1 for the upper bounds.
+  DenseMap<Rational> lhs;
+  Rational rhs(1);
+  double norm = 0, minCoeff = 0, maxCoeff = 0;
+  for (size_t i = 0, n = coeffs.size(); i < n; ++i)
+  {
+    const auto& [v, alpha, integral] = coeffs[i];
+    Rational g;
+    if (integral)
+    {
+      Rational fj = alpha.floor_frac();
+      g = fj <= f0 ? fj / f0 : (Rational(1) - fj) / f0c;
+    }
+    else
+    {
+      g = alpha.sgn() >= 0 ? alpha / f0 : -alpha / f0c;
+    }
+    if (g.isZero())
+    {
+      continue;
+    }
+    double gd = g.getDouble();
+    norm += gd * gd;
+    minCoeff = minCoeff == 0 ? gd : std::min(minCoeff, gd);
+    maxCoeff = std::max(maxCoeff, gd);
+    if (bounds[i]->isUpperBound())
+    {
+      g = -g;
+    }
+    rhs += g * bounds[i]->getValue().getNoninfinitesimalPart();
+    lhs.set(v, g);
+  }
+  // The current assignment has y_j = 0 (up to the infinitesimals), so the
+  // distance of the cut to it is 1 / ||g||.
+  efficacy = norm == 0 ? std::numeric_limits<double>::infinity()
+                       : 1.0 / std::sqrt(norm);
+  if (efficacy < options().arith.arithGomoryMinEfficacy
+      || (minCoeff > 0 && maxCoeff / minCoeff > maxDynamism))
+  {
+    ++d_statistics.d_gomoryCutsFiltered;
+    return Node::null();
+  }
+  Node sum = toSumNode(nm, d_partialModel, lhs);
+  if (sum.isNull())
+  {
+    return Node::null();
+  }
+  Node cut =
+      nm->mkNode(Kind::GEQ, sum, nm->mkConstRealOrInt(sum.getType(), rhs));
+  Node expl = Constraint::externalExplainByAssertions(nm, bounds);
+  Node lemma = rewrite(nm->mkNode(Kind::IMPLIES, expl, cut));
+  Trace("arith::gomory") << "gomory cut for " << basic << ": " << lemma
+                         << " efficacy " << efficacy << endl;
+  return lemma;
+}
+
 Node TheoryArithPrivate::callDioSolver(){
   while(!d_constantIntegerVariables.empty()){
     ArithVar v = d_constantIntegerVariables.front();
@@ -2955,13 +3185,14 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
 
   SimplexDecisionProcedure& simplex = selectSimplex(true);
 
-  bool useApprox = options().arith.useApprox && ApproximateSimplex::enabled()
+  bool useApprox = options().arith.useApprox
+                   && ApproximateSimplex::relaxationEnabled()
                    && getSolveIntegerResource();
 
   Trace("TheoryArithPrivate::solveRealRelaxation")
       << "solveRealRelaxation() approx"
       << " " << options().arith.useApprox << " "
-      << ApproximateSimplex::enabled() << " " << useApprox << " "
+      << ApproximateSimplex::relaxationEnabled() << " " << useApprox << " "
       << safeToCallApprox() << endl;
 
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
@@ -2974,7 +3205,7 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   {
     // pass2: fancy-final
     static constexpr int32_t relaxationLimit = 10000;
-    Assert(ApproximateSimplex::enabled());
+    Assert(ApproximateSimplex::relaxationEnabled());
 
     TreeLog& tl = getTreeLog();
     ApproximateStatistics& stats = getApproxStats();
@@ -3431,6 +3662,25 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
       }
     }
 
+    if (!emmittedConflictOrSplit
+        && d_gomoryRounds < options().arith.arithGomoryRounds)
+    {
+      std::vector<TrustNode> cuts = gomoryCuts();
+      for (const TrustNode& cut : cuts)
+      {
+        Trace("arith::lemma") << "gomory cut   " << cut << endl;
+        if (outputTrustedLemma(cut, InferenceId::ARITH_GOMORY_CUT))
+        {
+          emmittedConflictOrSplit = true;
+        }
+      }
+      if (!cuts.empty())
+      {
+        d_gomoryRounds = d_gomoryRounds + 1;
+        d_cutCount = d_cutCount + 1;
+      }
+    }
+
     if(!emmittedConflictOrSplit) {
       bool tryNew;
       Trace("arith-round-robin") << "Round robin branch..." << std::endl;
@@ -4354,7 +4604,10 @@ void TheoryArithPrivate::propagateCandidatesNew(){
   Trace("arith::prop") << "propagateCandidatesNew begin" << endl;
 
   Assert(d_qflraStatus == Result::SAT);
-  if(d_updatedBounds.empty()){ return; }
+  if (d_updatedBounds.empty() && d_candidateRows.empty())
+  {
+    return;
+  }
   dumpUpdatedBoundsToRows();
   Assert(d_updatedBounds.empty());
 
@@ -4363,9 +4616,28 @@ void TheoryArithPrivate::propagateCandidatesNew(){
     d_partialModel.processBoundsQueue(utcb);
   }
 
+  // The number of row entries that may still be visited in this round, where
+  // 0 means no limit. The rows left over are kept for the next round.
+  uint64_t budget = options().arith.arithPropagateBudget;
+  bool bounded = budget > 0;
   while(!d_candidateRows.empty()){
+    if (bounded && budget == 0)
+    {
+      d_statistics.d_boundRowsDeferred += d_candidateRows.size();
+      break;
+    }
     RowIndex candidate = d_candidateRows.back();
     d_candidateRows.pop_back();
+    if (!d_tableau.isRowIndex(candidate))
+    {
+      // deferred from an earlier round and removed since
+      continue;
+    }
+    if (bounded)
+    {
+      budget -= std::min<uint64_t>(budget, d_tableau.getRowLength(candidate));
+    }
+    ++d_statistics.d_boundRowsProcessed;
     propagateCandidateRow(candidate);
   }
   Trace("arith::prop") << "propagateCandidatesNew end" << endl << endl << endl;
@@ -4682,7 +4954,6 @@ bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx){
 }
 
 void TheoryArithPrivate::dumpUpdatedBoundsToRows(){
-  Assert(d_candidateRows.empty());
   DenseSet::const_iterator i = d_updatedBounds.begin();
   DenseSet::const_iterator end = d_updatedBounds.end();
   for(; i != end; ++i){
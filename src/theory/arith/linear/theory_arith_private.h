@@ -251,6 +251,26 @@ private:
    */
   TrustNode dioCutting();
 
+  /**
+   * Produces Gomory mixed-integer cuts from the rows of the tableau whose
+   * basic variable is an integer with a fractional assignment, and whose
+   * nonbasic variables are all at one of their bounds. Each lemma is of the
+   * form (=> B c) where B explains the bounds of the nonbasic variables and c
+   * is the cut, which the current assignment violates.
+   *
+   * Cuts that separate the current assignment by less than
+   * arithGomoryMinEfficacy, or whose coefficients vary too much in
+   * magnitude, are not returned.
+   */
+  std::vector<TrustNode> gomoryCuts();
+
+  /**
+   * Returns the Gomory mixed-integer cut of the row of basic, or the null
+   * node if there is none or it was filtered. If a cut is returned, efficacy
+   * is set to the distance by which it separates the current assignment.
+   */
+  Node gomoryCut(ArithVar basic, double& efficacy);
+
   Comparison mkIntegerEqualityFromAssignment(ArithVar v);
 
   /**
@@ -615,9 +635,17 @@ private:
 
   /** Tracks the basic variables where propagation might be possible. */
   DenseSet d_candidateBasics;
+  /**
+   * The rows where propagation might be possible. Rows that did not fit in
+   * the budget of a round (see arithPropagateBudget) are kept here for the
+   * next round, by which time they may have been removed from the tableau.
+   */
   DenseSet d_candidateRows;
 
-  bool hasAnyUpdates() { return !d_updatedBounds.empty(); }
+  bool hasAnyUpdates()
+  {
+    return !d_updatedBounds.empty() || !d_candidateRows.empty();
+  }
   void clearUpdates();
 
   void revertOutOfConflict();
@@ -716,6 +744,8 @@ private:
   void branchVector(const std::vector<ArithVar>& lemmas);
 
   context::CDO<unsigned> d_cutCount;
+  /** The number of rounds of Gomory cuts issued in the context. */
+  context::CDO<unsigned> d_gomoryRounds;
   context::CDHashSet<ArithVar, std::hash<ArithVar>> d_cutInContext;
 
   context::CDO<bool> d_likelyIntegerInfeasible;
@@ -760,6 +790,11 @@ private:
 
   int32_t d_dioSolveResources;
   bool getDioCuttingResource();
+  /**
+   * A hash of the input and speculated equalities of the last call to
+   * dioCutting() in the context that did not find a cut, or 0.
+   */
+  context::CDO<uint64_t> d_dioCutFailed;
 
   uint32_t d_solveIntMaybeHelp, d_solveIntAttempts;
 
@@ -796,6 +831,14 @@ private:
 
     TimerStat d_boundComputationTime;
     IntStat d_boundComputations, d_boundPropagations;
+    /** Rows visited by, and rows deferred to the next, propagation round. */
+    IntStat d_boundRowsProcessed, d_boundRowsDeferred;
+
+    /** Gomory cuts issued, and discarded as too weak or unstable. */
+    IntStat d_gomoryCuts, d_gomoryCutsFiltered;
+
+    /** Calls to dioCutting() skipped since they failed before. */
+    IntStat d_dioCutsSkipped;
 
     IntStat d_unknownChecks;
     IntStat d_maxUnknownsInARow;
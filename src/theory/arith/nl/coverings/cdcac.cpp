@@ -18,6 +18,9 @@
 
 #ifdef CVC5_POLY_IMP
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "options/arith_options.h"
 #include "theory/arith/nl/coverings/lazard_evaluation.h"
 #include "theory/arith/nl/coverings/projections.h"
@@ -45,7 +48,11 @@ namespace nl {
 namespace coverings {
 
 CDCAC::CDCAC(Env& env, const std::vector<poly::Variable>& ordering)
-    : EnvObj(env), d_variableOrdering(ordering)
+    : EnvObj(env),
+      d_variableOrdering(ordering),
+      d_projectionCache(statisticsRegistry()),
+      d_reusedIntervals(statisticsRegistry().registerInt(
+          "theory::arith::coverings::reused-intervals"))
 {
   if (d_env.isTheoryProofProducing())
   {
@@ -63,8 +70,37 @@ void CDCAC::reset()
 void CDCAC::computeVariableOrdering()
 {
   // Actually compute the variable ordering
-  d_variableOrdering = d_varOrder(d_constraints.getConstraints(),
-                                  VariableOrderingStrategy::BROWN);
+  std::vector<poly::Variable> ordering = d_varOrder(
+      d_constraints.getConstraints(), VariableOrderingStrategy::BROWN);
+  if (options().arith.nlCovIncremental)
+  {
+    auto isIn = [](const std::vector<poly::Variable>& vars,
+                   const poly::Variable& v) {
+      return std::find(vars.begin(), vars.end(), v) != vars.end();
+    };
+    if (std::all_of(
+            ordering.begin(), ordering.end(), [&](const poly::Variable& v) {
+              return isIn(d_variableOrdering, v);
+            }))
+    {
+      // No new variables, keep the previous ordering of the variables.
+      std::vector<poly::Variable> stable;
+      for (const auto& v : d_variableOrdering)
+      {
+        if (isIn(ordering, v))
+        {
+          stable.emplace_back(v);
+        }
+      }
+      ordering = std::move(stable);
+    }
+  }
+  if (ordering != d_variableOrdering)
+  {
+    // cached polynomials are only valid for the previous ordering
+    d_projectionCache.clear();
+    d_variableOrdering = std::move(ordering);
+  }
   Trace("cdcac") << "Variable ordering is now " << d_variableOrdering
                  << std::endl;
 
@@ -354,17 +390,18 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
     }
     for (const auto& p : i.d_mainPolys)
     {
+      const poly::Polynomial& disc = d_projectionCache.discriminant(p);
       Trace("cdcac::projection")
-          << "Discriminant of " << p << " -> " << discriminant(p) << std::endl;
+          << "Discriminant of " << p << " -> " << disc << std::endl;
       // Add all discriminants
-      res.add(discriminant(p));
+      res.add(disc);
 
       // Add pairwise resultants
       for (const auto& q : i.d_mainPolys)
       {
         // avoid symmetric duplicates
         if (p >= q) continue;
-        res.add(resultant(p, q));
+        res.add(d_projectionCache.resultant(p, q));
       }
 
       for (const auto& q : requiredCoefficients(p))
@@ -379,18 +416,20 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
         if (p == q) continue;
         // Check whether p(s \times a) = 0 for some a <= l
         if (!hasRootBelow(q, get_lower(i.d_interval))) continue;
-        Trace("cdcac::projection") << "Resultant of " << p << " and " << q
-                                   << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        const poly::Polynomial& r = d_projectionCache.resultant(p, q);
+        Trace("cdcac::projection")
+            << "Resultant of " << p << " and " << q << " -> " << r << std::endl;
+        res.add(r);
       }
       for (const auto& q : i.d_upperPolys)
       {
         if (p == q) continue;
         // Check whether p(s \times a) = 0 for some a >= u
         if (!hasRootAbove(q, get_upper(i.d_interval))) continue;
-        Trace("cdcac::projection") << "Resultant of " << p << " and " << q
-                                   << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        const poly::Polynomial& r = d_projectionCache.resultant(p, q);
+        Trace("cdcac::projection")
+            << "Resultant of " << p << " and " << q << " -> " << r << std::endl;
+        res.add(r);
       }
     }
   }
@@ -402,9 +441,10 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
     {
       for (const auto& q : intervals[i + 1].d_lowerPolys)
       {
-        Trace("cdcac::projection") << "Resultant of " << p << " and " << q
-                                   << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        const poly::Polynomial& r = d_projectionCache.resultant(p, q);
+        Trace("cdcac::projection")
+            << "Resultant of " << p << " and " << q << " -> " << r << std::endl;
+        res.add(r);
       }
     }
   }
@@ -533,6 +573,10 @@ std::vector<CACInterval> CDCAC::getUnsatCoverImpl(std::size_t curVariable,
   Trace("cdcac") << "Looking for unsat cover for "
                  << d_variableOrdering[curVariable] << std::endl;
   std::vector<CACInterval> intervals = getUnsatIntervals(curVariable);
+  if (curVariable == 0)
+  {
+    reusePreviousIntervals(intervals);
+  }
 
   if (TraceIsOn("cdcac"))
   {
@@ -548,6 +592,11 @@ std::vector<CACInterval> CDCAC::getUnsatCoverImpl(std::size_t curVariable,
 
   while (sampleOutsideWithInitial(intervals, sample, curVariable))
   {
+    if (curVariable == 0 && options().arith.nlCovIncremental)
+    {
+      d_previousIntervals = intervals;
+      d_previousVariable = d_variableOrdering[0];
+    }
     if (!checkIntegrality(curVariable, sample))
     {
       // the variable is integral, but the sample is not.
@@ -624,6 +673,11 @@ std::vector<CACInterval> CDCAC::getUnsatCoverImpl(std::size_t curVariable,
     // Remove redundant intervals
     pruneRedundantIntervals(intervals);
   }
+  if (curVariable == 0 && options().arith.nlCovIncremental)
+  {
+    d_previousIntervals = intervals;
+    d_previousVariable = d_variableOrdering[0];
+  }
 
   if (TraceIsOn("cdcac"))
   {
@@ -696,19 +750,19 @@ CACInterval CDCAC::buildIntegralityInterval(std::size_t cur_variable,
                      {}};
 }
 
-bool CDCAC::hasRootAbove(const poly::Polynomial& p,
-                         const poly::Value& val) const
+bool CDCAC::hasRootAbove(const poly::Polynomial& p, const poly::Value& val)
 {
-  auto roots = poly::isolate_real_roots(p, d_assignment);
+  const std::vector<poly::Value>& roots =
+      d_projectionCache.isolateRealRoots(p, d_assignment, d_variableOrdering);
   return std::any_of(roots.begin(), roots.end(), [&val](const poly::Value& r) {
     return r >= val;
   });
 }
 
-bool CDCAC::hasRootBelow(const poly::Polynomial& p,
-                         const poly::Value& val) const
+bool CDCAC::hasRootBelow(const poly::Polynomial& p, const poly::Value& val)
 {
-  auto roots = poly::isolate_real_roots(p, d_assignment);
+  const std::vector<poly::Value>& roots =
+      d_projectionCache.isolateRealRoots(p, d_assignment, d_variableOrdering);
   return std::any_of(roots.begin(), roots.end(), [&val](const poly::Value& r) {
     return r <= val;
   });
@@ -764,14 +818,47 @@ void CDCAC::prepareRootIsolation(LazardEvaluation& le,
   }
 }
 
-std::vector<poly::Value> CDCAC::isolateRealRoots(
-    LazardEvaluation& le, const poly::Polynomial& p) const
+void CDCAC::reusePreviousIntervals(std::vector<CACInterval>& intervals)
+{
+  if (!options().arith.nlCovIncremental || isProofEnabled()
+      || d_previousIntervals.empty())
+  {
+    return;
+  }
+  if (d_previousVariable == d_variableOrdering[0])
+  {
+    std::unordered_set<Node> current;
+    for (const auto& c : d_constraints.getConstraints())
+    {
+      current.insert(std::get<2>(c));
+    }
+    for (const auto& i : d_previousIntervals)
+    {
+      if (std::all_of(i.d_origins.begin(),
+                      i.d_origins.end(),
+                      [&current](const Node& n) { return current.count(n); }))
+      {
+        Trace("cdcac") << "Reusing " << i.d_interval << " from "
+                       << i.d_origins << std::endl;
+        intervals.emplace_back(i);
+        intervals.back().d_id = d_nextIntervalId++;
+        ++d_reusedIntervals;
+      }
+    }
+    pruneRedundantIntervals(intervals);
+  }
+  d_previousIntervals.clear();
+}
+
+std::vector<poly::Value> CDCAC::isolateRealRoots(LazardEvaluation& le,
+                                                 const poly::Polynomial& p)
 {
   if (options().arith.nlCovLifting == options::nlCovLiftingMode::LAZARD)
   {
     return le.isolateRealRoots(p);
   }
-  return poly::isolate_real_roots(p, d_assignment);
+  return d_projectionCache.isolateRealRoots(
+      p, d_assignment, d_variableOrdering);
 }
 
 }  // namespace coverings
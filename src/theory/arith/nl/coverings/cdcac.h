@@ -30,8 +30,10 @@
 #include "theory/arith/nl/coverings/cdcac_utils.h"
 #include "theory/arith/nl/coverings/constraints.h"
 #include "theory/arith/nl/coverings/lazard_evaluation.h"
+#include "theory/arith/nl/coverings/projections.h"
 #include "theory/arith/nl/coverings/proof_generator.h"
 #include "theory/arith/nl/coverings/variable_ordering.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -55,7 +57,11 @@ class CDCAC : protected EnvObj
   /** Reset this instance. */
   void reset();
 
-  /** Collect variables from the constraints and compute a variable ordering. */
+  /**
+   * Collect variables from the constraints and compute a variable ordering.
+   * With --nl-cov-incremental, the previous ordering is kept (restricted to
+   * the current variables) unless new variables occur.
+   */
   void computeVariableOrdering();
 
   /**
@@ -131,6 +137,13 @@ class CDCAC : protected EnvObj
    * @param returnFirstInterval If true, the function returns after the first
    * interval obtained from a recursive call. The result is not (necessarily) an
    * unsat cover, but merely a list of infeasible intervals.
+   *
+   * Note: samples are explored one at a time. Every sample is chosen outside
+   * of the intervals refuted so far, and the recursion shares d_assignment,
+   * the proof generator and libpoly's global variable ordering, which lazily
+   * reorders polynomials in place. Hence subtrees can not be explored by
+   * concurrent threads; multiple cores are used instead by running different
+   * strategies in separate processes with --use-portfolio.
    */
   std::vector<CACInterval> getUnsatCoverImpl(std::size_t curVariable = 0,
                                              bool returnFirstInterval = false);
@@ -182,12 +195,12 @@ class CDCAC : protected EnvObj
    * Check whether the polynomial has a real root above the given value (when
    * evaluated over the current assignment).
    */
-  bool hasRootAbove(const poly::Polynomial& p, const poly::Value& val) const;
+  bool hasRootAbove(const poly::Polynomial& p, const poly::Value& val);
   /**
    * Check whether the polynomial has a real root below the given value (when
    * evaluated over the current assignment).
    */
-  bool hasRootBelow(const poly::Polynomial& p, const poly::Value& val) const;
+  bool hasRootBelow(const poly::Polynomial& p, const poly::Value& val);
 
   /**
    * Sort intervals according to section 4.4.1. and removes fully redundant
@@ -202,13 +215,21 @@ class CDCAC : protected EnvObj
    */
   void prepareRootIsolation(LazardEvaluation& le, size_t cur_variable) const;
 
+  /**
+   * With --nl-cov-incremental, adds the infeasible intervals for the first
+   * variable found by the previous call to getUnsatCover() whose origins are
+   * all still among the constraints. Such intervals do not depend on any
+   * sample and hence remain valid.
+   */
+  void reusePreviousIntervals(std::vector<CACInterval>& intervals);
+
   /**
    * Isolates the real roots of the polynomial `p`. If the lazard lifting is
    * enabled, this function uses `le.isolateRealRoots()`, otherwise uses the
-   * regular `poly::isolate_real_roots()`.
+   * regular `poly::isolate_real_roots()` through the projection cache.
    */
   std::vector<poly::Value> isolateRealRoots(LazardEvaluation& le,
-                                            const poly::Polynomial& p) const;
+                                            const poly::Polynomial& p);
 
   /**
    * The current assignment. When the method terminates with SAT, it contains a
@@ -233,6 +254,19 @@ class CDCAC : protected EnvObj
 
   /** The next interval id */
   size_t d_nextIntervalId = 1;
+
+  /**
+   * The cache for discriminants, resultants and real roots. It is kept across
+   * calls to reset() and only cleared when the variable ordering changes.
+   */
+  ProjectionCache d_projectionCache;
+
+  /** The infeasible intervals for the first variable of the last call. */
+  std::vector<CACInterval> d_previousIntervals;
+  /** The first variable of the ordering used for d_previousIntervals. */
+  poly::Variable d_previousVariable;
+  /** The number of intervals reused from the previous call. */
+  IntStat d_reusedIntervals;
 };
 
 }  // namespace coverings
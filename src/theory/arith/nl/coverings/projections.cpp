@@ -18,6 +18,7 @@
 #ifdef CVC5_POLY_IMP
 
 #include "base/check.h"
+#include "util/statistics_registry.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -101,6 +102,88 @@ PolyVector projectionMcCallum(const std::vector<Polynomial>& polys)
   return res;
 }
 
+ProjectionCache::ProjectionCache(StatisticsRegistry& reg)
+    : d_projectionHits(
+        reg.registerInt("theory::arith::coverings::projection-cache-hits")),
+      d_projectionMisses(
+          reg.registerInt("theory::arith::coverings::projection-cache-misses")),
+      d_rootHits(reg.registerInt("theory::arith::coverings::root-cache-hits")),
+      d_rootMisses(
+          reg.registerInt("theory::arith::coverings::root-cache-misses"))
+{
+}
+
+void ProjectionCache::clear()
+{
+  d_discriminants.clear();
+  d_resultants.clear();
+  d_roots.clear();
+}
+
+const Polynomial& ProjectionCache::discriminant(const Polynomial& p)
+{
+  auto it = d_discriminants.find(p);
+  if (it != d_discriminants.end())
+  {
+    ++d_projectionHits;
+    return it->second;
+  }
+  ++d_projectionMisses;
+  if (d_discriminants.size() >= s_maxSize)
+  {
+    d_discriminants.clear();
+  }
+  return d_discriminants.emplace(p, poly::discriminant(p)).first->second;
+}
+
+const Polynomial& ProjectionCache::resultant(const Polynomial& p,
+                                             const Polynomial& q)
+{
+  std::pair<Polynomial, Polynomial> key(p, q);
+  auto it = d_resultants.find(key);
+  if (it != d_resultants.end())
+  {
+    ++d_projectionHits;
+    return it->second;
+  }
+  ++d_projectionMisses;
+  if (d_resultants.size() >= s_maxSize)
+  {
+    d_resultants.clear();
+  }
+  Polynomial res = poly::resultant(key.first, key.second);
+  return d_resultants.emplace(std::move(key), std::move(res)).first->second;
+}
+
+const std::vector<Value>& ProjectionCache::isolateRealRoots(
+    const Polynomial& p,
+    const Assignment& a,
+    const std::vector<Variable>& ordering)
+{
+  std::pair<Polynomial, std::vector<Value>> key;
+  key.first = p;
+  Variable mv = main_variable(p);
+  for (const auto& v : ordering)
+  {
+    if (v == mv) break;
+    Assert(a.has(v));
+    key.second.emplace_back(a.get(v));
+  }
+  auto it = d_roots.find(key);
+  if (it != d_roots.end())
+  {
+    ++d_rootHits;
+    return it->second;
+  }
+  ++d_rootMisses;
+  if (d_roots.size() >= s_maxSize)
+  {
+    d_roots.clear();
+  }
+  std::vector<Value> roots = poly::isolate_real_roots(p, a);
+  return d_roots.emplace(std::move(key), std::move(roots)).first->second;
+}
+
 }  // namespace coverings
 }  // namespace nl
 }  // namespace arith
@@ -22,8 +22,12 @@
 
 #include <poly/polyxx.h>
 
+#include <map>
+#include <utility>
 #include <vector>
 
+#include "util/statistics_stats.h"
+
 namespace cvc5::internal {
 namespace theory {
 namespace arith {
@@ -71,6 +75,57 @@ class PolyVector : public std::vector<poly::Polynomial>
  */
 PolyVector projectionMcCallum(const std::vector<poly::Polynomial>& polys);
 
+/**
+ * A cache for the projection operations of the coverings method, which are
+ * mostly recomputed for the same polynomials in consecutive checks.
+ * Discriminants and resultants only depend on the polynomials, real roots
+ * additionally depend on the values of the variables below the main variable.
+ *
+ * Polynomials are compared with respect to the variable ordering of libpoly,
+ * hence the cache must be cleared whenever this ordering changes.
+ */
+class ProjectionCache
+{
+ public:
+  ProjectionCache(StatisticsRegistry& reg);
+
+  /** Clear all cached results. */
+  void clear();
+
+  /** Get the discriminant of p. */
+  const poly::Polynomial& discriminant(const poly::Polynomial& p);
+  /** Get the resultant of p and q. */
+  const poly::Polynomial& resultant(const poly::Polynomial& p,
+                                    const poly::Polynomial& q);
+  /**
+   * Get the real roots of p over the assignment a, where the variables below
+   * the main variable of p in the given ordering must be assigned.
+   */
+  const std::vector<poly::Value>& isolateRealRoots(
+      const poly::Polynomial& p,
+      const poly::Assignment& a,
+      const std::vector<poly::Variable>& ordering);
+
+ private:
+  /** The maximum number of entries of a single map before clearing it. */
+  static constexpr size_t s_maxSize = 1 << 14;
+
+  /** The cached discriminants. */
+  std::map<poly::Polynomial, poly::Polynomial> d_discriminants;
+  /** The cached resultants, keyed by the ordered pair of polynomials. */
+  std::map<std::pair<poly::Polynomial, poly::Polynomial>, poly::Polynomial>
+      d_resultants;
+  /** The cached real roots, keyed by the polynomial and the sample values. */
+  std::map<std::pair<poly::Polynomial, std::vector<poly::Value>>,
+           std::vector<poly::Value>>
+      d_roots;
+
+  IntStat d_projectionHits;
+  IntStat d_projectionMisses;
+  IntStat d_rootHits;
+  IntStat d_rootMisses;
+};
+
 }  // namespace coverings
 }  // namespace nl
 }  // namespace arith
@@ -15,6 +15,8 @@
 
 #include "theory/arith/nl/ext/monomial_bounds_check.h"
 
+#include <algorithm>
+
 #include "expr/node.h"
 #include "options/arith_options.h"
 #include "proof/proof.h"
@@ -229,6 +231,9 @@ void MonomialBoundsCheck::checkBounds(const std::vector<Node>& asserts,
   }
 
   Trace("nl-ext") << "Get inferred bound lemmas..." << std::endl;
+  // the inferred lemmas, sent at the end if --nl-ext-lemma-limit is set
+  std::vector<InferredBound> inferred;
+  uint64_t limit = options().arith.nlExtLemmaLimit;
   const std::map<Node, std::vector<Node> >& cpMap =
       d_data->d_mdb.getContainsParentMap();
   for (unsigned k = 0; k < d_data->d_mterms.size(); k++)
@@ -324,6 +329,12 @@ void MonomialBoundsCheck::checkBounds(const std::vector<Node>& asserts,
                            nm->mkConstRealOrInt(mult.getType(), Rational(0))),
                 d_ci_exp[x][coeff][rhs]);
             Node iblem = nm->mkNode(Kind::IMPLIES, exp, infer);
+            if (limit > 0
+                && d_data->d_im.hasCachedLemma(iblem, LemmaProperty::NONE))
+            {
+              // would be discarded, do not let it take the place of another
+              continue;
+            }
             Node iblem_rw = rewrite(iblem);
             bool introNewTerms = hasNewMonomials(iblem_rw, d_data->d_ms);
             Trace("nl-ext-bound-lemma")
@@ -419,15 +430,49 @@ void MonomialBoundsCheck::checkBounds(const std::vector<Node>& asserts,
                                {iblem});
               }
             }
-            d_data->d_im.addPendingLemma(iblem,
-                                         InferenceId::ARITH_NL_INFER_BOUNDS_NT,
-                                         proof,
-                                         introNewTerms);
+            if (limit == 0)
+            {
+              d_data->d_im.addPendingLemma(
+                  iblem,
+                  InferenceId::ARITH_NL_INFER_BOUNDS_NT,
+                  proof,
+                  introNewTerms);
+              continue;
+            }
+            InferredBound ib{iblem, proof, introNewTerms, Rational(0)};
+            Node lmv = d_data->d_model.computeAbstractModelValue(infer_lhs);
+            Node rmv = d_data->d_model.computeAbstractModelValue(infer_rhs);
+            if (lmv.isConst() && rmv.isConst())
+            {
+              ib.d_violation =
+                  (lmv.getConst<Rational>() - rmv.getConst<Rational>()).abs();
+            }
+            inferred.emplace_back(ib);
           }
         }
       }
     }
   }
+  if (inferred.size() > limit)
+  {
+    // Send the lemmas with the largest violation in the current model. The
+    // others are inferred again in later rounds if they are still violated.
+    std::stable_sort(inferred.begin(),
+                     inferred.end(),
+                     [](const InferredBound& x, const InferredBound& y) {
+                       return x.d_violation > y.d_violation;
+                     });
+    Trace("nl-ext-bound") << "Defer " << inferred.size() - limit
+                          << " bound inference lemmas" << std::endl;
+    inferred.resize(limit);
+  }
+  for (const InferredBound& ib : inferred)
+  {
+    d_data->d_im.addPendingLemma(ib.d_lemma,
+                                 InferenceId::ARITH_NL_INFER_BOUNDS_NT,
+                                 ib.d_proof,
+                                 ib.d_introNewTerms);
+  }
 }
 
 void MonomialBoundsCheck::checkResBounds()
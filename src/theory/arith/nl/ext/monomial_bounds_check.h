@@ -19,8 +19,12 @@
 #include "expr/node.h"
 #include "smt/env_obj.h"
 #include "theory/arith/nl/ext/constraint.h"
+#include "util/rational.h"
 
 namespace cvc5::internal {
+
+class CDProof;
+
 namespace theory {
 namespace arith {
 namespace nl {
@@ -50,6 +54,10 @@ class MonomialBoundsCheck : protected EnvObj
    * x < 0 ^ (y > z + w) => x*y < x*(z+w)
    *   ...where (y > z + w) and x*y are a constraint and term
    *      that occur in the current context.
+   *
+   * With --nl-ext-lemma-limit=K, at most K lemmas are sent, namely the ones
+   * with the largest violation in the current model, skipping lemmas that
+   * were sent before.
    */
   void checkBounds(const std::vector<Node>& asserts,
                    const std::vector<Node>& false_asserts);
@@ -71,6 +79,17 @@ class MonomialBoundsCheck : protected EnvObj
   void checkResBounds();
 
  private:
+  /** A lemma inferred by checkBounds(). */
+  struct InferredBound
+  {
+    Node d_lemma;
+    CDProof* d_proof;
+    /** Whether the lemma introduces new monomials. */
+    bool d_introNewTerms;
+    /** The difference of both sides of the inferred bound in the model. */
+    Rational d_violation;
+  };
+
   /** Basic data that is shared with other checks */
   ExtState* d_data;
 
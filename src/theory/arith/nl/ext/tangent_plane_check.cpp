@@ -15,7 +15,10 @@
 
 #include "theory/arith/nl/ext/tangent_plane_check.h"
 
+#include <algorithm>
+
 #include "expr/node.h"
+#include "options/arith_options.h"
 #include "proof/proof.h"
 #include "theory/arith/arith_msum.h"
 #include "theory/arith/arith_utilities.h"
@@ -43,6 +46,7 @@ void TangentPlaneCheck::check(bool asWaitingLemmas)
   NodeManager* nm = nodeManager();
   const std::map<Node, std::vector<Node> >& ccMap =
       d_data->d_mdb.getContainsChildrenMap();
+  std::vector<Refinement> refinements;
   unsigned kstart = d_data->d_ms_vars.size();
   for (unsigned k = kstart; k < d_data->d_mterms.size(); k++)
   {
@@ -60,6 +64,7 @@ void TangentPlaneCheck::check(bool asWaitingLemmas)
     {
       continue;
     }
+    Node t_v = d_data->d_model.computeAbstractModelValue(t);
     std::map<Node, std::map<Node, bool> > dproc;
     for (unsigned j = 0; j < it->second.size(); j++)
     {
@@ -76,95 +81,126 @@ void TangentPlaneCheck::check(bool asWaitingLemmas)
           dproc[a][b] = true;
           Trace("nl-ext-tplanes")
               << "  decomposable into : " << a << " * " << b << std::endl;
-          Node a_v_c = d_data->d_model.computeAbstractModelValue(a);
-          Node b_v_c = d_data->d_model.computeAbstractModelValue(b);
+          Refinement r;
+          r.d_a = a;
+          r.d_b = b;
+          r.d_aValue = d_data->d_model.computeAbstractModelValue(a);
+          r.d_bValue = d_data->d_model.computeAbstractModelValue(b);
           // points we will add tangent planes for
-          std::vector<Node> pts[2];
-          pts[0].push_back(a_v_c);
-          pts[1].push_back(b_v_c);
+          r.d_points[0].push_back(r.d_aValue);
+          r.d_points[1].push_back(r.d_bValue);
           // if previously refined
-          bool prevRefine = d_tangent_val_bound[0][a].find(b)
-                            != d_tangent_val_bound[0][a].end();
+          r.d_previous = d_tangent_val_bound[0][a].find(b)
+                         != d_tangent_val_bound[0][a].end();
           // a_min, a_max, b_min, b_max
-          for (unsigned p = 0; p < 4; p++)
+          for (unsigned p = 0; r.d_previous && p < 4; p++)
           {
-            Node curr_v = p <= 1 ? a_v_c : b_v_c;
-            if (prevRefine)
+            Node curr_v = p <= 1 ? r.d_aValue : r.d_bValue;
+            Node pt_v = d_tangent_val_bound[p][a][b];
+            Assert(!pt_v.isNull());
+            if (curr_v != pt_v)
             {
-              Node pt_v = d_tangent_val_bound[p][a][b];
-              Assert(!pt_v.isNull());
-              if (curr_v != pt_v)
+              Node do_extend = nm->mkNode(
+                  (p == 1 || p == 3) ? Kind::GT : Kind::LT, curr_v, pt_v);
+              do_extend = rewrite(do_extend);
+              if (do_extend == d_data->d_true)
               {
-                Node do_extend = nm->mkNode(
-                    (p == 1 || p == 3) ? Kind::GT : Kind::LT, curr_v, pt_v);
-                do_extend = rewrite(do_extend);
-                if (do_extend == d_data->d_true)
+                for (unsigned q = 0; q < 2; q++)
                 {
-                  for (unsigned q = 0; q < 2; q++)
-                  {
-                    pts[p <= 1 ? 0 : 1].push_back(curr_v);
-                    pts[p <= 1 ? 1 : 0].push_back(
-                        d_tangent_val_bound[p <= 1 ? 2 + q : q][a][b]);
-                  }
+                  r.d_points[p <= 1 ? 0 : 1].push_back(curr_v);
+                  r.d_points[p <= 1 ? 1 : 0].push_back(
+                      d_tangent_val_bound[p <= 1 ? 2 + q : q][a][b]);
                 }
               }
             }
-            else
-            {
-              d_tangent_val_bound[p][a][b] = curr_v;
-            }
           }
-
-          for (unsigned p = 0; p < pts[0].size(); p++)
+          // the violation of the tangent plane at the current point
+          if (t_v.isConst() && r.d_aValue.isConst() && r.d_bValue.isConst())
           {
-            Node a_v = pts[0][p];
-            Node b_v = pts[1][p];
+            r.d_violation = (t_v.getConst<Rational>()
+                             - r.d_aValue.getConst<Rational>()
+                                   * r.d_bValue.getConst<Rational>())
+                                .abs();
+          }
+          refinements.emplace_back(std::move(r));
+        }
+      }
+    }
+  }
 
-            // tangent plane
-            Node tplane = nm->mkNode(Kind::SUB,
-                                     nm->mkNode(Kind::ADD,
-                                                nm->mkNode(Kind::MULT, b_v, a),
-                                                nm->mkNode(Kind::MULT, a_v, b)),
-                                     nm->mkNode(Kind::MULT, a_v, b_v));
-            // construct the following lemmas:
-            // t <= tplane  <=>  ((a <= a_v ^ b >= b_v) v (a >= a_v ^ b <= b_v))
-            // t >= tplane  <=>  ((a <= a_v ^ b <= b_v) v (a >= a_v ^ b >= b_v))
+  uint64_t limit = options().arith.nlExtLemmaLimit;
+  if (limit > 0 && refinements.size() > limit)
+  {
+    // Prefer products that were not refined before, then the ones with the
+    // largest violation. The others are refined in later rounds if they are
+    // still violated, hence their bounds are not recorded.
+    std::stable_sort(refinements.begin(),
+                     refinements.end(),
+                     [](const Refinement& x, const Refinement& y) {
+                       if (x.d_previous != y.d_previous)
+                       {
+                         return !x.d_previous;
+                       }
+                       return x.d_violation > y.d_violation;
+                     });
+    Trace("nl-ext-tplanes") << "Defer " << refinements.size() - limit
+                            << " tangent plane refinements" << std::endl;
+    refinements.resize(limit);
+  }
 
-            for (unsigned d = 0; d < 2; d++)
-            {
-              Node b1 = nm->mkNode(d == 0 ? Kind::GEQ : Kind::LEQ, b, b_v);
-              Node b2 = nm->mkNode(d == 0 ? Kind::LEQ : Kind::GEQ, b, b_v);
-              Node t2 = nm->mkNode(Kind::NONLINEAR_MULT, a, b);
-              Node tlem = nm->mkNode(
-                  Kind::EQUAL,
-                  nm->mkNode(d == 0 ? Kind::LEQ : Kind::GEQ, t2, tplane),
-                  nm->mkNode(
-                      Kind::OR,
-                      nm->mkNode(Kind::AND, nm->mkNode(Kind::LEQ, a, a_v), b1),
-                      nm->mkNode(
-                          Kind::AND, nm->mkNode(Kind::GEQ, a, a_v), b2)));
-              Trace("nl-ext-tplanes")
-                  << "Tangent plane lemma : " << tlem << std::endl;
-              CDProof* proof = nullptr;
-              if (d_data->isProofEnabled())
-              {
-                proof = d_data->getProof();
-                proof->addStep(tlem,
-                               ProofRule::ARITH_MULT_TANGENT,
-                               {},
-                               {a,
-                                b,
-                                a_v,
-                                b_v,
-                                nm->mkConst(d == 1)});
-              }
-              d_data->d_im.addPendingLemma(tlem,
-                                           InferenceId::ARITH_NL_TANGENT_PLANE,
-                                           proof,
-                                           asWaitingLemmas);
-            }
-          }
+  for (const Refinement& r : refinements)
+  {
+    const Node& a = r.d_a;
+    const Node& b = r.d_b;
+    if (!r.d_previous)
+    {
+      for (unsigned p = 0; p < 4; p++)
+      {
+        d_tangent_val_bound[p][a][b] = p <= 1 ? r.d_aValue : r.d_bValue;
+      }
+    }
+    for (unsigned p = 0; p < r.d_points[0].size(); p++)
+    {
+      Node a_v = r.d_points[0][p];
+      Node b_v = r.d_points[1][p];
+
+      // tangent plane
+      Node tplane = nm->mkNode(Kind::SUB,
+                               nm->mkNode(Kind::ADD,
+                                          nm->mkNode(Kind::MULT, b_v, a),
+                                          nm->mkNode(Kind::MULT, a_v, b)),
+                               nm->mkNode(Kind::MULT, a_v, b_v));
+      // construct the following lemmas:
+      // t <= tplane  <=>  ((a <= a_v ^ b >= b_v) v (a >= a_v ^ b <= b_v))
+      // t >= tplane  <=>  ((a <= a_v ^ b <= b_v) v (a >= a_v ^ b >= b_v))
+
+      for (unsigned d = 0; d < 2; d++)
+      {
+        Node b1 = nm->mkNode(d == 0 ? Kind::GEQ : Kind::LEQ, b, b_v);
+        Node b2 = nm->mkNode(d == 0 ? Kind::LEQ : Kind::GEQ, b, b_v);
+        Node t2 = nm->mkNode(Kind::NONLINEAR_MULT, a, b);
+        Node tlem = nm->mkNode(
+            Kind::EQUAL,
+            nm->mkNode(d == 0 ? Kind::LEQ : Kind::GEQ, t2, tplane),
+            nm->mkNode(
+                Kind::OR,
+                nm->mkNode(Kind::AND, nm->mkNode(Kind::LEQ, a, a_v), b1),
+                nm->mkNode(Kind::AND, nm->mkNode(Kind::GEQ, a, a_v), b2)));
+        Trace("nl-ext-tplanes")
+            << "Tangent plane lemma : " << tlem << std::endl;
+        CDProof* proof = nullptr;
+        if (d_data->isProofEnabled())
+        {
+          proof = d_data->getProof();
+          proof->addStep(tlem,
+                         ProofRule::ARITH_MULT_TANGENT,
+                         {},
+                         {a, b, a_v, b_v, nm->mkConst(d == 1)});
         }
+        d_data->d_im.addPendingLemma(tlem,
+                                     InferenceId::ARITH_NL_TANGENT_PLANE,
+                                     proof,
+                                     asWaitingLemmas);
       }
     }
   }
@@ -17,9 +17,11 @@
 #define CVC5__THEORY__ARITH__NL__EXT__TANGENT_PLANE_CHECK_H
 
 #include <map>
+#include <vector>
 
 #include "expr/node.h"
 #include "smt/env_obj.h"
+#include "util/rational.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -56,10 +58,30 @@ class TangentPlaneCheck : protected EnvObj
    *
    * ( ( x>2 ^ y>5) ^ (x<2 ^ y<5) ) => x*y > 5*x + 2*y - 10
    * ( ( x>2 ^ y<5) ^ (x<2 ^ y>5) ) => x*y < 5*x + 2*y - 10
+   *
+   * With --nl-ext-lemma-limit=K, only the products a*b of the K best
+   * refinements are refined, preferring products that were not refined
+   * before and then the ones whose tangent plane at the current point is
+   * violated the most.
    */
   void check(bool asWaitingLemmas);
 
  private:
+  /** The tangent planes to add for the decomposition a*b of a monomial. */
+  struct Refinement
+  {
+    Node d_a;
+    Node d_b;
+    /** The model values of a and b. */
+    Node d_aValue;
+    Node d_bValue;
+    /** The points (a_v, b_v) of the tangent planes. */
+    std::vector<Node> d_points[2];
+    /** Whether a*b was refined before. */
+    bool d_previous = false;
+    /** The difference of the model values of a*b and of a_v*b_v. */
+    Rational d_violation;
+  };
   /** Basic data that is shared with other checks */
   ExtState* d_data;
   /** tangent plane bounds */
@@ -17,12 +17,17 @@
 
 #ifdef CVC5_POLY_IMP
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <optional>
 
 #include "base/check.h"
 #include "base/output.h"
 #include "theory/arith/nl/icp/intersection.h"
 #include "theory/arith/nl/poly_conversion.h"
+#include "util/poly_util.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -30,11 +35,171 @@ namespace arith {
 namespace nl {
 namespace icp {
 
+namespace {
+
+constexpr double s_inf = std::numeric_limits<double>::infinity();
+
+/** A closed interval of doubles, that may have infinite bounds. */
+struct DoubleInterval
+{
+  double d_lower;
+  double d_upper;
+};
+
+double roundDown(double d) { return std::nextafter(d, -s_inf); }
+double roundUp(double d) { return std::nextafter(d, s_inf); }
+
+/**
+ * Enclose the given rational, where getDouble() truncates and is thus off by
+ * less than one ulp.
+ */
+DoubleInterval toDoubleInterval(const Rational& r)
+{
+  double d = r.getDouble();
+  if (Rational::fromDouble(d) == r)
+  {
+    return {d, d};
+  }
+  return {roundDown(d), roundUp(d)};
+}
+
+/** Enclose the interval of a variable, or return the whole real line. */
+DoubleInterval toDoubleInterval(const poly::IntervalAssignment& ia,
+                                const poly::Variable& v)
+{
+  DoubleInterval res{-s_inf, s_inf};
+  if (!ia.has(v))
+  {
+    return res;
+  }
+  const poly::Interval& i = ia.get(v);
+  if (!is_minus_infinity(get_lower(i)))
+  {
+    res.d_lower = toDoubleInterval(poly_utils::toRationalBelow(get_lower(i)))
+                      .d_lower;
+  }
+  if (!is_plus_infinity(get_upper(i)))
+  {
+    res.d_upper = toDoubleInterval(poly_utils::toRationalAbove(get_upper(i)))
+                      .d_upper;
+  }
+  return res;
+}
+
+DoubleInterval operator+(const DoubleInterval& a, const DoubleInterval& b)
+{
+  return {roundDown(a.d_lower + b.d_lower), roundUp(a.d_upper + b.d_upper)};
+}
+
+DoubleInterval operator*(const DoubleInterval& a, const DoubleInterval& b)
+{
+  double p[] = {a.d_lower * b.d_lower,
+                a.d_lower * b.d_upper,
+                a.d_upper * b.d_lower,
+                a.d_upper * b.d_upper};
+  return {roundDown(*std::min_element(p, p + 4)),
+          roundUp(*std::max_element(p, p + 4))};
+}
+
+/** Data for the traversal in evaluateApproximately(). */
+struct ApproximateEvaluation
+{
+  const poly::IntervalAssignment& d_ia;
+  DoubleInterval d_result{0, 0};
+};
+
+/**
+ * Evaluate p over ia with outward rounded double intervals. Returns an
+ * enclosure of the exact result, or std::nullopt if the enclosure is not
+ * defined (infinite bounds multiplied by zero or cancelling out).
+ */
+std::optional<DoubleInterval> evaluateApproximately(
+    const poly::Polynomial& p, const poly::IntervalAssignment& ia)
+{
+  ApproximateEvaluation eval{ia};
+  lp_polynomial_traverse_f f =
+      [](const lp_polynomial_context_t* ctx, lp_monomial_t* m, void* data) {
+        ApproximateEvaluation* e = static_cast<ApproximateEvaluation*>(data);
+        DoubleInterval term =
+            toDoubleInterval(poly_utils::toRational(poly::Integer(&m->a)));
+        for (std::size_t i = 0; i < m->n; ++i)
+        {
+          DoubleInterval var = toDoubleInterval(e->d_ia, m->p[i].x);
+          for (std::size_t j = 0; j < m->p[i].d; ++j)
+          {
+            term = term * var;
+          }
+        }
+        e->d_result = e->d_result + term;
+      };
+  lp_polynomial_traverse(p.get_internal(), f, &eval);
+  if (std::isnan(eval.d_result.d_lower) || std::isnan(eval.d_result.d_upper))
+  {
+    return std::nullopt;
+  }
+  return eval.d_result;
+}
+
+/**
+ * Convert a bound of an enclosure to a value, rounding it outward to single
+ * precision to keep the bit size of the resulting dyadic rational small.
+ */
+poly::Value toValue(double d, bool upper)
+{
+  float f = static_cast<float>(d);
+  if (upper && f < d)
+  {
+    f = std::nextafter(f, std::numeric_limits<float>::infinity());
+  }
+  else if (!upper && f > d)
+  {
+    f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+  }
+  if (std::isinf(f))
+  {
+    return upper ? poly::Value::plus_infty() : poly::Value::minus_infty();
+  }
+  return poly::Value(poly_utils::toRational(*Rational::fromDouble(f)));
+}
+
+}  // namespace
+
 PropagationResult Candidate::propagate(poly::IntervalAssignment& ia,
-                                       std::size_t size_threshold) const
+                                       std::size_t size_threshold,
+                                       bool approximate) const
 {
+  if (approximate)
+  {
+    std::optional<DoubleInterval> enclosure = evaluateApproximately(rhs, ia);
+    if (enclosure)
+    {
+      DoubleInterval res = *enclosure
+                           * toDoubleInterval(poly_utils::toRational(rhsmult));
+      if (!std::isnan(res.d_lower) && !std::isnan(res.d_upper))
+      {
+        PropagationResult result =
+            contractWith(ia,
+                         size_threshold,
+                         poly::Interval(toValue(res.d_lower, false),
+                                        false,
+                                        toValue(res.d_upper, true),
+                                        false));
+        if (result != PropagationResult::NOT_CHANGED)
+        {
+          return result;
+        }
+      }
+    }
+  }
   // Evaluate the right hand side
   auto res = poly::evaluate(rhs, ia) * poly::Interval(poly::Value(rhsmult));
+  return contractWith(ia, size_threshold, res);
+}
+
+PropagationResult Candidate::contractWith(poly::IntervalAssignment& ia,
+                                          std::size_t size_threshold,
+                                          poly::Interval res) const
+{
   if (get_lower(res) == poly::Value::minus_infty()
       && get_upper(res) == poly::Value::plus_infty())
   {
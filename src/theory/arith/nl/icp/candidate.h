@@ -67,9 +67,21 @@ struct Candidate
    * Contract the interval assignment based on this candidate.
    * Only contract if the new interval is below the given threshold, see
    * intersect_interval_with().
+   * If approximate is true, rhsmult*rhs is first evaluated with outward
+   * rounded double intervals, and the exact evaluation is only done if this
+   * enclosure does not change the interval of lhs.
    */
   PropagationResult propagate(poly::IntervalAssignment& ia,
-                              std::size_t size_threshold) const;
+                              std::size_t size_threshold,
+                              bool approximate = false) const;
+
+ private:
+  /**
+   * Contract the interval assignment given an enclosure res of rhsmult*rhs.
+   */
+  PropagationResult contractWith(poly::IntervalAssignment& ia,
+                                 std::size_t size_threshold,
+                                 poly::Interval res) const;
 };
 
 /** Print a candidate. */
@@ -20,6 +20,7 @@
 #include "base/check.h"
 #include "base/output.h"
 #include "expr/node_algorithm.h"
+#include "options/arith_options.h"
 #include "theory/arith/arith_msum.h"
 #include "theory/arith/inference_manager.h"
 #include "theory/arith/nl/poly_conversion.h"
@@ -223,7 +224,8 @@ PropagationResult ICPSolver::doPropagationRound()
   for (const auto& c : d_state.d_candidates)
   {
     --d_budget;
-    PropagationResult cres = c.propagate(d_state.d_assignment, 100);
+    PropagationResult cres =
+        c.propagate(d_state.d_assignment, 100, options().arith.nlICPApprox);
     switch (cres)
     {
       case PropagationResult::NOT_CHANGED: break;
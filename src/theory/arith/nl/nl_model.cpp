@@ -15,6 +15,9 @@
 
 #include "theory/arith/nl/nl_model.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "expr/node_algorithm.h"
 #include "options/arith_options.h"
 #include "options/smt_options.h"
@@ -45,11 +48,109 @@ NlModel::~NlModel() {}
 
 void NlModel::reset(const std::map<Node, Node>& arithModel)
 {
-  d_concreteModelCache.clear();
-  d_abstractModelCache.clear();
+  if (options().arith.nlModelIncremental)
+  {
+    invalidateModelCaches(arithModel);
+  }
+  else
+  {
+    d_concreteModelCache.clear();
+    d_abstractModelCache.clear();
+  }
   d_arithVal = arithModel;
 }
 
+void NlModel::invalidateModelCaches(const std::map<Node, Node>& arithModel)
+{
+  // Collect the terms whose value differs between d_arithVal and arithModel,
+  // including those assigned in only one of them. Both maps use the same
+  // order, hence we can merge them.
+  std::unordered_set<TNode> changed;
+  auto it = d_arithVal.begin();
+  auto itn = arithModel.begin();
+  while (it != d_arithVal.end() || itn != arithModel.end())
+  {
+    if (itn == arithModel.end()
+        || (it != d_arithVal.end() && it->first < itn->first))
+    {
+      changed.insert(it->first);
+      ++it;
+    }
+    else if (it == d_arithVal.end() || itn->first < it->first)
+    {
+      changed.insert(itn->first);
+      ++itn;
+    }
+    else
+    {
+      if (it->second != itn->second)
+      {
+        changed.insert(it->first);
+      }
+      ++it;
+      ++itn;
+    }
+  }
+  if (changed.empty())
+  {
+    Trace("nl-ext-mv") << "NlModel::reset: model unchanged" << std::endl;
+    return;
+  }
+  // The model value of a term only depends on the values in d_arithVal of
+  // itself and its subterms. We erase all cached values of terms that have a
+  // subterm in changed. The erased terms are kept alive until we are done,
+  // since their subterms may be shared with other cached terms.
+  std::vector<Node> erased;
+  std::unordered_map<TNode, bool> invalid;
+  std::vector<TNode> visit;
+  for (auto* cache : {&d_concreteModelCache, &d_abstractModelCache})
+  {
+    size_t prevSize = cache->size();
+    for (auto itc = cache->begin(); itc != cache->end();)
+    {
+      visit.push_back(itc->first);
+      do
+      {
+        TNode cur = visit.back();
+        auto itv = invalid.find(cur);
+        if (itv == invalid.end())
+        {
+          invalid.emplace(cur, false);
+          if (changed.find(cur) != changed.end())
+          {
+            invalid[cur] = true;
+            visit.pop_back();
+          }
+          else
+          {
+            visit.insert(visit.end(), cur.begin(), cur.end());
+          }
+          continue;
+        }
+        visit.pop_back();
+        if (!itv->second)
+        {
+          bool inv = std::any_of(cur.begin(), cur.end(), [&](TNode c) {
+            return invalid[c];
+          });
+          itv->second = inv;
+        }
+      } while (!visit.empty());
+      if (invalid[itc->first])
+      {
+        erased.push_back(itc->first);
+        itc = cache->erase(itc);
+      }
+      else
+      {
+        ++itc;
+      }
+    }
+    Trace("nl-ext-mv") << "NlModel::reset: keep " << cache->size() << " / "
+                       << prevSize << " cached model values" << std::endl;
+  }
+}
+
 void NlModel::resetCheck()
 {
   d_used_approx = false;
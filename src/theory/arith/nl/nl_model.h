@@ -180,6 +180,11 @@ class NlModel : protected EnvObj
   Node getSubstitutedForm(TNode s) const;
 
  private:
+  /**
+   * Erase from the model value caches the values of terms that depend on a
+   * term whose value in arithModel differs from its value in d_arithVal.
+   */
+  void invalidateModelCaches(const std::map<Node, Node>& arithModel);
   /** Cache for concrete model values */
   std::map<Node, Node> d_concreteModelCache;
   /** Cache for abstract model values */
@@ -15,9 +15,10 @@
 
 #include "theory/arith/nl/transcendental/taylor_generator.h"
 
+#include <mutex>
+
 #include "theory/arith/arith_utilities.h"
 #include "theory/arith/nl/nl_model.h"
-#include "theory/evaluator.h"
 #include "theory/rewriter.h"
 
 using namespace cvc5::internal::kind;
@@ -28,6 +29,90 @@ namespace arith {
 namespace nl {
 namespace transcendental {
 
+namespace {
+
+/**
+ * The rational coefficients of the Taylor series computed by
+ * TaylorGenerator::getTaylor() for some kind and degree n: the value of the
+ * series at x is sum_i d_coeffs[i] * x^i, the value of the remainder is
+ * d_remainder * x^n.
+ */
+struct TaylorCoefficients
+{
+  std::vector<Rational> d_coeffs;
+  Rational d_remainder;
+  /** n, the exponent of x in the remainder */
+  std::uint64_t d_degree;
+
+  /** Evaluate the Taylor series at c. */
+  Rational evaluate(const Rational& c) const
+  {
+    Rational res(0);
+    for (size_t i = d_coeffs.size(); i > 0; --i)
+    {
+      res = res * c + d_coeffs[i - 1];
+    }
+    return res;
+  }
+  /** Evaluate the Taylor remainder at c. */
+  Rational evaluateRemainder(const Rational& c) const
+  {
+    Rational res = d_remainder;
+    for (std::uint64_t i = 0; i < d_degree; ++i)
+    {
+      res *= c;
+    }
+    return res;
+  }
+};
+
+/**
+ * Get the coefficients of the Taylor series of degree n for k. Unlike the
+ * nodes cached by TaylorGenerator, these do not depend on a node manager and
+ * are hence computed once per process and shared by all solver instances.
+ * The returned reference remains valid, since entries are never erased.
+ */
+const TaylorCoefficients& getTaylorCoefficients(Kind k, std::uint64_t n)
+{
+  static std::mutex s_mutex;
+  static std::map<std::pair<Kind, std::uint64_t>, TaylorCoefficients> s_cache;
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = s_cache.find({k, n});
+  if (it != s_cache.end())
+  {
+    return it->second;
+  }
+  TaylorCoefficients& tc = s_cache[{k, n}];
+  tc.d_degree = n;
+  // mirrors the construction of getTaylor()
+  Integer factorial = 1;
+  for (std::uint64_t counter = 1; counter <= n; ++counter)
+  {
+    if (k == Kind::EXPONENTIAL)
+    {
+      tc.d_coeffs.push_back(Rational(Integer(1), factorial));
+    }
+    else
+    {
+      Assert(k == Kind::SINE);
+      if (counter % 2 == 0)
+      {
+        int sign = (counter % 4 == 0 ? -1 : 1);
+        tc.d_coeffs.push_back(Rational(Integer(sign), factorial));
+      }
+      else
+      {
+        tc.d_coeffs.push_back(Rational(0));
+      }
+    }
+    factorial *= counter;
+  }
+  tc.d_remainder = Rational(Integer(1), factorial);
+  return tc;
+}
+
+}  // namespace
+
 TaylorGenerator::TaylorGenerator(NodeManager* nm)
     : d_taylor_real_fv(NodeManager::mkBoundVar("x", nm->realType())), d_nm(nm)
 {
@@ -144,26 +229,7 @@ std::uint64_t TaylorGenerator::getPolynomialApproximationBoundForArg(
   Assert(c.isConst());
   if (k == Kind::EXPONENTIAL && c.getConst<Rational>().sgn() == 1)
   {
-    bool success = false;
-    std::uint64_t ds = d;
-    TNode ttrf = getTaylorVariable();
-    TNode tc = c;
-    Evaluator eval(nullptr);
-    do
-    {
-      success = true;
-      std::uint64_t n = 2 * ds;
-      std::pair<Node, Node> taylor = getTaylor(k, n);
-      // check that 1-c^{n+1}/(n+1)! > 0
-      Node ru = taylor.second;
-      Node rus = eval.eval(ru, {ttrf}, {tc});
-      Assert(rus.isConst());
-      if (rus.getConst<Rational>() > 1)
-      {
-        success = false;
-        ds = ds + 1;
-      }
-    } while (!success);
+    std::uint64_t ds = getExpUpperPosDegree(c.getConst<Rational>(), d);
     if (ds > d)
     {
       Trace("nl-ext-exp-taylor")
@@ -202,37 +268,53 @@ std::pair<Node, Node> TaylorGenerator::getTfModelBounds(Node tf,
   }
   bool isNeg = csign == -1;
 
-  ApproximationBounds pbounds;
-  getPolynomialApproximationBoundForArg(k, c, d, pbounds);
-
-  std::vector<Node> bounds;
-  TNode tfv = getTaylorVariable();
-  TNode tfs = tf[0];
-  Evaluator eval(nullptr);
-  for (unsigned d2 = 0; d2 < 2; d2++)
+  // We evaluate the bounds of getPolynomialApproximationBoundForArg() at the
+  // model value of the argument M_A(tf[0]) directly on the (shared) rational
+  // coefficients of the Taylor series, which avoids constructing and
+  // evaluating the polynomials as nodes.
+  const Rational& cr = c.getConst<Rational>();
+  const TaylorCoefficients& tc = getTaylorCoefficients(k, 2 * d);
+  Rational p = tc.evaluate(cr);
+  Rational r = tc.evaluateRemainder(cr);
+  Rational lower, upper;
+  if (k == Kind::EXPONENTIAL)
   {
-    Node pab = (d2 == 0 ? pbounds.d_lower
-                        : (isNeg ? pbounds.d_upperNeg : pbounds.d_upperPos));
-    if (!pab.isNull())
+    lower = p;
+    if (isNeg)
     {
-      // { x -> M_A(tf[0]) }
-      // Notice that we compute the model value of tfs first, so that
-      // the call to rewrite below does not modify the term, where notice that
-      // rewrite( x*x { x -> M_A(t) } ) = M_A(t)*M_A(t)
-      // is not equal to
-      // M_A( x*x { x -> t } ) = M_A( t*t )
-      // where M_A denotes the abstract model.
-      Node mtfs = model.computeAbstractModelValue(tfs);
-      pab = eval.eval(pab, {tfv}, {mtfs});
-      Assert(pab.isConst());
-      bounds.push_back(pab);
+      upper = p + r;
     }
     else
     {
-      bounds.push_back(Node::null());
+      // must use sound upper bound
+      std::uint64_t ds = getExpUpperPosDegree(cr, d);
+      const TaylorCoefficients& tcs = getTaylorCoefficients(k, 2 * ds);
+      Rational den = Rational(1) - tcs.evaluateRemainder(cr);
+      Assert(!den.isZero());
+      upper = tcs.evaluate(cr) / den;
     }
   }
-  return std::pair<Node, Node>(bounds[0], bounds[1]);
+  else
+  {
+    Assert(k == Kind::SINE);
+    lower = p - r;
+    upper = p + r;
+  }
+  return std::pair<Node, Node>(d_nm->mkConstReal(lower),
+                               d_nm->mkConstReal(upper));
+}
+
+std::uint64_t TaylorGenerator::getExpUpperPosDegree(const Rational& c,
+                                                    std::uint64_t d)
+{
+  std::uint64_t ds = d;
+  // check that 1-c^{n+1}/(n+1)! > 0
+  while (getTaylorCoefficients(Kind::EXPONENTIAL, 2 * ds).evaluateRemainder(c)
+         > 1)
+  {
+    ds = ds + 1;
+  }
+  return ds;
 }
 
 }  // namespace transcendental
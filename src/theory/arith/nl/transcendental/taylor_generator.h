@@ -19,6 +19,7 @@
 #include <cstdint>
 
 #include "expr/node.h"
+#include "util/rational.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -106,6 +107,12 @@ class TaylorGenerator
                                          NlModel& model);
 
  private:
+  /**
+   * Return the minimum degree d' >= d such that the upper bound for positive
+   * values of the exponential of degree 2*d' is sound for argument c > 0.
+   */
+  std::uint64_t getExpUpperPosDegree(const Rational& c, std::uint64_t d);
+
   const Node d_taylor_real_fv;
 
   /** the associated node manager */
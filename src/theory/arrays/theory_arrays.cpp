@@ -59,7 +59,11 @@ TheoryArrays::TheoryArrays(Env& env,
                            std::string name)
     : Theory(THEORY_ARRAYS, env, out, valuation, name),
       d_numRow(statisticsRegistry().registerInt(name + "number of Row lemmas")),
+      d_numRowSuppressed(statisticsRegistry().registerInt(
+          name + "number of suppressed Row lemmas")),
       d_numExt(statisticsRegistry().registerInt(name + "number of Ext lemmas")),
+      d_numWeakEquiv(statisticsRegistry().registerInt(
+          name + "number of weak equivalence lemmas")),
       d_numProp(
           statisticsRegistry().registerInt(name + "number of propagations")),
       d_numExplain(
@@ -92,6 +96,7 @@ TheoryArrays::TheoryArrays(Env& env,
       d_mergeInProgress(false),
       d_RowQueue(context()),
       d_RowAlreadyAdded(userContext()),
+      d_RowQueued(context()),
       d_sharedArrays(context()),
       d_sharedOther(context()),
       d_sharedTerms(context(), false),
@@ -480,10 +485,15 @@ void TheoryArrays::visitAllLeaves(TNode reason, vector<TNode>& conjunctions) {
   }
 }
 
-void TheoryArrays::weakEquivBuildCond(TNode node, TNode index, vector<TNode>& conjunctions) {
+void TheoryArrays::weakEquivBuildCond(TNode node,
+                                      TNode index,
+                                      vector<TNode>& conjunctions,
+                                      TNode stop)
+{
   Assert(!index.isNull());
   TNode pointer, index2;
-  while (true) {
+  while (node != stop)
+  {
     pointer = d_infoMap.getWeakEquivPointer(node);
     if (pointer.isNull()) {
       return;
@@ -515,6 +525,56 @@ void TheoryArrays::weakEquivBuildCond(TNode node, TNode index, vector<TNode>& co
   }
 }
 
+TNode TheoryArrays::weakEquivGetMeetIndex(TNode a, TNode b, TNode index)
+{
+  Assert(!index.isNull());
+  // collect the path of a, which follows the same steps as weakEquivGetRepIndex
+  std::unordered_set<TNode> path;
+  TNode node = a;
+  TNode pointer, index2;
+  while (true)
+  {
+    path.insert(node);
+    pointer = d_infoMap.getWeakEquivPointer(node);
+    if (pointer.isNull())
+    {
+      break;
+    }
+    index2 = d_infoMap.getWeakEquivIndex(node);
+    if (index2.isNull() || !d_equalityEngine->areEqual(index, index2))
+    {
+      node = pointer;
+    }
+    else
+    {
+      TNode secondary = d_infoMap.getWeakEquivSecondary(node);
+      if (secondary.isNull())
+      {
+        break;
+      }
+      node = secondary;
+    }
+  }
+  // walk the path of b until it reaches a node on the path of a
+  node = b;
+  while (path.find(node) == path.end())
+  {
+    pointer = d_infoMap.getWeakEquivPointer(node);
+    Assert(!pointer.isNull());
+    index2 = d_infoMap.getWeakEquivIndex(node);
+    if (index2.isNull() || !d_equalityEngine->areEqual(index, index2))
+    {
+      node = pointer;
+    }
+    else
+    {
+      node = d_infoMap.getWeakEquivSecondary(node);
+      Assert(!node.isNull());
+    }
+  }
+  return node;
+}
+
 void TheoryArrays::weakEquivMakeRep(TNode node) {
   TNode pointer = d_infoMap.getWeakEquivPointer(node);
   if (pointer.isNull()) {
@@ -1286,14 +1346,17 @@ void TheoryArrays::postCheck(Effort level)
           if (r[1] != r2[1]) {
             d_equalityEngine->explainEquality(r[1], r2[1], true, conjunctions);
           }
-          // TODO: get smaller lemmas by eliminating shared parts of path
-          weakEquivBuildCond(r[0], r[1], conjunctions);
-          weakEquivBuildCond(r2[0], r[1], conjunctions);
+          // only the parts of the paths up to the node where they meet are
+          // relevant, which gives smaller lemmas
+          TNode meet = weakEquivGetMeetIndex(r[0], r2[0], r[1]);
+          weakEquivBuildCond(r[0], r[1], conjunctions, meet);
+          weakEquivBuildCond(r2[0], r[1], conjunctions, meet);
           lemma = mkAnd(conjunctions, true);
-          // LSH FIXME: which kind of arrays lemma is this
           Trace("arrays-lem")
               << "Arrays::addExtLemma (weak-eq) " << lemma << "\n";
-          d_out->lemma(lemma, InferenceId::NONE, LemmaProperty::SEND_ATOMS);
+          ++d_numWeakEquiv;
+          d_out->lemma(
+              lemma, InferenceId::ARRAYS_WEAK_EQUIV, LemmaProperty::SEND_ATOMS);
           d_readTableContext->pop();
           Trace("arrays") << spaces(context()->getLevel())
                           << "Arrays::check(): done" << endl;
@@ -1893,6 +1956,13 @@ void TheoryArrays::queueRowLemma(RowLemmaType lem)
     propagateRowLemma(lem);
   }
 
+  // Skip the lemma if an equivalent lemma was already queued in this context
+  if (!d_RowQueued.insert(getRowLemmaKey(lem)))
+  {
+    ++d_numRowSuppressed;
+    return;
+  }
+
   // Prefer equality between indexes so as not to introduce new read terms
   if (options().arrays.arraysEagerIndexSplitting && !bothExist
       && !d_equalityEngine->areDisequal(i, j, false))
@@ -2007,6 +2077,8 @@ bool TheoryArrays::dischargeLemmas()
 {
   bool reduceSharing = options().arrays.arraysReduceSharing;
   bool lemmasAdded = false;
+  bool relevant;
+  std::vector<RowLemmaType> deferred;
 
   for (size_t count = 0, sz = d_RowQueue.size(); count < sz; ++count)
   {
@@ -2015,119 +2087,177 @@ bool TheoryArrays::dischargeLemmas()
     if (d_RowAlreadyAdded.contains(l)) {
       continue;
     }
-
-    TNode a, b, i, j;
-    std::tie(a, b, i, j) = l;
-    Assert(a.getType().isArray() && b.getType().isArray());
-
-    NodeManager* nm = nodeManager();
-    Node aj = nm->mkNode(Kind::SELECT, a, j);
-    Node bj = nm->mkNode(Kind::SELECT, b, j);
-    bool ajExists = d_equalityEngine->hasTerm(aj);
-    bool bjExists = d_equalityEngine->hasTerm(bj);
-
-    // Check for redundant lemma
-    // TODO: more checks possible (i.e. check d_RowAlreadyAdded in context)
-    if (!d_equalityEngine->hasTerm(i) || !d_equalityEngine->hasTerm(j)
-        || d_equalityEngine->areEqual(i, j) || !d_equalityEngine->hasTerm(a)
-        || !d_equalityEngine->hasTerm(b) || d_equalityEngine->areEqual(a, b)
-        || (ajExists && bjExists && d_equalityEngine->areEqual(aj, bj)))
+    relevant = true;
+    if (dischargeLemma(l, true, relevant))
     {
-      continue;
-    }
-
-    int64_t prop = options().arrays.arraysPropagate;
-    if (prop > 0) {
-      propagateRowLemma(l);
-      if (d_state.isInConflict())
+      lemmasAdded = true;
+      if (reduceSharing)
       {
-        return true;
+        break;
       }
     }
-
-    // Make sure that any terms introduced by rewriting are appropriately stored in the equality database
-    Node aj2 = rewrite(aj);
-    if (aj != aj2) {
-      if (!ajExists) {
-        preRegisterTermInternal(aj);
-      }
-      if (!d_equalityEngine->hasTerm(aj2))
-      {
-        preRegisterTermInternal(aj2);
-      }
-      d_im.assertInference(aj.eqNode(aj2),
-                           true,
-                           InferenceId::ARRAYS_EQ_TAUTOLOGY,
-                           d_true,
-                           ProofRule::MACRO_SR_PRED_INTRO);
+    else if (!relevant)
+    {
+      deferred.push_back(l);
     }
-    Node bj2 = rewrite(bj);
-    if (bj != bj2) {
-      if (!bjExists) {
-        preRegisterTermInternal(bj);
-      }
-      if (!d_equalityEngine->hasTerm(bj2))
-      {
-        preRegisterTermInternal(bj2);
-      }
-      d_im.assertInference(bj.eqNode(bj2),
-                           true,
-                           InferenceId::ARRAYS_EQ_TAUTOLOGY,
-                           d_true,
-                           ProofRule::MACRO_SR_PRED_INTRO);
+    if (d_state.isInConflict())
+    {
+      return true;
     }
-    if (aj2 == bj2) {
-      continue;
+  }
+  if (lemmasAdded)
+  {
+    // keep the lemmas that are not relevant yet for later rounds
+    for (const RowLemmaType& l : deferred)
+    {
+      d_RowQueue.push(l);
     }
-
-    // construct lemma
-    Node eq1 = aj2.eqNode(bj2);
-    Node eq1_r = rewrite(eq1);
-    if (eq1_r == d_true) {
-      if (!d_equalityEngine->hasTerm(aj2))
-      {
-        preRegisterTermInternal(aj2);
-      }
-      if (!d_equalityEngine->hasTerm(bj2))
+    return true;
+  }
+  for (const RowLemmaType& l : deferred)
+  {
+    if (dischargeLemma(l, false, relevant))
+    {
+      lemmasAdded = true;
+      if (reduceSharing)
       {
-        preRegisterTermInternal(bj2);
+        return true;
       }
-      d_im.assertInference(eq1,
-                           true,
-                           InferenceId::ARRAYS_EQ_TAUTOLOGY,
-                           d_true,
-                           ProofRule::MACRO_SR_PRED_INTRO);
-      continue;
     }
+    if (d_state.isInConflict())
+    {
+      return true;
+    }
+  }
+  return lemmasAdded;
+}
 
-    Node eq2 = i.eqNode(j);
-    Node eq2_r = rewrite(eq2);
-    if (eq2_r == d_true) {
-      d_im.assertInference(eq2,
-                           true,
-                           InferenceId::ARRAYS_EQ_TAUTOLOGY,
-                           d_true,
-                           ProofRule::MACRO_SR_PRED_INTRO);
-      continue;
+bool TheoryArrays::dischargeLemma(const RowLemmaType& l,
+                                  bool relevantOnly,
+                                  bool& relevant)
+{
+  TNode a, b, i, j;
+  std::tie(a, b, i, j) = l;
+  Assert(a.getType().isArray() && b.getType().isArray());
+
+  NodeManager* nm = nodeManager();
+  Node aj = nm->mkNode(Kind::SELECT, a, j);
+  Node bj = nm->mkNode(Kind::SELECT, b, j);
+  bool ajExists = d_equalityEngine->hasTerm(aj);
+  bool bjExists = d_equalityEngine->hasTerm(bj);
+
+  // Check for redundant lemma
+  // TODO: more checks possible (i.e. check d_RowAlreadyAdded in context)
+  if (!d_equalityEngine->hasTerm(i) || !d_equalityEngine->hasTerm(j)
+      || d_equalityEngine->areEqual(i, j) || !d_equalityEngine->hasTerm(a)
+      || !d_equalityEngine->hasTerm(b) || d_equalityEngine->areEqual(a, b)
+      || (ajExists && bjExists && d_equalityEngine->areEqual(aj, bj)))
+  {
+    return false;
+  }
+
+  int64_t prop = options().arrays.arraysPropagate;
+  if (prop > 0) {
+    propagateRowLemma(l);
+    if (d_state.isInConflict())
+    {
+      return false;
     }
+  }
 
-    Node lem = nm->mkNode(Kind::OR, eq2_r, eq1_r);
+  // Make sure that any terms introduced by rewriting are appropriately stored in the equality database
+  Node aj2 = rewrite(aj);
+  if (aj != aj2) {
+    if (!ajExists) {
+      preRegisterTermInternal(aj);
+    }
+    if (!d_equalityEngine->hasTerm(aj2))
+    {
+      preRegisterTermInternal(aj2);
+    }
+    d_im.assertInference(aj.eqNode(aj2),
+                         true,
+                         InferenceId::ARRAYS_EQ_TAUTOLOGY,
+                         d_true,
+                         ProofRule::MACRO_SR_PRED_INTRO);
+  }
+  Node bj2 = rewrite(bj);
+  if (bj != bj2) {
+    if (!bjExists) {
+      preRegisterTermInternal(bj);
+    }
+    if (!d_equalityEngine->hasTerm(bj2))
+    {
+      preRegisterTermInternal(bj2);
+    }
+    d_im.assertInference(bj.eqNode(bj2),
+                         true,
+                         InferenceId::ARRAYS_EQ_TAUTOLOGY,
+                         d_true,
+                         ProofRule::MACRO_SR_PRED_INTRO);
+  }
+  if (aj2 == bj2) {
+    return false;
+  }
 
-    Trace("arrays-lem") << "Arrays::addRowLemma (2) adding " << lem << "\n";
-    d_RowAlreadyAdded.insert(l);
-    // use non-rewritten nodes, theory preprocessing will rewrite
-    d_im.arrayLemma(aj.eqNode(bj),
-                    InferenceId::ARRAYS_READ_OVER_WRITE,
-                    eq2.notNode(),
-                    ProofRule::ARRAYS_READ_OVER_WRITE);
-    ++d_numRow;
-    lemmasAdded = true;
-    if (reduceSharing)
+  // construct lemma
+  Node eq1 = aj2.eqNode(bj2);
+  Node eq1_r = rewrite(eq1);
+  if (eq1_r == d_true) {
+    if (!d_equalityEngine->hasTerm(aj2))
     {
-      return true;
+      preRegisterTermInternal(aj2);
+    }
+    if (!d_equalityEngine->hasTerm(bj2))
+    {
+      preRegisterTermInternal(bj2);
     }
+    d_im.assertInference(eq1,
+                         true,
+                         InferenceId::ARRAYS_EQ_TAUTOLOGY,
+                         d_true,
+                         ProofRule::MACRO_SR_PRED_INTRO);
+    return false;
   }
-  return lemmasAdded;
+
+  Node eq2 = i.eqNode(j);
+  Node eq2_r = rewrite(eq2);
+  if (eq2_r == d_true) {
+    d_im.assertInference(eq2,
+                         true,
+                         InferenceId::ARRAYS_EQ_TAUTOLOGY,
+                         d_true,
+                         ProofRule::MACRO_SR_PRED_INTRO);
+    return false;
+  }
+
+  Node lem = nm->mkNode(Kind::OR, eq2_r, eq1_r);
+
+  Trace("arrays-lem") << "Arrays::addRowLemma (2) adding " << lem << "\n";
+  d_RowAlreadyAdded.insert(l);
+  // use non-rewritten nodes, theory preprocessing will rewrite
+  d_im.arrayLemma(aj.eqNode(bj),
+                  InferenceId::ARRAYS_READ_OVER_WRITE,
+                  eq2.notNode(),
+                  ProofRule::ARRAYS_READ_OVER_WRITE);
+  ++d_numRow;
+  return true;
+}
+
+TheoryArrays::RowLemmaType TheoryArrays::getRowLemmaKey(
+    const RowLemmaType& lem)
+{
+  TNode a, b, i, j;
+  std::tie(a, b, i, j) = lem;
+  a = d_equalityEngine->getRepresentative(a);
+  b = d_equalityEngine->getRepresentative(b);
+  if (b < a)
+  {
+    std::swap(a, b);
+  }
+  i = d_equalityEngine->getRepresentative(i);
+  j = d_equalityEngine->getRepresentative(j);
+  return RowLemmaType(a, b, i, j);
 }
 
 void TheoryArrays::conflict(TNode a, TNode b) {
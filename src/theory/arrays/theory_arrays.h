@@ -112,8 +112,12 @@ class TheoryArrays : public Theory {
 
   /** number of Row lemmas */
   IntStat d_numRow;
+  /** number of Row lemmas suppressed as duplicates modulo equality */
+  IntStat d_numRowSuppressed;
   /** number of Ext lemmas */
   IntStat d_numExt;
+  /** number of weak equivalence lemmas */
+  IntStat d_numWeakEquiv;
   /** number of propagations */
   IntStat d_numProp;
   /** number of explanations */
@@ -282,7 +286,22 @@ class TheoryArrays : public Theory {
   TNode weakEquivGetRep(TNode node);
   TNode weakEquivGetRepIndex(TNode node, TNode index);
   void visitAllLeaves(TNode reason, std::vector<TNode>& conjunctions);
-  void weakEquivBuildCond(TNode node, TNode index, std::vector<TNode>& conjunctions);
+  /**
+   * Add to conjunctions the conditions under which node is weakly equivalent
+   * on index to the node reached by following the weak equivalence path of
+   * node on index up to stop, or up to its representative if stop is null.
+   */
+  void weakEquivBuildCond(TNode node,
+                          TNode index,
+                          std::vector<TNode>& conjunctions,
+                          TNode stop = TNode());
+  /**
+   * Get the first node on the weak equivalence path of b on index that also
+   * is on the path of a. Both nodes must have the same representative for
+   * index. The conditions from this node to the representative are shared by
+   * both paths and do not need to be part of a lemma.
+   */
+  TNode weakEquivGetMeetIndex(TNode a, TNode b, TNode index);
   void weakEquivMakeRep(TNode node);
   void weakEquivMakeRepIndex(TNode node);
   void weakEquivAddSecondary(TNode index, TNode arrayFrom, TNode arrayTo, TNode reason);
@@ -371,6 +390,14 @@ class TheoryArrays : public Theory {
 
   context::CDQueue<RowLemmaType> d_RowQueue;
   context::CDHashSet<RowLemmaType, RowLemmaTypeHashFunction> d_RowAlreadyAdded;
+  /**
+   * The Row lemmas queued in the current context, where the arrays and
+   * indices are replaced by their representatives at the time the lemma was
+   * queued (see getRowLemmaKey). A lemma whose key is in this set is
+   * equivalent to an already queued lemma modulo the current equalities and
+   * is not queued again.
+   */
+  context::CDHashSet<RowLemmaType, RowLemmaTypeHashFunction> d_RowQueued;
 
   typedef context::CDHashSet<Node> CDNodeSet;
 
@@ -396,9 +423,10 @@ class TheoryArrays : public Theory {
    protected:
     void contextNotifyPop() override
     {
+      // the SAT context may have been popped several levels at once
       if (d_contextToPop->getLevel() > d_satContext->getLevel())
       {
-        d_contextToPop->pop();
+        d_contextToPop->popto(d_satContext->getLevel());
       }
     }
 
@@ -443,7 +471,28 @@ class TheoryArrays : public Theory {
   void checkRowLemmas(TNode a, TNode b);
   void propagateRowLemma(RowLemmaType lem);
   void queueRowLemma(RowLemmaType lem);
+  /**
+   * Get the key of Row lemma lem modulo the current equalities, i.e., the
+   * lemma over the representatives of its arrays and indices. Since the
+   * lemma is symmetric in its arrays, they are ordered.
+   */
+  RowLemmaType getRowLemmaKey(const RowLemmaType& lem);
+  /**
+   * Discharge the queued Row lemmas. The lemmas that are relevant for the
+   * current model, i.e., whose indices are disequal or that do not introduce
+   * new read terms, are discharged first. The other lemmas are only
+   * discharged if no relevant lemma was added. Returns true if a lemma was
+   * added and we should stop, or if we are in conflict.
+   */
   bool dischargeLemmas();
+  /**
+   * Discharge Row lemma l, return true if it was added as a lemma.
+   * If relevantOnly is true, then l is not discharged if it is not
+   * relevant for the current model and relevant is set to false.
+   */
+  bool dischargeLemma(const RowLemmaType& l,
+                      bool relevantOnly,
+                      bool& relevant);
 
   /**
    * The decision strategy for the theory of arrays, which calls the
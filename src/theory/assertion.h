@@ -18,6 +18,7 @@
 #ifndef CVC5__THEORY__ASSERTION_H
 #define CVC5__THEORY__ASSERTION_H
 
+#include "context/cdlist.h"
 #include "expr/node.h"
 
 namespace cvc5::internal {
@@ -46,6 +47,14 @@ struct Assertion {
 
 std::ostream& operator<<(std::ostream& out, const Assertion& a);
 
+/**
+ * The list of facts asserted to a theory. Since it gets very long on large
+ * problems, it uses segmented storage that never relocates its elements.
+ */
+using FactList = context::CDList<Assertion,
+                                 context::DefaultCleanUp<Assertion>,
+                                 context::SegmentedAllocator<Assertion>>;
+
 }  // namespace theory
 }  // namespace cvc5::internal
 
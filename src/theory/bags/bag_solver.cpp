@@ -16,6 +16,7 @@
 #include "theory/bags/bag_solver.h"
 
 #include "expr/emptybag.h"
+#include "options/bags_options.h"
 #include "theory/bags/bags_utils.h"
 #include "theory/bags/inference_generator.h"
 #include "theory/bags/inference_manager.h"
@@ -142,6 +143,79 @@ set<Node> BagSolver::getElementsForBinaryOperator(const Node& n)
   return elements;
 }
 
+void BagSolver::checkCountVector(const Node& n, std::set<Node>& elements)
+{
+  if (!options().bags.bagsCountVectors)
+  {
+    return;
+  }
+  std::vector<Node> reps;
+  std::vector<Node> countsA;
+  std::vector<Node> countsB;
+  std::vector<Node> premises;
+  std::set<Node> processed;
+  for (std::set<Node>::iterator it = elements.begin(); it != elements.end();)
+  {
+    Node e = d_state.getRepresentative(*it);
+    if (processed.find(e) == processed.end())
+    {
+      size_t npremises = premises.size();
+      Node a = getConstantCount(e, n[0], premises);
+      Node b = a.isNull() ? a : getConstantCount(e, n[1], premises);
+      if (b.isNull())
+      {
+        // the multiplicities of e are not known, use the rules for e
+        premises.resize(npremises);
+        ++it;
+        continue;
+      }
+      processed.insert(e);
+      reps.push_back(e);
+      countsA.push_back(a);
+      countsB.push_back(b);
+    }
+    it = elements.erase(it);
+  }
+  if (reps.empty())
+  {
+    return;
+  }
+  Trace("bags-count-vector") << "Count vector for " << n << " over " << reps
+                             << std::endl;
+  InferInfo i = d_ig.countVector(n, reps, countsA, countsB, premises);
+  d_im.lemmaTheoryInference(&i);
+}
+
+Node BagSolver::getConstantCount(const Node& e,
+                                 const Node& bag,
+                                 std::vector<Node>& premises)
+{
+  NodeManager* nm = nodeManager();
+  Node b = bag;
+  Node count = nm->mkNode(Kind::BAG_COUNT, e, b);
+  if (!d_state.hasTerm(count))
+  {
+    // count terms are registered for representatives
+    b = d_state.getRepresentative(bag);
+    count = nm->mkNode(Kind::BAG_COUNT, e, b);
+    if (b == bag || !d_state.hasTerm(count))
+    {
+      return Node::null();
+    }
+  }
+  Node c = d_state.getRepresentative(count);
+  if (!c.isConst())
+  {
+    return Node::null();
+  }
+  if (b != bag)
+  {
+    premises.push_back(bag.eqNode(b));
+  }
+  premises.push_back(count.eqNode(c));
+  return c;
+}
+
 void BagSolver::checkEmpty(const Node& n)
 {
   Assert(n.getKind() == Kind::BAG_EMPTY);
@@ -156,6 +230,7 @@ void BagSolver::checkUnionDisjoint(const Node& n)
 {
   Assert(n.getKind() == Kind::BAG_UNION_DISJOINT);
   std::set<Node> elements = getElementsForBinaryOperator(n);
+  checkCountVector(n, elements);
   for (const Node& e : elements)
   {
     InferInfo i = d_ig.unionDisjoint(n, d_state.getRepresentative(e));
@@ -178,6 +253,7 @@ void BagSolver::checkIntersectionMin(const Node& n)
 {
   Assert(n.getKind() == Kind::BAG_INTER_MIN);
   std::set<Node> elements = getElementsForBinaryOperator(n);
+  checkCountVector(n, elements);
   for (const Node& e : elements)
   {
     InferInfo i = d_ig.intersection(n, d_state.getRepresentative(e));
@@ -189,6 +265,7 @@ void BagSolver::checkDifferenceSubtract(const Node& n)
 {
   Assert(n.getKind() == Kind::BAG_DIFFERENCE_SUBTRACT);
   std::set<Node> elements = getElementsForBinaryOperator(n);
+  checkCountVector(n, elements);
   for (const Node& e : elements)
   {
     InferInfo i = d_ig.differenceSubtract(n, d_state.getRepresentative(e));
@@ -84,6 +84,26 @@ class BagSolver : protected EnvObj
    * @return the set union of known elements in (op A B) , A, and B.
    */
   std::set<Node> getElementsForBinaryOperator(const Node& n);
+  /**
+   * If option bagsCountVectors is enabled, apply the inference rules for the
+   * bag n = (op A B) in bulk for all elements whose multiplicities in A and B
+   * are known constants, see InferenceGenerator::countVector. The elements
+   * processed this way are removed from elements.
+   * @param n is a bag of the form (op A B) where op is one of
+   * bag.union_disjoint, bag.inter_min, or bag.difference_subtract
+   * @param elements the elements of n, A and B
+   */
+  void checkCountVector(const Node& n, std::set<Node>& elements);
+  /**
+   * @param e is a representative of an element
+   * @param bag is a bag term
+   * @param premises the explanation of the result is added to this vector
+   * @return the constant multiplicity of e in bag if it is known in the
+   * equality engine, or null otherwise.
+   */
+  Node getConstantCount(const Node& e,
+                        const Node& bag,
+                        std::vector<Node>& premises);
   /** apply inference rules for union disjoint */
   void checkUnionDisjoint(const Node& n);
   /** apply inference rules for union max */
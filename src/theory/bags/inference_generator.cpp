@@ -376,6 +376,41 @@ InferInfo InferenceGenerator::cardUnionDisjoint(
   return inferInfo;
 }
 
+InferInfo InferenceGenerator::countVector(Node n,
+                                          const std::vector<Node>& elements,
+                                          const std::vector<Node>& countsA,
+                                          const std::vector<Node>& countsB,
+                                          const std::vector<Node>& premises)
+{
+  Kind k = n.getKind();
+  Assert(k == Kind::BAG_UNION_DISJOINT || k == Kind::BAG_INTER_MIN
+         || k == Kind::BAG_DIFFERENCE_SUBTRACT);
+  Assert(elements.size() == countsA.size()
+         && elements.size() == countsB.size());
+
+  InferInfo inferInfo(d_im, InferenceId::BAGS_COUNT_VECTOR);
+  inferInfo.d_premises = premises;
+  Node skolem = registerAndAssertSkolemLemma(n);
+  std::vector<Node> conclusions;
+  for (size_t i = 0, size = elements.size(); i < size; ++i)
+  {
+    Assert(countsA[i].isConst() && countsB[i].isConst());
+    const Rational& a = countsA[i].getConst<Rational>();
+    const Rational& b = countsB[i].getConst<Rational>();
+    Rational c;
+    switch (k)
+    {
+      case Kind::BAG_UNION_DISJOINT: c = a + b; break;
+      case Kind::BAG_INTER_MIN: c = a < b ? a : b; break;
+      default: c = a > b ? a - b : Rational(0); break;
+    }
+    Node count = getMultiplicityTerm(elements[i], skolem);
+    conclusions.push_back(count.eqNode(d_nm->mkConstInt(c)));
+  }
+  inferInfo.d_conclusion = d_nm->mkAnd(conclusions);
+  return inferInfo;
+}
+
 Node InferenceGenerator::getMultiplicityTerm(Node element, Node bag)
 {
   Node count = d_nm->mkNode(Kind::BAG_COUNT, element, bag);
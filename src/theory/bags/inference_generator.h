@@ -179,6 +179,29 @@ class InferenceGenerator
    * where skolem is a fresh variable equals (bag.difference_remove A B)
    */
   InferInfo differenceRemove(Node n, Node e);
+  /**
+   * @param n is (op A B) where op is one of bag.union_disjoint,
+   * bag.inter_min, or bag.difference_subtract
+   * @param elements are nodes e_1, ..., e_k of type E
+   * @param countsA are constants a_1, ..., a_k
+   * @param countsB are constants b_1, ..., b_k
+   * @param premises are literals that imply that the multiplicities of e_i in
+   * A and B are a_i and b_i, respectively
+   * @return an inference that represents the following implication
+   * (=>
+   *   (and premises)
+   *   (and
+   *     (= (bag.count e_1 skolem) c_1)
+   *     ...
+   *     (= (bag.count e_k skolem) c_k)))
+   * where skolem is a fresh variable equals n, and c_i is a_i + b_i,
+   * min(a_i, b_i), or max(a_i - b_i, 0), depending on op.
+   */
+  InferInfo countVector(Node n,
+                        const std::vector<Node>& elements,
+                        const std::vector<Node>& countsA,
+                        const std::vector<Node>& countsB,
+                        const std::vector<Node>& premises);
   /**
    * @param n is (bag.setof A) where A is a bag of type (Bag E)
    * @param e is a node of Type E
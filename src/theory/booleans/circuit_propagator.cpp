@@ -26,7 +26,6 @@
 #include "theory/booleans/proof_circuit_propagator.h"
 #include "theory/theory.h"
 #include "util/hash.h"
-#include "util/utility.h"
 
 using namespace std;
 
@@ -44,6 +43,8 @@ CircuitPropagator::CircuitPropagator(Env& env, bool enableForward, bool enableBa
       d_learnedLiteralClearer(&d_context, d_learnedLiterals),
       d_backEdges(),
       d_backEdgesClearer(&d_context, d_backEdges),
+      d_watches(),
+      d_watchesClearer(&d_context, d_watches),
       d_seen(&d_context),
       d_state(&d_context),
       d_forwardPropagation(enableForward),
@@ -262,12 +263,11 @@ void CircuitPropagator::propagateBackward(TNode parent, bool parentAssignment)
       else
       {
         // AND = FALSE: if all children BUT ONE == TRUE, assign(c = FALSE)
-        TNode::iterator holdout =
-            find_if_unique(parent.begin(), parent.end(), [this](TNode x) {
-              return !isAssignedTo(x, true);
-            });
-        if (holdout != parent.end())
+        std::pair<size_t, size_t> w = getWatches(parent, true);
+        if (w.first < parent.getNumChildren()
+            && w.second == parent.getNumChildren())
         {
+          TNode::iterator holdout = parent.begin() + w.first;
           assignAndEnqueue(*holdout, false, prover.andFalse(parent, holdout));
         }
       }
@@ -276,12 +276,11 @@ void CircuitPropagator::propagateBackward(TNode parent, bool parentAssignment)
       if (parentAssignment)
       {
         // OR = TRUE: if all children BUT ONE == FALSE, assign(c = TRUE)
-        TNode::iterator holdout =
-            find_if_unique(parent.begin(), parent.end(), [this](TNode x) {
-              return !isAssignedTo(x, false);
-            });
-        if (holdout != parent.end())
+        std::pair<size_t, size_t> w = getWatches(parent, false);
+        if (w.first < parent.getNumChildren()
+            && w.second == parent.getNumChildren())
         {
+          TNode::iterator holdout = parent.begin() + w.first;
           assignAndEnqueue(*holdout, true, prover.orTrue(parent, holdout));
         }
       }
@@ -436,6 +435,25 @@ void CircuitPropagator::propagateBackward(TNode parent, bool parentAssignment)
   }
 }
 
+std::pair<size_t, size_t> CircuitPropagator::getWatches(TNode parent,
+                                                        bool value)
+{
+  Assert(parent.getKind() == Kind::AND || parent.getKind() == Kind::OR);
+  std::pair<size_t, size_t>& w =
+      d_watches.try_emplace(parent, 0, 1).first->second;
+  size_t n = parent.getNumChildren();
+  while (w.first < n && isAssignedTo(parent[w.first], value))
+  {
+    ++w.first;
+  }
+  w.second = std::max(w.second, w.first + 1);
+  while (w.second < n && isAssignedTo(parent[w.second], value))
+  {
+    ++w.second;
+  }
+  return {std::min(w.first, n), std::min(w.second, n)};
+}
+
 void CircuitPropagator::propagateForward(TNode child, bool childAssignment)
 {
   // The assignment we have
@@ -467,10 +485,9 @@ void CircuitPropagator::propagateForward(TNode child, bool childAssignment)
       case Kind::AND:
         if (childAssignment)
         {
-          TNode::iterator holdout;
-          holdout = find_if(parent.begin(), parent.end(), [this](TNode x) {
-            return !isAssignedTo(x, true);
-          });
+          // the first two children not assigned TRUE
+          std::pair<size_t, size_t> w = getWatches(parent, true);
+          TNode::iterator holdout = parent.begin() + w.first;
 
           if (holdout == parent.end())
           {  // all children are assigned TRUE
@@ -481,11 +498,7 @@ void CircuitPropagator::propagateForward(TNode child, bool childAssignment)
           else if (isAssignedTo(parent, false))
           {  // the AND is FALSE
             // is the holdout unique ?
-            TNode::iterator other =
-                find_if(holdout + 1, parent.end(), [this](TNode x) {
-                  return !isAssignedTo(x, true);
-                });
-            if (other == parent.end())
+            if (w.second == parent.getNumChildren())
             {  // the holdout is unique
               // AND ...(x=TRUE)...: if all children BUT ONE now assigned to
               // TRUE, and AND == FALSE, assign(last_holdout = FALSE)
@@ -508,10 +521,9 @@ void CircuitPropagator::propagateForward(TNode child, bool childAssignment)
         }
         else
         {
-          TNode::iterator holdout;
-          holdout = find_if(parent.begin(), parent.end(), [this](TNode x) {
-            return !isAssignedTo(x, false);
-          });
+          // the first two children not assigned FALSE
+          std::pair<size_t, size_t> w = getWatches(parent, false);
+          TNode::iterator holdout = parent.begin() + w.first;
           if (holdout == parent.end())
           {  // all children are assigned FALSE
             // OR ...(x=FALSE)...: if all children now assigned to FALSE,
@@ -521,11 +533,7 @@ void CircuitPropagator::propagateForward(TNode child, bool childAssignment)
           else if (isAssignedTo(parent, true))
           {  // the OR is TRUE
             // is the holdout unique ?
-            TNode::iterator other =
-                find_if(holdout + 1, parent.end(), [this](TNode x) {
-                  return !isAssignedTo(x, false);
-                });
-            if (other == parent.end())
+            if (w.second == parent.getNumChildren())
             {  // the holdout is unique
               // OR ...(x=FALSE)...: if all children BUT ONE now assigned to
               // FALSE, and OR == TRUE, assign(last_holdout = TRUE)
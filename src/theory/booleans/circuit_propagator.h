@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "context/cdhashmap.h"
@@ -194,6 +195,15 @@ class CircuitPropagator : protected EnvObj
    */
   void propagateBackward(TNode parent, bool assignment);
 
+  /**
+   * Get the watches of the AND or OR node parent, that is, the indices of its
+   * first two children that are not assigned to value (the number of children
+   * if there is no such child). Since assignments are only added until the
+   * context is popped, the watches only move forward and the total cost of
+   * maintaining them is linear in the number of children of parent.
+   */
+  std::pair<size_t, size_t> getWatches(TNode parent, bool value);
+
   /** Are proofs enabled? */
   bool isProofEnabled() const;
 
@@ -231,6 +241,15 @@ class CircuitPropagator : protected EnvObj
    */
   DataClearer<BackEdgesMap> d_backEdgesClearer;
 
+  /** The watches of AND and OR nodes, see getWatches(). */
+  std::unordered_map<TNode, std::pair<size_t, size_t>> d_watches;
+
+  /**
+   * Similar data clearer for watches.
+   */
+  DataClearer<std::unordered_map<TNode, std::pair<size_t, size_t>>>
+      d_watchesClearer;
+
   /** Nodes that have been attached already (computed forward edges for) */
   // All the nodes we've visited so far
   context::CDHashSet<Node> d_seen;
@@ -14,6 +14,9 @@
  */
 #include "theory/bv/bitblast/node_bitblaster.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "options/bv_options.h"
 #include "theory/theory_model.h"
 #include "theory/theory_state.h"
@@ -23,7 +26,11 @@ namespace theory {
 namespace bv {
 
 NodeBitblaster::NodeBitblaster(Env& env, TheoryState* s)
-    : TBitblaster<Node>(), EnvObj(env), d_state(s)
+    : TBitblaster<Node>(),
+      EnvObj(env),
+      d_state(s),
+      d_simplify(options().bv.bvBitblastSimp && !env.isTheoryProofProducing()),
+      d_lazyArithWidth(0)
 {
 }
 
@@ -47,7 +54,12 @@ void NodeBitblaster::bbAtom(TNode node)
                 normalized, this)
           : normalized;
 
-  storeBBAtom(node, rewrite(atom_bb));
+  atom_bb = rewrite(atom_bb);
+  if (d_simplify)
+  {
+    atom_bb = simplify(atom_bb);
+  }
+  storeBBAtom(node, atom_bb);
 }
 
 void NodeBitblaster::storeBBAtom(TNode atom, Node atom_bb)
@@ -89,8 +101,23 @@ void NodeBitblaster::bbTerm(TNode node, Bits& bits)
     getBBTerm(node, bits);
     return;
   }
-  d_termBBStrategies[static_cast<uint32_t>(node.getKind())](node, bits, this);
+  if (isLazyArith(node))
+  {
+    abstractArith(node, bits);
+  }
+  else
+  {
+    d_termBBStrategies[static_cast<uint32_t>(node.getKind())](
+        node, bits, this);
+  }
   Assert(bits.size() == utils::getSize(node));
+  if (d_simplify)
+  {
+    for (Node& bit : bits)
+    {
+      bit = simplify(bit);
+    }
+  }
   storeBBTerm(node, bits);
 }
 
@@ -178,6 +205,292 @@ Node NodeBitblaster::applyAtomBBStrategy(TNode node)
   return d_atomBBStrategies[static_cast<uint32_t>(node.getKind())](node, this);
 }
 
+bool NodeBitblaster::isLazyArith(TNode node) const
+{
+  if (d_lazyArithWidth == 0 || utils::getSize(node) < d_lazyArithWidth)
+  {
+    return false;
+  }
+  Kind k = node.getKind();
+  if (k != Kind::BITVECTOR_MULT && k != Kind::BITVECTOR_UDIV
+      && k != Kind::BITVECTOR_UREM)
+  {
+    return false;
+  }
+  // circuits with constant operands are cheap
+  return std::none_of(
+      node.begin(), node.end(), [](TNode c) { return c.isConst(); });
+}
+
+void NodeBitblaster::abstractArith(TNode node, Bits& bits)
+{
+  Trace("bv-bitblast") << "abstract " << node << std::endl;
+  std::vector<Node> lsbs;
+  for (TNode c : node)
+  {
+    Bits cbits;
+    bbTerm(c, cbits);
+    lsbs.push_back(cbits[0]);
+  }
+  for (unsigned i = 0, size = utils::getSize(node); i < size; ++i)
+  {
+    bits.push_back(utils::mkBit(node, i));
+  }
+  if (node.getKind() == Kind::BITVECTOR_MULT)
+  {
+    bits[0] = mkAnd(nodeManager(), lsbs);
+  }
+  d_abstractions.insert(node);
+}
+
+Node NodeBitblaster::refineAbstraction(TNode node)
+{
+  Assert(d_abstractions.find(node) != d_abstractions.end());
+  Trace("bv-bitblast") << "refine " << node << std::endl;
+  Bits abits, bits;
+  getBBTerm(node, abits);
+  d_termBBStrategies[static_cast<uint32_t>(node.getKind())](node, bits, this);
+  std::vector<Node> eqs;
+  for (size_t i = 0, size = bits.size(); i < size; ++i)
+  {
+    Node bit = d_simplify ? simplify(bits[i]) : bits[i];
+    if (abits[i] != bit)
+    {
+      eqs.push_back(abits[i].eqNode(bit));
+    }
+  }
+  d_abstractions.erase(node);
+  return eqs.empty() ? nodeManager()->mkConst(true) : nodeManager()->mkAnd(eqs);
+}
+
+namespace {
+
+/** Return true if n is a Boolean connective handled by simplify(). */
+bool isSimpConnective(TNode n)
+{
+  switch (n.getKind())
+  {
+    case Kind::NOT:
+    case Kind::AND:
+    case Kind::OR:
+    case Kind::XOR:
+    case Kind::IMPLIES: return true;
+    case Kind::EQUAL: return n[0].getType().isBoolean();
+    case Kind::ITE: return n.getType().isBoolean();
+    default: return false;
+  }
+}
+
+}  // namespace
+
+Node NodeBitblaster::simplify(TNode node)
+{
+  std::vector<TNode> visit;
+  visit.push_back(node);
+  do
+  {
+    TNode cur = visit.back();
+    if (d_simpCache.find(cur) != d_simpCache.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (!isSimpConnective(cur))
+    {
+      d_simpCache.emplace(cur, cur);
+      visit.pop_back();
+      continue;
+    }
+    bool ready = true;
+    for (TNode c : cur)
+    {
+      if (d_simpCache.find(c) == d_simpCache.end())
+      {
+        visit.push_back(c);
+        ready = false;
+      }
+    }
+    if (!ready)
+    {
+      continue;
+    }
+    visit.pop_back();
+    std::vector<Node> children;
+    for (TNode c : cur)
+    {
+      children.push_back(d_simpCache[c]);
+    }
+    d_simpCache.emplace(cur, simplifyConnective(cur.getKind(), children));
+  } while (!visit.empty());
+  return d_simpCache[node];
+}
+
+Node NodeBitblaster::simplifyConnective(Kind k,
+                                        const std::vector<Node>& children)
+{
+  switch (k)
+  {
+    case Kind::NOT: return mkSimpNot(children[0]);
+    case Kind::AND:
+    case Kind::OR: return mkSimpAndOr(k, children);
+    case Kind::IMPLIES:
+      return mkSimpAndOr(Kind::OR, {mkSimpNot(children[0]), children[1]});
+    case Kind::XOR: return mkSimpXor(children[0], children[1], false);
+    case Kind::EQUAL: return mkSimpXor(children[0], children[1], true);
+    case Kind::ITE: return mkSimpIte(children[0], children[1], children[2]);
+    default: Unreachable();
+  }
+  return Node::null();
+}
+
+Node NodeBitblaster::mkSimpNot(TNode a)
+{
+  if (a.isConst())
+  {
+    return nodeManager()->mkConst(!a.getConst<bool>());
+  }
+  if (a.getKind() == Kind::NOT)
+  {
+    return a[0];
+  }
+  return a.notNode();
+}
+
+Node NodeBitblaster::mkSimpAndOr(Kind k, const std::vector<Node>& children)
+{
+  Assert(k == Kind::AND || k == Kind::OR);
+  NodeManager* nm = nodeManager();
+  Node absorbing = nm->mkConst(k == Kind::OR);
+  Node identity = nm->mkConst(k == Kind::AND);
+  // flatten, the children are simplified and hence already flat
+  std::vector<TNode> flat;
+  for (const Node& c : children)
+  {
+    if (c.getKind() == k)
+    {
+      flat.insert(flat.end(), c.begin(), c.end());
+    }
+    else
+    {
+      flat.push_back(c);
+    }
+  }
+  std::unordered_set<TNode> lits;
+  for (TNode c : flat)
+  {
+    if (c == absorbing)
+    {
+      return absorbing;
+    }
+    if (c != identity)
+    {
+      lits.insert(c);
+    }
+  }
+  Kind dk = k == Kind::AND ? Kind::OR : Kind::AND;
+  std::vector<TNode> res;
+  for (TNode c : lits)
+  {
+    // x & ~x = false, x | ~x = true
+    if (c.getKind() == Kind::NOT && lits.find(c[0]) != lits.end())
+    {
+      return absorbing;
+    }
+    // x & (x | y) = x, x | (x & y) = x
+    if (c.getKind() == dk
+        && std::any_of(c.begin(), c.end(), [&lits](TNode cc) {
+             return lits.find(cc) != lits.end();
+           }))
+    {
+      continue;
+    }
+    res.push_back(c);
+  }
+  if (res.empty())
+  {
+    return identity;
+  }
+  if (res.size() == 1)
+  {
+    return res[0];
+  }
+  std::sort(res.begin(), res.end(), [](TNode x, TNode y) {
+    return x.getId() < y.getId();
+  });
+  return nm->mkNode(k, res);
+}
+
+Node NodeBitblaster::mkSimpXor(TNode a, TNode b, bool isEq)
+{
+  // we compute (a xor b) xor neg, pulling negations and constants into neg
+  bool neg = isEq;
+  if (a.getKind() == Kind::NOT)
+  {
+    a = a[0];
+    neg = !neg;
+  }
+  if (b.getKind() == Kind::NOT)
+  {
+    b = b[0];
+    neg = !neg;
+  }
+  if (a.isConst())
+  {
+    std::swap(a, b);
+  }
+  if (b.isConst())
+  {
+    bool bneg = neg != b.getConst<bool>();
+    return bneg ? mkSimpNot(a) : Node(a);
+  }
+  if (a == b)
+  {
+    return nodeManager()->mkConst(neg);
+  }
+  if (b.getId() < a.getId())
+  {
+    std::swap(a, b);
+  }
+  return NodeManager::mkNode(neg ? Kind::EQUAL : Kind::XOR, a, b);
+}
+
+Node NodeBitblaster::mkSimpIte(TNode c, TNode a, TNode b)
+{
+  if (c.isConst())
+  {
+    return c.getConst<bool>() ? a : b;
+  }
+  if (c.getKind() == Kind::NOT)
+  {
+    c = c[0];
+    std::swap(a, b);
+  }
+  if (a == b)
+  {
+    return a;
+  }
+  // ite(c, c, b) = c | b, ite(c, a, c) = c & a
+  if (a == c || (a.isConst() && a.getConst<bool>()))
+  {
+    return mkSimpAndOr(Kind::OR, {c, b});
+  }
+  if (b == c || (b.isConst() && !b.getConst<bool>()))
+  {
+    return mkSimpAndOr(Kind::AND, {c, a});
+  }
+  if (a.isConst())
+  {
+    // a is false
+    return mkSimpAndOr(Kind::AND, {mkSimpNot(c), b});
+  }
+  if (b.isConst())
+  {
+    // b is true
+    return mkSimpAndOr(Kind::OR, {mkSimpNot(c), a});
+  }
+  return NodeManager::mkNode(Kind::ITE, c, a, b);
+}
+
 }  // namespace bv
 }  // namespace theory
 }  // namespace cvc5::internal
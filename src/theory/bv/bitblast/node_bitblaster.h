@@ -70,14 +70,73 @@ class NodeBitblaster : public TBitblaster<Node>, protected EnvObj
    */
   Node applyAtomBBStrategy(TNode node);
 
+  /**
+   * Abstract applications of BITVECTOR_MULT, BITVECTOR_UDIV and
+   * BITVECTOR_UREM of bit-width at least `width` with non-constant operands
+   * when bit-blasting them, rather than bit-blasting their circuits. The
+   * abstractions must be refined by the caller, see refineAbstraction().
+   * A width of 0 disables abstraction.
+   */
+  void setLazyArithWidth(uint64_t width) { d_lazyArithWidth = width; }
+  /** Get the abstracted terms that were not refined yet. */
+  const std::unordered_set<Node>& getAbstractions() const
+  {
+    return d_abstractions;
+  }
+  /**
+   * Refine the abstraction of `node` by bit-blasting its circuit. Returns the
+   * Boolean formula stating that its abstract bits are equal to the bits of
+   * the circuit.
+   */
+  Node refineAbstraction(TNode node);
+
  private:
   /** Query SAT solver for assignment of node 'a'. */
   Node getModelFromSatSolver(TNode a, bool fullModel) override;
 
+  /** Whether `node` is abstracted, see setLazyArithWidth(). */
+  bool isLazyArith(TNode node) const;
+  /**
+   * Make the abstract bits of `node`. Only the lowest bit of a multiplication
+   * is defined, as the conjunction of the lowest bits of its operands.
+   */
+  void abstractArith(TNode node, Bits& bits);
+
+  /**
+   * Simplify the bit-level circuit `node`, built from NOT, AND, OR, XOR,
+   * IMPLIES, EQUAL and ITE over Booleans.
+   *
+   * Similar to and-inverter graphs with structural hashing, the children of
+   * commutative operators are flattened and sorted, and negations are pushed
+   * out of XOR and EQUAL, so that equivalent subcircuits are represented by
+   * the same node. Additionally, constants, duplicate and complementary
+   * children, absorption (x & (x | y) = x) and trivial ITEs are simplified.
+   * The result is cached in d_simpCache.
+   */
+  Node simplify(TNode node);
+  /** Simplify `k` applied to the already simplified `children`. */
+  Node simplifyConnective(Kind k, const std::vector<Node>& children);
+  /** Return the simplified negation of simplified `a`. */
+  Node mkSimpNot(TNode a);
+  /** Return the simplified AND or OR of simplified `children`. */
+  Node mkSimpAndOr(Kind k, const std::vector<Node>& children);
+  /** Return the simplified XOR (or EQUAL if `isEq`) of simplified a and b. */
+  Node mkSimpXor(TNode a, TNode b, bool isEq);
+  /** Return the simplified ITE of simplified c, a and b. */
+  Node mkSimpIte(TNode c, TNode a, TNode b);
+
   /** Caches variables for which we already created bits. */
   TNodeSet d_variables;
   /** Stores bit-blasted atoms. */
   std::unordered_map<Node, Node> d_bbAtoms;
+  /** Whether to simplify the bit-blasted circuits, see simplify(). */
+  bool d_simplify;
+  /** Caches the results of simplify(). */
+  std::unordered_map<Node, Node> d_simpCache;
+  /** The bit-width from which arithmetic terms are abstracted. */
+  uint64_t d_lazyArithWidth;
+  /** The abstracted terms that were not refined yet. */
+  std::unordered_set<Node> d_abstractions;
   /** Theory state. */
   TheoryState* d_state;
 };
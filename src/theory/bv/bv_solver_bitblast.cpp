@@ -125,7 +125,9 @@ BVSolverBitblast::BVSolverBitblast(Env& env,
       d_factLiteralCache(context()),
       d_literalFactCache(context()),
       d_propagate(options().bv.bitvectorPropagate),
-      d_resetNotify(new NotifyResetAssertions(userContext()))
+      d_resetNotify(new NotifyResetAssertions(userContext())),
+      d_wordProp(options().bv.bvWordProp ? new WordPropagator(env) : nullptr),
+      d_wordConflict(context())
 {
   if (env.isTheoryProofProducing())
   {
@@ -133,6 +135,7 @@ BVSolverBitblast::BVSolverBitblast(Env& env,
   }
 
   initSatSolver();
+  d_bitblaster->setLazyArithWidth(options().bv.bvLazyArithWidth);
 }
 
 bool BVSolverBitblast::needsEqualityEngine(EeSetupInfo& esi)
@@ -144,6 +147,24 @@ bool BVSolverBitblast::needsEqualityEngine(EeSetupInfo& esi)
 
 void BVSolverBitblast::postCheck(Theory::Effort level)
 {
+  // Conflicts found at the word level do not require bit-blasting.
+  if (!d_wordConflict.get().isNull())
+  {
+    Node conflict = d_wordConflict.get();
+    TrustNode tconflict;
+    if (d_epg != nullptr)
+    {
+      tconflict = d_epg->mkTrustNodeTrusted(
+          conflict, TrustId::BV_BITBLAST_CONFLICT, {}, {}, true);
+    }
+    else
+    {
+      tconflict = TrustNode::mkTrustConflict(conflict, nullptr);
+    }
+    d_im.trustedConflict(tconflict, InferenceId::BV_BITBLAST_CONFLICT);
+    return;
+  }
+
   if (level != Theory::Effort::EFFORT_FULL)
   {
     /* Do bit-level propagation only if the SAT solver supports it. */
@@ -153,13 +174,16 @@ void BVSolverBitblast::postCheck(Theory::Effort level)
     }
   }
 
-  // If we permanently added assertions to the SAT solver and the assertions
-  // were reset, we have to reset the SAT solver and the CNF stream.
+  // If we added input assertions to the SAT solver and the assertions were
+  // reset, we permanently disable them by asserting the negation of their
+  // activation literal and continue with a fresh one. This keeps the SAT
+  // solver, the CNF stream and the bit-blasted terms, whose clauses are
+  // definitional and hence remain valid.
   if (options().bv.bvAssertInput && d_resetNotify->doneResetAssertions())
   {
-    d_satSolver.reset(nullptr);
-    d_cnfStream.reset(nullptr);
-    initSatSolver();
+    prop::SatClause clause{~d_inputActivation};
+    d_satSolver->addClause(clause, false);
+    d_inputActivation = prop::SatLiteral(d_satSolver->newVar(false, false));
     d_resetNotify->reset();
   }
 
@@ -173,16 +197,21 @@ void BVSolverBitblast::postCheck(Theory::Effort level)
     /* Bit-blast fact and cache literal. */
     if (d_factLiteralCache.find(fact) == d_factLiteralCache.end())
     {
+      prop::SatLiteral lit;
       if (fact.getKind() == Kind::BITVECTOR_EAGER_ATOM)
       {
-        handleEagerAtom(fact, true);
+        handleEagerAtom(fact, false);
+        lit = d_cnfStream->getLiteral(fact[0]);
       }
       else
       {
         d_bitblaster->bbAtom(fact);
         Node bb_fact = d_bitblaster->getStoredBBAtom(fact);
-        d_cnfStream->convertAndAssert(bb_fact, false, false);
+        d_cnfStream->ensureLiteral(bb_fact);
+        lit = d_cnfStream->getLiteral(bb_fact);
       }
+      prop::SatClause clause{~d_inputActivation, lit};
+      d_satSolver->addClause(clause, false);
     }
     d_assertions.push_back(fact);
   }
@@ -216,7 +245,16 @@ void BVSolverBitblast::postCheck(Theory::Effort level)
 
   std::vector<prop::SatLiteral> assumptions(d_assumptions.begin(),
                                             d_assumptions.end());
+  if (options().bv.bvAssertInput)
+  {
+    assumptions.push_back(d_inputActivation);
+  }
   prop::SatValue val = d_satSolver->solve(assumptions);
+  while (level == Theory::Effort::EFFORT_FULL
+         && val == prop::SatValue::SAT_VALUE_TRUE && refineAbstractions())
+  {
+    val = d_satSolver->solve(assumptions);
+  }
 
   if (val == prop::SatValue::SAT_VALUE_FALSE)
   {
@@ -230,6 +268,12 @@ void BVSolverBitblast::postCheck(Theory::Effort level)
       std::vector<Node> conf;
       for (const prop::SatLiteral& lit : unsat_assumptions)
       {
+        if (options().bv.bvAssertInput && lit == d_inputActivation)
+        {
+          // the input assertions are involved in the conflict
+          conf.insert(conf.end(), d_assertions.begin(), d_assertions.end());
+          continue;
+        }
         conf.push_back(d_literalFactCache[lit]);
         Trace("bv-bitblast")
             << "unsat assumption (" << lit << "): " << conf.back() << std::endl;
@@ -275,7 +319,12 @@ bool BVSolverBitblast::preNotifyFact(
   {
     d_bbFacts.push_back(fact);
   }
-  
+
+  if (d_wordProp != nullptr && d_wordConflict.get().isNull())
+  {
+    d_wordConflict = d_wordProp->notifyFact(fact);
+  }
+
   // Return false to enable equality engine reasoning in Theory, which is
   // available if we are using the equality engine.
   return !logicInfo().isSharingEnabled() && !options().bv.bvEqEngine;
@@ -355,6 +404,17 @@ void BVSolverBitblast::initSatSolver()
           "theory::bv::BVSolverBitblast::"));
       break;
     default:
+      if (options().bv.bvSatThreads > 1)
+      {
+        d_satSolver.reset(prop::SatSolverFactory::createCadicalPortfolio(
+            d_env,
+            statisticsRegistry(),
+            d_env.getResourceManager(),
+            options().bv.bvSatThreads,
+            options().bv.bvSatShareSize,
+            "theory::bv::BVSolverBitblast::"));
+        break;
+      }
       d_satSolver.reset(prop::SatSolverFactory::createCadical(
           d_env,
           statisticsRegistry(),
@@ -367,6 +427,10 @@ void BVSolverBitblast::initSatSolver()
                                         d_nullContext.get(),
                                         prop::FormulaLitPolicy::INTERNAL,
                                         "theory::bv::BVSolverBitblast"));
+  if (options().bv.bvAssertInput)
+  {
+    d_inputActivation = prop::SatLiteral(d_satSolver->newVar(false, false));
+  }
 }
 
 Node BVSolverBitblast::getValue(TNode node, bool initialize)
@@ -403,6 +467,38 @@ Node BVSolverBitblast::getValue(TNode node, bool initialize)
   return utils::mkConst(nm, bits.size(), value);
 }
 
+bool BVSolverBitblast::refineAbstractions()
+{
+  const std::unordered_set<Node>& abstractions =
+      d_bitblaster->getAbstractions();
+  if (abstractions.empty())
+  {
+    return false;
+  }
+  NodeManager* nm = nodeManager();
+  std::vector<Node> spurious;
+  for (const Node& t : abstractions)
+  {
+    std::vector<Node> children;
+    for (const Node& c : t)
+    {
+      children.push_back(getValue(c, true));
+    }
+    Node expected = rewrite(nm->mkNode(t.getKind(), children));
+    if (getValue(t, true) != expected)
+    {
+      spurious.push_back(t);
+    }
+  }
+  for (const Node& t : spurious)
+  {
+    // The refinement is valid, hence we add it permanently.
+    Node lem = d_bitblaster->refineAbstraction(t);
+    d_cnfStream->convertAndAssert(lem, false, false);
+  }
+  return !spurious.empty();
+}
+
 void BVSolverBitblast::handleEagerAtom(TNode fact, bool assertFact)
 {
   Assert(fact.getKind() == Kind::BITVECTOR_EAGER_ATOM);
@@ -20,6 +20,7 @@
 
 #include <unordered_map>
 
+#include "context/cdo.h"
 #include "context/cdqueue.h"
 #include "proof/eager_proof_generator.h"
 #include "prop/cnf_stream.h"
@@ -28,6 +29,7 @@
 #include "theory/bv/bitblast/node_bitblaster.h"
 #include "theory/bv/bv_solver.h"
 #include "theory/bv/proof_checker.h"
+#include "theory/bv/word_propagator.h"
 
 namespace cvc5::internal {
 
@@ -89,6 +91,13 @@ class BVSolverBitblast : public BVSolver
    */
   void handleEagerAtom(TNode fact, bool assertFact);
 
+  /**
+   * Refine the abstractions of the bit-blaster (see
+   * NodeBitblaster::setLazyArithWidth()) whose values in the current SAT model
+   * are spurious. Returns true if any abstraction was refined.
+   */
+  bool refineAbstractions();
+
   /** Bit-blaster used to bit-blast atoms/terms. */
   std::unique_ptr<NodeBitblaster> d_bitblaster;
 
@@ -121,6 +130,16 @@ class BVSolverBitblast : public BVSolver
   /** Stores the current input assertions. */
   context::CDList<Node> d_assertions;
 
+  /**
+   * The SAT literal that activates the input assertions if
+   * options::bvAssertInput is enabled.
+   *
+   * Input facts are added to the SAT solver as clauses guarded by this
+   * literal, which is always assumed. On reset-assertions, we replace it by a
+   * fresh literal rather than resetting the SAT solver.
+   */
+  prop::SatLiteral d_inputActivation;
+
   /** Proof generator that manages proofs for lemmas generated by this class. */
   std::unique_ptr<EagerProofGenerator> d_epg;
 
@@ -138,6 +157,11 @@ class BVSolverBitblast : public BVSolver
 
   /** Notifies when reset-assertion was called. */
   std::unique_ptr<NotifyResetAssertions> d_resetNotify;
+
+  /** Word-level propagator, if options::bvWordProp is enabled. */
+  std::unique_ptr<WordPropagator> d_wordProp;
+  /** The conflict found by d_wordProp, if any. */
+  context::CDO<Node> d_wordConflict;
 };
 
 }  // namespace bv
@@ -0,0 +1,224 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Constant folding of bit-vector terms.
+ */
+
+#include "theory/bv/constant_folder.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/attribute.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "util/bitvector.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+namespace {
+
+struct NotFoldableAttributeId
+{
+};
+/** Attribute true for terms that ConstantFolder::fold failed on. */
+using NotFoldableAttribute = expr::Attribute<NotFoldableAttributeId, bool>;
+
+}  // namespace
+
+bool ConstantFolder::isPredicate(TNode n)
+{
+  switch (n.getKind())
+  {
+    case Kind::BITVECTOR_ULT:
+    case Kind::BITVECTOR_ULE:
+    case Kind::BITVECTOR_UGT:
+    case Kind::BITVECTOR_UGE:
+    case Kind::BITVECTOR_SLT:
+    case Kind::BITVECTOR_SLE:
+    case Kind::BITVECTOR_SGT:
+    case Kind::BITVECTOR_SGE: return true;
+    case Kind::EQUAL: return n[0].getType().isBitVector();
+    default: return false;
+  }
+}
+
+bool ConstantFolder::isFoldable(Kind k)
+{
+  switch (k)
+  {
+    case Kind::BITVECTOR_NOT:
+    case Kind::BITVECTOR_NEG:
+    case Kind::BITVECTOR_EXTRACT:
+    case Kind::BITVECTOR_CONCAT:
+    case Kind::BITVECTOR_ADD:
+    case Kind::BITVECTOR_MULT:
+    case Kind::BITVECTOR_AND:
+    case Kind::BITVECTOR_OR:
+    case Kind::BITVECTOR_XOR:
+    case Kind::BITVECTOR_UDIV:
+    case Kind::BITVECTOR_UREM:
+    case Kind::BITVECTOR_SHL:
+    case Kind::BITVECTOR_ASHR:
+    case Kind::BITVECTOR_REPEAT:
+    case Kind::BITVECTOR_SIGN_EXTEND:
+    case Kind::BITVECTOR_ZERO_EXTEND: return true;
+    default: return false;
+  }
+}
+
+Node ConstantFolder::fold(NodeManager* nm, TNode n)
+{
+  Kind k = n.getKind();
+  bool isPred = isPredicate(n);
+  if ((!isPred && !isFoldable(k)) || n.getAttribute(NotFoldableAttribute()))
+  {
+    return Node::null();
+  }
+
+  // The value of each visited term, where terms whose children are being
+  // visited are mapped to a bit-vector of size 0. The values of predicates
+  // are bit-vectors of size 1.
+  std::unordered_map<TNode, BitVector> values;
+  std::unordered_map<TNode, BitVector>::iterator it;
+  std::vector<TNode> visit;
+  visit.push_back(n);
+  TNode cur;
+  while (!visit.empty())
+  {
+    cur = visit.back();
+    it = values.find(cur);
+    if (it == values.end())
+    {
+      if (cur.isConst())
+      {
+        visit.pop_back();
+        values.emplace(cur, cur.getConst<BitVector>());
+        continue;
+      }
+      // predicates may only occur at the root
+      if ((cur != n && !isFoldable(cur.getKind()))
+          || cur.getAttribute(NotFoldableAttribute()))
+      {
+        // Mark the terms whose traversal has started but not finished as not
+        // foldable, since they all contain cur.
+        for (const std::pair<const TNode, BitVector>& v : values)
+        {
+          if (v.second.getSize() == 0)
+          {
+            TNode t = v.first;
+            t.setAttribute(NotFoldableAttribute(), true);
+          }
+        }
+        return Node::null();
+      }
+      values.emplace(cur, BitVector());
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    visit.pop_back();
+    if (it->second.getSize() > 0)
+    {
+      continue;
+    }
+    Kind ck = cur.getKind();
+    const BitVector& a = values[cur[0]];
+    BitVector res;
+    switch (ck)
+    {
+      case Kind::BITVECTOR_NOT: res = ~a; break;
+      case Kind::BITVECTOR_NEG: res = -a; break;
+      case Kind::BITVECTOR_EXTRACT:
+        res = a.extract(utils::getExtractHigh(cur), utils::getExtractLow(cur));
+        break;
+      case Kind::BITVECTOR_CONCAT:
+      case Kind::BITVECTOR_ADD:
+      case Kind::BITVECTOR_MULT:
+      case Kind::BITVECTOR_AND:
+      case Kind::BITVECTOR_OR:
+      case Kind::BITVECTOR_XOR:
+      {
+        res = a;
+        for (size_t i = 1, nchildren = cur.getNumChildren(); i < nchildren; ++i)
+        {
+          const BitVector& b = values[cur[i]];
+          switch (ck)
+          {
+            case Kind::BITVECTOR_CONCAT: res = res.concat(b); break;
+            case Kind::BITVECTOR_ADD: res = res + b; break;
+            case Kind::BITVECTOR_MULT: res = res * b; break;
+            case Kind::BITVECTOR_AND: res = res & b; break;
+            case Kind::BITVECTOR_OR: res = res | b; break;
+            default: res = res ^ b; break;
+          }
+        }
+        break;
+      }
+      case Kind::BITVECTOR_UDIV:
+        res = a.unsignedDivTotal(values[cur[1]]);
+        break;
+      case Kind::BITVECTOR_UREM:
+        res = a.unsignedRemTotal(values[cur[1]]);
+        break;
+      case Kind::BITVECTOR_SHL: res = a.leftShift(values[cur[1]]); break;
+      case Kind::BITVECTOR_ASHR: res = a.arithRightShift(values[cur[1]]); break;
+      case Kind::BITVECTOR_REPEAT:
+      {
+        unsigned amount =
+            cur.getOperator().getConst<BitVectorRepeat>().d_repeatAmount;
+        res = a;
+        for (unsigned i = 1; i < amount; ++i)
+        {
+          res = res.concat(a);
+        }
+        break;
+      }
+      case Kind::BITVECTOR_SIGN_EXTEND:
+        res = a.signExtend(utils::getSignExtendAmount(cur));
+        break;
+      case Kind::BITVECTOR_ZERO_EXTEND:
+        res = a.zeroExtend(cur.getOperator()
+                               .getConst<BitVectorZeroExtend>()
+                               .d_zeroExtendAmount);
+        break;
+      default:
+      {
+        Assert(cur == n && isPred);
+        const BitVector& b = values[cur[1]];
+        bool val;
+        switch (ck)
+        {
+          case Kind::BITVECTOR_ULT: val = a.unsignedLessThan(b); break;
+          case Kind::BITVECTOR_ULE: val = a.unsignedLessThanEq(b); break;
+          case Kind::BITVECTOR_UGT: val = b.unsignedLessThan(a); break;
+          case Kind::BITVECTOR_UGE: val = b.unsignedLessThanEq(a); break;
+          case Kind::BITVECTOR_SLT: val = a.signedLessThan(b); break;
+          case Kind::BITVECTOR_SLE: val = a.signedLessThanEq(b); break;
+          case Kind::BITVECTOR_SGT: val = b.signedLessThan(a); break;
+          case Kind::BITVECTOR_SGE: val = b.signedLessThanEq(a); break;
+          default: Assert(ck == Kind::EQUAL); val = a == b; break;
+        }
+        res = BitVector(1, val ? 1u : 0u);
+        break;
+      }
+    }
+    values[cur] = res;
+  }
+  const BitVector& res = values[n];
+  return isPred ? nm->mkConst(res.isBitSet(0)) : nm->mkConst(res);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Constant folding of bit-vector terms.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__BV__CONSTANT_FOLDER_H
+#define CVC5__THEORY__BV__CONSTANT_FOLDER_H
+
+#include "expr/node.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+/**
+ * Evaluates bit-vector terms whose leaves are all constants bottom-up in a
+ * single traversal, and only creates the node of the resulting constant.
+ * This avoids creating a constant node for every intermediate term, as is
+ * done when the constant evaluation rewrite rules are applied term by term.
+ *
+ * Only the bit-vector operators supported by the Evaluator are folded, such
+ * that folding steps can be justified by evaluation in proofs. Terms that
+ * can not be folded are marked, such that their subterms are not traversed
+ * again when the rewriter descends into them.
+ */
+class ConstantFolder
+{
+ public:
+  /**
+   * Return the constant n evaluates to, or the null node if n is not a
+   * bit-vector term (or predicate) with constant leaves.
+   */
+  static Node fold(NodeManager* nm, TNode n);
+
+ private:
+  /** Return true if n is a bit-vector predicate that can be folded. */
+  static bool isPredicate(TNode n);
+  /** Return true if bit-vector terms of kind k can be folded. */
+  static bool isFoldable(Kind k);
+};
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__BV__CONSTANT_FOLDER_H */
@@ -52,8 +52,11 @@ IntBlaster::IntBlaster(Env& env,
                        options::SolveBVAsIntMode mode,
                        uint64_t granularity)
     : EnvObj(env),
-      d_binarizeCache(userContext()),
-      d_intblastCache(userContext()),
+      d_cacheContext(options().smt.bvToIntIncremental ? new context::Context()
+                                                      : nullptr),
+      d_binarizeCache(d_cacheContext ? d_cacheContext.get() : userContext()),
+      d_intblastCache(d_cacheContext ? d_cacheContext.get() : userContext()),
+      d_replayed(userContext()),
       d_rangeAssertions(userContext()),
       d_bitwiseAssertions(userContext()),
       d_iandUtils(nodeManager()),
@@ -86,6 +89,10 @@ void IntBlaster::addRangeConstraint(Node node,
   Node rangeConstraint = mkRangeConstraint(node, size);
   Trace("int-blaster-debug")
       << "range constraint computed: " << rangeConstraint << std::endl;
+  if (!d_translating.isNull())
+  {
+    d_sideLemmas[d_translating].emplace_back(rangeConstraint, false);
+  }
   if (d_rangeAssertions.find(rangeConstraint) == d_rangeAssertions.end())
   {
     Trace("int-blaster-debug")
@@ -99,6 +106,10 @@ void IntBlaster::addRangeConstraint(Node node,
 void IntBlaster::addBitwiseConstraint(Node bitwiseConstraint,
                                       std::vector<TrustNode>& lemmas)
 {
+  if (!d_translating.isNull())
+  {
+    d_sideLemmas[d_translating].emplace_back(bitwiseConstraint, true);
+  }
   if (d_bitwiseAssertions.find(bitwiseConstraint) == d_bitwiseAssertions.end())
   {
     Trace("int-blaster-debug")
@@ -207,7 +218,12 @@ TrustNode IntBlaster::trustedIntBlast(Node n,
       // We already visited and translated this node
       if (!d_intblastCache[current].get().isNull())
       {
-        // We are done computing the translation for current
+        // We are done computing the translation for current. If it was
+        // translated in a popped user context, we add its lemmas again.
+        if (d_cacheContext != nullptr)
+        {
+          replaySideEffects(current, lemmas, skolems);
+        }
         toVisit.pop_back();
       }
       else
@@ -215,9 +231,22 @@ TrustNode IntBlaster::trustedIntBlast(Node n,
         // We are now visiting current on the way back up.
         // This is when we do the actual translation.
         Node translation;
+        if (d_cacheContext != nullptr)
+        {
+          d_translating = current;
+          d_replayed.insert(current);
+        }
         if (currentNumChildren == 0)
         {
           translation = translateNoChildren(current, lemmas, skolems);
+          if (d_cacheContext != nullptr)
+          {
+            auto its = skolems.find(current);
+            if (its != skolems.end())
+            {
+              d_sideSkolems[current] = its->second;
+            }
+          }
         }
         else
         {
@@ -248,6 +277,7 @@ TrustNode IntBlaster::trustedIntBlast(Node n,
               translateWithChildren(current, translated_children, lemmas);
         }
         Assert(!translation.isNull());
+        d_translating = Node::null();
         // Map the current node to its translation in the cache.
         d_intblastCache[current] = translation;
         // Also map the translation to itself.
@@ -265,6 +295,51 @@ TrustNode IntBlaster::trustedIntBlast(Node n,
   return TrustNode::mkTrustRewrite(n, res, this);
 }
 
+void IntBlaster::replaySideEffects(const Node& n,
+                                   std::vector<TrustNode>& lemmas,
+                                   std::map<Node, Node>& skolems)
+{
+  std::vector<Node> toVisit;
+  toVisit.push_back(n);
+  while (!toVisit.empty())
+  {
+    Node current = toVisit.back();
+    toVisit.pop_back();
+    if (d_replayed.find(current) != d_replayed.end())
+    {
+      continue;
+    }
+    d_replayed.insert(current);
+    auto itl = d_sideLemmas.find(current);
+    if (itl != d_sideLemmas.end())
+    {
+      for (const std::pair<Node, bool>& lem : itl->second)
+      {
+        context::CDHashSet<Node>& cache =
+            lem.second ? d_bitwiseAssertions : d_rangeAssertions;
+        if (cache.find(lem.first) == cache.end())
+        {
+          cache.insert(lem.first);
+          lemmas.push_back(TrustNode::mkTrustLemma(lem.first, this));
+        }
+      }
+    }
+    auto its = d_sideSkolems.find(current);
+    if (its != d_sideSkolems.end() && skolems.find(current) == skolems.end())
+    {
+      skolems[current] = its->second;
+    }
+    for (const Node& child : current)
+    {
+      toVisit.push_back(makeBinary(child));
+    }
+    if (current.getKind() == Kind::APPLY_UF)
+    {
+      toVisit.push_back(current.getOperator());
+    }
+  }
+}
+
 Node IntBlaster::intBlast(Node n,
                           std::vector<Node>& lemmas,
                           std::map<Node, Node>& skolems)
@@ -18,6 +18,9 @@
 #ifndef __CVC5__THEORY__BV__INT_BLASTER__H
 #define __CVC5__THEORY__BV__INT_BLASTER__H
 
+#include <memory>
+#include <unordered_map>
+
 #include "context/cdhashmap.h"
 #include "context/cdhashset.h"
 #include "context/cdo.h"
@@ -354,10 +357,39 @@ class IntBlaster : protected EnvObj, public ProofGenerator
                            std::vector<TrustNode>& lemmas,
                            std::map<Node, Node>& skolems);
 
+  /**
+   * Add the lemmas and skolem definitions recorded for the translation of n
+   * and its subterms, unless this was already done in the current user
+   * context. Only used with options::bvToIntIncremental.
+   */
+  void replaySideEffects(const Node& n,
+                         std::vector<TrustNode>& lemmas,
+                         std::map<Node, Node>& skolems);
+
+  /**
+   * The context of the caches below if options::bvToIntIncremental is
+   * enabled, which is never popped. Otherwise, the caches depend on the user
+   * context.
+   */
+  std::unique_ptr<context::Context> d_cacheContext;
+
   /** Caches for the different functions */
   CDNodeMap d_binarizeCache;
   CDNodeMap d_intblastCache;
 
+  /**
+   * The range and bitwise constraints (marked by true) computed when
+   * translating a term, used to re-add them after a pop if the translation
+   * cache is kept.
+   */
+  std::unordered_map<Node, std::vector<std::pair<Node, bool>>> d_sideLemmas;
+  /** The skolem definitions computed when translating a term. */
+  std::unordered_map<Node, Node> d_sideSkolems;
+  /** The terms whose side effects were added in the current user context. */
+  context::CDHashSet<Node> d_replayed;
+  /** The term currently being translated, if the translation cache is kept. */
+  Node d_translating;
+
   /** Node manager that is used throughout the pass */
   NodeManager* d_nm;
 
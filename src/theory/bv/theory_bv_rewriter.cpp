@@ -17,6 +17,7 @@
 
 #include "options/bv_options.h"
 #include "theory/arith/arith_poly_norm.h"
+#include "theory/bv/constant_folder.h"
 #include "theory/bv/theory_bv_rewrite_rules.h"
 #include "theory/bv/theory_bv_rewrite_rules_constant_evaluation.h"
 #include "theory/bv/theory_bv_rewrite_rules_core.h"
@@ -72,6 +73,18 @@ TheoryBVRewriter::TheoryBVRewriter(NodeManager* nm) : TheoryRewriter(nm)
 
 RewriteResponse TheoryBVRewriter::preRewrite(TNode node)
 {
+  // Evaluate terms with constant leaves at once, which avoids rewriting each
+  // of their subterms to a constant.
+  if (!node.isConst())
+  {
+    Node c = ConstantFolder::fold(d_nm, node);
+    if (!c.isNull())
+    {
+      Trace("bitvector-rewrite")
+          << "TheoryBV::preRewrite fold " << node << " to " << c << std::endl;
+      return RewriteResponse(REWRITE_DONE, c);
+    }
+  }
   RewriteResponse res =
       d_rewriteTable[static_cast<uint32_t>(node.getKind())](node, true);
   if (res.d_node != node)
@@ -0,0 +1,227 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Word-level propagation of bit-vector facts before bit-blasting.
+ */
+
+#include "theory/bv/word_propagator.h"
+
+#include <algorithm>
+
+#include "theory/bv/theory_bv_utils.h"
+#include "util/bitvector.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+WordPropagator::WordPropagator(Env& env)
+    : EnvObj(env), d_domains(context())
+{
+}
+
+Node WordPropagator::notifyFact(TNode fact)
+{
+  bool pol = fact.getKind() != Kind::NOT;
+  TNode atom = pol ? fact : fact[0];
+  Kind k = atom.getKind();
+  if (k != Kind::EQUAL && k != Kind::BITVECTOR_ULT
+      && k != Kind::BITVECTOR_ULE)
+  {
+    return Node::null();
+  }
+  if (!atom[0].getType().isBitVector()
+      || atom[0].isConst() == atom[1].isConst())
+  {
+    return Node::null();
+  }
+  // whether the constant is on the right-hand side
+  bool constRight = atom[1].isConst();
+  TNode t = constRight ? atom[0] : atom[1];
+  Integer c = (constRight ? atom[1] : atom[0]).getConst<BitVector>().getValue();
+  if (k == Kind::EQUAL)
+  {
+    if (!pol)
+    {
+      Domain d = getDomain(t);
+      if (d.d_lo == c && d.d_hi == c)
+      {
+        return mkConflict({d.d_loReason, d.d_hiReason, fact});
+      }
+      return Node::null();
+    }
+    Node conflict = updateBound(t, c, true, fact);
+    if (conflict.isNull())
+    {
+      conflict = updateBound(t, c, false, fact);
+    }
+    if (conflict.isNull() && t.getKind() == Kind::BITVECTOR_EXTRACT)
+    {
+      conflict = fixBits(t[0],
+                         utils::getExtractHigh(t),
+                         utils::getExtractLow(t),
+                         c,
+                         fact);
+    }
+    return conflict;
+  }
+  // normalize to t >= lo or t <= hi
+  bool strict = (k == Kind::BITVECTOR_ULT);
+  if (!pol)
+  {
+    // (not (t < c)) is c <= t, (not (t <= c)) is c < t
+    strict = !strict;
+    constRight = !constRight;
+  }
+  if (constRight)
+  {
+    // t < c or t <= c
+    if (strict)
+    {
+      if (c.isZero())
+      {
+        return mkConflict({fact});
+      }
+      c = c - 1;
+    }
+    return updateBound(t, c, false, fact);
+  }
+  // c < t or c <= t
+  if (strict)
+  {
+    c = c + 1;
+    if (c == Integer(2).pow(utils::getSize(t)))
+    {
+      return mkConflict({fact});
+    }
+  }
+  return updateBound(t, c, true, fact);
+}
+
+WordPropagator::Domain WordPropagator::getDomain(TNode t) const
+{
+  auto it = d_domains.find(t);
+  if (it != d_domains.end())
+  {
+    return it->second;
+  }
+  Domain d;
+  d.d_lo = Integer(0);
+  d.d_hi = Integer(2).pow(utils::getSize(t)) - 1;
+  d.d_mask = Integer(0);
+  d.d_value = Integer(0);
+  return d;
+}
+
+Node WordPropagator::updateBound(TNode t,
+                                 const Integer& c,
+                                 bool isLower,
+                                 TNode fact)
+{
+  Domain d = getDomain(t);
+  if (isLower ? c <= d.d_lo : c >= d.d_hi)
+  {
+    return Node::null();
+  }
+  if (isLower)
+  {
+    d.d_lo = c;
+    d.d_loReason = fact;
+  }
+  else
+  {
+    d.d_hi = c;
+    d.d_hiReason = fact;
+  }
+  Node conflict = checkDomain(t, d);
+  d_domains[t] = d;
+  return conflict;
+}
+
+Node WordPropagator::fixBits(
+    TNode t, uint32_t high, uint32_t low, const Integer& c, TNode fact)
+{
+  Domain d = getDomain(t);
+  uint32_t width = high - low + 1;
+  Integer mask = (Integer(2).pow(width) - 1).multiplyByPow2(low);
+  Integer value = c.multiplyByPow2(low);
+  Integer common = d.d_mask.bitwiseAnd(mask);
+  if (!common.bitwiseAnd(d.d_value.bitwiseXor(value)).isZero())
+  {
+    std::vector<Node> reasons = d.d_bitReasons;
+    reasons.push_back(fact);
+    return mkConflict(reasons);
+  }
+  if (common == mask)
+  {
+    // no new bits
+    return Node::null();
+  }
+  d.d_mask = d.d_mask.bitwiseOr(mask);
+  d.d_value = d.d_value.bitwiseOr(value);
+  d.d_bitReasons.push_back(fact);
+  Node conflict = checkDomain(t, d);
+  d_domains[t] = d;
+  return conflict;
+}
+
+Node WordPropagator::checkDomain(TNode t, const Domain& d)
+{
+  if (d.d_lo > d.d_hi)
+  {
+    Trace("bv-word-prop") << "empty interval for " << t << std::endl;
+    return mkConflict({d.d_loReason, d.d_hiReason});
+  }
+  if (d.d_mask.isZero())
+  {
+    return Node::null();
+  }
+  // the smallest and largest values with the known bits
+  Integer ones = Integer(2).pow(utils::getSize(t)) - 1;
+  const Integer& minValue = d.d_value;
+  Integer maxValue = d.d_value.bitwiseOr(ones.bitwiseXor(d.d_mask));
+  std::vector<Node> reasons = d.d_bitReasons;
+  if (minValue > d.d_hi)
+  {
+    reasons.push_back(d.d_hiReason);
+  }
+  else if (maxValue < d.d_lo)
+  {
+    reasons.push_back(d.d_loReason);
+  }
+  else
+  {
+    return Node::null();
+  }
+  Trace("bv-word-prop") << "known bits out of bounds for " << t << std::endl;
+  return mkConflict(reasons);
+}
+
+Node WordPropagator::mkConflict(const std::vector<Node>& reasons)
+{
+  std::vector<Node> conj;
+  for (const Node& r : reasons)
+  {
+    if (!r.isNull() && std::find(conj.begin(), conj.end(), r) == conj.end())
+    {
+      conj.push_back(r);
+    }
+  }
+  Assert(!conj.empty());
+  Node conflict = nodeManager()->mkAnd(conj);
+  Trace("bv-word-prop") << "conflict: " << conflict << std::endl;
+  return conflict;
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
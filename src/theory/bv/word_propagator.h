@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Word-level propagation of bit-vector facts before bit-blasting.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__BV__WORD_PROPAGATOR_H
+#define CVC5__THEORY__BV__WORD_PROPAGATOR_H
+
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/integer.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+/**
+ * Maintains an interval and a set of known bits for every bit-vector term
+ * that is compared against a constant in the asserted facts, and detects
+ * conflicts between these facts without bit-blasting them.
+ *
+ * The handled facts are (possibly negated) unsigned comparisons
+ * (bvult, bvule) of a term with a constant, equalities of a term with a
+ * constant, and equalities of extracts of a term with a constant, which fix
+ * the extracted bits of the term. A conflict is found if the interval of a
+ * term becomes empty, if two facts fix a bit to different values, or if the
+ * known bits of a term do not admit a value in its interval.
+ *
+ * The domains are context-dependent and the facts are expected to be
+ * rewritten.
+ */
+class WordPropagator : protected EnvObj
+{
+ public:
+  WordPropagator(Env& env);
+
+  /**
+   * Notify that `fact` was asserted. Returns a conjunction of asserted facts
+   * that is unsatisfiable if a conflict was found, and the null node
+   * otherwise.
+   */
+  Node notifyFact(TNode fact);
+
+ private:
+  /** The domain of a term. */
+  struct Domain
+  {
+    /** The unsigned lower and upper bound of the term. */
+    Integer d_lo;
+    Integer d_hi;
+    /** The facts implying the bounds, null if the bound is trivial. */
+    Node d_loReason;
+    Node d_hiReason;
+    /** The bits fixed to d_value. */
+    Integer d_mask;
+    /** The values of the fixed bits. */
+    Integer d_value;
+    /** The facts fixing the bits. */
+    std::vector<Node> d_bitReasons;
+  };
+  /** Get the current domain of t, initialized to the full domain. */
+  Domain getDomain(TNode t) const;
+  /**
+   * Update the lower (if isLower) or upper bound of t to c, justified by
+   * fact. Returns the conflict if any.
+   */
+  Node updateBound(TNode t, const Integer& c, bool isLower, TNode fact);
+  /**
+   * Fix the bits high to low of t to the bits of c, justified by fact.
+   * Returns the conflict if any.
+   */
+  Node fixBits(
+      TNode t, uint32_t high, uint32_t low, const Integer& c, TNode fact);
+  /** Check whether domain d of t is consistent, returns the conflict if not. */
+  Node checkDomain(TNode t, const Domain& d);
+  /** Make the conjunction of the non-null reasons. */
+  Node mkConflict(const std::vector<Node>& reasons);
+  /** The domains of terms. */
+  context::CDHashMap<Node, Domain> d_domains;
+};
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif
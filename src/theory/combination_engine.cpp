@@ -15,6 +15,7 @@
 
 #include "theory/combination_engine.h"
 
+#include "context/context_stats.h"
 #include "expr/node_visitor.h"
 #include "proof/eager_proof_generator.h"
 #include "theory/care_graph.h"
@@ -60,9 +61,13 @@ CombinationEngine::CombinationEngine(Env& env,
     // for now, the shared solver is the same in both approaches; use the
     // distributed one for now
     d_sharedSolver.reset(new SharedSolverDistributed(env, d_te));
-    // make the central equality engine manager
-    d_eemanager.reset(
-        new EqEngineManagerCentral(env, d_te, *d_sharedSolver.get()));
+    // make the central equality engine manager, which owns the central
+    // equality engine
+    {
+      context::ContextStatistics::OwnerScope owner("EqualityEngine");
+      d_eemanager.reset(
+          new EqEngineManagerCentral(env, d_te, *d_sharedSolver.get()));
+    }
     // make the distributed model manager
     d_mmanager.reset(
         new ModelManagerDistributed(env, d_te, *d_eemanager.get()));
@@ -313,7 +313,10 @@ void SygusExtension::assertTesterInternal(int tindex, TNode n, Node exp)
     std::map<Node, bool> sb_elim_pred;
     bool usingSymCons = d_tds->usingSymbolicConsForEnumerator(m);
     bool isVarAgnostic = d_tds->isVariableAgnosticEnumerator(m);
-    for (unsigned ds = 0; ds <= max_depth; ds++)
+    // The predicates for depths less than min_depth were instantiated for n
+    // when this tester was asserted at a smaller search size, and the lemmas
+    // we sent for them are not removed when the search size increases.
+    for (unsigned ds = min_depth; ds <= max_depth; ds++)
     {
       // static conjecture-independent symmetry breaking
       Trace("sygus-sb-debug") << "  simple symmetry breaking...\n";
@@ -14,8 +14,10 @@
  */
 #include "theory/datatypes/theory_datatypes.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
+#include <unordered_set>
 
 #include "base/check.h"
 #include "expr/codatatype_bound_variable.h"
@@ -58,6 +60,7 @@ TheoryDatatypes::TheoryDatatypes(Env& env,
       d_selector_apps(context()),
       d_initialLemmaCache(userContext()),
       d_functionTerms(context()),
+      d_acyclic(context(), false),
       d_singleton_eq(userContext()),
       d_sygusExtension(nullptr),
       d_rewriter(nodeManager(), env.getEvaluator(), options()),
@@ -458,6 +461,8 @@ void TheoryDatatypes::merge( Node t1, Node t2 ){
   }
   Trace("datatypes-merge") << "Merge " << t1 << " " << t2 << std::endl;
   Assert(d_equalityEngine->areEqual(t1, t2));
+  // the constructor graph changes, cycles must be checked again
+  d_acyclic = false;
   EqcInfo* eqc2 = getOrMakeEqcInfo(t2);
   if (eqc2 == nullptr)
   {
@@ -533,6 +538,26 @@ void TheoryDatatypes::merge( Node t1, Node t2 ){
     eqc1->d_constructor.set(eqc2->d_constructor);
     eqc1->d_selectors.set(eqc2->d_selectors);
   }
+  // Check for a cycle of length one through the constructor of the merged
+  // class, i.e. (= x (C ... x ...)), which is cheap to detect here. Longer
+  // cycles are detected by checkCycles.
+  TNode cons = eqc1->d_constructor.get();
+  if (!cons.isNull() && options().datatypes.dtCyclic
+      && !cons.getType().isCodatatype())
+  {
+    for (const Node& c : cons)
+    {
+      if (d_equalityEngine->hasTerm(c) && d_equalityEngine->areEqual(c, t1))
+      {
+        std::vector<Node> expl;
+        expl.push_back(c.eqNode(cons));
+        Trace("dt-conflict")
+            << "CONFLICT: Cycle conflict on merge : " << expl << std::endl;
+        d_im.sendDtConflict(expl, InferenceId::DATATYPES_CYCLE);
+        return;
+      }
+    }
+  }
 
   // merge labels
   NodeUIntMap::iterator lbl_i = d_labels.find(t2);
@@ -1034,6 +1059,17 @@ bool TheoryDatatypes::collectModelValues(TheoryModel* m,
   std::vector< TypeEnumerator > typ_enum;
   size_t index = 0;
   bool shareSel = options().datatypes.dtSharedSelectors;
+  // If we do not split on enumeration terms, we must assign distinct
+  // constructors to their equivalence classes, see checkSplit.
+  bool lazyEnumSplit = options().datatypes.dtLazyEnumSplit;
+  std::unordered_set<Node> usedEnumCons;
+  if (lazyEnumSplit)
+  {
+    for (const std::pair<const Node, Node>& ec : eqc_cons)
+    {
+      usedEnumCons.insert(ec.second);
+    }
+  }
   while (index < nodes.size())
   {
     Node eqc = nodes[index];
@@ -1056,6 +1092,21 @@ bool TheoryDatatypes::collectModelValues(TheoryModel* m,
       }
       Trace("dt-cmi") << std::endl;
     }
+    if (lazyEnumSplit && utils::isEnumeration(dt))
+    {
+      for (size_t i = 0, psize = pcons.size(); i < psize; i++)
+      {
+        if (pcons[i])
+        {
+          Node c = utils::getInstCons(eqc, dt, i, shareSel);
+          if (usedEnumCons.insert(c).second)
+          {
+            neqc = c;
+            break;
+          }
+        }
+      }
+    }
     for (size_t r = 0; r < 2; r++)
     {
       if (neqc.isNull())
@@ -1279,12 +1330,15 @@ void TheoryDatatypes::checkCycles() {
   std::map< TNode, bool > visited;
   std::map< TNode, bool > proc;
   std::vector<Node> expl;
+  // if the constructor graph did not change since the last check, it is
+  // still acyclic
+  bool checkAcyclic = options().datatypes.dtCyclic && !d_acyclic.get();
   while( !eqcs_i.isFinished() ){
     Node eqc = (*eqcs_i);
     TypeNode tn = eqc.getType();
     if( tn.isDatatype() ) {
       if( !tn.isCodatatype() ){
-        if (options().datatypes.dtCyclic)
+        if (checkAcyclic)
         {
           //do cycle checks
           Trace("datatypes-cycle-check") << "...search for cycle starting at " << eqc << std::endl;
@@ -1315,6 +1369,10 @@ void TheoryDatatypes::checkCycles() {
     }
     ++eqcs_i;
   }
+  if (checkAcyclic)
+  {
+    d_acyclic = true;
+  }
   Trace("datatypes-cycle-check") << "Check uniqueness" << std::endl;
   //process codatatypes
   if (cdt_eqc.size() > 1 && options().datatypes.cdtBisimilar)
@@ -1555,14 +1613,22 @@ void TheoryDatatypes::checkSplit()
   // get the relevant term set, currently all datatype equivalence classes
   // in the equality engine
   std::set<Node> termSetReps;
+  // the number of equivalence classes per enumeration type
+  std::map<TypeNode, size_t> numEnumEqcs;
+  bool lazyEnumSplit = options().datatypes.dtLazyEnumSplit;
   eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(d_equalityEngine);
   while (!eqcs_i.isFinished())
   {
     Node eqc = (*eqcs_i);
     ++eqcs_i;
-    if (eqc.getType().isDatatype())
+    TypeNode tn = eqc.getType();
+    if (tn.isDatatype())
     {
       termSetReps.insert(eqc);
+      if (lazyEnumSplit)
+      {
+        numEnumEqcs[tn]++;
+      }
     }
   }
   std::map<TypeNode, Node> rec_singletons;
@@ -1648,6 +1714,20 @@ void TheoryDatatypes::checkSplit()
     // all other cases
     std::vector<bool> pcons;
     getPossibleCons(eqc, n, pcons);
+    // If n has an enumeration type and has at least as many possible
+    // constructors as there are equivalence classes of its type, we can
+    // always assign it a constructor distinct from the values of all other
+    // equivalence classes when building the model, hence there is no need to
+    // split.
+    if (lazyEnumSplit && !dt.isSygus() && !tn.isCodatatype()
+        && utils::isEnumeration(dt)
+        && std::count(pcons.begin(), pcons.end(), true)
+               >= static_cast<std::ptrdiff_t>(numEnumEqcs[tn]))
+    {
+      Trace("dt-split-debug") << "Do not split enumeration term " << n
+                              << " : " << tn << std::endl;
+      continue;
+    }
     // check if we do not need to resolve the constructor type for this
     // equivalence class.
     // this is if there are no selectors for this equivalence class, and its
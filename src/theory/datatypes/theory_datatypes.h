@@ -22,6 +22,7 @@
 #include <map>
 
 #include "context/cdlist.h"
+#include "context/cdo.h"
 #include "expr/attribute.h"
 #include "expr/node_trie.h"
 #include "theory/care_pair_argument_callback.h"
@@ -145,6 +146,13 @@ private:
   BoolMap d_initialLemmaCache;
   /** All the function terms that the theory has seen */
   context::CDList<TNode> d_functionTerms;
+  /**
+   * Whether the inductive datatype equivalence classes were found to be
+   * acyclic by checkCycles and no datatype equivalence classes were merged
+   * since then. In this case, the constructor graph did not change and the
+   * search for cycles can be skipped.
+   */
+  context::CDO<bool> d_acyclic;
   /** uninterpreted constant to variable map */
   std::map< Node, Node > d_uc_to_fresh_var;
 private:
@@ -161,6 +161,18 @@ bool isNullaryConstructor(const DTypeConstructor& c)
   return true;
 }
 
+bool isEnumeration(const DType& dt)
+{
+  for (size_t i = 0, ncons = dt.getNumConstructors(); i < ncons; i++)
+  {
+    if (dt[i].getNumArgs() > 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool checkClash(Node n1, Node n2, std::vector<Node>& rew, bool checkNdtConst)
 {
   std::vector<size_t> path;
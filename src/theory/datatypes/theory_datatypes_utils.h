@@ -98,6 +98,8 @@ Node mkSplit(Node n, const DType& dt);
 bool isNullaryApplyConstructor(Node n);
 /** returns true iff c is a constructor with no datatype children */
 bool isNullaryConstructor(const DTypeConstructor& c);
+/** returns true iff all constructors of dt have no arguments */
+bool isEnumeration(const DType& dt);
 /** check clash
  *
  * This method returns true if and only if n1 and n2 have a skeleton that has
@@ -15,6 +15,7 @@
 
 #include "theory/ee_manager.h"
 
+#include "context/context_stats.h"
 #include "theory/theory_model.h"
 
 namespace cvc5::internal {
@@ -38,6 +39,7 @@ const EeTheoryInfo* EqEngineManager::getEeTheoryInfo(TheoryId tid) const
 eq::EqualityEngine* EqEngineManager::allocateEqualityEngine(EeSetupInfo& esi,
                                                             context::Context* c)
 {
+  context::ContextStatistics::OwnerScope owner("EqualityEngine");
   if (esi.d_notify != nullptr)
   {
     return new eq::EqualityEngine(
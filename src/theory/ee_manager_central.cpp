@@ -15,6 +15,7 @@
 
 #include "theory/ee_manager_central.h"
 
+#include "context/context_stats.h"
 #include "options/arith_options.h"
 #include "options/theory_options.h"
 #include "smt/env.h"
@@ -113,6 +114,7 @@ void EqEngineManagerCentral::initializeTheories()
     d_masterEENotify.reset(new quantifiers::MasterNotifyClass(qe));
     if (!masterEqToCentral)
     {
+      context::ContextStatistics::OwnerScope owner("EqualityEngine");
       d_masterEqualityEngineAlloc = std::make_unique<eq::EqualityEngine>(
           d_env, c, *d_masterEENotify.get(), "master::ee", false);
       d_masterEqualityEngine = d_masterEqualityEngineAlloc.get();
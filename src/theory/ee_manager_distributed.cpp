@@ -15,6 +15,7 @@
 
 #include "theory/ee_manager_distributed.h"
 
+#include "context/context_stats.h"
 #include "theory/quantifiers_engine.h"
 #include "theory/shared_solver.h"
 #include "theory/theory_engine.h"
@@ -58,6 +59,7 @@ void EqEngineManagerDistributed::initializeTheories()
     QuantifiersEngine* qe = d_te.getQuantifiersEngine();
     Assert(qe != nullptr);
     d_masterEENotify.reset(new quantifiers::MasterNotifyClass(qe));
+    context::ContextStatistics::OwnerScope owner("EqualityEngine");
     d_masterEqualityEngine = std::make_unique<eq::EqualityEngine>(
         d_env, c, *d_masterEENotify.get(), "theory::master", false);
   }
@@ -17,6 +17,8 @@
 
 #include <math.h>
 
+#include <unordered_set>
+
 #include "theory/builtin/theory_builtin_rewriter.h"
 #include "theory/bv/theory_bv_utils.h"
 #include "theory/rewriter.h"
@@ -169,6 +171,139 @@ Node Evaluator::eval(TNode n,
       evalAsNode[p.first] = val;
     }
   }
+  return evalToNode(n, args, vals, evalAsNode, results);
+}
+
+CompiledTerm Evaluator::compile(TNode n, const std::vector<Node>& args) const
+{
+  Trace("evaluator") << "Compiling " << n << " for variables " << args
+                     << std::endl;
+  CompiledTerm ct;
+  ct.d_term = n;
+  ct.d_args = args;
+  std::unordered_set<TNode> argSet(args.begin(), args.end());
+  // Compute the subterms of n that contain one of args. We treat non-constant
+  // operators of parameterized terms as their children, as in evalInternal.
+  std::unordered_map<TNode, bool> visited;
+  std::unordered_map<TNode, bool>::iterator it;
+  std::unordered_set<TNode> hasArg;
+  std::vector<TNode> children;
+  std::vector<TNode> visit;
+  TNode cur;
+  visit.push_back(n);
+  do
+  {
+    cur = visit.back();
+    it = visited.find(cur);
+    if (it == visited.end())
+    {
+      visited[cur] = false;
+      if (cur.getNumChildren() == 0)
+      {
+        visit.pop_back();
+        visited[cur] = true;
+        if (argSet.find(cur) != argSet.end())
+        {
+          hasArg.insert(cur);
+        }
+        continue;
+      }
+      if (cur.getMetaKind() == kind::metakind::PARAMETERIZED
+          && !cur.getOperator().isConst())
+      {
+        visit.push_back(cur.getOperator());
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+    else if (!it->second)
+    {
+      visit.pop_back();
+      it->second = true;
+      children.clear();
+      if (cur.getMetaKind() == kind::metakind::PARAMETERIZED
+          && !cur.getOperator().isConst())
+      {
+        children.push_back(cur.getOperator());
+      }
+      children.insert(children.end(), cur.begin(), cur.end());
+      for (TNode c : children)
+      {
+        if (hasArg.find(c) != hasArg.end())
+        {
+          hasArg.insert(cur);
+          break;
+        }
+      }
+    }
+    else
+    {
+      visit.pop_back();
+    }
+  } while (!visit.empty());
+  // The maximal subterms without variables are the children of the subterms
+  // containing a variable that themselves do not contain one, or n itself.
+  // Leaves are cheap to evaluate and are not cached.
+  std::vector<TNode> ground;
+  if (hasArg.find(n) == hasArg.end())
+  {
+    ground.push_back(n);
+  }
+  for (TNode t : hasArg)
+  {
+    if (t.getMetaKind() == kind::metakind::PARAMETERIZED
+        && !t.getOperator().isConst()
+        && hasArg.find(t.getOperator()) == hasArg.end())
+    {
+      ground.push_back(t.getOperator());
+    }
+    for (TNode tc : t)
+    {
+      if (hasArg.find(tc) == hasArg.end())
+      {
+        ground.push_back(tc);
+      }
+    }
+  }
+  std::vector<Node> noArgs;
+  std::unordered_map<TNode, Node> evalAsNode;
+  std::unordered_map<TNode, EvalResult> results;
+  for (TNode g : ground)
+  {
+    if (g.getNumChildren() == 0 || ct.d_results.find(g) != ct.d_results.end())
+    {
+      continue;
+    }
+    EvalResult res = evalInternal(g, noArgs, noArgs, evalAsNode, results);
+    ct.d_results[g] = res;
+    if (res.d_tag == EvalResult::INVALID)
+    {
+      Assert(evalAsNode.find(g) != evalAsNode.end());
+      ct.d_evalAsNode[g] = evalAsNode[g];
+    }
+  }
+  Trace("evaluator") << "...cached " << ct.d_results.size() << " subterms"
+                     << std::endl;
+  return ct;
+}
+
+Node Evaluator::eval(const CompiledTerm& ct,
+                     const std::vector<Node>& vals) const
+{
+  Assert(ct.d_args.size() == vals.size());
+  Trace("evaluator") << "Evaluating compiled " << ct.d_term
+                     << " under substitution " << ct.d_args << " " << vals
+                     << std::endl;
+  std::unordered_map<TNode, Node> evalAsNode = ct.d_evalAsNode;
+  std::unordered_map<TNode, EvalResult> results = ct.d_results;
+  return evalToNode(ct.d_term, ct.d_args, vals, evalAsNode, results);
+}
+
+Node Evaluator::evalToNode(TNode n,
+                           const std::vector<Node>& args,
+                           const std::vector<Node>& vals,
+                           std::unordered_map<TNode, Node>& evalAsNode,
+                           std::unordered_map<TNode, EvalResult>& results) const
+{
   Trace("evaluator") << "Run eval internal..." << std::endl;
   Node ret =
       evalInternal(n, args, vals, evalAsNode, results).toNode(n.getType());
@@ -21,6 +21,7 @@
 #ifndef CVC5__THEORY__EVALUATOR_H
 #define CVC5__THEORY__EVALUATOR_H
 
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -83,10 +84,44 @@ struct EvalResult
 
 class Rewriter;
 
+/**
+ * A term prepared for repeated evaluation under substitutions of a fixed list
+ * of variables, see Evaluator::compile. The maximal subterms of the term that
+ * do not contain any of these variables are evaluated once when the term is
+ * compiled. Their results are reused by all later evaluations, which only
+ * traverse the part of the term that depends on the variables.
+ */
+class CompiledTerm
+{
+  friend class Evaluator;
+
+ public:
+  CompiledTerm() {}
+  /** Get the compiled term. */
+  const Node& getTerm() const { return d_term; }
+  /** Get the variables of the substitutions the term is evaluated under. */
+  const std::vector<Node>& getVariables() const { return d_args; }
+  /** Get the number of subterms whose evaluation is cached. */
+  size_t getNumCached() const { return d_results.size(); }
+
+ private:
+  /** The compiled term, which keeps the keys of the maps below alive. */
+  Node d_term;
+  /** The variables of the substitutions. */
+  std::vector<Node> d_args;
+  /** The evaluation results of the maximal subterms without variables. */
+  std::unordered_map<TNode, EvalResult> d_results;
+  /**
+   * The results of substitution and rewriting for the subterms of d_results
+   * with invalid evaluation results.
+   */
+  std::unordered_map<TNode, Node> d_evalAsNode;
+};
+
 /**
  * The class that performs the actual evaluation of a term under a
- * substitution. Right now, the class does not cache anything between different
- * calls to `eval` but this might change in the future.
+ * substitution. The class does not cache anything between different calls to
+ * `eval`, except for a term that is compiled beforehand, see compile().
  */
 class Evaluator
 {
@@ -125,8 +160,29 @@ class Evaluator
             const std::vector<Node>& args,
             const std::vector<Node>& vals,
             const std::unordered_map<Node, Node>& visited) const;
+  /**
+   * Compile node `n` for evaluating it under many substitutions of the
+   * variables `args`, which evaluates the subterms of `n` that do not contain
+   * any of `args`. The result must only be evaluated with this evaluator.
+   */
+  CompiledTerm compile(TNode n, const std::vector<Node>& args) const;
+  /**
+   * Same as eval(ct.getTerm(), ct.getVariables(), vals), but reusing the
+   * evaluation of the subterms cached by `ct`.
+   */
+  Node eval(const CompiledTerm& ct, const std::vector<Node>& vals) const;
 
  private:
+  /**
+   * Evaluates node `n` under the substitution `args` -> `vals` given the
+   * results and evaluations as node of some of its subterms, and converts the
+   * result to a node as described in eval() above.
+   */
+  Node evalToNode(TNode n,
+                  const std::vector<Node>& args,
+                  const std::vector<Node>& vals,
+                  std::unordered_map<TNode, Node>& evalAsNode,
+                  std::unordered_map<TNode, EvalResult>& results) const;
   /**
    * Evaluates node `n` under the substitution described by the variable names
    * `args` and the corresponding values `vals`. The internal version returns
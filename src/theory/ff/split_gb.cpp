@@ -97,12 +97,14 @@ SplitGb splitGb(const std::vector<Polys>& generatorSets,
   size_t k = generatorSets.size();
   std::vector<Polys> newPolys(generatorSets);
   SplitGb splitBasis(k);
+  std::vector<bool> changed(k);
   do
   {
     // add newPolys to each basis
     for (size_t i = 0; i < k; ++i)
     {
-      if (newPolys[i].size())
+      changed[i] = !newPolys[i].empty();
+      if (changed[i])
       {
         Polys newGens{};
 
@@ -117,9 +119,17 @@ SplitGb splitGb(const std::vector<Polys>& generatorSets,
     }
 
     // compute polys that can be shared
+    //
+    // The generators of an unchanged basis were already offered to the other
+    // bases when it was last computed. Since ideals only grow, those that
+    // were admitted are still contained, so we only share changed bases.
     Polys toPropagate = bitProp.getBitEqualities(splitBasis);
     for (size_t i = 0; i < k; ++i)
     {
+      if (!changed[i])
+      {
+        continue;
+      }
       const auto& basis = splitBasis[i].basis();
       std::copy(basis.begin(), basis.end(), std::back_inserter(toPropagate));
     }
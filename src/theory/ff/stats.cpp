@@ -31,9 +31,10 @@ FfStatistics::FfStatistics(StatisticsRegistry& registry,
       d_modelConstructionTime(
           registry.registerTimer(prefix + "model_construction_time")),
       d_numConstructionErrors(
-          registry.registerInt(prefix + "num_construction_errors"))
+          registry.registerInt(prefix + "num_construction_errors")),
+      d_numModelReuses(registry.registerInt(prefix + "num_model_reuses"))
 {
-  Trace("ff::stats") << "ff registered 4 stats" << std::endl;
+  Trace("ff::stats") << "ff registered 5 stats" << std::endl;
 }
 
 }  // namespace ff
@@ -44,6 +44,10 @@ struct FfStatistics
    * Number of times that model construction gave an error
    */
   IntStat d_numConstructionErrors;
+  /**
+   * Number of full checks answered by the model of a previous check
+   */
+  IntStat d_numModelReuses;
 
   FfStatistics(StatisticsRegistry& reg, const std::string& prefix);
 };
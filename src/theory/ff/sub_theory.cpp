@@ -61,13 +61,23 @@ void SubTheory::notifyFact(TNode fact) { d_facts.emplace_back(fact); }
 
 Result SubTheory::postCheck(Theory::Effort e)
 {
-  d_conflict.clear();
-  d_model.clear();
+  // the basis is not maintained across checks, but the model of the last
+  // check is, if it is still a model of the current facts
+  if (e == Theory::EFFORT_FULL && d_conflict.empty() && !d_model.empty()
+      && modelSatisfiesFacts())
+  {
+    Trace("ff::gb") << "Reusing model of last check" << std::endl;
+    ++d_stats->d_numModelReuses;
+    return Result::SAT;
+  }
   // on some branches, we'll overwrite this result
   Result result = {
       Result::UNKNOWN, UnknownExplanation::UNKNOWN_REASON, "internal"};
   if (e == Theory::EFFORT_FULL)
   {
+    // only cleared here, so that the model can be reused by the next check
+    d_conflict.clear();
+    d_model.clear();
     try
     {
       if (d_facts.empty()) return Result::SAT;
@@ -210,6 +220,27 @@ void SubTheory::setTrivialConflict()
   std::copy(d_facts.begin(), d_facts.end(), std::back_inserter(d_conflict));
 }
 
+bool SubTheory::modelSatisfiesFacts()
+{
+  std::vector<Node> vars;
+  std::vector<Node> values;
+  for (const auto& [var, value] : d_model)
+  {
+    vars.push_back(var);
+    values.push_back(value);
+  }
+  for (const Node& fact : d_facts)
+  {
+    Node value = rewrite(
+        fact.substitute(vars.begin(), vars.end(), values.begin(), values.end()));
+    if (!value.isConst() || !value.getConst<bool>())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool SubTheory::inConflict() const { return !d_conflict.empty(); }
 
 const std::vector<Node>& SubTheory::conflict() const { return d_conflict; }
@@ -102,6 +102,15 @@ class SubTheory : protected EnvObj, public FieldObj
    */
   void setTrivialConflict();
 
+  /**
+   * Does the current model satisfy all facts? That is, does each fact
+   * rewrite to true after substituting the values of d_model?
+   *
+   * Used to answer a full check without computing a new Groebner basis, e.g.,
+   * when facts were added that the model of the last check already satisfies.
+   */
+  bool modelSatisfiesFacts();
+
   /**
    * Facts, in notification order.
    *
@@ -735,9 +735,12 @@ TypeNode floatingPointTypeInfo::getTypeNode(NodeManager* nm) const
 }
 }  // namespace symfpuSymbolic
 
-FpWordBlaster::FpWordBlaster(NodeManager* nm, context::UserContext* user)
+FpWordBlaster::FpWordBlaster(NodeManager* nm,
+                             context::UserContext* user,
+                             bool lazyMulDiv)
     : d_additionalAssertions(user),
       d_nm(nm),
+      d_lazyMulDiv(lazyMulDiv),
       d_fpMap(user),
       d_rmMap(user),
       d_boolMap(user),
@@ -805,7 +808,10 @@ Node FpWordBlaster::sbvToNode(const sbv& s) const { return s; }
 FpWordBlaster::uf FpWordBlaster::buildComponents(TNode current)
 {
   Assert(Theory::isLeafOf(current, THEORY_FP)
-         || current.getKind() == Kind::FLOATINGPOINT_TO_FP_FROM_REAL);
+         || current.getKind() == Kind::FLOATINGPOINT_TO_FP_FROM_REAL
+         || (d_lazyMulDiv
+             && (current.getKind() == Kind::FLOATINGPOINT_MULT
+                 || current.getKind() == Kind::FLOATINGPOINT_DIV)));
 
   uf tmp(
       NodeManager::mkNode(Kind::FLOATINGPOINT_COMPONENT_NAN, current),
@@ -1023,6 +1029,12 @@ Node FpWordBlaster::wordBlast(TNode node)
               Assert(d_rmMap.find(cur[0]) != d_rmMap.end());
               Assert(d_fpMap.find(cur[1]) != d_fpMap.end());
               Assert(d_fpMap.find(cur[2]) != d_fpMap.end());
+              if (d_lazyMulDiv)
+              {
+                // refined on demand, see wordBlastRefinement
+                d_fpMap.insert(cur, buildComponents(cur));
+                break;
+              }
               d_fpMap.insert(
                   cur,
                   symfpu::multiply<traits>(fpt(t),
@@ -1035,6 +1047,12 @@ Node FpWordBlaster::wordBlast(TNode node)
               Assert(d_rmMap.find(cur[0]) != d_rmMap.end());
               Assert(d_fpMap.find(cur[1]) != d_fpMap.end());
               Assert(d_fpMap.find(cur[2]) != d_fpMap.end());
+              if (d_lazyMulDiv)
+              {
+                // refined on demand, see wordBlastRefinement
+                d_fpMap.insert(cur, buildComponents(cur));
+                break;
+              }
               d_fpMap.insert(
                   cur,
                   symfpu::divide<traits>(fpt(t),
@@ -1290,6 +1308,9 @@ Node FpWordBlaster::getValue(Valuation& val, TNode var)
          || var.getKind() == Kind::FLOATINGPOINT_TO_FP_FROM_UBV
          || var.getKind() == Kind::FLOATINGPOINT_TO_FP_FROM_REAL
          || var.getKind() == Kind::FLOATINGPOINT_TO_FP_FROM_IEEE_BV
+         || (d_lazyMulDiv
+             && (var.getKind() == Kind::FLOATINGPOINT_MULT
+                 || var.getKind() == Kind::FLOATINGPOINT_DIV))
          || Theory::isLeafOf(var, THEORY_FP));
 
   TypeNode t(var.getType());
@@ -1316,6 +1337,29 @@ Node FpWordBlaster::getValue(Valuation& val, TNode var)
   return ufToNode(fpt(t), (*i).second);
 }
 
+Node FpWordBlaster::wordBlastRefinement(TNode node)
+{
+  Kind k = node.getKind();
+  Assert(d_lazyMulDiv
+         && (k == Kind::FLOATINGPOINT_MULT || k == Kind::FLOATINGPOINT_DIV));
+  // ensures that node and its arguments are word-blasted
+  wordBlast(node);
+
+  symfpuSymbolic::SymFpuNM snm(d_nm);
+  fpt format(node.getType());
+  Assert(d_rmMap.find(node[0]) != d_rmMap.end());
+  Assert(d_fpMap.find(node[1]) != d_fpMap.end());
+  Assert(d_fpMap.find(node[2]) != d_fpMap.end());
+  rm r = (*d_rmMap.find(node[0])).second;
+  uf a = (*d_fpMap.find(node[1])).second;
+  uf b = (*d_fpMap.find(node[2])).second;
+  uf circuit = k == Kind::FLOATINGPOINT_MULT
+                   ? symfpu::multiply<traits>(format, r, a, b)
+                   : symfpu::divide<traits>(format, r, a, b);
+  return propToNode(symfpu::smtlibEqual<traits>(
+      format, (*d_fpMap.find(node)).second, circuit));
+}
+
 }  // namespace fp
 }  // namespace theory
 }  // namespace cvc5::internal
@@ -300,8 +300,13 @@ class floatingPointTypeInfo : public FloatingPointSize
 class FpWordBlaster
 {
  public:
-  /** Constructor. */
-  FpWordBlaster(NodeManager* nm, context::UserContext*);
+  /**
+   * Constructor. If lazyMulDiv is true, fp.mul and fp.div terms are
+   * word-blasted as if they were variables, see wordBlastRefinement.
+   */
+  FpWordBlaster(NodeManager* nm,
+                context::UserContext*,
+                bool lazyMulDiv = false);
   /** Destructor. */
   ~FpWordBlaster();
 
@@ -314,6 +319,14 @@ class FpWordBlaster
    */
   Node getValue(Valuation&, TNode);
 
+  /**
+   * Get the lemma that gives the (word-blasted) semantics of fp.mul or fp.div
+   * term node, which has been word-blasted as if it were a variable. That is,
+   * the lemma equates the components of node with the value of the circuit
+   * of its operation over the components of its arguments.
+   */
+  Node wordBlastRefinement(TNode node);
+
   context::CDList<Node> d_additionalAssertions;
 
  protected:
@@ -332,6 +345,8 @@ class FpWordBlaster
   typedef context::CDHashMap<Node, sbv> sbvMap;
 
   NodeManager* d_nm;
+  /** Are fp.mul and fp.div word-blasted lazily? */
+  bool d_lazyMulDiv;
   fpMap d_fpMap;
   rmMap d_rmMap;
   boolMap d_boolMap;
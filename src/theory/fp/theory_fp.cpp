@@ -42,9 +42,11 @@ namespace fp {
 /** Constructs a new instance of TheoryFp w.r.t. the provided contexts. */
 TheoryFp::TheoryFp(Env& env, OutputChannel& out, Valuation valuation)
     : Theory(THEORY_FP, env, out, valuation),
-      d_wordBlaster(new FpWordBlaster(nodeManager(), userContext())),
+      d_wordBlaster(new FpWordBlaster(
+          nodeManager(), userContext(), options().fp.fpLazyMulDiv)),
       d_registeredTerms(userContext()),
       d_abstractionMap(userContext()),
+      d_refinedTerms(userContext()),
       d_rewriter(nodeManager(), userContext(), options().fp.fpExp),
       d_state(env, valuation),
       d_im(env, *this, d_state, "theory::fp::", true),
@@ -369,6 +371,40 @@ bool TheoryFp::refineAbstraction(TheoryModel *m, TNode abstract, TNode concrete)
       return false;
     }
   }
+  else if (k == Kind::FLOATINGPOINT_MULT || k == Kind::FLOATINGPOINT_DIV)
+  {
+    Assert(abstract == concrete);
+    if (d_refinedTerms.contains(concrete))
+    {
+      return false;
+    }
+    // The value of the term according to its word-blasted components
+    Node wordBlasted = d_wordBlaster->getValue(d_valuation, concrete);
+    Node abstractValue =
+        wordBlasted.isNull() ? wordBlasted : m->getValue(wordBlasted);
+    // The value of the operation applied to the values of the arguments
+    Node concreteValue = rewrite(nm->mkNode(k,
+                                            m->getValue(concrete[0]),
+                                            m->getValue(concrete[1]),
+                                            m->getValue(concrete[2])));
+    Assert(concreteValue.isConst());
+
+    Trace("fp-refineAbstraction")
+        << "TheoryFp::refineAbstraction(): " << concrete << " = "
+        << abstractValue << ", expected " << concreteValue << std::endl;
+
+    if (abstractValue == concreteValue)
+    {
+      // No refinement needed
+      return false;
+    }
+    d_refinedTerms.insert(concrete);
+    // ensure the components of concrete and its arguments are constrained
+    wordBlastAndEquateTerm(concrete);
+    handleLemma(d_wordBlaster->wordBlastRefinement(concrete),
+                InferenceId::FP_LAZY_REFINE);
+    return true;
+  }
   else
   {
     Unreachable() << "Unknown abstraction";
@@ -569,6 +605,12 @@ void TheoryFp::registerTerm(TNode node)
     // TODO : rounding-mode specific bounds on floats that don't give infinity
     // BEWARE of directed rounding!   #1914
   }
+  else if (options().fp.fpLazyMulDiv
+           && (k == Kind::FLOATINGPOINT_MULT || k == Kind::FLOATINGPOINT_DIV))
+  {
+    // word-blasted as a variable below, refined in postCheck when needed
+    d_abstractionMap.insert(node, node);
+  }
 
   /* When not word-blasting lazier, we word-blast every term on
    * registration. */
@@ -119,8 +119,13 @@ class TheoryFp : public Theory
   /** The terms registered via registerTerm(). */
   context::CDHashSet<Node> d_registeredTerms;
 
-  /** Map abstraction skolem to abstracted FP_TO_REAL/FP_FROM_REAL node. */
+  /**
+   * Map abstraction skolem to abstracted FP_TO_REAL/FP_FROM_REAL node. With
+   * --fp-lazy-mul-div, this also maps fp.mul and fp.div terms to themselves.
+   */
   AbstractionMap d_abstractionMap;  // abstract -> original
+  /** The fp.mul and fp.div terms whose semantics were word-blasted. */
+  context::CDHashSet<Node> d_refinedTerms;
 
   /** The theory rewriter for this theory. */
   TheoryFpRewriter d_rewriter;
@@ -57,6 +57,7 @@ const char* toString(InferenceId i)
     case InferenceId::ARITH_APPROX_CUT: return "ARITH_APPROX_CUT";
     case InferenceId::ARITH_BB_LEMMA: return "ARITH_BB_LEMMA";
     case InferenceId::ARITH_DIO_CUT: return "ARITH_DIO_CUT";
+    case InferenceId::ARITH_GOMORY_CUT: return "ARITH_GOMORY_CUT";
     case InferenceId::ARITH_DIO_DECOMPOSITION: return "ARITH_DIO_DECOMPOSITION";
     case InferenceId::ARITH_UNATE: return "ARITH_UNATE";
     case InferenceId::ARITH_ROW_IMPL: return "ARITH_ROW_IMPL";
@@ -125,6 +126,7 @@ const char* toString(InferenceId i)
     case InferenceId::ARRAYS_READ_OVER_WRITE: return "ARRAYS_READ_OVER_WRITE";
     case InferenceId::ARRAYS_READ_OVER_WRITE_1: return "ARRAYS_READ_OVER_WRITE_1";
     case InferenceId::ARRAYS_READ_OVER_WRITE_CONTRA: return "ARRAYS_READ_OVER_WRITE_CONTRA";
+    case InferenceId::ARRAYS_WEAK_EQUIV: return "ARRAYS_WEAK_EQUIV";
     case InferenceId::ARRAYS_CONST_ARRAY_DEFAULT:
       return "ARRAYS_CONST_ARRAY_DEFAULT";
     case InferenceId::ARRAYS_EQ_TAUTOLOGY: return "ARRAYS_EQ_TAUTOLOGY";
@@ -143,6 +145,7 @@ const char* toString(InferenceId i)
     case InferenceId::BAGS_DIFFERENCE_SUBTRACT:
       return "BAGS_DIFFERENCE_SUBTRACT";
     case InferenceId::BAGS_DIFFERENCE_REMOVE: return "BAGS_DIFFERENCE_REMOVE";
+    case InferenceId::BAGS_COUNT_VECTOR: return "BAGS_COUNT_VECTOR";
     case InferenceId::BAGS_SETOF: return "BAGS_SETOF";
     case InferenceId::BAGS_MAP_DOWN: return "BAGS_MAP_DOWN";
     case InferenceId::BAGS_MAP_DOWN_INJECTIVE: return "BAGS_MAP_DOWN_INJECTIVE";
@@ -222,6 +225,7 @@ const char* toString(InferenceId i)
     case InferenceId::FP_PREPROCESS: return "FP_PREPROCESS";
     case InferenceId::FP_EQUATE_TERM: return "FP_EQUATE_TERM";
     case InferenceId::FP_REGISTER_TERM: return "FP_REGISTER_TERM";
+    case InferenceId::FP_LAZY_REFINE: return "FP_LAZY_REFINE";
 
     case InferenceId::QUANTIFIERS_INST_E_MATCHING:
       return "QUANTIFIERS_INST_E_MATCHING";
@@ -94,6 +94,8 @@ enum class InferenceId
   ARITH_APPROX_CUT,
   ARITH_BB_LEMMA,
   ARITH_DIO_CUT,
+  // Gomory mixed-integer cut from a row of the simplex tableau
+  ARITH_GOMORY_CUT,
   ARITH_DIO_DECOMPOSITION,
   // unate lemma during presolve
   ARITH_UNATE,
@@ -200,6 +202,9 @@ enum class InferenceId
   ARRAYS_READ_OVER_WRITE,
   ARRAYS_READ_OVER_WRITE_1,
   ARRAYS_READ_OVER_WRITE_CONTRA,
+  // two reads at equal indices of arrays that are weakly equivalent on that
+  // index are equal, see the weak equivalence procedure of Christ/Hoenicke
+  ARRAYS_WEAK_EQUIV,
   // (= (select (as const (Array T1 T2) x) y) x)
   ARRAYS_CONST_ARRAY_DEFAULT,
   // an internally inferred tautological equality
@@ -220,6 +225,9 @@ enum class InferenceId
   BAGS_INTERSECTION_MIN,
   BAGS_DIFFERENCE_SUBTRACT,
   BAGS_DIFFERENCE_REMOVE,
+  // multiplicities of a bag term computed from the constant multiplicities of
+  // its children, for several elements at once
+  BAGS_COUNT_VECTOR,
   BAGS_SETOF,
   BAGS_MAP_DOWN,
   BAGS_MAP_DOWN_INJECTIVE,
@@ -327,6 +335,8 @@ enum class InferenceId
   FP_EQUATE_TERM,
   // a lemma sent during TheoryFp::registerTerm
   FP_REGISTER_TERM,
+  // the word-blasted semantics of a lazily word-blasted fp.mul or fp.div term
+  FP_LAZY_REFINE,
   //-------------------------------------- end floating point theory
 
   //-------------------------------------- quantifiers theory
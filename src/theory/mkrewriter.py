@@ -39,6 +39,7 @@ class CodeGenerator:
         self.post_rewrite_get_cache = ""
         self.pre_rewrite_set_cache = ""
         self.post_rewrite_set_cache = ""
+        self.rewrite_cache_attribute_ids = ""
 
         current_year = date.today().year
         self.copyright = f"2010-{current_year}"
@@ -51,6 +52,7 @@ class CodeGenerator:
         self.post_rewrite_get_cache_replacement_pattern = b'${post_rewrite_get_cache}'
         self.pre_rewrite_set_cache_replacement_pattern = b'${pre_rewrite_set_cache}'
         self.post_rewrite_set_cache_replacement_pattern = b'${post_rewrite_set_cache}'
+        self.rewrite_cache_attribute_ids_replacement_pattern = b'${rewrite_cache_attribute_ids}'
 
         self.file_header = f"""/******************************************************************************
  * This file is part of the cvc5 project.
@@ -103,6 +105,8 @@ class CodeGenerator:
         self.pre_rewrite_set_cache += f"    case {theory_id}: return RewriteAttibute<{theory_id}>::setPreRewriteCache(node, cache);\n"
         self.post_rewrite_get_cache += f"    case {theory_id}: return RewriteAttibute<{theory_id}>::getPostRewriteCache(node);\n"
         self.post_rewrite_set_cache += f"    case {theory_id}: return RewriteAttibute<{theory_id}>::setPostRewriteCache(node, cache);\n"
+        self.rewrite_cache_attribute_ids += f"  d_cacheAttrIds.push_back(expr::attr::AttributeManager::getAttributeId(RewriteAttibute<{theory_id}>::pre_rewrite()));\n"
+        self.rewrite_cache_attribute_ids += f"  d_cacheAttrIds.push_back(expr::attr::AttributeManager::getAttributeId(RewriteAttibute<{theory_id}>::post_rewrite()));\n"
 
     def generate_code_for_rewriter_includes(self, rewriter_include):
         self.rewriter_includes += f"#include \"{rewriter_include}\"\n"
@@ -118,6 +122,8 @@ class CodeGenerator:
                            self.post_rewrite_get_cache)
         self.fill_template(self.post_rewrite_set_cache_replacement_pattern,
                            self.post_rewrite_set_cache)
+        self.fill_template(self.rewrite_cache_attribute_ids_replacement_pattern,
+                           self.rewrite_cache_attribute_ids)
 
     def fill_template(self, target_pattern, replacement_string):
         self.template_data = self.template_data.replace(
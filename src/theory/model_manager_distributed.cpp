@@ -96,7 +96,13 @@ bool ModelManagerDistributed::prepareModel()
     t->collectAssertedTermsForModel(termSet);
     // also get relevant terms
     t->computeRelevantTerms(termSet);
-    if (!t->collectModelInfo(d_model.get(), termSet))
+    bool success;
+    {
+      TheoryProfile::Scope ps(
+          d_te.getProfile(), theoryId, TheoryProfileOp::COLLECT_MODEL_INFO);
+      success = t->collectModelInfo(d_model.get(), termSet);
+    }
+    if (!success)
     {
       Trace("model-builder")
           << "ModelManagerDistributed: fail collect model info" << std::endl;
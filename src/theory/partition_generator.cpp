@@ -208,9 +208,13 @@ std::vector<Node> PartitionGenerator::collectLiterals(LiteralListType litType)
   return filteredLiterals;
 }
 
-void PartitionGenerator::emitPartition(Node toEmit)
+void PartitionGenerator::emitPartition(Node toEmit, Node partition)
 {
-  *options().parallel.partitionsOut << toEmit << std::endl;
+  if (!options().parallel.solvePartitions)
+  {
+    *options().parallel.partitionsOut << toEmit << std::endl;
+  }
+  d_emittedPartitions.push_back(partition.isNull() ? toEmit : partition);
   ++d_numPartitionsSoFar;
   d_createdAnyPartitions = true;
 }
@@ -399,7 +403,7 @@ Node PartitionGenerator::makeCubePartitions(LiteralListType litType,
         std::vector<Node> zllLiterals = collectLiterals(ZLL);
         zllLiterals.push_back(conj);
         Node zllConj = nodeManager()->mkAnd(zllLiterals);
-        emitPartition(zllConj);
+        emitPartition(zllConj, conj);
       }
       else
       {
@@ -438,7 +442,7 @@ void PartitionGenerator::emitRemainingPartitions(bool solved)
       zllLiterals.pop_back();
     }
 
-    emitPartition(lemma);
+    emitPartition(lemma, partition);
   }
 
   // If the problem has been solved, then there is no need to emit
@@ -454,14 +458,15 @@ void PartitionGenerator::emitRemainingPartitions(bool solved)
     }
 
     Node finalPartition = nodeManager()->mkAnd(nots);
+    Node toEmit = finalPartition;
 
     if (emitZLL)
     {
       zllLiterals.push_back(finalPartition);
-      finalPartition = nodeManager()->mkAnd(zllLiterals);
+      toEmit = nodeManager()->mkAnd(zllLiterals);
     }
 
-    emitPartition(finalPartition);
+    emitPartition(toEmit, finalPartition);
   }
 }
 
@@ -562,6 +567,11 @@ void PartitionGenerator::check(Theory::Effort e)
   }
 }
 
+std::vector<Node> PartitionGenerator::getPartitionsToSolve() const
+{
+  return d_emittedAllPartitions ? d_emittedPartitions : d_scatterPartitions;
+}
+
 void PartitionGenerator::postsolve(prop::SatValue result)
 {
   // Handle emitting pending partitions.
@@ -63,6 +63,16 @@ class PartitionGenerator : public TheoryEngineModule
                    const std::vector<Node>& skAsserts,
                    const std::vector<Node>& sks) override;
 
+  /**
+   * Get the partitions that remain to be solved after the check of the
+   * partitioning solver answered unsat. If all partitions have been emitted,
+   * which ends the check with unsat, these are all partitions. Otherwise,
+   * these are the scatter partitions created so far, whose cubes were blocked
+   * off from the search. The partitions do not include the zero-level learned
+   * literals appended with append-learned-literals-to-cubes.
+   */
+  std::vector<Node> getPartitionsToSolve() const;
+
  private:
   /* LiteralListType is used to specify where to pull literals from when calling
    * collectLiterals. HEAP for the order_heap in the SAT solver, DECISION for
@@ -77,10 +87,12 @@ class PartitionGenerator : public TheoryEngineModule
     ZLL
   };
   /**
-   * Increment d_numPartitionsSoFar and print the cube to 
-   * the output file specified by --write-partitions-to. 
+   * Increment d_numPartitionsSoFar and print the cube to
+   * the output file specified by --write-partitions-to, unless the partitions
+   * are solved with solve-partitions. The partition without zero-level
+   * learned literals is given by partition, if it differs from toEmit.
    */
-  void emitPartition(Node toEmit);
+  void emitPartition(Node toEmit, Node partition = Node::null());
 
   /**
    * Emit any remaining partitions that were not emitted during solving.
@@ -225,6 +237,11 @@ bool d_createdAnyPartitions;
  */
 bool d_emittedAllPartitions;
 
+/**
+ * The partitions that have been emitted, without zero-level learned literals.
+ */
+std::vector<Node> d_emittedPartitions;
+
 /**
  * Track lemma literals that we have seen and their frequency.
  */
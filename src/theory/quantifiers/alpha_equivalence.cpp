@@ -20,6 +20,8 @@
 #include "proof/proof.h"
 #include "proof/proof_node.h"
 #include "theory/builtin/proof_checker.h"
+#include "theory/quantifiers/term_util.h"
+#include "util/hash.h"
 
 using namespace cvc5::internal::kind;
 
@@ -86,17 +88,15 @@ AlphaEquivalenceDb::AlphaEquivalenceDb(context::Context* c,
     : d_context(c),
       d_ae_typ_trie(c),
       d_tc(tc),
-      d_sortCommutativeOpChildren(sortCommChildren)
+      d_sortCommutativeOpChildren(sortCommChildren),
+      d_fpQuant(c)
 {
 }
 Node AlphaEquivalenceDb::addTerm(Node q)
 {
   Assert(q.getKind() == Kind::FORALL);
   Trace("aeq") << "Alpha equivalence : register " << q << std::endl;
-  //construct canonical quantified formula
-  Node t = d_tc->getCanonicalTerm(q[1], d_sortCommutativeOpChildren);
-  Trace("aeq") << "  canonical form: " << t << std::endl;
-  return addTermToTypeTrie(t, q);
+  return addTermInternal(q, false);
 }
 
 Node AlphaEquivalenceDb::addTermWithSubstitution(Node q,
@@ -104,23 +104,12 @@ Node AlphaEquivalenceDb::addTermWithSubstitution(Node q,
                                                  std::vector<Node>& subs)
 {
   Trace("aeq") << "Alpha equivalence : register " << q << std::endl;
-  // construct canonical quantified formula with visited cache
-  std::map<TNode, Node> visited;
-  Node t = d_tc->getCanonicalTerm(q[1], visited, d_sortCommutativeOpChildren);
-  // only need to store BOUND_VARIABLE in substitution
-  std::map<Node, TNode>& bm = d_bvmap[q];
-  for (const std::pair<const TNode, Node>& b : visited)
-  {
-    if (b.first.getKind() == Kind::BOUND_VARIABLE)
-    {
-      Assert(b.second.getKind() == Kind::BOUND_VARIABLE);
-      bm[b.second] = b.first;
-    }
-  }
-  Node qret = addTermToTypeTrie(t, q);
+  Node qret = addTermInternal(q, true);
   if (qret != q)
   {
     Assert(d_bvmap.find(qret) != d_bvmap.end());
+    Assert(d_bvmap.find(q) != d_bvmap.end());
+    std::map<Node, TNode>& bm = d_bvmap[q];
     std::map<Node, TNode>& bmr = d_bvmap[qret];
     std::map<Node, TNode>::iterator itb;
     for (const std::pair<const Node, TNode>& b : bmr)
@@ -142,6 +131,116 @@ Node AlphaEquivalenceDb::addTermWithSubstitution(Node q,
   return qret;
 }
 
+Node AlphaEquivalenceDb::addTermInternal(Node q, bool trackVars)
+{
+  uint64_t fp = getFingerprint(q);
+  context::CDHashMap<uint64_t, Node>::const_iterator it = d_fpQuant.find(fp);
+  if (it == d_fpQuant.end())
+  {
+    // nothing alpha-equivalent to q was added
+    Trace("aeq") << "  ...new fingerprint" << std::endl;
+    d_fpQuant[fp] = q;
+    return q;
+  }
+  if (!it->second.isNull())
+  {
+    // the first quantified formula with this fingerprint must now be compared
+    Node qp = it->second;
+    d_fpQuant[fp] = Node::null();
+    CVC5_UNUSED Node qpret = addQuantToTypeTrie(qp, trackVars);
+    Assert(qpret == qp);
+  }
+  return addQuantToTypeTrie(q, trackVars);
+}
+
+Node AlphaEquivalenceDb::addQuantToTypeTrie(Node q, bool trackVars)
+{
+  Node t;
+  if (trackVars)
+  {
+    // construct canonical quantified formula with visited cache
+    std::map<TNode, Node> visited;
+    t = d_tc->getCanonicalTerm(q[1], visited, d_sortCommutativeOpChildren);
+    // only need to store BOUND_VARIABLE in substitution
+    std::map<Node, TNode>& bm = d_bvmap[q];
+    for (const std::pair<const TNode, Node>& b : visited)
+    {
+      if (b.first.getKind() == Kind::BOUND_VARIABLE)
+      {
+        Assert(b.second.getKind() == Kind::BOUND_VARIABLE);
+        bm[b.second] = b.first;
+      }
+    }
+  }
+  else
+  {
+    t = d_tc->getCanonicalTerm(q[1], d_sortCommutativeOpChildren);
+  }
+  Trace("aeq") << "  canonical form: " << t << std::endl;
+  return addTermToTypeTrie(t, q);
+}
+
+uint64_t AlphaEquivalenceDb::getFingerprint(Node q) const
+{
+  // the multiset of types of the variables, combined independently of order
+  uint64_t vhash = 0;
+  for (const Node& v : q[0])
+  {
+    vhash += std::hash<TypeNode>()(v.getType());
+  }
+  std::unordered_map<TNode, uint64_t> visited;
+  uint64_t bhash = getFingerprint(q[1], visited);
+  return fnv1a::fnv1a_64(bhash, vhash);
+}
+
+uint64_t AlphaEquivalenceDb::getFingerprint(
+    TNode n, std::unordered_map<TNode, uint64_t>& visited) const
+{
+  std::unordered_map<TNode, uint64_t>::iterator it = visited.find(n);
+  if (it != visited.end())
+  {
+    return it->second;
+  }
+  uint64_t ret;
+  Kind k = n.getKind();
+  if (k == Kind::BOUND_VARIABLE)
+  {
+    // bound variables are renamed by the canonizer, only their type matters
+    ret = fnv1a::fnv1a_64(std::hash<TypeNode>()(n.getType()));
+  }
+  else if (n.getNumChildren() == 0)
+  {
+    ret = std::hash<Node>()(n);
+  }
+  else
+  {
+    ret = fnv1a::fnv1a_64(static_cast<uint64_t>(k));
+    if (n.getMetaKind() == metakind::PARAMETERIZED)
+    {
+      ret = fnv1a::fnv1a_64(getFingerprint(n.getOperator(), visited), ret);
+    }
+    if (d_sortCommutativeOpChildren && TermUtil::isComm(k))
+    {
+      // the canonizer sorts the children, combine independently of order
+      uint64_t chash = 0;
+      for (TNode nc : n)
+      {
+        chash += getFingerprint(nc, visited);
+      }
+      ret = fnv1a::fnv1a_64(chash, ret);
+    }
+    else
+    {
+      for (TNode nc : n)
+      {
+        ret = fnv1a::fnv1a_64(getFingerprint(nc, visited), ret);
+      }
+    }
+  }
+  visited[n] = ret;
+  return ret;
+}
+
 Node AlphaEquivalenceDb::addTermToTypeTrie(Node t, Node q)
 {
   //compute variable type counts
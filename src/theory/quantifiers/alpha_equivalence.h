@@ -18,6 +18,7 @@
 #ifndef CVC5__ALPHA_EQUIVALENCE_H
 #define CVC5__ALPHA_EQUIVALENCE_H
 
+#include "context/cdhashmap.h"
 #include "expr/term_canonize.h"
 #include "proof/eager_proof_generator.h"
 #include "smt/env_obj.h"
@@ -62,6 +63,14 @@ class AlphaEquivalenceTypeNode {
 
 /**
  * Stores a database of quantified formulas, which computes alpha-equivalence.
+ *
+ * To avoid constructing canonical forms, quantified formulas are first
+ * indexed by a fingerprint, which is a hash of their body that does not depend
+ * on the names of bound variables or the order of children of commutative
+ * operators. Alpha-equivalent quantified formulas have the same fingerprint.
+ * Hence, the canonical form of a quantified formula is only computed, and
+ * added to the type trie, once another quantified formula with the same
+ * fingerprint is added.
  */
 class AlphaEquivalenceDb
 {
@@ -92,6 +101,22 @@ class AlphaEquivalenceDb
    * had been added to this class, or q otherwise.
    */
   Node addTermToTypeTrie(Node t, Node q);
+  /**
+   * Add quantified formula q to the type trie, computing its canonical form.
+   * If trackVars is true, this tracks the variable mapping of q in d_bvmap.
+   */
+  Node addQuantToTypeTrie(Node q, bool trackVars);
+  /**
+   * Add quantified formula q to the database. If no quantified formula with
+   * the same fingerprint was added, this returns q without computing its
+   * canonical form.
+   */
+  Node addTermInternal(Node q, bool trackVars);
+  /** Get the fingerprint of the quantified formula q */
+  uint64_t getFingerprint(Node q) const;
+  /** Get the fingerprint of term n, where visited caches the results. */
+  uint64_t getFingerprint(TNode n,
+                          std::unordered_map<TNode, uint64_t>& visited) const;
   /** The context we depend on */
   context::Context* d_context;
   /** a trie per # of variables per type */
@@ -106,6 +131,12 @@ class AlphaEquivalenceDb
    * from canonical free variables to variables in q.
    */
   std::map<Node, std::map<Node, TNode> > d_bvmap;
+  /**
+   * Maps fingerprints to the quantified formula with that fingerprint that is
+   * not yet added to the type trie, or null if all quantified formulas with
+   * that fingerprint have been added to the type trie.
+   */
+  context::CDHashMap<uint64_t, Node> d_fpQuant;
 };
 
 /**
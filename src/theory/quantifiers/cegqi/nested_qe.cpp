@@ -17,6 +17,7 @@
 #include "theory/quantifiers/cegqi/nested_qe.h"
 
 #include "expr/node_algorithm.h"
+#include "expr/skolem_manager.h"
 #include "expr/subs.h"
 #include "smt/env.h"
 #include "theory/rewriter.h"
@@ -27,6 +28,27 @@ namespace cvc5::internal {
 namespace theory {
 namespace quantifiers {
 
+NestedQeCache::NestedQeCache() {}
+
+NestedQeCache::~NestedQeCache() {}
+
+Node NestedQeCache::get(Node q)
+{
+  std::unordered_map<Node, Node>::iterator it = d_results.find(getKey(q));
+  if (it != d_results.end())
+  {
+    return it->second;
+  }
+  return Node::null();
+}
+
+void NestedQeCache::set(Node q, Node res) { d_results[getKey(q)] = res; }
+
+Node NestedQeCache::getKey(Node q)
+{
+  return d_tcanon.getCanonicalTerm(q, true);
+}
+
 NestedQe::NestedQe(Env& env) : d_env(env), d_qnqe(d_env.getUserContext()) {}
 
 bool NestedQe::process(Node q, std::vector<Node>& lems)
@@ -38,7 +60,7 @@ bool NestedQe::process(Node q, std::vector<Node>& lems)
     return (*it).second != q;
   }
   Trace("cegqi-nested-qe") << "Check nested QE on " << q << std::endl;
-  Node qqe = doNestedQe(d_env, q, true);
+  Node qqe = doNestedQe(d_env, q, true, &d_cache);
   d_qnqe[q] = qqe;
   if (qqe == q)
   {
@@ -70,10 +92,22 @@ bool NestedQe::hasNestedQuantification(Node q)
   return getNestedQuantification(q, nqs);
 }
 
-Node NestedQe::doNestedQe(Env& env, Node q, bool keepTopLevel)
+Node NestedQe::doNestedQe(Env& env,
+                          Node q,
+                          bool keepTopLevel,
+                          NestedQeCache* cache)
 {
   NodeManager* nm = env.getNodeManager();
   Node qOrig = q;
+  if (cache != nullptr && !keepTopLevel)
+  {
+    Node cres = cache->get(q);
+    if (!cres.isNull())
+    {
+      Trace("cegqi-nested-qe-debug") << "...cached result" << std::endl;
+      return cres;
+    }
+  }
   bool inputExists = false;
   if (q.getKind() == Kind::EXISTS)
   {
@@ -91,23 +125,34 @@ Node NestedQe::doNestedQe(Env& env, Node q, bool keepTopLevel)
       return qOrig;
     }
     // just do ordinary quantifier elimination
-    Node qqe = doQe(env, q);
+    Node qqe = doQe(env, q, cache);
     Trace("cegqi-nested-qe-debug") << "...did ordinary qe" << std::endl;
+    if (cache != nullptr && qqe != q)
+    {
+      cache->set(qOrig, qqe);
+    }
     return qqe;
   }
   Trace("cegqi-nested-qe-debug")
       << "..." << nqs.size() << " nested quantifiers" << std::endl;
-  // otherwise, skolemize the arguments of this and apply
-  std::vector<Node> vars(q[0].begin(), q[0].end());
+  // otherwise, skolemize the arguments of this and apply. We use skolems
+  // that are unique to the variables, so that identical nested quantified
+  // formulas lead to identical queries, which are cached.
+  SkolemManager* skm = nm->getSkolemManager();
   Subs sk;
-  sk.add(vars);
+  for (const Node& v : q[0])
+  {
+    sk.add(v,
+           skm->mkInternalSkolemFunction(
+               InternalSkolemId::QE_NESTED_VAR, v.getType(), {v}));
+  }
   // do nested quantifier elimination on each nested quantifier, skolemizing the
   // free variables
   Subs snqe;
   for (const Node& nq : nqs)
   {
     Node nqk = sk.apply(nq);
-    Node nqqe = doNestedQe(env, nqk);
+    Node nqqe = doNestedQe(env, nqk, false, cache);
     if (nqqe == nqk)
     {
       // failed
@@ -131,20 +176,32 @@ Node NestedQe::doNestedQe(Env& env, Node q, bool keepTopLevel)
   {
     qargs.push_back(q[2]);
   }
-  return nm->mkNode(inputExists ? Kind::EXISTS : Kind::FORALL, qargs);
+  Node ret = nm->mkNode(inputExists ? Kind::EXISTS : Kind::FORALL, qargs);
+  if (cache != nullptr && !keepTopLevel)
+  {
+    cache->set(qOrig, ret);
+  }
+  return ret;
 }
 
-Node NestedQe::doQe(Env& env, Node q)
+Node NestedQe::doQe(Env& env, Node q, NestedQeCache* cache)
 {
   Assert(q.getKind() == Kind::FORALL);
   Trace("cegqi-nested-qe") << "  Apply qe to " << q << std::endl;
   q = NodeManager::mkNode(Kind::EXISTS, q[0], q[1].negate());
-  std::unique_ptr<SolverEngine> smt_qe;
-  Options subOptions;
-  subOptions.copyValues(env.getOptions());
-  smt::SetDefaults::disableChecking(subOptions);
-  SubsolverSetupInfo ssi(env, subOptions);
-  initializeSubsolver(env.getNodeManager(), smt_qe, ssi);
+  std::unique_ptr<SolverEngine> smtQeLocal;
+  std::unique_ptr<SolverEngine>& smt_qe =
+      cache != nullptr ? cache->d_subsolver : smtQeLocal;
+  if (smt_qe == nullptr)
+  {
+    Options subOptions;
+    subOptions.copyValues(env.getOptions());
+    smt::SetDefaults::disableChecking(subOptions);
+    SubsolverSetupInfo ssi(env, subOptions);
+    initializeSubsolver(env.getNodeManager(), smt_qe, ssi);
+  }
+  // the query is given as an argument, which does not change the assertions
+  // of the subsolver, so that it can be reused for other queries
   Node qqe = smt_qe->getQuantifierElimination(q, true);
   if (expr::hasBoundVar(qqe))
   {
@@ -19,18 +19,49 @@
 #ifndef CVC5__THEORY__QUANTIFIERS__CEQGI__NESTED_QE_H
 #define CVC5__THEORY__QUANTIFIERS__CEQGI__NESTED_QE_H
 
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "context/cdhashmap.h"
 #include "expr/node.h"
+#include "expr/term_canonize.h"
 
 namespace cvc5::internal {
 
 class Env;
+class SolverEngine;
 
 namespace theory {
 namespace quantifiers {
 
+/**
+ * A cache for nested quantifier elimination. It stores the results of
+ * quantifier elimination on (nested) quantified formulas up to
+ * alpha-equivalence, and a subsolver that is reused by all calls to
+ * quantifier elimination made with this cache.
+ */
+class NestedQeCache
+{
+ public:
+  NestedQeCache();
+  ~NestedQeCache();
+  /** Get the cached result for q, or null if none exists */
+  Node get(Node q);
+  /** Set the result for q */
+  void set(Node q, Node res);
+  /** The subsolver, which is null if not yet initialized */
+  std::unique_ptr<SolverEngine> d_subsolver;
+
+ private:
+  /** Get the key of q in d_results */
+  Node getKey(Node q);
+  /** The term canonizer, for computing keys up to alpha-equivalence */
+  expr::TermCanonize d_tcanon;
+  /** Maps canonical quantified formulas to their results */
+  std::unordered_map<Node, Node> d_results;
+};
+
 class NestedQe
 {
   using NodeNodeMap = context::CDHashMap<Node, Node>;
@@ -66,14 +97,20 @@ class NestedQe
    * q and has no nested quantification. If keepTopLevel is false, then the
    * returned formula is quantifier-free. Otherwise, it is a quantified formula
    * with no nested quantification.
+   *
+   * If cache is non-null, then the results of eliminating nested quantified
+   * formulas are looked up in and stored to cache.
    */
-  static Node doNestedQe(Env& env, Node q, bool keepTopLevel = false);
+  static Node doNestedQe(Env& env,
+                         Node q,
+                         bool keepTopLevel = false,
+                         NestedQeCache* cache = nullptr);
   /**
    * Run quantifier elimination on quantified formula q, where q has no nested
    * quantification. This method invokes a subsolver for performing quantifier
-   * elimination.
+   * elimination, which is the one of cache if it is non-null.
    */
-  static Node doQe(Env& env, Node q);
+  static Node doQe(Env& env, Node q, NestedQeCache* cache = nullptr);
 
  private:
   /** Reference to the env */
@@ -82,6 +119,8 @@ class NestedQe
    * Mapping from quantified formulas q to the result of doNestedQe(q, true).
    */
   NodeNodeMap d_qnqe;
+  /** The cache used for all calls to doNestedQe */
+  NestedQeCache d_cache;
 };
 
 }  // namespace quantifiers
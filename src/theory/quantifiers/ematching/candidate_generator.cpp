@@ -21,6 +21,7 @@
 #include "options/quantifiers_options.h"
 #include "theory/datatypes/datatypes_rewriter.h"
 #include "theory/datatypes/theory_datatypes_utils.h"
+#include "theory/quantifiers/ematching/trigger_term_info.h"
 #include "theory/quantifiers/first_order_model.h"
 #include "theory/quantifiers/quantifiers_state.h"
 #include "theory/quantifiers/term_database.h"
@@ -59,6 +60,11 @@ CandidateGeneratorQE::CandidateGeneratorQE(Env& env,
 {
   d_op = d_treg.getTermDatabase()->getMatchOperator(pat);
   Assert(!d_op.isNull());
+  if (options().quantifiers.ematchSigIndex && pat.getKind() == Kind::APPLY_UF
+      && !TriggerTermInfo::isSimpleTrigger(pat))
+  {
+    d_pat = pat;
+  }
 }
 
 void CandidateGeneratorQE::reset(Node eqc) { resetForOperator(eqc, d_op); }
@@ -72,6 +78,16 @@ void CandidateGeneratorQE::resetForOperator(Node eqc, Node op)
   if (eqc.isNull())
   {
     d_mode = cand_term_db;
+    if (!d_pat.isNull() && d_treg.getTermDatabase()->getMatchOperator(d_pat) == op)
+    {
+      d_sigCands.clear();
+      TNodeTrie* tat = d_treg.getTermDatabase()->getTermArgTrie(op);
+      if (tat != nullptr)
+      {
+        collectSignatureCandidates(tat, 0);
+      }
+      d_mode = cand_term_sig;
+    }
   }else{
     if( isExcludedEqc( eqc ) ){
       d_mode = cand_term_none;
@@ -94,6 +110,45 @@ void CandidateGeneratorQE::resetForOperator(Node eqc, Node op)
     }
   }
 }
+void CandidateGeneratorQE::collectSignatureCandidates(TNodeTrie* tat,
+                                                      size_t argIndex)
+{
+  if (argIndex == d_pat.getNumChildren())
+  {
+    Assert(!tat->d_data.empty());
+    d_sigCands.push_back(tat->getData());
+    return;
+  }
+  TNode pc = d_pat[argIndex];
+  if (!TermUtil::hasInstConstAttr(pc))
+  {
+    // ground arguments must be equal
+    Node r = d_qs.getRepresentative(pc);
+    std::map<TNode, TNodeTrie>::iterator it = tat->d_data.find(r);
+    if (it != tat->d_data.end())
+    {
+      collectSignatureCandidates(&it->second, argIndex + 1);
+    }
+    return;
+  }
+  TermDb* tdb = d_treg.getTermDatabase();
+  Node cop;
+  if (pc.getKind() == Kind::APPLY_UF)
+  {
+    cop = tdb->getMatchOperator(pc);
+  }
+  for (std::pair<const TNode, TNodeTrie>& t : tat->d_data)
+  {
+    // nested arguments only match in classes that have a term of their
+    // operator
+    if (!cop.isNull() && tdb->getTermArgTrie(t.first, cop) == nullptr)
+    {
+      continue;
+    }
+    collectSignatureCandidates(&t.second, argIndex + 1);
+  }
+}
+
 bool CandidateGeneratorQE::isLegalOpCandidate(const Node& n)
 {
   const Node opm = d_treg.getTermDatabase()->getMatchOperator(n);
@@ -138,6 +193,27 @@ Node CandidateGeneratorQE::getNextCandidateInternal()
         }
       }
     }
+  }
+  else if (d_mode == cand_term_sig)
+  {
+    Trace("cand-gen-qe") << "...get next candidate in signature index"
+                         << std::endl;
+    while (d_termIter < d_sigCands.size())
+    {
+      Node n = d_sigCands[d_termIter];
+      d_termIter++;
+      // as in cand_term_db mode, only active terms are candidates
+      if (!isLegalOpCandidate(n))
+      {
+        continue;
+      }
+      Node r = d_qs.getRepresentative(n);
+      if (d_exclude_eqc.find(r) == d_exclude_eqc.end())
+      {
+        Trace("cand-gen-qe") << "...returning " << n << std::endl;
+        return n;
+      }
+    }
   }else if( d_mode==cand_term_eqc ){
     Trace("cand-gen-qe") << "...get next candidate in eqc" << std::endl;
     while( !d_eqc_iter.isFinished() ){
@@ -18,6 +18,7 @@
 #ifndef CVC5__THEORY__QUANTIFIERS__CANDIDATE_GENERATOR_H
 #define CVC5__THEORY__QUANTIFIERS__CANDIDATE_GENERATOR_H
 
+#include "expr/node_trie.h"
 #include "smt/env_obj.h"
 #include "theory/theory.h"
 #include "theory/uf/equality_engine.h"
@@ -122,8 +123,24 @@ class CandidateGeneratorQE : public CandidateGenerator
   void resetForOperator(Node eqc, Node op);
   /** the default implementation of getNextCandidate. */
   Node getNextCandidateInternal();
+  /**
+   * Collect the terms at the leaves of the signature index tat that may match
+   * d_pat, starting from argument argIndex, into d_sigCands. We only descend
+   * into the branch of the representative of a ground argument of d_pat, and
+   * into branches whose equivalence class has a term with the operator of a
+   * nested argument of d_pat. This shares the (congruence-reduced) signature
+   * index of the term database between all triggers with the same operator.
+   */
+  void collectSignatureCandidates(TNodeTrie* tat, size_t argIndex);
   /** operator you are looking for */
   Node d_op;
+  /**
+   * The pattern, if we generate candidates from the signature index in
+   * cand_term_sig mode, or null otherwise.
+   */
+  Node d_pat;
+  /** The candidates in cand_term_sig mode */
+  std::vector<Node> d_sigCands;
   /** the equality class iterator (for cand_term_eqc) */
   eq::EqClassIterator d_eqc_iter;
   /** the TermDb index of the current ground term (for cand_term_db) */
@@ -135,6 +152,7 @@ class CandidateGeneratorQE : public CandidateGenerator
   /** candidate generation modes */
   enum {
     cand_term_db,
+    cand_term_sig,
     cand_term_ident,
     cand_term_eqc,
     cand_term_none,
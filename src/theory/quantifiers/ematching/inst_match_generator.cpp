@@ -41,7 +41,7 @@ namespace quantifiers {
 namespace inst {
 
 InstMatchGenerator::InstMatchGenerator(Env& env, Trigger* tparent, Node pat)
-    : IMGenerator(env, tparent)
+    : IMGenerator(env, tparent), d_lastMatchTime(context(), 0), d_matchSince(0)
 {
   d_cg = nullptr;
   d_needsReset = true;
@@ -529,7 +529,9 @@ int InstMatchGenerator::getNextMatch(InstMatch& m)
     Assert(!d_qstate.isInConflict());
     //if t not null, try to fit it into match m
     if( !t.isNull() ){
-      if( d_curr_exclude_match.find( t )==d_curr_exclude_match.end() ){
+      if (d_curr_exclude_match.find(t) == d_curr_exclude_match.end()
+          && (d_matchSince == 0 || isModified(t)))
+      {
         Assert(t.getType() == d_match_pattern_type);
         Trace("matching-summary") << "Try " << d_match_pattern << " : " << t << std::endl;
         success = getMatch(t, m);
@@ -560,6 +562,21 @@ int InstMatchGenerator::getNextMatch(InstMatch& m)
 
 uint64_t InstMatchGenerator::addInstantiations(InstMatch& m)
 {
+  // Check whether we can only match the terms that were modified since the
+  // last call. Note that d_lastMatchTime is context-dependent, hence we
+  // consider all terms again after backtracking.
+  TermDb* tdb = d_treg.getTermDatabase();
+  uint64_t startTime = tdb->getModificationTime();
+  bool incremental = options().quantifiers.ematchIncremental && d_next == nullptr
+                     && d_eq_class.isNull() && d_eq_class_rel.isNull()
+                     && d_pattern == d_match_pattern
+                     && !logicInfo().isHigherOrder()
+                     && isIncrementalPattern(d_match_pattern);
+  if (incremental)
+  {
+    d_matchSince = d_lastMatchTime.get();
+    d_modCache.clear();
+  }
   //try to add instantiation for each match produced
   uint64_t addedLemmas = 0;
   m.resetAll();
@@ -584,10 +601,103 @@ uint64_t InstMatchGenerator::addInstantiations(InstMatch& m)
     }
     m.resetAll();
   }
+  if (incremental)
+  {
+    d_matchSince = 0;
+    if (!d_qstate.isInConflict())
+    {
+      d_lastMatchTime = startTime;
+    }
+  }
   //return number of lemmas added
   return addedLemmas;
 }
 
+bool InstMatchGenerator::isIncrementalPattern(TNode pat)
+{
+  if (pat.getKind() != Kind::APPLY_UF)
+  {
+    return false;
+  }
+  for (TNode pc : pat)
+  {
+    if (pc.getKind() != Kind::INST_CONSTANT
+        && quantifiers::TermUtil::hasInstConstAttr(pc)
+        && !isIncrementalPattern(pc))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool InstMatchGenerator::isModified(TNode t)
+{
+  Assert(d_matchSince > 0);
+  TermDb* tdb = d_treg.getTermDatabase();
+  if (tdb->getTermAddTime(t) > d_matchSince)
+  {
+    return true;
+  }
+  for (size_t i = 0, nchild = t.getNumChildren(); i < nchild; i++)
+  {
+    if (isClassModified(d_qstate.getRepresentative(t[i]), d_match_pattern[i]))
+    {
+      return true;
+    }
+  }
+  Trace("matching-debug2") << "Skip unmodified " << t << std::endl;
+  return false;
+}
+
+bool InstMatchGenerator::isClassModified(TNode r, TNode pat)
+{
+  TermDb* tdb = d_treg.getTermDatabase();
+  if (tdb->getClassMergeTime(r) > d_matchSince)
+  {
+    return true;
+  }
+  // variables and ground terms only depend on the class of r
+  if (pat.getKind() != Kind::APPLY_UF
+      || !quantifiers::TermUtil::hasInstConstAttr(pat))
+  {
+    return false;
+  }
+  std::pair<Node, Node> key(r, pat);
+  std::map<std::pair<Node, Node>, bool>::iterator itc = d_modCache.find(key);
+  if (itc != d_modCache.end())
+  {
+    return itc->second;
+  }
+  bool ret = false;
+  Node op = tdb->getMatchOperator(pat);
+  eq::EqClassIterator eqc(r, d_qstate.getEqualityEngine());
+  while (!eqc.isFinished() && !ret)
+  {
+    TNode n = *eqc;
+    ++eqc;
+    if (tdb->getMatchOperator(n) != op)
+    {
+      continue;
+    }
+    if (tdb->getTermAddTime(n) > d_matchSince)
+    {
+      ret = true;
+      break;
+    }
+    for (size_t i = 0, nchild = n.getNumChildren(); i < nchild; i++)
+    {
+      if (isClassModified(d_qstate.getRepresentative(n[i]), pat[i]))
+      {
+        ret = true;
+        break;
+      }
+    }
+  }
+  d_modCache[key] = ret;
+  return ret;
+}
+
 InstMatchGenerator* InstMatchGenerator::mkInstMatchGenerator(Env& env,
                                                              Trigger* tparent,
                                                              Node q,
@@ -19,6 +19,8 @@
 #define CVC5__THEORY__QUANTIFIERS__INST_MATCH_GENERATOR_H
 
 #include <map>
+
+#include "context/cdo.h"
 #include "expr/node.h"
 #include "theory/quantifiers/inst_match.h"
 #include "theory/quantifiers/ematching/im_generator.h"
@@ -290,6 +292,39 @@ class InstMatchGenerator : public IMGenerator {
    * See TermDatabase::getMatchOperator for details on match operators.
    */
   Node d_match_pattern_op;
+  /**
+   * The modification time of the term database (see
+   * TermDb::getModificationTime) at the start of the last call to
+   * addInstantiations that was not interrupted by a conflict, or 0 if none.
+   */
+  context::CDO<uint64_t> d_lastMatchTime;
+  /**
+   * If non-zero, the time since which the candidates of the current call to
+   * addInstantiations must be modified to be considered.
+   */
+  uint64_t d_matchSince;
+  /** Cache for isClassModified in the current call to addInstantiations */
+  std::map<std::pair<Node, Node>, bool> d_modCache;
+  /**
+   * Return true if pattern pat contains only applications of uninterpreted
+   * functions, instantiation constants and ground terms, in which case we
+   * can determine whether a term may newly match it using isModified.
+   */
+  static bool isIncrementalPattern(TNode pat);
+  /**
+   * Return true if ground term t may have a match for d_match_pattern that it
+   * did not have at time d_matchSince. This is the case if t was added after
+   * this time, or if the equivalence class of one of its arguments was merged
+   * or contains a term that may newly match the corresponding argument of
+   * d_match_pattern. Since matching is done modulo equality, no other term
+   * can have new matches.
+   */
+  bool isModified(TNode t);
+  /**
+   * Return true if a term in the equivalence class of r may newly match
+   * pattern pat (or its class was merged), as in isModified.
+   */
+  bool isClassModified(TNode r, TNode pat);
   /** get the match against ground term or formula t.
    *
    * d_match_pattern and t should have the same shape, that is,
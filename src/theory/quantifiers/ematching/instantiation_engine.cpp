@@ -20,6 +20,7 @@
 #include "theory/quantifiers/ematching/inst_strategy_e_matching_user.h"
 #include "theory/quantifiers/ematching/trigger.h"
 #include "theory/quantifiers/first_order_model.h"
+#include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/quantifiers_attributes.h"
 #include "theory/quantifiers/term_database.h"
 #include "theory/quantifiers/term_util.h"
@@ -99,7 +100,17 @@ void InstantiationEngine::doInstantiationRound( Theory::Effort effort ){
         for( unsigned j=0; j<d_instStrategies.size(); j++ ){
           InstStrategy* is = d_instStrategies[j];
           Trace("inst-engine-debug") << "Do " << is->identify() << " " << e_use << std::endl;
-          InstStrategyStatus quantStatus = is->process(q, effort, e_use);
+          InstStrategyStatus quantStatus;
+          Instantiate::QuantProfile* qp = d_qim.getInstantiate()->getProfile(q);
+          if (qp != nullptr)
+          {
+            TimerStat::CodeTimer ct(qp->d_matchTime);
+            quantStatus = is->process(q, effort, e_use);
+          }
+          else
+          {
+            quantStatus = is->process(q, effort, e_use);
+          }
           Trace("inst-engine-debug")
               << " -> unfinished= "
               << (quantStatus == InstStrategyStatus::STATUS_UNFINISHED)
@@ -25,7 +25,11 @@ namespace ieval {
 InstEvaluatorManager::InstEvaluatorManager(Env& env,
                                            QuantifiersState& qs,
                                            TermDb& tdb)
-    : QuantifiersUtil(env), d_qstate(qs), d_tdb(tdb)
+    : QuantifiersUtil(env),
+      d_qstate(qs),
+      d_tdb(tdb),
+      d_numInfeasible(statisticsRegistry().registerInt(
+          "InstEvaluatorManager::numInfeasible"))
 {
 }
 
@@ -78,6 +82,33 @@ InstEvaluator* InstEvaluatorManager::getEvaluator(Node q, TermEvaluatorMode tev)
   return ret;
 }
 
+bool InstEvaluatorManager::isFeasible(Node q,
+                                      TermEvaluatorMode tev,
+                                      const std::vector<Node>& terms)
+{
+  Assert(terms.size() == q[0].getNumChildren());
+  InstEvaluator* ie = getEvaluator(q, tev);
+  if (ie == nullptr)
+  {
+    return true;
+  }
+  ie->resetAll();
+  bool ret = true;
+  for (size_t i = 0, nvars = terms.size(); i < nvars; i++)
+  {
+    if (!ie->push(q[0][i], terms[i]))
+    {
+      Trace("ieval-filter") << "Infeasible instance of " << q << " after "
+                            << (i + 1) << " terms: " << terms << std::endl;
+      ++d_numInfeasible;
+      ret = false;
+      break;
+    }
+  }
+  ie->resetAll();
+  return ret;
+}
+
 }  // namespace ieval
 }  // namespace quantifiers
 }  // namespace theory
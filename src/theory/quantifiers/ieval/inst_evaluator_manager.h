@@ -24,6 +24,7 @@
 #include "smt/env_obj.h"
 #include "theory/quantifiers/ieval/inst_evaluator.h"
 #include "theory/quantifiers/quant_util.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -52,6 +53,14 @@ class InstEvaluatorManager : public QuantifiersUtil
   std::string identify() const override;
   /** Get evaluator for quantified formula q in evaluation mode tev */
   InstEvaluator* getEvaluator(Node q, TermEvaluatorMode tev);
+  /**
+   * Return false if the evaluator for q in mode tev determines that the
+   * instantiation of q with terms does not meet the criteria of tev, e.g. it
+   * is entailed if tev is NO_ENTAIL. Returns true if no evaluator is
+   * available. This clears all assignments of the evaluator, and thus
+   * should not be called while another utility is assigning variables of it.
+   */
+  bool isFeasible(Node q, TermEvaluatorMode tev, const std::vector<Node>& terms);
 
  private:
   /** Reference to quantifiers state */
@@ -60,6 +69,8 @@ class InstEvaluatorManager : public QuantifiersUtil
   TermDb& d_tdb;
   /** Maps to the evaluators */
   std::map<QuantEvPair, std::unique_ptr<InstEvaluator> > d_evals;
+  /** Number of instantiations determined infeasible by isFeasible */
+  IntStat d_numInfeasible;
 };
 
 }  // namespace ieval
@@ -45,8 +45,6 @@ class PatTermInfo
   PatTermInfo(context::Context* c);
   /** initialize */
   void initialize(TNode pattern);
-  /** Reset round */
-  void resetRound();
   /**
    * Is active, return false if d_eq has been set to a ground term, possibly
    * the "none" term (indicating that this pattern is not entailed to be equal
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Hash table of instantiations.
+ */
+
+#include "theory/quantifiers/inst_hash_table.h"
+
+#include "util/hash.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace quantifiers {
+
+size_t InstTupleHashFunction::operator()(const std::vector<Node>& v) const
+{
+  uint64_t hash = fnv1a::offsetBasis;
+  for (const Node& n : v)
+  {
+    hash = fnv1a::fnv1a_64(n.getId(), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
+InstHashTable::InstHashTable(context::Context* c) : d_data(c) {}
+
+bool InstHashTable::addInstMatch(Node q, const std::vector<Node>& terms)
+{
+  return d_data.insert(mkEntry(q, terms));
+}
+
+bool InstHashTable::existsInstMatch(Node q,
+                                    const std::vector<Node>& terms) const
+{
+  return d_data.contains(mkEntry(q, terms));
+}
+
+void InstHashTable::getInstantiations(
+    Node q, std::vector<std::vector<Node>>& insts) const
+{
+  for (const std::vector<Node>& e : d_data)
+  {
+    if (e[0] == q)
+    {
+      insts.emplace_back(e.begin() + 1, e.end());
+    }
+  }
+}
+
+void InstHashTable::getInstantiations(
+    std::map<Node, std::vector<std::vector<Node>>>& insts) const
+{
+  for (const std::vector<Node>& e : d_data)
+  {
+    insts[e[0]].emplace_back(e.begin() + 1, e.end());
+  }
+}
+
+std::vector<Node> InstHashTable::mkEntry(Node q,
+                                         const std::vector<Node>& terms)
+{
+  std::vector<Node> entry;
+  entry.reserve(terms.size() + 1);
+  entry.push_back(q);
+  entry.insert(entry.end(), terms.begin(), terms.end());
+  return entry;
+}
+
+}  // namespace quantifiers
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Hash table of instantiations.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__QUANTIFIERS__INST_HASH_TABLE_H
+#define CVC5__THEORY__QUANTIFIERS__INST_HASH_TABLE_H
+
+#include <map>
+#include <vector>
+
+#include "context/cdhashset.h"
+#include "expr/node.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace quantifiers {
+
+/**
+ * Hash function for instantiations, given by a quantified formula followed by
+ * the terms of the instantiation.
+ */
+struct InstTupleHashFunction
+{
+  size_t operator()(const std::vector<Node>& v) const;
+};
+
+/**
+ * A flat, context-dependent table storing the instantiations of all
+ * quantified formulas. This is an alternative to using one (CD)InstMatchTrie
+ * per quantified formula, which requires a map lookup for each term of an
+ * instantiation and a map per trie node.
+ *
+ * Each instantiation is stored as the vector consisting of its quantified
+ * formula followed by its terms. Since the entire vector is stored, hash
+ * collisions are resolved by comparing the entries.
+ */
+class InstHashTable
+{
+ public:
+  InstHashTable(context::Context* c);
+  /**
+   * Add instantiation terms for quantified formula q. Return true if it was
+   * not already in this table.
+   */
+  bool addInstMatch(Node q, const std::vector<Node>& terms);
+  /** Return true if the instantiation terms for q are in this table */
+  bool existsInstMatch(Node q, const std::vector<Node>& terms) const;
+  /** Append the instantiations of q in this table to insts */
+  void getInstantiations(Node q, std::vector<std::vector<Node>>& insts) const;
+  /** Append the instantiations in this table to insts, for each formula */
+  void getInstantiations(
+      std::map<Node, std::vector<std::vector<Node>>>& insts) const;
+
+ private:
+  /** Make the entry of this table for q and terms */
+  static std::vector<Node> mkEntry(Node q, const std::vector<Node>& terms);
+  /** The instantiations */
+  context::CDHashSet<std::vector<Node>, InstTupleHashFunction> d_data;
+};
+
+}  // namespace quantifiers
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__QUANTIFIERS__INST_HASH_TABLE_H */
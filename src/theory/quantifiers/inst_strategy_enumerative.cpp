@@ -176,6 +176,11 @@ bool InstStrategyEnum::process(Node quantifier, bool fullEffort, bool isRd)
   TermTupleEnumeratorEnv ttec;
   ttec.d_fullEffort = fullEffort;
   ttec.d_increaseSum = options().quantifiers.enumInstSum;
+  // pruning entailed prefixes is only sound if entailed instances are
+  // discarded anyways
+  ttec.d_ieval = options().quantifiers.enumInstIeval
+                 && options().quantifiers.instNoEntail;
+  ttec.d_orderTerms = options().quantifiers.enumInstOrder;
   ttec.d_tr = &d_treg;
   // make the enumerator, which is either relevant domain or term database
   // based on the flag isRd.
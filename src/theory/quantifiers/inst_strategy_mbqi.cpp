@@ -22,6 +22,7 @@
 #include "printer/smt2/smt2_printer.h"
 #include "smt/set_defaults.h"
 #include "theory/quantifiers/first_order_model.h"
+#include "theory/quantifiers/ieval/inst_evaluator_manager.h"
 #include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/mbqi_enum.h"
 #include "theory/quantifiers/quantifiers_rewriter.h"
@@ -285,6 +286,18 @@ void InstStrategyMbqi::process(Node q)
   Node query = nm->mkAnd(constraints);
   query = extendedRewrite(query);
 
+  // The query only changes when the part of the model relevant to q has
+  // changed, hence the checks of many quantified formulas are typically
+  // repeated in later rounds.
+  bool useCache = options().quantifiers.mbqiQueryCache;
+  if (useCache && d_unsatQueries.find(query) != d_unsatQueries.end())
+  {
+    Trace("mbqi-model-exp") << "...SUCCESS, by cache" << std::endl;
+    d_quantChecked.insert(q);
+    Trace("mbqi") << "...success, by cache" << std::endl;
+    return;
+  }
+
   std::unique_ptr<SolverEngine> mbqiChecker;
   SubsolverSetupInfo ssi(d_env, d_subOptions);
   initializeSubsolver(d_env.getNodeManager(), mbqiChecker, ssi);
@@ -304,6 +317,10 @@ void InstStrategyMbqi::process(Node q)
   {
     Trace("mbqi-model-exp") << "...SUCCESS" << std::endl;
     d_quantChecked.insert(q);
+    if (useCache)
+    {
+      d_unsatQueries.insert(query);
+    }
     Trace("mbqi") << "...success, SAT" << std::endl;
     return;
   }
@@ -409,6 +426,14 @@ bool InstStrategyMbqi::tryInstantiation(
     v = fvToInst.apply(v);
   }
 
+  // filter entailed instances cheaply, if applicable
+  if (options().quantifiers.ievalFilter && options().quantifiers.instNoEntail
+      && !d_treg.getInstEvaluatorManager()->isFeasible(
+          q, ieval::TermEvaluatorMode::NO_ENTAIL, terms))
+  {
+    Trace("mbqi") << "...instantiation is entailed" << std::endl;
+    return false;
+  }
   // try to add instantiation
   Instantiate* qinst = d_qim.getInstantiate();
   if (!qinst->addInstantiation(q, terms, id))
@@ -138,6 +138,12 @@ class InstStrategyMbqi : public QuantifiersModule
   Result checkWithSubsolverSimple(Node query, const SubsolverSetupInfo& info);
   /** The quantified formulas that we succeeded in checking */
   std::unordered_set<Node> d_quantChecked;
+  /**
+   * The queries that the subsolver showed to be unsatisfiable, if
+   * --mbqi-query-cache is enabled. Since the queries do not depend on the
+   * context, this cache is never cleared.
+   */
+  std::unordered_set<Node> d_unsatQueries;
   /** Kinds that cannot appear in queries */
   std::unordered_set<Kind, kind::KindHashFunction> d_nonClosedKinds;
   /** Submodule for sygus enum */
@@ -17,6 +17,7 @@
 
 #include "options/quantifiers_options.h"
 #include "theory/quantifiers/first_order_model.h"
+#include "theory/quantifiers/ieval/inst_evaluator_manager.h"
 #include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/quantifiers_inference_manager.h"
 #include "theory/quantifiers/term_pools.h"
@@ -208,6 +209,9 @@ bool InstStrategyPool::process(Node q, Node p, uint64_t& addedLemmas)
   TermTupleEnumeratorEnv ttec;
   ttec.d_fullEffort = true;
   ttec.d_increaseSum = options().quantifiers.enumInstSum;
+  ttec.d_ieval = options().quantifiers.ievalFilter
+                 && options().quantifiers.instNoEntail;
+  ttec.d_orderTerms = false;
   ttec.d_tr = &d_treg;
   std::shared_ptr<TermTupleEnumeratorInterface> enumerator(
       mkTermTupleEnumeratorPool(q, &ttec, p));
@@ -245,6 +249,11 @@ bool InstStrategyPool::processTuple(Node q, Node p, uint64_t& addedLemmas)
 {
   Instantiate* ie = d_qim.getInstantiate();
   TermPools* tp = d_treg.getTermPools();
+  ieval::InstEvaluatorManager* iem = nullptr;
+  if (options().quantifiers.ievalFilter && options().quantifiers.instNoEntail)
+  {
+    iem = d_treg.getInstEvaluatorManager();
+  }
   // get the terms
   std::vector<Node> terms;
   tp->getTermsForPool(p[0], terms);
@@ -262,6 +271,12 @@ bool InstStrategyPool::processTuple(Node q, Node p, uint64_t& addedLemmas)
     }
     std::vector<Node> inst(t.begin(), t.end());
     Assert(inst.size() == q[0].getNumChildren());
+    if (iem != nullptr
+        && !iem->isFeasible(q, ieval::TermEvaluatorMode::NO_ENTAIL, inst))
+    {
+      Trace("pool-inst") << "Entailed (tuple) " << inst << std::endl;
+      continue;
+    }
     if (ie->addInstantiation(q, inst, InferenceId::QUANTIFIERS_INST_POOL_TUPLE))
     {
       Trace("pool-inst") << "Success (tuple) with " << inst << std::endl;
@@ -86,7 +86,7 @@ void InstStrategySubConflict::check(Theory::Effort e, QEffort quant_e)
       continue;
     }
     // collect all assertions from theory
-    for (context::CDList<Assertion>::const_iterator
+    for (FactList::const_iterator
              it = d_qstate.factsBegin(tid),
              itEnd = d_qstate.factsEnd(tid);
          it != itEnd;
@@ -15,6 +15,8 @@
 
 #include "theory/quantifiers/instantiate.h"
 
+#include <algorithm>
+
 #include "expr/node_algorithm.h"
 #include "options/base_options.h"
 #include "options/quantifiers_options.h"
@@ -53,7 +55,9 @@ Instantiate::Instantiate(Env& env,
       d_treg(tr),
       d_insts(userContext()),
       d_uimt(userContext()),
+      d_instTable(userContext()),
       d_cimt(context()),
+      d_numRecordedTerms(0),
       d_pfInst(isProofEnabled()
                    ? new CDProof(env, userContext(), "Instantiate::pfInst")
                    : nullptr)
@@ -61,9 +65,15 @@ Instantiate::Instantiate(Env& env,
   // We need to use user context-dependent trie for the main instantiation
   // trie if incremental.
   d_useCdInstTrie = options().base.incrementalSolving;
+  resourceManager()->registerMemoryAccount("instantiate", [this]() {
+    return d_numRecordedTerms * s_bytesPerRecordedTerm;
+  });
 }
 
-Instantiate::~Instantiate() {}
+Instantiate::~Instantiate()
+{
+  resourceManager()->unregisterMemoryAccount("instantiate");
+}
 
 bool Instantiate::reset(Theory::Effort e)
 {
@@ -225,6 +235,10 @@ bool Instantiate::addInstantiationInternal(
     {
       Trace("inst-add-debug") << " --> Currently entailed." << std::endl;
       ++(d_statistics.d_inst_duplicate_ent);
+      if (QuantProfile* qp = getProfile(q))
+      {
+        ++(qp->d_entailed);
+      }
       return false;
     }
   }
@@ -244,10 +258,18 @@ bool Instantiate::addInstantiationInternal(
 
   // record the instantiation
   bool recorded = recordInstantiationInternal(q, terms, isLocal);
-  if (!recorded)
+  if (recorded)
+  {
+    d_numRecordedTerms += terms.size();
+  }
+  else
   {
     Trace("inst-add-debug") << " --> Already exists (no record)." << std::endl;
     ++(d_statistics.d_inst_duplicate_eq);
+    if (QuantProfile* qp = getProfile(q))
+    {
+      ++(qp->d_duplicate);
+    }
     return false;
   }
 
@@ -353,6 +375,10 @@ bool Instantiate::addInstantiationInternal(
   {
     Trace("inst-add-debug") << " --> Lemma already exists." << std::endl;
     ++(d_statistics.d_inst_duplicate);
+    if (QuantProfile* qp = getProfile(q))
+    {
+      ++(qp->d_duplicate);
+    }
     return false;
   }
 
@@ -361,6 +387,10 @@ bool Instantiate::addInstantiationInternal(
   ill->d_list.push_back(body);
   // add to temporary debug statistics (# inst on this round)
   d_instDebugTemp[q]++;
+  if (QuantProfile* qp = getProfile(q))
+  {
+    qp->d_instantiations << id;
+  }
   if (TraceIsOn("inst"))
   {
     Trace("inst") << "*** Instantiate [" << id << "] " << q << " with "
@@ -547,6 +577,10 @@ void Instantiate::recordInstantiation(Node q,
 
 bool Instantiate::existsInstantiation(Node q, const std::vector<Node>& terms)
 {
+  if (options().quantifiers.instHashTable)
+  {
+    return d_instTable.existsInstMatch(q, terms);
+  }
   if (d_useCdInstTrie)
   {
     NodeInstTrieMap::iterator it = d_uimt.find(q);
@@ -576,10 +610,20 @@ Node Instantiate::getInstantiation(Node q,
 {
   Assert(vars.size() == terms.size());
   Assert(q[0].getNumChildren() == vars.size());
-  // Notice that this could be optimized, but no significant performance
-  // improvements were observed with alternative implementations (see #1386).
-  Node body =
-      q[1].substitute(vars.begin(), vars.end(), terms.begin(), terms.end());
+  Node body;
+  if (options().quantifiers.instTemplate
+      && std::equal(vars.begin(), vars.end(), q[0].begin()))
+  {
+    body = instantiateTemplate(q, terms);
+  }
+  else
+  {
+    // Notice that this could be optimized, but no significant performance
+    // improvements were observed with alternative implementations (see
+    // #1386).
+    body =
+        q[1].substitute(vars.begin(), vars.end(), terms.begin(), terms.end());
+  }
 
   // store the proof of the instantiated body, with (open) assumption q
   if (pf != nullptr)
@@ -634,6 +678,86 @@ Node Instantiate::getInstantiation(Node q,
       q, d_qreg.d_vars[q], terms, InferenceId::UNKNOWN, Node::null(), doVts);
 }
 
+const std::vector<Node>& Instantiate::getInstTemplate(Node q)
+{
+  std::map<Node, std::vector<Node>>::iterator it = d_instTemplate.find(q);
+  if (it != d_instTemplate.end())
+  {
+    return it->second;
+  }
+  std::vector<Node>& tmpl = d_instTemplate[q];
+  // maps subterms of the body to whether they contain a variable of q
+  std::unordered_map<TNode, bool> visited;
+  for (const Node& v : q[0])
+  {
+    visited[v] = true;
+  }
+  std::vector<TNode> visit;
+  visit.push_back(q[1]);
+  TNode cur;
+  do
+  {
+    cur = visit.back();
+    std::unordered_map<TNode, bool>::iterator itv = visited.find(cur);
+    if (itv == visited.end())
+    {
+      // process the children first
+      visited[cur] = false;
+      if (cur.getMetaKind() == kind::metakind::PARAMETERIZED)
+      {
+        visit.push_back(cur.getOperator());
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    visit.pop_back();
+    if (itv->second || cur.getNumChildren() == 0)
+    {
+      // a variable, or already processed
+      continue;
+    }
+    bool hasVar = cur.getMetaKind() == kind::metakind::PARAMETERIZED
+                  && visited[cur.getOperator()];
+    for (const Node& cn : cur)
+    {
+      hasVar = hasVar || visited[cn];
+    }
+    if (hasVar)
+    {
+      visited[cur] = true;
+      tmpl.push_back(cur);
+    }
+  } while (!visit.empty());
+  return tmpl;
+}
+
+Node Instantiate::instantiateTemplate(Node q, const std::vector<Node>& terms)
+{
+  const std::vector<Node>& tmpl = getInstTemplate(q);
+  std::unordered_map<TNode, Node> inst;
+  for (size_t i = 0, nvars = terms.size(); i < nvars; i++)
+  {
+    inst[q[0][i]] = terms[i];
+  }
+  for (const Node& n : tmpl)
+  {
+    NodeBuilder nb(nodeManager(), n.getKind());
+    if (n.getMetaKind() == kind::metakind::PARAMETERIZED)
+    {
+      std::unordered_map<TNode, Node>::iterator it = inst.find(n.getOperator());
+      nb << (it == inst.end() ? n.getOperator() : it->second);
+    }
+    for (const Node& cn : n)
+    {
+      std::unordered_map<TNode, Node>::iterator it = inst.find(cn);
+      nb << (it == inst.end() ? cn : it->second);
+    }
+    inst[n] = nb.constructNode();
+  }
+  std::unordered_map<TNode, Node>::iterator it = inst.find(q[1]);
+  return it == inst.end() ? q[1] : it->second;
+}
+
 bool Instantiate::recordInstantiationInternal(Node q,
                                               const std::vector<Node>& terms,
                                               bool isLocal)
@@ -666,7 +790,12 @@ bool Instantiate::recordInstantiationInternal(Node q,
     return trie->addInstMatch(context(), q, terms);
   }
   bool ret;
-  if (d_useCdInstTrie)
+  if (options().quantifiers.instHashTable)
+  {
+    Trace("inst-add-debug") << "Adding into inst hash table" << std::endl;
+    ret = d_instTable.addInstMatch(q, terms);
+  }
+  else if (d_useCdInstTrie)
   {
     CDInstMatchTrie* trie;
     NodeInstTrieMap::iterator it = d_uimt.find(q);
@@ -706,7 +835,11 @@ void Instantiate::getInstantiatedQuantifiedFormulas(std::vector<Node>& qs) const
 void Instantiate::getInstantiationTermVectors(
     Node q, std::vector<std::vector<Node> >& tvecs)
 {
-  if (d_useCdInstTrie)
+  if (options().quantifiers.instHashTable)
+  {
+    d_instTable.getInstantiations(q, tvecs);
+  }
+  else if (d_useCdInstTrie)
   {
     NodeInstTrieMap::const_iterator it = d_uimt.find(q);
     if (it != d_uimt.end())
@@ -728,7 +861,11 @@ void Instantiate::getInstantiationTermVectors(
 void Instantiate::getInstantiationTermVectors(
     std::map<Node, std::vector<std::vector<Node> > >& insts)
 {
-  if (d_useCdInstTrie)
+  if (options().quantifiers.instHashTable)
+  {
+    d_instTable.getInstantiations(insts);
+  }
+  else if (d_useCdInstTrie)
   {
     for (const auto& t : d_uimt)
     {
@@ -816,6 +953,49 @@ InstLemmaList* Instantiate::getOrMkInstLemmaList(TNode q)
   return ill.get();
 }
 
+Instantiate::QuantProfile::QuantProfile(StatisticsRegistry& sr,
+                                        const std::string& name)
+    : d_instantiations(sr.registerHistogram<InferenceId>(
+          "Instantiate::profile::" + name + "::instantiations", false)),
+      d_duplicate(
+          sr.registerInt("Instantiate::profile::" + name + "::duplicate", false)),
+      d_entailed(
+          sr.registerInt("Instantiate::profile::" + name + "::entailed", false)),
+      d_matchTime(sr.registerTimer(
+          "Instantiate::profile::" + name + "::ematching_time", false))
+{
+}
+
+Instantiate::QuantProfile* Instantiate::getProfile(Node q)
+{
+  if (!options().quantifiers.instProfile)
+  {
+    return nullptr;
+  }
+  std::map<Node, std::unique_ptr<QuantProfile>>::iterator it =
+      d_profiles.find(q);
+  if (it != d_profiles.end())
+  {
+    return it->second.get();
+  }
+  // use the name of q if it has one, and otherwise its index
+  std::stringstream ss;
+  Node name;
+  if (d_qreg.getNameForQuant(q, name, true))
+  {
+    ss << name;
+  }
+  else
+  {
+    ss << "q" << d_profiles.size();
+  }
+  Trace("inst-profile") << "Profile " << ss.str() << " is for " << q
+                        << std::endl;
+  QuantProfile* qp = new QuantProfile(statisticsRegistry(), ss.str());
+  d_profiles[q].reset(qp);
+  return qp;
+}
+
 Instantiate::Statistics::Statistics(StatisticsRegistry& sr)
     : d_instantiations(sr.registerInt("Instantiate::Instantiations_Total")),
       d_inst_duplicate(sr.registerInt("Instantiate::Duplicate_Inst")),
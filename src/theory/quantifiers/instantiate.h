@@ -24,6 +24,7 @@
 #include "expr/node.h"
 #include "proof/proof.h"
 #include "theory/inference_id.h"
+#include "theory/quantifiers/inst_hash_table.h"
 #include "theory/quantifiers/inst_match_trie.h"
 #include "theory/quantifiers/quant_util.h"
 #include "util/statistics_stats.h"
@@ -84,7 +85,8 @@ class InstLemmaList
  * This class is used for generating instantiation lemmas.  It maintains an
  * instantiation trie, which is represented by a different data structure
  * depending on whether incremental solving is enabled (see d_imt
- * and d_cimt).
+ * and d_cimt), or by a single hash table for all quantified formulas (see
+ * d_instTable).
  *
  * Below, we say an instantiation lemma for q = forall x. F under substitution
  * { x -> t } is the formula:
@@ -279,6 +281,26 @@ class Instantiate : public QuantifiersUtil
   /** Are proofs enabled for this object? */
   bool isProofEnabled() const;
 
+  /**
+   * Statistics for the instantiations of a single quantified formula, which
+   * are tracked if --inst-profile is enabled.
+   */
+  class QuantProfile
+  {
+   public:
+    QuantProfile(StatisticsRegistry& sr, const std::string& name);
+    /** The number of instantiations, per inference identifier */
+    HistogramStat<InferenceId> d_instantiations;
+    /** The number of instantiations that were duplicates */
+    IntStat d_duplicate;
+    /** The number of instantiations that were entailed */
+    IntStat d_entailed;
+    /** The time spent on E-matching for the quantified formula */
+    TimerStat d_matchTime;
+  };
+  /** Get the profile of q, or null if --inst-profile is not enabled */
+  QuantProfile* getProfile(Node q);
+
   /** statistics class
    *
    * This tracks statistics on the number of instantiations successfully
@@ -295,6 +317,8 @@ class Instantiate : public QuantifiersUtil
     Statistics(StatisticsRegistry& sr);
   }; /* class Instantiate::Statistics */
   Statistics d_statistics;
+  /** The profiles of quantified formulas, if --inst-profile is enabled */
+  std::map<Node, std::unique_ptr<QuantProfile>> d_profiles;
 
  private:
   /** Add instantiation internal */
@@ -314,6 +338,19 @@ class Instantiate : public QuantifiersUtil
   static bool isLocalInstId(InferenceId id);
   /** Get or make the instantiation list for quantified formula q */
   InstLemmaList* getOrMkInstLemmaList(TNode q);
+  /**
+   * Get the instantiation template of quantified formula q, which is the list
+   * of subterms of the body of q that contain a variable of q, ordered such
+   * that each term occurs after its subterms.
+   */
+  const std::vector<Node>& getInstTemplate(Node q);
+  /**
+   * Return the body of q where the variables of q are replaced by terms,
+   * computed using its instantiation template. This is the same as
+   * substituting into the body of q, but does not traverse the subterms that
+   * do not contain variables of q.
+   */
+  Node instantiateTemplate(Node q, const std::vector<Node>& terms);
 
   /** Reference to the quantifiers state */
   QuantifiersState& d_qstate;
@@ -339,6 +376,8 @@ class Instantiate : public QuantifiersUtil
    * on presolve, e.g. it is local to a check-sat call.
    */
   std::map<Node, std::vector<Node> > d_recordedInst;
+  /** Map from quantified formulas to their instantiation template */
+  std::map<Node, std::vector<Node>> d_instTemplate;
   /** statistics for debugging total instantiations per quantifier per round */
   std::map<Node, uint32_t> d_instDebugTemp;
   /** list of all instantiations produced for each quantifier
@@ -349,12 +388,26 @@ class Instantiate : public QuantifiersUtil
   std::map<Node, InstMatchTrie> d_imt;
   /** A user dependent trie of instantiations */
   NodeInstTrieMap d_uimt;
+  /**
+   * The user-context dependent table of instantiations, used instead of the
+   * tries above if --inst-hash-table is enabled.
+   */
+  InstHashTable d_instTable;
   /**
    * A SAT-context dependent trie of instantiations, used for inst-local only.
    * Local instantiations are stored both in d_cimt and in the
    * main instantiation trie (d_imt or d_uimt).
    */
   NodeInstTrieMap d_cimt;
+  /**
+   * The total number of terms of the instantiations recorded in the tries
+   * above, which is used to estimate their memory for the memory accounting
+   * of the resource manager. This is not decreased when context-dependent
+   * tries are popped.
+   */
+  uint64_t d_numRecordedTerms;
+  /** The estimated number of bytes per recorded term, i.e. per trie node */
+  static constexpr uint64_t s_bytesPerRecordedTerm = 64;
   /**
    * A CDProof storing instantiation steps.
    */
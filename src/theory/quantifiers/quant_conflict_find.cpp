@@ -2209,7 +2209,8 @@ QuantConflictFind::QuantConflictFind(Env& env,
                                      TermRegistry& tr)
     : QuantifiersModule(env, qs, qim, qr, tr),
       d_statistics(statisticsRegistry()),
-      d_effort(EFFORT_INVALID)
+      d_effort(EFFORT_INVALID),
+      d_failedTime(context())
 {
 }
 
@@ -2439,6 +2440,19 @@ void QuantConflictFind::checkQuantifiedFormula(Node q,
     debugPrintQuant("qcf-check", q);
     Trace("qcf-check") << " : " << q << "..." << std::endl;
   }
+  std::pair<Node, uint32_t> key(q, static_cast<uint32_t>(d_effort));
+  uint64_t modTime = d_treg.getTermDatabase()->getModificationTime();
+  if (options().quantifiers.cbqiIncremental)
+  {
+    QuantEffortTimeMap::const_iterator it = d_failedTime.find(key);
+    if (it != d_failedTime.end() && it->second == modTime)
+    {
+      Trace("qcf-check") << "   ... Skip, unchanged since last failure"
+                         << std::endl;
+      ++(d_statistics.d_skipped_checks);
+      return;
+    }
+  }
 
   Trace("qcf-check-debug") << "Reset round..." << std::endl;
   if (!qi->reset_round())
@@ -2450,6 +2464,7 @@ void QuantConflictFind::checkQuantifiedFormula(Node q,
   // try to make a matches making the body false or propagating
   Trace("qcf-check-debug") << "Get next match..." << std::endl;
   Instantiate* qinst = d_qim.getInstantiate();
+  unsigned prevAddedLemmas = addedLemmas;
   while (qi->getNextMatch())
   {
     if (d_qstate.isInConflict())
@@ -2560,6 +2575,12 @@ void QuantConflictFind::checkQuantifiedFormula(Node q,
     qi->revertMatch(assigned);
     d_tempCache.clear();
   }
+  if (options().quantifiers.cbqiIncremental && addedLemmas == prevAddedLemmas
+      && !d_qstate.isInConflict())
+  {
+    // the search failed, which it will again until the equality state changes
+    d_failedTime[key] = modTime;
+  }
   Trace("qcf-check") << "Done, conflict = " << d_qstate.isConflictingInst()
                      << std::endl;
 }
@@ -2643,7 +2664,8 @@ void QuantConflictFind::debugPrintQuantBody(const char* c,
 QuantConflictFind::Statistics::Statistics(StatisticsRegistry& sr)
     : d_inst_rounds(sr.registerInt("QuantConflictFind::Inst_Rounds")),
       d_entailment_checks(
-          sr.registerInt("QuantConflictFind::Entailment_Checks"))
+          sr.registerInt("QuantConflictFind::Entailment_Checks")),
+      d_skipped_checks(sr.registerInt("QuantConflictFind::Skipped_Checks"))
 {
 }
 
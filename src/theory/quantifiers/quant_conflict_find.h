@@ -26,6 +26,7 @@
 #include "expr/node_trie.h"
 #include "theory/quantifiers/inst_match.h"
 #include "theory/quantifiers/quant_module.h"
+#include "util/hash.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -236,6 +237,8 @@ class QuantConflictFind : public QuantifiersModule
   public:
     IntStat d_inst_rounds;
     IntStat d_entailment_checks;
+    /** Number of checks skipped since the equality state is unchanged */
+    IntStat d_skipped_checks;
     Statistics(StatisticsRegistry& sr);
   };
   Statistics d_statistics;
@@ -313,6 +316,19 @@ class QuantConflictFind : public QuantifiersModule
   std::map<Node, bool> d_irr_quant;
   /** The current effort */
   Effort d_effort;
+  using QuantEffortTimeMap =
+      context::CDHashMap<std::pair<Node, uint32_t>,
+                         uint64_t,
+                         PairHashFunction<Node, uint32_t, std::hash<Node>>>;
+  /**
+   * Maps pairs (q, e) to the modification time of the term database at which
+   * the search for instances of q at effort e last failed, if
+   * --cbqi-incremental is enabled. If this time is unchanged, the equality
+   * state is unchanged since then in the current context, and the search
+   * would fail again. This map is context-dependent, so that entries made in
+   * popped contexts are forgotten.
+   */
+  QuantEffortTimeMap d_failedTime;
 };
 
 std::ostream& operator<<(std::ostream& os, const QuantConflictFind::Effort& e);
@@ -47,7 +47,9 @@ EnumValueManager::EnumValueManager(Env& env,
       d_treg(tr),
       d_stats(s),
       d_tds(tr.getTermDatabaseSygus()),
-      d_eec(hasExamples ? new ExampleEvalCache(d_tds, e) : nullptr)
+      d_eec(hasExamples ? new ExampleEvalCache(
+                d_tds, e, options().quantifiers.sygusPbeColumnEval)
+                        : nullptr)
 {
 }
 
@@ -14,6 +14,9 @@
  */
 #include "theory/quantifiers/sygus/example_eval_cache.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "theory/quantifiers/sygus/example_min_eval.h"
 
 using namespace cvc5::internal;
@@ -23,9 +26,8 @@ namespace cvc5::internal {
 namespace theory {
 namespace quantifiers {
 
-ExampleEvalCache::ExampleEvalCache(TermDbSygus* tds,
-                                   Node e)
-    : d_tds(tds), d_stn(e.getType())
+ExampleEvalCache::ExampleEvalCache(TermDbSygus* tds, Node e, bool columnEval)
+    : d_tds(tds), d_stn(e.getType()), d_columnEval(columnEval)
 {
   d_indexSearchVals = !d_tds->isVariableAgnosticEnumerator(e);
 }
@@ -85,6 +87,10 @@ void ExampleEvalCache::evaluateVec(Node bv,
 void ExampleEvalCache::evaluateVecInternal(Node bv,
                                            std::vector<Node>& exOut) const
 {
+  if (d_columnEval && evaluateVecColumns(bv, exOut))
+  {
+    return;
+  }
   // use ExampleMinEval
   SygusTypeInfo& ti = d_tds->getTypeInfo(d_stn);
   const std::vector<Node>& varlist = ti.getVarList();
@@ -97,6 +103,116 @@ void ExampleEvalCache::evaluateVecInternal(Node bv,
   }
 }
 
+bool ExampleEvalCache::evaluateVecColumns(Node bv,
+                                          std::vector<Node>& exOut) const
+{
+  SygusTypeInfo& ti = d_tds->getTypeInfo(d_stn);
+  const std::vector<Node>& varlist = ti.getVarList();
+  const size_t nex = d_examples.size();
+  if (nex == 0)
+  {
+    return true;
+  }
+  NodeManager* nm = bv.getNodeManager();
+  std::unordered_map<TNode, std::vector<Node>> columns;
+  std::unordered_map<TNode, std::vector<Node>>::iterator it;
+  std::map<Node, std::vector<Node>>::const_iterator itc;
+  std::vector<TNode> visit;
+  TNode cur;
+  visit.push_back(bv);
+  do
+  {
+    cur = visit.back();
+    it = columns.find(cur);
+    if (it != columns.end() && !it->second.empty())
+    {
+      visit.pop_back();
+      continue;
+    }
+    std::vector<Node>& col = columns[cur];
+    itc = d_exOutCache.find(cur);
+    if (itc != d_exOutCache.end())
+    {
+      // already evaluated, e.g. a previously enumerated term
+      col = itc->second;
+      visit.pop_back();
+      continue;
+    }
+    if (cur.getNumChildren() == 0)
+    {
+      std::vector<Node>::const_iterator itv =
+          std::find(varlist.begin(), varlist.end(), cur);
+      if (itv != varlist.end())
+      {
+        size_t index = std::distance(varlist.begin(), itv);
+        for (const std::vector<Node>& ex : d_examples)
+        {
+          col.push_back(ex[index]);
+        }
+      }
+      else if (cur.isConst())
+      {
+        col.resize(nex, cur);
+      }
+      else
+      {
+        return false;
+      }
+      visit.pop_back();
+      continue;
+    }
+    if (cur.isClosure())
+    {
+      return false;
+    }
+    // visit the children first
+    bool childrenDone = true;
+    for (const Node& cn : cur)
+    {
+      it = columns.find(cn);
+      if (it == columns.end() || it->second.empty())
+      {
+        childrenDone = false;
+        visit.push_back(cn);
+      }
+    }
+    if (!childrenDone)
+    {
+      continue;
+    }
+    visit.pop_back();
+    // apply the operator of cur to the values of its children
+    bool isParam = cur.getMetaKind() == metakind::PARAMETERIZED;
+    std::vector<const std::vector<Node>*> ccols;
+    for (const Node& cn : cur)
+    {
+      ccols.push_back(&columns[cn]);
+    }
+    std::vector<Node> children;
+    for (size_t j = 0; j < nex; j++)
+    {
+      children.clear();
+      if (isParam)
+      {
+        children.push_back(cur.getOperator());
+      }
+      for (const std::vector<Node>* cc : ccols)
+      {
+        children.push_back((*cc)[j]);
+      }
+      Node v = d_tds->rewriteNode(nm->mkNode(cur.getKind(), children));
+      if (!v.isConst())
+      {
+        return false;
+      }
+      col.push_back(v);
+    }
+  } while (!visit.empty());
+  const std::vector<Node>& res = columns[bv];
+  exOut.insert(exOut.end(), res.begin(), res.end());
+  return true;
+}
+
 Node ExampleEvalCache::evaluate(Node bn, unsigned i) const
 {
   Assert(i < d_examples.size());
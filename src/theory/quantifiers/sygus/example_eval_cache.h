@@ -72,8 +72,11 @@ class ExampleEvalCache
    * e. In particular, the terms that will be evaluated by this class
    * are builtin terms that the analog of values taken by enumerator e that
    * is associated with f.
+   *
+   * If columnEval is true, then terms are evaluated on all examples at once,
+   * see evaluateVecColumns.
    */
-  ExampleEvalCache(TermDbSygus* tds, Node e);
+  ExampleEvalCache(TermDbSygus* tds, Node e, bool columnEval = false);
   ~ExampleEvalCache();
   /**
    * Add example to the list of examples maintained by this class.
@@ -136,6 +139,15 @@ class ExampleEvalCache
  private:
   /** Version of evaluateVec that does not do caching */
   void evaluateVecInternal(Node bv, std::vector<Node>& exOut) const;
+  /**
+   * Evaluate bv on all examples at once, computing for each subterm of bv
+   * the vector of its values on all examples (its column), operator by
+   * operator. The columns of subterms whose evaluation is cached in
+   * d_exOutCache, which are typically previously enumerated terms, are reused.
+   * Returns false if some subterm does not evaluate to a constant, in which
+   * case nothing is added to exOut.
+   */
+  bool evaluateVecColumns(Node bv, std::vector<Node>& exOut) const;
   /** Pointer to the sygus term database */
   TermDbSygus* d_tds;
   /** pointer to the example inference class */
@@ -147,6 +159,8 @@ class ExampleEvalCache
    * of this class is variable agnostic.
    */
   bool d_indexSearchVals;
+  /** Whether we use evaluateVecColumns */
+  bool d_columnEval;
   /** trie of search values
    *
    * This trie is an index of candidate solutions for PBE synthesis and their
@@ -47,6 +47,7 @@ SygusEnumerator::SygusEnumerator(Env& env,
       d_enumShapes(enumShapes),
       d_enumAnyConstHoles(enumAnyConstHoles),
       d_enumNumConsts(numConstants),
+      d_enumEvictSizes(0),
       d_tlEnum(nullptr),
       d_abortSize(-1)
 {
@@ -66,6 +67,12 @@ void SygusEnumerator::initialize(Node e)
   d_etype = d_enum.getType();
   Assert(d_etype.isDatatype());
   Assert(d_etype.getDType().isSygus());
+  // shapes are not constructed only from cached terms, hence cannot be evicted
+  if (!d_enumShapes)
+  {
+    d_enumEvictSizes =
+        static_cast<unsigned>(options().quantifiers.sygusEnumFastEvict);
+  }
   d_tlEnum = getMasterEnumForType(d_etype);
   d_abortSize = options().datatypes.sygusAbortSize;
 
@@ -182,6 +189,10 @@ SygusEnumerator::TermCache::TermCache()
     : d_sec(nullptr),
       d_isSygusType(false),
       d_numConClasses(0),
+      d_se(nullptr),
+      d_evictSizes(0),
+      d_numEvictChecked(0),
+      d_numEvicted(0),
       d_sizeEnum(0),
       d_isComplete(false)
 {
@@ -190,13 +201,17 @@ SygusEnumerator::TermCache::TermCache()
 void SygusEnumerator::TermCache::initialize(SygusStatistics* s,
                                             Node e,
                                             TypeNode tn,
-                                            SygusTermEnumeratorCallback* sec)
+                                            SygusTermEnumeratorCallback* sec,
+                                            SygusEnumerator* se,
+                                            unsigned evictSizes)
 {
   Trace("sygus-enum-debug") << "Init term cache " << tn << "..." << std::endl;
   d_stats = s;
   d_enum = e;
   d_tn = tn;
   d_sec = sec;
+  d_se = se;
+  d_evictSizes = se == nullptr ? 0 : evictSizes;
   d_sizeStartIndex[0] = 0;
   d_isSygusType = false;
 
@@ -334,7 +349,8 @@ unsigned SygusEnumerator::TermCache::getWeightForConstructorClass(
   return it->second.d_weight;
 }
 
-bool SygusEnumerator::TermCache::addTerm(Node n)
+bool SygusEnumerator::TermCache::addTerm(Node n,
+                                         const std::vector<unsigned>& enc)
 {
   if (!d_isSygusType)
   {
@@ -343,6 +359,10 @@ bool SygusEnumerator::TermCache::addTerm(Node n)
     Trace("sygus-enum-terms") << "tc(" << d_tn << "): term (builtin): " << n
                               << std::endl;
     d_terms.push_back(n);
+    if (d_evictSizes > 0)
+    {
+      d_encStart.push_back(d_encData.size() + 1);
+    }
     return true;
   }
   Assert(!n.isNull());
@@ -362,6 +382,18 @@ bool SygusEnumerator::TermCache::addTerm(Node n)
     ++(d_stats->d_enumTerms);
   }
   d_terms.push_back(n);
+  if (d_evictSizes > 0)
+  {
+    if (enc.empty())
+    {
+      d_encStart.push_back(d_encData.size() + 1);
+    }
+    else
+    {
+      d_encStart.push_back(d_encData.size());
+      d_encData.insert(d_encData.end(), enc.begin(), enc.end());
+    }
+  }
   return true;
 }
 void SygusEnumerator::TermCache::pushEnumSizeIndex()
@@ -371,6 +403,42 @@ void SygusEnumerator::TermCache::pushEnumSizeIndex()
   Trace("sygus-enum-debug") << "tc(" << d_tn << "): size " << d_sizeEnum
                             << " terms start at index " << d_terms.size()
                             << std::endl;
+  if (d_evictSizes > 0)
+  {
+    evictTerms();
+  }
+}
+void SygusEnumerator::TermCache::evictTerms()
+{
+  if (d_sizeEnum > d_evictSizes)
+  {
+    // the terms of sizes less than d_sizeEnum - d_evictSizes are evicted
+    size_t end = d_sizeStartIndex[d_sizeEnum - d_evictSizes];
+    for (; d_numEvictChecked < end; d_numEvictChecked++)
+    {
+      if (d_encStart[d_numEvictChecked] < d_encData.size())
+      {
+        d_terms[d_numEvictChecked] = Node::null();
+        d_numEvicted++;
+        if (d_stats != nullptr)
+        {
+          ++(d_stats->d_enumTermsEvicted);
+        }
+      }
+    }
+  }
+  if (TraceIsOn("sygus-enum-mem"))
+  {
+    size_t prev = d_sizeStartIndex[d_sizeEnum - 1];
+    Trace("sygus-enum-mem")
+        << "tc(" << d_tn << "): size " << (d_sizeEnum - 1) << " has "
+        << (d_terms.size() - prev) << " terms; " << d_terms.size()
+        << " terms in total, of which " << d_numEvicted
+        << " are evicted, encodings use "
+        << (d_encData.size() * sizeof(unsigned)
+            + d_encStart.size() * sizeof(size_t))
+        << " bytes" << std::endl;
+  }
 }
 unsigned SygusEnumerator::TermCache::getEnumSize() const { return d_sizeEnum; }
 unsigned SygusEnumerator::TermCache::getIndexForSize(unsigned s) const
@@ -383,9 +451,27 @@ unsigned SygusEnumerator::TermCache::getIndexForSize(unsigned s) const
 Node SygusEnumerator::TermCache::getTerm(unsigned index) const
 {
   Assert(index < d_terms.size());
+  if (d_terms[index].isNull())
+  {
+    return reconstructTerm(index);
+  }
   return d_terms[index];
 }
 
+Node SygusEnumerator::TermCache::reconstructTerm(unsigned index) const
+{
+  Assert(d_evictSizes > 0 && d_encStart[index] < d_encData.size());
+  const unsigned* enc = &d_encData[d_encStart[index]];
+  const DTypeConstructor& dc = d_tn.getDType()[enc[0]];
+  std::vector<Node> children;
+  children.push_back(dc.getConstructor());
+  for (size_t i = 0, nargs = dc.getNumArgs(); i < nargs; i++)
+  {
+    children.push_back(d_se->d_tcache[dc.getArgType(i)].getTerm(enc[i + 1]));
+  }
+  return d_tn.getNodeManager()->mkNode(Kind::APPLY_CONSTRUCTOR, children);
+}
+
 unsigned SygusEnumerator::TermCache::getNumTerms() const
 {
   return d_terms.size();
@@ -475,10 +561,11 @@ Node SygusEnumerator::TermEnumSlave::getCurrent()
   Trace("sygus-enum-debug2") << "slave(" << d_tn
                              << "): indices : " << d_hasIndexNextEnd << " "
                              << d_indexNextEnd << " " << d_index << std::endl;
-  // lookup in the cache
-  return tc.getTerm(d_index);
+  return curr;
 }
 
+unsigned SygusEnumerator::TermEnumSlave::getIndex() const { return d_index; }
+
 bool SygusEnumerator::TermEnumSlave::increment()
 {
   // increment index
@@ -561,7 +648,7 @@ void SygusEnumerator::TermEnumSlave::validateIndexNextEnd()
 void SygusEnumerator::initializeTermCache(TypeNode tn)
 {
   // initialize the term cache
-  d_tcache[tn].initialize(d_stats, d_enum, tn, d_sec);
+  d_tcache[tn].initialize(d_stats, d_enum, tn, d_sec, this, d_enumEvictSizes);
 }
 
 SygusEnumerator::TermEnum* SygusEnumerator::getMasterEnumForType(TypeNode tn)
@@ -658,6 +745,11 @@ Node SygusEnumerator::TermEnumMaster::getCurrent()
   // get the current constructor number
   unsigned cnum = d_ccCons[d_consNum - 1];
   children.push_back(dt[cnum].getConstructor());
+  d_currEnc.clear();
+  if (d_se->d_enumEvictSizes > 0)
+  {
+    d_currEnc.push_back(cnum);
+  }
   // add the current of each child to children
   for (unsigned i = 0, nargs = dt[cnum].getNumArgs(); i < nargs; i++)
   {
@@ -669,6 +761,10 @@ Node SygusEnumerator::TermEnumMaster::getCurrent()
       return cc;
     }
     children.push_back(cc);
+    if (d_se->d_enumEvictSizes > 0)
+    {
+      d_currEnc.push_back(d_children[i].getIndex());
+    }
   }
   if (d_enumShapes)
   {
@@ -878,7 +974,7 @@ bool SygusEnumerator::TermEnumMaster::incrementInternal()
       Node c = getCurrent();
       if (!c.isNull())
       {
-        if (!tc.addTerm(c))
+        if (!tc.addTerm(c, d_currEnc))
         {
           // the term was not unique based on rewriting
           Trace("sygus-enum-debug2") << "master(" << d_tn
@@ -55,6 +55,13 @@ class SygusPbe;
  * and so on, where z1 and z2 are variables of sygus datatype type S. We call
  * these "shapes". This feature can be enabled by setting enumShapes to true
  * in the constructor below.
+ *
+ * Note that this class is not thread-safe, and cannot be used to enumerate
+ * terms in parallel: the terms it enumerates, as well as their builtin and
+ * rewritten forms that are used for redundancy checking, are constructed via
+ * the node manager, which is not thread-safe. The term caches per sygus type
+ * are furthermore shared between all sizes and constructor classes, since
+ * terms of larger size are constructed from the cached terms of smaller size.
  */
 class SygusEnumerator : public EnumValGenerator
 {
@@ -108,6 +115,11 @@ class SygusEnumerator : public EnumValGenerator
   bool d_enumAnyConstHoles;
   /** The number of interpreted constants to consider for each size */
   size_t d_enumNumConsts;
+  /**
+   * The number of sizes whose terms are kept as nodes in the term caches, or
+   * 0 if all terms are kept.
+   */
+  unsigned d_enumEvictSizes;
   /** Term cache
    *
    * This stores a list of terms for a given sygus type. The key features of
@@ -139,6 +151,14 @@ class SygusEnumerator : public EnumValGenerator
    * is an optimization so that such constructors can be skipped for sizes
    * greater than 0, since we know all terms generated by these constructors
    * have size 0.
+   *
+   * If evictSizes is non-zero, only the terms of the evictSizes largest sizes
+   * are stored as nodes. Other terms constructed by a master enumerator are
+   * only stored as their constructor index and the indices of their children
+   * in the term caches of their types, and are reconstructed whenever
+   * requested, e.g. when they are chosen as subterms. This bounds the number
+   * of enumerated nodes we keep alive, while redundancy checking is not
+   * affected, since it is based on the builtin terms in d_bterms.
    */
   class TermCache
   {
@@ -148,7 +168,9 @@ class SygusEnumerator : public EnumValGenerator
     void initialize(SygusStatistics* s,
                     Node e,
                     TypeNode tn,
-                    SygusTermEnumeratorCallback* sec = nullptr);
+                    SygusTermEnumeratorCallback* sec = nullptr,
+                    SygusEnumerator* se = nullptr,
+                    unsigned evictSizes = 0);
     /** get last constructor class index for weight
      *
      * This returns a minimal index n such that all constructor classes at
@@ -167,9 +189,11 @@ class SygusEnumerator : public EnumValGenerator
 
     /**
      * Add sygus term n to this cache, return true if the term was unique based
-     * on the redundancy criteria used by this class.
+     * on the redundancy criteria used by this class. If non-empty, enc is the
+     * encoding of n, that is, the index of its constructor followed by the
+     * indices of its children in the term caches of their types.
      */
-    bool addTerm(Node n);
+    bool addTerm(Node n, const std::vector<unsigned>& enc = {});
     /**
      * Indicate to this cache that we are finished enumerating terms of the
      * current size.
@@ -222,8 +246,30 @@ class SygusEnumerator : public EnumValGenerator
     std::map<unsigned, std::vector<unsigned>> d_cToCIndices;
     //-------------------------end static information about type
 
-    /** the list of sygus terms we have enumerated */
+    /**
+     * The list of sygus terms we have enumerated, where evicted terms are
+     * null.
+     */
     std::vector<Node> d_terms;
+    /** Pointer to the parent, for reconstructing evicted terms */
+    SygusEnumerator* d_se;
+    /** The number of sizes whose terms are kept as nodes, or 0 for all */
+    unsigned d_evictSizes;
+    /**
+     * For each term in d_terms, the start of its encoding in d_encData, or
+     * d_encData.size() + 1 if it has none. Only used if d_evictSizes > 0.
+     */
+    std::vector<size_t> d_encStart;
+    /** The encodings of the terms in d_terms */
+    std::vector<unsigned> d_encData;
+    /** The number of terms in d_terms that we have considered for eviction */
+    size_t d_numEvictChecked;
+    /** The number of evicted terms */
+    size_t d_numEvicted;
+    /** Reconstruct the evicted term at index from its encoding */
+    Node reconstructTerm(unsigned index) const;
+    /** Evict the terms of sizes that are no longer kept as nodes */
+    void evictTerms();
     /** the set of builtin terms corresponding to the above list */
     std::unordered_set<Node> d_bterms;
     /**
@@ -301,6 +347,8 @@ class SygusEnumerator : public EnumValGenerator
     Node getCurrent() override;
     /** increment the enumerator */
     bool increment() override;
+    /** get the index of the current term in the term cache of d_tn */
+    unsigned getIndex() const;
 
    private:
     /** the maximum size of terms this enumerator should enumerate */
@@ -388,6 +436,11 @@ class SygusEnumerator : public EnumValGenerator
     bool d_isIncrementing;
     /** cache for getCurrent() */
     Node d_currTerm;
+    /**
+     * The encoding of d_currTerm, see TermCache::addTerm, if the term cache of
+     * d_tn evicts terms.
+     */
+    std::vector<unsigned> d_currEnc;
     /** is d_currTerm set */
     bool d_currTermSet;
     //----------------------------- current constructor class information
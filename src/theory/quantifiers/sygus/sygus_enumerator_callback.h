@@ -37,6 +37,16 @@ class TermDbSygus;
 /**
  * Class for callbacks in the fast enumerator. This class provides custom
  * criteria for whether or not enumerated values should be considered.
+ *
+ * Note that the redundancies found by this class are intentionally not
+ * persisted across runs, even for a fixed grammar. Redundancy up to rewriting
+ * is a function of the rewriter alone and is recomputed at the cost of one
+ * (cached) rewrite per enumerated term, which is already what a lookup in a
+ * persisted cache would require. Redundancy up to examples depends on the
+ * examples of the conjecture and not only on the grammar. The static symmetry
+ * breaking of SygusSimpleSymBreak is computed once per grammar at a cost
+ * polynomial in its size. Moreover, importing terms would require parsing
+ * them inside the solver, which is not supported at this level.
  */
 class SygusEnumeratorCallback : public SygusTermEnumeratorCallback,
                                 protected EnvObj
@@ -26,7 +26,8 @@ SygusStatistics::SygusStatistics(StatisticsRegistry& sr)
       d_enumTermsRewrite(sr.registerInt("SygusEnumerator::enumTermsRewrite")),
       d_enumTermsExampleEval(
           sr.registerInt("SygusEnumerator::enumTermsEvalExamples")),
-      d_enumTerms(sr.registerInt("SygusEnumerator::enumTerms"))
+      d_enumTerms(sr.registerInt("SygusEnumerator::enumTerms")),
+      d_enumTermsEvicted(sr.registerInt("SygusEnumerator::enumTermsEvicted"))
 
 {
 }
@@ -42,6 +42,8 @@ class SygusStatistics
   IntStat d_enumTermsExampleEval;
   /** Number of non-redundant terms generated by fast enumerators */
   IntStat d_enumTerms;
+  /** Number of terms of fast enumerators only kept in a compact encoding */
+  IntStat d_enumTermsEvicted;
 };
 
 }  // namespace quantifiers
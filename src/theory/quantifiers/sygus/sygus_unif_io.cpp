@@ -15,6 +15,8 @@
 
 #include "theory/quantifiers/sygus/sygus_unif_io.h"
 
+#include <bitset>
+
 #include "options/quantifiers_options.h"
 #include "theory/datatypes/sygus_datatype_utils.h"
 #include "theory/quantifiers/sygus/example_infer.h"
@@ -33,6 +35,12 @@ namespace cvc5::internal {
 namespace theory {
 namespace quantifiers {
 
+/** Returns the number of words in a bit vector with one bit per example */
+static size_t getNumWords(size_t nex) { return (nex + 63) / 64; }
+
+/** Returns the number of bits set in the word w */
+static size_t countBits(uint64_t w) { return std::bitset<64>(w).count(); }
+
 UnifContextIo::UnifContextIo(NodeManager* nm)
     : d_nm(nm), d_curr_role(role_invalid)
 {
@@ -548,6 +556,23 @@ void SygusUnifIo::initializeCandidate(
       d_examples_out.push_back(output);
     }
   }
+  // group the examples by their output
+  d_examples_out_class.clear();
+  d_examples_out_bits.clear();
+  std::map<Node, size_t> outClass;
+  size_t nwords = getNumWords(d_examples_out.size());
+  for (size_t i = 0, nex = d_examples_out.size(); i < nex; i++)
+  {
+    std::map<Node, size_t>::iterator it = outClass.find(d_examples_out[i]);
+    if (it == outClass.end())
+    {
+      size_t k = d_examples_out_bits.size();
+      it = outClass.emplace(d_examples_out[i], k).first;
+      d_examples_out_bits.emplace_back(nwords, 0);
+    }
+    d_examples_out_class.push_back(it->second);
+    d_examples_out_bits[it->second][i / 64] |= uint64_t(1) << (i % 64);
+  }
   d_ecache.clear();
   SygusUnif::initializeCandidate(tds, f, enums, strategy_lemmas);
   // learn redundant operators based on the strategy
@@ -1003,6 +1028,20 @@ void SygusUnifIo::EnumCache::addEnumValue(Node v, std::vector<Node>& results)
   d_enum_val_to_index[v] = d_enum_vals.size();
   d_enum_vals.push_back(v);
   d_enum_vals_res.push_back(results);
+  std::vector<uint64_t> bits(getNumWords(results.size()), 0);
+  for (size_t i = 0, nres = results.size(); i < nres; i++)
+  {
+    if (!results[i].isConst() || !results[i].getType().isBoolean())
+    {
+      bits.clear();
+      break;
+    }
+    if (results[i].getConst<bool>())
+    {
+      bits[i / 64] |= uint64_t(1) << (i % 64);
+    }
+  }
+  d_enum_vals_bits.push_back(bits);
 }
 
 void SygusUnifIo::initializeConstructSol()
@@ -1595,9 +1634,15 @@ Node SygusUnifIo::constructBestConditional(Node ce,
   // Get the index of conds[j] in the enumerator cache, this is to look up
   // its evaluation on each point.
   std::vector<unsigned> eindex;
+  bool useBits = true;
   for (unsigned j = 0; j < nconds; j++)
   {
     eindex.push_back(ecache.d_enum_val_to_index[conds[j]]);
+    useBits = useBits && !ecache.d_enum_vals_bits[eindex.back()].empty();
+  }
+  if (useBits)
+  {
+    return constructBestConditionalBits(ecache, conds, eindex);
   }
   unsigned activePoints = 0;
   for (unsigned i = 0, npoints = x.d_vals.size(); i < npoints; i++)
@@ -1680,6 +1725,139 @@ Node SygusUnifIo::constructBestConditional(Node ce,
   return conds[bestIndex];
 }
 
+Node SygusUnifIo::constructBestConditionalBits(
+    EnumCache& ecache,
+    const std::vector<Node>& conds,
+    const std::vector<unsigned>& eindex)
+{
+  UnifContextIo& x = d_context;
+  size_t npoints = x.d_vals.size();
+  size_t nwords = getNumWords(npoints);
+  // the active points of the context
+  std::vector<uint64_t> active(nwords, 0);
+  std::vector<unsigned> activeIndices;
+  for (size_t i = 0; i < npoints; i++)
+  {
+    if (x.d_vals[i].getConst<bool>())
+    {
+      active[i / 64] |= uint64_t(1) << (i % 64);
+      activeIndices.push_back(i);
+    }
+  }
+  size_t activePoints = activeIndices.size();
+  AlwaysAssert(activePoints > 0);
+  // the output classes having an active point, with their active points
+  std::vector<size_t> classes;
+  std::vector<std::vector<uint64_t>> classActive;
+  std::vector<size_t> classCount;
+  for (size_t k = 0, nclasses = d_examples_out_bits.size(); k < nclasses; k++)
+  {
+    std::vector<uint64_t> ca(nwords);
+    size_t count = 0;
+    for (size_t w = 0; w < nwords; w++)
+    {
+      ca[w] = d_examples_out_bits[k][w] & active[w];
+      count += countBits(ca[w]);
+    }
+    if (count > 0)
+    {
+      classes.push_back(k);
+      classActive.push_back(ca);
+      classCount.push_back(count);
+    }
+  }
+  // Counting by word-wise set operations is preferable unless there are many
+  // distinct outputs, in which case we count on the active points directly.
+  bool countWords = classes.size() * nwords <= activePoints;
+  std::vector<size_t> classIndex(d_examples_out_bits.size(), 0);
+  for (size_t c = 0, nclasses = classes.size(); c < nclasses; c++)
+  {
+    classIndex[classes[c]] = c;
+  }
+  // the number of active points on which the current condition is true, for
+  // each class
+  std::vector<size_t> trueCount(classes.size());
+  // find the condition that leads to the lowest entropy, as in
+  // constructBestConditional
+  double minEntropy = 2.0;
+  size_t bestIndex = 0;
+  int numEqual = 1;
+  for (size_t j = 0, nconds = conds.size(); j < nconds; j++)
+  {
+    const std::vector<uint64_t>& cbits = ecache.d_enum_vals_bits[eindex[j]];
+    Assert(cbits.size() == nwords);
+    if (countWords)
+    {
+      for (size_t c = 0, nclasses = classes.size(); c < nclasses; c++)
+      {
+        size_t count = 0;
+        for (size_t w = 0; w < nwords; w++)
+        {
+          count += countBits(cbits[w] & classActive[c][w]);
+        }
+        trueCount[c] = count;
+      }
+    }
+    else
+    {
+      std::fill(trueCount.begin(), trueCount.end(), 0);
+      for (unsigned i : activeIndices)
+      {
+        if ((cbits[i / 64] >> (i % 64)) & 1)
+        {
+          trueCount[classIndex[d_examples_out_class[i]]]++;
+        }
+      }
+    }
+    size_t branchTrue = 0;
+    for (size_t count : trueCount)
+    {
+      branchTrue += count;
+    }
+    size_t branchFalse = activePoints - branchTrue;
+    double entropySum = 0.0;
+    for (size_t c = 0, nclasses = classes.size(); c < nclasses; c++)
+    {
+      size_t counts[2] = {trueCount[c], classCount[c] - trueCount[c]};
+      size_t branches[2] = {branchTrue, branchFalse};
+      for (size_t b = 0; b < 2; b++)
+      {
+        if (counts[b] > 0)
+        {
+          double probBranch = double(branches[b]) / double(activePoints);
+          double probVal = double(counts[b]) / double(branches[b]);
+          entropySum += probBranch * -probVal * log2(probVal);
+        }
+      }
+    }
+    Trace("sygus-sui-dt-igain") << j << " : " << branchTrue << "/"
+                                << activePoints << " ..." << entropySum
+                                << std::endl;
+    // either less, or equal and coin flip passes
+    bool doSet = false;
+    if (entropySum == minEntropy)
+    {
+      numEqual++;
+      if (Random::getRandom().pickWithProb(double(1) / double(numEqual)))
+      {
+        doSet = true;
+      }
+    }
+    else if (entropySum < minEntropy)
+    {
+      doSet = true;
+      numEqual = 1;
+    }
+    if (doSet)
+    {
+      minEntropy = entropySum;
+      bestIndex = j;
+    }
+  }
+  Assert(!conds.empty());
+  return conds[bestIndex];
+}
+
 }  // namespace quantifiers
 }  // namespace theory
 }  // namespace cvc5::internal
@@ -347,6 +347,13 @@ class SygusUnifIo : public SygusUnif
   std::vector<std::vector<Node>> d_examples;
   /** output of I/O examples */
   std::vector<Node> d_examples_out;
+  /** For each I/O example, the index of its output in d_examples_out_bits */
+  std::vector<size_t> d_examples_out_class;
+  /**
+   * For each distinct output of the I/O examples, the set of examples having
+   * that output, as a bit vector packed in words.
+   */
+  std::vector<std::vector<uint64_t>> d_examples_out_bits;
 
   /**
   * This class stores information regarding an enumerator, including:
@@ -378,6 +385,13 @@ class SygusUnifIo : public SygusUnif
       * or the value of f( I ) = O if d_role==enum_io
       */
     std::vector<std::vector<Node>> d_enum_vals_res;
+    /**
+     * For each value in d_enum_vals, the examples on which it evaluates to
+     * true as a bit vector packed in words, if all values in its entry of
+     * d_enum_vals_res are Boolean constants, or empty otherwise. This is used
+     * for computing the information gain of conditions.
+     */
+    std::vector<std::vector<uint64_t>> d_enum_vals_bits;
     /**
     * The set of values in d_enum_vals that have been "subsumed" by others
     * (see SubsumeTrie for explanation of subsumed).
@@ -465,6 +479,14 @@ class SygusUnifIo : public SygusUnif
    */
   Node constructBestConditional(Node ce,
                                 const std::vector<Node>& conds) override;
+  /**
+   * Same as above, where the truth vectors of all conditions are available in
+   * ecache, and eindex are the indices of conds in ecache. This computes the
+   * information gain using set operations on these vectors.
+   */
+  Node constructBestConditionalBits(EnumCache& ecache,
+                                    const std::vector<Node>& conds,
+                                    const std::vector<unsigned>& eindex);
 };
 
 }  // namespace quantifiers
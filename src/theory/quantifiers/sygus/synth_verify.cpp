@@ -21,6 +21,7 @@
 #include "options/datatypes_options.h"
 #include "options/quantifiers_options.h"
 #include "smt/set_defaults.h"
+#include "smt/solver_engine.h"
 #include "theory/quantifiers/first_order_model.h"
 #include "theory/quantifiers/sygus/term_database_sygus.h"
 #include "theory/rewriter.h"
@@ -58,6 +59,11 @@ SynthVerify::SynthVerify(Env& env, TermDbSygus* tds)
   d_subOptions.write_datatypes().dtSharedSelectors =
       options().datatypes.dtSharedSelectors;
   d_subOptions.write_datatypes().dtSharedSelectorsWasSetByUser = true;
+  // the subsolver for sygusVerifyIncremental answers multiple queries
+  if (d_subOptions.quantifiers.sygusVerifyIncremental)
+  {
+    d_subOptions.write_base().incrementalSolving = true;
+  }
   // disable checking
   smt::SetDefaults::disableChecking(d_subOptions);
 }
@@ -86,16 +92,23 @@ Result SynthVerify::verify(Node query,
       }
       // sat, but we need to get arbtirary model values below
     }
-    SubsolverSetupInfo ssi(d_subOptions,
-                           d_subLogicInfo,
-                           d_env.getSepLocType(),
-                           d_env.getSepDataType());
-    r = checkWithSubsolver(queryp,
-                           vars,
-                           mvs,
-                           ssi,
-                           options().quantifiers.sygusVerifyTimeout != 0,
-                           options().quantifiers.sygusVerifyTimeout);
+    if (options().quantifiers.sygusVerifyIncremental)
+    {
+      r = checkIncremental(queryp, vars, mvs);
+    }
+    else
+    {
+      SubsolverSetupInfo ssi(d_subOptions,
+                             d_subLogicInfo,
+                             d_env.getSepLocType(),
+                             d_env.getSepDataType());
+      r = checkWithSubsolver(queryp,
+                             vars,
+                             mvs,
+                             ssi,
+                             options().quantifiers.sygusVerifyTimeout != 0,
+                             options().quantifiers.sygusVerifyTimeout);
+    }
     finished = true;
     Trace("sygus-engine") << "  ...got " << r << std::endl;
     // we try to learn models for "sat" and "unknown" here
@@ -162,6 +175,34 @@ Result SynthVerify::verify(Node query)
   return verify(query, vars, mvs);
 }
 
+Result SynthVerify::checkIncremental(Node queryp,
+                                     const std::vector<Node>& vars,
+                                     std::vector<Node>& mvs)
+{
+  mvs.clear();
+  if (d_subsolver == nullptr)
+  {
+    SubsolverSetupInfo ssi(d_subOptions,
+                           d_subLogicInfo,
+                           d_env.getSepLocType(),
+                           d_env.getSepDataType());
+    initializeSubsolver(nodeManager(),
+                        d_subsolver,
+                        ssi,
+                        options().quantifiers.sygusVerifyTimeout != 0,
+                        options().quantifiers.sygusVerifyTimeout);
+  }
+  Result r = d_subsolver->checkSat(queryp);
+  if (r.getStatus() == Result::SAT || r.getStatus() == Result::UNKNOWN)
+  {
+    for (const Node& v : vars)
+    {
+      mvs.push_back(d_subsolver->getValue(v));
+    }
+  }
+  return r;
+}
+
 Node SynthVerify::preprocessQueryInternal(Node query)
 {
   NodeManager* nm = nodeManager();
@@ -26,6 +26,8 @@
 #include "util/result.h"
 
 namespace cvc5::internal {
+
+class SolverEngine;
 namespace theory {
 namespace quantifiers {
 
@@ -68,12 +70,23 @@ class SynthVerify : protected EnvObj
    * and its current I/O pairs are communicated explicitly via these conjuncts.
    */
   Node preprocessQueryInternal(Node query);
+  /**
+   * Check the preprocessed query queryp using d_subsolver, which is
+   * initialized if not done so already. The query is checked as an assumption,
+   * so that the subsolver is unchanged after this call. Returns the result of
+   * the check, and adds to mvs the model values of vars if it is not unsat.
+   */
+  Result checkIncremental(Node queryp,
+                          const std::vector<Node>& vars,
+                          std::vector<Node>& mvs);
   /** Pointer to the term database sygus */
   TermDbSygus* d_tds;
   /** The options for subsolver calls */
   Options d_subOptions;
   /** The logic info for subsolver calls */
   const LogicInfo& d_subLogicInfo;
+  /** The subsolver for all verification checks, if sygusVerifyIncremental */
+  std::unique_ptr<SolverEngine> d_subsolver;
 };
 
 }  // namespace quantifiers
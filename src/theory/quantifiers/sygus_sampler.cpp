@@ -24,6 +24,7 @@
 #include "options/quantifiers_options.h"
 #include "printer/printer.h"
 #include "theory/datatypes/sygus_datatype_utils.h"
+#include "theory/evaluator.h"
 #include "theory/quantifiers/lazy_trie.h"
 #include "theory/quantifiers/sygus/term_database_sygus.h"
 #include "theory/rewriter.h"
@@ -31,6 +32,7 @@
 #include "util/random.h"
 #include "util/rational.h"
 #include "util/sampler.h"
+#include "util/hash.h"
 #include "util/string.h"
 
 using namespace cvc5::internal::kind;
@@ -252,6 +254,7 @@ void SygusSampler::initializeSamples(unsigned nsamples)
   }
 
   d_trie.clear();
+  d_fpTerms.clear();
 }
 
 bool SygusSampler::PtTrie::add(std::vector<Node>& pt)
@@ -273,11 +276,53 @@ Node SygusSampler::registerTerm(Node n, bool forceKeep)
     // do nothing
     return n;
   }
+  if (options().quantifiers.sygusSampleFingerprint)
+  {
+    return registerTermFingerprint(n, forceKeep);
+  }
   TypeNode tn = n.getType();
   // cache based on the (original) type of n
   return d_trie[tn].add(n, this, 0, d_samples.size(), forceKeep);
 }
 
+size_t SygusSampler::FingerprintHashFunction::operator()(
+    const Fingerprint& fp) const
+{
+  uint64_t hash = fnv1a::offsetBasis;
+  for (const Node& v : fp)
+  {
+    hash = fnv1a::fnv1a_64(std::hash<Node>()(v), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
+Node SygusSampler::registerTermFingerprint(Node n, bool forceKeep)
+{
+  Fingerprint fp;
+  computeFingerprint(n, 0, fp);
+  // cache based on the (original) type of n
+  FingerprintMap& fpm = d_fpTerms[n.getType()];
+  std::pair<FingerprintMap::iterator, bool> res = fpm.emplace(fp, n);
+  if (!res.second && forceKeep)
+  {
+    res.first->second = n;
+  }
+  return res.first->second;
+}
+
+void SygusSampler::computeFingerprint(Node n, size_t start, Fingerprint& fp)
+{
+  // n is evaluated on (typically) many sample points, hence we compile it
+  Evaluator* ev = d_env.getEvaluator(true);
+  CompiledTerm ct = ev->compile(d_env.getRewriter()->rewrite(n), d_vars);
+  for (size_t i = start, nsamp = d_samples.size(); i < nsamp; i++)
+  {
+    Node e = ev->eval(ct, d_samples[i]);
+    Assert(!e.isNull());
+    fp.push_back(e);
+  }
+}
+
 bool SygusSampler::isContiguous(Node n)
 {
   // compute free variables in n
@@ -447,6 +492,20 @@ void SygusSampler::addSamplePoint(const std::vector<Node>& pt)
 {
   Assert(pt.size() == d_vars.size());
   d_samples.push_back(pt);
+  // extend the fingerprints of the representatives with the new point, which
+  // keeps them distinct
+  size_t index = d_samples.size() - 1;
+  for (std::pair<const TypeNode, FingerprintMap>& p : d_fpTerms)
+  {
+    FingerprintMap fpm;
+    for (const std::pair<const Fingerprint, Node>& e : p.second)
+    {
+      Fingerprint fp = e.first;
+      computeFingerprint(e.second, index, fp);
+      fpm.emplace(fp, e.second);
+    }
+    p.second = std::move(fpm);
+  }
 }
 
 Node SygusSampler::evaluate(Node n, unsigned index)
@@ -464,10 +523,16 @@ Node SygusSampler::evaluate(Node n, unsigned index)
 
 int SygusSampler::getDiffSamplePointIndex(Node a, Node b)
 {
+  // a and b are evaluated on all sample points, hence we compile them once
+  Rewriter* rr = d_env.getRewriter();
+  Evaluator* ev = d_env.getEvaluator(true);
+  CompiledTerm ac = ev->compile(rr->rewrite(a), d_vars);
+  CompiledTerm bc = ev->compile(rr->rewrite(b), d_vars);
   for (unsigned i = 0, nsamp = d_samples.size(); i < nsamp; i++)
   {
-    Node ae = evaluate(a, i);
-    Node be = evaluate(b, i);
+    Node ae = ev->eval(ac, d_samples[i]);
+    Node be = ev->eval(bc, d_samples[i]);
+    Assert(!ae.isNull() && !be.isNull());
     if (ae != be)
     {
       return i;
@@ -19,6 +19,7 @@
 #define CVC5__THEORY__QUANTIFIERS__SYGUS_SAMPLER_H
 
 #include <map>
+#include <unordered_map>
 
 #include "smt/env_obj.h"
 #include "theory/quantifiers/lazy_trie.h"
@@ -186,6 +187,21 @@ class SygusSampler : protected EnvObj, public LazyTrieEvaluator
   };
   /** a trie for samples */
   PtTrie d_samples_trie;
+  /** The evaluation of a term on all sample points */
+  using Fingerprint = std::vector<Node>;
+  /** Hash function for fingerprints */
+  struct FingerprintHashFunction
+  {
+    size_t operator()(const Fingerprint& fp) const;
+  };
+  using FingerprintMap =
+      std::unordered_map<Fingerprint, Node, FingerprintHashFunction>;
+  /**
+   * For each type, a map from fingerprints to the representative term with
+   * that fingerprint. This is used instead of d_trie if
+   * sygusSampleFingerprint is true.
+   */
+  std::map<TypeNode, FingerprintMap> d_fpTerms;
   /** the sygus type for this sampler (if applicable). */
   TypeNode d_ftn;
   /** whether we are registering terms of sygus types with this sampler */
@@ -255,6 +271,17 @@ class SygusSampler : protected EnvObj, public LazyTrieEvaluator
    * Adds nsamples sample points to d_samples.
    */
   void initializeSamples(unsigned nsamples);
+  /**
+   * Register term n using d_fpTerms, where n is evaluated on all sample points
+   * at once using a compiled term. Returns the representative of the
+   * fingerprint of n, which is n itself if forceKeep is true.
+   */
+  Node registerTermFingerprint(Node n, bool forceKeep);
+  /**
+   * Append to fp the evaluation of n on the sample points with index start
+   * and greater.
+   */
+  void computeFingerprint(Node n, size_t start, Fingerprint& fp);
   /** get random value for a type
    *
    * Returns a random value for the given type based on the random number
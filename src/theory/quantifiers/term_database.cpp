@@ -15,6 +15,8 @@
 
 #include "theory/quantifiers/term_database.h"
 
+#include <limits>
+
 #include "expr/skolem_manager.h"
 #include "expr/sort_to_term.h"
 #include "options/base_options.h"
@@ -111,10 +113,15 @@ TermDb::TermDb(Env& env, QuantifiersState& qs, QuantifiersRegistry& qr)
       d_qim(nullptr),
       d_qreg(qr),
       d_processed(context()),
+      d_modTime(0),
+      d_termAddTime(context()),
+      d_classMergeTime(context()),
       d_typeMap(context()),
       d_ops(context()),
       d_opMap(context()),
       d_inactive_map(context()),
+      d_opCurrentStamp(context()),
+      d_trieStamp(0),
       d_has_map(context()),
       d_dcproof(options().smt.produceProofs ? new DeqCongProofGenerator(d_env)
                                             : nullptr)
@@ -297,10 +304,71 @@ void TermDb::eqNotifyMerge(TNode t1, TNode t2)
     setHasTerm(t1);
     setHasTerm(t2);
   }
+  if (isIncrementalSigTable())
+  {
+    // The signature tables that have t1 or t2 as an argument are stale. We
+    // keep the entries of d_repToOps, since the tables may become current
+    // again after backtracking.
+    for (TNode t : {t1, t2})
+    {
+      std::map<Node, std::unordered_set<Node>>::iterator it =
+          d_repToOps.find(t);
+      if (it != d_repToOps.end())
+      {
+        for (const Node& f : it->second)
+        {
+          d_opCurrentStamp[f] = 0;
+        }
+      }
+    }
+  }
+  if (tracksModifications())
+  {
+    // we do not know which of the two is the new representative
+    d_modTime++;
+    d_classMergeTime[t1] = d_modTime;
+    d_classMergeTime[t2] = d_modTime;
+  }
+}
+
+void TermDb::eqNotifyDisequal(TNode t1, TNode t2)
+{
+  if (tracksModifications())
+  {
+    d_modTime++;
+  }
+}
+
+bool TermDb::tracksModifications() const
+{
+  return options().quantifiers.ematchIncremental
+         || options().quantifiers.cbqiIncremental;
+}
+
+uint64_t TermDb::getTermAddTime(TNode n) const
+{
+  context::CDHashMap<Node, uint64_t>::const_iterator it = d_termAddTime.find(n);
+  if (it == d_termAddTime.end())
+  {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  return it->second;
+}
+
+uint64_t TermDb::getClassMergeTime(TNode r) const
+{
+  context::CDHashMap<Node, uint64_t>::const_iterator it =
+      d_classMergeTime.find(r);
+  return it == d_classMergeTime.end() ? 0 : it->second;
 }
 
 void TermDb::addTerm(Node n)
 {
+  if (isIncrementalSigTable())
+  {
+    // n may have become relevant or been added to the equality engine
+    markSigTableStale(n);
+  }
   if (d_processed.find(n) != d_processed.end())
   {
     return;
@@ -319,6 +387,11 @@ void TermDb::addTerm(Node n)
       Trace("term-db-debug") << "  match operator is : " << op << std::endl;
       DbList* dlo = getOrMkDbListForOp(op);
       dlo->d_list.push_back(n);
+      if (tracksModifications())
+      {
+        d_modTime++;
+        d_termAddTime[n] = d_modTime;
+      }
       // If we are higher-order, we may need to register more terms.
       addTermInternal(n);
     }
@@ -407,7 +480,21 @@ void TermDb::computeUfEqcTerms( TNode f ) {
 }
 
 void TermDb::computeUfTerms( TNode f ) {
-  if (d_op_nonred_count.find(f) != d_op_nonred_count.end())
+  bool incremental = isIncrementalSigTable();
+  if (incremental)
+  {
+    context::CDHashMap<Node, uint64_t>::const_iterator its =
+        d_opCurrentStamp.find(f);
+    if (its != d_opCurrentStamp.end() && its->second != 0
+        && its->second == d_opTrieStamp[f])
+    {
+      // computed in a previous round and still current
+      return;
+    }
+    d_func_map_trie[f].clear();
+    d_fmapRelDom.erase(f);
+  }
+  else if (d_op_nonred_count.find(f) != d_op_nonred_count.end())
   {
     // already computed
     return;
@@ -456,6 +543,13 @@ void TermDb::computeUfTerms( TNode f ) {
       Assert(d_qstate.hasTerm(n));
       Trace("term-db-debug")
           << "  and value : " << d_qstate.getRepresentative(n) << std::endl;
+      if (incremental)
+      {
+        for (TNode r : reps)
+        {
+          d_repToOps[r].insert(f);
+        }
+      }
       Node at = d_func_map_trie[f].addOrGetTerm(n, reps);
       Assert(d_qstate.hasTerm(at));
       Trace("term-db-debug2") << "...add term returned " << at << std::endl;
@@ -528,6 +622,33 @@ void TermDb::computeUfTerms( TNode f ) {
                    << std::endl;
     }
   }
+  if (incremental)
+  {
+    d_trieStamp++;
+    d_opTrieStamp[f] = d_trieStamp;
+    d_opCurrentStamp[f] = d_trieStamp;
+  }
+}
+
+bool TermDb::isIncrementalSigTable() const
+{
+  // the operators of higher-order terms may be merged, hence we always
+  // recompute the tables in that case
+  return options().quantifiers.termDbIncremental
+         && !logicInfo().isHigherOrder();
+}
+
+void TermDb::markSigTableStale(TNode n)
+{
+  Node op = getMatchOperator(n);
+  if (!op.isNull())
+  {
+    op = getOperatorRepresentative(op);
+    if (d_opCurrentStamp.find(op) != d_opCurrentStamp.end())
+    {
+      d_opCurrentStamp[op] = 0;
+    }
+  }
 }
 
 Node TermDb::getOperatorRepresentative(TNode op) const { return op; }
@@ -674,6 +795,14 @@ void TermDb::setHasTerm(Node n)
     if (d_has_map.find(cur) == d_has_map.end())
     {
       d_has_map.insert(cur);
+      if (tracksModifications())
+      {
+        d_modTime++;
+      }
+      if (isIncrementalSigTable())
+      {
+        markSigTableStale(cur);
+      }
       visit.insert(visit.end(), cur.begin(), cur.end());
     }
   } while (!visit.empty());
@@ -682,11 +811,15 @@ void TermDb::setHasTerm(Node n)
 void TermDb::presolve() {}
 
 bool TermDb::reset( Theory::Effort effort ){
-  d_op_nonred_count.clear();
   d_arg_reps.clear();
-  d_func_map_trie.clear();
   d_func_map_eqc_trie.clear();
-  d_fmapRelDom.clear();
+  // the signature tables are otherwise recomputed when they become stale
+  if (!isIncrementalSigTable())
+  {
+    d_op_nonred_count.clear();
+    d_func_map_trie.clear();
+    d_fmapRelDom.clear();
+  }
 
   Assert(d_qstate.getEqualityEngine()->consistent());
 
@@ -706,7 +839,7 @@ bool TermDb::reset( Theory::Effort effort ){
       // remaining terms that appear in assertions are marked relevant here
       // in case there are terms appearing in assertions but not in the master
       // equality engine.
-      for (context::CDList<Assertion>::const_iterator
+      for (FactList::const_iterator
                it = d_qstate.factsBegin(theoryId),
                it_end = d_qstate.factsEnd(theoryId);
            it != it_end;
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "context/cdhashmap.h"
 #include "context/cdhashset.h"
@@ -128,6 +129,28 @@ class TermDb : public QuantifiersUtil {
   void addTerm(Node n);
   /** notification when master equality engine merges two classes*/
   void eqNotifyMerge(TNode t1, TNode t2);
+  /** notification when master equality engine makes two classes disequal */
+  void eqNotifyDisequal(TNode t1, TNode t2);
+  /**
+   * Get the current modification time. This is increased whenever a term is
+   * added to this database or becomes relevant, or two equivalence classes
+   * are merged or made disequal, if tracksModifications() holds. Since it is
+   * not decreased on backtracking, the state of the equality engine is
+   * unchanged if this time is unchanged since a point in the current context.
+   */
+  uint64_t getModificationTime() const { return d_modTime; }
+  /** Is the modification time tracked (by incremental E-matching or CBQI)? */
+  bool tracksModifications() const;
+  /**
+   * Get the time at which term n was added to this database, or the maximal
+   * time if unknown.
+   */
+  uint64_t getTermAddTime(TNode n) const;
+  /**
+   * Get the time at which the equivalence class of representative r was last
+   * merged, or 0 if it was never merged in the current context.
+   */
+  uint64_t getClassMergeTime(TNode r) const;
   /** Get the currently added ground terms of the given type */
   DbList* getOrMkDbListForType(TypeNode tn);
   /** Get the currently added ground terms for the given operator */
@@ -228,6 +251,12 @@ class TermDb : public QuantifiersUtil {
   context::Context* d_termsContextUse;
   /** terms processed */
   NodeSet d_processed;
+  /** The current modification time, see getModificationTime */
+  uint64_t d_modTime;
+  /** Map from terms to the time they were added */
+  context::CDHashMap<Node, uint64_t> d_termAddTime;
+  /** Map from representatives to the time their class was last merged */
+  context::CDHashMap<Node, uint64_t> d_classMergeTime;
   /** map from types to ground terms for that type */
   TypeNodeDbListMap d_typeMap;
   /** list of all operators */
@@ -249,6 +278,23 @@ class TermDb : public QuantifiersUtil {
   std::map< TNode, std::vector< TNode > > d_arg_reps;
   /** map from operators to trie */
   std::map<Node, TNodeTrie> d_func_map_trie;
+  /**
+   * If the signature tables are kept across rounds (--term-db-incremental),
+   * this maps operators to the stamp of the last computation of their entries
+   * in d_func_map_trie, d_op_nonred_count and d_fmapRelDom. The entries of f
+   * are current if this context-dependent map contains the stamp of its
+   * entries in d_opTrieStamp, hence they are recomputed after backtracking.
+   */
+  context::CDHashMap<Node, uint64_t> d_opCurrentStamp;
+  /** Map from operators to the stamp of their current entries */
+  std::map<Node, uint64_t> d_opTrieStamp;
+  /** The last stamp given to the entries of an operator */
+  uint64_t d_trieStamp;
+  /**
+   * Map from representatives to the operators whose signature tables they
+   * occur in as arguments. This may contain more operators than necessary.
+   */
+  std::map<Node, std::unordered_set<Node>> d_repToOps;
   std::map<Node, TNodeTrie> d_func_map_eqc_trie;
   /**
    * Mapping from operators to their representative relevant domains. The
@@ -299,6 +345,10 @@ class TermDb : public QuantifiersUtil {
   * Ensure that an entry for f is in d_func_map_trie
   */
   void computeUfTerms( TNode f );
+  /** Are the signature tables kept across rounds? */
+  bool isIncrementalSigTable() const;
+  /** Mark the signature table of the match operator of n (if any) as stale */
+  void markSigTableStale(TNode n);
   /** compute arg reps
   * Ensure that an entry for n is in d_arg_reps
   */
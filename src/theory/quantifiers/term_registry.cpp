@@ -83,6 +83,11 @@ void TermRegistry::eqNotifyMerge(TNode t1, TNode t2)
   d_termDb->eqNotifyMerge(t1, t2);
 }
 
+void TermRegistry::eqNotifyDisequal(TNode t1, TNode t2)
+{
+  d_termDb->eqNotifyDisequal(t1, t2);
+}
+
 void TermRegistry::addTermInternal(TNode n, bool withinQuant)
 {
   // don't add terms in quantifier bodies
@@ -56,6 +56,8 @@ class TermRegistry : protected EnvObj
   void eqNotifyNewClass(TNode t);
   /** notification when master equality engine merges two classes*/
   void eqNotifyMerge(TNode t1, TNode t2);
+  /** notification when master equality engine makes two classes disequal */
+  void eqNotifyDisequal(TNode t1, TNode t2);
 
   /** get term for type
    *
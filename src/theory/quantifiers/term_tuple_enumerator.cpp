@@ -19,14 +19,17 @@
 #include <functional>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <vector>
 
 #include "base/map_util.h"
 #include "base/output.h"
 #include "options/quantifiers_options.h"
+#include "theory/quantifiers/ieval/inst_evaluator.h"
 #include "theory/quantifiers/index_trie.h"
 #include "theory/quantifiers/instantiate.h"
 #include "theory/quantifiers/quant_module.h"
+#include "theory/quantifiers/quantifiers_attributes.h"
 #include "theory/quantifiers/relevant_domain.h"
 #include "theory/quantifiers/term_pools.h"
 #include "theory/quantifiers/term_registry.h"
@@ -90,13 +93,20 @@ class TermTupleEnumeratorBase : public TermTupleEnumeratorInterface
         d_env(env),
         d_stepCounter(0),
         d_disabledCombinations(
-            true)  // do not record combinations with no blanks
-
+            true),  // do not record combinations with no blanks
+        d_ieval(nullptr)
   {
     d_changePrefix = d_variableCount;
   }
 
-  virtual ~TermTupleEnumeratorBase() = default;
+  virtual ~TermTupleEnumeratorBase()
+  {
+    // the evaluator is shared, clear our assignments from it
+    if (d_ieval != nullptr)
+    {
+      d_ieval->resetAll();
+    }
+  }
 
   // implementation of the TermTupleEnumeratorInterface
   virtual void init() override;
@@ -156,6 +166,29 @@ class TermTupleEnumeratorBase : public TermTupleEnumeratorInterface
   /** Get a given term for a given variable.  */
   CVC5_WARN_UNUSED_RESULT virtual Node getTerm(size_t variableIx,
                                                size_t term_index) = 0;
+
+  /**
+   * The instantiation evaluator of the quantifier, if we prune tuples based on
+   * TermTupleEnumeratorEnv::d_ieval.
+   */
+  ieval::InstEvaluator* d_ieval;
+  /** The terms currently assigned to the first variables in d_ieval */
+  std::vector<Node> d_ievalTerms;
+  /**
+   * For each variable, the indices of its terms in the order they are
+   * enumerated, if TermTupleEnumeratorEnv::d_orderTerms holds.
+   */
+  std::vector<std::vector<size_t>> d_termOrder;
+  /** Compute d_termOrder for the given variable. */
+  void orderTerms(size_t variableIx);
+  /** Get the term of the given index in the enumeration order. */
+  Node getOrderedTerm(size_t variableIx, size_t termIndex);
+  /**
+   * Return true if the instantiation evaluator determines that terms has a
+   * prefix for which all instances are entailed. In this case, all tuples
+   * with this prefix are disabled, and the change prefix is set accordingly.
+   */
+  bool isPruned(const std::vector<Node>& terms);
 };
 
 /**
@@ -242,11 +275,89 @@ void TermTupleEnumeratorBase::init()
     }
     d_termsSizes.push_back(termsSize);
     d_stageCount = std::max(d_stageCount, termsSize);
+    if (d_env->d_orderTerms)
+    {
+      orderTerms(variableIx);
+    }
   }
 
   Trace("inst-alg-rd") << "Will do " << d_stageCount
                        << " stages of instantiation." << std::endl;
   d_termIndex.resize(d_variableCount, 0);
+  if (d_env->d_ieval)
+  {
+    d_ieval = d_env->d_tr->getEvaluator(d_quantifier,
+                                        ieval::TermEvaluatorMode::NO_ENTAIL);
+    if (d_ieval != nullptr)
+    {
+      d_ieval->resetAll();
+    }
+  }
+}
+
+void TermTupleEnumeratorBase::orderTerms(size_t variableIx)
+{
+  const size_t termsSize = d_termsSizes[variableIx];
+  std::vector<std::pair<uint64_t, int>> keys;
+  for (size_t i = 0; i < termsSize; i++)
+  {
+    Node t = getTerm(variableIx, i);
+    uint64_t level = 0;
+    QuantAttributes::getInstantiationLevel(t, level);
+    keys.emplace_back(level, TermUtil::getTermDepth(t));
+  }
+  d_termOrder.resize(d_variableCount);
+  std::vector<size_t>& order = d_termOrder[variableIx];
+  order.resize(termsSize);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t i, size_t j) {
+    return keys[i] < keys[j];
+  });
+}
+
+Node TermTupleEnumeratorBase::getOrderedTerm(size_t variableIx,
+                                             size_t termIndex)
+{
+  if (d_env->d_orderTerms)
+  {
+    Assert(termIndex < d_termOrder[variableIx].size());
+    termIndex = d_termOrder[variableIx][termIndex];
+  }
+  return getTerm(variableIx, termIndex);
+}
+
+bool TermTupleEnumeratorBase::isPruned(const std::vector<Node>& terms)
+{
+  if (d_ieval == nullptr)
+  {
+    return false;
+  }
+  // keep the assignments of the prefix shared with the previous tuple
+  size_t common = 0;
+  while (common < d_ievalTerms.size() && d_ievalTerms[common] == terms[common])
+  {
+    common++;
+  }
+  while (d_ievalTerms.size() > common)
+  {
+    d_ieval->pop();
+    d_ievalTerms.pop_back();
+  }
+  for (size_t variableIx = common; variableIx < d_variableCount; variableIx++)
+  {
+    if (!d_ieval->push(d_quantifier[0][variableIx], terms[variableIx]))
+    {
+      Trace("inst-alg-rd") << "Prune prefix of length " << (variableIx + 1)
+                           << std::endl;
+      std::vector<bool> mask(d_variableCount, false);
+      std::fill(mask.begin(), mask.begin() + variableIx + 1, true);
+      d_disabledCombinations.add(mask, terms);
+      d_changePrefix = variableIx + 1;
+      return true;
+    }
+    d_ievalTerms.push_back(terms[variableIx]);
+  }
+  return false;
 }
 
 bool TermTupleEnumeratorBase::hasNext()
@@ -261,7 +372,12 @@ bool TermTupleEnumeratorBase::hasNext()
     Assert(d_currentStage == 0);
     Trace("inst-alg-rd") << "Try stage " << d_currentStage << "..."
                          << std::endl;
-    return true;
+    std::vector<Node> tti;
+    next(tti);
+    if (!isPruned(tti))
+    {
+      return true;
+    }
   }
 
   // try to find the next combination
@@ -293,7 +409,7 @@ void TermTupleEnumeratorBase::next(/*out*/ std::vector<Node>& terms)
     const Node t =
         d_termsSizes[variableIx] == 0
             ? d_env->d_tr->getTermForType(d_quantifier[0][variableIx].getType())
-            : getTerm(variableIx, d_termIndex[variableIx]);
+            : getOrderedTerm(variableIx, d_termIndex[variableIx]);
     terms[variableIx] = t;
     Trace("inst-alg-rd") << t << "  ";
     Assert(!t.isNull());
@@ -362,7 +478,7 @@ bool TermTupleEnumeratorBase::nextCombination()
     }
     std::vector<Node> tti;
     next(tti);
-    if (!d_disabledCombinations.find(tti, d_changePrefix))
+    if (!d_disabledCombinations.find(tti, d_changePrefix) && !isPruned(tti))
     {
       return true;  // current combination vetted by disabled combinations
     }
@@ -66,6 +66,17 @@ struct TermTupleEnumeratorEnv
   bool d_fullEffort;
   /** Whether we increase tuples based on sum instead of max (see below) */
   bool d_increaseSum;
+  /**
+   * Whether we use the instantiation evaluator of the quantifier to skip all
+   * tuples having a prefix that only leads to entailed instances.
+   */
+  bool d_ieval;
+  /**
+   * Whether we order the terms for each variable by increasing instantiation
+   * level, then term depth. Terms that are equal for both are kept in the
+   * order they are provided, which for the term database is their age.
+   */
+  bool d_orderTerms;
   /** Term registry */
   TermRegistry* d_tr;
 };
@@ -88,6 +99,10 @@ struct TermTupleEnumeratorEnv
  * In this method, the returned enumerator draws ground terms from the term
  * database (provided by td). The quantifiers state (qs) is used to eliminate
  * duplicates modulo equality.
+ *
+ * If TermTupleEnumeratorEnv::d_ieval is set, then each candidate tuple is
+ * assigned to the instantiation evaluator one variable at a time, and once a
+ * prefix is infeasible, all tuples with that prefix are skipped.
  */
 TermTupleEnumeratorInterface* mkTermTupleEnumerator(
     Node q, const TermTupleEnumeratorEnv* env, QuantifiersState& qs);
@@ -665,6 +665,11 @@ void QuantifiersEngine::eqNotifyMerge(TNode t1, TNode t2)
   d_treg.eqNotifyMerge(t1, t2);
 }
 
+void QuantifiersEngine::eqNotifyDisequal(TNode t1, TNode t2)
+{
+  d_treg.eqNotifyDisequal(t1, t2);
+}
+
 void QuantifiersEngine::markRelevant( Node q ) {
   d_model->markRelevant( q );
 }
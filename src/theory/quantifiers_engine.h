@@ -97,6 +97,8 @@ class QuantifiersEngine : protected EnvObj
   void eqNotifyNewClass(TNode t);
   /** notification when master equality engine merges two classes*/
   void eqNotifyMerge(TNode t1, TNode t2);
+  /** notification when master equality engine makes two classes disequal */
+  void eqNotifyDisequal(TNode t1, TNode t2);
   /** mark relevant quantified formula, this will indicate it should be checked
    * before the others */
   void markRelevant(Node q);
@@ -36,6 +36,7 @@ RelevanceManager::RelevanceManager(Env& env, TheoryEngine* engine)
       d_rset(context()),
       d_inFullEffortCheck(false),
       d_fullEffortCheckFail(false),
+      d_computed(false),
       d_success(false),
       d_trackRSetExp(false),
       d_miniscopeTopLevel(true),
@@ -76,6 +77,8 @@ void RelevanceManager::notifyPreprocessedAssertions(
     }
   }
   addAssertionsInternal(toProcess);
+  // the new assertions must be justified
+  d_computed = false;
   // notify the difficulty manager if these are input assertions
   if (isInput && d_dman != nullptr)
   {
@@ -148,12 +151,14 @@ void RelevanceManager::check(Theory::Effort effort)
   {
     d_inFullEffortCheck = true;
     d_fullEffortCheckFail = false;
+    d_computed = false;
   }
 }
 
 void RelevanceManager::postCheck(Theory::Effort effort)
 {
   d_inFullEffortCheck = false;
+  d_computed = false;
 }
 
 void RelevanceManager::computeRelevance()
@@ -169,6 +174,14 @@ void RelevanceManager::computeRelevance()
     d_success = false;
     return;
   }
+  // The assignment does not change during a full effort check, hence the
+  // relevant selection only needs to be recomputed when new assertions are
+  // notified. Otherwise the queries of isRelevant, which are typically made
+  // for all asserted literals, would each traverse all input assertions.
+  if (d_inFullEffortCheck && d_computed)
+  {
+    return;
+  }
   for (const Node& node: d_input)
   {
     if (!computeRelevanceFor(node))
@@ -191,6 +204,7 @@ void RelevanceManager::computeRelevance()
     }
   }
   d_success = !d_fullEffortCheckFail;
+  d_computed = d_inFullEffortCheck;
 }
 
 bool RelevanceManager::computeRelevanceFor(TNode input)
@@ -523,6 +537,7 @@ std::unordered_set<TNode> RelevanceManager::getRelevantAssertions(bool& success)
   // set in full effort check temporarily
   d_inFullEffortCheck = true;
   d_fullEffortCheckFail = false;
+  d_computed = false;
   computeRelevance();
   // update success flag
   success = d_success;
@@ -536,6 +551,7 @@ std::unordered_set<TNode> RelevanceManager::getRelevantAssertions(bool& success)
   }
   // reset in full effort check
   d_inFullEffortCheck = false;
+  d_computed = false;
   return rset;
 }
 
@@ -73,7 +73,10 @@ class TheoryModel;
  * Internally, this class stores the input assertions and can be asked if an
  * asserted literal is part of the current relevant selection. The relevant
  * selection is computed lazily, i.e. only when someone asks if a literal is
- * relevant, and only at most once per FULL effort check.
+ * relevant, and only at most once per FULL effort check, unless new
+ * assertions are notified during the check. Since the justification cache is
+ * SAT context dependent, assertions justified in an earlier check are not
+ * traversed again as long as their justification still holds.
  */
 class RelevanceManager : public TheoryEngineModule
 {
@@ -220,6 +223,12 @@ class RelevanceManager : public TheoryEngineModule
   bool d_inFullEffortCheck;
   /** Have we failed to justify a formula in a full effort check? */
   bool d_fullEffortCheckFail;
+  /**
+   * Have we computed the relevant selection for all current assertions in the
+   * current full effort check? If so, queries to isRelevant are answered by
+   * lookups in d_rset only.
+   */
+  bool d_computed;
   /**
    * Did we succeed in computing the relevant selection? If this is false, there
    * was a syncronization issue between the input formula and the satisfying
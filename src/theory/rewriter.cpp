@@ -15,6 +15,8 @@
 
 #include "theory/rewriter.h"
 
+#include <sstream>
+
 #include "options/theory_options.h"
 #include "proof/conv_proof_generator.h"
 #include "theory/builtin/proof_checker.h"
@@ -23,6 +25,7 @@
 #include "theory/rewriter_tables.h"
 #include "theory/theory.h"
 #include "util/resource_manager.h"
+#include "util/statistics_registry.h"
 
 using namespace std;
 
@@ -94,6 +97,64 @@ Node Rewriter::rewrite(TNode node) {
   return rewriteTo(theoryOf(node), node);
 }
 
+Rewriter::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_postCacheHits(sr.registerInt("Rewriter::postCacheHits")),
+      d_postCacheMisses(sr.registerInt("Rewriter::postCacheMisses")),
+      d_cacheFlushes(sr.registerInt("Rewriter::cacheFlushes"))
+{
+}
+
+Rewriter::DetailStatistics::DetailStatistics(StatisticsRegistry& sr)
+    : d_preRewrites(sr.registerHistogram<TheoryId>("Rewriter::preRewrites")),
+      d_postRewrites(sr.registerHistogram<TheoryId>("Rewriter::postRewrites")),
+      d_postRewritesChanged(
+          sr.registerHistogram<TheoryId>("Rewriter::postRewritesChanged")),
+      d_rulesApplied(
+          sr.registerHistogram<ProofRewriteRule>("Rewriter::rulesApplied")),
+      d_rulesFound(
+          sr.registerHistogram<ProofRewriteRule>("Rewriter::rulesFound"))
+{
+  for (size_t i = 0; i < THEORY_LAST; ++i)
+  {
+    std::stringstream ss;
+    ss << "Rewriter::" << static_cast<TheoryId>(i) << "::";
+    d_preRewriteTime.push_back(sr.registerTimer(ss.str() + "preRewriteTime"));
+    d_postRewriteTime.push_back(
+        sr.registerTimer(ss.str() + "postRewriteTime"));
+  }
+}
+
+void Rewriter::initializeStatistics(StatisticsRegistry& sr, bool detailed)
+{
+  d_stats.reset(new Statistics(sr));
+  if (detailed)
+  {
+    d_detailStats.reset(new DetailStatistics(sr));
+  }
+}
+
+bool Rewriter::flushCaches(uint64_t limit)
+{
+  if (d_numCached <= limit)
+  {
+    return false;
+  }
+  Trace("rewriter") << "Rewriter::flushCaches: flush " << d_numCached
+                    << " cached terms" << std::endl;
+  std::vector<const expr::attr::AttributeUniqueId*> ids;
+  for (const expr::attr::AttributeUniqueId& id : d_cacheAttrIds)
+  {
+    ids.push_back(&id);
+  }
+  d_nm->deleteAttributes(ids);
+  d_numCached = 0;
+  if (d_stats != nullptr)
+  {
+    ++d_stats->d_cacheFlushes;
+  }
+  return true;
+}
+
 Node Rewriter::extendedRewrite(TNode node, bool aggr)
 {
   quantifiers::ExtendedRewriter er(d_nm, *this, aggr);
@@ -167,7 +228,12 @@ Node Rewriter::rewriteViaRule(ProofRewriteRule id, const Node& n)
   TheoryRewriter* tr = getTheoryRewriter(tid);
   if (tr != nullptr)
   {
-    return tr->rewriteViaRule(id, n);
+    Node ret = tr->rewriteViaRule(id, n);
+    if (d_detailStats != nullptr && !ret.isNull())
+    {
+      d_detailStats->d_rulesApplied << id;
+    }
+    return ret;
   }
   return Node::null();
 }
@@ -181,7 +247,12 @@ ProofRewriteRule Rewriter::findRule(const Node& a,
   TheoryRewriter* tr = getTheoryRewriter(tid);
   if (tr != nullptr)
   {
-    return tr->findRule(a, b, ctx);
+    ProofRewriteRule id = tr->findRule(a, b, ctx);
+    if (d_detailStats != nullptr && id != ProofRewriteRule::NONE)
+    {
+      d_detailStats->d_rulesFound << id;
+    }
+    return id;
   }
   return ProofRewriteRule::NONE;
 }
@@ -207,8 +278,16 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
   Node cached = getPostRewriteCache(theoryId, node);
   if (!cached.isNull() && (tcpg == nullptr || hasRewrittenWithProofs(node)))
   {
+    if (d_stats != nullptr)
+    {
+      ++d_stats->d_postCacheHits;
+    }
     return cached;
   }
+  if (d_stats != nullptr)
+  {
+    ++d_stats->d_postCacheMisses;
+  }
 
   // Put the node on the stack in order to start the "recursive" rewrite
   vector<RewriteStackElement> rewriteStack;
@@ -281,6 +360,7 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
         setPreRewriteCache(rewriteStackTop.getOriginalTheoryId(),
                            rewriteStackTop.d_original,
                            rewriteStackTop.d_node);
+        ++d_numCached;
       }
       // Otherwise we're have already been pre-rewritten (in pre-rewrite cache)
       else {
@@ -294,6 +374,17 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
     // Now it's time to rewrite the children, check if this has already been done
     cached = getPostRewriteCache(rewriteStackTop.getTheoryId(),
                                  rewriteStackTop.d_node);
+    if (d_stats != nullptr)
+    {
+      if (cached.isNull())
+      {
+        ++d_stats->d_postCacheMisses;
+      }
+      else
+      {
+        ++d_stats->d_postCacheHits;
+      }
+    }
     // If not, go through the children
     if (cached.isNull()
         || (tcpg != nullptr && !hasRewrittenWithProofs(rewriteStackTop.d_node)))
@@ -427,6 +518,7 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
       setPostRewriteCache(rewriteStackTop.getOriginalTheoryId(),
                           rewriteStackTop.d_original,
                           rewriteStackTop.d_node);
+      ++d_numCached;
     }
     else
     {
@@ -456,6 +548,20 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
 RewriteResponse Rewriter::preRewrite(theory::TheoryId theoryId,
                                      TNode n,
                                      TConvProofGenerator* tcpg)
+{
+  if (d_detailStats != nullptr)
+  {
+    d_detailStats->d_preRewrites << theoryId;
+    // theory rewriters may call the rewriter recursively
+    CodeTimer codeTimer(d_detailStats->d_preRewriteTime[theoryId], true);
+    return callPreRewrite(theoryId, n, tcpg);
+  }
+  return callPreRewrite(theoryId, n, tcpg);
+}
+
+RewriteResponse Rewriter::callPreRewrite(theory::TheoryId theoryId,
+                                         TNode n,
+                                         TConvProofGenerator* tcpg)
 {
   if (tcpg != nullptr)
   {
@@ -472,6 +578,24 @@ RewriteResponse Rewriter::preRewrite(theory::TheoryId theoryId,
 RewriteResponse Rewriter::postRewrite(theory::TheoryId theoryId,
                                       TNode n,
                                       TConvProofGenerator* tcpg)
+{
+  if (d_detailStats != nullptr)
+  {
+    d_detailStats->d_postRewrites << theoryId;
+    CodeTimer codeTimer(d_detailStats->d_postRewriteTime[theoryId], true);
+    RewriteResponse response = callPostRewrite(theoryId, n, tcpg);
+    if (response.d_node != n)
+    {
+      d_detailStats->d_postRewritesChanged << theoryId;
+    }
+    return response;
+  }
+  return callPostRewrite(theoryId, n, tcpg);
+}
+
+RewriteResponse Rewriter::callPostRewrite(theory::TheoryId theoryId,
+                                          TNode n,
+                                          TConvProofGenerator* tcpg)
 {
   if (tcpg != nullptr)
   {
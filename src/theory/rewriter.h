@@ -19,8 +19,10 @@
 
 #include <cvc5/cvc5_proof_rule.h>
 
+#include "expr/attribute_unique_id.h"
 #include "expr/node.h"
 #include "theory/theory_rewriter.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
@@ -37,7 +39,7 @@ class Evaluator;
  * The main rewriter class.
  */
 class Rewriter {
-  friend class cvc5::internal::Env;  // to set the resource manager
+  friend class cvc5::internal::Env;  // to set the resource manager and stats
  public:
   Rewriter(NodeManager* nm);
 
@@ -121,7 +123,61 @@ class Rewriter {
    */
   ProofRewriteRule findRule(const Node& a, const Node& b, TheoryRewriteCtx ctx);
 
+  /**
+   * Flush the pre- and post-rewrite caches of all theories if more than
+   * `limit` terms were cached since they were last flushed. The caches are
+   * attributes of the rewritten terms, which are otherwise only freed together
+   * with these terms. Since the cached rewrites keep their results alive, this
+   * must only be called when no TNode refers to a term obtained by rewriting,
+   * e.g., between satisfiability checks.
+   *
+   * Note that the caches are shared by all rewriters of the node manager.
+   *
+   * @param limit The number of cached terms above which the caches are
+   * flushed.
+   * @return true if the caches were flushed.
+   */
+  bool flushCaches(uint64_t limit);
+
  private:
+  /** Statistics of the rewrite caches. */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of post-rewrite cache lookups that succeeded. */
+    IntStat d_postCacheHits;
+    /** Number of post-rewrite cache lookups that failed. */
+    IntStat d_postCacheMisses;
+    /** Number of times the caches were flushed. */
+    IntStat d_cacheFlushes;
+  };
+  /**
+   * Statistics on the individual theory rewriters, which are only collected
+   * with --stats-rewrite, since timing each call is expensive.
+   */
+  struct DetailStatistics
+  {
+    DetailStatistics(StatisticsRegistry& sr);
+    /** Number of calls to the pre-rewriter of each theory. */
+    HistogramStat<TheoryId> d_preRewrites;
+    /** Number of calls to the post-rewriter of each theory. */
+    HistogramStat<TheoryId> d_postRewrites;
+    /** Number of calls to the post-rewriter that changed the term. */
+    HistogramStat<TheoryId> d_postRewritesChanged;
+    /** Time spent in the pre-rewriter of each theory. */
+    std::vector<TimerStat> d_preRewriteTime;
+    /** Time spent in the post-rewriter of each theory. */
+    std::vector<TimerStat> d_postRewriteTime;
+    /** Number of successful applications of each rule via rewriteViaRule. */
+    HistogramStat<ProofRewriteRule> d_rulesApplied;
+    /** Number of times each rule was found by findRule. */
+    HistogramStat<ProofRewriteRule> d_rulesFound;
+  };
+  /**
+   * Register the statistics of this rewriter in sr, including the detailed
+   * statistics if detailed is true.
+   */
+  void initializeStatistics(StatisticsRegistry& sr, bool detailed);
 
   /** Returns the appropriate cache for a node */
   Node getPreRewriteCache(theory::TheoryId theoryId, TNode node);
@@ -142,15 +198,29 @@ class Rewriter {
                  Node node,
                  TConvProofGenerator* tcpg = nullptr);
 
-  /** Calls the pre-rewriter for the given theory */
+  /**
+   * Calls the pre-rewriter for the given theory, recording the detailed
+   * statistics if enabled.
+   */
   RewriteResponse preRewrite(theory::TheoryId theoryId,
                              TNode n,
                              TConvProofGenerator* tcpg = nullptr);
+  /** Calls the pre-rewriter for the given theory */
+  RewriteResponse callPreRewrite(theory::TheoryId theoryId,
+                                 TNode n,
+                                 TConvProofGenerator* tcpg);
 
-  /** Calls the post-rewriter for the given theory */
+  /**
+   * Calls the post-rewriter for the given theory, recording the detailed
+   * statistics if enabled.
+   */
   RewriteResponse postRewrite(theory::TheoryId theoryId,
                               TNode n,
                               TConvProofGenerator* tcpg = nullptr);
+  /** Calls the post-rewriter for the given theory */
+  RewriteResponse callPostRewrite(theory::TheoryId theoryId,
+                                  TNode n,
+                                  TConvProofGenerator* tcpg);
   /** processes a trust rewrite response */
   RewriteResponse processTrustRewriteResponse(
       theory::TheoryId theoryId,
@@ -174,6 +244,15 @@ class Rewriter {
   /** The resource manager, for tracking resource usage */
   ResourceManager* d_resourceManager;
 
+  /** The statistics, null until set by the environment. */
+  std::unique_ptr<Statistics> d_stats;
+  /** The detailed statistics, null unless enabled. */
+  std::unique_ptr<DetailStatistics> d_detailStats;
+  /** The number of terms cached since the caches were last flushed. */
+  uint64_t d_numCached;
+  /** The ids of the pre- and post-rewrite cache attributes of all theories. */
+  std::vector<expr::attr::AttributeUniqueId> d_cacheAttrIds;
+
   /** Theory rewriters used by this rewriter instance */
   TheoryRewriter* d_theoryRewriters[theory::THEORY_LAST];
   /** No-op theory rewriters, used when theory does not provide a rewriter */
@@ -81,8 +81,11 @@ ${post_rewrite_set_cache}
 }
 
 Rewriter::Rewriter(NodeManager* nm)
-    : d_nm(nm), d_resourceManager(nullptr), d_tpg(nullptr)
+    : d_nm(nm), d_resourceManager(nullptr), d_numCached(0), d_tpg(nullptr)
 {
+  // clang-format off
+${rewrite_cache_attribute_ids}
+  // clang-format on
 }
 
 }  // namespace theory
@@ -168,7 +168,7 @@ void TheorySep::postProcessModel( TheoryModel* m ){
   // set up model
   Trace("sep-model") << "...preparing sep model..." << std::endl;
   // collect data points that are not pointed to
-  for (context::CDList<Assertion>::const_iterator it = facts_begin();
+  for (FactList::const_iterator it = facts_begin();
        it != facts_end();
        ++it)
   {
@@ -1317,27 +1317,23 @@ void TheorySep::makeDisjointHeap(Node parent, const std::vector<Node>& children)
     Assert(c.getType() == parent.getType());
     d_parentMap[c].push_back(parent);
   }
-  // make the disjointness constraints
+  // make the disjointness constraints, where we build the union of the
+  // children right to left and require each child to be disjoint from the
+  // union of the children after it. This is equivalent to requiring the
+  // children to be pairwise disjoint, while introducing a number of terms and
+  // lemmas that is linear in the number of children.
   NodeManager* nm = nodeManager();
   std::vector<Node> lems;
-  Node ulem = nm->mkNode(Kind::SET_UNION, children[0], children[1]);
-  size_t lsize = children.size();
-  for (size_t i = 2; i < lsize; i++)
-  {
-    ulem = nm->mkNode(Kind::SET_UNION, ulem, children[i]);
-  }
-  ulem = parent.eqNode(ulem);
-  lems.push_back(ulem);
   Node empSet = nm->mkConst(EmptySet(parent.getType()));
-  for (size_t i = 0; i < lsize; i++)
+  size_t lsize = children.size();
+  Node suffix = children[lsize - 1];
+  for (size_t i = lsize - 1; i > 0; i--)
   {
-    for (size_t j = (i + 1); j < lsize; j++)
-    {
-      Node s = nm->mkNode(Kind::SET_INTER, children[i], children[j]);
-      Node ilem = s.eqNode(empSet);
-      lems.push_back(ilem);
-    }
+    Node s = nm->mkNode(Kind::SET_INTER, children[i - 1], suffix);
+    lems.push_back(s.eqNode(empSet));
+    suffix = nm->mkNode(Kind::SET_UNION, children[i - 1], suffix);
   }
+  lems.push_back(parent.eqNode(suffix));
   // send out definitional lemmas for introduced sets
   for (const Node& clem : lems)
   {
@@ -254,8 +254,10 @@ class TheorySep : public Theory {
 
   /**
    * This sends the lemmas:
-   *   parent = (set.union children)
-   *   (set.inter children_i children_j) = empty, for each i != j
+   *   parent = (set.union children_1 ... (set.union children_{n-1} children_n))
+   *   (set.inter children_i (set.union children_{i+1} ... children_n)) = empty,
+   *   for each i < n
+   * where the unions are shared between the lemmas.
    * It also stores these relationships in d_parentMap.
    */
   void makeDisjointHeap(Node parent, const std::vector<Node>& children);
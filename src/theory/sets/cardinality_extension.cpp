@@ -230,7 +230,6 @@ void CardinalityExtension::check()
 void CardinalityExtension::checkRegister()
 {
   Trace("sets") << "Cardinality graph..." << std::endl;
-  NodeManager* nm = nodeManager();
   // first, ensure cardinality relationships are added as lemmas for all
   // non-basic set terms
   const std::vector<Node>& setEqc = d_state.getSetsEqClasses();
@@ -244,7 +243,7 @@ void CardinalityExtension::checkRegister()
         // if setminus, do for intersection instead
         if (n.getKind() == Kind::SET_MINUS)
         {
-          n = rewrite(nm->mkNode(Kind::SET_INTER, n[0], n[1]));
+          n = getCardGraphTerms(n)[0];
         }
         registerCardinalityTerm(n);
       }
@@ -312,6 +311,7 @@ void CardinalityExtension::checkCardCycles()
   // build order of equivalence classes, also build cardinality graph
   const std::vector<Node>& setEqc = d_state.getSetsEqClasses();
   d_oSetEqc.clear();
+  d_oSetEqcProcessed.clear();
   d_cardParent.clear();
   for (const Node& s : setEqc)
   {
@@ -366,7 +366,7 @@ void CardinalityExtension::checkCardCyclesRec(Node eqc,
     }
     return;
   }
-  if (std::find(d_oSetEqc.begin(), d_oSetEqc.end(), eqc) != d_oSetEqc.end())
+  if (d_oSetEqcProcessed.find(eqc) != d_oSetEqcProcessed.end())
   {
     // already processed
     return;
@@ -376,6 +376,7 @@ void CardinalityExtension::checkCardCyclesRec(Node eqc,
   {
     // no non-variable sets, trivial
     d_oSetEqc.push_back(eqc);
+    d_oSetEqcProcessed.insert(eqc);
     return;
   }
   curr.push_back(eqc);
@@ -394,33 +395,20 @@ void CardinalityExtension::checkCardCyclesRec(Node eqc,
     // set minus.
     Trace("sets-debug") << "Build cardinality parents for " << n << "..."
                         << std::endl;
-    std::vector<Node> sib;
+    const std::vector<Node>& gterms = getCardGraphTerms(n);
+    std::vector<Node> sib(gterms.begin(), gterms.begin() + 2);
     unsigned true_sib = 0;
-    // Note that we use the rewriter to get the form of the siblings here.
-    // This is required to ensure that the lookups in the equality engine are
-    // accurate. However, it may lead to issues if the rewritten form of a
-    // node leads to unexpected relationships in the graph. To avoid this,
-    // we ensure that universe is not a child of a set in the assertions above.
     if (n.getKind() == Kind::SET_INTER)
     {
       d_localBase[n] = n;
-      for (unsigned e = 0; e < 2; e++)
-      {
-        Node sm = rewrite(nm->mkNode(Kind::SET_MINUS, n[e], n[1 - e]));
-        sib.push_back(sm);
-      }
       true_sib = 2;
     }
     else
     {
-      Node si = rewrite(nm->mkNode(Kind::SET_INTER, n[0], n[1]));
-      sib.push_back(si);
-      d_localBase[n] = si;
-      Node osm = rewrite(nm->mkNode(Kind::SET_MINUS, n[1], n[0]));
-      sib.push_back(osm);
+      d_localBase[n] = sib[0];
       true_sib = 1;
     }
-    Node u = rewrite(nm->mkNode(Kind::SET_UNION, n[0], n[1]));
+    Node u = gterms[2];
     if (!d_state.hasTerm(u))
     {
       u = Node::null();
@@ -664,6 +652,36 @@ void CardinalityExtension::checkCardCyclesRec(Node eqc,
   curr.pop_back();
   // parents now processed, can add to ordered list
   d_oSetEqc.push_back(eqc);
+  d_oSetEqcProcessed.insert(eqc);
+}
+
+const std::vector<Node>& CardinalityExtension::getCardGraphTerms(
+    const Node& n)
+{
+  Assert(n.getKind() == Kind::SET_INTER || n.getKind() == Kind::SET_MINUS);
+  std::map<Node, std::vector<Node>>::iterator it = d_cardGraphTerms.find(n);
+  if (it != d_cardGraphTerms.end())
+  {
+    return it->second;
+  }
+  NodeManager* nm = nodeManager();
+  std::vector<Node>& terms = d_cardGraphTerms[n];
+  // Note that we use the rewriter to get the form of the siblings here.
+  // This is required to ensure that the lookups in the equality engine are
+  // accurate. However, it may lead to issues if the rewritten form of a
+  // node leads to unexpected relationships in the graph. To avoid this,
+  // we ensure that universe is not a child of a set in the assertions above.
+  if (n.getKind() == Kind::SET_INTER)
+  {
+    terms.push_back(rewrite(nm->mkNode(Kind::SET_MINUS, n[0], n[1])));
+  }
+  else
+  {
+    terms.push_back(rewrite(nm->mkNode(Kind::SET_INTER, n[0], n[1])));
+  }
+  terms.push_back(rewrite(nm->mkNode(Kind::SET_MINUS, n[1], n[0])));
+  terms.push_back(rewrite(nm->mkNode(Kind::SET_UNION, n[0], n[1])));
+  return terms;
 }
 
 void CardinalityExtension::checkNormalForms(std::vector<Node>& intro_sets)
@@ -706,7 +724,10 @@ void CardinalityExtension::checkNormalForm(Node eqc,
   {
     for (std::pair<const Node, std::vector<Node> >& itf : it->second)
     {
+      // flat forms are carried from several children, remove duplicates
       std::sort(itf.second.begin(), itf.second.end());
+      itf.second.erase(std::unique(itf.second.begin(), itf.second.end()),
+                       itf.second.end());
       if (base.isNull())
       {
         base = itf.first;
@@ -953,21 +974,13 @@ void CardinalityExtension::checkNormalForm(Node eqc,
       Trace("sets-nf-debug") << "Carry nf to parent ( " << cbase << ", [" << p
                              << "] ), from " << n << "..." << std::endl;
 
+      // Duplicate venn regions are removed when the flat form is sorted in
+      // checkNormalForm. If a venn region is a duplicate, it must be empty
+      // since it is coming from syntactically disjoint siblings.
       std::vector<Node>& ffpc = d_ff[p][cbase];
-      for (const Node& nfeqci : nfeqc)
-      {
-        if (std::find(ffpc.begin(), ffpc.end(), nfeqci) == ffpc.end())
-        {
-          Trace("sets-nf-debug") << "Add to flat form " << nfeqci << " to "
-                                 << cbase << " in " << p << std::endl;
-          ffpc.push_back(nfeqci);
-        }
-        else
-        {
-          // if it is a duplicate venn region, it must be empty since it is
-          // coming from syntactically disjoint siblings
-        }
-      }
+      Trace("sets-nf-debug") << "Add to flat form " << nfeqc << " to " << cbase
+                             << " in " << p << std::endl;
+      ffpc.insert(ffpc.end(), nfeqc.begin(), nfeqc.end());
     }
   }
 }
@@ -18,6 +18,8 @@
 #ifndef CVC5__THEORY__SETS__CARDINALITY_EXTENSION_H
 #define CVC5__THEORY__SETS__CARDINALITY_EXTENSION_H
 
+#include <unordered_set>
+
 #include "context/cdhashset.h"
 #include "context/context.h"
 #include "smt/env_obj.h"
@@ -267,6 +269,15 @@ class CardinalityExtension : protected EnvObj
   void checkCardCyclesRec(Node eqc,
                           std::vector<Node>& curr,
                           std::vector<Node>& exp);
+  /**
+   * Get the terms adjacent to the intersection or set minus term n in the
+   * cardinality graph. For n = (A ^ B), this is the vector
+   *   [ (A \ B), (B \ A), (A u B) ],
+   * for n = (A \ B), this is the vector
+   *   [ (A ^ B), (B \ A), (A u B) ],
+   * where all terms are rewritten.
+   */
+  const std::vector<Node>& getCardGraphTerms(const Node& n);
   /** check normal forms
    *
    * This method attempts to assign "normal forms" to all set equivalence
@@ -357,6 +368,8 @@ class CardinalityExtension : protected EnvObj
   NodeSet d_card_processed;
   /** The ordered set of equivalence classes, see checkCardCycles. */
   std::vector<Node> d_oSetEqc;
+  /** The equivalence classes in d_oSetEqc, for fast lookups. */
+  std::unordered_set<Node> d_oSetEqcProcessed;
   /**
    * This maps set terms to the set of representatives of their "parent" sets,
    * see checkCardCycles. Parents are stored as a pair of the form
@@ -382,6 +395,13 @@ class CardinalityExtension : protected EnvObj
    * ( A ^ B ), and (B \ A).
    */
   std::map<Node, Node> d_localBase;
+  /**
+   * Maps intersection and set minus terms S to the (rewritten) terms that
+   * are adjacent to S in the cardinality graph, see getCardGraphTerms. These
+   * only depend on S, hence they are computed once, when S is first
+   * encountered, instead of in every call to checkCardCycles.
+   */
+  std::map<Node, std::vector<Node>> d_cardGraphTerms;
 
   /**
    * a map to store proxy nodes for the universe sets
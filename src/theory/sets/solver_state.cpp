@@ -555,7 +555,7 @@ void SolverState::addMember(TNode r, TNode atom)
   {
     n_members = (*mem_i).second;
   }
-  d_members[r] = n_members + 1;
+  d_members.insert(r, n_members + 1);
   if (n_members < d_members_data[r].size())
   {
     d_members_data[r][n_members] = atom;
@@ -640,7 +640,7 @@ bool SolverState::merge(TNode t1,
       n_members++;
     }
   }
-  d_members[t1] = n_members;
+  d_members.insert(t1, n_members);
   return true;
 }
 
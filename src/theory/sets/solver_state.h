@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "context/cdhashset.h"
+#include "context/cdtrail_hashmap.h"
 #include "theory/sets/skolem_cache.h"
 #include "theory/theory_state.h"
 #include "theory/uf/equality_engine.h"
@@ -44,7 +45,7 @@ class TheorySetsPrivate;
  */
 class SolverState : public TheoryState
 {
-  typedef context::CDHashMap<Node, size_t> NodeIntMap;
+  typedef context::CDTrailHashMap<Node, size_t> NodeIntMap;
 
  public:
   SolverState(Env& env,
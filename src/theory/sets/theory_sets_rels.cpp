@@ -739,8 +739,8 @@ void TheorySetsRels::check(Theory::Effort level)
   }
 
   void TheorySetsRels::doTCInference(
-      std::map<Node, std::unordered_set<Node> > rel_tc_graph,
-      std::map<Node, Node> rel_tc_graph_exps,
+      std::map<Node, std::unordered_set<Node> >& rel_tc_graph,
+      std::map<Node, Node>& rel_tc_graph_exps,
       Node tc_rel)
   {
     Trace("rels-debug") << "[Theory::Rels] ****** doTCInference !" << std::endl;
@@ -775,11 +775,64 @@ void TheorySetsRels::check(Theory::Effort level)
       Node start_node_rep,
       Node cur_node_rep,
       std::unordered_set<Node>& seen)
+  {
+    Node fst = TupleUtils::nthElementOfTuple((reasons.front())[0], 0);
+    Node snd = TupleUtils::nthElementOfTuple((reasons.back())[0], 1);
+    // only infer the memberships of tc_rel that are not known yet, but
+    // continue the traversal since the successors of cur_node_rep may be new
+    if (!isKnownMember(tc_rel, {fst, snd}))
+    {
+      sendTCInference(tc_rel, reasons, fst, snd);
+    }
+
+    // check if cur_node has been traversed or not
+    if( seen.find( cur_node_rep ) != seen.end() ) {
+      return;
+    }
+    seen.insert( cur_node_rep );
+    TC_GRAPH_IT  cur_set = tc_graph.find( cur_node_rep );
+    if( cur_set != tc_graph.end() ) {
+      for (std::unordered_set<Node>::iterator set_it = cur_set->second.begin();
+           set_it != cur_set->second.end();
+           ++set_it)
+      {
+        Node new_pair = RelsUtils::constructPair( tc_rel, cur_node_rep, *set_it );
+        std::vector< Node > new_reasons( reasons );
+        new_reasons.push_back( rel_tc_graph_exps.find( new_pair )->second );
+        doTCInference( tc_rel, new_reasons, tc_graph, rel_tc_graph_exps, start_node_rep, *set_it, seen );
+      }
+    }
+  }
+
+  bool TheorySetsRels::isKnownMember(Node rel,
+                                     const std::vector<Node>& elements,
+                                     size_t start)
+  {
+    std::map<Node, TupleTrie>::iterator it =
+        d_membership_trie.find(getRepresentative(rel));
+    if (it == d_membership_trie.end())
+    {
+      return false;
+    }
+    std::vector<Node> reps;
+    for (size_t i = start, nelems = elements.size(); i < nelems; i++)
+    {
+      if (!hasTerm(elements[i]))
+      {
+        return false;
+      }
+      reps.push_back(getRepresentative(elements[i]));
+    }
+    return !it->second.existsTerm(reps).isNull();
+  }
+
+  void TheorySetsRels::sendTCInference(Node tc_rel,
+                                       const std::vector<Node>& reasons,
+                                       Node fst,
+                                       Node snd)
   {
     NodeManager* nm = nodeManager();
-    Node tc_mem = RelsUtils::constructPair( tc_rel,
-        TupleUtils::nthElementOfTuple((reasons.front())[0], 0),
-        TupleUtils::nthElementOfTuple((reasons.back())[0], 1) );
+    Node tc_mem = RelsUtils::constructPair(tc_rel, fst, snd);
     std::vector< Node > all_reasons( reasons );
 
     for( unsigned int i = 0 ; i < reasons.size()-1; i++ ) {
@@ -808,24 +861,6 @@ void TheorySetsRels::check(Theory::Effort level)
                 InferenceId::SETS_RELS_TCLOSURE_FWD,
                 all_reasons.front());
     }
-
-    // check if cur_node has been traversed or not
-    if( seen.find( cur_node_rep ) != seen.end() ) {
-      return;
-    }
-    seen.insert( cur_node_rep );
-    TC_GRAPH_IT  cur_set = tc_graph.find( cur_node_rep );
-    if( cur_set != tc_graph.end() ) {
-      for (std::unordered_set<Node>::iterator set_it = cur_set->second.begin();
-           set_it != cur_set->second.end();
-           ++set_it)
-      {
-        Node new_pair = RelsUtils::constructPair( tc_rel, cur_node_rep, *set_it );
-        std::vector< Node > new_reasons( reasons );
-        new_reasons.push_back( rel_tc_graph_exps.find( new_pair )->second );
-        doTCInference( tc_rel, new_reasons, tc_graph, rel_tc_graph_exps, start_node_rep, *set_it, seen );
-      }
-    }
   }
 
   /*  product-split rule:  (a, b) IS_IN (X RELATION_PRODUCT Y)
@@ -1218,15 +1253,60 @@ void TheorySetsRels::check(Theory::Effort level)
     }
     NodeManager* nm = nodeManager();
 
-    std::vector<Node> r1_rep_exps = d_rReps_memberReps_exp_cache[r1_rep];
-    std::vector<Node> r2_rep_exps = d_rReps_memberReps_exp_cache[r2_rep];
+    const std::vector<Node>& r1_rep_exps = d_rReps_memberReps_exp_cache[r1_rep];
+    const std::vector<Node>& r2_rep_exps = d_rReps_memberReps_exp_cache[r2_rep];
     size_t r1_tuple_len = r1.getType().getSetElementType().getTupleLength();
     size_t r2_tuple_len = r2.getType().getSetElementType().getTupleLength();
 
     Kind rk = rel.getKind();
     TypeNode tn = rel.getType().getSetElementType();
+    // For joins, index the members of r2 by the representative of their
+    // leftmost element, so that each member of r1 is only combined with the
+    // members of r2 it can join with. For products, all pairs are combined,
+    // as well as for joins on tuple elements, whose equality is checked
+    // component-wise by areEqual.
+    bool isJoin = rk == Kind::RELATION_JOIN;
+    bool useIndex =
+        isJoin && !r2.getType().getSetElementType().getTupleTypes()[0].isTuple();
+    std::map<Node, std::vector<size_t>> r2_index;
+    std::vector<size_t> r2_all;
+    for (size_t j = 0, nr2 = r2_rep_exps.size(); j < nr2; j++)
+    {
+      if (isJoin)
+      {
+        Node r2_lmost = TupleUtils::nthElementOfTuple(r2_rep_exps[j][0], 0);
+        // Since we require notification r1_rmost and r2_lmost are equal,
+        // they must be shared terms of theory of sets. Hence, we make the
+        // following calls to makeSharedTerm to ensure this is the case.
+        makeSharedTerm(r2_lmost);
+        if (useIndex)
+        {
+          r2_index[getRepresentative(r2_lmost)].push_back(j);
+          continue;
+        }
+      }
+      r2_all.push_back(j);
+    }
     for( unsigned int i = 0; i < r1_rep_exps.size(); i++ ) {
-      for( unsigned int j = 0; j < r2_rep_exps.size(); j++ ) {
+      const std::vector<size_t>* r2_cands = &r2_all;
+      if (isJoin)
+      {
+        Node r1_rmost =
+            TupleUtils::nthElementOfTuple(r1_rep_exps[i][0], r1_tuple_len - 1);
+        makeSharedTerm(r1_rmost);
+        if (useIndex)
+        {
+          std::map<Node, std::vector<size_t>>::const_iterator itr =
+              r2_index.find(getRepresentative(r1_rmost));
+          if (itr == r2_index.end())
+          {
+            continue;
+          }
+          r2_cands = &itr->second;
+        }
+      }
+      for (size_t j : *r2_cands)
+      {
         std::vector<Node> tuple_elements;
         tuple_elements.push_back(tn.getDType()[0].getConstructor());
         std::vector<Node> reasons;
@@ -1234,11 +1314,6 @@ void TheorySetsRels::check(Theory::Effort level)
         {
           Node r1_rmost = TupleUtils::nthElementOfTuple(r1_rep_exps[i][0], r1_tuple_len - 1);
           Node r2_lmost = TupleUtils::nthElementOfTuple(r2_rep_exps[j][0], 0);
-          // Since we require notification r1_rmost and r2_lmost are equal,
-          // they must be shared terms of theory of sets. Hence, we make the
-          // following calls to makeSharedTerm to ensure this is the case.
-          makeSharedTerm(r1_rmost);
-          makeSharedTerm(r2_lmost);
 
           Trace("rels-debug") << "[Theory::Rels] r1_rmost: " << r1_rmost
                               << " of type " << r1_rmost.getType() << std::endl;
@@ -1277,6 +1352,11 @@ void TheorySetsRels::check(Theory::Effort level)
                 TupleUtils::nthElementOfTuple( r2_rep_exps[j][0], l ) );
           }
 
+          if (isKnownMember(rel, tuple_elements, 1))
+          {
+            // already a member, no need to infer it again
+            continue;
+          }
           Node composed_tuple =
               nm->mkNode(Kind::APPLY_CONSTRUCTOR, tuple_elements);
           Node fact = nm->mkNode(Kind::SET_MEMBER, composed_tuple, rel);
@@ -176,8 +176,8 @@ class TheorySetsRels : protected EnvObj
   void applyTCRule( Node mem, Node rel, Node rel_rep, Node exp);
   void buildTCGraphForRel( Node tc_rel );
   void doTCInference();
-  void doTCInference(std::map<Node, std::unordered_set<Node> > rel_tc_graph,
-                     std::map<Node, Node> rel_tc_graph_exps,
+  void doTCInference(std::map<Node, std::unordered_set<Node> >& rel_tc_graph,
+                     std::map<Node, Node>& rel_tc_graph_exps,
                      Node tc_rel);
   void doTCInference(Node tc_rel,
                      std::vector<Node> reasons,
@@ -186,6 +186,22 @@ class TheorySetsRels : protected EnvObj
                      Node start_node_rep,
                      Node cur_node_rep,
                      std::unordered_set<Node>& seen);
+  /**
+   * Send the inference that (tuple fst snd) is a member of tc_rel, where
+   * reasons are the memberships of the path from fst to snd.
+   */
+  void sendTCInference(Node tc_rel,
+                       const std::vector<Node>& reasons,
+                       Node fst,
+                       Node snd);
+  /**
+   * Return true if the tuple whose elements are elements[start], ... is
+   * currently known to be a member of rel, based on the membership trie
+   * computed in collectRelsInfo.
+   */
+  bool isKnownMember(Node rel,
+                     const std::vector<Node>& elements,
+                     size_t start = 0);
 
   void composeMembersForRels( Node );
   /**
@@ -80,6 +80,7 @@ TrustNode SharedSolverDistributed::explain(TNode literal, TheoryId id)
   {
     // By default, we ask the individual theory for the explanation.
     // It is possible that a centralized approach could preempt this.
+    TheoryProfile::Scope ps(d_te.getProfile(), id, TheoryProfileOp::EXPLAIN);
     texp = d_te.theoryOf(id)->explain(literal);
     Trace("shared-solver") << "\tTerm was propagated by owner theory: " << id
                            << ". Explanation: " << texp.getNode() << std::endl;
@@ -29,7 +29,8 @@ SubsolverSetupInfo::SubsolverSetupInfo(const Options& opts,
     : d_opts(opts),
       d_logicInfo(logicInfo),
       d_sepLocType(sepLocType),
-      d_sepDataType(sepDataType)
+      d_sepDataType(sepDataType),
+      d_optionsCache(nullptr)
 {
 }
 
@@ -37,7 +38,8 @@ SubsolverSetupInfo::SubsolverSetupInfo(const Env& env)
     : d_opts(env.getOptions()),
       d_logicInfo(env.getLogicInfo()),
       d_sepLocType(env.getSepLocType()),
-      d_sepDataType(env.getSepDataType())
+      d_sepDataType(env.getSepDataType()),
+      d_optionsCache(env.getSubsolverOptionsCache())
 {
 }
 
@@ -45,7 +47,8 @@ SubsolverSetupInfo::SubsolverSetupInfo(const Env& env, const Options& opts)
     : d_opts(opts),
       d_logicInfo(env.getLogicInfo()),
       d_sepLocType(env.getSepLocType()),
-      d_sepDataType(env.getSepDataType())
+      d_sepDataType(env.getSepDataType()),
+      d_optionsCache(env.getSubsolverOptionsCache())
 {
 }
 
@@ -74,6 +77,7 @@ void initializeSubsolver(NodeManager* nm,
 {
   smte.reset(new SolverEngine(nm, &info.d_opts));
   smte->setIsInternalSubsolver();
+  smte->setSubsolverOptionsCache(info.d_optionsCache);
   smte->setLogic(info.d_logicInfo);
   // set the options
   if (needsTimeout)
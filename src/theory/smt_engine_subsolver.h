@@ -47,6 +47,11 @@ struct SubsolverSetupInfo
   /** The separation logic location and data types */
   TypeNode d_sepLocType;
   TypeNode d_sepDataType;
+  /**
+   * The cache for the default options of the subsolver, which is the cache of
+   * the Env if the info is constructed from one, and null otherwise.
+   */
+  smt::SubsolverOptionsCache* d_optionsCache;
 };
 
 /**
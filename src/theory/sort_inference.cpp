@@ -41,8 +41,12 @@ namespace cvc5::internal {
 namespace theory {
 
 void SortInference::UnionFind::print(const char * c){
-  for( std::map< int, int >::iterator it = d_eqc.begin(); it != d_eqc.end(); ++it ){
-    Trace(c) << "s_" << it->first << " = s_" << it->second << ", ";
+  for (size_t i = 0, size = d_eqc.size(); i < size; i++)
+  {
+    if (d_eqc[i] != static_cast<int>(i))
+    {
+      Trace(c) << "s_" << i << " = s_" << d_eqc[i] << ", ";
+    }
   }
   for( unsigned i=0; i<d_deq.size(); i++ ){
     Trace(c) << "s_" << d_deq[i].first << " != s_" << d_deq[i].second << ", ";
@@ -51,29 +55,47 @@ void SortInference::UnionFind::print(const char * c){
 }
 void SortInference::UnionFind::set( UnionFind& c ) {
   clear();
-  for( std::map< int, int >::iterator it = c.d_eqc.begin(); it != c.d_eqc.end(); ++it ){
-    d_eqc[ it->first ] = it->second;
-  }
+  d_eqc = c.d_eqc;
   d_deq.insert( d_deq.end(), c.d_deq.begin(), c.d_deq.end() );
 }
 int SortInference::UnionFind::getRepresentative( int t ){
-  std::map< int, int >::iterator it = d_eqc.find( t );
-  if( it==d_eqc.end() || it->second==t ){
-    return t;
-  }else{
-    int rt = getRepresentative( it->second );
+  Assert(t >= 0);
+  // find the representative iteratively, then compress the path to it
+  int rt = t;
+  while (static_cast<size_t>(rt) < d_eqc.size() && d_eqc[rt] != rt)
+  {
+    rt = d_eqc[rt];
+  }
+  while (t != rt)
+  {
+    int next = d_eqc[t];
     d_eqc[t] = rt;
-    return rt;
+    t = next;
+  }
+  return rt;
+}
+void SortInference::UnionFind::setParent(int t, int t2)
+{
+  Assert(getRepresentative(t) == t);
+  if (static_cast<size_t>(t) >= d_eqc.size())
+  {
+    size_t size = d_eqc.size();
+    d_eqc.resize(t + 1);
+    for (size_t i = size; i < d_eqc.size(); i++)
+    {
+      d_eqc[i] = static_cast<int>(i);
+    }
   }
+  d_eqc[t] = t2;
 }
 void SortInference::UnionFind::setEqual( int t1, int t2 ){
   if( t1!=t2 ){
     int rt1 = getRepresentative( t1 );
     int rt2 = getRepresentative( t2 );
     if( rt1>rt2 ){
-      d_eqc[rt1] = rt2;
-    }else{
-      d_eqc[rt2] = rt1;
+      setParent(rt1, rt2);
+    }else if (rt2 > rt1){
+      setParent(rt2, rt1);
     }
   }
 }
@@ -89,7 +111,13 @@ bool SortInference::UnionFind::isValid() {
 
 void SortInference::recordSubsort( TypeNode tn, int s ){
   s = d_type_union_find.getRepresentative( s );
-  if( std::find( d_sub_sorts.begin(), d_sub_sorts.end(), s )==d_sub_sorts.end() ){
+  if (static_cast<size_t>(s) >= d_is_sub_sort.size())
+  {
+    d_is_sub_sort.resize(s + 1, false);
+  }
+  if (!d_is_sub_sort[s])
+  {
+    d_is_sub_sort[s] = true;
     d_sub_sorts.push_back( s );
     d_type_sub_sorts[tn].push_back( s );
   }
@@ -106,6 +134,7 @@ void SortInference::printSort( const char* c, int t ){
 
 void SortInference::reset() {
   d_sub_sorts.clear();
+  d_is_sub_sort.clear();
   d_non_monotonic_sorts.clear();
   d_type_sub_sorts.clear();
   //reset info
@@ -347,7 +376,7 @@ void SortInference::setEqual( int t1, int t2 ){
           return;
         }
       }
-      d_type_union_find.d_eqc[rt1] = rt2;
+      d_type_union_find.setParent(rt1, rt2);
     }
   }
 }
@@ -44,6 +44,8 @@ class SortInference : protected EnvObj
  private:
   //all subsorts
   std::vector< int > d_sub_sorts;
+  /** whether each sort id is in d_sub_sorts, indexed by sort id */
+  std::vector<bool> d_is_sub_sort;
   std::map< int, bool > d_non_monotonic_sorts;
   std::map< TypeNode, std::vector< int > > d_type_sub_sorts;
   void recordSubsort( TypeNode tn, int s );
@@ -54,13 +56,19 @@ public:
     UnionFind( UnionFind& c ){
       set( c );
     }
-    std::map< int, int > d_eqc;
+    /**
+     * The parent of each sort id, indexed by sort id. Ids that are not in the
+     * range of this vector, or that are their own parent, are representatives.
+     */
+    std::vector<int> d_eqc;
     //pairs that must be disequal
     std::vector< std::pair< int, int > > d_deq;
     void print(const char * c);
     void clear() { d_eqc.clear(); d_deq.clear(); }
     void set( UnionFind& c );
     int getRepresentative( int t );
+    /** Set the parent of representative t to t2. */
+    void setParent(int t, int t2);
     void setEqual( int t1, int t2 );
     void setDisequal( int t1, int t2 ){ d_deq.push_back( std::pair< int, int >( t1, t2 ) ); }
     bool areEqual( int t1, int t2 ) { return getRepresentative( t1 )==getRepresentative( t2 ); }
@@ -87,27 +87,61 @@ void ArrayCoreSolver::checkNth(const std::vector<Node>& nthTerms)
       sendInference(exp, lem, InferenceId::STRINGS_ARRAY_NTH_EXTRACT);
     }
   }
-  for (size_t i = 0; i < nthTerms.size(); i++)
+  // Group the nth terms by the representative of their index, since only
+  // nth terms with equal indices lead to splits. For each index, we only
+  // consider one sequence per equivalence class.
+  std::map<Node, std::map<Node, Node>> seqsForIndex;
+  for (const Node& n : nthTerms)
   {
-    for (size_t j = i + 1; j < nthTerms.size(); j++)
+    Node ri = d_state.getRepresentative(n[1]);
+    Node r = d_state.getRepresentative(n[0]);
+    seqsForIndex[ri].emplace(r, n[0]);
+  }
+  std::vector<Node> seqs;
+  for (const std::pair<const Node, std::map<Node, Node>>& si : seqsForIndex)
+  {
+    seqs.clear();
+    for (const std::pair<const Node, Node>& s : si.second)
     {
-      TNode x = nthTerms[i][0];
-      TNode y = nthTerms[j][0];
-
-      if (x.getType() != y.getType())
+      seqs.push_back(s.second);
+    }
+    for (size_t i = 0, nseqs = seqs.size(); i < nseqs; i++)
+    {
+      for (size_t j = i + 1; j < nseqs; j++)
       {
-        continue;
+        TNode x = seqs[i];
+        TNode y = seqs[j];
+        if (x.getType() != y.getType())
+        {
+          continue;
+        }
+        if (!d_state.areDisequal(x, y))
+        {
+          d_im.sendSplit(x, y, InferenceId::STRINGS_ARRAY_EQ_SPLIT);
+        }
       }
+    }
+  }
+}
 
-      TNode n = nthTerms[i][1];
-      TNode m = nthTerms[j][1];
-      if (d_state.areEqual(n, m) && !d_state.areEqual(x, y)
-          && !d_state.areDisequal(x, y))
-      {
-        d_im.sendSplit(x, y, InferenceId::STRINGS_ARRAY_EQ_SPLIT);
-      }
+Node ArrayCoreSolver::getUpdateChainValue(const Node& n, const Node& j)
+{
+  Assert(n.getKind() == Kind::STRING_UPDATE && n[1].isConst());
+  Assert(j.isConst());
+  NodeManager* nm = nodeManager();
+  Node cur = n;
+  // Note that update terms do not change the length of the sequence, hence
+  // j is in the bounds of all sequences of the chain.
+  while (cur.getKind() == Kind::STRING_UPDATE && cur[1].isConst()
+         && (cur == n || d_termReg.isHandledUpdateOrSubstr(cur)))
+  {
+    if (cur[1] == j)
+    {
+      return nm->mkNode(Kind::SEQ_NTH, cur[2], nm->mkConstInt(Rational(0)));
     }
+    cur = cur[0];
   }
+  return nm->mkNode(Kind::SEQ_NTH, cur, j);
 }
 
 void ArrayCoreSolver::checkUpdate(const std::vector<Node>& updateTerms)
@@ -192,12 +226,22 @@ void ArrayCoreSolver::checkUpdate(const std::vector<Node>& updateTerms)
             Kind::AND,
             nm->mkNode(Kind::LEQ, nm->mkConstInt(0), j),
             nm->mkNode(Kind::LT, j, nm->mkNode(Kind::STRING_LENGTH, n[0])));
-        Node idxEq = i.eqNode(j);
-        Node updateVal = nm->mkNode(Kind::SEQ_NTH, n[2], nm->mkConstInt(0));
-        Node iteNthInBounds = nm->mkNode(Kind::ITE,
-                                         i.eqNode(j),
-                                         updateVal,
-                                         nm->mkNode(Kind::SEQ_NTH, n[0], j));
+        Node iteNthInBounds;
+        if (i.isConst() && j.isConst())
+        {
+          // both indices are constant, we directly take the value from the
+          // chain of updates
+          iteNthInBounds = getUpdateChainValue(n, j);
+        }
+        else
+        {
+          Node updateVal =
+              nm->mkNode(Kind::SEQ_NTH, n[2], nm->mkConstInt(Rational(0)));
+          iteNthInBounds = nm->mkNode(Kind::ITE,
+                                      i.eqNode(j),
+                                      updateVal,
+                                      nm->mkNode(Kind::SEQ_NTH, n[0], j));
+        }
         Node rhs = nm->mkNode(Kind::ITE, nthInBounds, iteNthInBounds, nth);
         Node lem = nth.eqNode(rhs);
 
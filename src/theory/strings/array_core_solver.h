@@ -94,6 +94,18 @@ class ArrayCoreSolver : protected EnvObj
    */
   void checkUpdate(const std::vector<Node>& updateTerms);
 
+  /**
+   * Get the value of (seq.nth n j) when j is in the bounds of n, where n is
+   * an update term whose index is a constant, and j is a constant. This
+   * coalesces chains of nested update terms with constant indices, e.g.
+   * for n = (seq.update (seq.update s 0 a) 1 b) it returns
+   * (seq.nth a 0) for j = 0 and (seq.nth s 2) for j = 2, which avoids
+   * introducing an nth term for each update term of the chain. The chain is
+   * traversed while the index of the update term is constant and the
+   * update term is handled.
+   */
+  Node getUpdateChainValue(const Node& n, const Node& j);
+
   /**
    * Given the current set of update terms, this computes the connected
    * sequences implied by the current equality information + this set of terms.
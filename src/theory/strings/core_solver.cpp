@@ -47,6 +47,7 @@ CoreSolver::CoreSolver(Env& env,
       d_im(im),
       d_termReg(tr),
       d_bsolver(bs),
+      d_nfStampCounter(1),
       d_nfPairs(context()),
       d_extDeq(userContext()),
       d_modelUnsoundId(IncompleteId::NONE)
@@ -557,6 +558,12 @@ void CoreSolver::checkNormalFormsEqProp()
   // calculate normal forms for each equivalence class, possibly adding
   // splitting lemmas
   d_normal_form.clear();
+  d_nfStamp.clear();
+  if (d_nfCache.size() > 2 * d_strings_eqc.size())
+  {
+    // drop the entries of stale equivalence classes
+    d_nfCache.clear();
+  }
   // map from normal form terms (the concatenation of the terms in the normal
   // form) to the equivalence that had that normal form
   std::map<Node, Node> nf_to_eqc;
@@ -628,11 +635,27 @@ void CoreSolver::normalizeEquivalenceClass(Node eqc,
     //do nothing
     Trace("strings-process-debug") << "Return process equivalence class " << eqc << " : empty." << std::endl;
     d_normal_form[eqc].init(emp);
+    d_nfStamp[eqc] = 1;
   }
   else
   {
     // should not have computed the normal form of this equivalence class yet
     Assert(d_normal_form.find(eqc) == d_normal_form.end());
+    NfSignature sig;
+    if (options().strings.stringsNfIncremental)
+    {
+      getNormalFormSignature(eqc, sig);
+      std::map<Node, NfCacheEntry>::iterator itc = d_nfCache.find(eqc);
+      if (itc != d_nfCache.end() && itc->second.d_sig == sig)
+      {
+        d_normal_form[eqc] = itc->second.d_nf;
+        d_nfStamp[eqc] = itc->second.d_stamp;
+        Trace("strings-process-debug")
+            << "Return process equivalence class " << eqc
+            << " : reused = " << d_normal_form[eqc].d_nf << std::endl;
+        return;
+      }
+    }
     // Normal forms for the relevant terms in the equivalence class of eqc
     std::vector<NormalForm> normal_forms;
     // map each term to its index in the above vector
@@ -643,6 +666,9 @@ void CoreSolver::normalizeEquivalenceClass(Node eqc,
     {
       return;
     }
+    // the normal form is a function of the signature if there is at most one
+    // normal form to choose from
+    bool reusable = normal_forms.size() <= 1;
     // process the normal forms
     processNEqc(eqc, normal_forms, stype, pinfer);
     // If we sent a lemma, or if pinfer is non-empty (a normal form could not
@@ -665,12 +691,78 @@ void CoreSolver::normalizeEquivalenceClass(Node eqc,
       nf_index = it->second;
     }
     d_normal_form[eqc] = normal_forms[nf_index];
+    setNormalFormStamp(eqc, sig, reusable);
     Trace("strings-process-debug")
         << "Return process equivalence class " << eqc
         << " : returned = " << d_normal_form[eqc].d_nf << std::endl;
   }
 }
 
+void CoreSolver::getNormalFormSignature(Node eqc, NfSignature& sig)
+{
+  eq::EqualityEngine* ee = d_state.getEqualityEngine();
+  eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, ee);
+  const std::set<Node>& rlvSet = d_termReg.getRelevantTermSet();
+  for (; !eqc_i.isFinished(); ++eqc_i)
+  {
+    Node n = (*eqc_i);
+    // this check should be in sync with the check in getNormalForms
+    if (!n.isConst()
+        && (d_bsolver.isCongruent(n) || rlvSet.find(n) == rlvSet.end()))
+    {
+      continue;
+    }
+    sig.emplace_back(n, 0);
+    if (n.getKind() == Kind::STRING_CONCAT)
+    {
+      for (const Node& nc : n)
+      {
+        Node nr = ee->getRepresentative(nc);
+        std::map<Node, uint64_t>::iterator its = d_nfStamp.find(nr);
+        // a fresh stamp never matches a cached signature
+        uint64_t stamp =
+            its != d_nfStamp.end() ? its->second : ++d_nfStampCounter;
+        sig.emplace_back(nr, stamp);
+      }
+    }
+  }
+}
+
+void CoreSolver::setNormalFormStamp(Node eqc, NfSignature& sig, bool reusable)
+{
+  if (!options().strings.stringsNfIncremental)
+  {
+    return;
+  }
+  const NormalForm& nf = d_normal_form[eqc];
+  std::map<Node, NfCacheEntry>::iterator itc = d_nfCache.find(eqc);
+  uint64_t stamp;
+  if (itc != d_nfCache.end() && itc->second.d_nf.d_base == nf.d_base
+      && itc->second.d_nf.d_nf == nf.d_nf && itc->second.d_nf.d_exp == nf.d_exp
+      && itc->second.d_nf.d_isRev == nf.d_isRev)
+  {
+    // the normal form did not change, classes depending on it may reuse
+    // their normal forms
+    stamp = itc->second.d_stamp;
+  }
+  else
+  {
+    stamp = ++d_nfStampCounter;
+  }
+  d_nfStamp[eqc] = stamp;
+  if (reusable)
+  {
+    NfCacheEntry& e = d_nfCache[eqc];
+    e.d_sig = std::move(sig);
+    e.d_nf = nf;
+    e.d_stamp = stamp;
+  }
+  else
+  {
+    d_nfCache.erase(eqc);
+  }
+}
+
 const std::vector<Node>& CoreSolver::getRelevantDeq() const { return d_rlvDeq; }
 
 bool CoreSolver::hasNormalForm(const Node& n) const
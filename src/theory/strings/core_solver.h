@@ -391,6 +391,20 @@ class CoreSolver : public InferSideEffectProcess, protected EnvObj
                       std::vector<NormalForm>& normal_forms,
                       std::map<Node, unsigned>& term_to_nf_index,
                       TypeNode stype);
+  /**
+   * The signature of the normal form of an equivalence class, which lists the
+   * terms of the equivalence class considered by getNormalForms. Each
+   * concatenation term is followed by the representatives of its children,
+   * paired with the stamps of their normal forms. Terms are paired with 0.
+   */
+  using NfSignature = std::vector<std::pair<Node, uint64_t>>;
+  /** Get the signature of the normal form of eqc. */
+  void getNormalFormSignature(Node eqc, NfSignature& sig);
+  /**
+   * Set the stamp of the normal form computed for eqc, given the signature it
+   * was computed from, and cache the normal form if reusable is true.
+   */
+  void setNormalFormStamp(Node eqc, NfSignature& sig, bool reusable);
   /** process normalize equivalence class
    *
    * This is called when an equivalence class eqc contains a set of terms that
@@ -564,6 +578,28 @@ class CoreSolver : public InferSideEffectProcess, protected EnvObj
   std::vector<Node> d_rlvDeq;
   /** map from terms to their normal forms */
   std::map<Node, NormalForm> d_normal_form;
+  /** A normal form computed in a previous check, and its signature. */
+  struct NfCacheEntry
+  {
+    NfSignature d_sig;
+    NormalForm d_nf;
+    uint64_t d_stamp;
+  };
+  /**
+   * Maps equivalence classes to the last normal form computed for them when
+   * stringsNfIncremental is enabled. The normal form of an equivalence class
+   * is a function of its signature. It is reused if the signature is
+   * unchanged, which is only the case if the class has the same terms and the
+   * classes its normal form depends on have unchanged normal forms.
+   */
+  std::map<Node, NfCacheEntry> d_nfCache;
+  /**
+   * The stamps of the normal forms computed in the current check, where equal
+   * stamps imply equal normal forms.
+   */
+  std::map<Node, uint64_t> d_nfStamp;
+  /** The last stamp used, stamp 1 is for the normal form of the empty word */
+  uint64_t d_nfStampCounter;
   /**
    * In certain cases, we know that two terms are equivalent despite
    * not having to verify their normal forms are identical. For example,
@@ -51,7 +51,9 @@ ExtfSolver::ExtfSolver(Env& env,
       d_preproc(env, d_termReg.getSkolemCache(), &statistics.d_reductions),
       d_hasExtf(context(), false),
       d_extfInferCache(context()),
-      d_reduced(userContext())
+      d_reduced(userContext()),
+      d_evalCache(userContext()),
+      d_symDefCache(userContext())
 {
   d_extt.addFunctionKind(Kind::STRING_SUBSTR);
   d_extt.addFunctionKind(Kind::STRING_UPDATE);
@@ -351,7 +353,17 @@ void ExtfSolver::checkExtfEval(int effort)
       einfo.d_initExp.insert(einfo.d_initExp.end(), exp.begin(), exp.end());
       einfo.d_exp.insert(einfo.d_exp.end(), exp.begin(), exp.end());
       // inference is rewriting the substituted node
-      Node nrc = rewrite(sn);
+      Node nrc;
+      NodeNodeMap::const_iterator itc = d_evalCache.find(sn);
+      if (itc != d_evalCache.end())
+      {
+        nrc = itc->second;
+      }
+      else
+      {
+        nrc = rewrite(sn);
+        d_evalCache.insert(sn, nrc);
+      }
       // if rewrites to a constant, then do the inference and mark as reduced
       if (nrc.isConst())
       {
@@ -363,7 +375,6 @@ void ExtfSolver::checkExtfEval(int effort)
           d_extt.markInactive(n, ExtReducedId::STRINGS_SR_CONST);
           Trace("strings-extf-debug")
               << "  resolvable by evaluation..." << std::endl;
-          std::vector<Node> exps;
           // The following optimization gets the "symbolic definition" of
           // an extended term. The symbolic definition of a term t is a term
           // t' where constants are replaced by their corresponding proxy
@@ -383,26 +394,7 @@ void ExtfSolver::checkExtfEval(int effort)
           // only use symbolic definitions if option is set
           if (options().strings.stringInferSym)
           {
-            nrs = d_termReg.getSymbolicDefinition(sn, exps);
-          }
-          if (!nrs.isNull())
-          {
-            Trace("strings-extf-debug")
-                << "  rewrite " << nrs << "..." << std::endl;
-            Node nrsr = rewrite(nrs);
-            // ensure the symbolic form is not rewritable
-            if (nrsr != nrs)
-            {
-              // we cannot use the symbolic definition if it rewrites
-              Trace("strings-extf-debug")
-                  << "  symbolic definition is trivial..." << std::endl;
-              nrs = Node::null();
-            }
-          }
-          else
-          {
-            Trace("strings-extf-debug")
-                << "  could not infer symbolic definition." << std::endl;
+            nrs = getSymbolicDefinition(sn);
           }
           Node conc;
           if (!nrs.isNull())
@@ -533,6 +525,37 @@ void ExtfSolver::checkExtfEval(int effort)
   d_hasExtf = has_nreduce;
 }
 
+Node ExtfSolver::getSymbolicDefinition(const Node& n)
+{
+  NodeNodeMap::const_iterator it = d_symDefCache.find(n);
+  if (it != d_symDefCache.end())
+  {
+    return it->second;
+  }
+  std::vector<Node> exps;
+  Node nrs = d_termReg.getSymbolicDefinition(n, exps);
+  if (!nrs.isNull())
+  {
+    Trace("strings-extf-debug") << "  rewrite " << nrs << "..." << std::endl;
+    Node nrsr = rewrite(nrs);
+    // ensure the symbolic form is not rewritable
+    if (nrsr != nrs)
+    {
+      // we cannot use the symbolic definition if it rewrites
+      Trace("strings-extf-debug")
+          << "  symbolic definition is trivial..." << std::endl;
+      nrs = Node::null();
+    }
+  }
+  else
+  {
+    Trace("strings-extf-debug")
+        << "  could not infer symbolic definition." << std::endl;
+  }
+  d_symDefCache.insert(n, nrs);
+  return nrs;
+}
+
 void ExtfSolver::checkExtfInference(Node n,
                                     Node nr,
                                     ExtfInfoTmp& in,
@@ -21,6 +21,7 @@
 #include <map>
 #include <vector>
 
+#include "context/cdhashmap.h"
 #include "context/cdo.h"
 #include "expr/node.h"
 #include "smt/env_obj.h"
@@ -84,6 +85,7 @@ class ExtfInfoTmp
 class ExtfSolver : public InferSideEffectProcess, protected EnvObj
 {
   typedef context::CDHashSet<Node> NodeSet;
+  typedef context::CDHashMap<Node, Node> NodeNodeMap;
 
  public:
   ExtfSolver(Env& env,
@@ -279,6 +281,22 @@ class ExtfSolver : public InferSideEffectProcess, protected EnvObj
   NodeSet d_reduced;
   /** Map from lemmas to the terms they justify the reduction of */
   std::map<Node, Node> d_reductionWaitingMap;
+  /**
+   * Maps extended functions whose arguments were replaced by their current
+   * substitution in checkExtfEval to their rewritten form. This avoids
+   * re-simplifying the same term when the normal forms of the arguments of
+   * an extended function did not change since the last check.
+   */
+  NodeNodeMap d_evalCache;
+  /**
+   * Maps the terms in d_evalCache that rewrite to constants to their
+   * symbolic definition, or to the null node if they have no usable symbolic
+   * definition. This is user-context dependent, since symbolic definitions
+   * refer to proxy variables.
+   */
+  NodeNodeMap d_symDefCache;
+  /** Get the symbolic definition of n if it does not rewrite, cached. */
+  Node getSymbolicDefinition(const Node& n);
 };
 
 /** An extended theory callback */
@@ -15,6 +15,11 @@
 
 #include "theory/strings/regexp_eval.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include "theory/strings/theory_strings_utils.h"
 #include "util/string.h"
 
@@ -109,6 +114,11 @@ class NfaState
       }
     }
   }
+  /** Get the edges from this state. */
+  const std::map<Node, std::vector<NfaState*>>& getChildren() const
+  {
+    return d_children;
+  }
 
  private:
   /**
@@ -241,6 +251,307 @@ class NfaState
   std::vector<std::pair<NfaState*, Node>> d_arrows;
 };
 
+/**
+ * A regular expression compiled to an NFA over character classes, which is
+ * lazily converted to a DFA while strings are evaluated.
+ *
+ * The characters are partitioned into classes of consecutive characters that
+ * are not distinguished by any edge of the NFA. A DFA state is a set of NFA
+ * states, whose successors are computed on demand for every character class
+ * and cached. The number of DFA states is bounded by s_maxDfaStates, beyond
+ * which the NFA is simulated without caching.
+ *
+ * Compiled regular expressions do not refer to nodes, and can hence be
+ * shared by all node managers and threads. Evaluation is thread-safe.
+ */
+class CompiledRegExp
+{
+ public:
+  CompiledRegExp(const Node& r)
+  {
+    NfaState accept;
+    std::vector<std::shared_ptr<NfaState>> scache;
+    NfaState* rs = NfaState::construct(r, &accept, scache);
+    // number the NFA states, with the accept state last
+    std::unordered_map<NfaState*, uint32_t> ids;
+    for (const std::shared_ptr<NfaState>& s : scache)
+    {
+      ids.emplace(s.get(), ids.size());
+    }
+    d_accept = ids.size();
+    ids.emplace(&accept, d_accept);
+    d_epsilon.resize(ids.size());
+    d_edges.resize(ids.size());
+    std::vector<uint32_t> bounds;
+    for (const std::pair<NfaState* const, uint32_t>& s : ids)
+    {
+      for (const std::pair<const Node, std::vector<NfaState*>>& c :
+           s.first->getChildren())
+      {
+        const Node& l = c.first;
+        uint32_t lo = 0;
+        uint32_t hi = String::num_codes() - 1;
+        if (l.isNull())
+        {
+          for (NfaState* cs : c.second)
+          {
+            d_epsilon[s.second].push_back(ids.at(cs));
+          }
+          continue;
+        }
+        else if (l.getKind() == Kind::CONST_STRING)
+        {
+          lo = l.getConst<String>().front();
+          hi = lo;
+        }
+        else if (l.getKind() == Kind::REGEXP_RANGE)
+        {
+          lo = l[0].getConst<String>().front();
+          hi = l[1].getConst<String>().front();
+        }
+        bounds.push_back(lo);
+        bounds.push_back(hi + 1);
+        for (NfaState* cs : c.second)
+        {
+          d_edges[s.second].push_back({lo, hi, ids.at(cs)});
+        }
+      }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    d_bounds = bounds;
+    // the dead state and the initial state
+    std::vector<uint32_t> init;
+    addClosure(ids[rs], init);
+    std::sort(init.begin(), init.end());
+    addDfaState({});
+    addDfaState(init);
+  }
+
+  /** Return true if the string with characters vec is accepted. */
+  bool evaluate(const std::vector<unsigned>& vec)
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    size_t nclasses = d_bounds.size() + 1;
+    uint32_t curr = 1;
+    for (size_t i = 0, nvec = vec.size(); i < nvec; i++)
+    {
+      size_t c = getClass(vec[i]);
+      int32_t next = d_trans[curr * nclasses + c];
+      if (next < 0)
+      {
+        std::vector<uint32_t> nset = step(d_dfaStates[curr], vec[i]);
+        std::map<std::vector<uint32_t>, uint32_t>::iterator it =
+            d_dfaIndex.find(nset);
+        if (it != d_dfaIndex.end())
+        {
+          next = it->second;
+        }
+        else if (d_dfaStates.size() < s_maxDfaStates)
+        {
+          next = addDfaState(nset);
+        }
+        else
+        {
+          // too many DFA states, simulate the NFA on the remaining string
+          for (++i; i < nvec && !nset.empty(); i++)
+          {
+            nset = step(nset, vec[i]);
+          }
+          return std::binary_search(nset.begin(), nset.end(), d_accept);
+        }
+        d_trans[curr * nclasses + c] = next;
+      }
+      curr = next;
+      // the dead state does not accept any string
+      if (curr == 0)
+      {
+        return false;
+      }
+    }
+    return d_accepting[curr];
+  }
+
+  /** Get the number of NFA states. */
+  size_t getNumNfaStates() const { return d_edges.size(); }
+
+ private:
+  /** An edge labelled by the characters from d_lo to d_hi. */
+  struct Edge
+  {
+    uint32_t d_lo;
+    uint32_t d_hi;
+    uint32_t d_target;
+  };
+  /** The maximum number of DFA states. */
+  static constexpr size_t s_maxDfaStates = 4096;
+  /** Get the character class of character c. */
+  size_t getClass(uint32_t c) const
+  {
+    return std::upper_bound(d_bounds.begin(), d_bounds.end(), c)
+           - d_bounds.begin();
+  }
+  /** Add state s and the states reachable by epsilon edges to set. */
+  void addClosure(uint32_t s, std::vector<uint32_t>& set) const
+  {
+    std::vector<uint32_t> visit{s};
+    while (!visit.empty())
+    {
+      uint32_t cur = visit.back();
+      visit.pop_back();
+      if (std::find(set.begin(), set.end(), cur) == set.end())
+      {
+        set.push_back(cur);
+        visit.insert(visit.end(), d_epsilon[cur].begin(), d_epsilon[cur].end());
+      }
+    }
+  }
+  /** Return the sorted set of states reached from set by character c. */
+  std::vector<uint32_t> step(const std::vector<uint32_t>& set,
+                             uint32_t c) const
+  {
+    std::vector<uint32_t> next;
+    for (uint32_t s : set)
+    {
+      for (const Edge& e : d_edges[s])
+      {
+        if (e.d_lo <= c && c <= e.d_hi)
+        {
+          addClosure(e.d_target, next);
+        }
+      }
+    }
+    std::sort(next.begin(), next.end());
+    return next;
+  }
+  /** Add DFA state for the sorted set of NFA states, return its index. */
+  uint32_t addDfaState(const std::vector<uint32_t>& set)
+  {
+    uint32_t id = d_dfaStates.size();
+    d_dfaIndex.emplace(set, id);
+    d_dfaStates.push_back(set);
+    d_accepting.push_back(std::binary_search(set.begin(), set.end(), d_accept));
+    d_trans.resize(d_trans.size() + d_bounds.size() + 1, -1);
+    return id;
+  }
+  /** The epsilon edges of each NFA state. */
+  std::vector<std::vector<uint32_t>> d_epsilon;
+  /** The labelled edges of each NFA state. */
+  std::vector<std::vector<Edge>> d_edges;
+  /** The accepting NFA state. */
+  uint32_t d_accept;
+  /** The sorted lower bounds of the character classes except the first. */
+  std::vector<uint32_t> d_bounds;
+  /** The DFA states, the dead state 0 is empty and 1 is initial. */
+  std::vector<std::vector<uint32_t>> d_dfaStates;
+  /** Maps sets of NFA states to their DFA state. */
+  std::map<std::vector<uint32_t>, uint32_t> d_dfaIndex;
+  /** Whether each DFA state is accepting. */
+  std::vector<bool> d_accepting;
+  /**
+   * The DFA transitions, indexed by state and character class, -1 if not
+   * yet computed.
+   */
+  std::vector<int32_t> d_trans;
+  /** Protects the lazily constructed DFA. */
+  std::mutex d_mutex;
+};
+
+namespace {
+
+/**
+ * Append an encoding of r to key that identifies r up to structural
+ * equality, where r can be evaluated via compilation to NFA. Shared subterms
+ * are encoded once and referred to by their index.
+ */
+void getKey(const Node& r, std::vector<uint32_t>& key)
+{
+  std::unordered_map<TNode, uint32_t> visited;
+  std::unordered_map<TNode, uint32_t>::iterator it;
+  std::vector<TNode> visit;
+  // the index of the next encoded term
+  uint32_t index = 0;
+  // the index of terms whose children are being visited
+  const uint32_t pending = static_cast<uint32_t>(-1);
+  TNode cur;
+  visit.push_back(r);
+  do
+  {
+    cur = visit.back();
+    it = visited.find(cur);
+    if (it == visited.end())
+    {
+      visited.emplace(cur, pending);
+      if (cur.getKind() != Kind::STRING_TO_REGEXP
+          && cur.getKind() != Kind::REGEXP_RANGE)
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    visit.pop_back();
+    if (it->second != pending)
+    {
+      continue;
+    }
+    it->second = index++;
+    key.push_back(static_cast<uint32_t>(cur.getKind()));
+    switch (cur.getKind())
+    {
+      case Kind::STRING_TO_REGEXP:
+      {
+        const std::vector<unsigned>& vec = cur[0].getConst<String>().getVec();
+        key.push_back(vec.size());
+        key.insert(key.end(), vec.begin(), vec.end());
+      }
+      break;
+      case Kind::REGEXP_RANGE:
+        key.push_back(cur[0].getConst<String>().front());
+        key.push_back(cur[1].getConst<String>().front());
+        break;
+      default:
+        key.push_back(cur.getNumChildren());
+        for (const Node& cc : cur)
+        {
+          key.push_back(visited[cc]);
+        }
+        break;
+    }
+  } while (!visit.empty());
+}
+
+/** The maximum number of regular expressions in the cache. */
+constexpr size_t s_maxCacheSize = 1024;
+
+/**
+ * Get the compiled regular expression for r from the process-wide cache,
+ * compiling it if necessary.
+ */
+std::shared_ptr<CompiledRegExp> getCompiled(const Node& r)
+{
+  static std::mutex mutex;
+  static std::map<std::vector<uint32_t>, std::shared_ptr<CompiledRegExp>>
+      cache;
+  std::vector<uint32_t> key;
+  getKey(r, key);
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<CompiledRegExp>& c = cache[key];
+  if (c == nullptr)
+  {
+    if (cache.size() > s_maxCacheSize)
+    {
+      cache.clear();
+      std::shared_ptr<CompiledRegExp>& cn = cache[key];
+      cn = std::make_shared<CompiledRegExp>(r);
+      return cn;
+    }
+    c = std::make_shared<CompiledRegExp>(r);
+  }
+  return c;
+}
+
+}  // namespace
+
 bool RegExpEval::canEvaluate(const Node& r)
 {
   std::unordered_set<TNode> visited;
@@ -289,31 +600,9 @@ bool RegExpEval::evaluate(String& s, const Node& r)
   Trace("re-eval") << "Evaluate " << s << " in " << r << std::endl;
   // no intersection, complement, and r must be constant.
   Assert(canEvaluate(r));
-  NfaState accept;
-  std::vector<std::shared_ptr<NfaState>> scache;
-  NfaState* rs = NfaState::construct(r, &accept, scache);
-  Trace("re-eval") << "NFA size is " << (scache.size() + 1) << std::endl;
-  std::unordered_set<NfaState*> curr;
-  rs->addToNext(curr);
-  const std::vector<unsigned>& vec = s.getVec();
-  for (size_t i = 0, nvec = vec.size(); i < nvec; i++)
-  {
-    Trace("re-eval") << "..process next char " << vec[i]
-                     << ", #states=" << curr.size() << std::endl;
-    std::unordered_set<NfaState*> next;
-    for (NfaState* cs : curr)
-    {
-      cs->processNextChar(vec[i], next);
-    }
-    // if there are no more states, we are done
-    if (next.empty())
-    {
-      return false;
-    }
-    curr = next;
-  }
-  Trace("re-eval") << "..finish #states=" << curr.size() << std::endl;
-  return curr.find(&accept) != curr.end();
+  std::shared_ptr<CompiledRegExp> c = getCompiled(r);
+  Trace("re-eval") << "NFA size is " << c->getNumNfaStates() << std::endl;
+  return c->evaluate(s.getVec());
 }
 
 }  // namespace strings
@@ -49,9 +49,10 @@ class RegExpEval
    * number of subterms of r. It evaluates whether s is in r, which is a
    * linear scan through s while tracking the (set of) states in the NFA.
    *
-   * Note that the NFA construction is not cached. Moreover, for this reason we
-   * do not compile the NFA to a DFA, which would lead to faster evaluation if
-   * testing many strings in the same regular expression.
+   * The NFA is cached process-wide for regular expressions that are
+   * structurally equal to r, and lazily compiled to a DFA over character
+   * classes while strings are tested. This makes testing many strings in the
+   * same regular expression a table lookup per character.
    */
   static bool evaluate(String& s, const Node& r);
 };
@@ -24,6 +24,7 @@
 #include "theory/strings/theory_strings_utils.h"
 #include "theory/strings/word.h"
 #include "util/regexp.h"
+#include "util/statistics_registry.h"
 
 using namespace cvc5::internal::kind;
 
@@ -41,6 +42,12 @@ RegExpOpr::RegExpOpr(Env& env, SkolemCache* sc)
       d_one(nodeManager()->mkConstInt(Rational(1))),
       d_sigma(nodeManager()->mkNode(Kind::REGEXP_ALLCHAR, std::vector<Node>{})),
       d_sigma_star(nodeManager()->mkNode(Kind::REGEXP_STAR, d_sigma)),
+      d_derivCacheHits(statisticsRegistry().registerInt(
+          "theory::strings::regexp::derivCacheHits")),
+      d_interCacheHits(statisticsRegistry().registerInt(
+          "theory::strings::regexp::interCacheHits")),
+      d_cacheClears(statisticsRegistry().registerInt(
+          "theory::strings::regexp::cacheClears")),
       d_sc(sc)
 {
   d_emptyString = Word::mkEmptyWord(nodeManager()->stringType());
@@ -122,7 +129,7 @@ RegExpConstType RegExpOpr::getRegExpConstType(Node r)
 
 // 0-unknown, 1-yes, 2-no
 int RegExpOpr::delta( Node r, Node &exp ) {
-  std::map<Node, std::pair<int, Node> >::const_iterator itd =
+  std::unordered_map<Node, std::pair<int, Node>>::const_iterator itd =
       d_delta_cache.find(r);
   if (itd != d_delta_cache.end())
   {
@@ -260,6 +267,7 @@ int RegExpOpr::delta( Node r, Node &exp ) {
     exp = rewrite(exp);
   }
   std::pair<int, Node> p(ret, exp);
+  boundCache(d_delta_cache);
   d_delta_cache[r] = p;
   Trace("regexp-delta") << "RegExpOpr::delta returns " << ret << " for " << r
                         << ", expr = " << exp << std::endl;
@@ -277,9 +285,13 @@ int RegExpOpr::derivativeS(Node r, cvc5::internal::String c, Node& retNode)
   NodeManager* nm = nodeManager();
 
   PairNodeStr dv = std::make_pair( r, c );
-  if( d_deriv_cache.find( dv ) != d_deriv_cache.end() ) {
-    retNode = d_deriv_cache[dv].first;
-    ret = d_deriv_cache[dv].second;
+  PairNodeStrMap<std::pair<Node, int>>::const_iterator itd =
+      d_deriv_cache.find(dv);
+  if (itd != d_deriv_cache.end())
+  {
+    ++d_derivCacheHits;
+    retNode = itd->second.first;
+    ret = itd->second.second;
   }
   else if (c.empty())
   {
@@ -291,6 +303,7 @@ int RegExpOpr::derivativeS(Node r, cvc5::internal::String c, Node& retNode)
       retNode = r;
     }
     std::pair< Node, int > p(retNode, ret);
+    boundCache(d_deriv_cache);
     d_deriv_cache[dv] = p;
   } else {
     switch( r.getKind() ) {
@@ -550,6 +563,7 @@ int RegExpOpr::derivativeS(Node r, cvc5::internal::String c, Node& retNode)
       retNode = rewrite(retNode);
     }
     std::pair< Node, int > p(retNode, ret);
+    boundCache(d_deriv_cache);
     d_deriv_cache[dv] = p;
   }
 
@@ -564,8 +578,11 @@ Node RegExpOpr::derivativeSingle(Node r, cvc5::internal::String c)
   Node retNode = d_emptyRegexp;
   PairNodeStr dv = std::make_pair( r, c );
   NodeManager* nm = nodeManager();
-  if( d_dv_cache.find( dv ) != d_dv_cache.end() ) {
-    retNode = d_dv_cache[dv];
+  PairNodeStrMap<Node>::const_iterator itd = d_dv_cache.find(dv);
+  if (itd != d_dv_cache.end())
+  {
+    ++d_derivCacheHits;
+    retNode = itd->second;
   }
   else if (c.empty())
   {
@@ -761,6 +778,7 @@ Node RegExpOpr::derivativeSingle(Node r, cvc5::internal::String c)
     if(retNode != d_emptyRegexp) {
       retNode = rewrite(retNode);
     }
+    boundCache(d_dv_cache);
     d_dv_cache[dv] = retNode;
   }
   Trace("regexp-derive") << "RegExp-derive returns : /" << mkString( retNode ) << "/" << std::endl;
@@ -770,8 +788,8 @@ Node RegExpOpr::derivativeSingle(Node r, cvc5::internal::String c)
 void RegExpOpr::firstChars(Node r, std::set<unsigned> &pcset, SetNodes &pvset)
 {
   Trace("regexp-fset") << "Start FSET(" << mkString(r) << ")" << std::endl;
-  std::map<Node, std::pair<std::set<unsigned>, SetNodes> >::const_iterator itr =
-      d_fset_cache.find(r);
+  std::unordered_map<Node, std::pair<std::set<unsigned>, SetNodes>>::
+      const_iterator itr = d_fset_cache.find(r);
   if(itr != d_fset_cache.end()) {
     pcset.insert((itr->second).first.begin(), (itr->second).first.end());
     pvset.insert((itr->second).second.begin(), (itr->second).second.end());
@@ -882,6 +900,7 @@ void RegExpOpr::firstChars(Node r, std::set<unsigned> &pcset, SetNodes &pvset)
     pcset.insert(cset.begin(), cset.end());
     pvset.insert(vset.begin(), vset.end());
     std::pair<std::set<unsigned>, SetNodes> p(cset, vset);
+    boundCache(d_fset_cache);
     d_fset_cache[r] = p;
   }
 
@@ -908,7 +927,7 @@ Node RegExpOpr::simplify(Node t, bool polarity)
   Assert(t.getKind() == Kind::STRING_IN_REGEXP);
   Node tlit = polarity ? t : t.notNode();
   Node conc;
-  std::map<Node, Node>::const_iterator itr = d_simpCache.find(tlit);
+  std::unordered_map<Node, Node>::const_iterator itr = d_simpCache.find(tlit);
   if (itr != d_simpCache.end())
   {
     return itr->second;
@@ -1305,7 +1324,11 @@ void RegExpOpr::convert2(unsigned cnt, Node n, Node &r1, Node &r2) {
   }
 }
 
-Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node > cache, unsigned cnt ) {
+Node RegExpOpr::intersectInternal(Node r1,
+                                  Node r2,
+                                  PairNodesMap<Node>& cache,
+                                  unsigned cnt)
+{
   //Assert(checkConstRegExp(r1) && checkConstRegExp(r2));
   if(r1 > r2) {
     TNode tmpNode = r1;
@@ -1315,9 +1338,10 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
   NodeManager* nm = nodeManager();
   Trace("regexp-int") << "Starting INTERSECT(" << cnt << "):\n  "<< mkString(r1) << ",\n  " << mkString(r2) << std::endl;
   std::pair < Node, Node > p(r1, r2);
-  std::map < PairNodes, Node >::const_iterator itr = d_inter_cache.find(p);
+  PairNodesMap<Node>::const_iterator itr = d_inter_cache.find(p);
   Node rNode;
   if(itr != d_inter_cache.end()) {
+    ++d_interCacheHits;
     rNode = itr->second;
   } else {
     Trace("regexp-int-debug") << " ... not in cache" << std::endl;
@@ -1341,7 +1365,7 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
       rNode = r1; //convert1(cnt, r1);
     } else {
       Trace("regexp-int-debug") << " ... normal checking" << std::endl;
-      std::map< PairNodes, Node >::const_iterator itrcache = cache.find(p);
+      PairNodesMap<Node>::const_iterator itrcache = cache.find(p);
       if(itrcache != cache.end()) {
         rNode = itrcache->second;
       } else {
@@ -1382,7 +1406,11 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
           }
           Trace("regexp-int-debug") << std::endl;
         }
-        std::map< PairNodes, Node > cacheX;
+        PairNodesMap<Node> cacheX;
+        // While computing the intersection of the derivatives, p stands for
+        // the recursion variable of this call. It is removed again below, so
+        // that the path cache is shared instead of copied for each call.
+        cache[p] = nm->mkNode(Kind::REGEXP_RV, nm->mkConstInt(Rational(cnt)));
         for (std::vector<unsigned>::const_iterator it = cset.begin();
              it != cset.end();
              ++it)
@@ -1402,14 +1430,11 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
             r1l = r2l; r2l = tnode;
           }
           PairNodes pp(r1l, r2l);
-          std::map< PairNodes, Node >::const_iterator itr2 = cacheX.find(pp);
+          PairNodesMap<Node>::const_iterator itr2 = cacheX.find(pp);
           if(itr2 != cacheX.end()) {
             rt = itr2->second;
           } else {
-            std::map< PairNodes, Node > cache2(cache);
-            cache2[p] =
-                nm->mkNode(Kind::REGEXP_RV, nm->mkConstInt(Rational(cnt)));
-            rt = intersectInternal(r1l, r2l, cache2, cnt+1);
+            rt = intersectInternal(r1l, r2l, cache, cnt+1);
             cacheX[ pp ] = rt;
           }
 
@@ -1421,6 +1446,7 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
           Trace("regexp-int-debug") << "  ... got p(r1,c) && p(r2,c) = " << mkString(rt) << std::endl;
           vec_nodes.push_back(rt);
         }
+        cache.erase(p);
         rNode = rewrite(vec_nodes.size() == 0 ? d_emptyRegexp
                         : vec_nodes.size() == 1
                             ? vec_nodes[0]
@@ -1432,6 +1458,7 @@ Node RegExpOpr::intersectInternal( Node r1, Node r2, std::map< PairNodes, Node >
     Trace("regexp-int-debug") << "  ... try testing no RV of " << mkString(rNode) << std::endl;
     if (!expr::hasSubtermKind(Kind::REGEXP_RV, rNode))
     {
+      boundCache(d_inter_cache);
       d_inter_cache[p] = rNode;
     }
   }
@@ -1529,7 +1556,7 @@ Node RegExpOpr::intersect(Node r1, Node r2)
   }
   Node rr1 = removeIntersection(r1);
   Node rr2 = removeIntersection(r2);
-  std::map<PairNodes, Node> cache;
+  PairNodesMap<Node> cache;
   Trace("regexp-intersect-node") << "Intersect (1): " << rr1 << std::endl;
   Trace("regexp-intersect-node") << "Intersect (2): " << rr2 << std::endl;
   Trace("regexp-intersect") << "Start INTERSECTION(\n\t" << mkString(r1)
@@ -26,6 +26,8 @@
 #include "expr/node.h"
 #include "smt/env_obj.h"
 #include "theory/strings/skolem_cache.h"
+#include "util/hash.h"
+#include "util/statistics_stats.h"
 #include "util/string.h"
 
 namespace cvc5::internal {
@@ -59,6 +61,16 @@ class RegExpOpr : protected EnvObj
   typedef std::pair<Node, cvc5::internal::String> PairNodeStr;
   typedef std::set< Node > SetNodes;
   typedef std::pair< Node, Node > PairNodes;
+  using PairNodeStrHash =
+      PairHashFunction<Node,
+                       cvc5::internal::String,
+                       std::hash<Node>,
+                       cvc5::internal::strings::StringHashFunction>;
+  using PairNodesHash = PairHashFunction<Node, Node>;
+  template <class T>
+  using PairNodesMap = std::unordered_map<PairNodes, T, PairNodesHash>;
+  template <class T>
+  using PairNodeStrMap = std::unordered_map<PairNodeStr, T, PairNodeStrHash>;
 
  private:
   /** the code point of the last character in the alphabet we are using */
@@ -74,17 +86,39 @@ class RegExpOpr : protected EnvObj
   Node d_sigma;
   Node d_sigma_star;
 
+  /**
+   * The maximum number of entries of the caches for deltas, derivatives,
+   * first characters and intersections, which are cleared when they exceed
+   * this size. Their entries are context-independent and can be recomputed.
+   */
+  static constexpr size_t s_maxCacheSize = 1 << 16;
   /** A cache for simplify */
-  std::map<Node, Node> d_simpCache;
-  std::map<Node, std::pair<int, Node> > d_delta_cache;
-  std::map<PairNodeStr, Node> d_dv_cache;
-  std::map<PairNodeStr, std::pair<Node, int> > d_deriv_cache;
+  std::unordered_map<Node, Node> d_simpCache;
+  std::unordered_map<Node, std::pair<int, Node>> d_delta_cache;
+  PairNodeStrMap<Node> d_dv_cache;
+  PairNodeStrMap<std::pair<Node, int>> d_deriv_cache;
   /** cache mapping regular expressions to whether they contain constants */
   std::unordered_map<Node, RegExpConstType> d_constCache;
-  std::map<Node, std::pair<std::set<unsigned>, std::set<Node> > > d_fset_cache;
-  std::map<PairNodes, Node> d_inter_cache;
-  std::map<Node, std::vector<PairNodes> > d_split_cache;
+  std::unordered_map<Node, std::pair<std::set<unsigned>, std::set<Node>>>
+      d_fset_cache;
+  PairNodesMap<Node> d_inter_cache;
   std::map<PairNodes, bool> d_inclusionCache;
+  /** The number of hits in the derivative caches */
+  IntStat d_derivCacheHits;
+  /** The number of hits in the intersection cache */
+  IntStat d_interCacheHits;
+  /** The number of times a cache was cleared for exceeding its size */
+  IntStat d_cacheClears;
+  /** Clear cache c if it exceeds the maximum cache size */
+  template <class Cache>
+  void boundCache(Cache& c)
+  {
+    if (c.size() >= s_maxCacheSize)
+    {
+      c.clear();
+      ++d_cacheClears;
+    }
+  }
   /**
    * Helper function for mkString, pretty prints constant or variable regular
    * expression r.
@@ -96,9 +130,14 @@ class RegExpOpr : protected EnvObj
   bool containC2(unsigned cnt, Node n);
   Node convert1(unsigned cnt, Node n);
   void convert2(unsigned cnt, Node n, Node &r1, Node &r2);
+  /**
+   * Returns the intersection of r1 and r2, where cache maps the pairs whose
+   * intersection is being computed on the current path of the recursion to
+   * the recursion variable (re.rv) standing for their intersection.
+   */
   Node intersectInternal(Node r1,
                          Node r2,
-                         std::map<PairNodes, Node> cache,
+                         PairNodesMap<Node>& cache,
                          unsigned cnt);
   /**
    * Given a regular expression r, this returns an equivalent regular expression
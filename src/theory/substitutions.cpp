@@ -27,8 +27,11 @@ SubstitutionMap::SubstitutionMap(context::Context* context, bool compress)
       d_substitutions(context ? context : &d_context),
       d_substitutionCache(),
       d_cacheInvalidated(false),
+      d_cachePruned(false),
+      d_numChanges(0),
       d_compress(compress),
-      d_cacheInvalidator(context ? context : &d_context, d_cacheInvalidated)
+      d_cacheInvalidator(
+          context ? context : &d_context, d_cacheInvalidated, d_numChanges)
 {
 }
 
@@ -211,6 +214,13 @@ Node SubstitutionMap::internalSubstitute(TNode t,
   return cache[t];
 } /* SubstitutionMap::internalSubstitute() */
 
+bool SubstitutionMap::isCacheValidFor(TNode x) const
+{
+  return !d_cachePruned && x.getNumChildren() == 0
+         && x.getMetaKind() != kind::metakind::PARAMETERIZED
+         && d_substitutionCache.find(x) == d_substitutionCache.end();
+}
+
 void SubstitutionMap::addSubstitution(TNode x, TNode t, bool invalidateCache)
 {
   // don't check type equal here, since this utility may be used in conversions
@@ -228,10 +238,14 @@ void SubstitutionMap::addSubstitution(TNode x, TNode t, bool invalidateCache)
   Assert(x != t) << "cannot substitute a term for itself";
 
   d_substitutions[x] = t;
+  d_numChanges++;
 
   // Also invalidate the cache if necessary
   if (invalidateCache) {
-    d_cacheInvalidated = true;
+    if (!isCacheValidFor(x))
+    {
+      d_cacheInvalidated = true;
+    }
   }
   else {
     d_substitutionCache[x] = d_substitutions[x];
@@ -243,15 +257,17 @@ void SubstitutionMap::addSubstitutions(SubstitutionMap& subMap, bool invalidateC
 {
   NodeMap::const_iterator it = subMap.begin();
   NodeMap::const_iterator it_end = subMap.end();
+  d_numChanges++;
   for (; it != it_end; ++ it) {
     Assert(d_substitutions.find((*it).first) == d_substitutions.end());
     d_substitutions[(*it).first] = (*it).second;
     if (!invalidateCache) {
       d_substitutionCache[(*it).first] = d_substitutions[(*it).first];
     }
-  }
-  if (invalidateCache) {
-    d_cacheInvalidated = true;
+    else if (!isCacheValidFor((*it).first))
+    {
+      d_cacheInvalidated = true;
+    }
   }
 }
 
@@ -261,6 +277,7 @@ void SubstitutionMap::eraseSubstitution(TNode x, bool invalidateCache)
   Assert(!d_compress);
   Assert(d_substitutions.find(x) != d_substitutions.end());
   d_substitutions[x] = x;
+  d_numChanges++;
   if (invalidateCache)
   {
     d_cacheInvalidated = true;
@@ -278,8 +295,11 @@ Node SubstitutionMap::apply(TNode t,
   if (d_cacheInvalidated) {
     d_substitutionCache.clear();
     d_cacheInvalidated = false;
+    d_cachePruned = false;
     Trace("substitution") << "-- reset the cache" << endl;
   }
+  // the cache may contain terms whose subterms are not keys of the cache
+  d_cachePruned = d_cachePruned || stc != nullptr;
 
   // Perform the substitution
   Node result = internalSubstitute(t, d_substitutionCache, tracker, stc);
@@ -70,9 +70,27 @@ class SubstitutionMap
   /** Has the cache been invalidated? */
   bool d_cacheInvalidated;
 
+  /**
+   * Does the cache contain terms whose subterms were not traversed, due to a
+   * ShouldTraverseCallback?
+   */
+  bool d_cachePruned;
+
+  /** The number of changes to the substitutions, see getNumChanges */
+  size_t d_numChanges;
+
   /** Are we using substitution compression */
   bool d_compress;
 
+  /**
+   * Returns true if the cache remains valid after adding a substitution for
+   * x. This is the case if x is a leaf that is not a key of the cache. Since
+   * all subterms of terms in the cache are (transitively) keys of the cache,
+   * x then does not occur in any of its entries, which are hence unchanged by
+   * a substitution for x.
+   */
+  bool isCacheValidFor(TNode x) const;
+
   /** Internal method that performs substitution */
   Node internalSubstitute(TNode t,
                           NodeCache& cache,
@@ -83,14 +101,22 @@ class SubstitutionMap
   class CacheInvalidator : public context::ContextNotifyObj
   {
     bool& d_cacheInvalidated;
+    size_t& d_numChanges;
 
    protected:
-    void contextNotifyPop() override { d_cacheInvalidated = true; }
+    void contextNotifyPop() override
+    {
+      d_cacheInvalidated = true;
+      d_numChanges++;
+    }
 
    public:
-    CacheInvalidator(context::Context* context, bool& cacheInvalidated)
+    CacheInvalidator(context::Context* context,
+                     bool& cacheInvalidated,
+                     size_t& numChanges)
         : context::ContextNotifyObj(context),
-          d_cacheInvalidated(cacheInvalidated)
+          d_cacheInvalidated(cacheInvalidated),
+          d_numChanges(numChanges)
     {
     }
 
@@ -141,6 +167,14 @@ class SubstitutionMap
 
   /** Size of the substitutions */
   size_t size() const { return d_substitutions.size(); }
+  /**
+   * Get the number of changes to this substitution, which is incremented
+   * whenever a substitution is added or erased, and on pops of the context.
+   * Callers may use this to determine whether the result of apply on a term
+   * is still valid. Notice that compression does not count as a change, since
+   * it does not change the result of apply.
+   */
+  size_t getNumChanges() const { return d_numChanges; }
   /**
    * Returns true iff x is in the substitution map
    */
@@ -199,6 +199,8 @@ void PreRegisterVisitor::preRegisterWithTheory(TheoryEngine* te,
   }
   // call the theory's preRegisterTerm method
   Theory* th = te->theoryOf(id);
+  TheoryProfile::Scope ps(
+      te->getProfile(), id, TheoryProfileOp::PRE_REGISTER_TERM);
   th->preRegisterTerm(current);
 }
 
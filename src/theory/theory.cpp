@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "base/check.h"
+#include "context/context_stats.h"
 #include "expr/node_algorithm.h"
 #include "expr/skolem_manager.h"
 #include "options/arith_options.h"
@@ -79,7 +80,9 @@ Theory::Theory(TheoryId id,
       d_id(id),
       d_facts(d_env.getContext()),
       d_factsHead(d_env.getContext(), 0),
-      d_careGraph(nullptr)
+      d_careGraph(nullptr),
+      d_careGraphSharedTerms(d_env.getContext(), 0),
+      d_careGraphPending(d_env.getContext())
 {
 }
 
@@ -127,6 +130,7 @@ void Theory::finishInitStandalone()
   if (needsEqualityEngine(esi))
   {
     // always associated with the same SAT context as the theory
+    context::ContextStatistics::OwnerScope owner("EqualityEngine");
     d_allocEqualityEngine =
         std::make_unique<eq::EqualityEngine>(d_env,
                                              context(),
@@ -258,19 +262,16 @@ void Theory::computeCareGraph()
   Trace("sharing") << "Theory::computeCareGraph<" << getId() << ">()" << endl;
   const context::CDList<TNode>& sharedTerms = d_theoryState->getSharedTerms();
   size_t ssize = sharedTerms.size();
-  for (size_t i = 0; i < ssize; ++i)
-  {
-    TNode a = sharedTerms[i];
-    TypeNode aType = a.getType();
-    for (size_t j = i + 1; j < ssize; ++j)
+  // Pairs whose equality status was propagated stay propagated in the current
+  // context and its extensions. Thus, only the pairs pending from the last
+  // call in this context and the pairs involving new shared terms are
+  // checked.
+  size_t oldSize = d_careGraphSharedTerms.get();
+  Assert(oldSize <= ssize);
+  auto pending = std::make_shared<std::vector<std::pair<Node, Node>>>();
+  auto checkPair = [&](TNode a, TNode b) {
+    switch (d_valuation.getEqualityStatus(a, b))
     {
-      TNode b = sharedTerms[j];
-      if (b.getType() != aType)
-      {
-        // We don't care about the terms of different types
-        continue;
-      }
-      switch (d_valuation.getEqualityStatus(a, b)) {
       case EQUALITY_TRUE_AND_PROPAGATED:
       case EQUALITY_FALSE_AND_PROPAGATED:
         // If we know about it, we should have propagated it, so we can skip
@@ -278,10 +279,34 @@ void Theory::computeCareGraph()
       default:
         // Let's split on it
         addCarePair(a, b);
+        pending->emplace_back(a, b);
         break;
+    }
+  };
+  if (d_careGraphPending.get() != nullptr)
+  {
+    for (const std::pair<Node, Node>& p : *d_careGraphPending.get())
+    {
+      checkPair(p.first, p.second);
+    }
+  }
+  for (size_t j = oldSize; j < ssize; ++j)
+  {
+    TNode b = sharedTerms[j];
+    TypeNode bType = b.getType();
+    for (size_t i = 0; i < j; ++i)
+    {
+      TNode a = sharedTerms[i];
+      if (a.getType() != bType)
+      {
+        // We don't care about the terms of different types
+        continue;
       }
+      checkPair(a, b);
     }
   }
+  d_careGraphSharedTerms = ssize;
+  d_careGraphPending = pending;
 }
 
 void Theory::printFacts(std::ostream& os) const {
@@ -325,7 +350,7 @@ void Theory::collectAssertedTerms(std::set<Node>& termSet,
                                   const std::set<Kind>& irrKinds) const
 {
   // Collect all terms appearing in assertions
-  context::CDList<Assertion>::const_iterator assert_it = facts_begin(),
+  FactList::const_iterator assert_it = facts_begin(),
                                              assert_it_end = facts_end();
   for (; assert_it != assert_it_end; ++assert_it)
   {
@@ -19,9 +19,12 @@
 #define CVC5__THEORY__THEORY_H
 
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "context/cdlist.h"
 #include "context/cdo.h"
@@ -687,7 +690,7 @@ class Theory : protected EnvObj
    */
   virtual std::string identify() const = 0;
 
-  typedef context::CDList<Assertion>::const_iterator assertions_iterator;
+  typedef FactList::const_iterator assertions_iterator;
 
   /**
    * Provides access to the facts queue, primarily intended for theory
@@ -788,7 +791,7 @@ class Theory : protected EnvObj
    * These can not be TNodes as some atoms (such as equalities) are sent
    * across theories without being stored in a global map.
    */
-  context::CDList<Assertion> d_facts;
+  FactList d_facts;
 
   /** Index into the head of the facts list */
   context::CDO<unsigned> d_factsHead;
@@ -796,6 +799,20 @@ class Theory : protected EnvObj
   /** The care graph the theory will use during combination. */
   CareGraph* d_careGraph;
 
+  /**
+   * The number of shared terms considered by the last call to the default
+   * implementation of computeCareGraph in this context.
+   */
+  context::CDO<size_t> d_careGraphSharedTerms;
+  /**
+   * The pairs of the above shared terms whose equality status was not
+   * propagated on the last call to computeCareGraph in this context. The
+   * other pairs among these terms remain propagated in this context and need
+   * not be checked again.
+   */
+  context::CDO<std::shared_ptr<std::vector<std::pair<Node, Node>>>>
+      d_careGraphPending;
+
   /** Pointer to the decision manager. */
   DecisionManager* d_decManager;
 }; /* class Theory */
@@ -237,8 +237,9 @@ TheoryEngine::TheoryEngine(Env& env)
       d_propagationMapTimestamp(context(), 0),
       d_propagatedLiterals(context()),
       d_propagatedLiteralsIndex(context(), 0),
+      d_lemmaCache(userContext()),
       d_atomRequests(context()),
-      d_stats(statisticsRegistry()),
+      d_stats(statisticsRegistry(), options().theory.theoryProfile),
       d_true(),
       d_false(),
       d_interrupted(false),
@@ -333,7 +334,7 @@ void TheoryEngine::printAssertions(const char* tag) {
         Trace(tag) << "--------------------------------------------" << endl;
         Trace(tag) << "Assertions of " << theory->getId() << ": " << endl;
         {
-          context::CDList<Assertion>::const_iterator it = theory->facts_begin(),
+          FactList::const_iterator it = theory->facts_begin(),
                                                      it_end =
                                                          theory->facts_end();
           for (unsigned i = 0; it != it_end; ++it, ++i)
@@ -386,7 +387,10 @@ void TheoryEngine::check(Theory::Effort effort) {
 #define CVC5_FOR_EACH_THEORY_STATEMENT(THEORY)                           \
   if (theory::TheoryTraits<THEORY>::hasCheck && isTheoryEnabled(THEORY)) \
   {                                                                      \
-    theoryOf(THEORY)->check(effort);                                     \
+    {                                                                    \
+      TheoryProfile::Scope ps(d_stats.d_profile, THEORY, checkOp);       \
+      theoryOf(THEORY)->check(effort);                                   \
+    }                                                                    \
     if (d_inConflict)                                                    \
     {                                                                    \
       Trace("conflict") << THEORY << " in conflict. " << std::endl;      \
@@ -397,6 +401,12 @@ void TheoryEngine::check(Theory::Effort effort) {
       interrupt();                                                       \
       return;                                                            \
     }                                                                    \
+    if (stopOnLemma && d_lemmasAdded)                                    \
+    {                                                                    \
+      Trace("theory") << THEORY << " sent a lemma. " << std::endl;       \
+      d_stats.d_fullEffortChecksCut++;                                   \
+      break;                                                             \
+    }                                                                    \
   }
 
   // Do the checking
@@ -425,6 +435,15 @@ void TheoryEngine::check(Theory::Effort effort) {
     }
 
     auto rm = d_env.getResourceManager();
+    // If a lemma is sent at full effort, the SAT solver processes it before
+    // the next full effort check, which may change the assignment. The work
+    // of the remaining theories (e.g. quantifier instantiation) is then likely
+    // wasted, so we may skip them until the next full effort check.
+    bool stopOnLemma =
+        Theory::fullEffort(effort) && options().theory.fullCheckStopOnLemma;
+    TheoryProfileOp checkOp = Theory::fullEffort(effort)
+                                  ? TheoryProfileOp::CHECK_FULL
+                                  : TheoryProfileOp::CHECK_STANDARD;
 
     // Check until done
     while (d_factsAsserted && !d_inConflict && !d_lemmasAdded) {
@@ -522,6 +541,9 @@ void TheoryEngine::check(Theory::Effort effort) {
                 // uniformity ask all theories needsCheckLastEffort method.
                 continue;
               }
+              TheoryProfile::Scope ps(d_stats.d_profile,
+                                      theoryId,
+                                      TheoryProfileOp::CHECK_LAST_CALL);
               theory->check(Theory::EFFORT_LAST_CALL);
             }
           }
@@ -601,10 +623,12 @@ void TheoryEngine::propagate(Theory::Effort effort)
 #undef CVC5_FOR_EACH_THEORY_STATEMENT
 #endif
 #define CVC5_FOR_EACH_THEORY_STATEMENT(THEORY)   \
-  if (theory::TheoryTraits<THEORY>::hasPropagate \
-      && isTheoryEnabled(THEORY))    \
-  {                                              \
-    theoryOf(THEORY)->propagate(effort);         \
+  if (theory::TheoryTraits<THEORY>::hasPropagate                 \
+      && isTheoryEnabled(THEORY))                                \
+  {                                                              \
+    TheoryProfile::Scope ps(                                     \
+        d_stats.d_profile, THEORY, TheoryProfileOp::PROPAGATE);  \
+    theoryOf(THEORY)->propagate(effort);                         \
   }
 
   // Reset the interrupt flag
@@ -909,7 +933,12 @@ TrustNode TheoryEngine::ppRewrite(TNode term,
        << term;
     throw LogicException(ss.str());
   }
-  TrustNode trn = d_theoryTable[tid]->ppRewrite(term, lems);
+  TrustNode trn;
+  {
+    TheoryProfile::Scope ps(
+        d_stats.d_profile, tid, TheoryProfileOp::PP_REWRITE);
+    trn = d_theoryTable[tid]->ppRewrite(term, lems);
+  }
   // should never introduce a skolem to eliminate an equality
   Assert(lems.empty() || term.getKind() != Kind::EQUAL);
   if (!isProofEnabled())
@@ -1312,7 +1341,12 @@ TrustNode TheoryEngine::getExplanation(TNode node)
         << "TheoryEngine::getExplanation: sharing is NOT enabled. "
         << " Responsible theory is: " << theoryOf(atom)->getId() << std::endl;
 
-    texplanation = theoryOf(atom)->explain(node);
+    Theory* th = theoryOf(atom);
+    {
+      TheoryProfile::Scope ps(
+          d_stats.d_profile, th->getId(), TheoryProfileOp::EXPLAIN);
+      texplanation = th->explain(node);
+    }
     Node explanation = texplanation.getNode();
     Trace("theory::explain") << "TheoryEngine::getExplanation(" << node
                              << ") => " << explanation << endl;
@@ -1509,6 +1543,29 @@ void TheoryEngine::lemma(TrustNode tlemma,
   Assert(!expr::hasFreeVar(rewrite(lemma)))
       << "Lemma " << lemma << " from " << from << " has a free variable";
 
+  // Drop lemmas that are equivalent up to rewriting to a lemma that is still
+  // in the SAT solver. Conflicts, and removable or local lemmas, which the SAT
+  // solver may forget, are never dropped. We still mark that a lemma was
+  // added, so that the behavior of check is the same as for the duplicate.
+  uint64_t dedupLimit = options().theory.lemmaDedupLimit;
+  if (dedupLimit > 0 && tlemma.getKind() == TrustNodeKind::LEMMA
+      && !isLemmaPropertyRemovable(p) && !isLemmaPropertyLocal(p))
+  {
+    Node rlemma = rewrite(lemma);
+    if (d_lemmaCache.find(rlemma) != d_lemmaCache.end())
+    {
+      Trace("te-lemma-dedup") << "Drop duplicate lemma " << lemma << " from "
+                              << from << std::endl;
+      d_stats.d_duplicateLemmas << from;
+      d_lemmasAdded = true;
+      return;
+    }
+    if (d_lemmaCache.size() < dedupLimit)
+    {
+      d_lemmaCache.insert(rlemma);
+    }
+  }
+
   // when proofs are enabled, we ensure the trust node has a generator by
   // adding a trust step to the lazy proof maintained by this class
   if (isProofEnabled())
@@ -2076,7 +2133,7 @@ void TheoryEngine::checkTheoryAssertionsWithModel(bool hardFailure) {
     Theory* theory = d_theoryTable[theoryId];
     if (theory && isTheoryEnabled(theoryId))
     {
-      for (context::CDList<Assertion>::const_iterator
+      for (FactList::const_iterator
                it = theory->facts_begin(),
                it_end = theory->facts_end();
            it != it_end;
@@ -2223,6 +2280,10 @@ void TheoryEngine::initializeProofChecker(ProofChecker* pc)
   for (theory::TheoryId id = theory::THEORY_FIRST; id < theory::THEORY_LAST;
        ++id)
   {
+    if (d_theoryTable[id] == nullptr)
+    {
+      continue;
+    }
     ProofRuleChecker* prc = d_theoryTable[id]->getProofChecker();
     if (prc)
     {
@@ -23,6 +23,8 @@
 
 #include "base/check.h"
 #include "context/cdhashmap.h"
+#include "context/cdhashset.h"
+#include "context/context_stats.h"
 #include "expr/node.h"
 #include "options/theory_options.h"
 #include "proof/trust_node.h"
@@ -136,6 +138,8 @@ class TheoryEngine : protected EnvObj
     Assert(d_theoryTable[theoryId] == NULL && d_theoryOut[theoryId] == NULL);
     d_theoryOut[theoryId] =
         new theory::OutputChannel(statisticsRegistry(), this, theoryId);
+    // attribute the context-dependent state of the theory to it
+    context::ContextStatistics::OwnerScope owner(theory::toString(theoryId));
     d_theoryTable[theoryId] =
         new TheoryClass(d_env, *d_theoryOut[theoryId], theory::Valuation(this));
     getRewriter()->registerTheoryRewriter(
@@ -164,6 +168,15 @@ class TheoryEngine : protected EnvObj
    */
   prop::PropEngine* getPropEngine() const { return d_propEngine; }
 
+  /**
+   * Get a pointer to the partition generator, or null if partitions are not
+   * computed.
+   */
+  theory::PartitionGenerator* getPartitionGenerator() const
+  {
+    return d_partitionGen.get();
+  }
+
   /**
    * Get a pointer to the underlying quantifiers engine.
    */
@@ -223,6 +236,9 @@ class TheoryEngine : protected EnvObj
    * a SAT response.
    */
   bool needCheck() const { return d_outputChannelUsed || d_lemmasAdded; }
+
+  /** Get the profile of the methods of theories (see --theory-profile). */
+  theory::TheoryProfile& getProfile() { return d_stats.d_profile; }
   /**
    * Is the literal lit (possibly) critical for satisfying the input formula in
    * the current context? This call is applicable only during collectModelInfo
@@ -640,6 +656,14 @@ class TheoryEngine : protected EnvObj
    */
   bool d_lemmasAdded;
 
+  /**
+   * The rewritten forms of the (non-removable, non-local) lemmas sent to the
+   * SAT solver in the current user context, if --lemma-dedup-limit is
+   * non-zero. Lemmas whose rewritten form is in this set are redundant and
+   * are not sent again. At most --lemma-dedup-limit lemmas are remembered.
+   */
+  context::CDHashSet<Node> d_lemmaCache;
+
   /**
    * A variable to mark if the OutputChannel was "used" by any theory
    * since the start of the last check.  If it has been, we require
@@ -15,17 +15,84 @@
 
 #include "theory/theory_engine_statistics.h"
 
+#include "base/check.h"
+
 namespace cvc5::internal {
 namespace theory {
 
-TheoryEngineStatistics::TheoryEngineStatistics(StatisticsRegistry& sr)
+namespace {
+
+const char* toString(TheoryProfileOp op)
+{
+  switch (op)
+  {
+    case TheoryProfileOp::CHECK_STANDARD: return "checkStandard";
+    case TheoryProfileOp::CHECK_FULL: return "checkFull";
+    case TheoryProfileOp::CHECK_LAST_CALL: return "checkLastCall";
+    case TheoryProfileOp::PROPAGATE: return "propagate";
+    case TheoryProfileOp::EXPLAIN: return "explain";
+    case TheoryProfileOp::PRE_REGISTER_TERM: return "preRegisterTerm";
+    case TheoryProfileOp::PP_REWRITE: return "ppRewrite";
+    case TheoryProfileOp::COLLECT_MODEL_INFO: return "collectModelInfo";
+    default: Unreachable();
+  }
+  return "?";
+}
+
+}  // namespace
+
+TheoryProfile::TheoryProfile(StatisticsRegistry& sr, bool enabled)
+    : d_enabled(enabled)
+{
+  if (!d_enabled)
+  {
+    return;
+  }
+  size_t numOps = static_cast<size_t>(TheoryProfileOp::NUM_OPS);
+  for (size_t i = 0; i < numOps; ++i)
+  {
+    std::string op = toString(static_cast<TheoryProfileOp>(i));
+    d_calls.push_back(
+        sr.registerHistogram<TheoryId>("TheoryEngine::profile::" + op));
+  }
+  for (TheoryId tid = THEORY_FIRST; tid < THEORY_LAST; ++tid)
+  {
+    for (size_t i = 0; i < numOps; ++i)
+    {
+      std::string op = toString(static_cast<TheoryProfileOp>(i));
+      d_times.push_back(
+          sr.registerTimer(getStatsPrefix(tid) + "profile::" + op + "Time"));
+    }
+  }
+}
+
+TheoryProfile::Scope::Scope(TheoryProfile& p,
+                            TheoryId tid,
+                            TheoryProfileOp op)
+{
+  if (!p.d_enabled)
+  {
+    return;
+  }
+  size_t i = static_cast<size_t>(op);
+  p.d_calls[i] << tid;
+  size_t numOps = static_cast<size_t>(TheoryProfileOp::NUM_OPS);
+  d_timer.emplace(p.d_times[static_cast<size_t>(tid) * numOps + i], true);
+}
+
+TheoryEngineStatistics::TheoryEngineStatistics(StatisticsRegistry& sr,
+                                               bool profile)
     : d_combineTheoriesTime(
         sr.registerTimer("TheoryEngine::combineTheoriesTime")),
       d_stdEffortChecks(sr.registerInt("TheoryEngine::Checks_Standard")),
       d_fullEffortChecks(sr.registerInt("TheoryEngine::Checks_Full")),
       d_combineTheoriesCalls(
           sr.registerInt("TheoryEngine::combineTheoriesCalls")),
-      d_lcEffortChecks(sr.registerInt("TheoryEngine::Checks_Last_Call"))
+      d_lcEffortChecks(sr.registerInt("TheoryEngine::Checks_Last_Call")),
+      d_fullEffortChecksCut(sr.registerInt("TheoryEngine::Checks_Full_Cut")),
+      d_duplicateLemmas(
+          sr.registerHistogram<TheoryId>("TheoryEngine::duplicateLemmas")),
+      d_profile(sr, profile)
 {
 }
 
@@ -18,12 +18,67 @@
 #ifndef CVC5__THEORY__THEORY_ENGINE_STATISTICS_H
 #define CVC5__THEORY__THEORY_ENGINE_STATISTICS_H
 
+#include <optional>
+#include <vector>
+
+#include "theory/theory_id.h"
 #include "util/statistics_registry.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace theory {
 
+/** The methods of theories that are profiled with --theory-profile. */
+enum class TheoryProfileOp : uint32_t
+{
+  CHECK_STANDARD,
+  CHECK_FULL,
+  CHECK_LAST_CALL,
+  PROPAGATE,
+  EXPLAIN,
+  PRE_REGISTER_TERM,
+  PP_REWRITE,
+  COLLECT_MODEL_INFO,
+  NUM_OPS
+};
+
+/**
+ * Per-theory call counts and times of the main methods of theories, for
+ * identifying which theory and effort level solving time goes to. The
+ * statistics are only registered if profiling is enabled, in which case the
+ * number of calls of each method is a histogram over theories, e.g.
+ * "TheoryEngine::profile::checkFull", and its time is a timer per theory,
+ * e.g. "theory::arith::profile::checkFullTime".
+ */
+class TheoryProfile
+{
+ public:
+  TheoryProfile(StatisticsRegistry& sr, bool enabled);
+  /** Is profiling enabled? */
+  bool isEnabled() const { return d_enabled; }
+
+  /**
+   * Counts a call of `op` of theory `tid` and times it for the lifetime of
+   * this object, if profiling is enabled.
+   */
+  class Scope
+  {
+   public:
+    Scope(TheoryProfile& p, TheoryId tid, TheoryProfileOp op);
+
+   private:
+    std::optional<CodeTimer> d_timer;
+  };
+
+ private:
+  /** Whether profiling is enabled */
+  bool d_enabled;
+  /** The number of calls, per method */
+  std::vector<HistogramStat<TheoryId>> d_calls;
+  /** The time spent, per theory and method */
+  std::vector<TimerStat> d_times;
+};
+
 /**
  * Statistics class for theory engine, which contains all statistics that need
  * to be tracked globally within the theory engine.
@@ -31,7 +86,7 @@ namespace theory {
 class TheoryEngineStatistics
 {
  public:
-  TheoryEngineStatistics(StatisticsRegistry& sr);
+  TheoryEngineStatistics(StatisticsRegistry& sr, bool profile);
   /** Time spent in theory combination */
   TimerStat d_combineTheoriesTime;
   /** Number of standard effort checks */
@@ -42,6 +97,12 @@ class TheoryEngineStatistics
   IntStat d_combineTheoriesCalls;
   /** Number of last call effort checks */
   IntStat d_lcEffortChecks;
+  /** Number of full effort checks cut short by a lemma */
+  IntStat d_fullEffortChecksCut;
+  /** Number of duplicate lemmas dropped, per theory that sent them */
+  HistogramStat<TheoryId> d_duplicateLemmas;
+  /** Profile of the methods of theories */
+  TheoryProfile d_profile;
 };
 
 }  // namespace theory
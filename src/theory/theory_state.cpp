@@ -201,11 +201,11 @@ bool TheoryState::hasSatValue(TNode n, bool& value) const
   return d_valuation.hasSatValue(n, value);
 }
 
-context::CDList<Assertion>::const_iterator TheoryState::factsBegin(TheoryId tid)
+FactList::const_iterator TheoryState::factsBegin(TheoryId tid)
 {
   return d_valuation.factsBegin(tid);
 }
-context::CDList<Assertion>::const_iterator TheoryState::factsEnd(TheoryId tid)
+FactList::const_iterator TheoryState::factsEnd(TheoryId tid)
 {
   return d_valuation.factsEnd(tid);
 }
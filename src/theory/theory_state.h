@@ -113,9 +113,9 @@ class TheoryState : protected EnvObj
    * assertions from other theories.
    */
   /** The beginning iterator of facts for theory tid.*/
-  context::CDList<Assertion>::const_iterator factsBegin(TheoryId tid);
+  FactList::const_iterator factsBegin(TheoryId tid);
   /** The beginning iterator of facts for theory tid.*/
-  context::CDList<Assertion>::const_iterator factsEnd(TheoryId tid);
+  FactList::const_iterator factsEnd(TheoryId tid);
 
   /** Get the underlying valuation class */
   Valuation& getValuation();
@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Open addressing hash table for the application lookup of the equality
+ * engine.
+ */
+
+#include "theory/uf/application_lookup_table.h"
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace eq {
+
+ApplicationLookupTable::ApplicationLookupTable() : d_slots(64), d_size(0) {}
+
+size_t ApplicationLookupTable::home(const FunctionApplication& app) const
+{
+  uint64_t h = (static_cast<uint64_t>(app.d_a) << 32) | app.d_b;
+  h ^= static_cast<uint64_t>(app.d_type) << 29;
+  // Fibonacci hashing, which spreads the consecutive ids well
+  h *= 0x9e3779b97f4a7c15ULL;
+  return static_cast<size_t>(h >> 32) & (d_slots.size() - 1);
+}
+
+EqualityNodeId ApplicationLookupTable::find(
+    const FunctionApplication& app) const
+{
+  size_t mask = d_slots.size() - 1;
+  for (size_t i = home(app);; i = (i + 1) & mask)
+  {
+    const Slot& s = d_slots[i];
+    if (s.d_id == null_id)
+    {
+      return null_id;
+    }
+    if (s.d_app == app)
+    {
+      return s.d_id;
+    }
+  }
+}
+
+void ApplicationLookupTable::insert(const FunctionApplication& app,
+                                    EqualityNodeId id)
+{
+  Assert(id != null_id);
+  Assert(find(app) == null_id);
+  // keep the load factor at most 1/2
+  if (2 * (d_size + 1) > d_slots.size())
+  {
+    grow();
+  }
+  size_t mask = d_slots.size() - 1;
+  size_t i = home(app);
+  while (d_slots[i].d_id != null_id)
+  {
+    i = (i + 1) & mask;
+  }
+  d_slots[i].d_app = app;
+  d_slots[i].d_id = id;
+  ++d_size;
+}
+
+void ApplicationLookupTable::erase(const FunctionApplication& app)
+{
+  size_t mask = d_slots.size() - 1;
+  size_t i = home(app);
+  for (; !(d_slots[i].d_app == app); i = (i + 1) & mask)
+  {
+    Assert(d_slots[i].d_id != null_id) << "erasing a missing application";
+  }
+  Assert(d_slots[i].d_id != null_id) << "erasing a missing application";
+  // Shift back the following entries of the cluster whose probe sequence
+  // passes through the freed slot.
+  for (size_t j = (i + 1) & mask; d_slots[j].d_id != null_id;
+       j = (j + 1) & mask)
+  {
+    size_t h = home(d_slots[j].d_app);
+    // move j to i if h is not cyclically in (i, j]
+    if (((j - h) & mask) >= ((j - i) & mask))
+    {
+      d_slots[i] = d_slots[j];
+      i = j;
+    }
+  }
+  d_slots[i].d_id = null_id;
+  --d_size;
+}
+
+void ApplicationLookupTable::grow()
+{
+  std::vector<Slot> old(2 * d_slots.size());
+  old.swap(d_slots);
+  size_t mask = d_slots.size() - 1;
+  for (const Slot& s : old)
+  {
+    if (s.d_id != null_id)
+    {
+      size_t i = home(s.d_app);
+      while (d_slots[i].d_id != null_id)
+      {
+        i = (i + 1) & mask;
+      }
+      d_slots[i] = s;
+    }
+  }
+}
+
+}  // namespace eq
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Open addressing hash table for the application lookup of the equality
+ * engine.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__UF__APPLICATION_LOOKUP_TABLE_H
+#define CVC5__THEORY__UF__APPLICATION_LOOKUP_TABLE_H
+
+#include <vector>
+
+#include "theory/uf/equality_engine_types.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace eq {
+
+/**
+ * A map from (normalized) function applications to node ids, used by the
+ * equality engine for detecting congruences. Lookups happen for every use of
+ * a merged class, hence this is a flat table with linear probing rather than
+ * a node-based hash map. Erasing uses backward shifting, so that no
+ * tombstones accumulate when the equality engine backtracks.
+ */
+class ApplicationLookupTable
+{
+ public:
+  ApplicationLookupTable();
+
+  /** Return the id stored for app, or null_id if there is none. */
+  EqualityNodeId find(const FunctionApplication& app) const;
+  /** Store id for app, which must not be in the table. */
+  void insert(const FunctionApplication& app, EqualityNodeId id);
+  /** Remove app, which must be in the table. */
+  void erase(const FunctionApplication& app);
+  /** The number of stored applications. */
+  size_t size() const { return d_size; }
+
+ private:
+  /** A slot of the table, which is empty if d_id is null_id. */
+  struct Slot
+  {
+    FunctionApplication d_app;
+    EqualityNodeId d_id = null_id;
+  };
+  /** The slot where the probe sequence of app starts. */
+  size_t home(const FunctionApplication& app) const;
+  /** Double the number of slots. */
+  void grow();
+  /** The slots, whose number is a power of two. */
+  std::vector<Slot> d_slots;
+  /** The number of non-empty slots. */
+  size_t d_size;
+};
+
+}  // namespace eq
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__UF__APPLICATION_LOOKUP_TABLE_H */
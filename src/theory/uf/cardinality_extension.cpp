@@ -984,6 +984,7 @@ int SortModel::combineRegions( int ai, int bi ){
   //update regions disequal DO_THIS?
   d_regions[ai]->combine( d_regions[bi] );
   d_regions[bi]->setValid( false );
+  ++(d_thss->d_statistics.d_region_combines);
   return ai;
 }
 
@@ -994,6 +995,7 @@ void SortModel::moveNode( Node n, int ri ){
   //move node to region ri
   d_regions[ri]->takeNode( d_regions[ d_regions_map[n] ], n );
   d_regions_map[n] = ri;
+  ++(d_thss->d_statistics.d_region_moves);
 }
 
 int SortModel::addSplit(Region* r)
@@ -1022,6 +1024,7 @@ int SortModel::addSplit(Region* r)
         Trace("uf-ss-lemma") << "....Assert disequal directly : "
                              << s[0] << " " << s[1] << std::endl;
         assertDisequal( s[0], s[1], b_t );
+        ++(d_thss->d_statistics.d_split_diseqs);
         return -1;
       }else{
         Trace("uf-ss-warn") << "Split on unknown literal : " << ss << std::endl;
@@ -1801,7 +1804,11 @@ CardinalityExtension::Statistics::Statistics(StatisticsRegistry& sr)
         sr.registerInt("CardinalityExtension::Clique_Conflicts")),
       d_clique_lemmas(sr.registerInt("CardinalityExtension::Clique_Lemmas")),
       d_split_lemmas(sr.registerInt("CardinalityExtension::Split_Lemmas")),
-      d_max_model_size(sr.registerInt("CardinalityExtension::Max_Model_Size"))
+      d_max_model_size(sr.registerInt("CardinalityExtension::Max_Model_Size")),
+      d_region_combines(
+          sr.registerInt("CardinalityExtension::Region_Combines")),
+      d_region_moves(sr.registerInt("CardinalityExtension::Region_Moves")),
+      d_split_diseqs(sr.registerInt("CardinalityExtension::Split_Diseqs"))
 {
   d_max_model_size.maxAssign(1);
 }
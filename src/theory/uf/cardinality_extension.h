@@ -395,6 +395,12 @@ class CardinalityExtension : protected EnvObj
     IntStat d_clique_lemmas;
     IntStat d_split_lemmas;
     IntStat d_max_model_size;
+    /** Number of times two regions were combined */
+    IntStat d_region_combines;
+    /** Number of times a node was moved to another region */
+    IntStat d_region_moves;
+    /** Number of splits that were resolved by a direct disequality */
+    IntStat d_split_diseqs;
     Statistics(StatisticsRegistry& sr);
   };
   /** statistics class */
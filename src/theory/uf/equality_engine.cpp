@@ -20,6 +20,7 @@
 
 #include "base/output.h"
 #include "options/smt_options.h"
+#include "options/uf_options.h"
 #include "smt/env.h"
 #include "theory/rewriter.h"
 #include "theory/uf/eq_proof.h"
@@ -33,7 +34,9 @@ EqualityEngine::Statistics::Statistics(StatisticsRegistry& sr,
     : d_mergesCount(sr.registerInt(name + "mergesCount")),
       d_termsCount(sr.registerInt(name + "termsCount")),
       d_functionTermsCount(sr.registerInt(name + "functionTermsCount")),
-      d_constantTermsCount(sr.registerInt(name + "constantTermsCount"))
+      d_constantTermsCount(sr.registerInt(name + "constantTermsCount")),
+      d_explainCacheHits(sr.registerInt(name + "explainCacheHits")),
+      d_masterMergesSkipped(sr.registerInt(name + "masterMergesSkipped"))
 {
 }
 
@@ -122,6 +125,9 @@ EqualityEngine::EqualityEngine(Env& env,
       d_deducedDisequalitiesSize(c, 0),
       d_deducedDisequalityReasonsSize(c, 0),
       d_propagatedDisequalities(c),
+      d_useExplainCache(options().uf.eeExplainCache),
+      d_explainReasons(c),
+      d_explainCache(c),
       d_name(name)
 {
   init();
@@ -154,6 +160,9 @@ EqualityEngine::EqualityEngine(Env& env,
       d_deducedDisequalitiesSize(c, 0),
       d_deducedDisequalityReasonsSize(c, 0),
       d_propagatedDisequalities(c),
+      d_useExplainCache(options().uf.eeExplainCache),
+      d_explainReasons(c),
+      d_explainCache(c),
       d_name(name)
 {
   init();
@@ -215,8 +224,9 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
   d_applications[funId] = FunctionApplicationPair(funOriginal, funNormalized);
 
   // Add the lookup data, if it's not already there
-  ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-  if (find == d_applicationLookup.end()) {
+  EqualityNodeId lookupId = d_applicationLookup.find(funNormalized);
+  if (lookupId == null_id)
+  {
     Trace("equality") << d_name << "::eq::newApplicationNode(" << original
                       << ", " << t1 << ", " << t2
                       << "): no lookup, setting up funNorm: (" << type << " "
@@ -227,8 +237,9 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
   } else {
     // If it's there, we need to merge these two
     Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup exists, adding to queue" << std::endl;
-    Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[find->second] << std::endl;
-    enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+    Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[lookupId] << std::endl;
+    enqueue(MergeCandidate(
+        funId, lookupId, MERGED_THROUGH_CONGRUENCE, TNode::null()));
   }
 
   // Add to the use lists
@@ -724,11 +735,13 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
         EqualityNodeId aNormalized = getEqualityNode(fun.d_a).getFind();
         EqualityNodeId bNormalized = getEqualityNode(fun.d_b).getFind();
         FunctionApplication funNormalized(fun.d_type, aNormalized, bNormalized);
-        ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-        if (find != d_applicationLookup.end()) {
+        EqualityNodeId lookupId = d_applicationLookup.find(funNormalized);
+        if (lookupId != null_id)
+        {
           // Applications fun and the funNormalized can be merged due to congruence
-          if (getEqualityNode(funId).getFind() != getEqualityNode(find->second).getFind()) {
-            enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+          if (getEqualityNode(funId).getFind() != getEqualityNode(lookupId).getFind()) {
+            enqueue(MergeCandidate(
+                funId, lookupId, MERGED_THROUGH_CONGRUENCE, TNode::null()));
           }
         } else {
           // There is no representative, so we can add one, we remove this when backtracking
@@ -1119,7 +1132,14 @@ void EqualityEngine::explainEquality(TNode t1, TNode t2, bool polarity,
   std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*> cache;
   if (polarity) {
     // Get the explanation
-    getExplanation(t1Id, t2Id, equalities, cache, eqp);
+    if (eqp == nullptr)
+    {
+      getExplanationTop(t1Id, t2Id, equalities);
+    }
+    else
+    {
+      getExplanation(t1Id, t2Id, equalities, cache, eqp);
+    }
   } else {
     if (eqp) {
       eqp->d_id = MERGED_THROUGH_TRANS;
@@ -1273,8 +1293,16 @@ void EqualityEngine::explainPredicate(TNode p, bool polarity,
     debugPrintGraph();
   }
   // Get the explanation
-  getExplanation(
-      getNodeId(p), polarity ? d_trueId : d_falseId, assertions, cache, eqp);
+  EqualityNodeId pId = getNodeId(p);
+  EqualityNodeId rhsId = polarity ? d_trueId : d_falseId;
+  if (eqp == nullptr)
+  {
+    getExplanationTop(pId, rhsId, assertions);
+  }
+  else
+  {
+    getExplanation(pId, rhsId, assertions, cache, eqp);
+  }
 }
 
 void EqualityEngine::explainLit(TNode lit,
@@ -1338,6 +1366,31 @@ Node EqualityEngine::mkExplainLit(TNode lit) const
   return ret;
 }
 
+void EqualityEngine::getExplanationTop(EqualityNodeId t1Id,
+                                       EqualityNodeId t2Id,
+                                       std::vector<TNode>& equalities) const
+{
+  std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*> cache;
+  size_t start = equalities.size();
+  getExplanation(t1Id, t2Id, equalities, cache, nullptr);
+  if (!d_useExplainCache || t1Id == t2Id)
+  {
+    return;
+  }
+  EqualityPair key = std::minmax(t1Id, t2Id);
+  if (d_explainCache.find(key) != d_explainCache.end())
+  {
+    // taken from the cache
+    return;
+  }
+  size_t rstart = d_explainReasons.size();
+  for (size_t i = start, size = equalities.size(); i < size; ++i)
+  {
+    d_explainReasons.push_back(equalities[i]);
+  }
+  d_explainCache[key] = std::make_pair(rstart, d_explainReasons.size());
+}
+
 void EqualityEngine::getExplanation(
     EqualityNodeId t1Id,
     EqualityNodeId t2Id,
@@ -1362,6 +1415,21 @@ void EqualityEngine::getExplanation(
     {
       return;
     }
+    // use the explanation memoized in the current context, if any
+    if (d_useExplainCache)
+    {
+      auto itm = d_explainCache.find(cacheKey);
+      if (itm != d_explainCache.end())
+      {
+        ++d_stats.d_explainCacheHits;
+        for (size_t i = itm->second.first; i < itm->second.second; ++i)
+        {
+          equalities.push_back(d_explainReasons[i]);
+        }
+        cache[cacheKey] = nullptr;
+        return;
+      }
+    }
   }
   else
   {
@@ -2008,10 +2076,25 @@ void EqualityEngine::propagate() {
       }
     }
 
-    // If not merging internal nodes, notify the master
+    // If not merging internal nodes, notify the master. Since the master
+    // receives the merges of all theories, the classes are often already
+    // merged there, e.g. for equalities between terms shared by UF and
+    // arrays, in which case we skip the (redundant) notification.
     if (d_masterEqualityEngine && !d_isInternal[t1classId] && !d_isInternal[t2classId]) {
-      d_masterEqualityEngine->assertEqualityInternal(d_nodes[t1classId], d_nodes[t2classId], TNode::null());
-      d_masterEqualityEngine->propagate();
+      TNode m1 = d_nodes[t1classId];
+      TNode m2 = d_nodes[t2classId];
+      if (d_masterEqualityEngine->hasTerm(m1)
+          && d_masterEqualityEngine->hasTerm(m2)
+          && d_masterEqualityEngine->areEqual(m1, m2))
+      {
+        ++d_stats.d_masterMergesSkipped;
+      }
+      else
+      {
+        d_masterEqualityEngine->assertEqualityInternal(
+            m1, m2, TNode::null());
+        d_masterEqualityEngine->propagate();
+      }
     }
 
     // Notify the triggers
@@ -2164,15 +2247,16 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
 
   // Create the equality
   FunctionApplication eqNormalized(APP_EQUALITY, t1ClassId, t2ClassId);
-  ApplicationIdsMap::const_iterator find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  EqualityNodeId lookupId = d_applicationLookup.find(eqNormalized);
+  if (lookupId != null_id)
+  {
+    if (getEqualityNode(lookupId).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
         const FunctionApplication original =
-            d_applications[find->second].d_original;
+            d_applications[lookupId].d_original;
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t1Id, original.d_a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(lookupId, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t2Id, original.d_b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
@@ -2184,15 +2268,16 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
 
   // Check the symmetric disequality
   std::swap(eqNormalized.d_a, eqNormalized.d_b);
-  find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  lookupId = d_applicationLookup.find(eqNormalized);
+  if (lookupId != null_id)
+  {
+    if (getEqualityNode(lookupId).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
         const FunctionApplication original =
-            d_applications[find->second].d_original;
+            d_applications[lookupId].d_original;
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t2Id, original.d_a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(lookupId, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t1Id, original.d_b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
@@ -2327,8 +2412,8 @@ TNode EqualityEngine::getTriggerTermRepresentative(TNode t, TheoryId tag) const
 }
 
 void EqualityEngine::storeApplicationLookup(FunctionApplication& funNormalized, EqualityNodeId funId) {
-  Assert(d_applicationLookup.find(funNormalized) == d_applicationLookup.end());
-  d_applicationLookup[funNormalized] = funId;
+  Assert(d_applicationLookup.find(funNormalized) == null_id);
+  d_applicationLookup.insert(funNormalized, funId);
   d_applicationLookups.push_back(funNormalized);
   d_applicationLookupsCount = d_applicationLookupsCount + 1;
   Trace("equality::backtrack") << "d_applicationLookupsCount = " << d_applicationLookupsCount << std::endl;
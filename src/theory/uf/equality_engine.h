@@ -27,11 +27,13 @@
 #include <vector>
 
 #include "context/cdhashmap.h"
+#include "context/cdlist.h"
 #include "context/cdo.h"
 #include "expr/kind_map.h"
 #include "expr/node.h"
 #include "smt/env_obj.h"
 #include "theory/theory_id.h"
+#include "theory/uf/application_lookup_table.h"
 #include "theory/uf/equality_engine_iterator.h"
 #include "theory/uf/equality_engine_notify.h"
 #include "theory/uf/equality_engine_types.h"
@@ -283,6 +285,10 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
     IntStat d_functionTermsCount;
     /** Number of constant terms managed by the system */
     IntStat d_constantTermsCount;
+    /** Number of explanations of equalities taken from d_explainCache */
+    mutable IntStat d_explainCacheHits;
+    /** Number of merges not sent to the master, where they already hold */
+    IntStat d_masterMergesSkipped;
 
     Statistics(StatisticsRegistry& sr, const std::string& name);
   };
@@ -308,14 +314,11 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
   /** Map from nodes to their ids */
   std::unordered_map<TNode, EqualityNodeId> d_nodeIds;
 
-  /** Map from function applications to their ids */
-  typedef std::unordered_map<FunctionApplication, EqualityNodeId, FunctionApplicationHashFunction> ApplicationIdsMap;
-
   /**
    * A map from a pair (a', b') to a function application f(a, b), where a' and b' are the current representatives
    * of a and b.
    */
-  ApplicationIdsMap d_applicationLookup;
+  ApplicationLookupTable d_applicationLookup;
 
   /** Application lookups in order, so that we can backtrack. */
   std::vector<FunctionApplication> d_applicationLookups;
@@ -625,6 +628,15 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
       std::vector<TNode>& equalities,
       std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*>& cache,
       EqProof* eqp) const;
+  /**
+   * Same as above for a top-level explanation without proofs, i.e. where
+   * cache is empty. If the explanation cache is enabled, this first looks up
+   * the explanation of t1 = t2 in d_explainCache and otherwise adds the
+   * computed explanation to it.
+   */
+  void getExplanationTop(EqualityNodeId t1Id,
+                         EqualityNodeId t2Id,
+                         std::vector<TNode>& equalities) const;
 
   /**
    * Print the equality graph.
@@ -773,6 +785,26 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
           PropagatedDisequalitiesMap;
   PropagatedDisequalitiesMap d_propagatedDisequalities;
 
+  /** Whether we memoize explanations (--ee-explain-cache) */
+  bool d_useExplainCache;
+  /**
+   * The reasons of the memoized explanations. The explanation of each pair in
+   * d_explainCache is a range of this list.
+   */
+  mutable context::CDList<TNode> d_explainReasons;
+  /**
+   * Map from ordered pairs of ids of equal terms to the range of the reasons
+   * in d_explainReasons that explain their equality. Since the path between
+   * two terms in the proof forest does not change until the context is
+   * popped, the memoized explanations remain valid in the current context.
+   * This is only used when proofs are not being constructed, since proofs
+   * depend on the order of the terms.
+   */
+  mutable context::CDHashMap<EqualityPair,
+                             std::pair<size_t, size_t>,
+                             EqualityPairHashFunction>
+      d_explainCache;
+
   /**
    * Has this equality been propagated to anyone.
    */
@@ -15,6 +15,7 @@
 
 #include "theory/uf/proof_equality_engine.h"
 
+#include "options/proof_options.h"
 #include "proof/lazy_proof_chain.h"
 #include "proof/proof_node.h"
 #include "proof/proof_node_manager.h"
@@ -39,7 +40,9 @@ ProofEqEngine::ProofEqEngine(Env& env, EqualityEngine& ee)
               nullptr,
               env.getContext(),
               "pfee::LazyCDProof::" + ee.identify()),
-      d_keep(env.getContext())
+      d_keep(env.getContext()),
+      d_lazyPropExp(options().proof.proofPfeeLazy),
+      d_lazyPropExps(env.getUserContext())
 {
   NodeManager* nm = nodeManager();
   d_true = nm->mkConst(true);
@@ -375,6 +378,17 @@ TrustNode ProofEqEngine::ensureProofForFact(Node conc,
       scopeAssumps.push_back(a);
     }
   }
+  if (d_lazyPropExp && tnk == TrustNodeKind::PROP_EXP)
+  {
+    // Delay closing the proof until it is requested, see getProofFor. We do
+    // not minimize the assumptions in this case.
+    exp = nm->mkAnd(scopeAssumps);
+    Node pekey = TrustNode::getPropExpProven(conc, exp);
+    d_lazyPropExps[pekey] = std::make_pair(pfBody, scopeAssumps);
+    Trace("pfee-proof") << "pfee::ensureProofForFact: lazy explanation "
+                        << exp << std::endl;
+    return TrustNode::mkTrustPropExp(conc, exp, this);
+  }
   // Scope the proof constructed above, and connect the formula with the proof
   // minimize the assumptions.
   ProofNodeManager* pnm = d_env.getProofNodeManager();
@@ -450,6 +464,42 @@ TrustNode ProofEqEngine::ensureProofForFact(Node conc,
   return TrustNode::null();
 }
 
+std::shared_ptr<ProofNode> ProofEqEngine::getProofFor(Node f)
+{
+  std::shared_ptr<ProofNode> pf = EagerProofGenerator::getProofFor(f);
+  if (pf != nullptr)
+  {
+    return pf;
+  }
+  LazyPropExpMap::const_iterator it = d_lazyPropExps.find(f);
+  if (it == d_lazyPropExps.end())
+  {
+    return nullptr;
+  }
+  Trace("pfee-proof") << "pfee::getProofFor: close lazy explanation " << f
+                      << std::endl;
+  ProofNodeManager* pnm = d_env.getProofNodeManager();
+  std::vector<Node> scopeAssumps = it->second.second;
+  pf = pnm->mkScope(it->second.first, scopeAssumps);
+  if (scopeAssumps.empty())
+  {
+    // as in ensureProofForFact, the explanation is (=> true F)
+    scopeAssumps.push_back(d_true);
+    pf = pnm->mkScope(pf, scopeAssumps, false);
+  }
+  Assert(pf->isClosed());
+  Assert(pf->getResult() == f);
+  // remember the closed proof
+  setProofFor(f, pf);
+  return pf;
+}
+
+bool ProofEqEngine::hasProofFor(Node f)
+{
+  return EagerProofGenerator::hasProofFor(f)
+         || d_lazyPropExps.find(f) != d_lazyPropExps.end();
+}
+
 bool ProofEqEngine::assertFactInternal(TNode atom, bool polarity, TNode reason)
 {
   Trace("pfee-debug") << "pfee::assertFactInternal: " << atom << " " << polarity
@@ -85,6 +85,10 @@ class ProofEqEngine : public EagerProofGenerator
 {
   typedef context::CDHashSet<Node> NodeSet;
   typedef context::CDHashMap<Node, std::shared_ptr<ProofNode>> NodeProofMap;
+  typedef context::CDHashMap<
+      Node,
+      std::pair<std::shared_ptr<ProofNode>, std::vector<Node>>>
+      LazyPropExpMap;
 
  public:
   /**
@@ -243,6 +247,15 @@ class ProofEqEngine : public EagerProofGenerator
    * (this class) that can prove the implication.
    */
   TrustNode explain(Node conc);
+  //-------------------------- proof generator
+  /**
+   * Get the proof for formula f, which is the proven formula of a trust node
+   * returned by this class. If --proof-pfee-lazy is enabled, this closes the
+   * proof of an explanation of a propagation on demand.
+   */
+  std::shared_ptr<ProofNode> getProofFor(Node f) override;
+  /** Can we give the proof for formula f? */
+  bool hasProofFor(Node f) override;
 
  private:
   /** Assert internal */
@@ -299,6 +312,16 @@ class ProofEqEngine : public EagerProofGenerator
    * SAT-context-dependent.
    */
   NodeSet d_keep;
+  /** Whether we close the proofs of explanations lazily */
+  bool d_lazyPropExp;
+  /**
+   * Map from the proven formulas of explanations of propagations to their
+   * (open) proof bodies and the assumptions to close them with, if
+   * d_lazyPropExp is true. Most explanations are never part of the final
+   * proof, in which case the cost of closing their proof is saved. The
+   * bodies are computed eagerly, since they depend on the SAT context.
+   */
+  LazyPropExpMap d_lazyPropExps;
 };
 
 }  // namespace eq
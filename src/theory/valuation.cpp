@@ -227,13 +227,13 @@ bool Valuation::isLegalElimination(TNode x, TNode val)
   return d_engine->isLegalElimination(x, val);
 }
 
-context::CDList<Assertion>::const_iterator Valuation::factsBegin(TheoryId tid)
+FactList::const_iterator Valuation::factsBegin(TheoryId tid)
 {
   Theory* theory = d_engine->theoryOf(tid);
   Assert(theory != nullptr);
   return theory->facts_begin();
 }
-context::CDList<Assertion>::const_iterator Valuation::factsEnd(TheoryId tid)
+FactList::const_iterator Valuation::factsEnd(TheoryId tid)
 {
   Theory* theory = d_engine->theoryOf(tid);
   Assert(theory != nullptr);
@@ -22,9 +22,9 @@
 #ifndef CVC5__THEORY__VALUATION_H
 #define CVC5__THEORY__VALUATION_H
 
-#include "context/cdlist.h"
 #include "expr/node.h"
 #include "options/theory_options.h"
+#include "theory/assertion.h"
 
 namespace cvc5::internal {
 
@@ -32,7 +32,6 @@ class TheoryEngine;
 
 namespace theory {
 
-struct Assertion;
 class TheoryModel;
 class SortInference;
 
@@ -242,9 +241,9 @@ public:
    * assertions from other theories.
    */
   /** The beginning iterator of facts for theory tid.*/
-  context::CDList<Assertion>::const_iterator factsBegin(TheoryId tid);
+  FactList::const_iterator factsBegin(TheoryId tid);
   /** The beginning iterator of facts for theory tid.*/
-  context::CDList<Assertion>::const_iterator factsEnd(TheoryId tid);
+  FactList::const_iterator factsEnd(TheoryId tid);
 };/* class Valuation */
 
 }  // namespace theory
@@ -20,29 +20,70 @@
 
 namespace cvc5::internal {
 
-BitVector::BitVector(const std::string& num, uint32_t base)
+BitVector::BitVector(const std::string& num, uint32_t base) : d_word(0)
 {
   Assert(base == 2 || base == 10 || base == 16);
   Assert(num[0] != '-');
-  d_value = Integer(num, base);
-  Assert(d_value == d_value.abs());
+  Integer value(num, base);
+  Assert(value == value.abs());
   // Compute the length, *without* any negative sign.
   switch (base)
   {
-    case 10: d_size = d_value.length(); break;
+    case 10: d_size = value.length(); break;
     case 16: d_size = num.size() * 4; break;
     default: d_size = num.size();
   }
+  setValue(value);
+}
+
+void BitVector::setValue(const Integer& val)
+{
+  if (isWord())
+  {
+    d_value = Integer();
+    // the two's complement representation of val modulo 2^64
+    if (val.length() < 64)
+    {
+      d_word = static_cast<uint64_t>(val.getSigned64()) & mask(d_size);
+    }
+    else
+    {
+      d_word = val.modByPow2(d_size).getUnsigned64();
+    }
+  }
+  else
+  {
+    d_word = 0;
+    d_value = val.modByPow2(d_size);
+  }
+}
+
+int64_t BitVector::signedWord() const
+{
+  Assert(isWord());
+  if (d_size == 0)
+  {
+    return 0;
+  }
+  unsigned shift = 64 - d_size;
+  return static_cast<int64_t>(d_word << shift) >> shift;
 }
 
 unsigned BitVector::getSize() const { return d_size; }
 
-const Integer& BitVector::getValue() const { return d_value; }
+Integer BitVector::getValue() const
+{
+  return isWord() ? Integer(d_word) : d_value;
+}
 
-Integer BitVector::toInteger() const { return d_value; }
+Integer BitVector::toInteger() const { return getValue(); }
 
 Integer BitVector::toSignedInteger() const
 {
+  if (isWord())
+  {
+    return Integer(signedWord());
+  }
   unsigned size = d_size;
   Integer sign_bit = d_value.extractBitRange(1, size - 1);
   Integer val = d_value.extractBitRange(size - 1, 0);
@@ -52,7 +93,19 @@ Integer BitVector::toSignedInteger() const
 
 std::string BitVector::toString(unsigned int base) const
 {
-  std::string str = d_value.toString(base);
+  if (base == 2 && isWord() && d_size > 0)
+  {
+    std::string str(d_size, '0');
+    for (unsigned i = 0; i < d_size; ++i)
+    {
+      if ((d_word >> i) & 1)
+      {
+        str[d_size - 1 - i] = '1';
+      }
+    }
+    return str;
+  }
+  std::string str = getValue().toString(base);
   if (base == 2 && d_size > str.size())
   {
     std::string zeroes;
@@ -71,12 +124,22 @@ std::string BitVector::toString(unsigned int base) const
 size_t BitVector::hash() const
 {
   PairHashFunction<size_t, size_t> h;
+  if (isWord())
+  {
+    return h(std::make_pair(static_cast<size_t>(d_word), d_size));
+  }
   return h(std::make_pair(d_value.hash(), d_size));
 }
 
 BitVector& BitVector::setBit(uint32_t i, bool value)
 {
   Assert(i < d_size);
+  if (isWord())
+  {
+    uint64_t bit = uint64_t(1) << i;
+    d_word = value ? (d_word | bit) : (d_word & ~bit);
+    return *this;
+  }
   d_value.setBit(i, value);
   return *this;
 }
@@ -84,11 +147,23 @@ BitVector& BitVector::setBit(uint32_t i, bool value)
 bool BitVector::isBitSet(uint32_t i) const
 {
   Assert(i < d_size);
+  if (isWord())
+  {
+    return ((d_word >> i) & 1) != 0;
+  }
   return d_value.isBitSet(i);
 }
 
 unsigned BitVector::isPow2() const
 {
+  if (isWord())
+  {
+    if (d_word == 0 || (d_word & (d_word - 1)) != 0)
+    {
+      return 0;
+    }
+    return __builtin_ctzll(d_word) + 1;
+  }
   return d_value.isPow2();
 }
 
@@ -100,14 +175,26 @@ unsigned BitVector::isPow2() const
 
 BitVector BitVector::concat(const BitVector& other) const
 {
-  return BitVector(d_size + other.d_size,
-                   (d_value.multiplyByPow2(other.d_size)) + other.d_value);
+  unsigned size = d_size + other.d_size;
+  if (size <= 64)
+  {
+    // note that other.d_size is 64 only if d_size is 0
+    uint64_t high = other.d_size == 64 ? 0 : d_word << other.d_size;
+    return BitVector(size, high | other.d_word);
+  }
+  return BitVector(size,
+                   (getValue().multiplyByPow2(other.d_size))
+                       + other.getValue());
 }
 
 BitVector BitVector::extract(unsigned high, unsigned low) const
 {
   Assert(high < d_size);
   Assert(low <= high);
+  if (isWord())
+  {
+    return BitVector(high - low + 1, d_word >> low);
+  }
   return BitVector(high - low + 1,
                    d_value.extractBitRange(high - low + 1, low));
 }
@@ -117,43 +204,38 @@ BitVector BitVector::extract(unsigned high, unsigned low) const
 bool operator==(const BitVector& a, const BitVector& b)
 {
   if (a.getSize() != b.getSize()) return false;
-  return a.getValue() == b.getValue();
+  if (a.isWord())
+  {
+    return a.d_word == b.d_word;
+  }
+  return a.d_value == b.d_value;
 }
 
-bool operator!=(const BitVector& a, const BitVector& b)
-{
-  if (a.getSize() != b.getSize()) return true;
-  return a.getValue() != b.getValue();
-}
+bool operator!=(const BitVector& a, const BitVector& b) { return !(a == b); }
 
 /* Unsigned Inequality --------------------------------------------------- */
 
 bool operator<(const BitVector& a, const BitVector& b)
 {
+  if (a.isWord() && b.isWord())
+  {
+    return a.d_word < b.d_word;
+  }
   return a.getValue() < b.getValue();
 }
 
-bool operator<=(const BitVector& a, const BitVector& b)
-{
-  return a.getValue() <= b.getValue();
-}
+bool operator<=(const BitVector& a, const BitVector& b) { return !(b < a); }
 
-bool operator>(const BitVector& a, const BitVector& b)
-{
-  return a.getValue() > b.getValue();
-}
+bool operator>(const BitVector& a, const BitVector& b) { return b < a; }
 
-bool operator>=(const BitVector& a, const BitVector& b)
-{
-  return a.getValue() >= b.getValue();
-}
+bool operator>=(const BitVector& a, const BitVector& b) { return !(a < b); }
 
 bool BitVector::unsignedLessThan(const BitVector& y) const
 {
   Assert(d_size == y.d_size);
   Assert(d_value >= 0);
   Assert(y.d_value >= 0);
-  return d_value < y.d_value;
+  return *this < y;
 }
 
 bool BitVector::unsignedLessThanEq(const BitVector& y) const
@@ -161,7 +243,7 @@ bool BitVector::unsignedLessThanEq(const BitVector& y) const
   Assert(d_size == y.d_size);
   Assert(d_value >= 0);
   Assert(y.d_value >= 0);
-  return d_value <= y.d_value;
+  return *this <= y;
 }
 
 /* Signed Inequality ----------------------------------------------------- */
@@ -171,6 +253,10 @@ bool BitVector::signedLessThan(const BitVector& y) const
   Assert(d_size == y.d_size);
   Assert(d_value >= 0);
   Assert(y.d_value >= 0);
+  if (isWord())
+  {
+    return signedWord() < y.signedWord();
+  }
   Integer a = (*this).toSignedInteger();
   Integer b = y.toSignedInteger();
 
@@ -182,6 +268,10 @@ bool BitVector::signedLessThanEq(const BitVector& y) const
   Assert(d_size == y.d_size);
   Assert(d_value >= 0);
   Assert(y.d_value >= 0);
+  if (isWord())
+  {
+    return signedWord() <= y.signedWord();
+  }
   Integer a = (*this).toSignedInteger();
   Integer b = y.toSignedInteger();
 
@@ -193,24 +283,40 @@ bool BitVector::signedLessThanEq(const BitVector& y) const
 BitVector operator^(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
-  return BitVector(a.getSize(), a.getValue().bitwiseXor(b.getValue()));
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word ^ b.d_word);
+  }
+  return BitVector(a.getSize(), a.d_value.bitwiseXor(b.d_value));
 }
 
 BitVector operator|(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
-  return BitVector(a.getSize(), a.getValue().bitwiseOr(b.getValue()));
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word | b.d_word);
+  }
+  return BitVector(a.getSize(), a.d_value.bitwiseOr(b.d_value));
 }
 
 BitVector operator&(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
-  return BitVector(a.getSize(), a.getValue().bitwiseAnd(b.getValue()));
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word & b.d_word);
+  }
+  return BitVector(a.getSize(), a.d_value.bitwiseAnd(b.d_value));
 }
 
 BitVector operator~(const BitVector& a)
 {
-  return BitVector(a.getSize(), a.getValue().bitwiseNot());
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), ~a.d_word);
+  }
+  return BitVector(a.getSize(), a.d_value.bitwiseNot());
 }
 
 /* Arithmetic operations ------------------------------------------------- */
@@ -218,13 +324,21 @@ BitVector operator~(const BitVector& a)
 BitVector operator+(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
-  Integer sum = a.getValue() + b.getValue();
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word + b.d_word);
+  }
+  Integer sum = a.d_value + b.d_value;
   return BitVector(a.getSize(), sum);
 }
 
 BitVector operator-(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word - b.d_word);
+  }
   // to maintain the invariant that we are only adding BitVectors of the
   // same size
   BitVector one(a.getSize(), Integer(1));
@@ -233,6 +347,10 @@ BitVector operator-(const BitVector& a, const BitVector& b)
 
 BitVector operator-(const BitVector& a)
 {
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), -a.d_word);
+  }
   BitVector one(a.getSize(), Integer(1));
   return ~a + one;
 }
@@ -240,13 +358,22 @@ BitVector operator-(const BitVector& a)
 BitVector operator*(const BitVector& a, const BitVector& b)
 {
   Assert(a.getSize() == b.getSize());
-  Integer prod = a.getValue() * b.getValue();
+  if (a.isWord())
+  {
+    return BitVector(a.getSize(), a.d_word * b.d_word);
+  }
+  Integer prod = a.d_value * b.d_value;
   return BitVector(a.getSize(), prod);
 }
 
 BitVector BitVector::unsignedDivTotal(const BitVector& y) const
 {
   Assert(d_size == y.d_size);
+  if (isWord())
+  {
+    /* d_word / 0 = -1 = 2^d_size - 1 */
+    return BitVector(d_size, y.d_word == 0 ? ~uint64_t(0) : d_word / y.d_word);
+  }
   /* d_value / 0 = -1 = 2^d_size - 1 */
   if (y.d_value == 0)
   {
@@ -260,6 +387,10 @@ BitVector BitVector::unsignedDivTotal(const BitVector& y) const
 BitVector BitVector::unsignedRemTotal(const BitVector& y) const
 {
   Assert(d_size == y.d_size);
+  if (isWord())
+  {
+    return BitVector(d_size, y.d_word == 0 ? d_word : d_word % y.d_word);
+  }
   if (y.d_value == 0)
   {
     return BitVector(d_size, d_value);
@@ -273,17 +404,24 @@ BitVector BitVector::unsignedRemTotal(const BitVector& y) const
 
 BitVector BitVector::zeroExtend(unsigned n) const
 {
-  return BitVector(d_size + n, d_value);
+  if (d_size + n <= 64)
+  {
+    return BitVector(d_size + n, d_word);
+  }
+  return BitVector(d_size + n, getValue());
 }
 
 BitVector BitVector::signExtend(unsigned n) const
 {
-  Integer sign_bit = d_value.extractBitRange(1, d_size - 1);
-  if (sign_bit == Integer(0))
+  if (d_size + n <= 64)
+  {
+    return BitVector(d_size + n, static_cast<uint64_t>(signedWord()));
+  }
+  if (!isBitSet(d_size - 1))
   {
-    return BitVector(d_size + n, d_value);
+    return BitVector(d_size + n, getValue());
   }
-  Integer val = d_value.oneExtend(d_size, n);
+  Integer val = getValue().oneExtend(d_size, n);
   return BitVector(d_size + n, val);
 }
 
@@ -291,38 +429,56 @@ BitVector BitVector::signExtend(unsigned n) const
 
 BitVector BitVector::leftShift(const BitVector& y) const
 {
-  if (y.d_value > Integer(d_size))
+  if (isWord() && y.isWord())
+  {
+    return BitVector(d_size, y.d_word >= d_size ? 0 : d_word << y.d_word);
+  }
+  Integer amountValue = y.getValue();
+  if (amountValue > Integer(d_size))
   {
     return BitVector(d_size, Integer(0));
   }
-  if (y.d_value == 0)
+  if (amountValue == 0)
   {
     return *this;
   }
   // making sure we don't lose information casting
-  Assert(y.d_value < Integer(1).multiplyByPow2(32));
-  uint32_t amount = y.d_value.toUnsignedInt();
-  Integer res = d_value.multiplyByPow2(amount);
+  Assert(amountValue < Integer(1).multiplyByPow2(32));
+  uint32_t amount = amountValue.toUnsignedInt();
+  Integer res = getValue().multiplyByPow2(amount);
   return BitVector(d_size, res);
 }
 
 BitVector BitVector::logicalRightShift(const BitVector& y) const
 {
-  if (y.d_value > Integer(d_size))
+  if (isWord() && y.isWord())
+  {
+    return BitVector(d_size, y.d_word >= d_size ? 0 : d_word >> y.d_word);
+  }
+  Integer amountValue = y.getValue();
+  if (amountValue > Integer(d_size))
   {
     return BitVector(d_size, Integer(0));
   }
   // making sure we don't lose information casting
-  Assert(y.d_value < Integer(1).multiplyByPow2(32));
-  uint32_t amount = y.d_value.toUnsignedInt();
-  Integer res = d_value.divByPow2(amount);
+  Assert(amountValue < Integer(1).multiplyByPow2(32));
+  uint32_t amount = amountValue.toUnsignedInt();
+  Integer res = getValue().divByPow2(amount);
   return BitVector(d_size, res);
 }
 
 BitVector BitVector::arithRightShift(const BitVector& y) const
 {
-  Integer sign_bit = d_value.extractBitRange(1, d_size - 1);
-  if (y.d_value > Integer(d_size))
+  if (isWord() && y.isWord())
+  {
+    // a shift by at least d_size yields 0 or -1, depending on the sign bit
+    uint64_t amount = y.d_word >= d_size ? 63 : y.d_word;
+    return BitVector(d_size, static_cast<uint64_t>(signedWord() >> amount));
+  }
+  Integer amountValue = y.getValue();
+  Integer value = getValue();
+  Integer sign_bit = value.extractBitRange(1, d_size - 1);
+  if (amountValue > Integer(d_size))
   {
     if (sign_bit == Integer(0))
     {
@@ -334,16 +490,16 @@ BitVector BitVector::arithRightShift(const BitVector& y) const
     }
   }
 
-  if (y.d_value == 0)
+  if (amountValue == 0)
   {
     return *this;
   }
 
   // making sure we don't lose information casting
-  Assert(y.d_value < Integer(1).multiplyByPow2(32));
+  Assert(amountValue < Integer(1).multiplyByPow2(32));
 
-  uint32_t amount = y.d_value.toUnsignedInt();
-  Integer rest = d_value.divByPow2(amount);
+  uint32_t amount = amountValue.toUnsignedInt();
+  Integer rest = value.divByPow2(amount);
 
   if (sign_bit == Integer(0))
   {
@@ -18,6 +18,7 @@
 #ifndef CVC5__BITVECTOR_H
 #define CVC5__BITVECTOR_H
 
+#include <cstdint>
 #include <iosfwd>
 #include <iostream>
 
@@ -25,15 +26,33 @@
 
 namespace cvc5::internal {
 
+/**
+ * A bit-vector constant.
+ *
+ * Bit-vectors of width at most 64 store their value in a machine word, and
+ * all operations on them are done with machine arithmetic. Wider bit-vectors
+ * store their value in an Integer.
+ */
 class BitVector
 {
+  friend bool operator==(const BitVector& a, const BitVector& b);
+  friend bool operator<(const BitVector& a, const BitVector& b);
+  friend BitVector operator^(const BitVector& a, const BitVector& b);
+  friend BitVector operator|(const BitVector& a, const BitVector& b);
+  friend BitVector operator&(const BitVector& a, const BitVector& b);
+  friend BitVector operator~(const BitVector& a);
+  friend BitVector operator+(const BitVector& a, const BitVector& b);
+  friend BitVector operator-(const BitVector& a, const BitVector& b);
+  friend BitVector operator-(const BitVector& a);
+  friend BitVector operator*(const BitVector& a, const BitVector& b);
+
  public:
-  BitVector(unsigned size, const Integer& val)
-      : d_size(size), d_value(val.modByPow2(size))
+  BitVector(unsigned size, const Integer& val) : d_size(size), d_word(0)
   {
+    setValue(val);
   }
 
-  BitVector(unsigned size = 0) : d_size(size), d_value(0) {}
+  BitVector(unsigned size = 0) : d_size(size), d_word(0) {}
 
   /**
    * BitVector constructor using a 32-bit unsigned integer for the value.
@@ -42,9 +61,9 @@ class BitVector
    * platforms (long is 32-bit when compiling 64-bit binaries on
    * Windows but 64-bit on Linux) and to prevent ambiguous overloads.
    */
-  BitVector(unsigned size, uint32_t z) : d_size(size), d_value(z)
+  BitVector(unsigned size, uint32_t z)
+      : BitVector(size, static_cast<uint64_t>(z))
   {
-    d_value = d_value.modByPow2(size);
   }
 
   /**
@@ -54,14 +73,28 @@ class BitVector
    * platforms (long is 32-bit when compiling 64-bit binaries on
    * Windows but 64-bit on Linux) and to prevent ambiguous overloads.
    */
-  BitVector(unsigned size, uint64_t z) : d_size(size), d_value(z)
+  BitVector(unsigned size, uint64_t z) : d_size(size), d_word(0)
   {
-    d_value = d_value.modByPow2(size);
+    if (isWord())
+    {
+      d_word = z & mask(size);
+    }
+    else
+    {
+      d_value = Integer(z);
+    }
   }
 
-  BitVector(unsigned size, const BitVector& q)
-      : d_size(size), d_value(q.d_value)
+  BitVector(unsigned size, const BitVector& q) : d_size(size), d_word(0)
   {
+    if (isWord() && q.isWord())
+    {
+      d_word = q.d_word;
+    }
+    else
+    {
+      setValue(q.getValue());
+    }
   }
 
   /**
@@ -86,6 +119,7 @@ class BitVector
   {
     if (this == &x) return *this;
     d_size = x.d_size;
+    d_word = x.d_word;
     d_value = x.d_value;
     return *this;
   }
@@ -93,7 +127,7 @@ class BitVector
   /* Get size (bit-width). */
   unsigned getSize() const;
   /* Get value. */
-  const Integer& getValue() const;
+  Integer getValue() const;
 
   /* Return value. */
   Integer toInteger() const;
@@ -209,11 +243,26 @@ class BitVector
  private:
   /**
    * Class invariants:
-   *  - no overflows: 2^d_size < d_value
+   *  - no overflows: d_word < 2^d_size, d_value < 2^d_size
    *  - no negative numbers: d_value >= 0
+   *  - if d_size <= 64, the value is stored in d_word and d_value is zero,
+   *    otherwise it is stored in d_value and d_word is zero
    */
 
+  /** Whether the value is stored in d_word. */
+  bool isWord() const { return d_size <= 64; }
+  /** The word with the lowest size bits set, for size <= 64. */
+  static uint64_t mask(unsigned size)
+  {
+    return size >= 64 ? ~uint64_t(0) : (uint64_t(1) << size) - 1;
+  }
+  /** The word d_word, sign-extended from d_size bits to 64 bits. */
+  int64_t signedWord() const;
+  /** Set the value of this bit-vector to val modulo 2^d_size. */
+  void setValue(const Integer& val);
+
   unsigned d_size;
+  uint64_t d_word;
   Integer d_value;
 
 }; /* class BitVector */
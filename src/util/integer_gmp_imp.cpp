@@ -15,6 +15,7 @@
 
 #include <cmath>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -31,130 +32,261 @@ using namespace std;
 
 namespace cvc5::internal {
 
-Integer::Integer(const char* s, unsigned base)
-  : d_value(s, base)
-{}
+namespace {
 
-Integer::Integer(const std::string& s, unsigned base)
-  : d_value(s, base)
-{}
-
-#ifdef CVC5_NEED_INT64_T_OVERLOADS
-Integer::Integer(int64_t z) : d_value(construct_mpz(z)) {}
-Integer::Integer(uint64_t z) : d_value(construct_mpz(z)) {}
-#endif /* CVC5_NEED_INT64_T_OVERLOADS */
+/** Floor division of inline values, y must be non-zero. */
+void smallFloorQR(int64_t& q, int64_t& r, int64_t x, int64_t y)
+{
+  q = x / y;
+  r = x % y;
+  if (r != 0 && ((r < 0) != (y < 0)))
+  {
+    q -= 1;
+    r += y;
+  }
+}
 
-Integer& Integer::operator=(const Integer& x)
+/** Ceiling division of inline values, y must be non-zero. */
+void smallCeilingQR(int64_t& q, int64_t& r, int64_t x, int64_t y)
 {
-  if (this == &x) return *this;
-  d_value = x.d_value;
-  return *this;
+  q = x / y;
+  r = x % y;
+  if (r != 0 && ((r < 0) == (y < 0)))
+  {
+    q += 1;
+    r -= y;
+  }
 }
 
-bool Integer::operator==(const Integer& y) const
+}  // namespace
+
+Integer::Integer(const char* s, unsigned base) : d_small(0), d_big(nullptr)
 {
-  return d_value == y.d_value;
+  setMpz(mpz_class(s, base));
 }
 
-Integer Integer::operator-() const { return Integer(-(d_value)); }
+Integer::Integer(const std::string& s, unsigned base)
+    : d_small(0), d_big(nullptr)
+{
+  setMpz(mpz_class(s, base));
+}
 
-bool Integer::operator!=(const Integer& y) const
+#ifdef CVC5_NEED_INT64_T_OVERLOADS
+Integer::Integer(int64_t z) : d_small(z), d_big(nullptr)
 {
-  return d_value != y.d_value;
+  if (CVC5_PREDICT_FALSE(!fitsSmall(z)))
+  {
+    setLarge(z);
+  }
 }
+Integer::Integer(uint64_t z) : d_small(static_cast<int64_t>(z)), d_big(nullptr)
+{
+  if (CVC5_PREDICT_FALSE(!fitsSmall(z)))
+  {
+    setLarge(z);
+  }
+}
+#endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
-bool Integer::operator<(const Integer& y) const { return d_value < y.d_value; }
+void Integer::setLarge(int64_t v)
+{
+  setLarge(magnitude(v));
+  if (v < 0)
+  {
+    mpz_neg(d_big->get_mpz_t(), d_big->get_mpz_t());
+  }
+}
 
-bool Integer::operator<=(const Integer& y) const
+void Integer::setLarge(uint64_t v)
 {
-  return d_value <= y.d_value;
+  d_small = 0;
+  d_big = new mpz_class();
+  mpz_import(d_big->get_mpz_t(), 1, -1, sizeof(v), 0, 0, &v);
 }
 
-bool Integer::operator>(const Integer& y) const { return d_value > y.d_value; }
+void Integer::setMpz(mpz_srcptr v)
+{
+  if (fitsSmall(v))
+  {
+    d_small = smallFromMpz(v);
+    delete d_big;
+    d_big = nullptr;
+  }
+  else if (d_big == nullptr)
+  {
+    d_small = 0;
+    d_big = new mpz_class(v);
+  }
+  else
+  {
+    mpz_set(d_big->get_mpz_t(), v);
+  }
+}
 
-bool Integer::operator>=(const Integer& y) const
+void Integer::setMpz(mpz_class&& v)
 {
-  return d_value >= y.d_value;
+  if (fitsSmall(v.get_mpz_t()))
+  {
+    setMpz(v.get_mpz_t());
+  }
+  else if (d_big == nullptr)
+  {
+    d_small = 0;
+    d_big = new mpz_class(std::move(v));
+  }
+  else
+  {
+    d_big->swap(v);
+  }
 }
 
-Integer Integer::operator+(const Integer& y) const
+mpz_class Integer::get_mpz() const
 {
-  return Integer(d_value + y.d_value);
+  if (isSmall())
+  {
+    return mpz_class(MpzView(*this).get());
+  }
+  return *d_big;
 }
 
-Integer& Integer::operator+=(const Integer& y)
+Integer& Integer::operator=(const Integer& x)
 {
-  d_value += y.d_value;
+  if (this == &x) return *this;
+  if (x.isSmall())
+  {
+    delete d_big;
+    d_big = nullptr;
+    d_small = x.d_small;
+  }
+  else if (d_big == nullptr)
+  {
+    d_small = 0;
+    d_big = new mpz_class(*x.d_big);
+  }
+  else
+  {
+    *d_big = *x.d_big;
+  }
   return *this;
 }
 
-Integer Integer::operator-(const Integer& y) const
+int Integer::cmpSlow(const Integer& y) const
 {
-  return Integer(d_value - y.d_value);
+  // Since the representation is canonical, a value stored in GMP has a
+  // larger magnitude than any inline value.
+  if (isSmall())
+  {
+    return y.isSmall() ? (d_small > y.d_small) - (d_small < y.d_small)
+                       : -mpz_sgn(y.d_big->get_mpz_t());
+  }
+  if (y.isSmall())
+  {
+    return mpz_sgn(d_big->get_mpz_t());
+  }
+  return mpz_cmp(d_big->get_mpz_t(), y.d_big->get_mpz_t());
 }
 
-Integer& Integer::operator-=(const Integer& y)
+Integer Integer::negSlow() const
 {
-  d_value -= y.d_value;
-  return *this;
+  mpz_class result;
+  mpz_neg(result.get_mpz_t(), MpzView(*this).get());
+  return Integer(std::move(result));
 }
 
-Integer Integer::operator*(const Integer& y) const
+Integer Integer::addSlow(const Integer& y) const
 {
-  return Integer(d_value * y.d_value);
+  mpz_class result;
+  mpz_add(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
-Integer& Integer::operator*=(const Integer& y)
+Integer Integer::subSlow(const Integer& y) const
 {
-  d_value *= y.d_value;
-  return *this;
+  mpz_class result;
+  mpz_sub(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
+}
+
+Integer Integer::mulSlow(const Integer& y) const
+{
+  mpz_class result;
+  mpz_mul(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::bitwiseOr(const Integer& y) const
 {
+  if (isSmall() && y.isSmall())
+  {
+    return fromSmall(d_small | y.d_small);
+  }
   mpz_class result;
-  mpz_ior(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(result);
+  mpz_ior(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::bitwiseAnd(const Integer& y) const
 {
+  if (isSmall() && y.isSmall())
+  {
+    return fromSmall(d_small & y.d_small);
+  }
   mpz_class result;
-  mpz_and(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(result);
+  mpz_and(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::bitwiseXor(const Integer& y) const
 {
+  if (isSmall() && y.isSmall())
+  {
+    return fromSmall(d_small ^ y.d_small);
+  }
   mpz_class result;
-  mpz_xor(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(result);
+  mpz_xor(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::bitwiseNot() const
 {
+  if (isSmall())
+  {
+    return fromSmall(~d_small);
+  }
   mpz_class result;
-  mpz_com(result.get_mpz_t(), d_value.get_mpz_t());
-  return Integer(result);
+  mpz_com(result.get_mpz_t(), d_big->get_mpz_t());
+  return Integer(std::move(result));
 }
 
 Integer Integer::multiplyByPow2(uint32_t pow) const
 {
   mpz_class result;
-  mpz_mul_2exp(result.get_mpz_t(), d_value.get_mpz_t(), pow);
-  return Integer(result);
+  mpz_mul_2exp(result.get_mpz_t(), MpzView(*this).get(), pow);
+  return Integer(std::move(result));
 }
 
 void Integer::setBit(uint32_t i, bool value)
 {
+  if (isSmall() && i < 63)
+  {
+    int64_t res = value ? (d_small | (int64_t(1) << i))
+                        : (d_small & ~(int64_t(1) << i));
+    if (fitsSmall(res))
+    {
+      d_small = res;
+      return;
+    }
+  }
+  mpz_class result = get_mpz();
   if (value)
   {
-    mpz_setbit(d_value.get_mpz_t(), i);
+    mpz_setbit(result.get_mpz_t(), i);
   }
   else
   {
-    mpz_clrbit(d_value.get_mpz_t(), i);
+    mpz_clrbit(result.get_mpz_t(), i);
   }
+  setMpz(std::move(result));
 }
 
 bool Integer::isBitSet(uint32_t i) const
@@ -166,45 +298,62 @@ Integer Integer::oneExtend(uint32_t size, uint32_t amount) const
 {
   // check that the size is accurate
   Assert((*this) < Integer(1).multiplyByPow2(size));
-  mpz_class res = d_value;
+  mpz_class res = get_mpz();
 
   for (unsigned i = size; i < size + amount; ++i)
   {
     mpz_setbit(res.get_mpz_t(), i);
   }
 
-  return Integer(res);
+  return Integer(std::move(res));
 }
 
 uint32_t Integer::toUnsignedInt() const
 {
-  return mpz_get_ui(d_value.get_mpz_t());
+  return mpz_get_ui(MpzView(*this).get());
 }
 
 Integer Integer::extractBitRange(uint32_t bitCount, uint32_t low) const
 {
   // bitCount = high-low+1
   uint32_t high = low + bitCount - 1;
+  if (isSmall() && d_small >= 0 && high < 63)
+  {
+    uint64_t mask = (uint64_t(1) << bitCount) - 1;
+    return fromSmall(static_cast<int64_t>((d_small >> low) & mask));
+  }
   //- Function: void mpz_fdiv_r_2exp (mpz_t r, mpz_t n, mp_bitcnt_t b)
   mpz_class rem, div;
-  mpz_fdiv_r_2exp(rem.get_mpz_t(), d_value.get_mpz_t(), high + 1);
+  mpz_fdiv_r_2exp(rem.get_mpz_t(), MpzView(*this).get(), high + 1);
   mpz_fdiv_q_2exp(div.get_mpz_t(), rem.get_mpz_t(), low);
 
-  return Integer(div);
+  return Integer(std::move(div));
 }
 
 Integer Integer::floorDivideQuotient(const Integer& y) const
 {
+  if (isSmall() && y.isSmall() && y.d_small != 0)
+  {
+    int64_t q, r;
+    smallFloorQR(q, r, d_small, y.d_small);
+    return fromSmall(q);
+  }
   mpz_class q;
-  mpz_fdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(q);
+  mpz_fdiv_q(q.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(q));
 }
 
 Integer Integer::floorDivideRemainder(const Integer& y) const
 {
+  if (isSmall() && y.isSmall() && y.d_small != 0)
+  {
+    int64_t q, r;
+    smallFloorQR(q, r, d_small, y.d_small);
+    return fromSmall(r);
+  }
   mpz_class r;
-  mpz_fdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(r);
+  mpz_fdiv_r(r.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(r));
 }
 
 void Integer::floorQR(Integer& q,
@@ -212,24 +361,47 @@ void Integer::floorQR(Integer& q,
                       const Integer& x,
                       const Integer& y)
 {
-  mpz_fdiv_qr(q.d_value.get_mpz_t(),
-              r.d_value.get_mpz_t(),
-              x.d_value.get_mpz_t(),
-              y.d_value.get_mpz_t());
+  if (x.isSmall() && y.isSmall() && y.d_small != 0)
+  {
+    int64_t qs, rs;
+    smallFloorQR(qs, rs, x.d_small, y.d_small);
+    q = fromSmall(qs);
+    r = fromSmall(rs);
+    return;
+  }
+  mpz_class qq, rr;
+  mpz_fdiv_qr(qq.get_mpz_t(),
+              rr.get_mpz_t(),
+              MpzView(x).get(),
+              MpzView(y).get());
+  q.setMpz(std::move(qq));
+  r.setMpz(std::move(rr));
 }
 
 Integer Integer::ceilingDivideQuotient(const Integer& y) const
 {
+  if (isSmall() && y.isSmall() && y.d_small != 0)
+  {
+    int64_t q, r;
+    smallCeilingQR(q, r, d_small, y.d_small);
+    return fromSmall(q);
+  }
   mpz_class q;
-  mpz_cdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(q);
+  mpz_cdiv_q(q.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(q));
 }
 
 Integer Integer::ceilingDivideRemainder(const Integer& y) const
 {
+  if (isSmall() && y.isSmall() && y.d_small != 0)
+  {
+    int64_t q, r;
+    smallCeilingQR(q, r, d_small, y.d_small);
+    return fromSmall(r);
+  }
   mpz_class r;
-  mpz_cdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(r);
+  mpz_cdiv_r(r.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(r));
 }
 
 void Integer::euclidianQR(Integer& q,
@@ -283,223 +455,234 @@ Integer Integer::euclidianDivideRemainder(const Integer& y) const
 Integer Integer::exactQuotient(const Integer& y) const
 {
   Assert(y.divides(*this));
+  if (isSmall() && y.isSmall())
+  {
+    return fromSmall(d_small / y.d_small);
+  }
   mpz_class q;
-  mpz_divexact(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(q);
+  mpz_divexact(q.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(q));
 }
 
 Integer Integer::modByPow2(uint32_t exp) const
 {
   mpz_class res;
-  mpz_fdiv_r_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
-  return Integer(res);
+  mpz_fdiv_r_2exp(res.get_mpz_t(), MpzView(*this).get(), exp);
+  return Integer(std::move(res));
 }
 
 Integer Integer::divByPow2(uint32_t exp) const
 {
   mpz_class res;
-  mpz_fdiv_q_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
-  return Integer(res);
-}
-
-int Integer::sgn() const { return mpz_sgn(d_value.get_mpz_t()); }
-
-bool Integer::strictlyPositive() const { return sgn() > 0; }
-
-bool Integer::strictlyNegative() const { return sgn() < 0; }
-
-bool Integer::isZero() const { return sgn() == 0; }
-
-bool Integer::isOne() const { return mpz_cmp_si(d_value.get_mpz_t(), 1) == 0; }
-
-bool Integer::isNegativeOne() const
-{
-  return mpz_cmp_si(d_value.get_mpz_t(), -1) == 0;
+  mpz_fdiv_q_2exp(res.get_mpz_t(), MpzView(*this).get(), exp);
+  return Integer(std::move(res));
 }
 
 Integer Integer::pow(uint32_t exp) const
 {
   mpz_class result;
-  mpz_pow_ui(result.get_mpz_t(), d_value.get_mpz_t(), exp);
-  return Integer(result);
+  mpz_pow_ui(result.get_mpz_t(), MpzView(*this).get(), exp);
+  return Integer(std::move(result));
 }
 
 Integer Integer::gcd(const Integer& y) const
 {
+  if (isSmall() && y.isSmall())
+  {
+    uint64_t g = std::gcd(magnitude(d_small), magnitude(y.d_small));
+    return fromSmall(static_cast<int64_t>(g));
+  }
   mpz_class result;
-  mpz_gcd(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(result);
+  mpz_gcd(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::lcm(const Integer& y) const
 {
+  if (isSmall() && y.isSmall())
+  {
+    if (d_small == 0 || y.d_small == 0)
+    {
+      return Integer();
+    }
+    uint64_t a = magnitude(d_small);
+    uint64_t b = magnitude(y.d_small);
+    uint64_t res;
+    if (!__builtin_mul_overflow(a / std::gcd(a, b), b, &res) && fitsSmall(res))
+    {
+      return fromSmall(static_cast<int64_t>(res));
+    }
+  }
   mpz_class result;
-  mpz_lcm(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(result);
+  mpz_lcm(result.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  return Integer(std::move(result));
 }
 
 Integer Integer::modAdd(const Integer& y, const Integer& m) const
 {
   mpz_class res;
-  mpz_add(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
-  return Integer(res);
+  mpz_add(res.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), MpzView(m).get());
+  return Integer(std::move(res));
 }
 
 Integer Integer::modMultiply(const Integer& y, const Integer& m) const
 {
   mpz_class res;
-  mpz_mul(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
-  return Integer(res);
+  mpz_mul(res.get_mpz_t(), MpzView(*this).get(), MpzView(y).get());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), MpzView(m).get());
+  return Integer(std::move(res));
 }
 
 Integer Integer::modInverse(const Integer& m) const
 {
   Assert(m > 0) << "m must be greater than zero";
   mpz_class res;
-  if (mpz_invert(res.get_mpz_t(), d_value.get_mpz_t(), m.d_value.get_mpz_t())
+  if (mpz_invert(res.get_mpz_t(), MpzView(*this).get(), MpzView(m).get())
       == 0)
   {
     return Integer(-1);
   }
-  return Integer(res);
+  return Integer(std::move(res));
 }
 
 bool Integer::divides(const Integer& y) const
 {
-  int res = mpz_divisible_p(y.d_value.get_mpz_t(), d_value.get_mpz_t());
+  if (isSmall() && y.isSmall())
+  {
+    return d_small == 0 ? y.d_small == 0 : y.d_small % d_small == 0;
+  }
+  int res = mpz_divisible_p(MpzView(y).get(), MpzView(*this).get());
   return res != 0;
 }
 
-Integer Integer::abs() const { return d_value >= 0 ? *this : -*this; }
-
-std::string Integer::toString(int base) const { return d_value.get_str(base); }
+std::string Integer::toString(int base) const
+{
+  if (isSmall() && base == 10)
+  {
+    return std::to_string(d_small);
+  }
+  return get_mpz().get_str(base);
+}
 
-bool Integer::fitsSignedInt() const { return d_value.fits_sint_p(); }
+bool Integer::fitsSignedInt() const
+{
+  return isSmall() && d_small >= std::numeric_limits<int>::min()
+         && d_small <= std::numeric_limits<int>::max();
+}
 
-bool Integer::fitsUnsignedInt() const { return d_value.fits_uint_p(); }
+bool Integer::fitsUnsignedInt() const
+{
+  return isSmall() && d_small >= 0
+         && d_small <= std::numeric_limits<unsigned int>::max();
+}
 
 signed int Integer::getSignedInt() const
 {
   // ensure there isn't overflow
-  Assert(d_value <= std::numeric_limits<int>::max())
-      << "Overflow detected in Integer::getSignedInt().";
-  Assert(d_value >= std::numeric_limits<int>::min())
-      << "Overflow detected in Integer::getSignedInt().";
   Assert(fitsSignedInt()) << "Overflow detected in Integer::getSignedInt().";
-  return (signed int)d_value.get_si();
+  return static_cast<signed int>(d_small);
 }
 
 unsigned int Integer::getUnsignedInt() const
 {
   // ensure there isn't overflow
-  Assert(d_value <= std::numeric_limits<unsigned int>::max())
-      << "Overflow detected in Integer::getUnsignedInt()";
-  Assert(d_value >= std::numeric_limits<unsigned int>::min())
-      << "Overflow detected in Integer::getUnsignedInt()";
   Assert(fitsUnsignedInt()) << "Overflow detected in Integer::getUnsignedInt()";
-  return (unsigned int)d_value.get_ui();
+  return static_cast<unsigned int>(d_small);
 }
 
 long Integer::getLong() const
 {
+  if (isSmall() && d_small >= std::numeric_limits<long>::min()
+      && d_small <= std::numeric_limits<long>::max())
+  {
+    return static_cast<long>(d_small);
+  }
   // ensure there it fits
-  Assert(mpz_fits_slong_p(d_value.get_mpz_t()) != 0)
+  Assert(mpz_fits_slong_p(MpzView(*this).get()) != 0)
       << "Overflow detected in Integer::getLong().";
-  return d_value.get_si();
+  return mpz_get_si(MpzView(*this).get());
 }
 
 unsigned long Integer::getUnsignedLong() const
 {
+  if (isSmall() && d_small >= 0
+      && static_cast<uint64_t>(d_small)
+             <= std::numeric_limits<unsigned long>::max())
+  {
+    return static_cast<unsigned long>(d_small);
+  }
   // ensure that it fits
-  Assert(mpz_fits_ulong_p(d_value.get_mpz_t()) != 0)
+  Assert(mpz_fits_ulong_p(MpzView(*this).get()) != 0)
       << "Overflow detected in Integer::getUnsignedLong().";
-  return d_value.get_ui();
+  return mpz_get_ui(MpzView(*this).get());
 }
 
 int64_t Integer::getSigned64() const
 {
-  if constexpr (sizeof(int64_t) == sizeof(signed long int))
+  if (isSmall())
   {
-    return getLong();
+    return d_small;
   }
-  else
-  {
-    if (mpz_fits_slong_p(d_value.get_mpz_t()) != 0)
-    {
-      return getLong();
-    }
-    try
-    {
-      return std::stoll(toString());
-    }
-    catch (const std::exception& e)
-    {
-      Assert(false) << "Overflow detected in Integer::getSigned64().";
-    }
-  }
-  return 0;
+  // the only value stored in GMP that fits is -2^63
+  Assert(*this == Integer(std::numeric_limits<int64_t>::min()))
+      << "Overflow detected in Integer::getSigned64().";
+  return std::numeric_limits<int64_t>::min();
 }
+
 uint64_t Integer::getUnsigned64() const
 {
-  if constexpr (sizeof(uint64_t) == sizeof(unsigned long int))
+  if (isSmall())
   {
-    return getUnsignedLong();
-  }
-  else
-  {
-    if (mpz_fits_ulong_p(d_value.get_mpz_t()) != 0)
-    {
-      return getUnsignedLong();
-    }
-    try
-    {
-      Assert(sgn() >= 0) << "Overflow detected in Integer::getUnsigned64().";
-      return std::stoull(toString());
-    }
-    catch (const std::exception& e)
-    {
-      Assert(false) << "Overflow detected in Integer::getUnsigned64().";
-    }
+    Assert(d_small >= 0) << "Overflow detected in Integer::getUnsigned64().";
+    return static_cast<uint64_t>(d_small);
   }
-  return 0;
+  Assert(sgn() > 0 && mpz_sizeinbase(d_big->get_mpz_t(), 2) <= 64)
+      << "Overflow detected in Integer::getUnsigned64().";
+  uint64_t res = 0;
+  mpz_export(&res, nullptr, -1, sizeof(res), 0, 0, d_big->get_mpz_t());
+  return res;
 }
 
-size_t Integer::hash() const { return gmpz_hash(d_value.get_mpz_t()); }
-
 bool Integer::testBit(unsigned n) const
 {
-  return mpz_tstbit(d_value.get_mpz_t(), n);
+  if (isSmall())
+  {
+    // two's complement semantics, as mpz_tstbit
+    return n < 63 ? ((d_small >> n) & 1) != 0 : d_small < 0;
+  }
+  return mpz_tstbit(d_big->get_mpz_t(), n);
 }
 
 unsigned Integer::isPow2() const
 {
-  if (d_value <= 0) return 0;
+  if (sgn() <= 0) return 0;
+  if (isSmall())
+  {
+    uint64_t v = static_cast<uint64_t>(d_small);
+    return (v & (v - 1)) == 0 ? __builtin_ctzll(v) + 1 : 0;
+  }
   // check that the number of ones in the binary representation is 1
-  if (mpz_popcount(d_value.get_mpz_t()) == 1)
+  if (mpz_popcount(d_big->get_mpz_t()) == 1)
   {
     // return the index of the first one plus 1
-    return mpz_scan1(d_value.get_mpz_t(), 0) + 1;
+    return mpz_scan1(d_big->get_mpz_t(), 0) + 1;
   }
   return 0;
 }
 
 size_t Integer::length() const
 {
-  if (sgn() == 0)
-  {
-    return 1;
-  }
-  else
+  if (isSmall())
   {
-    return mpz_sizeinbase(d_value.get_mpz_t(), 2);
+    return d_small == 0 ? 1 : 64 - __builtin_clzll(magnitude(d_small));
   }
+  return mpz_sizeinbase(d_big->get_mpz_t(), 2);
 }
 
 bool Integer::isProbablePrime() const
 {
-  return mpz_probab_prime_p(d_value.get_mpz_t(), 30) > 0;
+  return mpz_probab_prime_p(MpzView(*this).get(), 30) > 0;
 }
 
 void Integer::extendedGcd(
@@ -507,11 +690,15 @@ void Integer::extendedGcd(
 {
   // see the documentation for:
   // mpz_gcdext (mpz_t g, mpz_t s, mpz_t t, mpz_t a, mpz_t b);
-  mpz_gcdext(g.d_value.get_mpz_t(),
-             s.d_value.get_mpz_t(),
-             t.d_value.get_mpz_t(),
-             a.d_value.get_mpz_t(),
-             b.d_value.get_mpz_t());
+  mpz_class gg, ss, tt;
+  mpz_gcdext(gg.get_mpz_t(),
+             ss.get_mpz_t(),
+             tt.get_mpz_t(),
+             MpzView(a).get(),
+             MpzView(b).get());
+  g.setMpz(std::move(gg));
+  s.setMpz(std::move(ss));
+  t.setMpz(std::move(tt));
 }
 
 const Integer& Integer::min(const Integer& a, const Integer& b)
@@ -20,13 +20,28 @@
 
 #include <gmpxx.h>
 
+#include <cstdint>
 #include <iosfwd>
+#include <limits>
 #include <string>
+#include <utility>
+
+#include "util/gmp_util.h"
 
 namespace cvc5::internal {
 
 class Rational;
 
+/**
+ * A multiprecision integer constant.
+ *
+ * Values that fit into a (symmetric) 64 bit machine word, i.e., values in
+ * [-(2^63 - 1), 2^63 - 1], are stored inline and most operations on them are
+ * done with overflow-checked machine arithmetic. Only values outside of this
+ * range are stored in a (heap allocated) GMP integer. The representation is
+ * canonical: a value is stored in GMP if and only if it does not fit into a
+ * machine word.
+ */
 class Integer
 {
   friend class cvc5::internal::Rational;
@@ -35,10 +50,17 @@ class Integer
   /**
    * Constructs an Integer by copying a GMP C++ primitive.
    */
-  Integer(const mpz_class& val) : d_value(val) {}
+  Integer(const mpz_class& val) : d_small(0), d_big(nullptr)
+  {
+    setMpz(val.get_mpz_t());
+  }
+  Integer(mpz_class&& val) : d_small(0), d_big(nullptr)
+  {
+    setMpz(std::move(val));
+  }
 
   /** Constructs a rational with the value 0. */
-  Integer() : d_value(0) {}
+  Integer() : d_small(0), d_big(nullptr) {}
 
   /**
    * Constructs a Integer from a C string.
@@ -49,12 +71,34 @@ class Integer
   explicit Integer(const char* s, unsigned base = 10);
   explicit Integer(const std::string& s, unsigned base = 10);
 
-  Integer(const Integer& q) : d_value(q.d_value) {}
-
-  Integer(signed int z) : d_value(z) {}
-  Integer(unsigned int z) : d_value(z) {}
-  Integer(signed long int z) : d_value(z) {}
-  Integer(unsigned long int z) : d_value(z) {}
+  Integer(const Integer& q)
+      : d_small(q.d_small),
+        d_big(q.d_big == nullptr ? nullptr : new mpz_class(*q.d_big))
+  {
+  }
+  Integer(Integer&& q) noexcept : d_small(q.d_small), d_big(q.d_big)
+  {
+    q.d_small = 0;
+    q.d_big = nullptr;
+  }
+
+  Integer(signed int z) : d_small(z), d_big(nullptr) {}
+  Integer(unsigned int z) : d_small(z), d_big(nullptr) {}
+  Integer(signed long int z) : d_small(z), d_big(nullptr)
+  {
+    if (CVC5_PREDICT_FALSE(!fitsSmall(static_cast<int64_t>(z))))
+    {
+      setLarge(static_cast<int64_t>(z));
+    }
+  }
+  Integer(unsigned long int z)
+      : d_small(static_cast<int64_t>(z)), d_big(nullptr)
+  {
+    if (CVC5_PREDICT_FALSE(!fitsSmall(static_cast<uint64_t>(z))))
+    {
+      setLarge(static_cast<uint64_t>(z));
+    }
+  }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   Integer(int64_t z);
@@ -62,41 +106,133 @@ class Integer
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
   /** Destructor. */
-  ~Integer() {}
+  ~Integer() { delete d_big; }
 
-  /** Returns a copy of d_value to enable public access of GMP data. */
-  const mpz_class& getValue() const { return d_value; }
+  /** Returns a copy of the value to enable public access of GMP data. */
+  mpz_class getValue() const { return get_mpz(); }
 
   /** Overload copy assignment operator. */
   Integer& operator=(const Integer& x);
+  /** Overload move assignment operator. */
+  Integer& operator=(Integer&& x) noexcept
+  {
+    std::swap(d_small, x.d_small);
+    std::swap(d_big, x.d_big);
+    return *this;
+  }
 
   /** Overload equality comparison operator. */
-  bool operator==(const Integer& y) const;
+  bool operator==(const Integer& y) const
+  {
+    if (isSmall() && y.isSmall())
+    {
+      return d_small == y.d_small;
+    }
+    return cmpSlow(y) == 0;
+  }
   /** Overload disequality comparison operator. */
-  bool operator!=(const Integer& y) const;
+  bool operator!=(const Integer& y) const { return !(*this == y); }
   /** Overload less than comparison operator. */
-  bool operator<(const Integer& y) const;
+  bool operator<(const Integer& y) const
+  {
+    if (isSmall() && y.isSmall())
+    {
+      return d_small < y.d_small;
+    }
+    return cmpSlow(y) < 0;
+  }
   /** Overload less than or equal comparison operator. */
-  bool operator<=(const Integer& y) const;
+  bool operator<=(const Integer& y) const
+  {
+    if (isSmall() && y.isSmall())
+    {
+      return d_small <= y.d_small;
+    }
+    return cmpSlow(y) <= 0;
+  }
   /** Overload greater than comparison operator. */
-  bool operator>(const Integer& y) const;
+  bool operator>(const Integer& y) const { return y < *this; }
   /** Overload greater than or equal comparison operator. */
-  bool operator>=(const Integer& y) const;
+  bool operator>=(const Integer& y) const { return y <= *this; }
 
   /** Overload negation operator. */
-  Integer operator-() const;
+  Integer operator-() const
+  {
+    if (isSmall())
+    {
+      return fromSmall(-d_small);
+    }
+    return negSlow();
+  }
   /** Overload addition operator. */
-  Integer operator+(const Integer& y) const;
+  Integer operator+(const Integer& y) const
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_add_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      return fromSmall(res);
+    }
+    return addSlow(y);
+  }
   /** Overload addition assignment operator. */
-  Integer& operator+=(const Integer& y);
+  Integer& operator+=(const Integer& y)
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_add_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      d_small = res;
+      return *this;
+    }
+    return *this = addSlow(y);
+  }
   /** Overload subtraction operator. */
-  Integer operator-(const Integer& y) const;
+  Integer operator-(const Integer& y) const
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_sub_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      return fromSmall(res);
+    }
+    return subSlow(y);
+  }
   /** Overload subtraction assignment operator. */
-  Integer& operator-=(const Integer& y);
+  Integer& operator-=(const Integer& y)
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_sub_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      d_small = res;
+      return *this;
+    }
+    return *this = subSlow(y);
+  }
   /** Overload multiplication operator. */
-  Integer operator*(const Integer& y) const;
+  Integer operator*(const Integer& y) const
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_mul_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      return fromSmall(res);
+    }
+    return mulSlow(y);
+  }
   /** Overload multiplication assignment operator. */
-  Integer& operator*=(const Integer& y);
+  Integer& operator*=(const Integer& y)
+  {
+    int64_t res;
+    if (isSmall() && y.isSmall()
+        && !__builtin_mul_overflow(d_small, y.d_small, &res) && fitsSmall(res))
+    {
+      d_small = res;
+      return *this;
+    }
+    return *this = mulSlow(y);
+  }
 
   /** Return the bit-wise or of this and the given Integer. */
   Integer bitwiseOr(const Integer& y) const;
@@ -185,22 +321,29 @@ class Integer
   Integer divByPow2(uint32_t exp) const;
 
   /** Return 1 if this is > 0, 0 if it is 0, and -1 if it is < 0. */
-  int sgn() const;
+  int sgn() const
+  {
+    if (isSmall())
+    {
+      return (d_small > 0) - (d_small < 0);
+    }
+    return mpz_sgn(d_big->get_mpz_t());
+  }
 
   /** Return true if this is > 0. */
-  bool strictlyPositive() const;
+  bool strictlyPositive() const { return sgn() > 0; }
 
   /** Return true if this is < 0. */
-  bool strictlyNegative() const;
+  bool strictlyNegative() const { return sgn() < 0; }
 
   /** Return true if this is 0. */
-  bool isZero() const;
+  bool isZero() const { return isSmall() && d_small == 0; }
 
   /** Return true if this is 1. */
-  bool isOne() const;
+  bool isOne() const { return isSmall() && d_small == 1; }
 
   /** Return true if this is -1. */
-  bool isNegativeOne() const;
+  bool isNegativeOne() const { return isSmall() && d_small == -1; }
 
   /** Raise this Integer to the power 'exp'. */
   Integer pow(uint32_t exp) const;
@@ -238,7 +381,7 @@ class Integer
   bool divides(const Integer& y) const;
 
   /** Return the absolute value of this integer.  */
-  Integer abs() const;
+  Integer abs() const { return sgn() >= 0 ? *this : -*this; }
 
   /** Return a string representation of this Integer. */
   std::string toString(int base = 10) const;
@@ -271,7 +414,14 @@ class Integer
    * Computes the hash of the node from the first word of the
    * numerator, the denominator.
    */
-  size_t hash() const;
+  size_t hash() const
+  {
+    if (isSmall())
+    {
+      return smallHash(d_small);
+    }
+    return gmpz_hash(d_big->get_mpz_t());
+  }
 
   /**
    * Returns true iff bit n is set.
@@ -320,16 +470,145 @@ class Integer
 
  private:
   /**
-   * Gets a reference to the gmp data that backs up the integer.
-   * Only accessible to friend classes.
+   * A read-only view of the value of an Integer as a GMP integer, which does
+   * not allocate if the Integer is stored inline. The view must not outlive
+   * the Integer it was created from.
    */
-  const mpz_class& get_mpz() const { return d_value; }
+  class MpzView
+  {
+   public:
+    MpzView(const Integer& i)
+    {
+      if (i.isSmall())
+      {
+        d_ptr = roinitSmall(d_tmp, d_limbs, i.d_small);
+      }
+      else
+      {
+        d_ptr = i.d_big->get_mpz_t();
+      }
+    }
+    MpzView(const MpzView&) = delete;
+    MpzView& operator=(const MpzView&) = delete;
+    /** Get the GMP integer */
+    mpz_srcptr get() const { return d_ptr; }
+
+   private:
+    /** The limbs of an inline value */
+    mp_limb_t d_limbs[64 / GMP_NUMB_BITS + 1];
+    /** The read-only GMP integer over d_limbs */
+    mpz_t d_tmp;
+    /** The viewed GMP integer */
+    mpz_srcptr d_ptr;
+  };
 
   /**
-   * The value of the rational is stored in a C++ GMP integer class.
-   * Using this instead of mpz_t allows for easier destruction.
+   * Initialize x as a read-only GMP integer with the inline value v, using
+   * limbs (of size at least 64 / GMP_NUMB_BITS + 1) as the storage of x.
    */
-  mpz_class d_value;
+  static mpz_srcptr roinitSmall(mpz_ptr x, mp_limb_t* limbs, int64_t v)
+  {
+    uint64_t mag = magnitude(v);
+    mp_size_t n = 0;
+    while (mag != 0)
+    {
+      limbs[n++] = static_cast<mp_limb_t>(mag);
+      if constexpr (GMP_NUMB_BITS >= 64)
+      {
+        mag = 0;
+      }
+      else
+      {
+        mag >>= GMP_NUMB_BITS % 64;
+      }
+    }
+    return mpz_roinit_n(x, limbs, v < 0 ? -n : n);
+  }
+  /** Whether the GMP integer v is in the range of inline values */
+  static bool fitsSmall(mpz_srcptr v) { return mpz_sizeinbase(v, 2) <= 63; }
+  /** The value of the GMP integer v, which must satisfy fitsSmall(v) */
+  static int64_t smallFromMpz(mpz_srcptr v)
+  {
+    if constexpr (sizeof(signed long int) >= sizeof(int64_t))
+    {
+      return mpz_get_si(v);
+    }
+    else
+    {
+      uint64_t mag = 0;
+      mpz_export(&mag, nullptr, -1, sizeof(mag), 0, 0, v);
+      return mpz_sgn(v) < 0 ? -static_cast<int64_t>(mag)
+                            : static_cast<int64_t>(mag);
+    }
+  }
+
+  /** Whether v is in the range of values that are stored inline */
+  static bool fitsSmall(int64_t v)
+  {
+    return v != std::numeric_limits<int64_t>::min();
+  }
+  static bool fitsSmall(uint64_t v)
+  {
+    return v <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  }
+  /** The absolute value of an inline value */
+  static uint64_t magnitude(int64_t v)
+  {
+    return v < 0 ? -static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+  }
+  /** The hash of an inline value, which agrees with gmpz_hash */
+  static size_t smallHash(int64_t v)
+  {
+    uint64_t mag = magnitude(v);
+    if constexpr (GMP_NUMB_BITS >= 64)
+    {
+      return mag;
+    }
+    else
+    {
+      size_t hash = 0;
+      while (mag != 0)
+      {
+        hash = (hash * 2) ^ static_cast<mp_limb_t>(mag);
+        mag >>= GMP_NUMB_BITS % 64;
+      }
+      return hash;
+    }
+  }
+  /** An Integer with the inline value v, which must satisfy fitsSmall(v) */
+  static Integer fromSmall(int64_t v)
+  {
+    Integer res;
+    res.d_small = v;
+    return res;
+  }
+  /** Whether the value is stored inline */
+  bool isSmall() const { return d_big == nullptr; }
+
+  /** Set the value to v, which does not fit into an inline value. */
+  void setLarge(int64_t v);
+  void setLarge(uint64_t v);
+  /** Set the value to v. */
+  void setMpz(mpz_srcptr v);
+  void setMpz(mpz_class&& v);
+
+  /** The slow paths of the arithmetic and comparison operators. */
+  int cmpSlow(const Integer& y) const;
+  Integer negSlow() const;
+  Integer addSlow(const Integer& y) const;
+  Integer subSlow(const Integer& y) const;
+  Integer mulSlow(const Integer& y) const;
+
+  /**
+   * Gets a copy of the value as a GMP integer.
+   * Only accessible to friend classes.
+   */
+  mpz_class get_mpz() const;
+
+  /** The value, if d_big is null, and zero otherwise. */
+  int64_t d_small;
+  /** The value, if it does not fit into d_small, and null otherwise. */
+  mpz_class* d_big;
 }; /* class Integer */
 
 struct IntegerHashFunction
@@ -245,6 +245,18 @@ class Rational
     return (*this);
   }
 
+  /**
+   * Sets this rational to this + a * b.
+   *
+   * @return True if the result was computed with machine arithmetic, which
+   * is never the case for this implementation.
+   */
+  bool addProduct(const Rational& a, const Rational& b)
+  {
+    d_value += a.d_value * b.d_value;
+    return false;
+  }
+
   Rational& operator*=(const Rational& y)
   {
     d_value *= y.d_value;
@@ -13,6 +13,8 @@
  * A multi-precision rational constant.
  */
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -27,6 +29,328 @@
 
 namespace cvc5::internal {
 
+namespace {
+
+/**
+ * Computes n/d = a/b + c/e for canonical inline values a/b and c/e, following
+ * Knuth, TAOCP Vol. 2, Section 4.5.1. Returns false if this overflows.
+ */
+bool addSmall(
+    int64_t a, int64_t b, int64_t c, int64_t e, int64_t& n, int64_t& d)
+{
+  int64_t g = std::gcd(b, e);
+  int64_t x, y, t;
+  if (__builtin_mul_overflow(a, e / g, &x)
+      || __builtin_mul_overflow(c, b / g, &y)
+      || __builtin_add_overflow(x, y, &t)
+      || t == std::numeric_limits<int64_t>::min())
+  {
+    return false;
+  }
+  // if gcd(b, e) = 1, then t/(b*e) is already canonical
+  int64_t g2 = g == 1 ? 1 : std::gcd(t, g);
+  n = t / g2;
+  return !__builtin_mul_overflow(b / g, e / g2, &d)
+         && d != std::numeric_limits<int64_t>::min();
+}
+
+/**
+ * Computes n/d = (a/b) * (c/e) for canonical inline values a/b and c/e.
+ * Returns false if this overflows.
+ */
+bool mulSmall(
+    int64_t a, int64_t b, int64_t c, int64_t e, int64_t& n, int64_t& d)
+{
+  int64_t g1 = std::gcd(a, e);
+  int64_t g2 = std::gcd(c, b);
+  return !__builtin_mul_overflow(a / g1, c / g2, &n)
+         && n != std::numeric_limits<int64_t>::min()
+         && !__builtin_mul_overflow(b / g2, e / g1, &d)
+         && d != std::numeric_limits<int64_t>::min();
+}
+
+}  // namespace
+
+class Rational::MpqView
+{
+ public:
+  MpqView(const Rational& q)
+  {
+    if (q.isSmall())
+    {
+      Integer::roinitSmall(mpq_numref(d_tmp), d_numLimbs, q.d_num);
+      Integer::roinitSmall(mpq_denref(d_tmp), d_denLimbs, q.d_den);
+      d_ptr = d_tmp;
+    }
+    else
+    {
+      d_ptr = q.d_big->get_mpq_t();
+    }
+  }
+  MpqView(const MpqView&) = delete;
+  MpqView& operator=(const MpqView&) = delete;
+  /** Get the GMP rational */
+  mpq_srcptr get() const { return d_ptr; }
+
+ private:
+  /** The limbs of an inline numerator and denominator */
+  mp_limb_t d_numLimbs[64 / GMP_NUMB_BITS + 1];
+  mp_limb_t d_denLimbs[64 / GMP_NUMB_BITS + 1];
+  /** The read-only GMP rational over the limbs */
+  mpq_t d_tmp;
+  /** The viewed GMP rational */
+  mpq_srcptr d_ptr;
+};
+
+Rational::Rational(const char* s, unsigned base)
+    : d_num(0), d_den(1), d_big(nullptr)
+{
+  mpq_class v(s, base);
+  v.canonicalize();
+  setMpq(std::move(v));
+}
+
+Rational::Rational(const std::string& s, unsigned base)
+    : d_num(0), d_den(1), d_big(nullptr)
+{
+  mpq_class v(s, base);
+  v.canonicalize();
+  setMpq(std::move(v));
+}
+
+Rational::Rational(const Integer& n, const Integer& d)
+    : d_num(0), d_den(1), d_big(nullptr)
+{
+  if (n.isSmall() && d.isSmall() && d.d_small != 0)
+  {
+    int64_t num = d.d_small < 0 ? -n.d_small : n.d_small;
+    int64_t den = d.d_small < 0 ? -d.d_small : d.d_small;
+    int64_t g = std::gcd(num, den);
+    d_num = num / g;
+    d_den = den / g;
+    return;
+  }
+  mpq_class v;
+  mpz_set(v.get_num_mpz_t(), Integer::MpzView(n).get());
+  mpz_set(v.get_den_mpz_t(), Integer::MpzView(d).get());
+  v.canonicalize();
+  setMpq(std::move(v));
+}
+
+void Rational::setMpq(mpq_srcptr v)
+{
+  if (Integer::fitsSmall(mpq_numref(v)) && Integer::fitsSmall(mpq_denref(v)))
+  {
+    d_num = Integer::smallFromMpz(mpq_numref(v));
+    d_den = Integer::smallFromMpz(mpq_denref(v));
+    delete d_big;
+    d_big = nullptr;
+  }
+  else if (d_big == nullptr)
+  {
+    d_num = 0;
+    d_den = 1;
+    d_big = new mpq_class(v);
+  }
+  else
+  {
+    mpq_set(d_big->get_mpq_t(), v);
+  }
+}
+
+void Rational::setMpq(mpq_class&& v)
+{
+  if (Integer::fitsSmall(v.get_num_mpz_t())
+      && Integer::fitsSmall(v.get_den_mpz_t()))
+  {
+    setMpq(v.get_mpq_t());
+  }
+  else if (d_big == nullptr)
+  {
+    d_num = 0;
+    d_den = 1;
+    d_big = new mpq_class(std::move(v));
+  }
+  else
+  {
+    d_big->swap(v);
+  }
+}
+
+void Rational::setMpz(mpz_srcptr v)
+{
+  Assert(isSmall());
+  if (Integer::fitsSmall(v))
+  {
+    d_num = Integer::smallFromMpz(v);
+    d_den = 1;
+  }
+  else
+  {
+    d_num = 0;
+    d_den = 1;
+    d_big = new mpq_class();
+    mpq_set_z(d_big->get_mpq_t(), v);
+  }
+}
+
+mpq_class Rational::getValue() const
+{
+  if (isSmall())
+  {
+    return mpq_class(MpqView(*this).get());
+  }
+  return *d_big;
+}
+
+double Rational::getDouble() const
+{
+  // integers of magnitude at most 2^53 are exactly representable
+  if (isSmall() && d_den == 1
+      && Integer::magnitude(d_num) <= (uint64_t(1) << 53))
+  {
+    return static_cast<double>(d_num);
+  }
+  return mpq_get_d(MpqView(*this).get());
+}
+
+Integer Rational::floor() const
+{
+  if (isSmall())
+  {
+    int64_t q = d_num / d_den;
+    if (d_num % d_den != 0 && d_num < 0)
+    {
+      --q;
+    }
+    return Integer::fromSmall(q);
+  }
+  mpz_class q;
+  mpz_fdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
+  return Integer(std::move(q));
+}
+
+Integer Rational::ceiling() const
+{
+  if (isSmall())
+  {
+    int64_t q = d_num / d_den;
+    if (d_num % d_den != 0 && d_num > 0)
+    {
+      ++q;
+    }
+    return Integer::fromSmall(q);
+  }
+  mpz_class q;
+  mpz_cdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
+  return Integer(std::move(q));
+}
+
+Rational& Rational::operator=(const Rational& x)
+{
+  if (this == &x) return *this;
+  if (x.isSmall())
+  {
+    delete d_big;
+    d_big = nullptr;
+    d_num = x.d_num;
+    d_den = x.d_den;
+  }
+  else if (d_big == nullptr)
+  {
+    d_num = 0;
+    d_den = 1;
+    d_big = new mpq_class(*x.d_big);
+  }
+  else
+  {
+    *d_big = *x.d_big;
+  }
+  return *this;
+}
+
+Rational Rational::add(const Rational& y) const
+{
+  int64_t n, d;
+  if (isSmall() && y.isSmall()
+      && addSmall(d_num, d_den, y.d_num, y.d_den, n, d))
+  {
+    return fromSmall(n, d);
+  }
+  mpq_class res;
+  mpq_add(res.get_mpq_t(), MpqView(*this).get(), MpqView(y).get());
+  return fromMpq(std::move(res));
+}
+
+Rational Rational::sub(const Rational& y) const
+{
+  int64_t n, d;
+  if (isSmall() && y.isSmall()
+      && addSmall(d_num, d_den, -y.d_num, y.d_den, n, d))
+  {
+    return fromSmall(n, d);
+  }
+  mpq_class res;
+  mpq_sub(res.get_mpq_t(), MpqView(*this).get(), MpqView(y).get());
+  return fromMpq(std::move(res));
+}
+
+Rational Rational::mul(const Rational& y) const
+{
+  int64_t n, d;
+  if (isSmall() && y.isSmall()
+      && mulSmall(d_num, d_den, y.d_num, y.d_den, n, d))
+  {
+    return fromSmall(n, d);
+  }
+  mpq_class res;
+  mpq_mul(res.get_mpq_t(), MpqView(*this).get(), MpqView(y).get());
+  return fromMpq(std::move(res));
+}
+
+Rational Rational::div(const Rational& y) const
+{
+  int64_t n, d;
+  // multiply with the inverse of y, if y is non-zero
+  if (isSmall() && y.isSmall() && y.d_num != 0
+      && mulSmall(d_num,
+                  d_den,
+                  y.d_num < 0 ? -y.d_den : y.d_den,
+                  y.d_num < 0 ? -y.d_num : y.d_num,
+                  n,
+                  d))
+  {
+    return fromSmall(n, d);
+  }
+  mpq_class res;
+  mpq_div(res.get_mpq_t(), MpqView(*this).get(), MpqView(y).get());
+  return fromMpq(std::move(res));
+}
+
+Rational Rational::negSlow() const
+{
+  mpq_class res;
+  mpq_neg(res.get_mpq_t(), MpqView(*this).get());
+  return fromMpq(std::move(res));
+}
+
+int Rational::cmpSlow(const Rational& y) const
+{
+  // Don't use mpq_class's cmp() function.
+  // The name ends up conflicting with this function.
+  return mpq_cmp(MpqView(*this).get(), MpqView(y).get());
+}
+
+std::string Rational::toString(int base) const
+{
+  if (isSmall() && base == 10)
+  {
+    return d_den == 1 ? std::to_string(d_num)
+                      : std::to_string(d_num) + "/" + std::to_string(d_den);
+  }
+  return getValue().get_str(base);
+}
+
 std::ostream& operator<<(std::ostream& os, const Rational& q){
   return os << q.toString();
 }
@@ -89,9 +413,9 @@ std::optional<Rational> Rational::fromDouble(double d)
 {
   using namespace std;
   if(isfinite(d)){
-    Rational q;
-    mpq_set_d(q.d_value.get_mpq_t(), d);
-    return q;
+    mpq_class q;
+    mpq_set_d(q.get_mpq_t(), d);
+    return fromMpq(std::move(q));
   }
   return std::optional<Rational>();
 }
@@ -22,6 +22,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 
 #include "util/gmp_util.h"
 #include "util/integer.h"
@@ -37,6 +38,11 @@ namespace cvc5::internal {
  * literature.) A consequence is that that the numerator and denominator may be
  * different than the values used to construct the Rational.
  *
+ * As for Integer, rationals whose numerator and denominator both fit into a
+ * (symmetric) 64 bit machine word are stored inline, and arithmetic on them
+ * is done with overflow-checked machine arithmetic. A rational is stored in a
+ * (heap allocated) GMP rational if and only if this is not the case.
+ *
  * NOTE: The correct way to create a Rational from an int is to use one of the
  * int numerator/int denominator constructors with the denominator 1.  Trying
  * to construct a Rational with a single int, e.g., Rational(0), will put you
@@ -52,7 +58,10 @@ class Rational
    * Assumes that the value is in canonical form, and thus does not
    * have to call canonicalize() on the value.
    */
-  Rational(const mpq_class& val) : d_value(val) {}
+  Rational(const mpq_class& val) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    setMpq(val.get_mpq_t());
+  }
 
   /**
    * Creates a rational from a decimal string (e.g., <code>"1.5"</code>).
@@ -63,7 +72,7 @@ class Rational
   static Rational fromDecimal(const std::string& dec);
 
   /** Constructs a rational with the value 0/1. */
-  Rational() : d_value(0) { d_value.canonicalize(); }
+  Rational() : d_num(0), d_den(1), d_big(nullptr) {}
 
   /**
    * Constructs a Rational from a C string in a given base (defaults to 10).
@@ -72,95 +81,100 @@ class Rational
    * For more information about what is a valid rational string,
    * see GMP's documentation for mpq_set_str().
    */
-  explicit Rational(const char* s, unsigned base = 10) : d_value(s, base)
-  {
-    d_value.canonicalize();
-  }
-  Rational(const std::string& s, unsigned base = 10) : d_value(s, base)
-  {
-    d_value.canonicalize();
-  }
+  explicit Rational(const char* s, unsigned base = 10);
+  Rational(const std::string& s, unsigned base = 10);
 
   /**
    * Creates a Rational from another Rational, q, by performing a deep copy.
    */
-  Rational(const Rational& q) : d_value(q.d_value) { d_value.canonicalize(); }
+  Rational(const Rational& q)
+      : d_num(q.d_num),
+        d_den(q.d_den),
+        d_big(q.d_big == nullptr ? nullptr : new mpq_class(*q.d_big))
+  {
+  }
+  Rational(Rational&& q) noexcept
+      : d_num(q.d_num), d_den(q.d_den), d_big(q.d_big)
+  {
+    q.d_num = 0;
+    q.d_den = 1;
+    q.d_big = nullptr;
+  }
 
   /**
    * Constructs a canonical Rational from a numerator.
    */
-  Rational(signed int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(signed long int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned long int n) : d_value(n, 1) { d_value.canonicalize(); }
+  Rational(signed int n) : d_num(n), d_den(1), d_big(nullptr) {}
+  Rational(unsigned int n) : d_num(n), d_den(1), d_big(nullptr) {}
+  Rational(signed long int n) : Rational(Integer(n)) {}
+  Rational(unsigned long int n) : Rational(Integer(n)) {}
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
-  // to avoid truncation, we convert the input value to an mpz and then build
-  // the mpq.
-  Rational(int64_t n) : d_value(construct_mpz(n), 1) { d_value.canonicalize(); }
-  Rational(uint64_t n) : d_value(construct_mpz(n), 1)
-  {
-    d_value.canonicalize();
-  }
+  Rational(int64_t n) : Rational(Integer(n)) {}
+  Rational(uint64_t n) : Rational(Integer(n)) {}
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
   /**
    * Constructs a canonical Rational from a numerator and denominator.
    */
-  Rational(signed int n, signed int d) : d_value(n, d)
-  {
-    d_value.canonicalize();
-  }
-  Rational(unsigned int n, unsigned int d) : d_value(n, d)
+  Rational(signed int n, signed int d) : Rational(Integer(n), Integer(d)) {}
+  Rational(unsigned int n, unsigned int d) : Rational(Integer(n), Integer(d))
   {
-    d_value.canonicalize();
   }
-  Rational(signed long int n, signed long int d) : d_value(n, d)
+  Rational(signed long int n, signed long int d)
+      : Rational(Integer(n), Integer(d))
   {
-    d_value.canonicalize();
   }
-  Rational(unsigned long int n, unsigned long int d) : d_value(n, d)
+  Rational(unsigned long int n, unsigned long int d)
+      : Rational(Integer(n), Integer(d))
   {
-    d_value.canonicalize();
   }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
-  // to avoid truncation, we convert the input value to an mpz and then build
-  // the mpq.
-  Rational(int64_t n, int64_t d) : d_value(construct_mpz(n), construct_mpz(d))
-  {
-    d_value.canonicalize();
-  }
-  Rational(uint64_t n, uint64_t d) : d_value(construct_mpz(n), construct_mpz(d))
-  {
-    d_value.canonicalize();
-  }
+  Rational(int64_t n, int64_t d) : Rational(Integer(n), Integer(d)) {}
+  Rational(uint64_t n, uint64_t d) : Rational(Integer(n), Integer(d)) {}
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
-  Rational(const Integer& n, const Integer& d)
-      : d_value(n.get_mpz(), d.get_mpz())
+  Rational(const Integer& n, const Integer& d);
+  Rational(const Integer& n) : d_num(n.d_small), d_den(1), d_big(nullptr)
   {
-    d_value.canonicalize();
+    if (CVC5_PREDICT_FALSE(!n.isSmall()))
+    {
+      setMpz(n.d_big->get_mpz_t());
+    }
   }
-  Rational(const Integer& n) : d_value(n.get_mpz()) { d_value.canonicalize(); }
-  ~Rational() {}
+  ~Rational() { delete d_big; }
 
   /**
-   * Returns a copy of d_value to enable public access of GMP data.
+   * Returns a copy of the value to enable public access of GMP data.
    */
-  const mpq_class& getValue() const { return d_value; }
+  mpq_class getValue() const;
 
   /**
    * Returns the value of numerator of the Rational.
    * Note that this makes a deep copy of the numerator.
    */
-  Integer getNumerator() const { return Integer(d_value.get_num()); }
+  Integer getNumerator() const
+  {
+    if (isSmall())
+    {
+      return Integer::fromSmall(d_num);
+    }
+    return Integer(d_big->get_num());
+  }
 
   /**
    * Returns the value of denominator of the Rational.
    * Note that this makes a deep copy of the denominator.
    */
-  Integer getDenominator() const { return Integer(d_value.get_den()); }
+  Integer getDenominator() const
+  {
+    if (isSmall())
+    {
+      return Integer::fromSmall(d_den);
+    }
+    return Integer(d_big->get_den());
+  }
 
   static std::optional<Rational> fromDouble(double d);
 
@@ -169,30 +183,50 @@ class Rational
    * approximate: truncation may occur, overflow may result in
    * infinity, and underflow may result in zero.
    */
-  double getDouble() const { return d_value.get_d(); }
+  double getDouble() const;
 
   Rational inverse() const
   {
+    if (isSmall() && d_num != 0)
+    {
+      return d_num > 0 ? fromSmall(d_den, d_num) : fromSmall(-d_den, -d_num);
+    }
     return Rational(getDenominator(), getNumerator());
   }
 
   int cmp(const Rational& x) const
   {
-    // Don't use mpq_class's cmp() function.
-    // The name ends up conflicting with this function.
-    return mpq_cmp(d_value.get_mpq_t(), x.d_value.get_mpq_t());
+    if (isSmall() && x.isSmall())
+    {
+      if (d_den == x.d_den)
+      {
+        return (d_num > x.d_num) - (d_num < x.d_num);
+      }
+      // a/b < c/d iff a*d < c*b, since b and d are positive
+      int64_t l, r;
+      if (!__builtin_mul_overflow(d_num, x.d_den, &l)
+          && !__builtin_mul_overflow(x.d_num, d_den, &r))
+      {
+        return (l > r) - (l < r);
+      }
+    }
+    return cmpSlow(x);
   }
 
-  int sgn() const { return mpq_sgn(d_value.get_mpq_t()); }
+  int sgn() const
+  {
+    if (isSmall())
+    {
+      return (d_num > 0) - (d_num < 0);
+    }
+    return mpq_sgn(d_big->get_mpq_t());
+  }
 
-  bool isZero() const { return sgn() == 0; }
+  bool isZero() const { return isSmall() && d_num == 0; }
 
-  bool isOne() const { return mpq_cmp_si(d_value.get_mpq_t(), 1, 1) == 0; }
+  bool isOne() const { return isSmall() && d_num == 1 && d_den == 1; }
 
-  bool isNegativeOne() const
-  {
-    return mpq_cmp_si(d_value.get_mpq_t(), -1, 1) == 0;
-  }
+  bool isNegativeOne() const { return isSmall() && d_num == -1 && d_den == 1; }
 
   Rational abs() const
   {
@@ -206,88 +240,149 @@ class Rational
     }
   }
 
-  Integer floor() const
-  {
-    mpz_class q;
-    mpz_fdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
-    return Integer(q);
-  }
+  Integer floor() const;
 
-  Integer ceiling() const
-  {
-    mpz_class q;
-    mpz_cdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
-    return Integer(q);
-  }
+  Integer ceiling() const;
 
   Rational floor_frac() const { return (*this) - Rational(floor()); }
 
-  Rational& operator=(const Rational& x)
+  Rational& operator=(const Rational& x);
+
+  Rational& operator=(Rational&& x) noexcept
   {
-    if (this == &x) return *this;
-    d_value = x.d_value;
+    std::swap(d_num, x.d_num);
+    std::swap(d_den, x.d_den);
+    std::swap(d_big, x.d_big);
     return *this;
   }
 
-  Rational operator-() const { return Rational(-(d_value)); }
+  Rational operator-() const
+  {
+    if (isSmall())
+    {
+      return fromSmall(-d_num, d_den);
+    }
+    return negSlow();
+  }
 
-  bool operator==(const Rational& y) const { return d_value == y.d_value; }
+  bool operator==(const Rational& y) const
+  {
+    if (isSmall() && y.isSmall())
+    {
+      return d_num == y.d_num && d_den == y.d_den;
+    }
+    return !isSmall() && !y.isSmall()
+           && mpq_equal(d_big->get_mpq_t(), y.d_big->get_mpq_t());
+  }
 
-  bool operator!=(const Rational& y) const { return d_value != y.d_value; }
+  bool operator!=(const Rational& y) const { return !(*this == y); }
 
-  bool operator<(const Rational& y) const { return d_value < y.d_value; }
+  bool operator<(const Rational& y) const { return cmp(y) < 0; }
 
-  bool operator<=(const Rational& y) const { return d_value <= y.d_value; }
+  bool operator<=(const Rational& y) const { return cmp(y) <= 0; }
 
-  bool operator>(const Rational& y) const { return d_value > y.d_value; }
+  bool operator>(const Rational& y) const { return cmp(y) > 0; }
 
-  bool operator>=(const Rational& y) const { return d_value >= y.d_value; }
+  bool operator>=(const Rational& y) const { return cmp(y) >= 0; }
 
   Rational operator+(const Rational& y) const
   {
-    return Rational(d_value + y.d_value);
+    int64_t res;
+    if (isSmall() && y.isSmall() && d_den == 1 && y.d_den == 1
+        && !__builtin_add_overflow(d_num, y.d_num, &res)
+        && Integer::fitsSmall(res))
+    {
+      return fromSmall(res, 1);
+    }
+    return add(y);
   }
   Rational operator-(const Rational& y) const
   {
-    return Rational(d_value - y.d_value);
+    int64_t res;
+    if (isSmall() && y.isSmall() && d_den == 1 && y.d_den == 1
+        && !__builtin_sub_overflow(d_num, y.d_num, &res)
+        && Integer::fitsSmall(res))
+    {
+      return fromSmall(res, 1);
+    }
+    return sub(y);
   }
 
   Rational operator*(const Rational& y) const
   {
-    return Rational(d_value * y.d_value);
-  }
-  Rational operator/(const Rational& y) const
-  {
-    return Rational(d_value / y.d_value);
+    int64_t res;
+    if (isSmall() && y.isSmall() && d_den == 1 && y.d_den == 1
+        && !__builtin_mul_overflow(d_num, y.d_num, &res)
+        && Integer::fitsSmall(res))
+    {
+      return fromSmall(res, 1);
+    }
+    return mul(y);
   }
+  Rational operator/(const Rational& y) const { return div(y); }
 
   Rational& operator+=(const Rational& y)
   {
-    d_value += y.d_value;
-    return (*this);
+    int64_t res;
+    if (isSmall() && y.isSmall() && d_den == 1 && y.d_den == 1
+        && !__builtin_add_overflow(d_num, y.d_num, &res)
+        && Integer::fitsSmall(res))
+    {
+      d_num = res;
+      return *this;
+    }
+    return *this = add(y);
   }
   Rational& operator-=(const Rational& y)
   {
-    d_value -= y.d_value;
-    return (*this);
+    int64_t res;
+    if (isSmall() && y.isSmall() && d_den == 1 && y.d_den == 1
+        && !__builtin_sub_overflow(d_num, y.d_num, &res)
+        && Integer::fitsSmall(res))
+    {
+      d_num = res;
+      return *this;
+    }
+    return *this = sub(y);
   }
 
-  Rational& operator*=(const Rational& y)
+  /**
+   * Sets this rational to this + a * b. If all three values and the result
+   * are integers stored inline, this is done with machine arithmetic and
+   * without constructing the product.
+   *
+   * @return True if the result was computed with machine arithmetic.
+   */
+  bool addProduct(const Rational& a, const Rational& b)
   {
-    d_value *= y.d_value;
-    return (*this);
+    int64_t prod, res;
+    if (isSmall() && a.isSmall() && b.isSmall() && d_den == 1 && a.d_den == 1
+        && b.d_den == 1 && !__builtin_mul_overflow(a.d_num, b.d_num, &prod)
+        && !__builtin_add_overflow(d_num, prod, &res)
+        && Integer::fitsSmall(res))
+    {
+      d_num = res;
+      return true;
+    }
+    *this += a * b;
+    return false;
   }
 
-  Rational& operator/=(const Rational& y)
+  Rational& operator*=(const Rational& y) { return *this = *this * y; }
+
+  Rational& operator/=(const Rational& y) { return *this = div(y); }
+
+  bool isIntegral() const
   {
-    d_value /= y.d_value;
-    return (*this);
+    if (isSmall())
+    {
+      return d_den == 1;
+    }
+    return mpz_cmp_ui(d_big->get_den_mpz_t(), 1) == 0;
   }
 
-  bool isIntegral() const { return mpz_cmp_ui(d_value.get_den_mpz_t(), 1) == 0; }
-
   /** Returns a string representing the rational in the given base. */
-  std::string toString(int base = 10) const { return d_value.get_str(base); }
+  std::string toString(int base = 10) const;
 
   /**
    * Computes the hash of the rational from hashes of the numerator and the
@@ -295,8 +390,12 @@ class Rational
    */
   size_t hash() const
   {
-    size_t numeratorHash = gmpz_hash(d_value.get_num_mpz_t());
-    size_t denominatorHash = gmpz_hash(d_value.get_den_mpz_t());
+    if (isSmall())
+    {
+      return Integer::smallHash(d_num) ^ Integer::smallHash(d_den);
+    }
+    size_t numeratorHash = gmpz_hash(d_big->get_num_mpz_t());
+    size_t denominatorHash = gmpz_hash(d_big->get_den_mpz_t());
 
     return numeratorHash ^ denominatorHash;
   }
@@ -312,11 +411,53 @@ class Rational
   int absCmp(const Rational& q) const;
 
  private:
+  /** A read-only view of the value of a Rational as a GMP rational. */
+  class MpqView;
+
+  /**
+   * The Rational with the inline value n/d, which must be in canonical form
+   * and satisfy Integer::fitsSmall for both n and d.
+   */
+  static Rational fromSmall(int64_t n, int64_t d)
+  {
+    Rational res;
+    res.d_num = n;
+    res.d_den = d;
+    return res;
+  }
+  /** Whether the value is stored inline */
+  bool isSmall() const { return d_big == nullptr; }
+
+  /** The Rational with value v, which must be in canonical form. */
+  static Rational fromMpq(mpq_class&& v)
+  {
+    Rational res;
+    res.setMpq(std::move(v));
+    return res;
+  }
+  /** Set the value to v, which must be in canonical form. */
+  void setMpq(mpq_srcptr v);
+  void setMpq(mpq_class&& v);
+  /** Set the value to the integer v. */
+  void setMpz(mpz_srcptr v);
+
   /**
-   * Stores the value of the rational is stored in a C++ GMP rational class.
-   * Using this instead of mpq_t allows for easier destruction.
+   * The arithmetic operators, for the cases not handled inline. The inline
+   * fast paths in the operators only handle integral values.
    */
-  mpq_class d_value;
+  Rational add(const Rational& y) const;
+  Rational sub(const Rational& y) const;
+  Rational mul(const Rational& y) const;
+  Rational div(const Rational& y) const;
+  Rational negSlow() const;
+  int cmpSlow(const Rational& y) const;
+
+  /** The numerator, if d_big is null. */
+  int64_t d_num;
+  /** The (positive) denominator, if d_big is null. */
+  int64_t d_den;
+  /** The value, if it is not stored inline, and null otherwise. */
+  mpq_class* d_big;
 
 }; /* class Rational */
 
@@ -17,7 +17,16 @@
 #include "util/resource_manager.h"
 
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
 #include <ostream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 #include "base/check.h"
 #include "base/listener.h"
@@ -119,6 +128,35 @@ ResourceManager::Statistics::Statistics(StatisticsRegistry& stats)
 {
 }
 
+struct ResourceManager::Calibration
+{
+  using clock = std::chrono::steady_clock;
+  /** The time of the last spend, or of the beginning of the current call */
+  clock::time_point d_last;
+  /** The number of spends per InferenceId resource */
+  std::array<uint64_t, resman_detail::InferenceIdMax + 1> d_infidCount{};
+  /** The nanoseconds spent per InferenceId resource */
+  std::array<uint64_t, resman_detail::InferenceIdMax + 1> d_infidTime{};
+  /** The number of spends per Resource resource */
+  std::array<uint64_t, resman_detail::ResourceMax + 1> d_resourceCount{};
+  /** The nanoseconds spent per Resource resource */
+  std::array<uint64_t, resman_detail::ResourceMax + 1> d_resourceTime{};
+  Calibration() : d_last(clock::now()) {}
+  /**
+   * Returns the nanoseconds elapsed since the last spend, which are
+   * attributed to the current spend, and restarts the measurement.
+   */
+  uint64_t lap()
+  {
+    clock::time_point now = clock::now();
+    uint64_t res =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - d_last)
+            .count();
+    d_last = now;
+    return res;
+  }
+};
+
 bool parseOption(const std::string& optarg, std::string& name, uint64_t& weight)
 {
   auto pos = optarg.find('=');
@@ -149,17 +187,124 @@ bool setWeight(const std::string& name, uint64_t weight, Weights& weights)
   return false;
 }
 
+template <typename T, typename Counts>
+void printWeights(std::ostream& out,
+                  const Counts& counts,
+                  const Counts& times,
+                  double unit)
+{
+  using theory::toString;
+  for (std::size_t i = 0; i < counts.size(); ++i)
+  {
+    if (counts[i] == 0)
+    {
+      continue;
+    }
+    double avg = static_cast<double>(times[i]) / counts[i];
+    long long weight = std::max<long long>(1, std::llround(avg / unit));
+    out << toString(static_cast<T>(i)) << "=" << weight << std::endl;
+  }
+}
+
+struct ResourceManager::Snapshots
+{
+  using clock = std::chrono::steady_clock;
+  /** The time the snapshots were started */
+  clock::time_point d_start;
+  /** The time the next snapshot is due, if the interval is in milliseconds */
+  clock::time_point d_next;
+  /**
+   * The conflicts of the SAT solver, or nullptr if they are not available.
+   * Only used if the interval is in conflicts.
+   */
+  const StatisticBaseValue* d_conflicts;
+  /** The number of conflicts at which the next snapshot is due */
+  int64_t d_nextConflicts = 0;
+  Snapshots(const StatisticBaseValue* conflicts)
+      : d_start(clock::now()), d_next(d_start), d_conflicts(conflicts)
+  {
+  }
+  /** Returns the current number of conflicts of the SAT solver */
+  int64_t conflicts() const
+  {
+    StatExportData sed = d_conflicts->getViewer();
+    return std::holds_alternative<int64_t>(sed) ? std::get<int64_t>(sed) : 0;
+  }
+};
+
+struct ResourceManager::MemoryAccount
+{
+  MemoryAccount(StatisticsRegistry& sr,
+                const std::string& name,
+                std::function<uint64_t()> usage)
+      : d_name(name),
+        d_usage(std::move(usage)),
+        d_current(0),
+        d_peak(sr.registerInt("memory::" + name + "::peakBytes", false))
+  {
+  }
+  /** The name of the subsystem */
+  std::string d_name;
+  /** Returns the memory usage of the subsystem, unset if unregistered */
+  std::function<uint64_t()> d_usage;
+  /** The memory usage at the last sample */
+  uint64_t d_current;
+  /** The peak memory usage over all samples */
+  IntStat d_peak;
+};
+
+namespace {
+
+/**
+ * Returns the current resident set size of the process in bytes. Falls back
+ * to the peak resident set size if the current one is not available, and
+ * returns zero if neither is.
+ */
+uint64_t getResidentSetSize()
+{
+#ifdef __linux__
+  // the second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size, resident;
+  if (statm >> size >> resident)
+  {
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+#ifndef _WIN32
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0)
+  {
+#ifdef __APPLE__
+    return ru.ru_maxrss;
+#else
+    return static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
 /*---------------------------------------------------------------------------*/
 
 ResourceManager::ResourceManager(StatisticsRegistry& stats,
                                  const Options& options)
     : d_options(options),
+      d_statisticsRegistry(stats),
       d_enabled(true),
+      d_interrupted(false),
       d_perCallTimer(),
       d_cumulativeTimeUsed(0),
       d_cumulativeResourceUsed(0),
       d_thisCallResourceUsed(0),
       d_thisCallResourceBudget(0),
+      d_spendsUntilTimeCheck(1),
+      d_spendsUntilSnapshotCheck(1),
+      d_spendsUntilMemoryCheck(1),
+      d_memoryChecks(false),
+      d_outOfMemory(false),
       d_statistics(new ResourceManager::Statistics(stats))
 {
   d_statistics->d_resourceUnitsUsed.set(d_cumulativeResourceUsed);
@@ -208,7 +353,34 @@ void ResourceManager::spendResource(uint64_t amount)
 
   Trace("limit") << "ResourceManager::spendResource()" << std::endl;
   d_thisCallResourceUsed += amount;
-  if (out())
+  bool isOut = outOfResources() || interrupted();
+  // Reading the clock is much more expensive than the other checks, hence we
+  // only check the time limit every s_timeCheckInterval spends.
+  if (!isOut && d_options.base.perCallMillisecondLimit > 0
+      && --d_spendsUntilTimeCheck == 0)
+  {
+    d_spendsUntilTimeCheck = s_timeCheckInterval;
+    isOut = outOfTime();
+  }
+  if (!isOut && d_memoryChecks && --d_spendsUntilMemoryCheck == 0)
+  {
+    d_spendsUntilMemoryCheck = s_memoryCheckInterval;
+    isOut = checkMemory();
+  }
+  if (d_snapshots
+      && d_options.base.statisticsEveryUnit == options::StatisticsEveryUnit::MS
+      && --d_spendsUntilSnapshotCheck == 0)
+  {
+    d_spendsUntilSnapshotCheck = s_timeCheckInterval;
+    Snapshots::clock::time_point now = Snapshots::clock::now();
+    if (now >= d_snapshots->d_next)
+    {
+      d_snapshots->d_next =
+          now + std::chrono::milliseconds(d_options.base.statisticsEvery);
+      writeSnapshot();
+    }
+  }
+  if (isOut)
   {
     Trace("limit") << "ResourceManager::spendResource: interrupt!" << std::endl;
     Trace("limit") << "          on call "
@@ -218,6 +390,11 @@ void ResourceManager::spendResource(uint64_t amount)
       Trace("limit") << "ResourceManager::spendResource: elapsed time"
                      << d_perCallTimer.elapsed() << std::endl;
     }
+    if (outOfMemory())
+    {
+      Trace("limit") << "ResourceManager::spendResource: out of memory"
+                     << std::endl;
+    }
 
     for (Listener* l : d_listeners)
     {
@@ -231,6 +408,26 @@ void ResourceManager::spendResource(Resource r)
   std::size_t i = static_cast<std::size_t>(r);
   Assert(d_resourceWeights.size() > i);
   d_statistics->d_resourceSteps << r;
+  if (d_calibration)
+  {
+    d_calibration->d_resourceCount[i]++;
+    d_calibration->d_resourceTime[i] += d_calibration->lap();
+  }
+  // the SAT solver spends this resource once per search step, which is
+  // where we check whether enough conflicts happened since the last snapshot
+  if (r == Resource::SatConflictStep && d_snapshots
+      && d_snapshots->d_conflicts != nullptr
+      && d_options.base.statisticsEveryUnit
+             == options::StatisticsEveryUnit::CONFLICTS)
+  {
+    int64_t conflicts = d_snapshots->conflicts();
+    if (conflicts >= d_snapshots->d_nextConflicts)
+    {
+      d_snapshots->d_nextConflicts =
+          conflicts + static_cast<int64_t>(d_options.base.statisticsEvery);
+      writeSnapshot();
+    }
+  }
   spendResource(d_resourceWeights[i]);
 }
 
@@ -244,16 +441,171 @@ void ResourceManager::spendResource(theory::InferenceId iid)
   std::size_t i = static_cast<std::size_t>(iid);
   Assert(d_infidWeights.size() > i);
   d_statistics->d_inferenceIdSteps << iid;
+  if (d_calibration)
+  {
+    d_calibration->d_infidCount[i]++;
+    d_calibration->d_infidTime[i] += d_calibration->lap();
+  }
   spendResource(d_infidWeights[i]);
 }
 
+void ResourceManager::printCalibratedWeights(std::ostream& out) const
+{
+  if (!d_calibration)
+  {
+    return;
+  }
+  const Calibration& c = *d_calibration;
+  uint64_t count = 0;
+  uint64_t time = 0;
+  for (std::size_t i = 0; i < c.d_resourceCount.size(); ++i)
+  {
+    count += c.d_resourceCount[i];
+    time += c.d_resourceTime[i];
+  }
+  for (std::size_t i = 0; i < c.d_infidCount.size(); ++i)
+  {
+    count += c.d_infidCount[i];
+    time += c.d_infidTime[i];
+  }
+  if (count == 0 || time == 0)
+  {
+    return;
+  }
+  // the average time of a spend has weight one
+  double unit = static_cast<double>(time) / count;
+  printWeights<Resource>(out, c.d_resourceCount, c.d_resourceTime, unit);
+  printWeights<theory::InferenceId>(
+      out, c.d_infidCount, c.d_infidTime, unit);
+}
+
+void ResourceManager::registerMemoryAccount(const std::string& name,
+                                            std::function<uint64_t()> usage)
+{
+  for (MemoryAccount& ma : d_memoryAccounts)
+  {
+    if (ma.d_name == name)
+    {
+      ma.d_usage = std::move(usage);
+      return;
+    }
+  }
+  d_memoryAccounts.emplace_back(d_statisticsRegistry, name, std::move(usage));
+}
+
+void ResourceManager::unregisterMemoryAccount(const std::string& name)
+{
+  for (MemoryAccount& ma : d_memoryAccounts)
+  {
+    if (ma.d_name == name)
+    {
+      // keep the account such that its peak is still reported
+      ma.d_usage = nullptr;
+      ma.d_current = 0;
+    }
+  }
+}
+
+bool ResourceManager::checkMemory()
+{
+  for (MemoryAccount& ma : d_memoryAccounts)
+  {
+    if (ma.d_usage)
+    {
+      ma.d_current = ma.d_usage();
+      ma.d_peak.maxAssign(static_cast<int64_t>(ma.d_current));
+    }
+  }
+  uint64_t limit = d_options.base.memoryLimit;
+  if (limit == 0 || d_outOfMemory)
+  {
+    return d_outOfMemory;
+  }
+  uint64_t rss = getResidentSetSize();
+  if (rss <= limit * 1024 * 1024)
+  {
+    return false;
+  }
+  d_outOfMemory = true;
+  Warning() << "cvc5 exceeded the memory limit of " << limit
+            << " MB with a resident set size of " << rss / (1024 * 1024)
+            << " MB, the estimated memory usage per subsystem is:"
+            << std::endl;
+  if (WarningChannel.isOn())
+  {
+    printMemoryUsage(WarningChannel.getStream());
+  }
+  return outOfMemory();
+}
+
+void ResourceManager::printMemoryUsage(std::ostream& out) const
+{
+  for (const MemoryAccount& ma : d_memoryAccounts)
+  {
+    // format in a separate stream to not change the flags of out
+    std::stringstream ss;
+    ss << "  " << std::left << std::setw(12) << ma.d_name << std::right
+       << std::fixed << std::setprecision(1) << std::setw(10)
+       << ma.d_current / (1024.0 * 1024.0) << " MB (peak "
+       << ma.d_peak.get() / (1024.0 * 1024.0) << " MB)";
+    out << ss.str() << std::endl;
+  }
+}
+
+void ResourceManager::writeSnapshot()
+{
+  uint64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         Snapshots::clock::now() - d_snapshots->d_start)
+                         .count();
+  int64_t maxRss = 0;
+#ifndef _WIN32
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0)
+  {
+#ifdef __APPLE__
+    // reported in bytes rather than kilobytes
+    maxRss = ru.ru_maxrss / 1024;
+#else
+    maxRss = ru.ru_maxrss;
+#endif
+  }
+#endif
+  std::ostream& out = *d_options.base.statisticsEveryOutput;
+  out << "{\"elapsed_ms\": " << elapsed
+      << ", \"resource_units\": " << d_cumulativeResourceUsed
+      << ", \"max_rss_kb\": " << maxRss << ", \"stats\": ";
+  d_statisticsRegistry.printJson(out, d_options.base.statisticsEveryPrefix);
+  out << "}" << std::endl;
+}
+
 void ResourceManager::beginCall()
 {
+  // The options may still change after construction, hence the calibration
+  // and the snapshots are set up on the first call.
+  if (!d_calibration && d_options.base.rweightCalibrateWasSetByUser)
+  {
+    d_calibration.reset(new Calibration());
+  }
+  d_memoryChecks =
+      d_options.base.statisticsMemory || d_options.base.memoryLimit > 0;
+  d_spendsUntilMemoryCheck = 1;
+  d_outOfMemory = false;
+  if (!d_snapshots && d_options.base.statisticsEvery > 0)
+  {
+    d_snapshots.reset(
+        new Snapshots(d_statisticsRegistry.get("sat::conflicts")));
+  }
   // refresh here if not already done so
   refresh();
   // begin call
   d_perCallTimer.set(d_options.base.perCallMillisecondLimit);
   d_thisCallResourceUsed = 0;
+  d_spendsUntilTimeCheck = 1;
+  if (d_calibration)
+  {
+    // do not attribute the time between calls to the first spend
+    d_calibration->d_last = Calibration::clock::now();
+  }
 
   if (d_options.base.cumulativeResourceLimit > 0)
   {
@@ -273,6 +625,11 @@ void ResourceManager::beginCall()
 
 void ResourceManager::refresh()
 {
+  if (d_memoryChecks)
+  {
+    // sample at the end of each call as well, to cover short calls
+    checkMemory();
+  }
   d_cumulativeTimeUsed += d_perCallTimer.elapsed();
   d_perCallTimer.set(0);
   d_thisCallResourceUsed = 0;
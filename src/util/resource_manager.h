@@ -23,8 +23,12 @@
 #include <stdint.h>
 
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <iosfwd>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "theory/inference_id.h"
@@ -136,8 +140,18 @@ class ResourceManager
   bool outOfResources() const;
   /** Checks whether time has been exhausted. */
   bool outOfTime() const;
-  /** Checks whether any limit has been exhausted. */
-  bool out() const { return outOfResources() || outOfTime(); }
+  /** Checks whether the memory limit has been exceeded. */
+  bool outOfMemory() const { return d_enabled && d_outOfMemory; }
+  /** Checks whether an interruption of the current call was requested. */
+  bool interrupted() const { return d_enabled && d_interrupted; }
+  /**
+   * Checks whether any limit has been exhausted or an interruption was
+   * requested.
+   */
+  bool out() const
+  {
+    return outOfResources() || outOfTime() || outOfMemory() || interrupted();
+  }
 
   /** Retrieves amount of resources used overall. */
   uint64_t getResourceUsage() const;
@@ -163,9 +177,37 @@ class ResourceManager
    */
   void spendResource(theory::InferenceId iid);
 
+  /**
+   * Prints resource weights approximating the time spent per resource, as
+   * measured if the option rweight-calibrate is set, and does nothing
+   * otherwise. Each line has the form NAME=N, as taken by --rweight. The
+   * weights are relative to the average time of all spends, and at least one.
+   */
+  void printCalibratedWeights(std::ostream& out) const;
+
+  /**
+   * Registers a subsystem whose (estimated) memory usage in bytes is given by
+   * usage, replacing a previous registration for name. If the option
+   * stats-memory or memory-limit is set, the usage is sampled periodically
+   * while solving. The peak is reported in the statistic
+   * memory::<name>::peakBytes, and the current usage is part of the
+   * breakdown printed when the memory limit is exceeded.
+   */
+  void registerMemoryAccount(const std::string& name,
+                             std::function<uint64_t()> usage);
+  /**
+   * Unregisters the subsystem name. Must be called before the object that
+   * usage of registerMemoryAccount refers to is destroyed.
+   */
+  void unregisterMemoryAccount(const std::string& name);
+  /** Prints the current and peak memory usage per subsystem. */
+  void printMemoryUsage(std::ostream& out) const;
+
   /**
    * Resets perCall limits to mark the start of a new call,
-   * updates budget for current call and starts the timer
+   * updates budget for current call and starts the timer. On the first call,
+   * this also sets up the calibration of resource weights and the periodic
+   * statistics snapshots if they are enabled.
    */
   void beginCall();
 
@@ -176,13 +218,25 @@ class ResourceManager
   void refresh();
 
   /**
-   * Registers a listener that is notified on a resource out or (per-call)
-   * timeout.
+   * Requests the interruption of the current call, or of the next one if no
+   * call is running. The listeners are notified the next time a resource is
+   * spent. This is the only method of this class that may be called from
+   * another thread than the one running the call.
+   */
+  void interrupt() { d_interrupted = true; }
+  /** Clears a requested interruption, at the end of a call. */
+  void clearInterrupt() { d_interrupted = false; }
+
+  /**
+   * Registers a listener that is notified on a resource out, (per-call)
+   * timeout or interruption.
    */
   void registerListener(Listener* listener);
 
  private:
   const Options& d_options;
+  /** The statistics registry, used for the periodic snapshots */
+  StatisticsRegistry& d_statisticsRegistry;
 
   /**
    * If the resource manager is not enabled, then the checks whether we are out
@@ -190,6 +244,9 @@ class ResourceManager
    */
   bool d_enabled;
 
+  /** Whether an interruption was requested, see interrupt(). */
+  std::atomic<bool> d_interrupted;
+
   /** The per-call wall clock timer. */
   WallClockTimer d_perCallTimer;
 
@@ -207,6 +264,32 @@ class ResourceManager
    */
   uint64_t d_thisCallResourceBudget;
 
+  /**
+   * The number of spends until the time limit is checked again when spending
+   * resources, see s_timeCheckInterval. The time limit is checked on the first
+   * spend of each call.
+   */
+  uint32_t d_spendsUntilTimeCheck;
+  /** The number of spends between two checks of the time limit. */
+  static constexpr uint32_t s_timeCheckInterval = 16;
+  /**
+   * The number of spends until we next check whether a statistics snapshot
+   * is due, if the interval of stats-every is given in milliseconds.
+   */
+  uint32_t d_spendsUntilSnapshotCheck;
+
+  /**
+   * The number of spends until we next sample the memory usage, if the
+   * option stats-memory or memory-limit is set.
+   */
+  uint32_t d_spendsUntilMemoryCheck;
+  /** The number of spends between two samples of the memory usage. */
+  static constexpr uint32_t s_memoryCheckInterval = 256;
+  /** Whether the memory usage is sampled, set on the first call. */
+  bool d_memoryChecks;
+  /** Whether the memory limit was exceeded in the current call. */
+  bool d_outOfMemory;
+
   /** Receives a notification on reaching a limit. */
   std::vector<Listener*> d_listeners;
 
@@ -220,6 +303,31 @@ class ResourceManager
   struct Statistics;
   /** The statistics object */
   std::unique_ptr<Statistics> d_statistics;
+
+  struct Calibration;
+  /**
+   * The time measured per resource, only allocated if the option
+   * rweight-calibrate is set.
+   */
+  std::unique_ptr<Calibration> d_calibration;
+
+  struct Snapshots;
+  /**
+   * The state of the periodic statistics snapshots, only allocated if the
+   * option stats-every is set.
+   */
+  std::unique_ptr<Snapshots> d_snapshots;
+  /** Write a statistics snapshot to the output of stats-every. */
+  void writeSnapshot();
+
+  struct MemoryAccount;
+  /** The subsystems whose memory usage is accounted for */
+  std::vector<MemoryAccount> d_memoryAccounts;
+  /**
+   * Samples the memory usage of all subsystems and updates their peaks.
+   * Returns true if the memory limit is exceeded.
+   */
+  bool checkMemory();
 }; /* class ResourceManager */
 
 }  // namespace cvc5::internal
@@ -17,11 +17,86 @@
 
 #include "util/statistics_registry.h"
 
+#include <cmath>
+#include <iomanip>
+
 #include "options/base_options.h"
 #include "util/statistics_public.h"
 
 namespace cvc5::internal {
 
+namespace {
+
+/** Print `s` as a JSON string. */
+void printJsonString(std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (char c : s)
+  {
+    switch (c)
+    {
+      case '"': os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      case '\n': os << "\\n"; break;
+      case '\t': os << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<int>(c) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+/** Print the statistic value `sed` as a JSON value. */
+void printJsonValue(std::ostream& os, const StatExportData& sed)
+{
+  if (std::holds_alternative<int64_t>(sed))
+  {
+    os << std::get<int64_t>(sed);
+  }
+  else if (std::holds_alternative<double>(sed))
+  {
+    double d = std::get<double>(sed);
+    if (std::isfinite(d))
+    {
+      std::streamsize precision = os.precision(15);
+      os << d;
+      os.precision(precision);
+    }
+    else
+    {
+      os << "null";
+    }
+  }
+  else if (std::holds_alternative<std::string>(sed))
+  {
+    printJsonString(os, std::get<std::string>(sed));
+  }
+  else
+  {
+    os << '{';
+    bool first = true;
+    const auto& hist = std::get<std::map<std::string, uint64_t>>(sed);
+    for (const auto& [key, count] : hist)
+    {
+      os << (first ? "" : ", ");
+      first = false;
+      printJsonString(os, key);
+      os << ": " << count;
+    }
+    os << '}';
+  }
+}
+
+}  // namespace
+
 StatisticsRegistry::StatisticsRegistry(bool internal,
                                        bool all,
                                        bool registerPublic)
@@ -42,11 +117,21 @@ IntStat StatisticsRegistry::registerInt(const std::string& name, bool internal)
 {
   return registerStat<IntStat>(name, internal);
 }
+ConcurrentIntStat StatisticsRegistry::registerConcurrentInt(
+    const std::string& name, bool internal)
+{
+  return registerStat<ConcurrentIntStat>(name, internal);
+}
 TimerStat StatisticsRegistry::registerTimer(const std::string& name,
                                             bool internal)
 {
   return registerStat<TimerStat>(name, internal);
 }
+CoarseTimerStat StatisticsRegistry::registerCoarseTimer(const std::string& name,
+                                                        bool internal)
+{
+  return registerStat<CoarseTimerStat>(name, internal);
+}
 
 void StatisticsRegistry::storeSnapshot()
 {
@@ -149,6 +234,28 @@ void StatisticsRegistry::printDiff(std::ostream& os) const
   }
 }
 
+void StatisticsRegistry::printJson(std::ostream& os,
+                                   const std::string& prefix) const
+{
+  os << '{';
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    bool first = true;
+    for (auto it = d_stats.lower_bound(prefix); it != d_stats.end(); ++it)
+    {
+      if (it->first.compare(0, prefix.size(), prefix) != 0) break;
+      if (!d_internal && it->second->d_internal) continue;
+      if (!d_all && it->second->isDefault()) continue;
+      os << (first ? "" : ", ");
+      first = false;
+      printJsonString(os, it->first);
+      os << ": ";
+      printJsonValue(os, it->second->getViewer());
+    }
+  }
+  os << '}';
+}
+
 void StatisticsRegistry::setStatsAll(bool val) { d_all = val; }
 
 void StatisticsRegistry::setStatsInternal(bool val) { d_internal = val; }
@@ -143,6 +143,9 @@ class StatisticsRegistry
 
   /** Register a new integer statistic for `name` */
   IntStat registerInt(const std::string& name, bool internal = true);
+  /** Register a new concurrent integer statistic for `name` */
+  ConcurrentIntStat registerConcurrentInt(const std::string& name,
+                                          bool internal = true);
 
   /** Register a new reference statistic for `name` */
   template <typename T>
@@ -181,6 +184,9 @@ class StatisticsRegistry
 
   /** Register a new timer statistic for `name` */
   TimerStat registerTimer(const std::string& name, bool internal = true);
+  /** Register a new coarse timer statistic for `name` */
+  CoarseTimerStat registerCoarseTimer(const std::string& name,
+                                      bool internal = true);
 
   /** Register a new value statistic for `name`. */
   template <typename T>
@@ -228,6 +234,13 @@ class StatisticsRegistry
    * Print all statistics as a diff to the last stored snapshot.
    */
   void printDiff(std::ostream& os) const;
+  /**
+   * Print all statistics whose name starts with `prefix` as a single JSON
+   * object (without a trailing newline) to the given output stream. Integers
+   * and doubles are printed as JSON numbers, histograms as JSON objects and
+   * all other values as JSON strings.
+   */
+  void printJson(std::ostream& os, const std::string& prefix = "") const;
   /**
    * Set d_all to val.
    */
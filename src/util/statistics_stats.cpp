@@ -93,7 +93,8 @@ void TimerStat::start()
   if constexpr (configuration::isStatisticsBuild())
   {
     Assert(!d_data->d_running) << "timer is already running";
-    d_data->d_start = StatisticTimerValue::clock::now();
+    d_data->d_start = d_data->d_coarse ? StatisticTimerValue::coarseNow()
+                                       : StatisticTimerValue::clock::now();
     d_data->d_running = true;
   }
 }
@@ -102,7 +103,9 @@ void TimerStat::stop()
   if constexpr (configuration::isStatisticsBuild())
   {
     Assert(d_data->d_running) << "timer is not running";
-    d_data->d_duration += StatisticTimerValue::clock::now() - d_data->d_start;
+    d_data->d_duration += (d_data->d_coarse ? StatisticTimerValue::coarseNow()
+                                            : StatisticTimerValue::clock::now())
+                          - d_data->d_start;
     d_data->d_running = false;
   }
 }
@@ -115,6 +118,8 @@ bool TimerStat::running() const
   return false;
 }
 
+CoarseTimerStat::CoarseTimerStat(stat_type* data) : TimerStat(data) {}
+
 CodeTimer::CodeTimer(TimerStat& timer, bool allow_reentrant)
     : d_timer(timer), d_reentrant(false)
 {
@@ -137,4 +142,29 @@ CodeTimer::~CodeTimer()
   }
 }
 
+ConcurrentIntStat& ConcurrentIntStat::operator++()
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    d_data->local().fetch_add(1, std::memory_order_relaxed);
+  }
+  return *this;
+}
+ConcurrentIntStat& ConcurrentIntStat::operator+=(int64_t val)
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    d_data->local().fetch_add(val, std::memory_order_relaxed);
+  }
+  return *this;
+}
+int64_t ConcurrentIntStat::get() const
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    return d_data->get();
+  }
+  return 0;
+}
+
 }  // namespace cvc5::internal
@@ -34,6 +34,8 @@ namespace cvc5::internal {
 struct StatisticAverageValue;
 template <typename T>
 struct StatisticBackedValue;
+struct StatisticCoarseTimerValue;
+struct StatisticConcurrentIntValue;
 template <typename T>
 struct StatisticHistogramValue;
 template <typename T>
@@ -92,6 +94,14 @@ class HistogramStat
     }
     return *this;
   }
+  /** Set the value for key `val` to `count` */
+  void set(Integral val, uint64_t count)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      d_data->set(val, count);
+    }
+  }
   /** Get the current value for key `val` */
   uint64_t getValue(Integral val) { return d_data->getValue(val); }
 
@@ -226,13 +236,34 @@ class TimerStat
   /** Checks whether the timer is running. */
   bool running() const;
 
- private:
+ protected:
   /** Construct from a pointer to the internal data */
   TimerStat(stat_type* data) : d_data(data) {}
   /** The actual data that lives in the registry */
   stat_type* d_data;
 };
 
+/**
+ * A `TimerStat` that reads a coarse monotonic clock (see
+ * `StatisticTimerValue::coarseNow()`). Starting and stopping it is
+ * considerably cheaper, which makes it suitable for code that is executed
+ * very often, but its resolution is only in the order of milliseconds. The
+ * accumulated time is thus only meaningful for code that runs for a
+ * substantial amount of time in total.
+ */
+class CoarseTimerStat : public TimerStat
+{
+ public:
+  /** Allow access to private constructor */
+  friend class StatisticsRegistry;
+  /** Value stored for this statistic */
+  using stat_type = StatisticCoarseTimerValue;
+
+ private:
+  /** Construct from a pointer to the internal data */
+  CoarseTimerStat(stat_type* data);
+};
+
 /**
  * Utility class to make it easier to call `stop` at the end of a code
  * block. When constructed, it starts the timer. When destructed, it stops
@@ -349,6 +380,36 @@ class IntStat : public ValueStat<int64_t>
   IntStat(stat_type* data) : ValueStat(data) {}
 };
 
+/**
+ * Stores an integer value that may be updated from multiple threads
+ * concurrently. Every thread updates its own shard of the value with relaxed
+ * atomic operations, and the shards are summed up when the value is read.
+ * Hence, updates are cheap while reading the value is comparatively
+ * expensive.
+ * Note that only the updates are thread-safe: the statistic itself has to be
+ * registered before it is used by multiple threads.
+ */
+class ConcurrentIntStat
+{
+ public:
+  /** Allow access to private constructor */
+  friend class StatisticsRegistry;
+  /** Value stored for this statistic */
+  using stat_type = StatisticConcurrentIntValue;
+  /** Pre-increment for the integer */
+  ConcurrentIntStat& operator++();
+  /** Add `val` to the integer */
+  ConcurrentIntStat& operator+=(int64_t val);
+  /** Returns the current value, summed over all threads */
+  int64_t get() const;
+
+ private:
+  /** Construct from a pointer to the internal data */
+  ConcurrentIntStat(stat_type* data) : d_data(data) {}
+  /** The actual data that lives in the registry */
+  stat_type* d_data;
+};
+
 }  // namespace cvc5::internal
 
 #endif
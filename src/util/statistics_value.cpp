@@ -25,6 +25,8 @@
 
 #include "util/statistics_value.h"
 
+#include <time.h>
+
 #include "util/ostream_util.h"
 
 namespace cvc5::internal {
@@ -83,6 +85,33 @@ void StatisticAverageValue::printSafe(int fd) const
 
 double StatisticAverageValue::get() const { return d_sum / d_count; }
 
+StatExportData StatisticConcurrentIntValue::getViewer() const { return get(); }
+
+bool StatisticConcurrentIntValue::isDefault() const { return get() == 0; }
+
+void StatisticConcurrentIntValue::printSafe(int fd) const
+{
+  safe_print<int64_t>(fd, get());
+}
+
+int64_t StatisticConcurrentIntValue::get() const
+{
+  int64_t res = 0;
+  for (const Shard& s : d_shards)
+  {
+    res += s.d_value.load(std::memory_order_relaxed);
+  }
+  return res;
+}
+
+size_t StatisticConcurrentIntValue::shardIndex()
+{
+  static std::atomic<size_t> s_nextShard{0};
+  thread_local size_t t_shard =
+      s_nextShard.fetch_add(1, std::memory_order_relaxed) % s_numShards;
+  return t_shard;
+}
+
 StatExportData StatisticTimerValue::getViewer() const
 {
   return std::to_string(get()) + "ms";
@@ -105,9 +134,25 @@ uint64_t StatisticTimerValue::get() const
   auto data = d_duration;
   if (d_running)
   {
-    data += clock::now() - d_start;
+    data += (d_coarse ? coarseNow() : clock::now()) - d_start;
   }
   return static_cast<int64_t>(data / std::chrono::milliseconds(1));
 }
 
+StatisticTimerValue::time_point StatisticTimerValue::coarseNow()
+{
+#ifdef CLOCK_MONOTONIC_COARSE
+  // steady_clock is based on CLOCK_MONOTONIC, which shares its epoch with
+  // CLOCK_MONOTONIC_COARSE
+  timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0)
+  {
+    return time_point(std::chrono::duration_cast<clock::duration>(
+        std::chrono::seconds(ts.tv_sec)
+        + std::chrono::nanoseconds(ts.tv_nsec)));
+  }
+#endif
+  return clock::now();
+}
+
 }  // namespace cvc5::internal
@@ -28,6 +28,8 @@
 #ifndef CVC5__UTIL__STATISTICS_VALUE_H
 #define CVC5__UTIL__STATISTICS_VALUE_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <map>
@@ -103,6 +105,41 @@ struct StatisticBackedValue : StatisticBaseValue
   T d_value;
 };
 
+/**
+ * Holds the data for a `ConcurrentIntStat`, an integer that may be updated
+ * from multiple threads at the same time.
+ * The value is split into a fixed number of shards, each on its own cache
+ * line. Every thread is assigned a shard once (round-robin) and only ever
+ * updates this shard, using relaxed atomic operations. As long as there are
+ * not more threads than shards, updates are thus never contended. The value
+ * of the statistic is the sum of all shards, which is computed on read.
+ */
+struct StatisticConcurrentIntValue : StatisticBaseValue
+{
+  /** The number of shards */
+  static constexpr size_t s_numShards = 16;
+  /** A single shard, aligned to avoid false sharing */
+  struct alignas(64) Shard
+  {
+    std::atomic<int64_t> d_value{0};
+  };
+
+  StatExportData getViewer() const override;
+  bool isDefault() const override;
+  void printSafe(int fd) const override;
+  /** Returns the sum of all shards */
+  int64_t get() const;
+  /** Returns the shard of the calling thread */
+  std::atomic<int64_t>& local()
+  {
+    return d_shards[shardIndex()].d_value;
+  }
+  /** Returns the index of the shard assigned to the calling thread */
+  static size_t shardIndex();
+
+  std::array<Shard, s_numShards> d_shards;
+};
+
 /**
  * Holds the data for a histogram. We assume the type to be (convertible to)
  * integral, and we can thus use a std::vector<uint64_t> for fast storage.
@@ -184,6 +221,35 @@ struct StatisticHistogramValue : StatisticBaseValue
     }
     d_hist[v - d_offset]++;
   }
+  /**
+   * Set the value stored for key `val` to `count`, resizing the vector as
+   * necessary.
+   */
+  void set(Integral val, uint64_t count)
+  {
+    int64_t v = static_cast<int64_t>(val);
+    if (count == 0
+        && (d_hist.empty() || v < d_offset
+            || static_cast<size_t>(v - d_offset) >= d_hist.size()))
+    {
+      // unset keys are zero already
+      return;
+    }
+    if (d_hist.empty())
+    {
+      d_offset = v;
+    }
+    if (v < d_offset)
+    {
+      d_hist.insert(d_hist.begin(), d_offset - v, 0);
+      d_offset = v;
+    }
+    if (static_cast<size_t>(v - d_offset) >= d_hist.size())
+    {
+      d_hist.resize(v - d_offset + 1);
+    }
+    d_hist[v - d_offset] = count;
+  }
   /** Get the value stored for key val */
   uint64_t getValue(Integral val)
   {
@@ -346,7 +412,8 @@ struct StatisticSizeValue : StatisticBaseValue
 /**
  * Holds the data for a `TimerStat`.
  * Uses `std::chrono` to obtain the current time, store a time point and sum up
- * the total durations.
+ * the total durations. If `d_coarse` is set, the time is instead obtained from
+ * `coarseNow()`.
  */
 struct StatisticTimerValue : StatisticBaseValue
 {
@@ -365,6 +432,13 @@ struct StatisticTimerValue : StatisticBaseValue
    * Make sure that we include the time of a currently running timer
    */
   uint64_t get() const;
+  /**
+   * Returns the current time of a clock that is considerably cheaper to read
+   * than `clock::now()`, at the cost of a lower resolution (typically a few
+   * milliseconds). Uses `CLOCK_MONOTONIC_COARSE` if available and falls back
+   * to `clock::now()` otherwise.
+   */
+  static time_point coarseNow();
 
   /**
    * The cumulative duration of the timer so far. 
@@ -378,6 +452,14 @@ struct StatisticTimerValue : StatisticBaseValue
   time_point d_start;
   /** Whether a timer is running right now. */
   bool d_running;
+  /** Whether the time is obtained from `coarseNow()`. */
+  bool d_coarse = false;
+};
+
+/** Holds the data for a `CoarseTimerStat`. */
+struct StatisticCoarseTimerValue : StatisticTimerValue
+{
+  StatisticCoarseTimerValue() : StatisticTimerValue() { d_coarse = true; }
 };
 
 }  // namespace cvc5::internal
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -63,24 +64,39 @@ String::String(const std::vector<unsigned> &s) : d_str(s)
 #endif
 }
 
+String::String(std::vector<unsigned>&& s) : d_str(std::move(s))
+{
+#ifdef CVC5_ASSERTIONS
+  for (unsigned u : d_str)
+  {
+    Assert(u < num_codes());
+  }
+#endif
+}
+
+bool String::equalCodes(const unsigned* a, const unsigned* b, std::size_t n)
+{
+  return n == 0 || std::memcmp(a, b, n * sizeof(unsigned)) == 0;
+}
+
 int String::cmp(const String &y) const {
   if (size() != y.size()) {
     return size() < y.size() ? -1 : 1;
   }
-  for (unsigned int i = 0; i < size(); ++i) {
-    if (d_str[i] != y.d_str[i]) {
-      unsigned cp = d_str[i];
-      unsigned cpy = y.d_str[i];
-      return cp < cpy ? -1 : 1;
-    }
+  auto [it, ity] = std::mismatch(d_str.begin(), d_str.end(), y.d_str.begin());
+  if (it != d_str.end())
+  {
+    return *it < *ity ? -1 : 1;
   }
   return 0;
 }
 
 String String::concat(const String &other) const {
-  std::vector<unsigned int> ret_vec(d_str);
+  std::vector<unsigned int> ret_vec;
+  ret_vec.reserve(d_str.size() + other.d_str.size());
+  ret_vec.insert(ret_vec.end(), d_str.begin(), d_str.end());
   ret_vec.insert(ret_vec.end(), other.d_str.begin(), other.d_str.end());
-  return String(ret_vec);
+  return String(std::move(ret_vec));
 }
 
 bool String::strncmp(const String& y, std::size_t n) const
@@ -94,10 +110,7 @@ bool String::strncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[i] != y.d_str[i]) return false;
-  }
-  return true;
+  return equalCodes(d_str.data(), y.d_str.data(), n);
 }
 
 bool String::rstrncmp(const String& y, std::size_t n) const
@@ -111,10 +124,8 @@ bool String::rstrncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[size() - i - 1] != y.d_str[y.size() - i - 1]) return false;
-  }
-  return true;
+  return equalCodes(
+      d_str.data() + size() - n, y.d_str.data() + y.size() - n, n);
 }
 
 void String::addCharToInternal(unsigned char ch, std::vector<unsigned>& str)
@@ -387,10 +398,19 @@ std::size_t String::find(const String &y, const std::size_t start) const {
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_iterator itr = std::search(
-      d_str.begin() + start, d_str.end(), y.d_str.begin(), y.d_str.end());
-  if (itr != d_str.end()) {
-    return itr - d_str.begin();
+  // Scan for the first character of y and compare the remaining ones with
+  // memcmp at each of its occurrences.
+  std::vector<unsigned>::const_iterator last = d_str.end() - y.size() + 1;
+  std::vector<unsigned>::const_iterator itr = d_str.begin() + start;
+  unsigned first = y.d_str[0];
+  size_t rest = y.size() - 1;
+  while ((itr = std::find(itr, last, first)) != last)
+  {
+    if (equalCodes(&*itr + 1, y.d_str.data() + 1, rest))
+    {
+      return itr - d_str.begin();
+    }
+    ++itr;
   }
   return std::string::npos;
 }
@@ -416,14 +436,7 @@ bool String::hasPrefix(const String& y) const
   {
     return false;
   }
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return equalCodes(d_str.data(), y.d_str.data(), ys);
 }
 
 bool String::hasSuffix(const String& y) const
@@ -434,15 +447,7 @@ bool String::hasSuffix(const String& y) const
   {
     return false;
   }
-  size_t idiff = s - ys;
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i + idiff] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return equalCodes(d_str.data() + s - ys, y.d_str.data(), ys);
 }
 
 String String::update(std::size_t i, const String& t) const
@@ -461,7 +466,7 @@ String String::update(std::size_t i, const String& t) const
       vec.insert(vec.end(), t.d_str.begin(), t.d_str.end());
       vec.insert(vec.end(), d_str.begin() + i + tnum, d_str.end());
     }
-    return String(vec);
+    return String(std::move(vec));
   }
   return *this;
 }
@@ -470,10 +475,11 @@ String String::replace(const String &s, const String &t) const {
   std::size_t ret = find(s);
   if (ret != std::string::npos) {
     std::vector<unsigned> vec;
+    vec.reserve(size() - s.size() + t.size());
     vec.insert(vec.begin(), d_str.begin(), d_str.begin() + ret);
     vec.insert(vec.end(), t.d_str.begin(), t.d_str.end());
     vec.insert(vec.end(), d_str.begin() + ret + s.size(), d_str.end());
-    return String(vec);
+    return String(std::move(vec));
   } else {
     return *this;
   }
@@ -481,18 +487,13 @@ String String::replace(const String &s, const String &t) const {
 
 String String::substr(std::size_t i) const {
   Assert(i <= size());
-  std::vector<unsigned> ret_vec;
-  std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, d_str.end());
-  return String(ret_vec);
+  return String(std::vector<unsigned>(d_str.begin() + i, d_str.end()));
 }
 
 String String::substr(std::size_t i, std::size_t j) const {
   Assert(i + j <= size());
-  std::vector<unsigned> ret_vec;
   std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, itr + j);
-  return String(ret_vec);
+  return String(std::vector<unsigned>(itr, itr + j));
 }
 
 bool String::isNumber() const {
@@ -82,13 +82,12 @@ class String
   {
   }
   explicit String(const std::vector<unsigned>& s);
+  explicit String(std::vector<unsigned>&& s);
 
-  String& operator=(const String& y) {
-    if (this != &y) {
-      d_str = y.d_str;
-    }
-    return *this;
-  }
+  String(const String& y) = default;
+  String(String&& y) = default;
+  String& operator=(const String& y) = default;
+  String& operator=(String&& y) = default;
 
   String concat(const String& other) const;
 
@@ -263,6 +262,11 @@ class String
    * positive number if *this > y.
    */
   int cmp(const String& y) const;
+  /**
+   * Returns true if the n code points starting at a and b are equal, which is
+   * checked with memcmp.
+   */
+  static bool equalCodes(const unsigned* a, const unsigned* b, std::size_t n);
 
   std::vector<unsigned> d_str;
 }; /* class String */
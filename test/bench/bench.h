@@ -0,0 +1,126 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Common header for the microbenchmarks.
+ */
+
+#ifndef CVC5__TEST__BENCH__BENCH_H
+#define CVC5__TEST__BENCH__BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cvc5::internal {
+namespace bench {
+
+/**
+ * The state of a running benchmark, which determines how many iterations of
+ * the benchmark are timed. A benchmark is a function that does its setup,
+ * then runs the code to measure in a loop of the form
+ *
+ *   while (state.keepRunning()) { ... }
+ *
+ * and finally cleans up. Only the loop is timed.
+ */
+class State
+{
+ public:
+  explicit State(uint64_t iterations);
+  /** Return true if another iteration should be run. */
+  bool keepRunning()
+  {
+    if (d_remaining == d_iterations)
+    {
+      resumeTiming();
+    }
+    if (d_remaining == 0)
+    {
+      pauseTiming();
+      return false;
+    }
+    --d_remaining;
+    return true;
+  }
+  /** Stop the timer, e.g. to (re)build inputs in the loop. */
+  void pauseTiming();
+  /** Restart the timer after pauseTiming. */
+  void resumeTiming();
+  /** Set the number of items processed per iteration. */
+  void setItemsPerIteration(uint64_t items) { d_items = items; }
+  /** Get the number of timed iterations. */
+  uint64_t getIterations() const { return d_iterations; }
+  /** Get the number of items processed per iteration. */
+  uint64_t getItemsPerIteration() const { return d_items; }
+  /** Get the time spent in the timed parts of the benchmark. */
+  std::chrono::nanoseconds getElapsed() const { return d_elapsed; }
+
+ private:
+  using clock = std::chrono::steady_clock;
+  /** The number of iterations to run. */
+  uint64_t d_iterations;
+  /** The number of remaining iterations. */
+  uint64_t d_remaining;
+  /** The number of items processed per iteration. */
+  uint64_t d_items;
+  /** Whether the timer is running. */
+  bool d_running;
+  /** The start of the current timed interval. */
+  clock::time_point d_start;
+  /** The accumulated time. */
+  std::chrono::nanoseconds d_elapsed;
+};
+
+/** The function of a benchmark. */
+using BenchmarkFunction = void (*)(State&);
+
+/** A registered benchmark. */
+struct Benchmark
+{
+  /** The name, which is "<group>/<name>". */
+  std::string d_name;
+  /** The function. */
+  BenchmarkFunction d_function;
+};
+
+/** Get the registered benchmarks. */
+std::vector<Benchmark>& getBenchmarks();
+
+/** Registers a benchmark on construction. */
+class Registration
+{
+ public:
+  Registration(const char* group, const char* name, BenchmarkFunction f);
+};
+
+/**
+ * Prevent the compiler from optimizing away the computation of value.
+ */
+template <class T>
+inline void doNotOptimize(const T& value)
+{
+  asm volatile("" : : "m"(value) : "memory");
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
+
+/** Define and register the benchmark function `group/name`. */
+#define CVC5_BENCHMARK(group, name)                                        \
+  static void bench_##group##_##name(::cvc5::internal::bench::State&);     \
+  static ::cvc5::internal::bench::Registration bench_reg_##group##_##name( \
+      #group, #name, bench_##group##_##name);                              \
+  static void bench_##group##_##name(                                      \
+      [[maybe_unused]] ::cvc5::internal::bench::State& state)
+
+#endif
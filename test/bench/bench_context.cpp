@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Microbenchmarks for contexts and context-dependent data structures.
+ */
+
+#include <vector>
+
+#include "bench.h"
+#include "context/cdhashmap.h"
+#include "context/cdlist.h"
+#include "context/cdo.h"
+#include "context/context.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+using namespace context;
+
+namespace {
+
+/** The number of context levels per iteration. */
+const size_t s_numLevels = 100;
+/** The number of updates per context level. */
+const size_t s_numUpdates = 10;
+
+}  // namespace
+
+CVC5_BENCHMARK(context, pushPop)
+{
+  Context c;
+  state.setItemsPerIteration(s_numLevels);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numLevels; i++)
+    {
+      c.push();
+    }
+    c.popto(0);
+  }
+}
+
+CVC5_BENCHMARK(context, cdo)
+{
+  Context c;
+  std::vector<CDO<size_t>*> objs;
+  for (size_t i = 0; i < s_numUpdates; i++)
+  {
+    objs.push_back(new (true) CDO<size_t>(&c, 0));
+  }
+  state.setItemsPerIteration(s_numLevels * s_numUpdates);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numLevels; i++)
+    {
+      c.push();
+      for (CDO<size_t>* o : objs)
+      {
+        *o = i;
+      }
+    }
+    c.popto(0);
+  }
+  for (CDO<size_t>* o : objs)
+  {
+    o->deleteSelf();
+  }
+}
+
+CVC5_BENCHMARK(context, cdlist)
+{
+  Context c;
+  CDList<size_t> list(&c);
+  state.setItemsPerIteration(s_numLevels * s_numUpdates);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numLevels; i++)
+    {
+      c.push();
+      for (size_t j = 0; j < s_numUpdates; j++)
+      {
+        list.push_back(j);
+      }
+    }
+    c.popto(0);
+  }
+}
+
+CVC5_BENCHMARK(context, cdhashmap)
+{
+  Context c;
+  CDHashMap<size_t, size_t> map(&c);
+  state.setItemsPerIteration(s_numLevels * s_numUpdates);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numLevels; i++)
+    {
+      c.push();
+      for (size_t j = 0; j < s_numUpdates; j++)
+      {
+        // both new keys and updates of keys of lower levels
+        map[(i * s_numUpdates + j) / 2] = j;
+      }
+    }
+    c.popto(0);
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
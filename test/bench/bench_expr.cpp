@@ -0,0 +1,194 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Microbenchmarks for node construction, attributes and the rewriter.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "bench.h"
+#include "expr/attribute.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+#include "theory/rewriter.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+namespace {
+
+/** The number of terms built per iteration. */
+const size_t s_numTerms = 1000;
+
+/** Make n fresh variables of the given type. */
+std::vector<Node> mkVars(NodeManager& nm, const TypeNode& tn, size_t n)
+{
+  SkolemManager* sm = nm.getSkolemManager();
+  std::vector<Node> vars;
+  for (size_t i = 0; i < n; i++)
+  {
+    vars.push_back(sm->mkDummySkolem("x" + std::to_string(i), tn));
+  }
+  return vars;
+}
+
+/**
+ * Make a DAG over vars of the form (+ (* c x_i) ...) <= (+ ...), with
+ * constants and duplicated subterms that the rewriter simplifies.
+ */
+Node mkArithDag(NodeManager& nm, const std::vector<Node>& vars)
+{
+  std::vector<Node> lhs;
+  std::vector<Node> rhs;
+  for (size_t i = 0, n = vars.size(); i < n; i++)
+  {
+    Node c = nm.mkConstInt(Rational(static_cast<int64_t>(i % 7) + 1));
+    Node t = nm.mkNode(Kind::MULT, c, vars[i]);
+    lhs.push_back(nm.mkNode(Kind::ADD, t, vars[(i + 1) % n]));
+    rhs.push_back(nm.mkNode(Kind::SUB, vars[(i + 3) % n], t));
+  }
+  std::vector<Node> atoms;
+  for (size_t i = 0, n = lhs.size(); i < n; i++)
+  {
+    atoms.push_back(nm.mkNode(Kind::LEQ, lhs[i], rhs[(i + 5) % n]));
+  }
+  return nm.mkNode(Kind::AND, atoms);
+}
+
+struct BenchAttrId
+{
+};
+using BenchAttr = expr::Attribute<BenchAttrId, uint64_t>;
+
+}  // namespace
+
+CVC5_BENCHMARK(node, mkNodeExisting)
+{
+  // all nodes are built once before, the iterations measure the lookup of
+  // existing nodes in the node pool
+  NodeManager nm;
+  std::vector<Node> vars = mkVars(nm, nm.integerType(), s_numTerms);
+  std::vector<Node> terms;
+  for (size_t i = 0; i < s_numTerms; i++)
+  {
+    terms.push_back(
+        nm.mkNode(Kind::ADD, vars[i], vars[(i + 1) % s_numTerms]));
+  }
+  state.setItemsPerIteration(s_numTerms);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numTerms; i++)
+    {
+      Node n = nm.mkNode(Kind::ADD, vars[i], vars[(i + 1) % s_numTerms]);
+      doNotOptimize(n);
+    }
+  }
+}
+
+CVC5_BENCHMARK(node, mkNodeNew)
+{
+  // each iteration builds nodes that are not in the node pool
+  NodeManager nm;
+  std::vector<Node> vars = mkVars(nm, nm.integerType(), s_numTerms);
+  std::vector<Node> terms;
+  int64_t c = 0;
+  state.setItemsPerIteration(s_numTerms);
+  while (state.keepRunning())
+  {
+    for (size_t i = 0; i < s_numTerms; i++)
+    {
+      terms.push_back(
+          nm.mkNode(Kind::ADD, vars[i], nm.mkConstInt(Rational(c++))));
+    }
+    state.pauseTiming();
+    terms.clear();
+    state.resumeTiming();
+  }
+}
+
+CVC5_BENCHMARK(node, attributeGet)
+{
+  NodeManager nm;
+  std::vector<Node> vars = mkVars(nm, nm.integerType(), s_numTerms);
+  for (size_t i = 0; i < s_numTerms; i++)
+  {
+    vars[i].setAttribute(BenchAttr(), i);
+  }
+  state.setItemsPerIteration(s_numTerms);
+  while (state.keepRunning())
+  {
+    uint64_t sum = 0;
+    for (const Node& v : vars)
+    {
+      sum += v.getAttribute(BenchAttr());
+    }
+    doNotOptimize(sum);
+  }
+}
+
+CVC5_BENCHMARK(node, attributeSet)
+{
+  NodeManager nm;
+  std::vector<Node> vars = mkVars(nm, nm.integerType(), s_numTerms);
+  uint64_t c = 0;
+  state.setItemsPerIteration(s_numTerms);
+  while (state.keepRunning())
+  {
+    for (Node& v : vars)
+    {
+      v.setAttribute(BenchAttr(), c++);
+    }
+  }
+}
+
+CVC5_BENCHMARK(rewriter, arithDag)
+{
+  // the rewriter caches its results, hence each iteration rewrites the same
+  // DAG over fresh variables
+  NodeManager nm;
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  theory::Rewriter* rr = slv.getEnv().getRewriter();
+  const size_t numVars = 100;
+  state.setItemsPerIteration(numVars);
+  while (state.keepRunning())
+  {
+    state.pauseTiming();
+    Node dag = mkArithDag(nm, mkVars(nm, nm.integerType(), numVars));
+    state.resumeTiming();
+    Node res = rr->rewrite(dag);
+    doNotOptimize(res);
+  }
+}
+
+CVC5_BENCHMARK(rewriter, cached)
+{
+  NodeManager nm;
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  theory::Rewriter* rr = slv.getEnv().getRewriter();
+  Node dag = mkArithDag(nm, mkVars(nm, nm.integerType(), 100));
+  rr->rewrite(dag);
+  while (state.keepRunning())
+  {
+    Node res = rr->rewrite(dag);
+    doNotOptimize(res);
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
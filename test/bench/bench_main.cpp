@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The driver of the microbenchmarks.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "bench.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+State::State(uint64_t iterations)
+    : d_iterations(iterations),
+      d_remaining(iterations),
+      d_items(0),
+      d_running(false),
+      d_elapsed(0)
+{
+}
+
+void State::pauseTiming()
+{
+  if (d_running)
+  {
+    d_elapsed += clock::now() - d_start;
+    d_running = false;
+  }
+}
+
+void State::resumeTiming()
+{
+  if (!d_running)
+  {
+    d_start = clock::now();
+    d_running = true;
+  }
+}
+
+std::vector<Benchmark>& getBenchmarks()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+Registration::Registration(const char* group,
+                           const char* name,
+                           BenchmarkFunction f)
+{
+  getBenchmarks().push_back({std::string(group) + "/" + name, f});
+}
+
+namespace {
+
+/** The results of a benchmark. */
+struct Result
+{
+  std::string d_name;
+  uint64_t d_iterations;
+  uint64_t d_items;
+  /** The time per iteration of each repetition. */
+  std::vector<double> d_nsPerIteration;
+};
+
+/**
+ * Run the benchmark, where the number of iterations is increased until the
+ * benchmark runs for at least minTime milliseconds, and then repeated.
+ */
+Result run(const Benchmark& b, uint64_t minTime, uint64_t repetitions)
+{
+  const double minNs = static_cast<double>(minTime) * 1e6;
+  uint64_t iterations = 1;
+  while (true)
+  {
+    State s(iterations);
+    b.d_function(s);
+    double ns = static_cast<double>(s.getElapsed().count());
+    if (ns >= minNs || iterations >= 1000000000)
+    {
+      break;
+    }
+    // estimate the required number of iterations, with some margin
+    double factor = ns <= 0 ? 100 : std::min(100.0, 1.4 * minNs / ns);
+    iterations = std::max(iterations + 1,
+                          static_cast<uint64_t>(iterations * factor));
+  }
+  Result res{b.d_name, iterations, 0, {}};
+  for (uint64_t i = 0; i < repetitions; i++)
+  {
+    State s(iterations);
+    b.d_function(s);
+    res.d_items = s.getItemsPerIteration();
+    res.d_nsPerIteration.push_back(static_cast<double>(s.getElapsed().count())
+                                   / iterations);
+  }
+  std::sort(res.d_nsPerIteration.begin(), res.d_nsPerIteration.end());
+  return res;
+}
+
+double median(const std::vector<double>& v)
+{
+  size_t n = v.size();
+  return n % 2 == 1 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+void printJson(std::ostream& out, const std::vector<Result>& results)
+{
+  out << "{" << std::endl << "  \"benchmarks\": [";
+  for (size_t i = 0, n = results.size(); i < n; i++)
+  {
+    const Result& r = results[i];
+    out << (i == 0 ? "" : ",") << std::endl
+        << "    {\"name\": \"" << r.d_name << "\", \"iterations\": "
+        << r.d_iterations << ", \"items_per_iteration\": " << r.d_items
+        << ", \"median_ns\": " << median(r.d_nsPerIteration)
+        << ", \"min_ns\": " << r.d_nsPerIteration.front()
+        << ", \"max_ns\": " << r.d_nsPerIteration.back() << "}";
+  }
+  out << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+void usage(const char* name)
+{
+  std::cerr << "usage: " << name << " [options]" << std::endl
+            << "  --filter=STR      only run the benchmarks containing STR"
+            << std::endl
+            << "  --list            list the benchmarks" << std::endl
+            << "  --min-time=MS     minimal time of each run (default: 200)"
+            << std::endl
+            << "  --repetitions=N   runs of each benchmark (default: 5)"
+            << std::endl
+            << "  --json=FILE       write the results as JSON to FILE"
+            << std::endl;
+}
+
+}  // namespace
+
+}  // namespace bench
+}  // namespace cvc5::internal
+
+using namespace cvc5::internal::bench;
+
+int main(int argc, char* argv[])
+{
+  std::string filter;
+  std::string json;
+  bool list = false;
+  uint64_t minTime = 200;
+  uint64_t repetitions = 5;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg(argv[i]);
+    if (arg.rfind("--filter=", 0) == 0)
+    {
+      filter = arg.substr(std::strlen("--filter="));
+    }
+    else if (arg.rfind("--json=", 0) == 0)
+    {
+      json = arg.substr(std::strlen("--json="));
+    }
+    else if (arg.rfind("--min-time=", 0) == 0)
+    {
+      minTime = std::stoull(arg.substr(std::strlen("--min-time=")));
+    }
+    else if (arg.rfind("--repetitions=", 0) == 0)
+    {
+      repetitions = std::max<uint64_t>(
+          1, std::stoull(arg.substr(std::strlen("--repetitions="))));
+    }
+    else if (arg == "--list")
+    {
+      list = true;
+    }
+    else
+    {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  std::vector<Benchmark> benchmarks = getBenchmarks();
+  std::sort(benchmarks.begin(),
+            benchmarks.end(),
+            [](const Benchmark& a, const Benchmark& b) {
+              return a.d_name < b.d_name;
+            });
+  std::vector<Result> results;
+  for (const Benchmark& b : benchmarks)
+  {
+    if (b.d_name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+    if (list)
+    {
+      std::cout << b.d_name << std::endl;
+      continue;
+    }
+    Result r = run(b, minTime, repetitions);
+    double ns = median(r.d_nsPerIteration);
+    std::cout << std::left << std::setw(40) << r.d_name << std::right
+              << std::setw(14) << std::fixed << std::setprecision(1) << ns
+              << " ns" << std::setw(12) << r.d_iterations << " iterations";
+    if (r.d_items > 0)
+    {
+      std::cout << std::setw(10) << std::setprecision(2) << ns / r.d_items
+                << " ns/item";
+    }
+    std::cout << std::endl;
+    results.push_back(r);
+  }
+  if (!json.empty())
+  {
+    std::ofstream out(json);
+    printJson(out, results);
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Microbenchmarks for the SMT-LIB lexer.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include "bench.h"
+#include "parser/input.h"
+#include "parser/smt2/smt2_lexer.h"
+#include "parser/tokens.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+using namespace cvc5::parser;
+
+namespace {
+
+/** Make an SMT-LIB script with n assertions. */
+std::string mkScript(size_t n)
+{
+  std::stringstream ss;
+  ss << "(set-logic QF_LIA)" << std::endl;
+  for (size_t i = 0; i < n; i++)
+  {
+    ss << "(declare-fun |x " << i << "| () Int)" << std::endl;
+  }
+  for (size_t i = 0; i < n; i++)
+  {
+    ss << "(assert (! (<= (+ (* " << i << " |x " << i << "|) |x "
+       << (i + 1) % n << "|) " << i * 31 << ") :named a" << i
+       << ")) ; constraint " << i << std::endl;
+  }
+  ss << "(check-sat)" << std::endl;
+  return ss.str();
+}
+
+}  // namespace
+
+CVC5_BENCHMARK(parser, smt2Lexer)
+{
+  const size_t numAsserts = 1000;
+  std::string script = mkScript(numAsserts);
+  size_t tokens = 0;
+  while (state.keepRunning())
+  {
+    std::unique_ptr<Input> input = Input::mkStringInput(script);
+    Smt2Lexer lexer(false, false);
+    lexer.initialize(input.get(), "bench");
+    while (lexer.nextToken() != Token::EOF_TOK)
+    {
+      tokens++;
+    }
+  }
+  state.setItemsPerIteration(tokens
+                             / std::max<uint64_t>(1, state.getIterations()));
+  doNotOptimize(tokens);
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
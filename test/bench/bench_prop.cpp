@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Microbenchmarks for the CNF conversion.
+ */
+
+#include <vector>
+
+#include "bench.h"
+#include "context/context.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "prop/cnf_stream.h"
+#include "prop/registrar.h"
+#include "prop/sat_solver.h"
+#include "smt/solver_engine.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+using namespace prop;
+
+namespace {
+
+/** A SAT solver that only counts the clauses added to it. */
+class CountingSatSolver : public SatSolver
+{
+ public:
+  CountingSatSolver() : d_nextVar(0), d_numClauses(0) {}
+
+  ClauseId addClause(SatClause& c, bool lemma) override
+  {
+    ++d_numClauses;
+    return ClauseIdUndef;
+  }
+
+  ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override
+  {
+    ++d_numClauses;
+    return ClauseIdUndef;
+  }
+
+  SatVariable newVar(bool theoryAtom, bool canErase) override
+  {
+    return d_nextVar++;
+  }
+
+  SatVariable trueVar() override { return d_nextVar++; }
+
+  SatVariable falseVar() override { return d_nextVar++; }
+
+  SatValue solve() override { return SAT_VALUE_UNKNOWN; }
+
+  SatValue solve(long unsigned int& resource) override
+  {
+    return SAT_VALUE_UNKNOWN;
+  }
+
+  void interrupt() override {}
+
+  SatValue value(SatLiteral l) override { return SAT_VALUE_UNKNOWN; }
+
+  SatValue modelValue(SatLiteral l) override { return SAT_VALUE_UNKNOWN; }
+
+  uint32_t getAssertionLevel() const override { return 0; }
+
+  bool ok() const override { return true; }
+
+  size_t numClauses() const { return d_numClauses; }
+
+ private:
+  SatVariable d_nextVar;
+  size_t d_numClauses;
+};
+
+/**
+ * Make a Boolean formula over n variables with nested and/or/xor/ite
+ * connectives that share subformulas.
+ */
+Node mkFormula(NodeManager& nm, size_t n)
+{
+  SkolemManager* sm = nm.getSkolemManager();
+  TypeNode boolType = nm.booleanType();
+  std::vector<Node> vars;
+  for (size_t i = 0; i < n; i++)
+  {
+    vars.push_back(sm->mkDummySkolem("p" + std::to_string(i), boolType));
+  }
+  std::vector<Node> layer = vars;
+  Kind kinds[] = {Kind::AND, Kind::OR, Kind::XOR, Kind::EQUAL};
+  for (size_t k = 0; layer.size() > 1; k++)
+  {
+    std::vector<Node> next;
+    for (size_t i = 0; i + 1 < layer.size(); i += 2)
+    {
+      Node a = layer[i];
+      Node b = layer[i + 1];
+      next.push_back(i % 3 == 2 ? nm.mkNode(Kind::ITE, vars[i], a, b.notNode())
+                                : nm.mkNode(kinds[(i + k) % 4], a, b));
+    }
+    if (layer.size() % 2 == 1)
+    {
+      next.push_back(layer.back());
+    }
+    layer = next;
+  }
+  return layer[0];
+}
+
+}  // namespace
+
+CVC5_BENCHMARK(prop, cnfStream)
+{
+  NodeManager nm;
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  CountingSatSolver sat;
+  context::Context c;
+  NullRegistrar registrar;
+  CnfStream cnf(slv.getEnv(), &sat, &registrar, &c);
+  const size_t numVars = 1000;
+  Node f = mkFormula(nm, numVars);
+  state.setItemsPerIteration(numVars);
+  while (state.keepRunning())
+  {
+    // the translation cache of the CNF stream is context dependent, hence the
+    // formula is converted anew in each iteration
+    c.push();
+    cnf.convertAndAssert(f, false, false);
+    state.pauseTiming();
+    c.pop();
+    state.resumeTiming();
+  }
+  doNotOptimize(sat.numClauses());
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Microbenchmarks for the equality engine and the arithmetic solver.
+ */
+
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "context/context.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "smt/solver_engine.h"
+#include "theory/uf/equality_engine.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+namespace {
+
+/** The number of terms of the equality engine benchmarks. */
+const size_t s_numTerms = 1000;
+
+}  // namespace
+
+CVC5_BENCHMARK(ee, mergeExplain)
+{
+  // merges a chain of equalities x_i = x_{i+1}, which are propagated by
+  // congruence to f(x_i) = f(x_{i+1}), and explains f(x_0) = f(x_n)
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  context::Context c;
+  theory::eq::EqualityEngine ee(slv.getEnv(), &c, "bench", false);
+  ee.addFunctionKind(Kind::APPLY_UF);
+  TypeNode u = nm.mkSort("U");
+  Node f = sm->mkDummySkolem("f", nm.mkFunctionType(u, u));
+  std::vector<Node> vars;
+  std::vector<Node> apps;
+  std::vector<Node> eqs;
+  for (size_t i = 0; i < s_numTerms; i++)
+  {
+    vars.push_back(sm->mkDummySkolem("x" + std::to_string(i), u));
+    apps.push_back(nm.mkNode(Kind::APPLY_UF, f, vars.back()));
+    ee.addTerm(apps.back());
+  }
+  for (size_t i = 0; i + 1 < s_numTerms; i++)
+  {
+    eqs.push_back(vars[i].eqNode(vars[i + 1]));
+  }
+  std::vector<TNode> assumptions;
+  state.setItemsPerIteration(s_numTerms);
+  while (state.keepRunning())
+  {
+    c.push();
+    for (const Node& eq : eqs)
+    {
+      ee.assertEquality(eq, true, eq);
+    }
+    assumptions.clear();
+    ee.explainEquality(apps.front(), apps.back(), true, assumptions);
+    doNotOptimize(assumptions.size());
+    c.pop();
+  }
+}
+
+CVC5_BENCHMARK(arith, simplexCheck)
+{
+  // checks a system of linear constraints, which exercises the pivoting of
+  // the simplex solver
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  SolverEngine slv(&nm);
+  slv.setOption("incremental", "true");
+  slv.setLogic(std::string("QF_LRA"));
+  slv.finishInit();
+  const size_t numVars = 30;
+  TypeNode real = nm.realType();
+  std::vector<Node> vars;
+  for (size_t i = 0; i < numVars; i++)
+  {
+    vars.push_back(sm->mkDummySkolem("x" + std::to_string(i), real));
+  }
+  std::vector<Node> constraints;
+  for (size_t i = 0; i < numVars; i++)
+  {
+    std::vector<Node> sum;
+    for (size_t j = 0; j < 4; j++)
+    {
+      size_t k = (i * 7 + j * 13) % numVars;
+      Node c = nm.mkConstReal(Rational(static_cast<int64_t>((i + j) % 5) - 2));
+      sum.push_back(nm.mkNode(Kind::MULT, c, vars[k]));
+    }
+    Node bound = nm.mkConstReal(Rational(static_cast<int64_t>(i % 11)));
+    constraints.push_back(
+        nm.mkNode(i % 2 == 0 ? Kind::LEQ : Kind::GEQ,
+                  nm.mkNode(Kind::ADD, sum),
+                  bound));
+    constraints.push_back(nm.mkNode(
+        Kind::GEQ, vars[i], nm.mkConstReal(Rational(-100))));
+  }
+  while (state.keepRunning())
+  {
+    slv.push();
+    for (const Node& cons : constraints)
+    {
+      slv.assertFormula(cons);
+    }
+    Result r = slv.checkSat();
+    doNotOptimize(r);
+    slv.pop();
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --gomory-rounds=10
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (and (>= x 0) (<= x 100) (>= y 0) (<= y 100) (>= z 0) (<= z 1)))
+(assert (= (+ (* 3 x) (* 5 y)) (+ 7 (* 1000 z))))
+(assert (<= (+ x y) 2))
+(check-sat)
@@ -0,0 +1,11 @@
+; COMMAND-LINE: --pp-assert-solve-any
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (= (+ x (* 2 y)) 3))
+(assert (= (+ y z) 1))
+(assert (>= x 2))
+(assert (>= y 1))
+(check-sat)
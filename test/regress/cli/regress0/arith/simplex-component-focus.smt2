@@ -0,0 +1,12 @@
+; COMMAND-LINE: --use-fcsimplex --simplex-component-focus
+; EXPECT: sat
+(set-logic QF_LRA)
+(declare-fun a () Real)
+(declare-fun b () Real)
+(declare-fun c () Real)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (and (>= (+ a b) 3) (<= (- a c) 1) (>= (+ b c) 5) (<= (+ a b c) 7)))
+(assert (and (>= (+ x y) 4) (<= (- x z) 2) (>= (+ y z) 6) (<= (+ x y z) 8)))
+(check-sat)
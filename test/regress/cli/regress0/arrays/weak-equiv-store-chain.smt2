@@ -0,0 +1,18 @@
+; COMMAND-LINE: --arrays-weak-equiv
+; EXPECT: unsat
+(set-logic QF_AUFLIA)
+(declare-fun a () (Array Int Int))
+(declare-fun b () (Array Int Int))
+(declare-fun c () (Array Int Int))
+(declare-fun i () Int)
+(declare-fun j () Int)
+(declare-fun k () Int)
+(assert (= b (store (store (store a 1 10) 2 20) 3 30)))
+(assert (= c (store b j 40)))
+(assert (not (= i 1)))
+(assert (not (= i 2)))
+(assert (not (= i 3)))
+(assert (not (= i j)))
+(assert (= i k))
+(assert (not (= (select a i) (select c k))))
+(check-sat)
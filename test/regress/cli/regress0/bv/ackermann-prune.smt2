@@ -0,0 +1,18 @@
+; COMMAND-LINE: --ackermann
+; COMMAND-LINE: --ackermann --no-ackermann-prune
+; EXPECT: unsat
+(set-logic QF_UFBV)
+
+(declare-fun f ((_ BitVec 8) (_ BitVec 8)) (_ BitVec 8))
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+
+(assert (= (f #x01 #x00) #x0a))
+(assert (= (f #x02 #x00) #x0b))
+(assert (= (f #x03 #x00) #x0c))
+(assert (= (f #x02 y) #x0d))
+(assert (= x #x02))
+(assert (or (distinct (f x #x00) #x0b) (= y #x00)))
+(assert (= (f x #x00) (f #x03 #x00)))
+
+(check-sat)
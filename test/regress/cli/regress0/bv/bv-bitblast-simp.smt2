@@ -0,0 +1,14 @@
+; COMMAND-LINE: --incremental --bv-bitblast-simp
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun a () (_ BitVec 8))
+(declare-fun b () (_ BitVec 8))
+(declare-fun c () (_ BitVec 8))
+(push 1)
+(assert (distinct (bvxor (bvand a b) (bvor c a)) (bvxor (bvor a c) (bvand b a))))
+(check-sat)
+(pop 1)
+(assert (= (bvmul a b) (bvadd c #x01)))
+(assert (bvult c (bvand a b)))
+(check-sat)
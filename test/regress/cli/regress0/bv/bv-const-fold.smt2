@@ -0,0 +1,9 @@
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 80))
+(assert (= x (bvadd (bvmul #x03 (bvnot #x0f)) ((_ extract 7 0) (concat #x12 (bvudiv #xa5 #x00))))))
+(assert (bvslt (bvashr #x80 #x01) ((_ sign_extend 4) #xf)))
+(assert (= y (bvurem ((_ repeat 10) (bvxor #xff #x0f)) ((_ zero_extend 72) #x07))))
+(assert (not (= (bvshl x #x01) (bvor x (bvand #x0f #xf0)))))
+(check-sat)
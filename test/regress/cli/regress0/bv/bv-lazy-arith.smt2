@@ -0,0 +1,21 @@
+; COMMAND-LINE: --incremental --bv-lazy-arith=8
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun a () (_ BitVec 16))
+(declare-fun b () (_ BitVec 16))
+(declare-fun c () (_ BitVec 16))
+(assert (= (bvmul a b) #x0023))
+(assert (bvugt a #x0001))
+(assert (bvugt b #x0001))
+(check-sat)
+(push 1)
+(assert (bvult a #x0005))
+(assert (bvult b #x0005))
+(check-sat)
+(pop 1)
+(assert (= c (bvudiv #x0023 a)))
+(assert (= (bvurem #x0023 b) #x0000))
+(assert (bvule c b))
+(check-sat)
@@ -0,0 +1,23 @@
+; COMMAND-LINE: --incremental --bv-word-prop
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun p () Bool)
+(push 1)
+(assert (or p (bvult x #x05)))
+(assert (or (not p) (bvult x #x03)))
+(assert (bvugt x #x0a))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= ((_ extract 7 4) x) #xf))
+(assert (bvule x #x80))
+(check-sat)
+(pop 1)
+(assert (= ((_ extract 3 0) y) #x3))
+(assert (bvult y #x14))
+(assert (not (= y #x03)))
+(check-sat)
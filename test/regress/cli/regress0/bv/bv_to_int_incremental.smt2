@@ -0,0 +1,23 @@
+; COMMAND-LINE: --incremental --solve-bv-as-int=sum --bv-to-int-incremental
+; COMMAND-LINE: --incremental --solve-bv-as-int=bitwise --bv-to-int-incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 4))
+(declare-fun y () (_ BitVec 4))
+(push 1)
+(assert (= (bvadd x y) #x0))
+(assert (= (bvand x y) #x1))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= (bvand x y) #x1))
+(assert (= (bvand x #x1) #x0))
+(check-sat)
+(pop 1)
+(assert (= (bvadd x y) #x0))
+(assert (bvult x #x2))
+(assert (bvult y #x2))
+(assert (not (= x #x0)))
+(check-sat)
@@ -0,0 +1,28 @@
+; COMMAND-LINE: -i --bv-solver=bitblast --bv-assert-input
+(set-logic QF_BV)
+(set-option :global-declarations true)
+
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+
+(assert (= (bvmul a b) #x06))
+(assert (= a #x00))
+(set-info :status unsat)
+(check-sat)
+
+(reset-assertions)
+
+(assert (= (bvmul a b) #x06))
+(set-info :status sat)
+(check-sat)
+
+(push 1)
+(assert (bvult a #x02))
+(assert (bvult b #x02))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+
+(assert (= b #x03))
+(set-info :status sat)
+(check-sat)
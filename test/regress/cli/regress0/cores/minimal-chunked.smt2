@@ -0,0 +1,20 @@
+; COMMAND-LINE: --minimal-unsat-cores --minimal-unsat-cores-chunked
+; EXPECT: unsat
+; EXPECT: (
+; EXPECT: a2
+; EXPECT: a5
+; EXPECT: )
+(set-logic QF_LIA)
+(set-option :produce-unsat-cores true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (! (> x 0) :named a0))
+(assert (! (> y x) :named a1))
+(assert (! (> z 10) :named a2))
+(assert (! (< y 100) :named a3))
+(assert (! (> (+ x y) 1) :named a4))
+(assert (! (< z 5) :named a5))
+(assert (! (>= (+ x z) 0) :named a6))
+(check-sat)
+(get-unsat-core)
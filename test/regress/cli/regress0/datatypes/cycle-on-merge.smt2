@@ -0,0 +1,11 @@
+; EXPECT: unsat
+(set-logic QF_DT)
+(declare-datatypes ((Lst 0)) (((cons (hd Bool) (tl Lst)) (nil))))
+(declare-fun x () Lst)
+(declare-fun y () Lst)
+(declare-fun z () Lst)
+(declare-fun b () Bool)
+(assert (= x (cons b y)))
+(assert (= z (cons b (cons (not b) x))))
+(assert (or (= y x) (= y z)))
+(check-sat)
@@ -0,0 +1,19 @@
+; COMMAND-LINE: --dt-lazy-enum-split --check-models
+; EXPECT: sat
+(set-logic QF_UFDT)
+(declare-datatypes ((E 0)) ((
+  (C0) (C1) (C2) (C3) (C4) (C5) (C6) (C7) (C8) (C9)
+  (C10) (C11) (C12) (C13) (C14) (C15) (C16) (C17) (C18) (C19)
+  (C20) (C21) (C22) (C23) (C24) (C25) (C26) (C27) (C28) (C29)
+  (C30) (C31) (C32) (C33) (C34) (C35) (C36) (C37) (C38) (C39))))
+(declare-fun x () E)
+(declare-fun y () E)
+(declare-fun z () E)
+(declare-fun f (E) Bool)
+(assert (distinct x y z))
+(assert (not ((_ is C0) x)))
+(assert (not ((_ is C1) x)))
+(assert (or (= y C0) (= z C0)))
+(assert (f x))
+(assert (not (f y)))
+(check-sat)
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --deep-restart=input --deep-restart-factor=0.5 --deep-restart-clause-size=3
+; EXPECT: unsat
+; DISABLE-TESTER: unsat-core
+; DISABLE-TESTER: proof
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(declare-const z Int)
+(declare-const w Int)
+(assert (and (<= 0 x) (<= x 2) (<= 0 y) (<= y 2) (<= 0 z) (<= z 2) (<= 0 w) (<= w 2)))
+(assert (distinct x y z w))
+(assert (or (> (+ x y) 1) (> (+ z w) 3)))
+(check-sat)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental --fp-exp --fp-lazy-mul-div
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_FP)
+(declare-fun x () (_ FloatingPoint 3 5))
+(declare-fun y () (_ FloatingPoint 3 5))
+(declare-fun z () (_ FloatingPoint 3 5))
+(define-fun one () (_ FloatingPoint 3 5) ((_ to_fp 3 5) RNE 1.0))
+(define-fun two () (_ FloatingPoint 3 5) ((_ to_fp 3 5) RNE 2.0))
+(assert (= z (fp.mul RNE x y)))
+(assert (fp.eq x two))
+(assert (fp.eq (fp.div RNE z two) y))
+(assert (fp.isNormal y))
+(check-sat)
+(assert (fp.eq y one))
+(assert (fp.eq z one))
+(check-sat)
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --produce-models --model-cores=justify
+; SCRUBBER: sed 's/(define-fun.*/define-fun/g'
+; EXPECT: sat
+; EXPECT: (
+; EXPECT: define-fun
+; EXPECT: define-fun
+; EXPECT: )
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (= x 0))
+(assert (or (> z 5) (> y 5)))
+(check-sat)
+(get-model)
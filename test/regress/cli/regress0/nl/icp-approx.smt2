@@ -0,0 +1,10 @@
+; REQUIRES: poly
+; COMMAND-LINE: --nl-icp --nl-icp-approx
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (and (>= x 1.0) (<= x 2.1)))
+(assert (= y (* x x x)))
+(assert (> y 9.5))
+(check-sat)
@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental --nl-ext=none --nl-cov --nl-cov-incremental
+; REQUIRES: poly
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (< (+ (* x x) (* y y)) 1.0))
+(check-sat)
+(push 1)
+(assert (> (* x y) 1.0))
+(check-sat)
+(pop 1)
+(assert (> (* x x) 0.25))
+(check-sat)
+(assert (> (* y y) 0.75))
+(check-sat)
@@ -0,0 +1,9 @@
+; COMMAND-LINE: --nl-ext=full --nl-ext-lemma-limit=1
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (and (>= x 0.0) (<= x 2.0) (>= y 0.0) (<= y 2.0) (>= z 0.0) (<= z 2.0)))
+(assert (> (+ (* x y) (* y z) (* x z)) 12.5))
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --incremental --nl-ext=full --nl-model-incremental
+; COMMAND-LINE: --incremental --nl-ext=full --no-nl-model-incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (> (* x y) 2.0))
+(assert (< (* y z) (- 1.0)))
+(check-sat)
+(push 1)
+(assert (and (> x 0.0) (> y 0.0) (> z 0.0)))
+(check-sat)
+(pop 1)
+(assert (< (* x z) 0.0))
+(check-sat)
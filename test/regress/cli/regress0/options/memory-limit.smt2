@@ -0,0 +1,8 @@
+; COMMAND-LINE: --memory-limit=1000000
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(assert (> (+ x y) 3))
+(assert (< (- x y) 1))
+(check-sat)
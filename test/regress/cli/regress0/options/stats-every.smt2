@@ -0,0 +1,14 @@
+; DISABLE-TESTER: dump
+; REQUIRES: statistics
+; COMMAND-LINE: --stats-every=1000000 --stats-every-prefix=resource::
+; ERROR-SCRUBBER: grep -c '^{"elapsed_ms": [0-9]*, "resource_units": [0-9]*, "max_rss_kb": [0-9]*, "stats": {.*}}$'
+; ERROR-EXPECT: 1
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-const a Bool)
+(declare-const b Bool)
+(assert (or a b))
+(assert (or (not a) b))
+(assert (or a (not b)))
+(assert (or (not a) (not b)))
+(check-sat)
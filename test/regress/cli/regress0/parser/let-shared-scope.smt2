@@ -0,0 +1,8 @@
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(assert (let ((x 1)) (let ((x (+ x 1)) (z x)) (let ((w (+ x z))) (= y w)))))
+(assert (= x (let ((y 5)) (let ((y (+ y 1))) (let ((a (let ((b y)) (+ b 1)))) (- a 1))))))
+(assert (not (and (= y 3) (= x 6))))
+(check-sat)
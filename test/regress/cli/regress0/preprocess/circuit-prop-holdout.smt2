@@ -0,0 +1,61 @@
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+
+;;;;; andFalse with the holdout assigned last
+(set-logic ALL)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun d () Bool)
+(declare-fun e () Bool)
+(assert (not (and a b c d e)))
+(assert d)
+(assert b)
+(assert a)
+(assert e)
+(assert c)
+(check-sat)
+
+(reset)
+
+;;;;; orTrue with the holdout in the middle
+(set-logic ALL)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun d () Bool)
+(declare-fun e () Bool)
+(assert (or a b c d e))
+(assert (not e))
+(assert (not a))
+(assert (not d))
+(assert (not b))
+(assert (=> c a))
+(check-sat)
+
+(reset)
+
+;;;;; no unique holdout due to a repeated child
+(set-logic ALL)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(assert (not (and a b c b)))
+(assert a)
+(assert c)
+(check-sat)
+
+(reset)
+
+;;;;; andAllTrue through nested gates
+(set-logic ALL)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun d () Bool)
+(assert (or (not (and a b)) (not (and c d))))
+(assert (and d c))
+(assert (and b a))
+(check-sat)
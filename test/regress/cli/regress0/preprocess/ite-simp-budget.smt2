@@ -0,0 +1,13 @@
+; COMMAND-LINE: --ite-simp --ite-simp-budget=4
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (= x (ite a 1 (ite b 2 3))))
+(assert (= y (ite c (ite a 4 5) 6)))
+(assert (or (= (ite a 1 (ite b 2 3)) 7) (= (ite c (ite a 4 5) 6) 0)))
+(assert (< (+ x y) 20))
+(check-sat)
@@ -0,0 +1,14 @@
+; COMMAND-LINE: --stream-assertions
+; EXPECT: sat
+; EXPECT: ((x 3))
+; DISABLE-TESTER: model
+(set-logic QF_LIA)
+(set-option :produce-models true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(define-fun z () Int (+ y 1))
+(assert (= x (+ z 1)))
+(assert (= y 1))
+(assert (> x 2))
+(check-sat)
+(get-value (x))
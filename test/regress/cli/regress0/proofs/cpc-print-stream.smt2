@@ -0,0 +1,11 @@
+; COMMAND-LINE: --proof-print-stream-size=2
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (= (f (+ x y)) z))
+(assert (= x y))
+(assert (or (> z (f (+ x x))) (< z (f (+ y x)))))
+(check-sat)
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --incremental --check-proofs --proof-granularity=dsl-rewrite
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun f (Int) Int)
+(push)
+(assert (not (= (f (+ x (* 2 y) 0)) (f (+ (* y 2) x)))))
+(check-sat)
+(pop)
+(push)
+(assert (not (= (f (+ x (* 2 y) 0)) (f (+ (* y 2) x)))))
+(check-sat)
+(pop)
@@ -0,0 +1,14 @@
+; COMMAND-LINE: --produce-proofs --produce-unsat-cores --proof-lazy-elaborate --proof-granularity=dsl-rewrite
+; EXPECT: unsat
+; EXPECT: (
+; EXPECT: a0
+; EXPECT: a1
+; EXPECT: )
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (! (= (+ x 0) (* 2 y)) :named a0))
+(assert (! (= (+ x 1) (+ y y)) :named a1))
+(assert (! (> y 0) :named a2))
+(check-sat)
+(get-unsat-core)
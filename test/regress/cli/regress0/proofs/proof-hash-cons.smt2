@@ -0,0 +1,12 @@
+; COMMAND-LINE: --proof-hash-cons --check-proofs
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun a () Int)
+(declare-fun b () Int)
+(declare-fun c () Int)
+(assert (= a b))
+(assert (= b c))
+(assert (or (distinct (f a) (f c)) (distinct (f (f a)) (f (f c)))))
+(assert (or (distinct (f c) (f a)) (> (f a) (f b))))
+(check-sat)
@@ -0,0 +1,24 @@
+; COMMAND-LINE: -i
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(push)
+(assert (= x 1))
+(assert (> y x))
+(assert (< y 3))
+(check-sat)
+(pop)
+(push)
+(assert (= x 2))
+(assert (> y x))
+(assert (< y 3))
+(check-sat)
+(pop)
+(assert (= x z))
+(assert (> y x))
+(assert (< y 3))
+(check-sat)
@@ -0,0 +1,12 @@
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun p (U U) Bool)
+(declare-fun q (U) Bool)
+(declare-fun r (U) Bool)
+(declare-const c U)
+(assert (forall ((x U) (y U)) (or (p x y) (q y))))
+(assert (forall ((x U) (y U)) (or (p x y) (q x))))
+(assert (distinct (forall ((x U) (y U)) (or (p x y) (r x)))
+                  (forall ((b U) (a U)) (or (r b) (p b a)))))
+(check-sat)
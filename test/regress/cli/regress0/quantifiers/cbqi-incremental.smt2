@@ -0,0 +1,18 @@
+; COMMAND-LINE: --cbqi-incremental
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun P (U) Bool)
+(declare-const a U)
+(declare-const b U)
+(declare-const c U)
+(assert (forall ((x U)) (=> (P x) (= (f x) x))))
+(assert (forall ((x U) (y U)) (=> (= (f x) y) (P y))))
+(assert (or (= a b) (= a c)))
+(assert (P a))
+(assert (= (f b) c))
+(assert (= (f c) b))
+(assert (not (P b)))
+(assert (not (= (f a) a)))
+(check-sat)
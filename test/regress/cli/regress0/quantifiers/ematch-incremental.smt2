@@ -0,0 +1,15 @@
+; COMMAND-LINE: --ematch-incremental
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun g (U U) U)
+(declare-fun P (U) Bool)
+(declare-const a U)
+(declare-const b U)
+(assert (forall ((x U)) (! (=> (P x) (P (f x))) :pattern ((P (f x))))))
+(assert (forall ((x U) (y U)) (! (= (g (f x) y) (f (g x y))) :pattern ((g (f x) y)))))
+(assert (P a))
+(assert (= b (f (f (f a)))))
+(assert (not (P b)))
+(assert (= (g b a) (g (f (f (f a))) a)))
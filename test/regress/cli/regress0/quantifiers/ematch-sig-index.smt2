@@ -0,0 +1,16 @@
+; COMMAND-LINE: --ematch-sig-index
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun g (U) U)
+(declare-fun P (U) Bool)
+(declare-const a U)
+(declare-const b U)
+(declare-const c U)
+(assert (forall ((x U) (y U)) (! (P (f (g x) y)) :pattern ((f (g x) y)))))
+(assert (forall ((x U)) (! (not (P (f x a))) :pattern ((f x a)))))
+(assert (= c (g b)))
+(assert (not (P (f b a))))
+(assert (P (f c c)))
+(assert (= (f c a) (f b b)))
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --enum-inst --enum-inst-ieval --enum-inst-order
+; COMMAND-LINE: --enum-inst --enum-inst-ieval --enum-inst-sum
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun R (U U) Bool)
+(declare-const a U)
+(declare-const b U)
+(assert (forall ((x U) (y U)) (! (or (not (R x y)) (R (f x) y)) :no-pattern (R x y))))
+(assert (R a b))
+(assert (not (R (f (f a)) b)))
+(check-sat)
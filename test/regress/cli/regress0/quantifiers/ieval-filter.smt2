@@ -0,0 +1,14 @@
+; COMMAND-LINE: --mbqi --ieval-filter
+; EXPECT: sat
+(set-logic ALL)
+(set-info :status sat)
+(declare-fun Q (Int) Bool)
+(declare-fun P (Int) Bool)
+(assert (forall ((x Int)) (=> (Q x) (P x))))
+(assert (not (P 1)))
+(assert (not (P 3)))
+(assert (Q 4))
+(assert (P 4))
+(assert (not (Q 2)))
+(assert (not (Q 5)))
+(check-sat)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --inst-hash-table --incremental
+; EXPECT: unsat
+; EXPECT: unsat
+(set-logic UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun P (Int) Bool)
+(assert (forall ((x Int)) (! (=> (P x) (> (f x) x)) :pattern ((P x)))))
+(assert (P 0))
+(assert (P 1))
+(push 1)
+(assert (< (f 1) 1))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (< (f 0) 0))
+(check-sat)
+(pop 1)
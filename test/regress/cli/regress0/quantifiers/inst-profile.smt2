@@ -0,0 +1,12 @@
+; COMMAND-LINE: --inst-profile
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun P (U) Bool)
+(declare-const a U)
+(assert (forall ((x U)) (! (=> (P x) (P (f x))) :pattern ((P (f x))) :qid step)))
+(assert (forall ((x U)) (! (P (f (f x))) :pattern ((f x)))))
+(assert (P a))
+(assert (not (P (f (f (f a))))))
+(assert (not (P (f a))))
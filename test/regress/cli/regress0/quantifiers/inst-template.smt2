@@ -0,0 +1,15 @@
+; COMMAND-LINE: --inst-template
+; COMMAND-LINE: --inst-template --produce-proofs
+; EXPECT: unsat
+(set-logic UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun g (Int Int) Int)
+(declare-fun P (Int) Bool)
+(declare-const c Int)
+(assert (forall ((x Int) (y Int))
+  (! (and (=> (P x) (= (g x y) (+ (f x) (f c) 1)))
+          (ite (> c 0) (>= (f x) c) (forall ((z Int)) (>= (g z y) (f c)))))
+     :pattern ((g x y)))))
+(assert (P 3))
+(assert (> c 0))
+(assert (= (g 3 c) (f c)))
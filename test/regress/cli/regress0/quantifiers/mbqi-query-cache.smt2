@@ -0,0 +1,15 @@
+; COMMAND-LINE: --mbqi --mbqi-query-cache
+; EXPECT: sat
+(set-logic ALL)
+(set-info :status sat)
+(declare-fun Q (Int) Bool)
+(declare-fun P (Int) Bool)
+(declare-fun R (Int) Bool)
+(assert (forall ((x Int)) (=> (Q x) (P x))))
+(assert (forall ((x Int)) (=> (R x) (or (P x) (Q x)))))
+(assert (forall ((x Int)) (=> (P x) (> x 10))))
+(assert (not (P 1)))
+(assert (not (P 3)))
+(assert (not (Q 2)))
+(assert (R 12))
+(check-sat)
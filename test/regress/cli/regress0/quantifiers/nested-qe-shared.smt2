@@ -0,0 +1,8 @@
+; COMMAND-LINE: --cegqi-nested-qe
+; EXPECT: sat
+(set-logic LIA)
+(set-info :status sat)
+(declare-fun k () Int)
+(assert (forall ((a Int)) (and (exists ((b Int)) (and (> b a) (< b (+ a k))))
+                               (or (> a 5) (exists ((c Int)) (and (> c a) (< c (+ a k))))))))
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --term-db-incremental
+; COMMAND-LINE: --term-db-incremental --term-db-mode=all
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun h (U U) U)
+(declare-fun P (U) Bool)
+(declare-const a U)
+(declare-const b U)
+(declare-const c U)
+(assert (forall ((x U)) (! (=> (P x) (P (f x))) :pattern ((P (f x))))))
+(assert (forall ((x U) (y U)) (! (= (h x y) (h y x)) :pattern ((h x y)))))
+(assert (P a))
+(assert (or (= b (f (f a))) (= c (f (f a)))))
+(assert (not (P b)))
+(assert (not (P c)))
+(assert (= (h b c) (h c a)))
@@ -0,0 +1,16 @@
+; EXPECT: unsat
+(set-logic ALL)
+(declare-fun r () (Relation Int Int))
+(declare-fun s () (Relation Int Int))
+(declare-fun a () Int)
+(declare-fun b () Int)
+(assert (set.member (tuple 1 2) r))
+(assert (set.member (tuple 2 3) r))
+(assert (set.member (tuple 3 4) r))
+(assert (set.member (tuple 4 5) r))
+(assert (set.member (tuple a 6) s))
+(assert (set.member (tuple b 7) s))
+(assert (= a 5))
+(assert (or (not (set.member (tuple 1 6) (rel.join (rel.tclosure r) s)))
+            (not (set.member (tuple 2 5) (rel.tclosure r)))))
+(check-sat)
@@ -0,0 +1,14 @@
+(set-logic QF_ALL)
+(set-info :status unsat)
+(declare-heap (Int Int))
+
+(declare-const x Int)
+(declare-const y Int)
+(declare-const z Int)
+(declare-const w Int)
+
+(assert (sep (pto x 0) (pto y 1) (pto z 2) (pto w 3)))
+
+(assert (or (= x w) (= y w)))
+
+(check-sat)
@@ -0,0 +1,9 @@
+; COMMAND-LINE: --seq-array=lazy
+; EXPECT: unsat
+(set-logic QF_SLIA)
+(declare-const x (Seq Int))
+(declare-const y (Seq Int))
+(assert (= y (seq.update (seq.update (seq.update x 0 (seq.unit 1)) 1 (seq.unit 2)) 2 (seq.unit 3))))
+(assert (>= (seq.len x) 4))
+(assert (or (not (= (seq.nth y 0) 1)) (not (= (seq.nth y 3) (seq.nth x 3)))))
+(check-sat)
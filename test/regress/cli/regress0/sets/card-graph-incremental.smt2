@@ -0,0 +1,18 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic ALL)
+(declare-fun A () (Set Int))
+(declare-fun B () (Set Int))
+(declare-fun C () (Set Int))
+(assert (= (set.card (set.inter A B)) 3))
+(assert (= (set.card (set.minus A B)) 2))
+(assert (>= (set.card (set.minus B C)) 1))
+(check-sat)
+(push 1)
+(assert (<= (set.card A) 4))
+(check-sat)
+(pop 1)
+(assert (= (set.card (set.union A B)) (+ (set.card A) 1)))
+(check-sat)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_SLIA)
+(declare-const x String)
+(declare-const y String)
+(assert (= y (str.replace_all (str.++ x "ab" x) "a" "c")))
+(push 1)
+(assert (= x "a"))
+(check-sat)
+(assert (str.contains y "a"))
+(check-sat)
+(pop 1)
+(assert (= x "b"))
+(assert (= (str.indexof y "cb" 0) 1))
+(check-sat)
@@ -0,0 +1,20 @@
+; COMMAND-LINE: --strings-nf-incremental
+; COMMAND-LINE: --no-strings-nf-incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_SLIA)
+(declare-const x String)
+(declare-const y String)
+(declare-const z String)
+(declare-const w String)
+(assert (= x (str.++ y "ab" z)))
+(assert (= w (str.++ x "c" y)))
+(assert (> (str.len z) 1))
+(push 1)
+(assert (= y "d"))
+(check-sat)
+(pop 1)
+(assert (= w (str.++ "e" z)))
+(assert (= y ""))
+(assert (not (= (str.at z 0) "a")))
+(check-sat)
@@ -0,0 +1,13 @@
+; EXPECT: sat
+(set-logic QF_SLIA)
+(define-fun log () RegLan (re.++ (re.* (re.range "a" "z")) (str.to_re ":") (re.* (re.union (re.range "0" "9") (str.to_re " "))) (re.* re.allchar)))
+(declare-const x String)
+(assert (str.in_re "error: 42 47" log))
+(assert (str.in_re "warn:" log))
+(assert (str.in_re "info:1 2 3 extra text" log))
+(assert (not (str.in_re "Error: 42" log)))
+(assert (not (str.in_re "debug 17" log)))
+(assert (not (str.in_re "" log)))
+(assert (= x (ite (str.in_re "trace:9" log) "ok" "fail")))
+(assert (= x "ok"))
+(check-sat)
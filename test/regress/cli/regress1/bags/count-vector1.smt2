@@ -0,0 +1,12 @@
+; COMMAND-LINE: --bags-count-vectors
+; EXPECT: unsat
+(set-logic ALL)
+(declare-fun A () (Bag Int))
+(declare-fun B () (Bag Int))
+(declare-fun C () (Bag Int))
+(assert (= A (bag.union_disjoint (bag 1 2) (bag 2 3))))
+(assert (= B (bag.inter_min A (bag 1 1))))
+(assert (= C (bag.difference_subtract A (bag 2 1))))
+(assert (= (bag.count 1 B) 1))
+(assert (not (= (bag.count 2 C) 2)))
+(check-sat)
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+###############################################################################
+# Top contributors (to current version):
+#   Andres Noetzli, Mathias Preiner
+#
+# This file is part of the cvc5 project.
+#
+# Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+# in the top-level source directory and their institutional affiliations.
+# All rights reserved.  See the file COPYING in the top-level source
+# directory for licensing information.
+# #############################################################################
+##
+"""
+Records performance baselines of regressions and reports the significant
+slowdowns between two baselines.
+"""
+
+import argparse
+import collections
+import concurrent.futures
+import json
+import math
+import os
+import subprocess
+import sys
+
+REGRESS_DIR = os.path.dirname(os.path.abspath(__file__))
+METRICS = ["time", "resource_units", "max_rss_kb"]
+
+
+def read_list(filename):
+    """Returns the benchmarks listed in `filename`, relative to the regression
+    directory."""
+
+    benchmarks = []
+    with open(filename) as fin:
+        for line in fin:
+            line = line.strip()
+            if line and not line.startswith("#"):
+                benchmarks.append(line)
+    return benchmarks
+
+
+def run(args):
+    """Runs the listed benchmarks with run_regression.py in performance mode
+    and stores the results in the baseline file."""
+
+    if os.path.exists(args.output):
+        os.remove(args.output)
+    output = os.path.abspath(args.output)
+    benchmarks = read_list(args.list)
+
+    def run_one(benchmark):
+        cmd = [sys.executable,
+               os.path.join(REGRESS_DIR, "run_regression.py"),
+               "--tester", "base",
+               "--perf-log", output,
+               "--perf-runs", str(args.runs),
+               os.path.abspath(args.cvc5_binary),
+               os.path.join(REGRESS_DIR, benchmark)]
+        res = subprocess.run(cmd, stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT)
+        return benchmark, res.returncode, res.stdout.decode(errors="replace")
+
+    failed = []
+    # the regressions are run sequentially by default, since parallel runs
+    # affect each other's timings
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+        for benchmark, rc, out in pool.map(run_one, benchmarks):
+            print("{} {}".format("ok  " if rc == 0 else "FAIL", benchmark))
+            if rc != 0:
+                failed.append(benchmark)
+                if args.verbose:
+                    print(out)
+    if failed:
+        print("{} regressions failed and are not in {}".format(
+            len(failed), args.output))
+    return 1 if failed else 0
+
+
+def load(filename):
+    """Returns (benchmark, args) -> results of the baseline file."""
+
+    res = collections.OrderedDict()
+    with open(filename) as fin:
+        for line in fin:
+            if line.strip():
+                entry = json.loads(line)
+                res[(entry["benchmark"], entry["args"])] = entry
+    return res
+
+
+def betacf(a, b, x):
+    """Continued fraction for the incomplete beta function."""
+
+    tiny = 1e-300
+    qab = a + b
+    qap = a + 1
+    qam = a - 1
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def betainc(a, b, x):
+    """The regularized incomplete beta function I_x(a, b)."""
+
+    if x <= 0:
+        return 0.0
+    if x >= 1:
+        return 1.0
+    lbeta = (math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +
+             a * math.log(x) + b * math.log(1 - x))
+    if x < (a + 1) / (a + b + 2):
+        return math.exp(lbeta) * betacf(a, b, x) / a
+    return 1.0 - math.exp(lbeta) * betacf(b, a, 1 - x) / b
+
+
+def slowdown_pvalue(base, new):
+    """Returns the p-value of Welch's t-test for the hypothesis that the mean
+    of `new` is larger than the mean of `base`."""
+
+    n1, n2 = len(base), len(new)
+    m1, m2 = sum(base) / n1, sum(new) / n2
+    v1 = sum((x - m1)**2 for x in base) / (n1 - 1) if n1 > 1 else 0.0
+    v2 = sum((x - m2)**2 for x in new) / (n2 - 1) if n2 > 1 else 0.0
+    se2 = v1 / n1 + v2 / n2
+    if se2 == 0:
+        # deterministic measurements, e.g. resource units
+        return 0.0 if m2 > m1 else 1.0
+    if n1 < 2 or n2 < 2:
+        return 1.0
+    t = (m2 - m1) / math.sqrt(se2)
+    df = se2**2 / ((v1 / n1)**2 / (n1 - 1) + (v2 / n2)**2 / (n2 - 1))
+    p = 0.5 * betainc(df / 2, 0.5, df / (df + t * t))
+    return p if t > 0 else 1.0 - p
+
+
+def compare(args):
+    """Reports the significant slowdowns of the new baseline."""
+
+    base = load(args.baseline)
+    new = load(args.new)
+    slowdowns = []
+    for key, entry in new.items():
+        if key not in base:
+            continue
+        for metric in args.metric:
+            b = [x for x in base[key].get(metric, []) if x is not None]
+            n = [x for x in entry.get(metric, []) if x is not None]
+            if not b or not n:
+                continue
+            mb, mn = sum(b) / len(b), sum(n) / len(n)
+            if mn < mb * (1 + args.threshold) or mn - mb < args.min_delta.get(
+                    metric, 0):
+                continue
+            p = slowdown_pvalue(b, n)
+            if p < args.alpha:
+                slowdowns.append((key, metric, mb, mn, p))
+    missing = [k for k in base if k not in new]
+    for (benchmark, cargs), metric, mb, mn, p in slowdowns:
+        print("{}{}: {} {:.6g} -> {:.6g} ({:+.1f}%, p={:.3g})".format(
+            benchmark, " " + cargs if cargs else "", metric, mb, mn,
+            (mn / mb - 1) * 100 if mb else float("inf"), p))
+    for benchmark, cargs in missing:
+        print("{}{}: missing".format(benchmark, " " + cargs if cargs else ""))
+    print("{} significant slowdowns in {} compared regressions".format(
+        len(slowdowns), len([k for k in new if k in base])))
+    return 1 if slowdowns else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    prun = sub.add_parser("run", help="record a baseline")
+    prun.add_argument("cvc5_binary")
+    prun.add_argument("output", help="the baseline file to write")
+    prun.add_argument("--list",
+                      default=os.path.join(REGRESS_DIR, "perf_benchmarks.txt"),
+                      help="the file listing the regressions")
+    prun.add_argument("--runs", type=int, default=5,
+                      help="the number of runs per regression")
+    prun.add_argument("--jobs", type=int, default=1,
+                      help="the number of regressions run in parallel")
+    prun.add_argument("-v", "--verbose", action="store_true")
+
+    pcmp = sub.add_parser("compare", help="compare two baselines")
+    pcmp.add_argument("baseline")
+    pcmp.add_argument("new")
+    pcmp.add_argument("--metric", choices=METRICS, action="append",
+                      help="the metrics to compare (default: all)")
+    pcmp.add_argument("--alpha", type=float, default=0.01,
+                      help="the significance level")
+    pcmp.add_argument("--threshold", type=float, default=0.05,
+                      help="the minimal relative slowdown that is reported")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        return run(args)
+    if not args.metric:
+        args.metric = METRICS
+    # ignore slowdowns below the resolution of the measurements
+    args.min_delta = {"time": 0.05, "max_rss_kb": 1024}
+    return compare(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -18,6 +18,7 @@ Runs benchmark and checks for correct exit status and output.
 import argparse
 import collections
 import difflib
+import json
 import os
 import re
 import shlex
@@ -26,6 +27,7 @@ import subprocess
 import sys
 import tempfile
 import threading
+import time
 
 g_args = None
 
@@ -760,6 +762,75 @@ def run_benchmark(benchmark_info):
     return (output, error, exit_status)
 
 
+def measure_performance(benchmark_info, runs):
+    """Runs cvc5 `runs` times on the benchmark of `benchmark_info` with
+    statistics enabled and returns the wall time in seconds, the resource
+    units spent and the peak resident set size in kilobytes of each run. The
+    peak resident set size is only available on platforms with `os.wait4`."""
+
+    args = (benchmark_info.wrapper + [benchmark_info.cvc5_binary] +
+            benchmark_info.command_line_args +
+            ["--stats", "--stats-internal", benchmark_info.benchmark_basename])
+    print("  $ {}".format(" ".join([shlex.quote(a) for a in args])))
+    rus_regex = re.compile(r"^resource::resourceUnitsUsed\s*=\s*(\d+)",
+                           re.MULTILINE)
+    res = {"time": [], "resource_units": [], "max_rss_kb": [],
+           "exit_status": []}
+    for _ in range(runs):
+        start = time.monotonic()
+        proc = subprocess.Popen(args, cwd=benchmark_info.benchmark_dir,
+                                stdout=subprocess.DEVNULL,
+                                stderr=subprocess.PIPE)
+        timer = None
+        if benchmark_info.timeout:
+            timer = threading.Timer(benchmark_info.timeout, proc.kill)
+            timer.start()
+        error = proc.stderr.read().decode(errors="replace")
+        proc.stderr.close()
+        max_rss = None
+        if hasattr(os, "wait4"):
+            _, status, rusage = os.wait4(proc.pid, 0)
+            proc.returncode = os.waitstatus_to_exitcode(status)
+            # ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+            max_rss = rusage.ru_maxrss
+            if sys.platform == "darwin":
+                max_rss //= 1024
+        else:
+            proc.wait()
+        elapsed = time.monotonic() - start
+        if timer:
+            timer.cancel()
+        match = rus_regex.search(error)
+        res["time"].append(elapsed)
+        res["resource_units"].append(int(match.group(1)) if match else None)
+        res["max_rss_kb"].append(max_rss)
+        res["exit_status"].append(proc.returncode)
+    return res
+
+
+def log_performance(perf_log, benchmark_path, configs, runs):
+    """Measures the performance of each configuration in `configs`, which are
+    pairs of command line arguments and benchmark infos, and appends the
+    results as JSON lines to the file `perf_log`."""
+
+    # identify the benchmark by its path relative to this directory if possible
+    name = os.path.abspath(benchmark_path)
+    regress_dir = os.path.dirname(os.path.abspath(__file__))
+    if name.startswith(regress_dir + os.sep):
+        name = os.path.relpath(name, regress_dir)
+    name = name.replace(os.sep, "/")
+    lines = []
+    for args, benchmark_info in configs:
+        print_info("Measuring performance with {} runs".format(runs))
+        res = measure_performance(benchmark_info, runs)
+        res["benchmark"] = name
+        res["args"] = " ".join(args)
+        lines.append(json.dumps(res, sort_keys=True) + "\n")
+    # write all lines at once, since regressions may run in parallel
+    with open(perf_log, "a") as log:
+        log.write("".join(lines))
+
+
 def run_regression(
     testers,
     wrapper,
@@ -892,6 +963,7 @@ def run_regression(
         command_lines.append("")
 
     tests = []
+    perf_configs = []
     expected_output_lines = expected_output.split()
     command_line_args_configs = []
     for command_line in command_lines:
@@ -922,6 +994,8 @@ def run_regression(
             safe_mode=("safe-mode" in cvc5_features),
             stable_mode=("stable-mode" in cvc5_features)
         )
+        if g_testers["base"].applies(benchmark_info):
+            perf_configs.append((all_args, benchmark_info))
         for tester_name, tester in g_testers.items():
             if tester_name in testers and tester.applies(benchmark_info):
                 tests.append((tester, benchmark_info))
@@ -940,6 +1014,11 @@ def run_regression(
         else:
             exit_code = test_exit_code
 
+    # Only measure the performance of correct runs
+    if g_args.perf_log and exit_code == EXIT_OK:
+        log_performance(g_args.perf_log, benchmark_path, perf_configs,
+                        g_args.perf_runs)
+
     return exit_code
 
 
@@ -964,6 +1043,14 @@ def main():
     parser.add_argument("--carcara-binary", default="")
     parser.add_argument("--ethos-binary", default="")
     parser.add_argument("--cpc-sig-dir", default="")
+    parser.add_argument(
+        "--perf-log",
+        default="",
+        help="measure the performance and append it as JSON lines to this file")
+    parser.add_argument("--perf-runs",
+                        type=int,
+                        default=1,
+                        help="the number of runs for measuring the performance")
     parser.add_argument("wrapper", nargs="*")
     parser.add_argument("cvc5_binary")
     parser.add_argument("benchmark")
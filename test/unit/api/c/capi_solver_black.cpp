@@ -284,6 +284,33 @@ TEST_F(TestCApiBlackSolver, assert_formula)
   cvc5_term_manager_delete(tm);
 }
 
+TEST_F(TestCApiBlackSolver, assert_formulas)
+{
+  Cvc5Term x = cvc5_mk_const(d_tm, cvc5_get_boolean_sort(d_tm), "x");
+  std::vector<Cvc5Term> terms = {cvc5_mk_true(d_tm), x};
+  ASSERT_DEATH(cvc5_assert_formulas(nullptr, terms.size(), terms.data()),
+               "unexpected NULL argument");
+  ASSERT_DEATH(cvc5_assert_formulas(d_solver, terms.size(), nullptr),
+               "unexpected NULL argument");
+  std::vector<Cvc5Term> bad = {x, nullptr};
+  ASSERT_DEATH(cvc5_assert_formulas(d_solver, bad.size(), bad.data()),
+               "invalid term at index 1");
+
+  cvc5_assert_formulas(d_solver, terms.size(), terms.data());
+  size_t size;
+  const Cvc5Term* assertions = cvc5_get_assertions(d_solver, &size);
+  ASSERT_EQ(size, 2);
+  ASSERT_TRUE(cvc5_term_is_equal(assertions[0], terms[0]));
+  ASSERT_TRUE(cvc5_term_is_equal(assertions[1], terms[1]));
+
+  Cvc5TermManager* tm = cvc5_term_manager_new();
+  Cvc5* slv = cvc5_new(tm);
+  ASSERT_DEATH(cvc5_assert_formulas(slv, terms.size(), terms.data()),
+               "term is not associated with the term manager of this solver");
+  cvc5_delete(slv);
+  cvc5_term_manager_delete(tm);
+}
+
 TEST_F(TestCApiBlackSolver, check_sat)
 {
   ASSERT_DEATH(cvc5_check_sat(nullptr), "unexpected NULL argument");
@@ -322,6 +349,19 @@ TEST_F(TestCApiBlackSolver, check_sat_assuming)
   cvc5_term_manager_delete(tm);
 }
 
+TEST_F(TestCApiBlackSolver, interrupt)
+{
+  ASSERT_DEATH(cvc5_interrupt(nullptr), "unexpected NULL argument");
+  cvc5_set_option(d_solver, "incremental", "true");
+  cvc5_assert_formula(d_solver, cvc5_mk_const(d_tm, d_bool, "x"));
+  cvc5_interrupt(d_solver);
+  Cvc5Result res = cvc5_check_sat(d_solver);
+  ASSERT_TRUE(cvc5_result_is_unknown(res));
+  ASSERT_EQ(cvc5_result_get_unknown_explanation(res),
+            CVC5_UNKNOWN_EXPLANATION_INTERRUPTED);
+  ASSERT_TRUE(cvc5_result_is_sat(cvc5_check_sat(d_solver)));
+}
+
 TEST_F(TestCApiBlackSolver, check_sat_assuming1)
 {
   Cvc5Term x = cvc5_mk_const(d_tm, d_bool, "x");
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 
 #include "base/output.h"
 #include "test_api.h"
@@ -189,6 +191,20 @@ TEST_F(TestApiBlackSolver, assertFormula)
   ASSERT_THROW(slv.assertFormula(d_tm.mkTrue()), CVC5ApiException);
 }
 
+TEST_F(TestApiBlackSolver, assertFormulas)
+{
+  Term x = d_tm.mkConst(d_tm.getBooleanSort(), "x");
+  ASSERT_NO_THROW(d_solver->assertFormulas({}));
+  ASSERT_NO_THROW(d_solver->assertFormulas({d_tm.mkTrue(), x}));
+  ASSERT_EQ(d_solver->getAssertions(), std::vector<Term>({d_tm.mkTrue(), x}));
+  ASSERT_THROW(d_solver->assertFormulas({x, Term()}), CVC5ApiException);
+  ASSERT_THROW(d_solver->assertFormulas({d_tm.mkInteger(1)}),
+               CVC5ApiException);
+  TermManager tm;
+  Solver slv(tm);
+  ASSERT_THROW(slv.assertFormulas({d_tm.mkTrue()}), CVC5ApiException);
+}
+
 TEST_F(TestApiBlackSolver, checkSat)
 {
   d_solver->setOption("incremental", "false");
@@ -206,6 +222,19 @@ TEST_F(TestApiBlackSolver, checkSatAssuming)
   ASSERT_THROW(slv.checkSatAssuming(d_tm.mkTrue()), CVC5ApiException);
 }
 
+TEST_F(TestApiBlackSolver, interrupt)
+{
+  d_solver->setOption("incremental", "true");
+  d_solver->assertFormula(d_tm.mkConst(d_bool, "x"));
+  // the interruption applies to the next call
+  ASSERT_NO_THROW(d_solver->interrupt());
+  cvc5::Result res = d_solver->checkSat();
+  ASSERT_TRUE(res.isUnknown());
+  ASSERT_EQ(res.getUnknownExplanation(), UnknownExplanation::INTERRUPTED);
+  // and only to that call
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+}
+
 TEST_F(TestApiBlackSolver, checkSatAssuming1)
 {
   Term x = d_tm.mkConst(d_bool, "x");
@@ -1111,6 +1140,58 @@ TEST_F(TestApiBlackSolver, getDriverOptions)
   ASSERT_EQ(dopts.out().rdbuf(), std::cout.rdbuf());
 }
 
+TEST_F(TestApiBlackSolver, snapshot)
+{
+  const char* filename = "snapshot.bin";
+  Sort bv8 = d_tm.mkBitVectorSort(8);
+  Sort fun = d_tm.mkFunctionSort({d_int, d_uninterpreted}, d_real);
+  Term x = d_tm.mkConst(d_int, "x");
+  Term u = d_tm.mkConst(d_uninterpreted, "u");
+  Term f = d_tm.mkConst(fun, "f");
+  Term b = d_tm.mkConst(bv8, "b");
+  Term big = d_tm.mkInteger("68038927088685865242724985643");
+  Term t1 = d_tm.mkTerm(
+      Kind::GT,
+      {d_tm.mkTerm(Kind::APPLY_UF, {f, d_tm.mkTerm(Kind::ADD, {x, big}), u}),
+       d_tm.mkReal(-1, 3)});
+  Op ext = d_tm.mkOp(Kind::BITVECTOR_EXTRACT, {3, 0});
+  Term t2 = d_tm.mkTerm(
+      Kind::EQUAL,
+      {d_tm.mkTerm(ext, {b}), d_tm.mkBitVector(4, 5)});
+  Term v = d_tm.mkVar(d_string, "s");
+  Term t3 = d_tm.mkTerm(
+      Kind::EXISTS,
+      {d_tm.mkTerm(Kind::VARIABLE_LIST, {v}),
+       d_tm.mkTerm(Kind::EQUAL, {v, d_tm.mkString("abc")})});
+  std::vector<Term> terms{t1, t2, t3, t1};
+  d_solver->saveSnapshot(filename, terms);
+
+  std::vector<Term> loaded = d_solver->loadSnapshot(filename);
+  std::remove(filename);
+  ASSERT_EQ(loaded.size(), terms.size());
+  for (size_t i = 0; i < terms.size(); ++i)
+  {
+    // free constants are created anew, but print the same
+    ASSERT_EQ(loaded[i].toString(), terms[i].toString());
+    ASSERT_EQ(loaded[i].getSort(), d_bool);
+  }
+  ASSERT_NE(loaded[0], t1);
+  ASSERT_EQ(loaded[0], loaded[3]);
+  ASSERT_EQ(loaded[1][0][0].getSort(), bv8);
+  d_solver->assertFormula(loaded[0]);
+  d_solver->assertFormula(loaded[1]);
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+
+  ASSERT_THROW(d_solver->saveSnapshot(filename, {Term()}), CVC5ApiException);
+  ASSERT_THROW(d_solver->loadSnapshot(filename), CVC5ApiException);
+  {
+    std::ofstream out(filename);
+    out << "(assert true)";
+  }
+  ASSERT_THROW(d_solver->loadSnapshot(filename), CVC5ApiException);
+  std::remove(filename);
+}
+
 TEST_F(TestApiBlackSolver, getStatistics)
 {
   ASSERT_NO_THROW(cvc5::Stat());
@@ -1942,6 +2023,23 @@ TEST_F(TestApiBlackSolver, resetAssertions)
   d_solver->checkSatAssuming({slt, ule});
 }
 
+TEST_F(TestApiBlackSolver, resetAssertionsModel)
+{
+  d_solver->setOption("incremental", "true");
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GT, {x, d_tm.mkInteger(0)}));
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  ASSERT_NO_THROW(d_solver->getValue(x));
+  d_solver->resetAssertions();
+  // the model of the last query is not available anymore
+  ASSERT_THROW(d_solver->getValue(x), CVC5ApiException);
+  Term lt = d_tm.mkTerm(Kind::LT, {x, d_tm.mkInteger(0)});
+  d_solver->assertFormula(lt);
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  ASSERT_TRUE(d_solver->getValue(lt).getBooleanValue());
+}
+
 TEST_F(TestApiBlackSolver, declareSygusVar)
 {
   d_solver->setOption("sygus", "true");
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of the recording of API traces.
+ */
+
+#include <cvc5/cvc5.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include "api/cpp/cvc5_trace_format.h"
+#include "test.h"
+
+namespace cvc5::internal {
+
+using namespace apitrace;
+
+namespace test {
+
+class TestApiWhiteTrace : public TestInternal
+{
+ protected:
+  void SetUp() override
+  {
+    d_filename =
+        (std::filesystem::temp_directory_path() / "cvc5_api_trace_white.bin")
+            .string();
+  }
+  void TearDown() override { std::filesystem::remove(d_filename); }
+
+  /** Read the operands of a record with the given opcode. */
+  void readOperands(Reader& r, Op op, std::vector<std::string>& strings)
+  {
+    uint64_t u;
+    std::string s;
+    switch (op)
+    {
+      case Op::NEW_SOLVER:
+      case Op::DELETE_SOLVER:
+      case Op::CHECK_SAT: ASSERT_TRUE(r.readUnsigned(u)); break;
+      case Op::SET_OPTION:
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_TRUE(r.readString(s));
+        strings.push_back(s);
+        ASSERT_TRUE(r.readString(s));
+        strings.push_back(s);
+        break;
+      case Op::SORT_INTEGER: break;
+      case Op::TERM_CONST:
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_EQ(u, 1u);
+        ASSERT_TRUE(r.readString(s));
+        strings.push_back(s);
+        break;
+      case Op::TERM_INTEGER:
+      case Op::RESULT:
+        if (op == Op::RESULT)
+        {
+          ASSERT_TRUE(r.readUnsigned(u));
+        }
+        ASSERT_TRUE(r.readString(s));
+        strings.push_back(s);
+        break;
+      case Op::TERM_APP:
+      {
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_EQ(u, 0u);
+        uint64_t n;
+        ASSERT_TRUE(r.readUnsigned(n));
+        for (uint64_t i = 0; i < n; ++i)
+        {
+          ASSERT_TRUE(r.readUnsigned(u));
+        }
+        break;
+      }
+      case Op::ASSERT_FORMULA:
+        ASSERT_TRUE(r.readUnsigned(u));
+        ASSERT_TRUE(r.readUnsigned(u));
+        break;
+      default: FAIL() << "unexpected record " << toString(op);
+    }
+  }
+
+  std::string d_filename;
+};
+
+TEST_F(TestApiWhiteTrace, record)
+{
+  setenv("CVC5_API_TRACE", d_filename.c_str(), 1);
+  {
+    TermManager tm;
+    unsetenv("CVC5_API_TRACE");
+    Solver slv(tm);
+    slv.setOption("incremental", "true");
+    Term x = tm.mkConst(tm.getIntegerSort(), "x");
+    Term one = tm.mkInteger(1);
+    slv.assertFormula(tm.mkTerm(cvc5::Kind::GT, {x, one}));
+    slv.assertFormula(tm.mkTerm(cvc5::Kind::LT, {x, tm.mkInteger(3)}));
+    ASSERT_TRUE(slv.checkSat().isSat());
+  }
+
+  std::ifstream in(d_filename, std::ios::binary);
+  Reader r(in);
+  ASSERT_TRUE(r.readHeader());
+  std::vector<Op> ops;
+  std::vector<std::string> strings;
+  Op op;
+  while (r.readOp(op))
+  {
+    readOperands(r, op, strings);
+    // the recorded non-default options depend on the configuration
+    if (op != Op::SET_OPTION)
+    {
+      ops.push_back(op);
+    }
+  }
+  // x and 1 are defined once, on their first use
+  std::vector<Op> expected = {Op::NEW_SOLVER,
+                              Op::SORT_INTEGER,
+                              Op::TERM_CONST,
+                              Op::TERM_INTEGER,
+                              Op::TERM_APP,
+                              Op::ASSERT_FORMULA,
+                              Op::TERM_INTEGER,
+                              Op::TERM_APP,
+                              Op::ASSERT_FORMULA,
+                              Op::CHECK_SAT,
+                              Op::RESULT,
+                              Op::DELETE_SOLVER};
+  ASSERT_EQ(ops, expected);
+  ASSERT_EQ(strings[0], "incremental");
+  ASSERT_EQ(strings[1], "true");
+  ASSERT_EQ(strings.back(), "sat");
+  ASSERT_NE(std::find(strings.begin(), strings.end(), "x"), strings.end());
+  ASSERT_NE(std::find(strings.begin(), strings.end(), "3"), strings.end());
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -1742,6 +1742,20 @@ class SolverTest
     assertThrows(CVC5ApiException.class, () -> slv.assertFormula(d_solver.mkTrue()));
   }
 
+  @Test
+  void assertFormulas() throws CVC5ApiException
+  {
+    Term x = d_tm.mkConst(d_tm.getBooleanSort(), "x");
+    assertDoesNotThrow(() -> d_solver.assertFormulas(new Term[] {}));
+    assertDoesNotThrow(() -> d_solver.assertFormulas(new Term[] {d_tm.mkTrue(), x}));
+    assertEquals(2, d_solver.getAssertions().length);
+    assertThrows(
+        CVC5ApiException.class, () -> d_solver.assertFormulas(new Term[] {d_tm.mkInteger(1)}));
+    Solver slv = new Solver();
+    assertThrows(
+        CVC5ApiException.class, () -> slv.assertFormulas(new Term[] {d_tm.mkTrue()}));
+  }
+
   @Test
   void checkSat() throws CVC5ApiException
   {
@@ -1760,6 +1774,18 @@ class SolverTest
     assertThrows(CVC5ApiException.class, () -> slv.checkSatAssuming(d_solver.mkTrue()));
   }
 
+  @Test
+  void interrupt() throws CVC5ApiException
+  {
+    d_solver.setOption("incremental", "true");
+    d_solver.assertFormula(d_tm.mkConst(d_tm.getBooleanSort(), "x"));
+    assertDoesNotThrow(() -> d_solver.interrupt());
+    Result res = d_solver.checkSat();
+    assertTrue(res.isUnknown());
+    assertEquals(res.getUnknownExplanation(), UnknownExplanation.INTERRUPTED);
+    assertTrue(d_solver.checkSat().isSat());
+  }
+
   @Test
   void checkSatAssuming1() throws CVC5ApiException
   {
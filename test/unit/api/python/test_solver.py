@@ -1213,6 +1213,20 @@ def test_assert_formula(tm, solver):
         slv.assertFormula(tm.mkTrue())
 
 
+def test_assert_formulas(tm, solver):
+    x = tm.mkConst(tm.getBooleanSort(), "x")
+    solver.assertFormulas([])
+    solver.assertFormulas([tm.mkTrue(), x])
+    assert solver.getAssertions() == [tm.mkTrue(), x]
+    with pytest.raises(RuntimeError):
+        solver.assertFormulas([tm.mkInteger(1)])
+
+    ttm = TermManager()
+    slv = Solver(ttm)
+    with pytest.raises(RuntimeError):
+        slv.assertFormulas([tm.mkTrue()])
+
+
 def test_check_sat(solver):
     solver.setOption("incremental", "false")
     solver.checkSat()
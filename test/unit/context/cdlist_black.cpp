@@ -20,6 +20,7 @@
 
 #include "base/exception.h"
 #include "context/cdlist.h"
+#include "context/cdqueue.h"
 #include "test_context.h"
 
 namespace cvc5::internal {
@@ -188,5 +189,82 @@ TEST_F(TestContextBlackCDList, emplace_back)
   ASSERT_EQ(list.size(), n);
 }
 
+
+TEST_F(TestContextBlackCDList, segmented_storage)
+{
+  using SegmentedList =
+      CDList<int32_t, DefaultCleanUp<int32_t>, SegmentedAllocator<int32_t>>;
+  SegmentedList list(d_context.get());
+  list.push_back(0);
+  const int32_t* first = &list[0];
+
+  d_context->push();
+  int32_t n = 100000;
+  for (int32_t i = 1; i < n; i++)
+  {
+    list.push_back(i);
+  }
+  // growing the list does not relocate the elements
+  ASSERT_EQ(&list[0], first);
+  ASSERT_EQ(list.size(), n);
+  int32_t i = 0;
+  for (SegmentedList::const_iterator it = list.begin(); it != list.end(); ++it)
+  {
+    ASSERT_EQ(*it, i++);
+  }
+  ASSERT_EQ(list.end() - list.begin(), n);
+  ASSERT_EQ(list.back(), n - 1);
+  d_context->pop();
+
+  ASSERT_EQ(list.size(), 1);
+  ASSERT_EQ(&list[0], first);
+  list.push_back(42);
+  ASSERT_EQ(list[1], 42);
+}
+
+TEST_F(TestContextBlackCDList, context_memory_storage)
+{
+  using CMMList = CDList<int32_t,
+                         DefaultCleanUp<int32_t>,
+                         ContextMemoryAllocator<int32_t>>;
+  CMMList list(d_context.get());
+  for (int32_t i = 0; i < 10; i++)
+  {
+    list.push_back(i);
+  }
+  for (int32_t j = 0; j < 3; j++)
+  {
+    d_context->push();
+    // more than a single segment of context memory
+    for (int32_t i = 10; i < 20000; i++)
+    {
+      list.push_back(i);
+    }
+    ASSERT_EQ(list.size(), 20000);
+    ASSERT_EQ(list[19999], 19999);
+    d_context->pop();
+    ASSERT_EQ(list.size(), 10);
+    ASSERT_EQ(list[9], 9);
+  }
+
+  CDQueue<int32_t,
+          DefaultCleanUp<int32_t>,
+          ContextMemoryAllocator<int32_t>>
+      queue(d_context.get());
+  d_context->push();
+  for (int32_t i = 0; i < 5000; i++)
+  {
+    queue.push(i);
+  }
+  while (!queue.empty())
+  {
+    queue.pop();
+  }
+  queue.push(7);
+  ASSERT_EQ(queue.front(), 7);
+  d_context->pop();
+  ASSERT_TRUE(queue.empty());
+}
+
 }  // namespace test
 }  // namespace cvc5::internal
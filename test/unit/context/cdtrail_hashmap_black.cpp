@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Andrew Reynolds, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::context::CDTrailHashMap<>.
+ */
+
+#include <map>
+
+#include "context/cdtrail_hashmap.h"
+#include "test_context.h"
+
+namespace cvc5::internal {
+namespace test {
+
+using cvc5::context::CDTrailHashMap;
+using cvc5::context::Context;
+
+class TestContextBlackCDTrailHashMap : public TestContext
+{
+ protected:
+  /** Returns the elements in a CDTrailHashMap. */
+  static std::map<int32_t, int32_t> get_elements(
+      const CDTrailHashMap<int32_t, int32_t>& map)
+  {
+    return std::map<int32_t, int32_t>{map.begin(), map.end()};
+  }
+
+  /** Returns true if the elements in map are the same as expected. */
+  static bool elements_are(const CDTrailHashMap<int32_t, int32_t>& map,
+                           const std::map<int32_t, int32_t>& expected)
+  {
+    return get_elements(map) == expected;
+  }
+};
+
+TEST_F(TestContextBlackCDTrailHashMap, simple_sequence)
+{
+  CDTrailHashMap<int32_t, int32_t> map(d_context.get());
+  ASSERT_TRUE(elements_are(map, {}));
+
+  map.insert(3, 4);
+  ASSERT_TRUE(elements_are(map, {{3, 4}}));
+
+  {
+    d_context->push();
+    ASSERT_TRUE(elements_are(map, {{3, 4}}));
+
+    ASSERT_TRUE(map.insert(5, 6));
+    ASSERT_TRUE(map.insert(9, 8));
+    ASSERT_TRUE(elements_are(map, {{3, 4}, {5, 6}, {9, 8}}));
+
+    {
+      d_context->push();
+      map.insert(1, 2);
+      ASSERT_TRUE(elements_are(map, {{1, 2}, {3, 4}, {5, 6}, {9, 8}}));
+
+      {
+        d_context->push();
+        ASSERT_FALSE(map.insert(1, 45));
+        ASSERT_FALSE(map.insert(3, 12));
+        map.insert(23, 324);
+        ASSERT_TRUE(elements_are(
+            map, {{1, 45}, {3, 12}, {5, 6}, {9, 8}, {23, 324}}));
+        ASSERT_EQ(map.size(), 5u);
+        d_context->pop();
+      }
+
+      ASSERT_TRUE(elements_are(map, {{1, 2}, {3, 4}, {5, 6}, {9, 8}}));
+      ASSERT_FALSE(map.contains(23));
+      d_context->pop();
+    }
+
+    ASSERT_TRUE(elements_are(map, {{3, 4}, {5, 6}, {9, 8}}));
+    d_context->pop();
+  }
+
+  ASSERT_TRUE(elements_are(map, {{3, 4}}));
+  ASSERT_EQ(map.size(), 1u);
+}
+
+TEST_F(TestContextBlackCDTrailHashMap, overwrite_in_same_level)
+{
+  CDTrailHashMap<int32_t, int32_t> map(d_context.get());
+  map.insert(1, 1);
+  d_context->push();
+  map.insert(2, 2);
+  map.insert(2, 3);
+  map.insert(1, 4);
+  map.insert(1, 5);
+  ASSERT_EQ(map[1], 5);
+  ASSERT_EQ(map[2], 3);
+  d_context->pop();
+  ASSERT_TRUE(elements_are(map, {{1, 1}}));
+}
+
+TEST_F(TestContextBlackCDTrailHashMap, grow)
+{
+  CDTrailHashMap<int32_t, int32_t> map(d_context.get());
+  std::map<int32_t, int32_t> expected;
+  for (int32_t i = 0; i < 100; ++i)
+  {
+    map.insert(i * 16, i);
+    expected[i * 16] = i;
+  }
+  d_context->push();
+  for (int32_t i = 0; i < 1000; ++i)
+  {
+    map.insert(i * 8, -i);
+  }
+  ASSERT_EQ(map.size(), 1000u);
+  ASSERT_EQ(map[8], -1);
+  ASSERT_EQ(map[16], -2);
+  d_context->pop();
+  ASSERT_TRUE(elements_are(map, expected));
+  // the table is still consistent after removing the elements
+  ASSERT_EQ(map.find(8), map.end());
+  map.insert(8, 1);
+  ASSERT_EQ(map[8], 1);
+  ASSERT_EQ(map.size(), 101u);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -14,12 +14,18 @@
  */
 
 #include <iostream>
+#include <optional>
 #include <vector>
 
+#include "base/configuration.h"
 #include "base/exception.h"
+#include "context/cdhashmap.h"
 #include "context/cdlist.h"
 #include "context/cdo.h"
+#include "context/cdtrail_hashmap.h"
+#include "context/context_stats.h"
 #include "test_context.h"
+#include "util/statistics_registry.h"
 
 namespace cvc5::internal {
 
@@ -193,6 +199,108 @@ TEST_F(TestContextBlack, pre_post_notify)
   d_context.reset(nullptr);
 }
 
+TEST_F(TestContextBlack, popto_multiple_levels)
+{
+  MyContextNotifyObj pre(d_context.get(), true), post(d_context.get(), false);
+  CDO<int32_t> o(d_context.get(), 0);
+  CDList<int32_t> l(d_context.get());
+  CDHashMap<int32_t, int32_t> m(d_context.get());
+  CDTrailHashMap<int32_t, int32_t> t(d_context.get());
+  for (int32_t i = 1; i <= 6; ++i)
+  {
+    d_context->push();
+    // o and the key 0 are modified at every level, the other keys only at
+    // some levels
+    o = i;
+    l.push_back(i);
+    m.insert(0, i);
+    t.insert(0, i);
+    if (i % 2 == 0)
+    {
+      m.insert(i, i);
+      t.insert(i, i);
+    }
+  }
+
+  d_context->popto(4);
+  ASSERT_EQ(d_context->getLevel(), 4u);
+  ASSERT_EQ(pre.d_ncalls, 1);
+  ASSERT_EQ(post.d_ncalls, 1);
+  ASSERT_EQ(o.get(), 4);
+  ASSERT_EQ(l.size(), 4u);
+  ASSERT_EQ(m.find(0)->second, 4);
+  ASSERT_EQ(t[0], 4);
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(t.size(), 3u);
+  ASSERT_FALSE(t.contains(6));
+
+  // modify again, then pop several levels below the modifications
+  d_context->push();
+  o = 10;
+  m.insert(0, 10);
+  t.insert(0, 10);
+  d_context->popto(1);
+  ASSERT_EQ(d_context->getLevel(), 1u);
+  ASSERT_EQ(pre.d_ncalls, 2);
+  ASSERT_EQ(post.d_ncalls, 2);
+  ASSERT_EQ(o.get(), 1);
+  ASSERT_EQ(l.size(), 1u);
+  ASSERT_EQ(m.find(0)->second, 1);
+  ASSERT_EQ(t[0], 1);
+  ASSERT_EQ(m.size(), 1u);
+  ASSERT_EQ(t.size(), 1u);
+
+  // the objects can still be modified and popped
+  d_context->push();
+  d_context->push();
+  m.insert(2, 2);
+  t.insert(2, 2);
+  d_context->popto(0);
+  ASSERT_EQ(o.get(), 0);
+  ASSERT_TRUE(l.empty());
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(t.empty());
+}
+
+TEST_F(TestContextBlack, save_restore_statistics)
+{
+  if (!configuration::isStatisticsBuild())
+  {
+    GTEST_SKIP();
+  }
+  StatisticsRegistry reg;
+  ContextStatistics stats(reg, "ctx::");
+  d_context->setStatistics(&stats);
+  {
+    std::optional<CDO<int32_t>> o;
+    std::optional<CDHashMap<int32_t, int32_t>> m;
+    {
+      ContextStatistics::OwnerScope owner("owner");
+      o.emplace(d_context.get(), 0);
+      m.emplace(d_context.get());
+    }
+    CDList<int32_t> l(d_context.get());
+    d_context->push();
+    *o = 1;
+    // the element of the map has the same owner as the map
+    m->insert(1, 1);
+    l.push_back(1);
+    l.push_back(2);
+    d_context->pop();
+  }
+  d_context->setStatistics(nullptr);
+
+  ASSERT_EQ(reg.registerInt("ctx::byType::CDO::saves").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byType::CDO::restores").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byType::CDOhash_map::saves").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byType::CDList::saves").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byType::CDList::restores").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byOwner::owner::saves").get(), 2);
+  ASSERT_EQ(reg.registerInt("ctx::byOwner::owner::restores").get(), 2);
+  ASSERT_EQ(reg.registerInt("ctx::byOwner::other::saves").get(), 1);
+  ASSERT_EQ(reg.registerInt("ctx::byOwner::other::restores").get(), 1);
+}
+
 TEST_F(TestContextBlack, detect_invalid_obj)
 {
   MyContextNotifyObj n(d_context.get(), true);
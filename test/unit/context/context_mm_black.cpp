@@ -102,5 +102,53 @@ TEST_F(TestContextBlackMM, push_pop)
 #endif
 }
 
+TEST_F(TestContextBlackMM, chunk_policy)
+{
+#ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
+  uint32_t len = ContextMemoryManager::getMaxAllocationSize();
+  // fill the initial chunk
+  d_cmm->newData(len);
+  // fills the chunks of 32 KB, 64 KB and 128 KB
+  uint32_t n = 2 + 4 + 8;
+  d_cmm->push();
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    d_cmm->newData(len);
+  }
+  d_cmm->pop();
+  const ContextMemoryStatistics& stats = d_cmm->getStatistics();
+  ASSERT_EQ(stats.d_allocated.size(), 2u);
+  ASSERT_EQ(stats.d_allocated[1], 3u);
+  ASSERT_TRUE(stats.d_reused.empty());
+  ASSERT_TRUE(stats.d_released.empty());
+
+  // the free chunks are reused
+  d_cmm->push();
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    d_cmm->newData(len);
+  }
+  d_cmm->pop();
+  ASSERT_EQ(stats.d_allocated[1], 3u);
+  ASSERT_EQ(stats.d_reused[1], 3u);
+
+  // the free chunks are released
+  ContextMemoryPolicy policy;
+  policy.d_maxChunkSize = len;
+  policy.d_maxFreeBytes = 0;
+  d_cmm->setPolicy(policy);
+  d_cmm->push();
+  d_cmm->push();
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    d_cmm->newData(len);
+  }
+  d_cmm->pop();
+  d_cmm->pop();
+  ASSERT_EQ(stats.d_allocated[2], 4u);
+  ASSERT_EQ(stats.d_released[2], 4u);
+#endif
+}
+
 }  // namespace test
 }  // namespace cvc5::internal
@@ -52,6 +52,9 @@ using TestFlag3 = Attribute<Test3, bool>;
 using TestFlag4 = Attribute<Test4, bool>;
 using TestFlag5 = Attribute<Test5, bool>;
 
+using TestDenseFlag = Attribute<Test1, bool, true>;
+using TestDenseNodeAttr = Attribute<Test1, Node, true>;
+
 class TestNodeWhiteAttribute : public TestNode
 {
  protected:
@@ -103,10 +106,36 @@ TEST_F(TestNodeWhiteAttribute, attribute_ids)
   ASSERT_NE(TestFlag3::s_id, TestFlag5::s_id);
   ASSERT_NE(TestFlag4::s_id, TestFlag5::s_id);
 
-  lastId = attr::LastAttributeId<TypeNode>::getId();
+  lastId = attr::LastAttributeId<DenseAttrTable<TypeNode>>::getId();
   ASSERT_LT(TypeAttr::s_id, lastId);
 }
 
+TEST_F(TestNodeWhiteAttribute, dense_attributes)
+{
+  std::vector<Node> vars;
+  for (size_t i = 0; i < 3000; ++i)
+  {
+    vars.push_back(d_nodeManager->mkVar(*d_booleanType));
+  }
+  for (size_t i = 0; i < vars.size(); i += 3)
+  {
+    vars[i].setAttribute(TestDenseFlag(), true);
+    vars[i].setAttribute(TestDenseNodeAttr(), vars[0]);
+  }
+  for (size_t i = 0; i < vars.size(); ++i)
+  {
+    ASSERT_EQ(vars[i].getAttribute(TestDenseFlag()), i % 3 == 0);
+    ASSERT_EQ(vars[i].hasAttribute(TestDenseNodeAttr()), i % 3 == 0);
+  }
+  Node n;
+  ASSERT_TRUE(vars[3].getAttribute(TestDenseNodeAttr(), n));
+  ASSERT_EQ(n, vars[0]);
+  ASSERT_FALSE(vars[4].getAttribute(TestDenseNodeAttr(), n));
+  vars[3].setAttribute(TestDenseFlag(), false);
+  ASSERT_FALSE(vars[3].getAttribute(TestDenseFlag()));
+  ASSERT_TRUE(vars[3].hasAttribute(TestDenseNodeAttr()));
+}
+
 TEST_F(TestNodeWhiteAttribute, attributes)
 {
   Node a = d_nodeManager->mkVar(*d_booleanType);
@@ -16,6 +16,7 @@
 #include <string>
 
 #include "expr/node_manager.h"
+#include "expr/node_manager_attributes.h"
 #include "test_node.h"
 #include "util/integer.h"
 #include "util/rational.h"
@@ -79,5 +80,44 @@ TEST_F(TestNodeWhiteNodeManager, topological_sort)
     ASSERT_EQ(NodeManager::TopologicalSort(roots), result);
   }
 }
+
+TEST_F(TestNodeWhiteNodeManager, memory_statistics)
+{
+  if (!configuration::isStatisticsBuild())
+  {
+    GTEST_SKIP();
+  }
+  const NodeManager::MemoryStatistics& mem =
+      d_nodeManager->getMemoryStatistics();
+  size_t kand = static_cast<size_t>(Kind::AND);
+  TypeNode boolType = d_nodeManager->booleanType();
+  Node i = d_skolemManager->mkDummySkolem("i", boolType);
+  d_nodeManager->reclaimZombiesAtBoundary();
+  uint64_t live = mem.d_liveNodes[kand];
+  uint64_t bytes = mem.d_liveBytes[kand];
+  {
+    std::vector<Node> nodes;
+    Node cur = i;
+    for (uint32_t k = 0; k < 10; ++k)
+    {
+      cur = d_nodeManager->mkNode(Kind::AND, i, cur);
+      nodes.push_back(cur);
+    }
+    ASSERT_EQ(mem.d_liveNodes[kand], live + 10);
+    ASSERT_EQ(mem.d_liveBytes[kand],
+              bytes + 10 * NodeValueAllocator::blockSize(2));
+    ASSERT_GE(mem.d_peakNodes[kand], live + 10);
+  }
+  d_nodeManager->reclaimZombiesAtBoundary();
+  ASSERT_EQ(mem.d_liveNodes[kand], live);
+  ASSERT_EQ(mem.d_liveBytes[kand], bytes);
+  ASSERT_GE(mem.d_peakNodes[kand], live + 10);
+
+  i.setAttribute(VarNameAttr(), "i");
+  std::vector<uint64_t> attrBytes(static_cast<size_t>(Kind::LAST_KIND), 0);
+  d_nodeManager->getAttributeMemory(attrBytes);
+  ASSERT_GT(attrBytes[static_cast<size_t>(Kind::SKOLEM)], 0u);
+}
+
 }  // namespace test
 }  // namespace cvc5::internal
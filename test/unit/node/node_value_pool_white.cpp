@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of cvc5::internal::expr::NodeValuePool.
+ */
+
+#include <vector>
+
+#include "expr/node_value_pool.h"
+#include "test_node.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace cvc5::internal::expr;
+
+namespace test {
+
+class TestNodeWhiteNodeValuePool : public TestNode
+{
+};
+
+TEST_F(TestNodeWhiteNodeValuePool, insert_find_erase)
+{
+  std::vector<Node> nodes;
+  for (uint32_t i = 0; i < 5000; ++i)
+  {
+    nodes.push_back(d_nodeManager->mkConstInt(Rational(i)));
+  }
+  NodeValuePool pool;
+  ASSERT_TRUE(pool.empty());
+  for (const Node& n : nodes)
+  {
+    ASSERT_EQ(pool.find(n.d_nv), nullptr);
+    pool.insert(n.d_nv);
+  }
+  ASSERT_EQ(pool.size(), nodes.size());
+  for (const Node& n : nodes)
+  {
+    ASSERT_EQ(pool.find(n.d_nv), n.d_nv);
+  }
+  // erase every other node and check that the remaining ones are still found
+  for (size_t i = 0; i < nodes.size(); i += 2)
+  {
+    pool.erase(nodes[i].d_nv);
+  }
+  ASSERT_EQ(pool.size(), nodes.size() / 2);
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    ASSERT_EQ(pool.find(nodes[i].d_nv), i % 2 == 0 ? nullptr : nodes[i].d_nv);
+  }
+  size_t count = 0;
+  for (NodeValuePool::const_iterator it = pool.begin(); it != pool.end(); ++it)
+  {
+    ASSERT_NE(*it, nullptr);
+    ++count;
+  }
+  ASSERT_EQ(count, pool.size());
+  ASSERT_GE(pool.getNumProbes(), pool.getNumLookups());
+  ASSERT_GE(pool.getMaxProbeLength(), 1u);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of cvc5::internal::expr::NodeVisitedSet.
+ */
+
+#include <vector>
+
+#include "expr/node_visited_set.h"
+#include "test_node.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace cvc5::internal::expr;
+
+namespace test {
+
+class TestNodeWhiteNodeVisitedSet : public TestNode
+{
+};
+
+TEST_F(TestNodeWhiteNodeVisitedSet, insert_contains)
+{
+  std::vector<Node> nodes;
+  for (uint32_t i = 0; i < 3000; ++i)
+  {
+    nodes.push_back(d_nodeManager->mkConstInt(Rational(i)));
+  }
+  {
+    NodeVisitedSet visited(d_nodeManager.get());
+    for (size_t i = 0; i < nodes.size(); i += 2)
+    {
+      ASSERT_TRUE(visited.insert(nodes[i]));
+    }
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+      ASSERT_EQ(visited.contains(nodes[i]), i % 2 == 0);
+      ASSERT_EQ(visited.insert(nodes[i]), i % 2 == 1);
+    }
+  }
+  // a new set is empty, even though it reuses the stamp array of the
+  // previous one
+  NodeVisitedSet visited(d_nodeManager.get());
+  for (const Node& n : nodes)
+  {
+    ASSERT_FALSE(visited.contains(n));
+  }
+  // nested sets are independent
+  ASSERT_TRUE(visited.insert(nodes[0]));
+  {
+    NodeVisitedSet inner(d_nodeManager.get());
+    ASSERT_FALSE(inner.contains(nodes[0]));
+    ASSERT_TRUE(inner.insert(nodes[1]));
+  }
+  ASSERT_TRUE(visited.contains(nodes[0]));
+  ASSERT_FALSE(visited.contains(nodes[1]));
+  // the null node does not belong to a node manager
+  NodeVisitedSet nullVisited(nullptr);
+  ASSERT_TRUE(nullVisited.insert(Node::null()));
+  ASSERT_TRUE(nullVisited.contains(Node::null()));
+}
+
+TEST_F(TestNodeWhiteNodeVisitedSet, reset)
+{
+  VisitedStamps stamps;
+  ASSERT_FALSE(stamps.contains(5));
+  ASSERT_TRUE(stamps.insert(5));
+  ASSERT_TRUE(stamps.contains(5));
+  ASSERT_FALSE(stamps.contains(100000));
+  ASSERT_TRUE(stamps.insert(100000));
+  ASSERT_GT(stamps.capacity(), 100000u);
+  for (uint32_t i = 0; i < 1000; ++i)
+  {
+    stamps.reset();
+    ASSERT_FALSE(stamps.contains(5));
+    ASSERT_FALSE(stamps.contains(100000));
+    ASSERT_TRUE(stamps.insert(5));
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::prop::ClauseExchange.
+ */
+
+#include <thread>
+
+#include "prop/clause_exchange.h"
+#include "test.h"
+
+namespace cvc5::internal {
+
+using namespace prop;
+
+namespace test {
+
+class TestPropBlackClauseExchange : public TestInternal
+{
+};
+
+TEST_F(TestPropBlackClauseExchange, exchange)
+{
+  ClauseExchange exchange(3, 2);
+  SatClause c1 = {SatLiteral(1), SatLiteral(2, true)};
+  SatClause c2 = {SatLiteral(3)};
+  SatClause c3 = {SatLiteral(1), SatLiteral(2), SatLiteral(3)};
+  ASSERT_FALSE(exchange.hasNewClauses(0));
+  exchange.exportClause(0, c1);
+  exchange.exportClause(1, c2);
+  // too long
+  exchange.exportClause(1, c3);
+  ASSERT_EQ(exchange.getNumExported(), 2);
+
+  std::vector<SatClause> clauses;
+  ASSERT_TRUE(exchange.hasNewClauses(0));
+  exchange.importClauses(0, clauses);
+  ASSERT_EQ(clauses, std::vector<SatClause>({c2}));
+  ASSERT_FALSE(exchange.hasNewClauses(0));
+
+  clauses.clear();
+  exchange.importClauses(2, clauses);
+  ASSERT_EQ(clauses, std::vector<SatClause>({c1, c2}));
+  clauses.clear();
+  exchange.importClauses(2, clauses);
+  ASSERT_TRUE(clauses.empty());
+
+  exchange.exportClause(2, c2);
+  clauses.clear();
+  exchange.importClauses(1, clauses);
+  ASSERT_EQ(clauses, std::vector<SatClause>({c1, c2}));
+  clauses.clear();
+  exchange.importClauses(0, clauses);
+  ASSERT_EQ(clauses, std::vector<SatClause>({c2}));
+}
+
+TEST_F(TestPropBlackClauseExchange, threads)
+{
+  const size_t n = 4, m = 1000;
+  ClauseExchange exchange(n, 1);
+  std::vector<std::vector<SatClause>> imported(n);
+  std::vector<std::thread> threads;
+  for (size_t id = 0; id < n; ++id)
+  {
+    threads.emplace_back([&, id]() {
+      for (size_t i = 0; i < m; ++i)
+      {
+        exchange.exportClause(id, {SatLiteral(id + 1)});
+        if (exchange.hasNewClauses(id))
+        {
+          exchange.importClauses(id, imported[id]);
+        }
+      }
+    });
+  }
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+  for (size_t id = 0; id < n; ++id)
+  {
+    exchange.importClauses(id, imported[id]);
+    ASSERT_EQ(imported[id].size(), (n - 1) * m);
+    for (const SatClause& c : imported[id])
+    {
+      ASSERT_NE(c[0], SatLiteral(id + 1));
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -15,6 +15,7 @@
 
 #include "base/check.h"
 #include "context/context.h"
+#include "options/prop_options.h"
 #include "prop/cnf_stream.h"
 #include "prop/prop_engine.h"
 #include "prop/registrar.h"
@@ -40,7 +41,9 @@ namespace test {
 class FakeSatSolver : public SatSolver
 {
  public:
-  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false) {}
+  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false), d_numClauses(0)
+  {
+  }
 
   SatVariable newVar(bool theoryAtom, bool canErase) override
   {
@@ -54,6 +57,7 @@ class FakeSatSolver : public SatSolver
   ClauseId addClause(SatClause& c, bool lemma) override
   {
     d_addClauseCalled = true;
+    ++d_numClauses;
     return ClauseIdUndef;
   }
 
@@ -69,6 +73,8 @@ class FakeSatSolver : public SatSolver
 
   unsigned int addClauseCalled() { return d_addClauseCalled; }
 
+  size_t numClauses() const { return d_numClauses; }
+
   unsigned getAssertionLevel() const override { return 0; }
 
   bool isDecision(Node) const { return false; }
@@ -99,6 +105,7 @@ class FakeSatSolver : public SatSolver
  private:
   SatVariable d_nextVar;
   bool d_addClauseCalled;
+  size_t d_numClauses;
 };
 
 class TestPropWhiteCnfStream : public TestSmt
@@ -133,6 +140,17 @@ class TestPropWhiteCnfStream : public TestSmt
   std::unique_ptr<Context> d_cnfContext;
   /** The registrar used by the CnfStream. */
   std::unique_ptr<prop::NullRegistrar> d_cnfRegistrar;
+
+  /** Recreate the CnfStream with the given CNF conversion options. */
+  void resetCnfStream(bool structHash, bool polarity)
+  {
+    d_slvEngine->getOptions().write_prop().cnfStructHash = structHash;
+    d_slvEngine->getOptions().write_prop().cnfPolarity = polarity;
+    d_cnfStream.reset(new prop::CnfStream(d_slvEngine->getEnv(),
+                                          d_satSolver.get(),
+                                          d_cnfRegistrar.get(),
+                                          d_cnfContext.get()));
+  }
 };
 
 /**
@@ -253,5 +271,49 @@ TEST_F(TestPropWhiteCnfStream, ensure_literal)
   ASSERT_TRUE(d_satSolver->addClauseCalled());
   ASSERT_TRUE(d_cnfStream->hasLiteral(a_and_b));
 }
+
+TEST_F(TestPropWhiteCnfStream, struct_hash)
+{
+  resetCnfStream(true, false);
+  Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node n1 = d_nodeManager->mkNode(
+      Kind::AND, a, d_nodeManager->mkNode(Kind::AND, b, c));
+  Node n2 = d_nodeManager->mkNode(
+      Kind::AND, d_nodeManager->mkNode(Kind::AND, c, a), b);
+  Node n3 = d_nodeManager->mkNode(
+      Kind::OR,
+      c.notNode(),
+      d_nodeManager->mkNode(Kind::OR, b.notNode(), a.notNode()));
+  d_cnfStream->ensureLiteral(n1);
+  size_t numClauses = d_satSolver->numClauses();
+  d_cnfStream->ensureLiteral(n2);
+  d_cnfStream->ensureLiteral(n3);
+  // the conjunctions are flattened and share their gate
+  ASSERT_EQ(d_satSolver->numClauses(), numClauses);
+  ASSERT_EQ(d_cnfStream->getLiteral(n1), d_cnfStream->getLiteral(n2));
+  ASSERT_EQ(d_cnfStream->getLiteral(n1), ~d_cnfStream->getLiteral(n3));
+  // the nested conjunction is not given a literal
+  ASSERT_FALSE(d_cnfStream->hasLiteral(n1[1]));
+}
+
+TEST_F(TestPropWhiteCnfStream, polarity)
+{
+  resetCnfStream(false, true);
+  Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node a_and_b = d_nodeManager->mkNode(Kind::AND, a, b);
+  // (a & b) occurs positively, so only l -> a and l -> b are needed
+  d_cnfStream->convertAndAssert(
+      d_nodeManager->mkNode(Kind::OR, a_and_b, c), false, false);
+  ASSERT_EQ(d_satSolver->numClauses(), 3);
+  // the missing direction is added when the literal is required
+  d_cnfStream->ensureLiteral(a_and_b);
+  ASSERT_EQ(d_satSolver->numClauses(), 4);
+  d_cnfStream->ensureLiteral(a_and_b);
+  ASSERT_EQ(d_satSolver->numClauses(), 4);
+}
 }  // namespace test
 }  // namespace cvc5::internal
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Aina Niemetz, Andrew Reynolds, Mathias Preiner
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::SolverEngine.
+ */
+
+#include "base/modal_exception.h"
+#include "options/smt_options.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+#include "test_smt.h"
+#include "theory/smt_engine_subsolver.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestSmtBlackSolverEngine : public TestSmtNoFinishInit
+{
+};
+
+TEST_F(TestSmtBlackSolverEngine, clone_preprocessed)
+{
+  d_slvEngine->setOption("pp-clones", "true");
+  d_slvEngine->setOption("produce-models", "true");
+  d_slvEngine->setLogic(std::string("QF_LIA"));
+  NodeManager* nm = d_nodeManager.get();
+  TypeNode intType = nm->integerType();
+  Node x = NodeManager::mkDummySkolem("x", intType);
+  Node y = NodeManager::mkDummySkolem("y", intType);
+  Node zero = nm->mkConstInt(Rational(0));
+  Node one = nm->mkConstInt(Rational(1));
+  Node ten = nm->mkConstInt(Rational(10));
+  d_slvEngine->assertFormula(nm->mkNode(Kind::GT, x, zero));
+  d_slvEngine->assertFormula(nm->mkNode(Kind::LT, x, ten));
+  d_slvEngine->assertFormula(
+      nm->mkNode(Kind::EQUAL, y, nm->mkNode(Kind::ADD, x, one)));
+  ASSERT_EQ(d_slvEngine->checkSat().getStatus(), Result::SAT);
+
+  // each clone solves a cube
+  std::unique_ptr<SolverEngine> c1 = d_slvEngine->clonePreprocessed();
+  ASSERT_EQ(c1->checkSat(nm->mkNode(Kind::GT, y, ten)).getStatus(),
+            Result::UNSAT);
+  std::unique_ptr<SolverEngine> c2 = d_slvEngine->clonePreprocessed();
+  Node three = nm->mkConstInt(Rational(3));
+  ASSERT_EQ(c2->checkSat(nm->mkNode(Kind::EQUAL, x, three)).getStatus(),
+            Result::SAT);
+  ASSERT_EQ(c2->getValue(y), nm->mkConstInt(Rational(4)));
+}
+
+TEST_F(TestSmtBlackSolverEngine, clone_preprocessed_requires_option)
+{
+  d_slvEngine->setLogic(std::string("QF_LIA"));
+  ASSERT_THROW(d_slvEngine->clonePreprocessed(), ModalException);
+}
+
+TEST_F(TestSmtBlackSolverEngine, subsolver_options_cache)
+{
+  d_slvEngine->setLogic(std::string("QF_LIA"));
+  d_slvEngine->finishInit();
+  const Env& env = d_slvEngine->getEnv();
+  // the second subsolver uses the defaults cached for the first one
+  std::unique_ptr<SolverEngine> s1;
+  theory::initializeSubsolver(s1, env, false, 0);
+  s1->finishInit();
+  std::unique_ptr<SolverEngine> s2;
+  theory::initializeSubsolver(s2, env, false, 0);
+  s2->finishInit();
+  ASSERT_TRUE(s1->getOptions().hasEqualValues(s2->getOptions()));
+  ASSERT_TRUE(s1->getLogicInfo() == s2->getLogicInfo());
+  // they are the defaults computed for a subsolver without the cache
+  theory::SubsolverSetupInfo ssi(env.getOptions(), env.getLogicInfo());
+  std::unique_ptr<SolverEngine> s3;
+  theory::initializeSubsolver(d_nodeManager.get(), s3, ssi, false, 0);
+  s3->finishInit();
+  ASSERT_TRUE(s1->getOptions().hasEqualValues(s3->getOptions()));
+  ASSERT_TRUE(s1->getLogicInfo() == s3->getLogicInfo());
+  // options set before initialization are not ignored
+  std::unique_ptr<SolverEngine> s4;
+  theory::initializeSubsolver(s4, env, false, 0);
+  s4->setOption("produce-models", "true");
+  s4->finishInit();
+  ASSERT_TRUE(s4->getOptions().smt.produceModels);
+  ASSERT_FALSE(s1->getOptions().hasEqualValues(s4->getOptions()));
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -98,6 +98,53 @@ TEST_F(TestTheoryWhiteEvaluator, loop)
                 args.begin(), args.end(), vals.begin(), vals.end())));
 }
 
+TEST_F(TestTheoryWhiteEvaluator, compiled)
+{
+  TypeNode intType = d_nodeManager->integerType();
+
+  Node x = d_nodeManager->mkVar("x", intType);
+  Node y = d_nodeManager->mkVar("y", intType);
+  Node two = d_nodeManager->mkConstInt(Rational(2));
+  Node three = d_nodeManager->mkConstInt(Rational(3));
+
+  // (+ (* x 2) (* 2 3) (ite (>= x y) (* 3 3) y))
+  Node c = d_nodeManager->mkNode(Kind::MULT, two, three);
+  Node t = d_nodeManager->mkNode(
+      Kind::ADD,
+      d_nodeManager->mkNode(Kind::MULT, x, two),
+      c,
+      d_nodeManager->mkNode(Kind::ITE,
+                            d_nodeManager->mkNode(Kind::GEQ, x, y),
+                            d_nodeManager->mkNode(Kind::MULT, three, three),
+                            y));
+
+  std::vector<Node> args = {x, y};
+  Rewriter* rr = d_slvEngine->getEnv().getRewriter();
+  Evaluator eval(rr);
+  CompiledTerm ct = eval.compile(t, args);
+  ASSERT_EQ(ct.getTerm(), t);
+  // (* 2 3) and (* 3 3) are cached
+  ASSERT_EQ(ct.getNumCached(), 2);
+  for (int64_t i = -2; i <= 2; i++)
+  {
+    for (int64_t j = -2; j <= 2; j++)
+    {
+      std::vector<Node> vals = {d_nodeManager->mkConstInt(Rational(i)),
+                                d_nodeManager->mkConstInt(Rational(j))};
+      Node r = eval.eval(ct, vals);
+      ASSERT_EQ(r, eval.eval(t, args, vals));
+      int64_t expected = 2 * i + 6 + (i >= j ? 9 : j);
+      ASSERT_EQ(r, d_nodeManager->mkConstInt(Rational(expected)));
+    }
+  }
+
+  // a term without the variables is cached as a whole
+  CompiledTerm cc = eval.compile(c, args);
+  ASSERT_EQ(cc.getNumCached(), 1);
+  std::vector<Node> vals = {two, three};
+  ASSERT_EQ(eval.eval(cc, vals), d_nodeManager->mkConstInt(Rational(6)));
+}
+
 TEST_F(TestTheoryWhiteEvaluator, strIdOf)
 {
   Node a = d_nodeManager->mkConst(String("A"));
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Top contributors (to current version):
+ *   Dejan Jovanovic, Andrew Reynolds
+ *
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::theory::eq::ApplicationLookupTable.
+ */
+
+#include <vector>
+
+#include "test.h"
+#include "theory/uf/application_lookup_table.h"
+
+namespace cvc5::internal {
+
+using namespace theory::eq;
+
+namespace test {
+
+class TestTheoryBlackUfApplicationLookupTable : public TestInternal
+{
+};
+
+TEST_F(TestTheoryBlackUfApplicationLookupTable, insert_find)
+{
+  ApplicationLookupTable table;
+  FunctionApplication f(APP_UNINTERPRETED, 1, 2);
+  FunctionApplication g(APP_INTERPRETED, 1, 2);
+  FunctionApplication e(APP_EQUALITY, 2, 1);
+  ASSERT_EQ(table.find(f), null_id);
+  table.insert(f, 10);
+  table.insert(g, 11);
+  table.insert(e, 12);
+  ASSERT_EQ(table.size(), 3);
+  ASSERT_EQ(table.find(f), 10);
+  ASSERT_EQ(table.find(g), 11);
+  ASSERT_EQ(table.find(e), 12);
+  ASSERT_EQ(table.find(FunctionApplication(APP_EQUALITY, 1, 2)), null_id);
+  table.erase(g);
+  ASSERT_EQ(table.find(g), null_id);
+  ASSERT_EQ(table.find(f), 10);
+  ASSERT_EQ(table.find(e), 12);
+  ASSERT_EQ(table.size(), 2);
+}
+
+TEST_F(TestTheoryBlackUfApplicationLookupTable, grow_and_backtrack)
+{
+  ApplicationLookupTable table;
+  const EqualityNodeId n = 2000;
+  std::vector<FunctionApplication> apps;
+  for (EqualityNodeId i = 0; i < n; ++i)
+  {
+    apps.emplace_back(APP_UNINTERPRETED, i % 37, i);
+    table.insert(apps.back(), i);
+  }
+  ASSERT_EQ(table.size(), n);
+  // erase in reverse order of insertion, as the equality engine does when
+  // backtracking, checking that the remaining entries are still found
+  for (EqualityNodeId i = n; i-- > 0;)
+  {
+    table.erase(apps[i]);
+    ASSERT_EQ(table.find(apps[i]), null_id);
+    if (i > 0)
+    {
+      ASSERT_EQ(table.find(apps[i / 2]), i / 2);
+    }
+  }
+  ASSERT_EQ(table.size(), 0);
+  // erase in an arbitrary order
+  for (EqualityNodeId i = 0; i < n; ++i)
+  {
+    table.insert(apps[i], i);
+  }
+  for (EqualityNodeId i = 0; i < n; i += 2)
+  {
+    table.erase(apps[i]);
+  }
+  for (EqualityNodeId i = 0; i < n; ++i)
+  {
+    ASSERT_EQ(table.find(apps[i]), i % 2 == 0 ? null_id : i);
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
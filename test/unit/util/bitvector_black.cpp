@@ -206,5 +206,36 @@ TEST_F(TestUtilBlackBitVector, static_helpers)
   ASSERT_EQ(BitVector::mkMinSigned(4).toSignedInteger(), Integer(-8));
   ASSERT_EQ(BitVector::mkMaxSigned(4).toSignedInteger(), Integer(7));
 }
+TEST_F(TestUtilBlackBitVector, word_boundary)
+{
+  // widths around the boundary of the machine word representation
+  BitVector ones64 = BitVector::mkOnes(64);
+  ASSERT_EQ(ones64.getValue(), Integer("18446744073709551615"));
+  ASSERT_EQ(ones64 + BitVector::mkOne(64), BitVector::mkZero(64));
+  ASSERT_EQ(ones64.toSignedInteger(), Integer(-1));
+  ASSERT_EQ(BitVector::mkMinSigned(64).toSignedInteger(),
+            Integer("-9223372036854775808"));
+  ASSERT_TRUE(BitVector::mkMinSigned(64).signedLessThan(ones64));
+  ASSERT_EQ(ones64.zeroExtend(1).getValue(), ones64.getValue());
+  ASSERT_EQ(ones64.signExtend(1), BitVector::mkOnes(65));
+  ASSERT_EQ(BitVector::mkOnes(65).extract(63, 0), ones64);
+  ASSERT_EQ(BitVector::mkOnes(32).concat(BitVector::mkOnes(32)), ones64);
+  ASSERT_EQ(ones64.concat(BitVector::mkOne(1)).getValue(),
+            Integer("36893488147419103231"));
+  ASSERT_EQ(BitVector(64, Integer(-1)), ones64);
+  ASSERT_EQ(ones64 * ones64, BitVector::mkOne(64));
+  ASSERT_EQ(ones64.unsignedDivTotal(BitVector::mkZero(64)), ones64);
+  ASSERT_EQ(ones64.arithRightShift(BitVector(64, 100u)), ones64);
+  ASSERT_EQ(ones64.logicalRightShift(BitVector(64, 63u)),
+            BitVector::mkOne(64));
+  ASSERT_EQ(BitVector(64, Integer(1).multiplyByPow2(64)),
+            BitVector::mkZero(64));
+  ASSERT_EQ(BitVector::mkOne(64).leftShift(BitVector(64, 63u)),
+            BitVector::mkMinSigned(64));
+  ASSERT_EQ(BitVector::mkMinSigned(65).extract(64, 1),
+            BitVector::mkMinSigned(64));
+  ASSERT_EQ(ones64.toString(2), std::string(64, '1'));
+  ASSERT_EQ(ones64.toString(16), "ffffffffffffffff");
+}
 }  // namespace test
 }  // namespace cvc5::internal
@@ -613,5 +613,34 @@ TEST_F(TestUtilBlackInteger, modInverse)
     }
   }
 }
+TEST_F(TestUtilBlackInteger, machine_word_boundary)
+{
+  // values around the boundary of the inline representation
+  int64_t max = std::numeric_limits<int64_t>::max();
+  Integer a(max);
+  Integer b = a + 1;
+  ASSERT_EQ(b.toString(), "9223372036854775808");
+  ASSERT_EQ(b - 1, a);
+  ASSERT_EQ((b - 1).hash(), a.hash());
+  ASSERT_GT(b, a);
+  ASSERT_LT(-b, -a);
+  ASSERT_EQ(-b - 1, Integer("-9223372036854775809"));
+  ASSERT_EQ(a * a, Integer("85070591730234615847396907784232501249"));
+  ASSERT_EQ((a * a).exactQuotient(a), a);
+  ASSERT_EQ((b * b).floorDivideQuotient(b), b);
+  ASSERT_EQ(Integer(max).gcd(b), 1);
+  ASSERT_EQ(Integer(std::numeric_limits<int64_t>::min()),
+            Integer("-9223372036854775808"));
+  ASSERT_EQ(Integer(std::numeric_limits<int64_t>::min()).abs(), b);
+  ASSERT_EQ(Integer(3037000500) * Integer(3037000500),
+            Integer("9223372037000250000"));
+  ASSERT_EQ(Integer(-3037000500) * Integer(3037000500),
+            Integer("-9223372037000250000"));
+  ASSERT_EQ(Integer(2).pow(62) + Integer(2).pow(62), Integer(2).pow(63));
+  ASSERT_EQ(Integer(2).pow(63).isPow2(), 64);
+  ASSERT_EQ(Integer(2).pow(62).isPow2(), 63);
+  ASSERT_EQ(Integer(2).pow(63).length(), 64);
+  ASSERT_EQ(Integer(max).length(), 63);
+}
 }  // namespace test
 }  // namespace cvc5::internal
@@ -13,6 +13,7 @@
  * Black box testing of cvc5::Rational.
  */
 
+#include <limits>
 #include <sstream>
 
 #include "test.h"
@@ -42,5 +43,53 @@ TEST_F(TestUtilBlackRational, fromDecimal)
   ASSERT_THROW(Rational::fromDecimal("1.2/3");, std::invalid_argument);
   ASSERT_THROW(Rational::fromDecimal("Hello, world!");, std::invalid_argument);
 }
+TEST_F(TestUtilBlackRational, machine_word_boundary)
+{
+  // values around the boundary of the inline representation
+  Integer max(std::numeric_limits<int64_t>::max());
+  Rational a(max, Integer(3));
+  Rational b(Integer(1), max);
+  ASSERT_EQ(a * b, Rational(1, 3));
+  ASSERT_EQ((a * b).hash(), Rational(1, 3).hash());
+  ASSERT_EQ(a + a + a, Rational(max));
+  ASSERT_EQ(Rational(max) + Rational(1),
+            Rational(Integer("9223372036854775808")));
+  ASSERT_EQ((Rational(max) + Rational(1)) - Rational(1), Rational(max));
+  ASSERT_EQ(b + b, Rational(Integer(2), max));
+  ASSERT_EQ(b * b, Rational(Integer(1), max * max));
+  ASSERT_EQ(b * b / b, b);
+  ASSERT_EQ(Rational(Integer(1), max) + Rational(Integer(1), max - 1),
+            Rational(max + max - 1, max * (max - 1)));
+  ASSERT_LT(Rational(Integer(1), max), Rational(Integer(1), max - 1));
+  ASSERT_GT(Rational(max, max - 1), Rational(max - 1, max - 2) - 1);
+  ASSERT_EQ(Rational(max * 2, Integer(2)), Rational(max));
+  ASSERT_EQ(Rational(max * 2, Integer(2)).hash(), Rational(max).hash());
+  ASSERT_EQ(Rational(Integer(-7), Integer(2)).floor(), -4);
+  ASSERT_EQ(Rational(Integer(-7), Integer(2)).ceiling(), -3);
+  ASSERT_EQ(Rational(Integer(7), Integer(-2)), Rational(-7, 2));
+  ASSERT_EQ(Rational(-7, 2).inverse(), Rational(-2, 7));
+  ASSERT_EQ(Rational(-7, 2).toString(), "-7/2");
+}
+
+TEST_F(TestUtilBlackRational, addProduct)
+{
+  Rational c(5);
+  c.addProduct(Rational(3), Rational(-4));
+  ASSERT_EQ(c, Rational(-7));
+  c.addProduct(Rational(1, 2), Rational(2, 3));
+  ASSERT_EQ(c, Rational(-20, 3));
+  c.addProduct(Rational(-1, 3), Rational(-1));
+  ASSERT_EQ(c, Rational(-19, 3));
+  // the product or the sum do not fit into a machine word
+  Integer max(std::numeric_limits<int64_t>::max());
+  Rational d(1);
+  d.addProduct(Rational(max), Rational(2));
+  ASSERT_EQ(d, Rational(max * 2 + 1));
+  d.addProduct(Rational(max), Rational(-2));
+  ASSERT_EQ(d, Rational(1));
+  d = Rational(max);
+  d.addProduct(Rational(1), Rational(1));
+  ASSERT_EQ(d, Rational(max + 1));
+}
 }  // namespace test
 }  // namespace cvc5::internal
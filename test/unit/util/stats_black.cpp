@@ -19,6 +19,7 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "lib/clock_gettime.h"
 #include "cvc5/cvc5_proof_rule.h"
@@ -97,5 +98,42 @@ TEST_F(TestUtilBlackStats, stats)
   ASSERT_EQ(reg.get("backedDoubleNoDec"), std::string("17"));
 #endif
 }
+
+TEST_F(TestUtilBlackStats, concurrent)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false, false, false);
+  ConcurrentIntStat cint = reg.registerConcurrentInt("cint");
+  ASSERT_EQ(reg.get("cint"), std::string("0"));
+  ASSERT_TRUE(reg.get("cint")->isDefault());
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 20; ++i)
+  {
+    threads.emplace_back([&cint]() {
+      for (size_t j = 0; j < 1000; ++j)
+      {
+        ++cint;
+      }
+      cint += 5;
+    });
+  }
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+  ASSERT_EQ(cint.get(), 20 * 1005);
+  ASSERT_EQ(reg.get("cint"), std::string("20100"));
+
+  CoarseTimerStat timer = reg.registerCoarseTimer("coarse-timer");
+  {
+    CodeTimer ct(timer);
+    ASSERT_TRUE(timer.running());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  ASSERT_FALSE(timer.running());
+  ASSERT_FALSE(reg.get("coarse-timer")->isDefault());
+#endif
+}
 }  // namespace test
 }  // namespace cvc5::internal